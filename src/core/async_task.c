@@ -34,6 +34,12 @@
 #include <arpa/inet.h>
 #include <fcntl.h>
 #include <errno.h>
+#include <stdint.h>
+#include <sys/time.h>
+#ifdef __OS_linux
+#include <sys/eventfd.h>
+#define ASYNC_TASK_EVENTFD
+#endif
 
 #include "dprint.h"
 #include "sr_module.h"
@@ -41,6 +47,7 @@
 #include "pt.h"
 #include "cfg/cfg_struct.h"
 #include "parser/parse_param.h"
+#include "mem/shm_mem.h"
 
 
 #include "async_task.h"
@@ -68,6 +75,17 @@ int async_task_workers_active(void)
 	return 1;
 }
 
+/**
+ *
+ */
+static inline unsigned long long async_task_now_us(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return (unsigned long long)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
 /**
  *
  */
@@ -77,6 +95,16 @@ int async_task_init_sockets(void)
 	async_wgroup_t *awg;
 
 	for(awg=_async_wgroup_list; awg!=NULL; awg=awg->next) {
+		awg->efd = -1;
+#ifdef ASYNC_TASK_EVENTFD
+		awg->efd = eventfd(0, EFD_SEMAPHORE);
+		if(awg->efd >= 0) {
+			continue;
+		}
+		LM_WARN("failed to create eventfd for group [%.*s] (%d: %s)"
+				" - using sockets\n", awg->name.len, awg->name.s,
+				errno, strerror(errno));
+#endif
 		if (socketpair(PF_UNIX, SOCK_DGRAM, 0, awg->sockets) < 0) {
 			LM_ERR("opening tasks dgram socket pair\n");
 			return -1;
@@ -108,7 +136,9 @@ void async_task_close_sockets_child(void)
 	LM_DBG("closing the notification socket used by children\n");
 
 	for(awg=_async_wgroup_list; awg!=NULL; awg=awg->next) {
-		close(awg->sockets[1]);
+		if(awg->efd < 0) {
+			close(awg->sockets[1]);
+		}
 	}
 }
 
@@ -122,8 +152,144 @@ void async_task_close_sockets_parent(void)
 	LM_DBG("closing the notification socket used by parent\n");
 
 	for(awg=_async_wgroup_list; awg!=NULL; awg=awg->next) {
-		close(awg->sockets[0]);
+		if(awg->efd < 0) {
+			close(awg->sockets[0]);
+		}
+	}
+}
+
+/**
+ * create the shm queues of the groups
+ */
+static int async_task_init_queues(void)
+{
+	async_wgroup_t *awg;
+	char hname[128];
+
+	for(awg=_async_wgroup_list; awg!=NULL; awg=awg->next) {
+		awg->queue = (async_tqueue_t*)shm_malloc(sizeof(async_tqueue_t));
+		if(awg->queue==NULL) {
+			SHM_MEM_ERROR;
+			return -1;
+		}
+		memset(awg->queue, 0, sizeof(async_tqueue_t));
+		if(lock_init(&awg->queue->lock)==NULL) {
+			LM_ERR("failed to init the lock for group [%.*s]\n",
+					awg->name.len, awg->name.s);
+			return -1;
+		}
+		if(awg->batch<=0) {
+			awg->batch = 1;
+		} else if(awg->batch>ASYNC_TASK_BATCH_MAX) {
+			awg->batch = ASYNC_TASK_BATCH_MAX;
+		}
+		snprintf(hname, sizeof(hname), "%.*s_wait_us", awg->name.len,
+				awg->name.s);
+		if(counter_register_hist(&awg->hwait, "async_task", hname, 0,
+					"time spent by the tasks in the queue (microseconds)",
+					0)<0) {
+			LM_ERR("failed to register the histogram for group [%.*s]\n",
+					awg->name.len, awg->name.s);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/**
+ * wake up one worker of the group
+ */
+static void async_task_wakeup(async_wgroup_t *awg)
+{
+	char c = 0;
+#ifdef ASYNC_TASK_EVENTFD
+	uint64_t v = 1;
+
+	if(awg->efd >= 0) {
+		if(write(awg->efd, &v, sizeof(v)) != sizeof(v)) {
+			LM_ERR("failed to notify group [%.*s] (%d: %s)\n",
+					awg->name.len, awg->name.s, errno, strerror(errno));
+		}
+		return;
+	}
+#endif
+	if(write(awg->sockets[1], &c, 1) != 1) {
+		LM_ERR("failed to notify group [%.*s] (%d: %s)\n",
+				awg->name.len, awg->name.s, errno, strerror(errno));
+	}
+}
+
+/**
+ * wait for a notification
+ */
+static int async_task_wait(async_wgroup_t *awg)
+{
+	char c;
+#ifdef ASYNC_TASK_EVENTFD
+	uint64_t v;
+
+	if(awg->efd >= 0) {
+		if(read(awg->efd, &v, sizeof(v)) != sizeof(v)) {
+			if(errno != EINTR) {
+				LM_ERR("failed to get notification (%d: %s)\n", errno,
+						strerror(errno));
+			}
+			return -1;
+		}
+		return 0;
+	}
+#endif
+	if(recvfrom(awg->sockets[0], &c, 1, 0, NULL, 0) < 0) {
+		if(errno != EINTR) {
+			LM_ERR("failed to get notification (%d: %s)\n", errno,
+					strerror(errno));
+		}
+		return -1;
 	}
+	return 0;
+}
+
+/**
+ * take up to n tasks from the queue, in the order of priorities
+ */
+static int async_task_pop(async_wgroup_t *awg, async_task_t **tasks, int n)
+{
+	async_tqueue_t *q;
+	async_task_t *t;
+	unsigned long long now;
+	unsigned int w;
+	int k;
+	int p;
+
+	q = awg->queue;
+	now = async_task_now_us();
+	k = 0;
+	lock_get(&q->lock);
+	for(p=0; p<ASYNC_TASK_PRIOS && k<n; p++) {
+		while(k<n && q->first[p]!=NULL) {
+			t = q->first[p];
+			q->first[p] = t->next;
+			if(q->first[p]==NULL) {
+				q->last[p] = NULL;
+			}
+			q->size[p]--;
+			w = (now > t->qtime) ? (unsigned int)(now - t->qtime) : 0;
+			q->wait_us += w;
+			if(w > q->wait_max_us) {
+				q->wait_max_us = w;
+			}
+			q->popped++;
+			t->next = NULL;
+			tasks[k++] = t;
+		}
+	}
+	lock_release(&q->lock);
+
+	for(p=0; p<k; p++) {
+		counter_hist_add(awg->hwait,
+				(now > tasks[p]->qtime) ? (now - tasks[p]->qtime) : 0);
+	}
+	return k;
 }
 
 /**
@@ -149,6 +315,11 @@ int async_task_init(void)
 	/* advertise new processes to cfg framework */
 	cfg_register_child(nrg);
 
+	if(async_task_init_queues()<0) {
+		LM_ERR("failed to initialize the task queues\n");
+		return -1;
+	}
+
 	return 0;
 }
 
@@ -248,6 +419,9 @@ int async_task_set_workers(int n)
 		_async_wgroup_list->name.len = gname.len;
 	}
 	_async_wgroup_list->workers = n;
+	if(_async_wgroup_list->batch<=0) {
+		_async_wgroup_list->batch = 1;
+	}
 
 	return 0;
 }
@@ -332,6 +506,12 @@ int async_task_set_workers_group(char *data)
 				LM_ERR("invalid nonblock value: %.*s\n", pit->body.len, pit->body.s);
 				return -1;
 			}
+		} else if (pit->name.len==5
+				&& strncasecmp(pit->name.s, "batch", 5)==0) {
+			if (str2sint(&pit->body, &awg.batch) < 0) {
+				LM_ERR("invalid batch value: %.*s\n", pit->body.len, pit->body.s);
+				return -1;
+			}
 		}
 	}
 
@@ -351,6 +531,9 @@ int async_task_set_workers_group(char *data)
 		}
 		async_task_set_nonblock(awg.nonblock);
 		async_task_set_usleep(awg.usleep);
+		if(awg.batch>0) {
+			_async_wgroup_list->batch = awg.batch;
+		}
 		return 0;
 	}
 	if(_async_wgroup_list==NULL) {
@@ -374,6 +557,7 @@ int async_task_set_workers_group(char *data)
 	newg->workers = awg.workers;
 	newg->nonblock = awg.nonblock;
 	newg->usleep = awg.usleep;
+	newg->batch = (awg.batch>0)?awg.batch:1;
 
 	newg->next = _async_wgroup_list->next;
 	_async_wgroup_list->next = newg;
@@ -384,54 +568,91 @@ int async_task_set_workers_group(char *data)
 /**
  *
  */
-int async_task_push(async_task_t *task)
+async_wgroup_t *async_task_group_find(str *gname)
+{
+	async_wgroup_t *awg = NULL;
+
+	for(awg=_async_wgroup_list; awg!=NULL; awg=awg->next) {
+		if(awg->name.len==gname->len
+				&& memcmp(awg->name.s, gname->s, gname->len)==0) {
+			return awg;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * add the task in the queue of the group and wake up a worker
+ */
+int async_task_group_push_prio(async_wgroup_t *awg, async_task_t *task,
+		int prio)
 {
-	int len;
+	async_tqueue_t *q;
+	unsigned int n;
+	int p;
 
-	if(_async_wgroup_list==NULL || _async_wgroup_list->workers<=0) {
+	if(awg==NULL || awg->workers<=0 || awg->queue==NULL) {
 		LM_WARN("async task pushed, but no async workers - ignoring\n");
 		return 0;
 	}
-
-	len = write(_async_wgroup_list->sockets[1], &task, sizeof(async_task_t*));
-	if(len<=0) {
-		LM_ERR("failed to pass the task to asynk workers\n");
-		return -1;
+	if(prio<ASYNC_TASK_PRIO_HIGH) {
+		prio = ASYNC_TASK_PRIO_HIGH;
+	} else if(prio>=ASYNC_TASK_PRIOS) {
+		prio = ASYNC_TASK_PRIOS - 1;
 	}
-	LM_DBG("task sent [%p]\n", task);
+	q = awg->queue;
+	task->next = NULL;
+	task->qtime = async_task_now_us();
+
+	lock_get(&q->lock);
+	if(q->last[prio]!=NULL) {
+		q->last[prio]->next = task;
+	} else {
+		q->first[prio] = task;
+	}
+	q->last[prio] = task;
+	q->size[prio]++;
+	q->pushed++;
+	for(n=0, p=0; p<ASYNC_TASK_PRIOS; p++) {
+		n += q->size[p];
+	}
+	if(n > q->size_max) {
+		q->size_max = n;
+	}
+	lock_release(&q->lock);
+
+	async_task_wakeup(awg);
+	LM_DBG("task [%p] sent to group [%.*s] with priority %d\n", task,
+			awg->name.len, awg->name.s, prio);
 	return 0;
 }
 
+/**
+ *
+ */
+int async_task_push(async_task_t *task)
+{
+	return async_task_group_push_prio(_async_wgroup_list, task,
+			ASYNC_TASK_PRIO_NORMAL);
+}
+
 /**
  *
  */
 int async_task_group_push(str *gname, async_task_t *task)
 {
-	int len;
 	async_wgroup_t *awg = NULL;
 
 	if(_async_wgroup_list==NULL) {
 		LM_WARN("async task pushed, but no async group - ignoring\n");
 		return 0;
 	}
-	for(awg=_async_wgroup_list; awg!=NULL; awg=awg->next) {
-		if(awg->name.len==gname->len
-				&& memcmp(awg->name.s, gname->s, gname->len)==0) {
-			break;
-		}
-	}
+	awg = async_task_group_find(gname);
 	if(awg==NULL) {
 		LM_WARN("group [%.*s] not found - ignoring\n", gname->len, gname->s);
 		return 0;
 	}
-	len = write(awg->sockets[1], &task, sizeof(async_task_t*));
-	if(len<=0) {
-		LM_ERR("failed to pass the task [%p] to group [%.*s]\n", task,
-				gname->len, gname->s);
-		return -1;
-	}
-	LM_DBG("task [%p] sent to groupt [%.*s]\n", task, gname->len, gname->s);
-	return 0;
+	return async_task_group_push_prio(awg, task, ASYNC_TASK_PRIO_NORMAL);
 }
 
 /**
@@ -439,33 +660,69 @@ int async_task_group_push(str *gname, async_task_t *task)
  */
 int async_task_run(async_wgroup_t *awg, int idx)
 {
+	async_task_t *tasks[ASYNC_TASK_BATCH_MAX];
 	async_task_t *ptask;
-	int received;
+	int n;
+	int i;
 
 	LM_DBG("async task worker [%.*s] idx [%d] ready\n", awg->name.len,
 			awg->name.s, idx);
 
 	for( ; ; ) {
 		if(unlikely(awg->usleep)) sleep_us(awg->usleep);
-		if ((received = recvfrom(awg->sockets[0],
-							&ptask, sizeof(async_task_t*),
-							0, NULL, 0)) < 0) {
-			LM_ERR("failed to received task (%d: %s)\n", errno, strerror(errno));
-			continue;
-		}
-		if(received != sizeof(async_task_t*)) {
-			LM_ERR("invalid task size %d\n", received);
+		n = async_task_pop(awg, tasks, awg->batch);
+		if(n==0) {
+			/* queue empty - wait for a notification */
+			async_task_wait(awg);
 			continue;
 		}
-		if(ptask->exec!=NULL) {
-			LM_DBG("task executed [%p] (%p/%p)\n", (void*)ptask,
-					(void*)ptask->exec, (void*)ptask->param);
-			ptask->exec(ptask->param);
-		} else {
-			LM_DBG("task with no callback function - ignoring\n");
+		for(i=0; i<n; i++) {
+			ptask = tasks[i];
+			if(ptask->exec!=NULL) {
+				LM_DBG("task executed [%p] (%p/%p)\n", (void*)ptask,
+						(void*)ptask->exec, (void*)ptask->param);
+				ptask->exec(ptask->param);
+			} else {
+				LM_DBG("task with no callback function - ignoring\n");
+			}
+			shm_free(ptask);
 		}
-		shm_free(ptask);
 	}
 
 	return 0;
 }
+
+/**
+ * rpc command listing the state of the task groups
+ */
+void async_task_rpc_stats(rpc_t *rpc, void *c)
+{
+	async_wgroup_t *awg;
+	async_tqueue_t q;
+	void *th;
+
+	for(awg=_async_wgroup_list; awg!=NULL; awg=awg->next) {
+		if(awg->queue==NULL) {
+			continue;
+		}
+		lock_get(&awg->queue->lock);
+		memcpy(&q, awg->queue, sizeof(async_tqueue_t));
+		lock_release(&awg->queue->lock);
+		if(rpc->add(c, "{", &th)<0) {
+			rpc->fault(c, 500, "Internal error creating structure");
+			return;
+		}
+		rpc->struct_add(th, "Sdduuuuuuuu",
+				"name", &awg->name,
+				"workers", awg->workers,
+				"batch", awg->batch,
+				"queue_high", q.size[ASYNC_TASK_PRIO_HIGH],
+				"queue_normal", q.size[ASYNC_TASK_PRIO_NORMAL],
+				"queue_low", q.size[ASYNC_TASK_PRIO_LOW],
+				"queue_max", q.size_max,
+				"pushed", (unsigned int)q.pushed,
+				"popped", (unsigned int)q.popped,
+				"wait_avg_us", (q.popped>0)?(unsigned int)(q.wait_us/q.popped):0,
+				"wait_max_us", q.wait_max_us);
+	}
+}
@@ -24,19 +24,52 @@
 #ifndef _ASYNC_TASK_H_
 #define _ASYNC_TASK_H_
 
+#include "str.h"
+#include "locking.h"
+#include "counters.h"
+#include "rpc.h"
+
+/* priority lanes of the group queues - lower value is served first */
+#define ASYNC_TASK_PRIO_HIGH	0
+#define ASYNC_TASK_PRIO_NORMAL	1
+#define ASYNC_TASK_PRIO_LOW		2
+#define ASYNC_TASK_PRIOS		3
+
+/* max number of tasks taken from the queue on a worker wakeup */
+#define ASYNC_TASK_BATCH_MAX	64
+
 typedef void (*async_cbe_t)(void *p);
 
 typedef struct _async_task {
 	async_cbe_t exec;
 	void *param;
+	struct _async_task *next;  /* internal - link in the group queue */
+	unsigned long long qtime;  /* internal - push time (microseconds) */
 } async_task_t;
 
+/* shm queue of a group, with one lane per priority */
+typedef struct _async_tqueue {
+	gen_lock_t lock;
+	async_task_t *first[ASYNC_TASK_PRIOS];
+	async_task_t *last[ASYNC_TASK_PRIOS];
+	unsigned int size[ASYNC_TASK_PRIOS]; /* current depth per lane */
+	unsigned int size_max;          /* highest overall depth */
+	unsigned long long pushed;      /* number of pushed tasks */
+	unsigned long long popped;      /* number of tasks taken by workers */
+	unsigned long long wait_us;     /* sum of the queue wait times */
+	unsigned int wait_max_us;       /* highest queue wait time */
+} async_tqueue_t;
+
 typedef struct _async_wgroup {
 	str name;
 	int workers;
-	int sockets[2];
+	int sockets[2];         /* wakeup channel, when eventfd is not used */
+	int efd;                /* eventfd for wakeup, -1 if not used */
 	int usleep;
 	int nonblock;
+	int batch;              /* tasks taken from the queue per wakeup */
+	async_tqueue_t *queue;
+	counter_handle_t hwait; /* histogram of the queue wait time (usec) */
 	struct _async_wgroup *next;
 } async_wgroup_t;
 
@@ -53,4 +86,10 @@ int async_task_workers_active(void);
 
 int async_task_group_push(str *gname, async_task_t *task);
 
+async_wgroup_t *async_task_group_find(str *gname);
+int async_task_group_push_prio(async_wgroup_t *awg, async_task_t *task,
+		int prio);
+
+void async_task_rpc_stats(rpc_t *rpc, void *c);
+
 #endif
@@ -0,0 +1,7 @@
+/* this file is autogenerated by make core/autover.h
+ * DO NOT EDIT IT
+ */
+
+#define REPO_VER "3ab427-dirty"
+#define REPO_HASH "3ab427"
+#define REPO_STATE "-dirty"
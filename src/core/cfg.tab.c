@@ -0,0 +1,12968 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 30 "core/cfg.y"
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/ip.h>
+#include <arpa/inet.h>
+#include <string.h>
+#include <errno.h>
+#include "route_struct.h"
+#include "globals.h"
+#include "shm_init.h"
+#include "route.h"
+#include "switch.h"
+#include "dprint.h"
+#include "sr_module.h"
+#include "modparam.h"
+#include "ip_addr.h"
+#include "resolve.h"
+#include "socket_info.h"
+#include "name_alias.h"
+#include "ut.h"
+#include "dset.h"
+#include "select.h"
+#include "flags.h"
+#include "tcp_init.h"
+#include "tcp_options.h"
+#include "sctp_core.h"
+#include "pvar.h"
+#include "lvalue.h"
+#include "rvalue.h"
+#include "sr_compat.h"
+#include "msg_translator.h"
+#include "async_task.h"
+
+#include "kemi.h"
+#include "ppcfg.h"
+#include "pvapi.h"
+#include "config.h"
+#include "daemonize.h"
+#include "cfg_core.h"
+#include "cfg/cfg.h"
+#ifdef CORE_TLS
+#include "tls/tls_config.h"
+#endif
+#include "timer_ticks.h"
+
+#ifdef DEBUG_DMALLOC
+#include <dmalloc.h>
+#endif
+
+/* hack to avoid alloca usage in the generated C file (needed for compiler
+ with no built in alloca, like icc*/
+#undef _ALLOCA_H
+
+#define onsend_check(s) \
+	do{\
+		if (rt!=ONSEND_ROUTE) yyerror( s " allowed only in onsend_routes");\
+	}while(0)
+
+	#define IF_AUTO_BIND_IPV6(x) x
+
+#ifdef USE_DNS_CACHE
+	#define IF_DNS_CACHE(x) x
+#else
+	#define IF_DNS_CACHE(x) warn("dns cache support not compiled in")
+#endif
+
+#ifdef USE_DNS_FAILOVER
+	#define IF_DNS_FAILOVER(x) x
+#else
+	#define IF_DNS_FAILOVER(x) warn("dns failover support not compiled in")
+#endif
+
+#ifdef USE_NAPTR
+	#define IF_NAPTR(x) x
+#else
+	#define IF_NAPTR(x) warn("dns naptr support not compiled in")
+#endif
+
+#ifdef USE_DST_BLOCKLIST
+	#define IF_DST_BLOCKLIST(x) x
+#else
+	#define IF_DST_BLOCKLIST(x) warn("dst blocklist support not compiled in")
+#endif
+
+#ifdef USE_SCTP
+	#define IF_SCTP(x) x
+#else
+	#define IF_SCTP(x) warn("sctp support not compiled in")
+#endif
+
+#ifdef USE_RAW_SOCKS
+	#define IF_RAW_SOCKS(x) x
+#else
+	#define IF_RAW_SOCKS(x) warn("raw socket support not compiled in")
+#endif
+
+
+extern int yylex();
+/* safer then using yytext which can be array or pointer */
+extern char* yy_number_str;
+
+static void yyerror(char* s, ...);
+static void yyerror_at(struct cfg_pos* pos, char* s, ...);
+static char* tmp = NULL;
+static int i_tmp = 0;
+static struct socket_id* lst_tmp = NULL;
+static struct name_lst* nl_tmp = NULL;
+static int rt = 0;  /* Type of route block for find_export */
+static str* str_tmp = NULL;
+static str s_tmp = STR_NULL;
+static struct ip_addr* ip_tmp = NULL;
+static struct avp_spec* s_attr = NULL;
+static select_t sel;
+static select_t* sel_ptr = NULL;
+static pv_spec_t* pv_spec = NULL;
+static struct action *mod_func_action = NULL;
+static struct lvalue* lval_tmp = NULL;
+static struct rvalue* rval_tmp = NULL;
+static struct rval_expr* rve_tmp = NULL;
+
+static void warn(char* s, ...);
+static void warn_at(struct cfg_pos* pos, char* s, ...);
+static void get_cpos(struct cfg_pos* pos);
+static struct rval_expr* mk_rve_rval(enum rval_type, void* v);
+static struct rval_expr* mk_rve1(enum rval_expr_op op, struct rval_expr* rve1);
+static struct rval_expr* mk_rve2(enum rval_expr_op op, struct rval_expr* rve1,
+									struct rval_expr* rve2);
+static int rval_expr_int_check(struct rval_expr *rve);
+static int warn_ct_rve(struct rval_expr *rve, char* name);
+static struct socket_id* mk_listen_id(char*, int, int);
+static struct name_lst* mk_name_lst(char* name, int flags);
+static struct socket_id* mk_listen_id2(struct name_lst*, int, int);
+static void free_name_lst(struct name_lst* lst);
+static void free_socket_id_lst(struct socket_id* i);
+
+static struct case_stms* mk_case_stm(struct rval_expr* ct, int is_re,
+									struct action* a, int* err);
+static int case_check_type(struct case_stms* stms);
+static int case_check_default(struct case_stms* stms);
+static int mod_f_params_pre_fixup(struct action* a);
+static void free_mod_func_action(struct action* a);
+
+
+extern int line;
+extern int column;
+extern int startcolumn;
+extern int startline;
+extern char *finame;
+extern char *routename;
+extern char *default_routename;
+
+#define set_cfg_pos(x) \
+	do{\
+		if(x) {\
+		(x)->cline = line;\
+		(x)->cfile = (finame!=0)?finame:((cfg_file!=0)?cfg_file:"default");\
+		(x)->rname = (routename!=0)?routename:((default_routename!=0)?default_routename:"DEFAULT");\
+		}\
+	}while(0)
+
+
+
+#line 239 "core/cfg.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "cfg.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_FORWARD = 3,                    /* FORWARD  */
+  YYSYMBOL_FORWARD_TCP = 4,                /* FORWARD_TCP  */
+  YYSYMBOL_FORWARD_TLS = 5,                /* FORWARD_TLS  */
+  YYSYMBOL_FORWARD_SCTP = 6,               /* FORWARD_SCTP  */
+  YYSYMBOL_FORWARD_UDP = 7,                /* FORWARD_UDP  */
+  YYSYMBOL_EXIT = 8,                       /* EXIT  */
+  YYSYMBOL_DROP = 9,                       /* DROP  */
+  YYSYMBOL_RETURN = 10,                    /* RETURN  */
+  YYSYMBOL_BREAK = 11,                     /* BREAK  */
+  YYSYMBOL_LOG_TOK = 12,                   /* LOG_TOK  */
+  YYSYMBOL_ERROR = 13,                     /* ERROR  */
+  YYSYMBOL_ROUTE = 14,                     /* ROUTE  */
+  YYSYMBOL_ROUTE_REQUEST = 15,             /* ROUTE_REQUEST  */
+  YYSYMBOL_ROUTE_FAILURE = 16,             /* ROUTE_FAILURE  */
+  YYSYMBOL_ROUTE_ONREPLY = 17,             /* ROUTE_ONREPLY  */
+  YYSYMBOL_ROUTE_REPLY = 18,               /* ROUTE_REPLY  */
+  YYSYMBOL_ROUTE_BRANCH = 19,              /* ROUTE_BRANCH  */
+  YYSYMBOL_ROUTE_SEND = 20,                /* ROUTE_SEND  */
+  YYSYMBOL_ROUTE_EVENT = 21,               /* ROUTE_EVENT  */
+  YYSYMBOL_EXEC = 22,                      /* EXEC  */
+  YYSYMBOL_SET_HOST = 23,                  /* SET_HOST  */
+  YYSYMBOL_SET_HOSTPORT = 24,              /* SET_HOSTPORT  */
+  YYSYMBOL_SET_HOSTPORTTRANS = 25,         /* SET_HOSTPORTTRANS  */
+  YYSYMBOL_PREFIX = 26,                    /* PREFIX  */
+  YYSYMBOL_STRIP = 27,                     /* STRIP  */
+  YYSYMBOL_STRIP_TAIL = 28,                /* STRIP_TAIL  */
+  YYSYMBOL_SET_USERPHONE = 29,             /* SET_USERPHONE  */
+  YYSYMBOL_APPEND_BRANCH = 30,             /* APPEND_BRANCH  */
+  YYSYMBOL_REMOVE_BRANCH = 31,             /* REMOVE_BRANCH  */
+  YYSYMBOL_CLEAR_BRANCHES = 32,            /* CLEAR_BRANCHES  */
+  YYSYMBOL_SET_USER = 33,                  /* SET_USER  */
+  YYSYMBOL_SET_USERPASS = 34,              /* SET_USERPASS  */
+  YYSYMBOL_SET_PORT = 35,                  /* SET_PORT  */
+  YYSYMBOL_SET_URI = 36,                   /* SET_URI  */
+  YYSYMBOL_REVERT_URI = 37,                /* REVERT_URI  */
+  YYSYMBOL_FORCE_RPORT = 38,               /* FORCE_RPORT  */
+  YYSYMBOL_ADD_LOCAL_RPORT = 39,           /* ADD_LOCAL_RPORT  */
+  YYSYMBOL_LOCAL_RPORT = 40,               /* LOCAL_RPORT  */
+  YYSYMBOL_FORCE_TCP_ALIAS = 41,           /* FORCE_TCP_ALIAS  */
+  YYSYMBOL_UDP_MTU = 42,                   /* UDP_MTU  */
+  YYSYMBOL_UDP_MTU_TRY_PROTO = 43,         /* UDP_MTU_TRY_PROTO  */
+  YYSYMBOL_UDP4_RAW = 44,                  /* UDP4_RAW  */
+  YYSYMBOL_UDP4_RAW_MTU = 45,              /* UDP4_RAW_MTU  */
+  YYSYMBOL_UDP4_RAW_TTL = 46,              /* UDP4_RAW_TTL  */
+  YYSYMBOL_IF = 47,                        /* IF  */
+  YYSYMBOL_ELSE = 48,                      /* ELSE  */
+  YYSYMBOL_SET_ADV_ADDRESS = 49,           /* SET_ADV_ADDRESS  */
+  YYSYMBOL_SET_ADV_PORT = 50,              /* SET_ADV_PORT  */
+  YYSYMBOL_FORCE_SEND_SOCKET = 51,         /* FORCE_SEND_SOCKET  */
+  YYSYMBOL_SET_FWD_NO_CONNECT = 52,        /* SET_FWD_NO_CONNECT  */
+  YYSYMBOL_SET_RPL_NO_CONNECT = 53,        /* SET_RPL_NO_CONNECT  */
+  YYSYMBOL_SET_FWD_CLOSE = 54,             /* SET_FWD_CLOSE  */
+  YYSYMBOL_SET_RPL_CLOSE = 55,             /* SET_RPL_CLOSE  */
+  YYSYMBOL_SWITCH = 56,                    /* SWITCH  */
+  YYSYMBOL_CASE = 57,                      /* CASE  */
+  YYSYMBOL_DEFAULT = 58,                   /* DEFAULT  */
+  YYSYMBOL_WHILE = 59,                     /* WHILE  */
+  YYSYMBOL_CFG_SELECT = 60,                /* CFG_SELECT  */
+  YYSYMBOL_CFG_RESET = 61,                 /* CFG_RESET  */
+  YYSYMBOL_URIHOST = 62,                   /* URIHOST  */
+  YYSYMBOL_URIPORT = 63,                   /* URIPORT  */
+  YYSYMBOL_MAX_LEN = 64,                   /* MAX_LEN  */
+  YYSYMBOL_SETFLAG = 65,                   /* SETFLAG  */
+  YYSYMBOL_RESETFLAG = 66,                 /* RESETFLAG  */
+  YYSYMBOL_ISFLAGSET = 67,                 /* ISFLAGSET  */
+  YYSYMBOL_SETAVPFLAG = 68,                /* SETAVPFLAG  */
+  YYSYMBOL_RESETAVPFLAG = 69,              /* RESETAVPFLAG  */
+  YYSYMBOL_ISAVPFLAGSET = 70,              /* ISAVPFLAGSET  */
+  YYSYMBOL_METHOD = 71,                    /* METHOD  */
+  YYSYMBOL_URI = 72,                       /* URI  */
+  YYSYMBOL_FROM_URI = 73,                  /* FROM_URI  */
+  YYSYMBOL_TO_URI = 74,                    /* TO_URI  */
+  YYSYMBOL_SRCIP = 75,                     /* SRCIP  */
+  YYSYMBOL_SRCPORT = 76,                   /* SRCPORT  */
+  YYSYMBOL_DSTIP = 77,                     /* DSTIP  */
+  YYSYMBOL_DSTPORT = 78,                   /* DSTPORT  */
+  YYSYMBOL_TOIP = 79,                      /* TOIP  */
+  YYSYMBOL_TOPORT = 80,                    /* TOPORT  */
+  YYSYMBOL_SNDIP = 81,                     /* SNDIP  */
+  YYSYMBOL_SNDPORT = 82,                   /* SNDPORT  */
+  YYSYMBOL_SNDPROTO = 83,                  /* SNDPROTO  */
+  YYSYMBOL_SNDAF = 84,                     /* SNDAF  */
+  YYSYMBOL_PROTO = 85,                     /* PROTO  */
+  YYSYMBOL_AF = 86,                        /* AF  */
+  YYSYMBOL_MYSELF = 87,                    /* MYSELF  */
+  YYSYMBOL_MSGLEN = 88,                    /* MSGLEN  */
+  YYSYMBOL_UDP = 89,                       /* UDP  */
+  YYSYMBOL_TCP = 90,                       /* TCP  */
+  YYSYMBOL_TLS = 91,                       /* TLS  */
+  YYSYMBOL_SCTP = 92,                      /* SCTP  */
+  YYSYMBOL_WS = 93,                        /* WS  */
+  YYSYMBOL_WSS = 94,                       /* WSS  */
+  YYSYMBOL_DEBUG_V = 95,                   /* DEBUG_V  */
+  YYSYMBOL_FORK = 96,                      /* FORK  */
+  YYSYMBOL_FORK_DELAY = 97,                /* FORK_DELAY  */
+  YYSYMBOL_MODINIT_DELAY = 98,             /* MODINIT_DELAY  */
+  YYSYMBOL_LOGSTDERROR = 99,               /* LOGSTDERROR  */
+  YYSYMBOL_LOGFACILITY = 100,              /* LOGFACILITY  */
+  YYSYMBOL_LOGNAME = 101,                  /* LOGNAME  */
+  YYSYMBOL_LOGCOLOR = 102,                 /* LOGCOLOR  */
+  YYSYMBOL_LOGPREFIX = 103,                /* LOGPREFIX  */
+  YYSYMBOL_LOGPREFIXMODE = 104,            /* LOGPREFIXMODE  */
+  YYSYMBOL_LOGENGINETYPE = 105,            /* LOGENGINETYPE  */
+  YYSYMBOL_LOGENGINEDATA = 106,            /* LOGENGINEDATA  */
+  YYSYMBOL_XAVPVIAPARAMS = 107,            /* XAVPVIAPARAMS  */
+  YYSYMBOL_XAVPVIAFIELDS = 108,            /* XAVPVIAFIELDS  */
+  YYSYMBOL_LISTEN = 109,                   /* LISTEN  */
+  YYSYMBOL_ADVERTISE = 110,                /* ADVERTISE  */
+  YYSYMBOL_STRNAME = 111,                  /* STRNAME  */
+  YYSYMBOL_ALIAS = 112,                    /* ALIAS  */
+  YYSYMBOL_SR_AUTO_ALIASES = 113,          /* SR_AUTO_ALIASES  */
+  YYSYMBOL_DNS = 114,                      /* DNS  */
+  YYSYMBOL_REV_DNS = 115,                  /* REV_DNS  */
+  YYSYMBOL_DNS_TRY_IPV6 = 116,             /* DNS_TRY_IPV6  */
+  YYSYMBOL_DNS_TRY_NAPTR = 117,            /* DNS_TRY_NAPTR  */
+  YYSYMBOL_DNS_SRV_LB = 118,               /* DNS_SRV_LB  */
+  YYSYMBOL_DNS_UDP_PREF = 119,             /* DNS_UDP_PREF  */
+  YYSYMBOL_DNS_TCP_PREF = 120,             /* DNS_TCP_PREF  */
+  YYSYMBOL_DNS_TLS_PREF = 121,             /* DNS_TLS_PREF  */
+  YYSYMBOL_DNS_SCTP_PREF = 122,            /* DNS_SCTP_PREF  */
+  YYSYMBOL_DNS_RETR_TIME = 123,            /* DNS_RETR_TIME  */
+  YYSYMBOL_DNS_SLOW_QUERY_MS = 124,        /* DNS_SLOW_QUERY_MS  */
+  YYSYMBOL_DNS_RETR_NO = 125,              /* DNS_RETR_NO  */
+  YYSYMBOL_DNS_SERVERS_NO = 126,           /* DNS_SERVERS_NO  */
+  YYSYMBOL_DNS_USE_SEARCH = 127,           /* DNS_USE_SEARCH  */
+  YYSYMBOL_DNS_SEARCH_FMATCH = 128,        /* DNS_SEARCH_FMATCH  */
+  YYSYMBOL_DNS_NAPTR_IGNORE_RFC = 129,     /* DNS_NAPTR_IGNORE_RFC  */
+  YYSYMBOL_DNS_CACHE_INIT = 130,           /* DNS_CACHE_INIT  */
+  YYSYMBOL_DNS_USE_CACHE = 131,            /* DNS_USE_CACHE  */
+  YYSYMBOL_DNS_USE_FAILOVER = 132,         /* DNS_USE_FAILOVER  */
+  YYSYMBOL_DNS_CACHE_FLAGS = 133,          /* DNS_CACHE_FLAGS  */
+  YYSYMBOL_DNS_CACHE_NEG_TTL = 134,        /* DNS_CACHE_NEG_TTL  */
+  YYSYMBOL_DNS_CACHE_MIN_TTL = 135,        /* DNS_CACHE_MIN_TTL  */
+  YYSYMBOL_DNS_CACHE_MAX_TTL = 136,        /* DNS_CACHE_MAX_TTL  */
+  YYSYMBOL_DNS_CACHE_MEM = 137,            /* DNS_CACHE_MEM  */
+  YYSYMBOL_DNS_CACHE_GC_INT = 138,         /* DNS_CACHE_GC_INT  */
+  YYSYMBOL_DNS_CACHE_DEL_NONEXP = 139,     /* DNS_CACHE_DEL_NONEXP  */
+  YYSYMBOL_DNS_CACHE_REC_PREF = 140,       /* DNS_CACHE_REC_PREF  */
+  YYSYMBOL_AUTO_BIND_IPV6 = 141,           /* AUTO_BIND_IPV6  */
+  YYSYMBOL_BIND_IPV6_LINK_LOCAL = 142,     /* BIND_IPV6_LINK_LOCAL  */
+  YYSYMBOL_IPV6_HEX_STYLE = 143,           /* IPV6_HEX_STYLE  */
+  YYSYMBOL_DST_BLST_INIT = 144,            /* DST_BLST_INIT  */
+  YYSYMBOL_USE_DST_BLST = 145,             /* USE_DST_BLST  */
+  YYSYMBOL_DST_BLST_MEM = 146,             /* DST_BLST_MEM  */
+  YYSYMBOL_DST_BLST_TTL = 147,             /* DST_BLST_TTL  */
+  YYSYMBOL_DST_BLST_GC_INT = 148,          /* DST_BLST_GC_INT  */
+  YYSYMBOL_DST_BLST_UDP_IMASK = 149,       /* DST_BLST_UDP_IMASK  */
+  YYSYMBOL_DST_BLST_TCP_IMASK = 150,       /* DST_BLST_TCP_IMASK  */
+  YYSYMBOL_DST_BLST_TLS_IMASK = 151,       /* DST_BLST_TLS_IMASK  */
+  YYSYMBOL_DST_BLST_SCTP_IMASK = 152,      /* DST_BLST_SCTP_IMASK  */
+  YYSYMBOL_IP_FREE_BIND = 153,             /* IP_FREE_BIND  */
+  YYSYMBOL_PORT = 154,                     /* PORT  */
+  YYSYMBOL_STAT = 155,                     /* STAT  */
+  YYSYMBOL_STATS_NAMESEP = 156,            /* STATS_NAMESEP  */
+  YYSYMBOL_CHILDREN = 157,                 /* CHILDREN  */
+  YYSYMBOL_SOCKET_WORKERS = 158,           /* SOCKET_WORKERS  */
+  YYSYMBOL_ASYNC_WORKERS = 159,            /* ASYNC_WORKERS  */
+  YYSYMBOL_ASYNC_USLEEP = 160,             /* ASYNC_USLEEP  */
+  YYSYMBOL_ASYNC_NONBLOCK = 161,           /* ASYNC_NONBLOCK  */
+  YYSYMBOL_ASYNC_WORKERS_GROUP = 162,      /* ASYNC_WORKERS_GROUP  */
+  YYSYMBOL_CHECK_VIA = 163,                /* CHECK_VIA  */
+  YYSYMBOL_PHONE2TEL = 164,                /* PHONE2TEL  */
+  YYSYMBOL_MEMLOG = 165,                   /* MEMLOG  */
+  YYSYMBOL_MEMDBG = 166,                   /* MEMDBG  */
+  YYSYMBOL_MEMSUM = 167,                   /* MEMSUM  */
+  YYSYMBOL_MEMSAFETY = 168,                /* MEMSAFETY  */
+  YYSYMBOL_MEMJOIN = 169,                  /* MEMJOIN  */
+  YYSYMBOL_MEMSTATUSMODE = 170,            /* MEMSTATUSMODE  */
+  YYSYMBOL_SIP_PARSER_LOG = 171,           /* SIP_PARSER_LOG  */
+  YYSYMBOL_SIP_PARSER_MODE = 172,          /* SIP_PARSER_MODE  */
+  YYSYMBOL_CORELOG = 173,                  /* CORELOG  */
+  YYSYMBOL_SIP_WARNING = 174,              /* SIP_WARNING  */
+  YYSYMBOL_SERVER_SIGNATURE = 175,         /* SERVER_SIGNATURE  */
+  YYSYMBOL_SERVER_HEADER = 176,            /* SERVER_HEADER  */
+  YYSYMBOL_USER_AGENT_HEADER = 177,        /* USER_AGENT_HEADER  */
+  YYSYMBOL_REPLY_TO_VIA = 178,             /* REPLY_TO_VIA  */
+  YYSYMBOL_LOADMODULE = 179,               /* LOADMODULE  */
+  YYSYMBOL_LOADMODULEX = 180,              /* LOADMODULEX  */
+  YYSYMBOL_LOADPATH = 181,                 /* LOADPATH  */
+  YYSYMBOL_MODPARAM = 182,                 /* MODPARAM  */
+  YYSYMBOL_MODPARAMX = 183,                /* MODPARAMX  */
+  YYSYMBOL_CFGENGINE = 184,                /* CFGENGINE  */
+  YYSYMBOL_MAXBUFFER = 185,                /* MAXBUFFER  */
+  YYSYMBOL_SQL_BUFFER_SIZE = 186,          /* SQL_BUFFER_SIZE  */
+  YYSYMBOL_USER = 187,                     /* USER  */
+  YYSYMBOL_GROUP = 188,                    /* GROUP  */
+  YYSYMBOL_CHROOT = 189,                   /* CHROOT  */
+  YYSYMBOL_WDIR = 190,                     /* WDIR  */
+  YYSYMBOL_RUNDIR = 191,                   /* RUNDIR  */
+  YYSYMBOL_MHOMED = 192,                   /* MHOMED  */
+  YYSYMBOL_DISABLE_TCP = 193,              /* DISABLE_TCP  */
+  YYSYMBOL_TCP_ACCEPT_ALIASES = 194,       /* TCP_ACCEPT_ALIASES  */
+  YYSYMBOL_TCP_ACCEPT_UNIQUE = 195,        /* TCP_ACCEPT_UNIQUE  */
+  YYSYMBOL_TCP_CONNECTION_MATCH = 196,     /* TCP_CONNECTION_MATCH  */
+  YYSYMBOL_TCP_CHILDREN = 197,             /* TCP_CHILDREN  */
+  YYSYMBOL_TCP_CONNECT_TIMEOUT = 198,      /* TCP_CONNECT_TIMEOUT  */
+  YYSYMBOL_TCP_SEND_TIMEOUT = 199,         /* TCP_SEND_TIMEOUT  */
+  YYSYMBOL_TCP_CON_LIFETIME = 200,         /* TCP_CON_LIFETIME  */
+  YYSYMBOL_TCP_POLL_METHOD = 201,          /* TCP_POLL_METHOD  */
+  YYSYMBOL_TCP_MAX_CONNECTIONS = 202,      /* TCP_MAX_CONNECTIONS  */
+  YYSYMBOL_TLS_MAX_CONNECTIONS = 203,      /* TLS_MAX_CONNECTIONS  */
+  YYSYMBOL_TCP_NO_CONNECT = 204,           /* TCP_NO_CONNECT  */
+  YYSYMBOL_TCP_SOURCE_IPV4 = 205,          /* TCP_SOURCE_IPV4  */
+  YYSYMBOL_TCP_SOURCE_IPV6 = 206,          /* TCP_SOURCE_IPV6  */
+  YYSYMBOL_TCP_OPT_FD_CACHE = 207,         /* TCP_OPT_FD_CACHE  */
+  YYSYMBOL_TCP_OPT_BUF_WRITE = 208,        /* TCP_OPT_BUF_WRITE  */
+  YYSYMBOL_TCP_OPT_CONN_WQ_MAX = 209,      /* TCP_OPT_CONN_WQ_MAX  */
+  YYSYMBOL_TCP_OPT_WQ_MAX = 210,           /* TCP_OPT_WQ_MAX  */
+  YYSYMBOL_TCP_OPT_RD_BUF = 211,           /* TCP_OPT_RD_BUF  */
+  YYSYMBOL_TCP_OPT_WQ_BLK = 212,           /* TCP_OPT_WQ_BLK  */
+  YYSYMBOL_TCP_OPT_DEFER_ACCEPT = 213,     /* TCP_OPT_DEFER_ACCEPT  */
+  YYSYMBOL_TCP_OPT_DELAYED_ACK = 214,      /* TCP_OPT_DELAYED_ACK  */
+  YYSYMBOL_TCP_OPT_SYNCNT = 215,           /* TCP_OPT_SYNCNT  */
+  YYSYMBOL_TCP_OPT_LINGER2 = 216,          /* TCP_OPT_LINGER2  */
+  YYSYMBOL_TCP_OPT_KEEPALIVE = 217,        /* TCP_OPT_KEEPALIVE  */
+  YYSYMBOL_TCP_OPT_KEEPIDLE = 218,         /* TCP_OPT_KEEPIDLE  */
+  YYSYMBOL_TCP_OPT_KEEPINTVL = 219,        /* TCP_OPT_KEEPINTVL  */
+  YYSYMBOL_TCP_OPT_KEEPCNT = 220,          /* TCP_OPT_KEEPCNT  */
+  YYSYMBOL_TCP_OPT_CRLF_PING = 221,        /* TCP_OPT_CRLF_PING  */
+  YYSYMBOL_TCP_OPT_ACCEPT_NO_CL = 222,     /* TCP_OPT_ACCEPT_NO_CL  */
+  YYSYMBOL_TCP_OPT_ACCEPT_HEP3 = 223,      /* TCP_OPT_ACCEPT_HEP3  */
+  YYSYMBOL_TCP_OPT_ACCEPT_HAPROXY = 224,   /* TCP_OPT_ACCEPT_HAPROXY  */
+  YYSYMBOL_TCP_CLONE_RCVBUF = 225,         /* TCP_CLONE_RCVBUF  */
+  YYSYMBOL_TCP_REUSE_PORT = 226,           /* TCP_REUSE_PORT  */
+  YYSYMBOL_DISABLE_TLS = 227,              /* DISABLE_TLS  */
+  YYSYMBOL_ENABLE_TLS = 228,               /* ENABLE_TLS  */
+  YYSYMBOL_TLSLOG = 229,                   /* TLSLOG  */
+  YYSYMBOL_TLS_PORT_NO = 230,              /* TLS_PORT_NO  */
+  YYSYMBOL_TLS_METHOD = 231,               /* TLS_METHOD  */
+  YYSYMBOL_TLS_HANDSHAKE_TIMEOUT = 232,    /* TLS_HANDSHAKE_TIMEOUT  */
+  YYSYMBOL_TLS_SEND_TIMEOUT = 233,         /* TLS_SEND_TIMEOUT  */
+  YYSYMBOL_SSLv23 = 234,                   /* SSLv23  */
+  YYSYMBOL_SSLv2 = 235,                    /* SSLv2  */
+  YYSYMBOL_SSLv3 = 236,                    /* SSLv3  */
+  YYSYMBOL_TLSv1 = 237,                    /* TLSv1  */
+  YYSYMBOL_TLS_VERIFY = 238,               /* TLS_VERIFY  */
+  YYSYMBOL_TLS_REQUIRE_CERTIFICATE = 239,  /* TLS_REQUIRE_CERTIFICATE  */
+  YYSYMBOL_TLS_CERTIFICATE = 240,          /* TLS_CERTIFICATE  */
+  YYSYMBOL_TLS_PRIVATE_KEY = 241,          /* TLS_PRIVATE_KEY  */
+  YYSYMBOL_TLS_CA_LIST = 242,              /* TLS_CA_LIST  */
+  YYSYMBOL_DISABLE_SCTP = 243,             /* DISABLE_SCTP  */
+  YYSYMBOL_ENABLE_SCTP = 244,              /* ENABLE_SCTP  */
+  YYSYMBOL_SCTP_CHILDREN = 245,            /* SCTP_CHILDREN  */
+  YYSYMBOL_ADVERTISED_ADDRESS = 246,       /* ADVERTISED_ADDRESS  */
+  YYSYMBOL_ADVERTISED_PORT = 247,          /* ADVERTISED_PORT  */
+  YYSYMBOL_DISABLE_CORE = 248,             /* DISABLE_CORE  */
+  YYSYMBOL_OPEN_FD_LIMIT = 249,            /* OPEN_FD_LIMIT  */
+  YYSYMBOL_SHM_MEM_SZ = 250,               /* SHM_MEM_SZ  */
+  YYSYMBOL_SHM_FORCE_ALLOC = 251,          /* SHM_FORCE_ALLOC  */
+  YYSYMBOL_MLOCK_PAGES = 252,              /* MLOCK_PAGES  */
+  YYSYMBOL_REAL_TIME = 253,                /* REAL_TIME  */
+  YYSYMBOL_RT_PRIO = 254,                  /* RT_PRIO  */
+  YYSYMBOL_RT_POLICY = 255,                /* RT_POLICY  */
+  YYSYMBOL_RT_TIMER1_PRIO = 256,           /* RT_TIMER1_PRIO  */
+  YYSYMBOL_RT_TIMER1_POLICY = 257,         /* RT_TIMER1_POLICY  */
+  YYSYMBOL_RT_TIMER2_PRIO = 258,           /* RT_TIMER2_PRIO  */
+  YYSYMBOL_RT_TIMER2_POLICY = 259,         /* RT_TIMER2_POLICY  */
+  YYSYMBOL_MCAST_LOOPBACK = 260,           /* MCAST_LOOPBACK  */
+  YYSYMBOL_MCAST_TTL = 261,                /* MCAST_TTL  */
+  YYSYMBOL_MCAST = 262,                    /* MCAST  */
+  YYSYMBOL_TOS = 263,                      /* TOS  */
+  YYSYMBOL_PMTU_DISCOVERY = 264,           /* PMTU_DISCOVERY  */
+  YYSYMBOL_KILL_TIMEOUT = 265,             /* KILL_TIMEOUT  */
+  YYSYMBOL_MAX_WLOOPS = 266,               /* MAX_WLOOPS  */
+  YYSYMBOL_PVBUFSIZE = 267,                /* PVBUFSIZE  */
+  YYSYMBOL_PVBUFSLOTS = 268,               /* PVBUFSLOTS  */
+  YYSYMBOL_PVCACHELIMIT = 269,             /* PVCACHELIMIT  */
+  YYSYMBOL_PVCACHEACTION = 270,            /* PVCACHEACTION  */
+  YYSYMBOL_HTTP_REPLY_PARSE = 271,         /* HTTP_REPLY_PARSE  */
+  YYSYMBOL_VERSION_TABLE_CFG = 272,        /* VERSION_TABLE_CFG  */
+  YYSYMBOL_VERBOSE_STARTUP = 273,          /* VERBOSE_STARTUP  */
+  YYSYMBOL_ROUTE_LOCKS_SIZE = 274,         /* ROUTE_LOCKS_SIZE  */
+  YYSYMBOL_WAIT_WORKER1_MODE = 275,        /* WAIT_WORKER1_MODE  */
+  YYSYMBOL_WAIT_WORKER1_TIME = 276,        /* WAIT_WORKER1_TIME  */
+  YYSYMBOL_WAIT_WORKER1_USLEEP = 277,      /* WAIT_WORKER1_USLEEP  */
+  YYSYMBOL_CFG_DESCRIPTION = 278,          /* CFG_DESCRIPTION  */
+  YYSYMBOL_SERVER_ID = 279,                /* SERVER_ID  */
+  YYSYMBOL_KEMI = 280,                     /* KEMI  */
+  YYSYMBOL_ONSEND_ROUTE_CALLBACK = 281,    /* ONSEND_ROUTE_CALLBACK  */
+  YYSYMBOL_REPLY_ROUTE_CALLBACK = 282,     /* REPLY_ROUTE_CALLBACK  */
+  YYSYMBOL_EVENT_ROUTE_CALLBACK = 283,     /* EVENT_ROUTE_CALLBACK  */
+  YYSYMBOL_RECEIVED_ROUTE_CALLBACK = 284,  /* RECEIVED_ROUTE_CALLBACK  */
+  YYSYMBOL_RECEIVED_ROUTE_MODE = 285,      /* RECEIVED_ROUTE_MODE  */
+  YYSYMBOL_PRE_ROUTING_CALLBACK = 286,     /* PRE_ROUTING_CALLBACK  */
+  YYSYMBOL_MAX_RECURSIVE_LEVEL = 287,      /* MAX_RECURSIVE_LEVEL  */
+  YYSYMBOL_MAX_BRANCHES_PARAM = 288,       /* MAX_BRANCHES_PARAM  */
+  YYSYMBOL_LATENCY_CFG_LOG = 289,          /* LATENCY_CFG_LOG  */
+  YYSYMBOL_LATENCY_LOG = 290,              /* LATENCY_LOG  */
+  YYSYMBOL_LATENCY_LIMIT_DB = 291,         /* LATENCY_LIMIT_DB  */
+  YYSYMBOL_LATENCY_LIMIT_ACTION = 292,     /* LATENCY_LIMIT_ACTION  */
+  YYSYMBOL_LATENCY_LIMIT_CFG = 293,        /* LATENCY_LIMIT_CFG  */
+  YYSYMBOL_MSG_TIME = 294,                 /* MSG_TIME  */
+  YYSYMBOL_ONSEND_RT_REPLY = 295,          /* ONSEND_RT_REPLY  */
+  YYSYMBOL_URI_HOST_EXTRA_CHARS = 296,     /* URI_HOST_EXTRA_CHARS  */
+  YYSYMBOL_HDR_NAME_EXTRA_CHARS = 297,     /* HDR_NAME_EXTRA_CHARS  */
+  YYSYMBOL_FLAGS_DECL = 298,               /* FLAGS_DECL  */
+  YYSYMBOL_AVPFLAGS_DECL = 299,            /* AVPFLAGS_DECL  */
+  YYSYMBOL_ATTR_MARK = 300,                /* ATTR_MARK  */
+  YYSYMBOL_SELECT_MARK = 301,              /* SELECT_MARK  */
+  YYSYMBOL_ATTR_FROM = 302,                /* ATTR_FROM  */
+  YYSYMBOL_ATTR_TO = 303,                  /* ATTR_TO  */
+  YYSYMBOL_ATTR_FROMURI = 304,             /* ATTR_FROMURI  */
+  YYSYMBOL_ATTR_TOURI = 305,               /* ATTR_TOURI  */
+  YYSYMBOL_ATTR_FROMUSER = 306,            /* ATTR_FROMUSER  */
+  YYSYMBOL_ATTR_TOUSER = 307,              /* ATTR_TOUSER  */
+  YYSYMBOL_ATTR_FROMDOMAIN = 308,          /* ATTR_FROMDOMAIN  */
+  YYSYMBOL_ATTR_TODOMAIN = 309,            /* ATTR_TODOMAIN  */
+  YYSYMBOL_ATTR_GLOBAL = 310,              /* ATTR_GLOBAL  */
+  YYSYMBOL_ADDEQ = 311,                    /* ADDEQ  */
+  YYSYMBOL_SUBST = 312,                    /* SUBST  */
+  YYSYMBOL_SUBSTDEF = 313,                 /* SUBSTDEF  */
+  YYSYMBOL_SUBSTDEFS = 314,                /* SUBSTDEFS  */
+  YYSYMBOL_EQUAL = 315,                    /* EQUAL  */
+  YYSYMBOL_LOG_OR = 316,                   /* LOG_OR  */
+  YYSYMBOL_LOG_AND = 317,                  /* LOG_AND  */
+  YYSYMBOL_BIN_OR = 318,                   /* BIN_OR  */
+  YYSYMBOL_BIN_AND = 319,                  /* BIN_AND  */
+  YYSYMBOL_BIN_XOR = 320,                  /* BIN_XOR  */
+  YYSYMBOL_BIN_LSHIFT = 321,               /* BIN_LSHIFT  */
+  YYSYMBOL_BIN_RSHIFT = 322,               /* BIN_RSHIFT  */
+  YYSYMBOL_EQUAL_T = 323,                  /* EQUAL_T  */
+  YYSYMBOL_DIFF = 324,                     /* DIFF  */
+  YYSYMBOL_MATCH = 325,                    /* MATCH  */
+  YYSYMBOL_INTEQ = 326,                    /* INTEQ  */
+  YYSYMBOL_INTDIFF = 327,                  /* INTDIFF  */
+  YYSYMBOL_STREQ = 328,                    /* STREQ  */
+  YYSYMBOL_STRDIFF = 329,                  /* STRDIFF  */
+  YYSYMBOL_GT = 330,                       /* GT  */
+  YYSYMBOL_LT = 331,                       /* LT  */
+  YYSYMBOL_GTE = 332,                      /* GTE  */
+  YYSYMBOL_LTE = 333,                      /* LTE  */
+  YYSYMBOL_PLUS = 334,                     /* PLUS  */
+  YYSYMBOL_MINUS = 335,                    /* MINUS  */
+  YYSYMBOL_STAR = 336,                     /* STAR  */
+  YYSYMBOL_SLASH = 337,                    /* SLASH  */
+  YYSYMBOL_MODULO = 338,                   /* MODULO  */
+  YYSYMBOL_NOT = 339,                      /* NOT  */
+  YYSYMBOL_UNARY = 340,                    /* UNARY  */
+  YYSYMBOL_BIN_NOT = 341,                  /* BIN_NOT  */
+  YYSYMBOL_DEFINED = 342,                  /* DEFINED  */
+  YYSYMBOL_INTCAST = 343,                  /* INTCAST  */
+  YYSYMBOL_STRCAST = 344,                  /* STRCAST  */
+  YYSYMBOL_DOT = 345,                      /* DOT  */
+  YYSYMBOL_STRLEN = 346,                   /* STRLEN  */
+  YYSYMBOL_STREMPTY = 347,                 /* STREMPTY  */
+  YYSYMBOL_SELVAL = 348,                   /* SELVAL  */
+  YYSYMBOL_NUMBER = 349,                   /* NUMBER  */
+  YYSYMBOL_ID = 350,                       /* ID  */
+  YYSYMBOL_NUM_ID = 351,                   /* NUM_ID  */
+  YYSYMBOL_STRING = 352,                   /* STRING  */
+  YYSYMBOL_IPV6ADDR = 353,                 /* IPV6ADDR  */
+  YYSYMBOL_PVAR = 354,                     /* PVAR  */
+  YYSYMBOL_AVP_OR_PVAR = 355,              /* AVP_OR_PVAR  */
+  YYSYMBOL_EVENT_RT_NAME = 356,            /* EVENT_RT_NAME  */
+  YYSYMBOL_COMMA = 357,                    /* COMMA  */
+  YYSYMBOL_SEMICOLON = 358,                /* SEMICOLON  */
+  YYSYMBOL_RPAREN = 359,                   /* RPAREN  */
+  YYSYMBOL_LPAREN = 360,                   /* LPAREN  */
+  YYSYMBOL_LBRACE = 361,                   /* LBRACE  */
+  YYSYMBOL_RBRACE = 362,                   /* RBRACE  */
+  YYSYMBOL_LBRACK = 363,                   /* LBRACK  */
+  YYSYMBOL_RBRACK = 364,                   /* RBRACK  */
+  YYSYMBOL_CR = 365,                       /* CR  */
+  YYSYMBOL_COLON = 366,                    /* COLON  */
+  YYSYMBOL_YYACCEPT = 367,                 /* $accept  */
+  YYSYMBOL_cfg = 368,                      /* cfg  */
+  YYSYMBOL_statements = 369,               /* statements  */
+  YYSYMBOL_statement = 370,                /* statement  */
+  YYSYMBOL_371_1 = 371,                    /* $@1  */
+  YYSYMBOL_372_2 = 372,                    /* $@2  */
+  YYSYMBOL_373_3 = 373,                    /* $@3  */
+  YYSYMBOL_374_4 = 374,                    /* $@4  */
+  YYSYMBOL_375_5 = 375,                    /* $@5  */
+  YYSYMBOL_listen_id = 376,                /* listen_id  */
+  YYSYMBOL_listen_id_lst = 377,            /* listen_id_lst  */
+  YYSYMBOL_listen_id2 = 378,               /* listen_id2  */
+  YYSYMBOL_proto = 379,                    /* proto  */
+  YYSYMBOL_eqproto = 380,                  /* eqproto  */
+  YYSYMBOL_port = 381,                     /* port  */
+  YYSYMBOL_phostport = 382,                /* phostport  */
+  YYSYMBOL_listen_phostport = 383,         /* listen_phostport  */
+  YYSYMBOL_id_lst = 384,                   /* id_lst  */
+  YYSYMBOL_intno = 385,                    /* intno  */
+  YYSYMBOL_flags_decl = 386,               /* flags_decl  */
+  YYSYMBOL_flag_list = 387,                /* flag_list  */
+  YYSYMBOL_flag_spec = 388,                /* flag_spec  */
+  YYSYMBOL_flag_name = 389,                /* flag_name  */
+  YYSYMBOL_avpflags_decl = 390,            /* avpflags_decl  */
+  YYSYMBOL_avpflag_list = 391,             /* avpflag_list  */
+  YYSYMBOL_avpflag_spec = 392,             /* avpflag_spec  */
+  YYSYMBOL_assign_stm = 393,               /* assign_stm  */
+  YYSYMBOL_cfg_var_id = 394,               /* cfg_var_id  */
+  YYSYMBOL_cfg_var_idn = 395,              /* cfg_var_idn  */
+  YYSYMBOL_cfg_var = 396,                  /* cfg_var  */
+  YYSYMBOL_module_stm = 397,               /* module_stm  */
+  YYSYMBOL_ip = 398,                       /* ip  */
+  YYSYMBOL_ipv4 = 399,                     /* ipv4  */
+  YYSYMBOL_ipv6addr = 400,                 /* ipv6addr  */
+  YYSYMBOL_ipv6 = 401,                     /* ipv6  */
+  YYSYMBOL_route_name = 402,               /* route_name  */
+  YYSYMBOL_route_main = 403,               /* route_main  */
+  YYSYMBOL_route_stm = 404,                /* route_stm  */
+  YYSYMBOL_failure_route_main = 405,       /* failure_route_main  */
+  YYSYMBOL_failure_route_stm = 406,        /* failure_route_stm  */
+  YYSYMBOL_route_reply_main = 407,         /* route_reply_main  */
+  YYSYMBOL_onreply_route_stm = 408,        /* onreply_route_stm  */
+  YYSYMBOL_409_6 = 409,                    /* $@6  */
+  YYSYMBOL_410_7 = 410,                    /* $@7  */
+  YYSYMBOL_branch_route_main = 411,        /* branch_route_main  */
+  YYSYMBOL_branch_route_stm = 412,         /* branch_route_stm  */
+  YYSYMBOL_send_route_main = 413,          /* send_route_main  */
+  YYSYMBOL_send_route_stm = 414,           /* send_route_stm  */
+  YYSYMBOL_event_route_main = 415,         /* event_route_main  */
+  YYSYMBOL_event_route_stm = 416,          /* event_route_stm  */
+  YYSYMBOL_preprocess_stm = 417,           /* preprocess_stm  */
+  YYSYMBOL_equalop = 418,                  /* equalop  */
+  YYSYMBOL_cmpop = 419,                    /* cmpop  */
+  YYSYMBOL_strop = 420,                    /* strop  */
+  YYSYMBOL_rve_equalop = 421,              /* rve_equalop  */
+  YYSYMBOL_rve_cmpop = 422,                /* rve_cmpop  */
+  YYSYMBOL_uri_type = 423,                 /* uri_type  */
+  YYSYMBOL_eint_op_onsend = 424,           /* eint_op_onsend  */
+  YYSYMBOL_eint_op = 425,                  /* eint_op  */
+  YYSYMBOL_eip_op_onsend = 426,            /* eip_op_onsend  */
+  YYSYMBOL_eip_op = 427,                   /* eip_op  */
+  YYSYMBOL_exp_elem = 428,                 /* exp_elem  */
+  YYSYMBOL_ipnet = 429,                    /* ipnet  */
+  YYSYMBOL_host = 430,                     /* host  */
+  YYSYMBOL_host_if_id = 431,               /* host_if_id  */
+  YYSYMBOL_host_or_if = 432,               /* host_or_if  */
+  YYSYMBOL_fcmd = 433,                     /* fcmd  */
+  YYSYMBOL_stm = 434,                      /* stm  */
+  YYSYMBOL_actions = 435,                  /* actions  */
+  YYSYMBOL_action = 436,                   /* action  */
+  YYSYMBOL_if_cmd = 437,                   /* if_cmd  */
+  YYSYMBOL_ct_rval = 438,                  /* ct_rval  */
+  YYSYMBOL_single_case = 439,              /* single_case  */
+  YYSYMBOL_case_stms = 440,                /* case_stms  */
+  YYSYMBOL_switch_cmd = 441,               /* switch_cmd  */
+  YYSYMBOL_while_cmd = 442,                /* while_cmd  */
+  YYSYMBOL_select_param = 443,             /* select_param  */
+  YYSYMBOL_select_params = 444,            /* select_params  */
+  YYSYMBOL_select_id = 445,                /* select_id  */
+  YYSYMBOL_446_8 = 446,                    /* $@8  */
+  YYSYMBOL_attr_class_spec = 447,          /* attr_class_spec  */
+  YYSYMBOL_attr_name_spec = 448,           /* attr_name_spec  */
+  YYSYMBOL_attr_spec = 449,                /* attr_spec  */
+  YYSYMBOL_attr_mark = 450,                /* attr_mark  */
+  YYSYMBOL_attr_id = 451,                  /* attr_id  */
+  YYSYMBOL_attr_id_num_idx = 452,          /* attr_id_num_idx  */
+  YYSYMBOL_attr_id_no_idx = 453,           /* attr_id_no_idx  */
+  YYSYMBOL_attr_id_ass = 454,              /* attr_id_ass  */
+  YYSYMBOL_attr_id_any = 455,              /* attr_id_any  */
+  YYSYMBOL_attr_id_any_str = 456,          /* attr_id_any_str  */
+  YYSYMBOL_pvar = 457,                     /* pvar  */
+  YYSYMBOL_avp_pvar = 458,                 /* avp_pvar  */
+  YYSYMBOL_assign_op = 459,                /* assign_op  */
+  YYSYMBOL_lval = 460,                     /* lval  */
+  YYSYMBOL_rval = 461,                     /* rval  */
+  YYSYMBOL_rve_un_op = 462,                /* rve_un_op  */
+  YYSYMBOL_rval_expr = 463,                /* rval_expr  */
+  YYSYMBOL_assign_action = 464,            /* assign_action  */
+  YYSYMBOL_avpflag_oper = 465,             /* avpflag_oper  */
+  YYSYMBOL_cmd = 466,                      /* cmd  */
+  YYSYMBOL_467_9 = 467,                    /* $@9  */
+  YYSYMBOL_func_params = 468,              /* func_params  */
+  YYSYMBOL_func_param = 469,               /* func_param  */
+  YYSYMBOL_ret_cmd = 470                   /* ret_cmd  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  494
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   12418
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  367
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  104
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  940
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  1769
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   621
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int16 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
+     175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
+     195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
+     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
+     255,   256,   257,   258,   259,   260,   261,   262,   263,   264,
+     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
+     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
+     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
+     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
+     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
+     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
+     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
+     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
+     365,   366
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   644,   644,   647,   648,   649,   652,   653,   654,   655,
+     656,   657,   657,   658,   658,   659,   660,   660,   661,   661,
+     662,   662,   663,   664,   667,   683,   691,   705,   706,   712,
+     713,   717,   718,   719,   720,   721,   724,   725,   726,   727,
+     728,   729,   730,   733,   734,   737,   738,   739,   740,   741,
+     745,   746,   747,   748,   749,   753,   754,   757,   758,   761,
+     762,   764,   765,   768,   771,   777,   778,   782,   783,   786,
+     787,   790,   796,   797,   798,   799,   800,   801,   802,   803,
+     804,   807,   808,   814,   815,   816,   817,   818,   819,   820,
+     821,   822,   823,   824,   825,   826,   827,   830,   831,   834,
+     835,   836,   837,   838,   839,   840,   841,   842,   843,   844,
+     845,   846,   847,   848,   849,   850,   851,   853,   854,   855,
+     856,   857,   858,   859,   860,   861,   862,   863,   864,   865,
+     866,   867,   868,   869,   870,   871,   872,   873,   874,   875,
+     876,   877,   878,   879,   880,   881,   882,   883,   884,   885,
+     886,   887,   888,   889,   890,   891,   892,   900,   901,   902,
+     903,   904,   905,   908,   909,   912,   913,   916,   917,   918,
+     919,   922,   923,   926,   927,   930,   931,   934,   935,   936,
+     937,   938,   939,   940,   941,   942,   943,   944,   945,   946,
+     947,   948,   949,   950,   951,   952,   953,   954,   955,   956,
+     957,   958,   959,   960,   961,   962,   963,   964,   965,   966,
+     967,   968,   969,   970,   971,   972,   973,   974,   975,   976,
+     977,   978,   979,   980,   981,   984,   985,   992,   999,  1000,
+    1001,  1002,  1003,  1004,  1005,  1006,  1007,  1008,  1009,  1010,
+    1011,  1012,  1013,  1014,  1021,  1022,  1029,  1030,  1037,  1038,
+    1045,  1046,  1053,  1054,  1061,  1062,  1069,  1070,  1080,  1081,
+    1095,  1109,  1110,  1117,  1118,  1125,  1126,  1133,  1134,  1143,
+    1144,  1153,  1154,  1161,  1162,  1169,  1170,  1177,  1178,  1185,
+    1186,  1193,  1194,  1201,  1202,  1209,  1210,  1217,  1218,  1225,
+    1226,  1233,  1234,  1241,  1242,  1249,  1250,  1257,  1258,  1265,
+    1266,  1273,  1274,  1281,  1282,  1289,  1290,  1297,  1299,  1306,
+    1307,  1318,  1319,  1326,  1327,  1334,  1335,  1342,  1343,  1350,
+    1351,  1358,  1365,  1372,  1379,  1386,  1393,  1394,  1401,  1402,
+    1409,  1410,  1417,  1418,  1425,  1426,  1433,  1434,  1441,  1442,
+    1449,  1450,  1457,  1458,  1465,  1466,  1467,  1468,  1471,  1472,
+    1475,  1476,  1477,  1478,  1479,  1480,  1481,  1482,  1494,  1506,
+    1519,  1532,  1545,  1558,  1560,  1571,  1572,  1573,  1574,  1580,
+    1581,  1591,  1592,  1593,  1594,  1595,  1596,  1603,  1604,  1611,
+    1612,  1613,  1614,  1615,  1616,  1617,  1618,  1619,  1620,  1621,
+    1622,  1623,  1624,  1625,  1626,  1627,  1628,  1635,  1636,  1643,
+    1644,  1651,  1658,  1659,  1660,  1687,  1688,  1689,  1690,  1691,
+    1692,  1693,  1694,  1695,  1696,  1697,  1698,  1699,  1700,  1701,
+    1702,  1703,  1704,  1705,  1706,  1707,  1708,  1709,  1710,  1711,
+    1712,  1713,  1714,  1715,  1716,  1725,  1726,  1735,  1736,  1745,
+    1746,  1755,  1756,  1765,  1766,  1767,  1768,  1769,  1770,  1771,
+    1772,  1773,  1774,  1775,  1776,  1777,  1778,  1779,  1780,  1781,
+    1782,  1783,  1784,  1785,  1786,  1788,  1789,  1790,  1791,  1793,
+    1795,  1796,  1797,  1800,  1801,  1804,  1805,  1806,  1809,  1810,
+    1813,  1814,  1815,  1823,  1828,  1833,  1838,  1843,  1846,  1851,
+    1859,  1865,  1866,  1872,  1873,  1883,  1884,  1894,  1895,  1904,
+    1913,  1914,  1923,  1932,  1941,  1942,  1948,  1949,  1955,  1959,
+    1960,  1963,  1992,  2007,  2008,  2012,  2023,  2024,  2028,  2029,
+    2033,  2040,  2056,  2057,  2060,  2063,  2070,  2086,  2090,  2091,
+    2096,  2096,  2103,  2104,  2106,  2105,  2128,  2133,  2136,  2143,
+    2159,  2162,  2165,  2172,  2188,  2191,  2194,  2211,  2214,  2215,
+    2216,  2217,  2218,  2219,  2241,  2242,  2243,  2244,  2247,  2248,
+    2249,  2250,  2253,  2254,  2260,  2261,  2262,  2263,  2264,  2265,
+    2266,  2269,  2270,  2271,  2272,  2279,  2280,  2281,  2288,  2289,
+    2290,  2294,  2295,  2296,  2297,  2298,  2303,  2304,  2307,  2308,
+    2309,  2315,  2317,  2319,  2320,  2322,  2324,  2326,  2328,  2330,
+    2331,  2333,  2334,  2335,  2336,  2338,  2340,  2342,  2344,  2346,
+    2348,  2349,  2385,  2387,  2389,  2391,  2394,  2396,  2398,  2400,
+    2404,  2405,  2416,  2417,  2421,  2422,  2437,  2452,  2453,  2456,
+    2457,  2458,  2470,  2471,  2486,  2501,  2503,  2510,  2552,  2553,
+    2556,  2557,  2558,  2561,  2562,  2563,  2564,  2565,  2566,  2567,
+    2568,  2571,  2579,  2589,  2606,  2613,  2620,  2627,  2634,  2639,
+    2644,  2645,  2646,  2647,  2648,  2651,  2660,  2667,  2692,  2708,
+    2709,  2714,  2733,  2742,  2754,  2769,  2770,  2773,  2773,  2783,
+    2784,  2785,  2786,  2787,  2788,  2789,  2790,  2791,  2794,  2797,
+    2798,  2801,  2808,  2811,  2818,  2824,  2825,  2834,  2835,  2836,
+    2839,  2840,  2852,  2876,  2887,  2918,  2922,  2932,  2946,  2958,
+    2959,  2961,  2962,  2963,  2977,  2978,  2979,  2980,  2981,  2982,
+    2983,  2987,  2988,  2989,  3002,  3008,  3009,  3010,  3011,  3012,
+    3013,  3014,  3015,  3016,  3017,  3018,  3019,  3020,  3021,  3022,
+    3040,  3041,  3042,  3043,  3044,  3045,  3046,  3054,  3055,  3056,
+    3057,  3058,  3059,  3060,  3061,  3062,  3063,  3064,  3066,  3068,
+    3069,  3070,  3071,  3072,  3073,  3076,  3094,  3095,  3096,  3099,
+    3100,  3101,  3102,  3103,  3104,  3105,  3106,  3107,  3108,  3109,
+    3110,  3111,  3112,  3113,  3114,  3115,  3116,  3117,  3118,  3119,
+    3120,  3121,  3122,  3123,  3124,  3125,  3126,  3127,  3128,  3129,
+    3130,  3131,  3132,  3133,  3141,  3149,  3157,  3165,  3173,  3181,
+    3189,  3197,  3205,  3206,  3208,  3216,  3224,  3232,  3241,  3250,
+    3259,  3267,  3276,  3284,  3285,  3287,  3290,  3291,  3292,  3293,
+    3300,  3307,  3308,  3314,  3321,  3322,  3328,  3335,  3336,  3342,
+    3345,  3348,  3349,  3350,  3353,  3354,  3355,  3364,  3373,  3374,
+    3375,  3376,  3377,  3378,  3379,  3380,  3381,  3382,  3383,  3384,
+    3385,  3386,  3387,  3388,  3389,  3390,  3394,  3398,  3399,  3400,
+    3401,  3402,  3403,  3404,  3405,  3406,  3407,  3408,  3409,  3410,
+    3411,  3412,  3413,  3414,  3415,  3416,  3417,  3418,  3419,  3420,
+    3421,  3422,  3423,  3424,  3425,  3433,  3441,  3449,  3450,  3452,
+    3454,  3465,  3466,  3467,  3483,  3484,  3485,  3489,  3492,  3493,
+    3496,  3499,  3502,  3505,  3508,  3511,  3514,  3517,  3520,  3523,
+    3524,  3525,  3528,  3529,  3530,  3530,  3563,  3565,  3567,  3568,
+    3571,  3588,  3592,  3596,  3600,  3605,  3609,  3614,  3618,  3622,
+    3626
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "FORWARD",
+  "FORWARD_TCP", "FORWARD_TLS", "FORWARD_SCTP", "FORWARD_UDP", "EXIT",
+  "DROP", "RETURN", "BREAK", "LOG_TOK", "ERROR", "ROUTE", "ROUTE_REQUEST",
+  "ROUTE_FAILURE", "ROUTE_ONREPLY", "ROUTE_REPLY", "ROUTE_BRANCH",
+  "ROUTE_SEND", "ROUTE_EVENT", "EXEC", "SET_HOST", "SET_HOSTPORT",
+  "SET_HOSTPORTTRANS", "PREFIX", "STRIP", "STRIP_TAIL", "SET_USERPHONE",
+  "APPEND_BRANCH", "REMOVE_BRANCH", "CLEAR_BRANCHES", "SET_USER",
+  "SET_USERPASS", "SET_PORT", "SET_URI", "REVERT_URI", "FORCE_RPORT",
+  "ADD_LOCAL_RPORT", "LOCAL_RPORT", "FORCE_TCP_ALIAS", "UDP_MTU",
+  "UDP_MTU_TRY_PROTO", "UDP4_RAW", "UDP4_RAW_MTU", "UDP4_RAW_TTL", "IF",
+  "ELSE", "SET_ADV_ADDRESS", "SET_ADV_PORT", "FORCE_SEND_SOCKET",
+  "SET_FWD_NO_CONNECT", "SET_RPL_NO_CONNECT", "SET_FWD_CLOSE",
+  "SET_RPL_CLOSE", "SWITCH", "CASE", "DEFAULT", "WHILE", "CFG_SELECT",
+  "CFG_RESET", "URIHOST", "URIPORT", "MAX_LEN", "SETFLAG", "RESETFLAG",
+  "ISFLAGSET", "SETAVPFLAG", "RESETAVPFLAG", "ISAVPFLAGSET", "METHOD",
+  "URI", "FROM_URI", "TO_URI", "SRCIP", "SRCPORT", "DSTIP", "DSTPORT",
+  "TOIP", "TOPORT", "SNDIP", "SNDPORT", "SNDPROTO", "SNDAF", "PROTO", "AF",
+  "MYSELF", "MSGLEN", "UDP", "TCP", "TLS", "SCTP", "WS", "WSS", "DEBUG_V",
+  "FORK", "FORK_DELAY", "MODINIT_DELAY", "LOGSTDERROR", "LOGFACILITY",
+  "LOGNAME", "LOGCOLOR", "LOGPREFIX", "LOGPREFIXMODE", "LOGENGINETYPE",
+  "LOGENGINEDATA", "XAVPVIAPARAMS", "XAVPVIAFIELDS", "LISTEN", "ADVERTISE",
+  "STRNAME", "ALIAS", "SR_AUTO_ALIASES", "DNS", "REV_DNS", "DNS_TRY_IPV6",
+  "DNS_TRY_NAPTR", "DNS_SRV_LB", "DNS_UDP_PREF", "DNS_TCP_PREF",
+  "DNS_TLS_PREF", "DNS_SCTP_PREF", "DNS_RETR_TIME", "DNS_SLOW_QUERY_MS",
+  "DNS_RETR_NO", "DNS_SERVERS_NO", "DNS_USE_SEARCH", "DNS_SEARCH_FMATCH",
+  "DNS_NAPTR_IGNORE_RFC", "DNS_CACHE_INIT", "DNS_USE_CACHE",
+  "DNS_USE_FAILOVER", "DNS_CACHE_FLAGS", "DNS_CACHE_NEG_TTL",
+  "DNS_CACHE_MIN_TTL", "DNS_CACHE_MAX_TTL", "DNS_CACHE_MEM",
+  "DNS_CACHE_GC_INT", "DNS_CACHE_DEL_NONEXP", "DNS_CACHE_REC_PREF",
+  "AUTO_BIND_IPV6", "BIND_IPV6_LINK_LOCAL", "IPV6_HEX_STYLE",
+  "DST_BLST_INIT", "USE_DST_BLST", "DST_BLST_MEM", "DST_BLST_TTL",
+  "DST_BLST_GC_INT", "DST_BLST_UDP_IMASK", "DST_BLST_TCP_IMASK",
+  "DST_BLST_TLS_IMASK", "DST_BLST_SCTP_IMASK", "IP_FREE_BIND", "PORT",
+  "STAT", "STATS_NAMESEP", "CHILDREN", "SOCKET_WORKERS", "ASYNC_WORKERS",
+  "ASYNC_USLEEP", "ASYNC_NONBLOCK", "ASYNC_WORKERS_GROUP", "CHECK_VIA",
+  "PHONE2TEL", "MEMLOG", "MEMDBG", "MEMSUM", "MEMSAFETY", "MEMJOIN",
+  "MEMSTATUSMODE", "SIP_PARSER_LOG", "SIP_PARSER_MODE", "CORELOG",
+  "SIP_WARNING", "SERVER_SIGNATURE", "SERVER_HEADER", "USER_AGENT_HEADER",
+  "REPLY_TO_VIA", "LOADMODULE", "LOADMODULEX", "LOADPATH", "MODPARAM",
+  "MODPARAMX", "CFGENGINE", "MAXBUFFER", "SQL_BUFFER_SIZE", "USER",
+  "GROUP", "CHROOT", "WDIR", "RUNDIR", "MHOMED", "DISABLE_TCP",
+  "TCP_ACCEPT_ALIASES", "TCP_ACCEPT_UNIQUE", "TCP_CONNECTION_MATCH",
+  "TCP_CHILDREN", "TCP_CONNECT_TIMEOUT", "TCP_SEND_TIMEOUT",
+  "TCP_CON_LIFETIME", "TCP_POLL_METHOD", "TCP_MAX_CONNECTIONS",
+  "TLS_MAX_CONNECTIONS", "TCP_NO_CONNECT", "TCP_SOURCE_IPV4",
+  "TCP_SOURCE_IPV6", "TCP_OPT_FD_CACHE", "TCP_OPT_BUF_WRITE",
+  "TCP_OPT_CONN_WQ_MAX", "TCP_OPT_WQ_MAX", "TCP_OPT_RD_BUF",
+  "TCP_OPT_WQ_BLK", "TCP_OPT_DEFER_ACCEPT", "TCP_OPT_DELAYED_ACK",
+  "TCP_OPT_SYNCNT", "TCP_OPT_LINGER2", "TCP_OPT_KEEPALIVE",
+  "TCP_OPT_KEEPIDLE", "TCP_OPT_KEEPINTVL", "TCP_OPT_KEEPCNT",
+  "TCP_OPT_CRLF_PING", "TCP_OPT_ACCEPT_NO_CL", "TCP_OPT_ACCEPT_HEP3",
+  "TCP_OPT_ACCEPT_HAPROXY", "TCP_CLONE_RCVBUF", "TCP_REUSE_PORT",
+  "DISABLE_TLS", "ENABLE_TLS", "TLSLOG", "TLS_PORT_NO", "TLS_METHOD",
+  "TLS_HANDSHAKE_TIMEOUT", "TLS_SEND_TIMEOUT", "SSLv23", "SSLv2", "SSLv3",
+  "TLSv1", "TLS_VERIFY", "TLS_REQUIRE_CERTIFICATE", "TLS_CERTIFICATE",
+  "TLS_PRIVATE_KEY", "TLS_CA_LIST", "DISABLE_SCTP", "ENABLE_SCTP",
+  "SCTP_CHILDREN", "ADVERTISED_ADDRESS", "ADVERTISED_PORT", "DISABLE_CORE",
+  "OPEN_FD_LIMIT", "SHM_MEM_SZ", "SHM_FORCE_ALLOC", "MLOCK_PAGES",
+  "REAL_TIME", "RT_PRIO", "RT_POLICY", "RT_TIMER1_PRIO",
+  "RT_TIMER1_POLICY", "RT_TIMER2_PRIO", "RT_TIMER2_POLICY",
+  "MCAST_LOOPBACK", "MCAST_TTL", "MCAST", "TOS", "PMTU_DISCOVERY",
+  "KILL_TIMEOUT", "MAX_WLOOPS", "PVBUFSIZE", "PVBUFSLOTS", "PVCACHELIMIT",
+  "PVCACHEACTION", "HTTP_REPLY_PARSE", "VERSION_TABLE_CFG",
+  "VERBOSE_STARTUP", "ROUTE_LOCKS_SIZE", "WAIT_WORKER1_MODE",
+  "WAIT_WORKER1_TIME", "WAIT_WORKER1_USLEEP", "CFG_DESCRIPTION",
+  "SERVER_ID", "KEMI", "ONSEND_ROUTE_CALLBACK", "REPLY_ROUTE_CALLBACK",
+  "EVENT_ROUTE_CALLBACK", "RECEIVED_ROUTE_CALLBACK", "RECEIVED_ROUTE_MODE",
+  "PRE_ROUTING_CALLBACK", "MAX_RECURSIVE_LEVEL", "MAX_BRANCHES_PARAM",
+  "LATENCY_CFG_LOG", "LATENCY_LOG", "LATENCY_LIMIT_DB",
+  "LATENCY_LIMIT_ACTION", "LATENCY_LIMIT_CFG", "MSG_TIME",
+  "ONSEND_RT_REPLY", "URI_HOST_EXTRA_CHARS", "HDR_NAME_EXTRA_CHARS",
+  "FLAGS_DECL", "AVPFLAGS_DECL", "ATTR_MARK", "SELECT_MARK", "ATTR_FROM",
+  "ATTR_TO", "ATTR_FROMURI", "ATTR_TOURI", "ATTR_FROMUSER", "ATTR_TOUSER",
+  "ATTR_FROMDOMAIN", "ATTR_TODOMAIN", "ATTR_GLOBAL", "ADDEQ", "SUBST",
+  "SUBSTDEF", "SUBSTDEFS", "EQUAL", "LOG_OR", "LOG_AND", "BIN_OR",
+  "BIN_AND", "BIN_XOR", "BIN_LSHIFT", "BIN_RSHIFT", "EQUAL_T", "DIFF",
+  "MATCH", "INTEQ", "INTDIFF", "STREQ", "STRDIFF", "GT", "LT", "GTE",
+  "LTE", "PLUS", "MINUS", "STAR", "SLASH", "MODULO", "NOT", "UNARY",
+  "BIN_NOT", "DEFINED", "INTCAST", "STRCAST", "DOT", "STRLEN", "STREMPTY",
+  "SELVAL", "NUMBER", "ID", "NUM_ID", "STRING", "IPV6ADDR", "PVAR",
+  "AVP_OR_PVAR", "EVENT_RT_NAME", "COMMA", "SEMICOLON", "RPAREN", "LPAREN",
+  "LBRACE", "RBRACE", "LBRACK", "RBRACK", "CR", "COLON", "$accept", "cfg",
+  "statements", "statement", "$@1", "$@2", "$@3", "$@4", "$@5",
+  "listen_id", "listen_id_lst", "listen_id2", "proto", "eqproto", "port",
+  "phostport", "listen_phostport", "id_lst", "intno", "flags_decl",
+  "flag_list", "flag_spec", "flag_name", "avpflags_decl", "avpflag_list",
+  "avpflag_spec", "assign_stm", "cfg_var_id", "cfg_var_idn", "cfg_var",
+  "module_stm", "ip", "ipv4", "ipv6addr", "ipv6", "route_name",
+  "route_main", "route_stm", "failure_route_main", "failure_route_stm",
+  "route_reply_main", "onreply_route_stm", "$@6", "$@7",
+  "branch_route_main", "branch_route_stm", "send_route_main",
+  "send_route_stm", "event_route_main", "event_route_stm",
+  "preprocess_stm", "equalop", "cmpop", "strop", "rve_equalop",
+  "rve_cmpop", "uri_type", "eint_op_onsend", "eint_op", "eip_op_onsend",
+  "eip_op", "exp_elem", "ipnet", "host", "host_if_id", "host_or_if",
+  "fcmd", "stm", "actions", "action", "if_cmd", "ct_rval", "single_case",
+  "case_stms", "switch_cmd", "while_cmd", "select_param", "select_params",
+  "select_id", "$@8", "attr_class_spec", "attr_name_spec", "attr_spec",
+  "attr_mark", "attr_id", "attr_id_num_idx", "attr_id_no_idx",
+  "attr_id_ass", "attr_id_any", "attr_id_any_str", "pvar", "avp_pvar",
+  "assign_op", "lval", "rval", "rve_un_op", "rval_expr", "assign_action",
+  "avpflag_oper", "cmd", "$@9", "func_params", "func_param", "ret_cmd", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-1218)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-925)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    2305,  -287,    19,    15,  -249,  -245,  -232,  -221,  -195,  -190,
+    -187, -1218,  -182,  -172,  -163,  -135,  -115,  -110,  -103,   -95,
+     -90,   -77,   -71,   -70,   -65,   -50,   -21,   -16,    -5,     4,
+      20,    79,   171,   581,   653,   704,   736,   754,   818,   819,
+     873,   878,   884,   896,   908,   916,   936,   937,   942,   951,
+     953,   954,   955,   956,   957,   963,   972,   973,   988,   994,
+     999,  1000,  1007,  1009,  1012,  1016,  1017,  1023,    23,    24,
+      28,    35,   101,   340,   374,   421,   424,   430,   480,   546,
+     558,   566,   571,   574,   596,   597,   600,   601,   606,   608,
+     635,   657,   661,   123,   200,   154,    60,    70,   201,   670,
+     672,   673,   676,   677,   682,   699,   700,   727,   728,   762,
+     796,   801,   811,   840,   856,   867,   868,   870,   871,   874,
+     877,   886,   887,  1024,  1025,  1026,  1028,   891,   895,   917,
+     930,   940,   944,   948,   967,   976,   989,   992,   997,  1005,
+    1006,  1010,  1011,  1018,  1032,  1038,  1056,  1065,  1066,  1089,
+    1090,  1092,  1101,  1110,  1125,  1128,  1130,  1132,  1134,  1135,
+    1137,  1138,  1139,  1140,  1142,  1143,  1144,  1146,  1163,  1164,
+    1208,  1287,  1288,  1289,  1030,  1290,  1334,  1335,  1336,  1339,
+    1353,  1354,  1355,  1356,  1357,  1358,  1360,  1361,  1362,   -87,
+    1363,  1364,  1369,  1370,  1371,  1382,  1384,  1385,  1387,  1389,
+    1390,  1401,   121,   216,   206,   245,   248, -1218, -1218, -1218,
+     329,  1368, -1218,   214,   271,   311,   314,   333, -1218, -1218,
+   -1218,  -268, -1218, -1218,   136, -1218, -1218, -1218, -1218,  -146,
+   -1218,   272,   315,   345,   889,   331,   350,   352,   341,   355,
+     363,   394,   534,   158,   251,   564,   253,   610,   255,   258,
+     262,   265,    48,    85,   626,   628,   691, -1218,   454, -1218,
+     647, -1218,   683, -1218,  -260, -1218,  -260, -1218,  -260, -1218,
+    -260, -1218,   684, -1218,   690, -1218,   698, -1218,   722, -1218,
+     725, -1218,   739, -1218,   740, -1218,   747, -1218,   763, -1218,
+     764, -1218,   765, -1218,   778, -1218,   782, -1218,   786, -1218,
+     815, -1218,   911, -1218,   927, -1218,   943, -1218,  1372, -1218,
+    1374, -1218,   793, -1218,  1375, -1218,  1376, -1218,  1378, -1218,
+    1379, -1218,  1380, -1218,  1381, -1218,  1383, -1218,  1386, -1218,
+    1388,   344,   706,   266,   707,   708,   710,   712,   713,   268,
+     714,   715,   348,   361,   392,   395,   457,   459,   463,   467,
+     488,   716,   717,   270,   274,   718, -1218, -1218, -1218, -1218,
+   -1218,   276, -1218, -1218,   794, -1218,   888, -1218,   278, -1218,
+     723,   724,   217,   223,   226,   229,   236,   730,   731,   732,
+     733,   734,   745,   569,   611,   612,   239,   746,   749,   750,
+     751,    52,   752,   755, -1218,  1391, -1218,  1407, -1218,  1408,
+   -1218,  1409,   756,   757,   759,   760,   761,   766,   768,   769,
+     770,   771,   772,   773,   774,   775,   776,   779,   780,   781,
+      91,   783,   787,   795,   798,   279,   280,   281,   799,   800,
+     803,   104,   804,   808,   809,   810,   812,   813,   814,   816,
+     817,   820,   821,   823,   824,   825,   826,   242,   210, -1218,
+    1410,   827,   828,   830,   831,   832,   835,   838,   282,   841,
+     842,   845,   846,   847,   848,  1081,   614,  1411,  1412,   618,
+     681,   849,   851,   854,   858,   863,   283,   284, -1218, -1218,
+   -1218, -1218,   876,   784, -1218, -1218, -1218,  1326, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218,  -287, -1218,    22,    26,  1359,
+   -1218,    51,  1377, -1218,    63,  1419, -1218,    66,  1421, -1218,
+      18,   991, -1218,   -28,  1435, -1218, -1218, -1218, -1218,  1367,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218,  1436, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+    1394, -1218, -1218, -1218, -1218,   945,   807, -1218,  1351,  1404,
+    1338,   122, -1218, -1218, -1218, -1218, -1218,  -209, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218,  1429,  1431, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218,  1394, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218,  1482,  1483,  1487,  1488,
+    1497, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218,  -194,  1476,  -194, -1218,  -146, -1218, 12060,
+   -1218,  -146, 12060, -1218,  -146, 12060, -1218,  -146, 12060, -1218,
+    1470, -1218, -1218, -1218,  1512,  1464, 12060,    58, -1218,  1480,
+    1473,  1472,  1486,   335,  1343, -1218,   945,  1500,   319,   323,
+    1502,  1503,   285,   287,   288,   289,   290, -1218, -1218, -1218,
+    1492,    72,    80,    84,    86,    87, 10737, 11096, 11182, -1218,
+      89,    90,    92,  1498,   102,   105,   116,   117,   128,   130,
+     133,   134,  1507,   140,   143,   150,   160,  1508,  1513,  1514,
+    1522,  1535, 11268,   166,   177,   181,  1536,  1537,  1538,  1539,
+    6267, 11268,   182,   185,   186,   187,   188, -1218, -1218, -1218,
+   -1218,   189, -1218, -1218, -1218,   103,  3450, -1218, -1218, -1218,
+   -1218,  1405, -1218, -1218, -1218, -1218, -1218,  1525,  1542,   191,
+   -1218,  1543,  1546,  3520,  1556,  3601,  1558,  3880,  1560,   246,
+    1527,  3961, -1218,  1564,  1581,   945, -1218, -1218, -1218, -1218,
+   -1218, -1218,  1562,   -48, -1218, -1218, -1218, -1218, -1218, -1218,
+    1580,  1585, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218,  1577, -1218,    54, -1218,    39, -1218,   129, -1218,
+     146, -1218,   152,   918, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218,   642, -1218,   642, -1218,   982,
+   -1218, -1218,  1436, -1218, -1218,  6355,  6443,  6804,  1583,  1584,
+    1592, -1218,  5369, 11851, -1218,   925, -1218,   906, -1218,   961,
+   -1218, -1218, -1218,  1405, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218,  6892,  3865,  5730,  3865,  5818,  3865, -1218,   247, -1218,
+     295, -1218,  6980,  1613, -1218,   296, -1218,   297, -1218,   299,
+   -1218,   300, -1218,   864, -1218,   865, -1218,  1607, -1218,   215,
+    1608, -1218,   301, -1218,   304, -1218,   305, -1218,   306,  1609,
+    1610,  1611,     6,   931,  7341, 11627, -1218,   180, -1218,   879,
+   -1218,     8,  1612,  1621,  1631,  1633, -1218,  2054, 11627, -1218,
+     307, -1218,   313, -1218,   -57, -1218,   441, -1218,   575, -1218,
+    1634, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218,  1650, -1218,  1373, -1218,
+   11268, -1218, -1218,   225, -1218,  1635, -1218,  1637, -1218,  1646,
+   -1218,  1647, -1218,  1441,  1734,   -28, -1218, 12060,  1664, -1218,
+    -289,  1662,  1702,  -113,  -139, 12060,  1691,  -164, -1218,  -102,
+   -1218,   585,   563,  1693,   689,   695,   701,   978,  1694,   711,
+     719,   797,  1074,  1695,   924,   977,   987,  1087,  1696,   993,
+    1013,  1039,  1103, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+    7429,  5181,  5275, -1218,  1318,  1729, -1218, -1218, -1218, -1218,
+   -1218, -1218,  7517,  7878,  7966,  1721, -1218,  1766,  1767,  1768,
+    1769,  2309,  1727,  1725,  4031, -1218,  8054, -1218, -1218, -1218,
+   -1218, -1218,  8415,  8503, -1218,  2653,  1726, -1218, -1218,  8591,
+    8952,  9040,  9128, 11268, 11268, 11268, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218,  9489,  9577,  9665,
+   10026, 10114, 10202, 10563, -1218, -1218,  1732,  1731,  1733,  1737,
+    1736,  1743,    83,  2639,  1744,  1745,  1746,  1748,  1749,  1750,
+    1752,  1753,  1754,  1755,  1756,  1757,  1758, -1218,  1759, -1218,
+    1760, -1218,  1761,  1762,  1763,  1764,  1765,  1790,  1791,  1792,
+   -1218, -1218, -1218,  1793,  1794, -1218,  1795,  1796, 12060,  2077,
+   -1218,  1797,  1798,  1799,  1800,  1802,  1806,  1807,  1803, -1218,
+   -1218, -1218, -1218,    11, -1218,  1804,  1809,  1815,  1816,  1818,
+    1819,  1820,  1822,  1823,  1824, 11268,  1834,  1821,  3865,  1043,
+   -1218,  1405, -1218,  1829, -1218, 12060, 12060, 12060, 12060,  1835,
+    1836,  1874,  4101,  1845, -1218, -1218,  2080,  1833,  1860,  1861,
+    1862,  1863,  4240, -1218,   -37, -1218,  1844, -1218,  1846, -1218,
+     184,   222,  1875, -1218, -1218,   110, -1218,  1876, -1218,  1877,
+   -1218,  1878, -1218, -1218,   686, -1218,  1879, -1218,  1882, -1218,
+    1883, -1218, -1218,   696, -1218,  1884, -1218,  1887, -1218,  1891,
+   -1218, -1218,   726, -1218,  1893, -1218,  1894, -1218,  1895, -1218,
+   -1218,  1810,  1711, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218,  1711, -1218, -1218,  1711, -1218, -1218, -1218,  1831,
+   -1218,  1900,  1864,  2796,  1870,  2866,  1888,  3435, -1218, -1218,
+   -1218, -1218, -1218, -1218,  1880,  1711, -1218,  1711, -1218,   881,
+   -1218,  1950,  1394,  1740,  1911, -1218,  -203,  1711,  -170, -1218,
+    3887, -1218,  4014, -1218,  2816, -1218,  1701,  2884,  3022,  2004,
+   -1218,   557, -1218,   557, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218,  1711, -1218,   881, -1218,  1897, -1218, -1218,  1899, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,  4461,
+   11781, -1218, -1218, -1218, -1218, -1218,   339,   945, -1218,  1890,
+    5906,  1889, -1218, -1218,   882, -1218, 11695, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218,  3865,  1044, -1218, -1218, -1218,
+    -194, -1218, -1218,   252,  4600,  4670,  4740,  4821, -1218, -1218,
+    -270, -1218,  1904,  1902, -1218, -1218, -1218, -1218, -1218, -1218,
+    1898,  1901,  1903,  1905, -1218, -1218, -1218, -1218,  1906,  1930,
+    1931,  1932,  1933,  1934,  1935,  1936,  1937,  1938,  1939,  1940,
+    1942,  1943,  1944,  1951,  1953,  1954,  1955,  1956,  1958,   599,
+    1729, -1218, -1218, -1218, -1218, -1218, 11268,    14,  1892,  1959,
+    1985, -1218, -1218, -1218, -1218,  1980, -1218,  1986, 10651,  1987,
+    3865, 12060, -1218, -1218,  1995,  3005, 11268, -1218,  1996,  1997,
+    1998, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218,  1994,  2000, -1218,  3505, -1218,  1394,
+   -1218, -1218, -1218, -1218,  -289, 12060,  1993,  1999,  2741,  2811,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, 11268, -1218,
+    2881, 12060, 12060, -1218,  3020,  3365,  3241,  3380, -1218
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   479,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   478,    22,    23,
+       0,     0,     4,     0,     0,     0,     0,     0,     8,     9,
+       6,     0,   476,    10,     0,    15,     7,   477,   532,     0,
+     533,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   105,     0,   107,
+       0,   109,     0,   111,     0,   113,     0,   115,     0,   117,
+       0,   119,     0,   121,     0,   123,     0,   125,     0,   127,
+       0,   129,     0,   131,     0,   133,     0,   135,     0,   137,
+       0,   139,     0,   141,     0,   145,     0,   143,     0,   147,
+       0,   149,     0,   151,     0,   153,     0,   155,     0,   159,
+       0,   157,     0,   161,     0,   163,     0,   165,     0,   167,
+       0,   169,     0,   171,     0,   173,     0,   175,     0,   177,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   491,   490,   493,   492,
+     495,     0,   494,   500,     0,   504,     0,   506,     0,   505,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   277,     0,   279,     0,   281,     0,
+     283,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   407,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    60,    66,
+      65,    59,    61,    63,    68,    71,    67,    69,   549,   548,
+     551,   550,   553,   552,     1,     5,     3,     0,     0,     0,
+      12,     0,     0,    14,     0,     0,    17,     0,     0,    19,
+       0,     0,    21,     0,     0,   530,   515,   516,   517,     0,
+     465,   464,   467,   466,   463,   462,   469,    31,    32,    33,
+      34,    35,   468,   471,     0,    57,   470,   473,   472,   475,
+     474,    73,    72,    75,    74,    77,    76,    79,    78,    81,
+      80,    83,    82,    85,    84,    87,    86,    89,    88,    91,
+      90,    93,    92,    95,    94,    97,    96,    99,    98,   363,
+     631,   629,   630,    25,   512,     0,     0,    30,    50,     0,
+      55,   357,    24,   509,   513,   510,   632,    26,   365,   364,
+     367,   366,   101,   100,   103,   102,   104,   106,   108,   110,
+     112,   114,   116,   118,   120,   122,   124,   126,   128,   130,
+     132,   134,   136,   138,   140,   144,   142,   146,   148,   150,
+     152,   154,   158,   156,   160,   162,   164,   166,   168,   170,
+     172,   174,   176,   179,   178,   185,   180,   189,   188,   187,
+     186,   191,   190,   193,   192,   195,   194,   197,   196,   199,
+     198,   201,   200,   203,   202,   205,   204,   207,   206,   209,
+     208,   211,   210,   213,   212,   215,   214,   217,   216,   219,
+     218,   221,   220,   223,   222,   346,   345,   348,   347,   350,
+     349,   356,   355,   497,   496,     0,     0,   508,   507,   182,
+     181,   184,   183,   228,   227,   226,   231,   230,   229,   234,
+     233,   232,   237,   236,   235,   240,   239,   238,   242,   241,
+     244,   243,   246,   245,   248,   247,   250,   249,   252,   251,
+     254,   253,   256,   255,   258,   257,   261,   259,   260,   263,
+     262,   265,   264,   267,   266,   269,     0,   268,   271,   270,
+     273,   272,   275,   274,   276,   278,   280,   282,   285,   284,
+     287,   286,   289,   288,   291,   290,   293,   292,   295,   294,
+     297,   296,   299,   298,   301,   300,   303,   302,   305,   304,
+     307,   306,   309,   308,   311,   310,   313,   312,   315,   314,
+     317,   316,   319,   318,   324,   320,   321,   322,   323,   336,
+     335,   338,   337,   326,   325,   328,   327,   330,   329,   332,
+     331,   334,   333,   340,   339,   342,   341,   344,   343,   369,
+     368,   371,   370,   373,   372,   375,   374,   377,   376,   379,
+     378,   381,   380,   383,   382,   385,   384,   387,   386,   389,
+     388,   391,   390,   393,   392,   395,   394,   397,   396,   399,
+     398,   402,   400,   401,   405,   403,   404,   406,   409,   408,
+     411,   410,   413,   412,   415,   414,   417,   416,   419,   418,
+     421,   420,   225,   224,   423,   422,   425,   424,   427,   426,
+     429,   428,   431,   430,   433,   432,     0,     0,     0,     0,
+       0,   445,   444,   446,   447,   451,   450,   449,   448,   453,
+     452,   455,   454,   457,   456,   459,   458,   461,   460,   352,
+     351,   354,   353,     0,     0,     0,   522,     0,   523,     0,
+     527,     0,     0,   540,     0,     0,   544,     0,     0,   547,
+       0,   481,   482,   480,     0,     0,     0,     0,    58,     0,
+      27,     0,     0,     0,     0,    56,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    62,    64,    70,
+       0,     0,     0,     0,     0,     0,   936,   933,   937,   940,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   889,   891,   893,
+     896,     0,     0,     0,     0,     0,   910,   912,   914,   916,
+       0,     0,     0,     0,     0,     0,     0,   766,   767,   768,
+     691,     0,   703,   704,   649,     0,     0,   641,   644,   645,
+     646,     0,   695,   696,   706,   707,   708,     0,     0,     0,
+     637,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   536,     0,     0,     0,    29,   514,    54,    44,
+      43,    51,    52,   361,   358,   636,   631,   634,   635,   633,
+       0,     0,   435,   434,   437,   436,   439,   438,   441,   440,
+     443,   442,     0,   779,     0,   801,     0,   812,     0,   823,
+       0,   790,     0,     0,   575,   576,   577,   588,   581,   589,
+     582,   587,   579,   586,   578,     0,   580,     0,   583,     0,
+     584,   677,   723,   721,   722,     0,     0,     0,     0,     0,
+       0,   710,     0,     0,   709,     0,   585,     0,   590,     0,
+     716,   715,   714,     0,   697,   699,   698,   711,   712,   713,
+     724,     0,   935,     0,   932,     0,   939,   827,     0,   844,
+       0,   848,     0,     0,   852,     0,   871,     0,   874,     0,
+     855,     0,   861,     0,   858,     0,   864,     0,   867,     0,
+       0,   880,     0,   883,     0,   877,     0,   886,     0,     0,
+       0,     0,     0,     0,     0,     0,   902,     0,   905,     0,
+     908,     0,     0,     0,     0,     0,   669,     0,     0,   919,
+       0,   922,     0,   831,     0,   834,     0,   837,     0,   926,
+       0,   650,   643,   642,   520,   640,   679,   680,   681,   682,
+     683,   684,   685,   686,   687,   688,     0,   689,   692,   705,
+       0,   648,   842,     0,   647,     0,   525,     0,   538,     0,
+     542,     0,   487,   483,   484,     0,   531,     0,     0,    28,
+       0,     0,     0,     0,     0,     0,     0,     0,   624,     0,
+     769,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   594,   554,   555,   563,   556,   557,   562,
+       0,     0,     0,   619,     0,     0,   764,   745,   748,   726,
+     749,   727,     0,     0,     0,     0,   934,   697,   698,   712,
+     713,     0,     0,     0,     0,   598,     0,   603,   558,   559,
+     560,   561,     0,     0,   615,     0,   692,   747,   725,     0,
+       0,     0,     0,     0,     0,     0,   564,   565,   570,   566,
+     567,   568,   569,   571,   572,   573,   574,     0,     0,     0,
+       0,     0,     0,     0,   931,   938,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   863,     0,   866,
+       0,   869,     0,     0,     0,     0,     0,     0,     0,     0,
+     888,   890,   892,     0,     0,   895,     0,     0,     0,   651,
+     638,     0,     0,     0,     0,     0,    45,     0,     0,   909,
+     911,   913,   915,     0,   671,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   927,     0,     0,   765,     0,
+     702,     0,   700,     0,   701,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    53,   362,   359,     0,     0,     0,
+       0,     0,     0,   780,     0,   778,     0,   771,     0,   772,
+       0,     0,     0,   770,   802,     0,   800,     0,   793,     0,
+     794,     0,   792,   813,     0,   811,     0,   804,     0,   805,
+       0,   803,   824,     0,   822,     0,   815,     0,   816,     0,
+     814,   791,     0,   789,     0,   782,     0,   783,     0,   781,
+     593,     0,   591,   609,    36,    37,    38,    39,    40,    41,
+      42,   607,   608,   606,   604,   605,   618,   616,   617,   672,
+     676,   678,     0,     0,     0,     0,     0,     0,   720,   742,
+     719,   718,   717,   597,     0,   595,   602,   600,   601,   599,
+     614,     0,    57,     0,   622,   610,   612,   611,     0,   760,
+     741,   759,   740,   755,   733,   756,   734,   735,   736,   737,
+     750,   728,   751,   729,   752,   730,   753,   731,   754,   732,
+     758,   739,   757,   738,   828,     0,   825,   845,     0,   849,
+     847,   846,   850,   853,   851,   872,   870,   875,   873,   856,
+     854,   862,   860,   859,   857,   868,   865,   881,   879,   884,
+     882,   878,   876,   887,   885,   897,   894,   899,   898,     0,
+       0,   901,   900,   904,   903,   907,     0,     0,   906,     0,
+       0,     0,   668,   666,     0,   920,     0,   923,   921,   829,
+     830,   832,   833,   835,   836,   930,     0,   929,   690,   694,
+       0,   841,   692,     0,     0,     0,     0,     0,   485,   486,
+       0,   535,     0,     0,   498,   499,   501,   503,   502,   521,
+       0,     0,     0,     0,   628,   626,   627,   625,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   761,   743,   762,   744,   763,     0,     0,     0,     0,
+       0,   639,   652,    49,    46,    47,   670,     0,     0,     0,
+     653,   659,   667,   665,    57,     0,     0,   925,     0,     0,
+       0,   526,   539,   543,   546,   488,   489,   511,   360,   776,
+     777,   774,   775,   773,   798,   799,   796,   797,   795,   809,
+     810,   807,   808,   806,   820,   821,   818,   819,   817,   787,
+     788,   785,   786,   784,     0,     0,   675,     0,   623,   621,
+     620,   693,   826,   843,     0,   662,     0,     0,     0,     0,
+     917,   918,   928,   840,   839,   838,   674,   673,     0,    48,
+       0,   663,   657,   664,     0,     0,     0,     0,   746
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+   -1218, -1218, -1218,  2047, -1218, -1218, -1218, -1218, -1218,  -429,
+    1224,  1327,  -230,  1088, -1217, -1218, -1218,  -243,  -235, -1218,
+    1458, -1218,  -202, -1218,  1457, -1218, -1218, -1218,  1141, -1218,
+   -1218, -1027,  1873,  1817,  1976,   127, -1218, -1218, -1218, -1218,
+   -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218, -1218,
+   -1218, -1051, -1218, -1047, -1218, -1218,  1094, -1218, -1218, -1218,
+    1095, -1218, -1218,  -994,  -770, -1218,  -325, -1172,  -894,  -981,
+   -1218,   709,   790, -1218, -1218, -1218,   729, -1218, -1218, -1218,
+   -1218,   990, -1096,  -487,  -904, -1218,  -755, -1218, -1218, -1218,
+    -540,  -861, -1218, -1218, -1218, -1218,    46,   292, -1218, -1218,
+   -1218, -1218,   702, -1218
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,   210,   211,   212,   213,   214,   215,   216,   217,   577,
+     931,   578,   579,  1491,  1041,  1388,   580,   581,  1104,   218,
+     481,   482,   483,   219,   486,   487,   220,   221,   924,   222,
+     223,   582,   583,   584,   585,   519,   499,   500,   502,   503,
+     224,   225,   926,  1033,   505,   506,   508,   509,   511,   512,
+     226,  1269,  1303,  1270,  1332,  1333,  1105,  1106,  1107,  1108,
+    1109,  1110,  1525,  1242,   586,   587,  1111,  1379,  1006,  1007,
+    1008,  1689,  1603,  1604,  1009,  1010,  1500,  1501,  1112,  1275,
+    1206,  1207,  1208,  1113,  1114,  1115,  1116,  1014,  1117,  1413,
+    1118,  1119,  1210,  1017,  1120,  1121,  1291,  1018,  1019,  1020,
+    1190,  1616,  1617,  1021
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+     536,   485,   810,   542,   532,  1012,  1394,  1373,  1012,  1385,
+     589,  1012,  1599,  1424,  1012,  1738,   230,  1306,  1023,   919,
+     228,  1025,  1012,   906,  1027,  1195,  1640,   908,   227,   599,
+     921,   600,  1031,   601,  1271,   602,  1272,  1241,  1274,  1246,
+    1243,  1251,  1195,  1256,  1195,  1261,  1195,  1039,  1016,   569,
+    1195,  1016,   910,   738,  1016,  1236,  1302,  1016,  1296,  1032,
+    1040,   363,  1305,  1231,   913,  1016,   231,   916,  1600,  1601,
+     232,   365,  1247,  1063,  1252,   534,  1257,   513,  1262,  1705,
+     257,  1065,  1706,   233,  1189,  1067,   588,  1069,  1071,   535,
+    1127,  1129,   784,  1131,   234,   514,   634,   527,   528,   529,
+     530,  1244,  1012,  1134,  1191,   809,  1136,   656,   658,   660,
+     662,   664,   666,   668,   670,   672,  1237,  1138,  1140,  1012,
+     235,  1012,   478,  1012,   356,   236,   938,  1012,   237,  1142,
+    1248,  1144,  1440,   238,  1146,  1148,   939,   527,   528,   529,
+     530,  1151,  1441,   239,  1153,  1016,   930,  1253,   721,   723,
+     725,  1155,   240,  1258,  1013,   360,   479,  1013,   480,   551,
+    1013,  1157,  1016,  1013,  1016,   534,  1016,  1166,  1047,  1049,
+    1016,  1013,   259,  1649,   527,   528,   529,   530,  1168,   535,
+     241,  1381,  1170,  1179,  1380,  1644,  1181,  1183,  1185,  1187,
+    1189,  1249,  1212,  1434,  1619,  1435,   534,  1380,  1287,  1012,
+     242,   358,   367,   516,   517,   243,   518,   488,  1254,  1294,
+     535,   844,   244,  1429,  1259,  1430,  1358,   484,   693,  1287,
+     245,  1287,   534,  1646,   696,   246,  1409,   699,   497,   498,
+     702,   882,   936,   937,   886,   888,   535,   705,   247,  1427,
+     726,  1290,  1016,   841,   248,   249,   490,  1222,  1336,   492,
+     250,  1013,   553,  1699,   557,  1436,   561,  1437,   465,   563,
+    1287,  1012,  1290,   565,  1290,   251,   567,   637,  1013,   649,
+    1013,   677,  1013,   520,  1012,   679,  1013,   683,  1524,   687,
+     797,   799,   801,   862,   899,   901,  1052,   501,  1054,  1056,
+    1058,  1060,  1399,   479,   252,   480,  1339,  1345,  1347,   253,
+    1349,  1351,  1362,  1290,  1016,  1364,  1366,  1368,  1395,  1412,
+     254,  1526,  1641,  1195,  1397,  1622,   522,  1016,  1232,   255,
+    1045,   922,   923,  1012,  1048,   785,   786,   787,   788,   494,
+     504,  1012,   533,  1422,   507,   256,  1038,   935,   331,   332,
+    1683,  1432,   541,   333,   531,   633,   524,  1288,  1013,   655,
+     334,   537,  1414,   539,   510,  1374,   543,   570,   571,   572,
+     573,   574,   657,  1739,   545,  1375,  1016,   574,  1288,  1015,
+    1288,   576,  1015,  1602,  1016,  1015,  -529,   576,  1015,  1684,
+    -528,  -545,   229,  -518,   531,   907,  1015,  -519,   736,  1238,
+    1012,  1245,   574,   659,   258,   547,   661,   570,   571,   572,
+     573,   574,   576,   736,  1238,   574,  1239,   574,   575,  1288,
+    1013,   576,  -524,  1240,   911,   576,   335,   576,  1682,  -534,
+     364,   531,  1011,  1013,  -537,  1011,   914,  -541,  1011,   917,
+     366,  1011,  1064,  1016,   570,   571,   572,   573,   574,  1011,
+    1066,  1195,  1560,  -924,  1068,   575,  1070,  1072,   576,  1128,
+    1130,  1195,  1132,   570,   571,   572,   573,   574,   663,  1650,
+     665,  1192,  1135,  1274,   667,  1137,  1015,   576,   669,   361,
+    1274,   479,  1013,   480,  1012,   357,  1139,  1141,   736,  1238,
+    1013,  1250,   574,  1015,  1589,  1015,   260,  1015,  1143,   671,
+    1145,  1015,   576,  1147,  1149,   736,  1238,   515,  1255,   574,
+    1152,   736,  1238,  1154,  1260,   574,   362,  1043,   552,   576,
+    1156,  1012,  1012,  1012,  1012,   576,   368,  1016,  1012,  1011,
+    1158,  1624,  1625,  1626,  1627,  1000,  1167,  1759,  1012,   570,
+     571,   572,   573,   574,  1645,   549,  1011,  1169,  1011,  1013,
+    1011,  1171,  1180,   576,  1011,  1182,  1184,  1186,  1188,  -924,
+     534,  1213,   359,   369,  1016,  1016,  1016,  1016,   489,   845,
+     846,  1016,  1289,  1015,   535,   555,   479,   694,   480,   695,
+     720,  1016,  1647,   697,  1359,   698,   700,  1410,   701,   703,
+    1003,   704,   261,  1289,  1005,  1289,   706,  1005,   707,   727,
+    1005,   728,   842,  1005,   843,  1223,  1337,   491,  1224,  1338,
+     493,  1005,   479,   554,   480,   558,   930,   562,  1195,  1380,
+     564,   559,   722,   724,   566,   881,  1011,   568,   638,   885,
+     650,   521,   678,  1013,  1289,  1015,   680,   590,   684,   592,
+     688,   798,   800,   802,   863,   900,   902,  1053,  1015,  1055,
+    1057,  1059,  1061,  1195,  1195,  1195,  1195,  1340,  1346,  1348,
+    1740,  1350,  1352,  1363,   263,   336,  1365,  1367,  1369,  1396,
+    1013,  1013,  1013,  1013,   523,  1398,   534,  1013,  1046,   571,
+     572,  1039,  1046,   571,   572,  1039,   534,  1013,  1011,   534,
+     535,  1005,   887,   534,  1040,  1012,  1012,  1015,  1040,   337,
+     535,  1011,   594,   535,   525,  1015,   534,   535,  1005,   538,
+    1005,   540,  1005,   485,   544,   265,  1005,   635,   639,   641,
+     535,   643,   546,   645,   647,   651,   653,   673,   675,   681,
+    1012,  1012,  1012,  1012,   689,   691,  1411,   534,  1016,  1016,
+     534,   708,   710,   712,   714,   716,   338,   267,  1382,   339,
+    1011,   535,  1386,   548,   535,   340,   718,   729,  1011,  1654,
+     731,   733,   735,   740,  1015,   269,   742,   748,   750,  1659,
+     752,   754,   756,  1016,  1016,  1016,  1016,   758,  1195,   760,
+     762,   764,   766,   768,   770,   772,   774,   776,  1005,  1195,
+     778,   780,   782,  1195,   789,  1195,  1195,  1012,   791,  1664,
+    1401,   479,   534,   480,   534,   341,   793,  1749,   534,   795,
+     803,   805,   534,   596,   807,   811,   535,  1011,   535,   813,
+     815,   817,   535,   819,   821,   823,   535,   825,   827,   271,
+     273,   829,   831,   534,   833,   835,   837,   839,   848,   850,
+    1016,   852,   854,   856,  1013,  1013,   858,   535,  1015,   860,
+    1005,  1012,   864,   866,  1012,  1012,   868,   870,   872,   874,
+     889,  1760,   891,  1005,  1764,   893,  1012,  1012,  1012,   895,
+    1012,   342,  1012,  1012,   897,  1353,  1355,  1766,  1767,  1013,
+    1013,  1013,  1013,   343,   275,  1015,  1015,  1015,  1015,   277,
+    1383,   344,  1015,   550,  1016,   279,   345,  1016,  1016,   346,
+     526,  1011,  1015,  1329,  1330,  1331,   262,   281,  1440,  1016,
+    1016,  1016,  1005,  1016,   534,  1016,  1016,  1297,  1441,   283,
+    1005,   347,   348,   556,  1360,   349,   350,   285,   535,  1263,
+    1442,   351,  1443,   352,  1403,   479,  1295,   480,  1011,  1011,
+    1011,  1011,  1376,  1377,   534,  1011,  1013,   287,   289,  1600,
+    1601,  1387,  1438,   291,  1439,  1011,   534,   534,   535,   534,
+     353,  1734,   293,   534,   295,   297,   299,   301,   303,   560,
+     535,   535,  1304,   535,   305,  1264,  1265,   535,   264,  1005,
+    1267,  1268,   354,   307,   309,   591,   355,   593,   527,   528,
+     529,   530,  1400,  1273,  1402,   370,  1404,   371,   372,   311,
+    1013,   373,   374,  1013,  1013,   313,   597,   375,  1428,  1431,
+     315,   317,  1122,  1124,  1126,  1013,  1013,  1013,   319,  1013,
+     321,  1013,  1013,   323,   376,   377,   534,   325,   327,   266,
+     527,   528,   529,   530,   329,   394,   396,   398,  1165,   400,
+     535,   449,   598,   603,   950,  1655,  1177,  1178,  1022,   604,
+     595,  1024,   378,   379,  1026,  1660,  1445,   605,  1446,  1015,
+    1015,   268,  1447,  1005,  1448,   636,   640,   642,  1449,   644,
+    1450,   646,   648,   652,   654,   674,   676,   682,  1454,   270,
+    1455,   606,   690,   692,   607,  1665,  1456,   380,  1457,   709,
+     711,   713,   715,   717,  1015,  1015,  1015,  1015,   608,   609,
+    1005,  1005,  1005,  1005,   719,   730,   610,  1005,   732,   734,
+     736,   741,  1011,  1011,   743,   749,   751,  1005,   753,   755,
+     757,   381,   611,   612,   613,   759,   382,   761,   763,   765,
+     767,   769,   771,   773,   775,   777,   383,   614,   779,   781,
+     783,   615,   790,   272,   274,   616,   792,  1011,  1011,  1011,
+    1011,  1277,  1279,  1281,   794,   623,   685,   796,   804,   806,
+     904,  1015,   808,   812,  1458,   384,  1459,   814,   816,   818,
+     574,   820,   822,   824,   617,   826,   828,  1308,  1685,   830,
+     832,   385,   834,   836,   838,   840,   849,   851,  1343,   853,
+     855,   857,   386,   387,   859,   388,   389,   861,   276,   390,
+     865,   867,   391,   278,   869,   871,   873,   875,   890,   280,
+     892,   392,   393,   894,  1011,  1015,   402,   896,  1015,  1015,
+     403,   282,   898,  1354,  1356,  1327,  1328,  1329,  1330,  1331,
+    1015,  1015,  1015,   284,  1015,   531,  1015,  1015,  1384,  1264,
+    1265,   286,   404,   903,  1267,  1268,  1298,  1299,  1300,  1301,
+     686,  1264,  1265,  1266,  1692,   405,  1267,  1268,  1264,  1265,
+    1266,   288,   290,  1267,  1268,   406,  1408,   292,  1011,   407,
+     618,  1011,  1011,   408,  1005,  1005,   294,   531,   296,   298,
+     300,   302,   304,  1011,  1011,  1011,   619,  1011,   306,  1011,
+    1011,  1463,   409,  1464,  1264,  1265,  1266,   308,   310,  1267,
+    1268,   410,   620,  1678,   570,   571,   572,   573,   574,  1005,
+    1005,  1005,  1005,   312,   411,  1264,  1265,   412,   576,   314,
+    1267,  1268,   413,  1440,   316,   318,  1482,  1492,  1495,  1496,
+     414,   415,   320,  1441,   322,   416,   417,   324,  1503,  1505,
+    1507,   326,   328,   418,  1465,  1451,  1466,  1452,   330,   395,
+     397,   399,  1515,   401,  1467,   450,  1468,   419,  1517,  1519,
+    1472,  1527,  1473,   420,   920,  1530,  1532,  1534,  1536,  1537,
+    1538,  1539,   876,   877,   878,   879,  1005,   880,    -2,   495,
+    1474,   421,  1475,  1541,  1543,  1545,  1547,  1549,  1551,  1553,
+     422,   423,   -11,   -11,   -13,     2,     3,   -16,   -18,   -20,
+    1074,  1075,  1076,  1077,  1292,  1079,  1476,  1081,  1477,  1083,
+    1620,  1696,  1621,  1697,   424,   425,     4,   426,     5,  1440,
+       6,     7,     8,     9,    10,  1292,   427,  1292,  1698,  1441,
+    1005,  1700,  1440,  1005,  1005,   428,    11,   527,   528,   529,
+     530,  1460,  1441,  1461,  1735,  1005,  1005,  1005,  1440,  1005,
+     429,  1005,  1005,   430,  1469,   431,  1470,   432,  1441,   433,
+     434,  1615,   435,   436,   437,   438,  1292,   439,   440,   441,
+    1478,   442,  1479,    12,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,   443,   444,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
+      67,    68,    69,   445,    70,    71,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   446,   447,   448,   451,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,  1690,   188,   189,   452,
+     453,   454,  1695,   190,   455,   191,   192,   193,   194,   195,
+     196,   197,   198,   199,   200,   201,   202,   203,   456,   457,
+     458,   459,   460,   461,   531,   462,   463,   464,   466,   467,
+     204,   205,   206,   905,   468,   469,   470,   570,   571,   572,
+     573,   574,   570,   571,   572,   573,   574,   471,   575,   472,
+     473,   576,   474,   575,   475,   476,   576,  1196,  1197,  1198,
+    1199,  1200,  1201,  1202,  1203,  1204,   477,   933,   207,  1419,
+     909,   621,  1737,   622,   624,   625,   208,   626,   627,   628,
+     629,   927,   630,   209,  1690,   631,  1407,   632,   912,   929,
+     744,  1189,  1615,  -624,  -624,  -624,  -624,  -624,  -624,  -624,
+    -624,  -624,  -624,  -624,  -624,  1205,   745,   746,   747,   847,
+     883,   884,  -624,  -624,  -624,  -624,  -624,  -624,  -624,  -624,
+     934,  -624,  -624,  -624,  -624,  -624,  -624,  -624,  -624,  -624,
+     915,  -624,   918,  -624,   925,   928,   940,  -624,   941,  -624,
+    -624,  -624,  -624,  -624,  -624,  -624,  -624,   942,   943,  -624,
+    -624,  -624,   944,   945,  1765,  -624,  -624,  -624,  -624,  -624,
+    -624,  1189,   946,  -592,  -592,  -592,  -592,  -592,  -592,  -592,
+    -592,  -592,  -592,  -592,  -592,   948,  1028,  1029,  1030,  1034,
+    1035,  1036,  -592,  -592,  -592,  -592,  -592,  -592,  -592,  -592,
+    1209,  -592,  -592,  -592,  -592,  -592,  -592,  -592,  -592,  -592,
+    1037,  -592,  1044,  -592,  1050,  1051,  1062,  -592,  1133,  -592,
+    -592,  -592,  -592,  -592,  -592,  -592,  -592,  1150,  1159,  -592,
+    -592,  -592,  1225,  1160,  1161,  -592,  -592,  -592,  -592,  -592,
+    -592,  1273,  1162,  -596,  -596,  -596,  -596,  -596,  -596,  -596,
+    -596,  -596,  -596,  -596,  -596,  1163,  1172,  1173,  1174,  1175,
+    1211,  1214,  -596,  -596,  -596,  -596,  -596,  -596,  -596,  -596,
+    1215,  -596,  -596,  -596,  -596,  -596,  -596,  -596,  -596,  -596,
+    1217,  -596,  1219,  -596,  1221,  1227,  1228,  -596,  1230,  -596,
+    -596,  -596,  -596,  -596,  -596,  -596,  -596,  1233,  1235,  -596,
+    -596,  -596,  1234,  1282,  1283,  -596,  -596,  -596,  -596,  -596,
+    -596,  1273,  1284,  -613,  -613,  -613,  -613,  -613,  -613,  -613,
+    -613,  -613,  -613,  -613,  -613,  1344,  1357,  1361,  1370,  1371,
+    1372,  1389,  -613,  -613,  -613,  -613,  -613,  -613,  -613,  -613,
+    1390,  -613,  -613,  -613,  -613,  -613,  -613,  -613,  -613,  -613,
+    1391,  -613,  1392,  -613,  1405,  1406,  1415,  -613,  1416,  -613,
+    -613,  -613,  -613,  -613,  -613,  -613,  -613,  1417,  1418,  -613,
+    -613,  -613,  1420,  1423,  1425,  -613,  -613,  -613,  -613,  -613,
+    -613,  1313,  1314,  1315,  1316,  1317,  1318,  1319,  1320,  1321,
+    1322,  1323,  1324,  1325,  1326,  1327,  1328,  1329,  1330,  1331,
+    -624,  1323,  1324,  1325,  1326,  1327,  1328,  1329,  1330,  1331,
+    1433,  1426,  1444,  1453,  1462,  1471,  -624,  -624,  -624,  -624,
+    -624,  -624,  -624,  -624,  -624,  -624,  -624,  -624,  -624,  -624,
+    -624,  -624,  -624,  -624,  -624,  -624,  -624,  -624,  -624,  1499,
+    1508,  -695,  -696,  -707,  -708,  -624,  1510,  1511,  1555,  1528,
+    -624,  1554,  1556,  1558,  -624,  -624,  1557,  -624,  -624,  -624,
+    -924,  -624,  1559,  1562,  1563,  1564,  -624,  1565,  1566,  1567,
+    -592,  1568,  1569,  1570,  1571,  1572,  1573,  1574,  1575,  1576,
+    1577,  1578,  1579,  1580,  1581,  1590,  -592,  -592,  -592,  -592,
+    -592,  -592,  -592,  -592,  -592,  -592,  -592,  -592,  -592,  -592,
+    -592,  -592,  -592,  -592,  -592,  -592,  -592,  -592,  -592,  1582,
+    1583,  1584,  1585,  1586,  1587,  1588,  1591,  1592,  1593,  1594,
+    -592,  1595,  1598,  1605,  -592,  -592,  1606,  -592,  -592,  -592,
+    -924,  -592,  1596,  1597,  1607,  1608,  -592,  1609,  1610,  1611,
+    -596,  1612,  1613,  1614,  1205,  1619,  1623,  1628,  1629,  1630,
+    1632,  1633,  1634,  1642,  1669,  1643,  -596,  -596,  -596,  -596,
+    -596,  -596,  -596,  -596,  -596,  -596,  -596,  -596,  -596,  -596,
+    -596,  -596,  -596,  -596,  -596,  -596,  -596,  -596,  -596,  1635,
+    1636,  1637,  1638,  1671,  1648,  1651,  1652,  1653,  1656,  1673,
+    -596,  1657,  1658,  1661,  -596,  -596,  1662,  -596,  -596,  -596,
+    1663,  -596,  1666,  1667,  1668,  1670,  -596,  1675,  1677,  1679,
+    -613,  1680,  1686,  1707,  1708,  1691,  1741,  1709,   496,  1229,
+    1710,  1042,  1711,   737,  1712,  1713,  -613,  -613,  -613,  -613,
+    -613,  -613,  -613,  -613,  -613,  -613,  -613,  -613,  -613,  -613,
+    -613,  -613,  -613,  -613,  -613,  -613,  -613,  -613,  -613,  1714,
+    1715,  1716,  1717,  1718,  1719,  1720,  1721,  1722,  1723,  1724,
+    -613,  1725,  1726,  1727,  -613,  -613,     1,  -613,  -613,  -613,
+    1728,  -613,  1729,  1730,  1731,  1732,  -613,  1733,  1742,   -11,
+     -11,   -13,     2,     3,   -16,   -18,   -20,  1316,  1317,  1318,
+    1319,  1320,  1321,  1322,  1323,  1324,  1325,  1326,  1327,  1328,
+    1329,  1330,  1331,     4,  1743,     5,  1744,     6,     7,     8,
+       9,    10,  1745,  1748,  1750,  1753,  1754,  1755,  1756,  1761,
+    1494,   947,   949,    11,  1757,  1762,  1421,   739,  1497,  1498,
+    1309,  1310,  1311,  1312,  1313,  1314,  1315,  1316,  1317,  1318,
+    1319,  1320,  1321,  1322,  1323,  1324,  1325,  1326,  1327,  1328,
+    1329,  1330,  1331,   932,  1693,     0,  1618,  1747,  1752,  1736,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,  1393,     0,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+       0,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,     0,
+       0,     0,     0,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
+     175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
+     185,   186,   187,     0,   188,   189,     0,     0,     0,     0,
+     190,     0,   191,   192,   193,   194,   195,   196,   197,   198,
+     199,   200,   201,   202,   203,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   204,   205,   206,
+       0,     0,     0,     0,     0,  1309,  1310,  1311,  1312,  1313,
+    1314,  1315,  1316,  1317,  1318,  1319,  1320,  1321,  1322,  1323,
+    1324,  1325,  1326,  1327,  1328,  1329,  1330,  1331,     0,     0,
+       0,     0,     0,     0,  1520,   207,   951,   952,   953,   954,
+     955,     0,     0,   208,     0,   960,   961,   962,  1509,     0,
+     209,     0,     0,     0,     0,   963,   964,   965,   966,   967,
+     968,   969,   970,     0,   971,   972,   973,   974,   975,   976,
+     977,   978,   979,     0,   980,     0,   981,     0,     0,     0,
+       0,     0,   983,   984,   985,   986,   987,   988,   989,     0,
+       0,     0,     0,   992,   993,     0,     0,     0,   994,   995,
+     996,   997,   998,   999,  1073,  1074,  1075,  1076,  1077,  1078,
+    1079,  1080,  1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,
+    1521,  1090,  1763,     0,   951,   952,   953,   954,   955,   956,
+     957,   958,   959,   960,   961,   962,     0,     0,     0,     0,
+       0,     0,     0,   963,   964,   965,   966,   967,   968,   969,
+     970,     0,   971,   972,   973,   974,   975,   976,   977,   978,
+     979,     0,   980,     0,   981,     0,     0,     0,   982,     0,
+     983,   984,   985,   986,   987,   988,   989,   990,  -656,  -656,
+     991,   992,   993,     0,     0,     0,   994,   995,   996,   997,
+     998,   999,  1193,     0,   951,   952,   953,   954,   955,   956,
+     957,   958,   959,   960,   961,   962,     0,     0,     0,     0,
+       0,     0,     0,   963,   964,   965,   966,   967,   968,   969,
+     970,     0,   971,   972,   973,   974,   975,   976,   977,   978,
+     979,     0,   980,     0,   981,     0,     0,     0,   982,     0,
+     983,   984,   985,   986,   987,   988,   989,   990,  -658,  -658,
+     991,   992,   993,     0,     0,     0,   994,   995,   996,   997,
+     998,   999,  1193,     0,   951,   952,   953,   954,   955,   956,
+     957,   958,   959,   960,   961,   962,     0,     0,     0,     0,
+       0,     0,     0,   963,   964,   965,   966,   967,   968,   969,
+     970,     0,   971,   972,   973,   974,   975,   976,   977,   978,
+     979,     0,   980,     0,   981,     0,     0,     0,   982,     0,
+     983,   984,   985,   986,   987,   988,   989,   990,  -660,  -660,
+     991,   992,   993,     0,     0,     0,   994,   995,   996,   997,
+     998,   999,     0,  1000,  1091,  1309,  1310,  1311,  1312,  1313,
+    1314,  1315,  1316,  1317,  1318,  1319,  1320,  1321,  1322,  1323,
+    1324,  1325,  1326,  1327,  1328,  1329,  1330,  1331,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  1092,     0,
+       0,     0,  1093,     0,  1094,  1095,  1096,  1097,  1561,  1098,
+    1099,  1100,  1522,  1523,     0,  1101,   574,  1002,  1003,     0,
+       0,     0,     0,  1164,  1103,     0,   576,     0,     0,     0,
+       0,  1193,     0,   951,   952,   953,   954,   955,   956,   957,
+     958,   959,   960,   961,   962,     0,     0,     0,     0,     0,
+       0,  1000,   963,   964,   965,   966,   967,   968,   969,   970,
+       0,   971,   972,   973,   974,   975,   976,   977,   978,   979,
+       0,   980,     0,   981,     0,     0,     0,   982,     0,   983,
+     984,   985,   986,   987,   988,   989,   990,  -654,  -654,   991,
+     992,   993,     0,     0,     0,   994,   995,   996,   997,   998,
+     999,  1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,
+       0,     0,     0,  -656,     0,     0,     0,     0,     0,     0,
+       0,  1000,  1309,  1310,  1311,  1312,  1313,  1314,  1315,  1316,
+    1317,  1318,  1319,  1320,  1321,  1322,  1323,  1324,  1325,  1326,
+    1327,  1328,  1329,  1330,  1331,  1312,  1313,  1314,  1315,  1316,
+    1317,  1318,  1319,  1320,  1321,  1322,  1323,  1324,  1325,  1326,
+    1327,  1328,  1329,  1330,  1331,  1672,     0,     0,     0,     0,
+       0,  1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,
+       0,     0,     0,  -658,     0,     0,     0,     0,     0,     0,
+       0,  1000,  1309,  1310,  1311,  1312,  1313,  1314,  1315,  1316,
+    1317,  1318,  1319,  1320,  1321,  1322,  1323,  1324,  1325,  1326,
+    1327,  1328,  1329,  1330,  1331,  1314,  1315,  1316,  1317,  1318,
+    1319,  1320,  1321,  1322,  1323,  1324,  1325,  1326,  1327,  1328,
+    1329,  1330,  1331,     0,     0,  1674,     0,     0,     0,     0,
+       0,  1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,
+       0,     0,  1193,  -660,   951,   952,   953,   954,   955,   956,
+     957,   958,   959,   960,   961,   962,     0,     0,     0,     0,
+       0,     0,     0,   963,   964,   965,   966,   967,   968,   969,
+     970,     0,   971,   972,   973,   974,   975,   976,   977,   978,
+     979,     0,   980,     0,   981,     0,     0,     0,   982,     0,
+     983,   984,   985,   986,   987,   988,   989,   990,  -661,  -661,
+     991,   992,   993,     0,     0,     0,   994,   995,   996,   997,
+     998,   999,     0,     0,     0,     0,     0,     0,     0,     0,
+    1000,  1309,  1310,  1311,  1312,  1313,  1314,  1315,  1316,  1317,
+    1318,  1319,  1320,  1321,  1322,  1323,  1324,  1325,  1326,  1327,
+    1328,  1329,  1330,  1331,  1315,  1316,  1317,  1318,  1319,  1320,
+    1321,  1322,  1323,  1324,  1325,  1326,  1327,  1328,  1329,  1330,
+    1331,     0,     0,     0,  1751,     0,     0,     0,     0,     0,
+    1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,     0,
+       0,  1193,  -654,   951,   952,   953,   954,   955,   956,   957,
+     958,   959,   960,   961,   962,     0,     0,     0,     0,     0,
+       0,     0,   963,   964,   965,   966,   967,   968,   969,   970,
+       0,   971,   972,   973,   974,   975,   976,   977,   978,   979,
+       0,   980,     0,   981,     0,     0,     0,   982,     0,   983,
+     984,   985,   986,   987,   988,   989,   990,  -655,  -655,   991,
+     992,   993,     0,     0,     0,   994,   995,   996,   997,   998,
+     999,  1193,     0,   951,   952,   953,   954,   955,   956,   957,
+     958,   959,   960,   961,   962,     0,     0,     0,     0,     0,
+       0,     0,   963,   964,   965,   966,   967,   968,   969,   970,
+       0,   971,   972,   973,   974,   975,   976,   977,   978,   979,
+       0,   980,     0,   981,     0,     0,     0,   982,     0,   983,
+     984,   985,   986,   987,   988,   989,   990,     0,     0,   991,
+     992,   993,     0,     0,     0,   994,   995,   996,   997,   998,
+     999,  1193,     0,   951,   952,   953,   954,   955,   956,   957,
+     958,   959,   960,   961,   962,     0,     0,     0,     0,     0,
+       0,  1000,   963,   964,   965,   966,   967,   968,   969,   970,
+       0,   971,   972,   973,   974,   975,   976,   977,   978,   979,
+       0,   980,     0,   981,     0,     0,     0,   982,     0,   983,
+     984,   985,   986,   987,   988,   989,   990,     0,     0,   991,
+     992,   993,     0,     0,     0,   994,   995,   996,   997,   998,
+     999,  1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,
+       0,     0,  1193,  -661,   951,   952,   953,   954,   955,   956,
+     957,   958,   959,   960,   961,   962,     0,     0,     0,     0,
+       0,     0,     0,   963,   964,   965,   966,   967,   968,   969,
+     970,     0,   971,   972,   973,   974,   975,   976,   977,   978,
+     979,     0,   980,     0,   981,     0,     0,     0,   982,     0,
+     983,   984,   985,   986,   987,   988,   989,   990,     0,     0,
+     991,   992,   993,     0,     0,     0,   994,   995,   996,   997,
+     998,   999,     0,     0,     0,     0,     0,     0,     0,     0,
+    1000,  1309,  1310,  1311,  1312,  1313,  1314,  1315,  1316,  1317,
+    1318,  1319,  1320,  1321,  1322,  1323,  1324,  1325,  1326,  1327,
+    1328,  1329,  1330,  1331,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  1768,     0,     0,     0,     0,     0,
+    1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,     0,
+       0,     0,  -655,     0,     0,     0,     0,     0,     0,     0,
+    1000,  1309,  1310,  1311,  1312,  1313,  1314,  1315,  1316,  1317,
+    1318,  1319,  1320,  1321,  1322,  1323,  1324,  1325,  1326,  1327,
+    1328,  1329,  1330,  1331,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1676,     0,     0,     0,     0,     0,     0,     0,
+    1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,     0,
+       0,     0,  1194,     0,     0,     0,     0,     0,     0,     0,
+    1000,  1309,  1310,  1311,  1312,  1313,  1314,  1315,  1316,  1317,
+    1318,  1319,  1320,  1321,  1322,  1323,  1324,  1325,  1326,  1327,
+    1328,  1329,  1330,  1331,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1758,     0,     0,     0,     0,     0,     0,     0,
+    1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,     0,
+       0,  1193,  1216,   951,   952,   953,   954,   955,   956,   957,
+     958,   959,   960,   961,   962,     0,     0,     0,     0,     0,
+       0,  1000,   963,   964,   965,   966,   967,   968,   969,   970,
+       0,   971,   972,   973,   974,   975,   976,   977,   978,   979,
+       0,   980,     0,   981,     0,     0,     0,   982,     0,   983,
+     984,   985,   986,   987,   988,   989,   990,     0,     0,   991,
+     992,   993,     0,     0,     0,   994,   995,   996,   997,   998,
+     999,  1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,
+       0,     0,  1193,  1218,   951,   952,   953,   954,   955,   956,
+     957,   958,   959,   960,   961,   962,     0,     0,     0,     0,
+       0,     0,     0,   963,   964,   965,   966,   967,   968,   969,
+     970,     0,   971,   972,   973,   974,   975,   976,   977,   978,
+     979,     0,   980,     0,   981,     0,     0,     0,   982,     0,
+     983,   984,   985,   986,   987,   988,   989,   990,     0,     0,
+     991,   992,   993,     0,     0,     0,   994,   995,   996,   997,
+     998,   999,  1193,     0,   951,   952,   953,   954,   955,   956,
+     957,   958,   959,   960,   961,   962,     0,     0,     0,     0,
+       0,     0,     0,   963,   964,   965,   966,   967,   968,   969,
+     970,     0,   971,   972,   973,   974,   975,   976,   977,   978,
+     979,     0,   980,     0,   981,     0,     0,     0,   982,     0,
+     983,   984,   985,   986,   987,   988,   989,   990,     0,     0,
+     991,   992,   993,     0,     0,     0,   994,   995,   996,   997,
+     998,   999,  1193,     0,   951,   952,   953,   954,   955,   956,
+     957,   958,   959,   960,   961,   962,     0,     0,     0,     0,
+       0,     0,     0,   963,   964,   965,   966,   967,   968,   969,
+     970,     0,   971,   972,   973,   974,   975,   976,   977,   978,
+     979,     0,   980,     0,   981,     0,     0,     0,   982,     0,
+     983,   984,   985,   986,   987,   988,   989,   990,     0,     0,
+     991,   992,   993,     0,     0,     0,   994,   995,   996,   997,
+     998,   999,     0,     0,     0,     0,     0,     0,     0,     0,
+    1000,  1309,  1310,  1311,  1312,  1313,  1314,  1315,  1316,  1317,
+    1318,  1319,  1320,  1321,  1322,  1323,  1324,  1325,  1326,  1327,
+    1328,  1329,  1330,  1331,  1310,  1311,  1312,  1313,  1314,  1315,
+    1316,  1317,  1318,  1319,  1320,  1321,  1322,  1323,  1324,  1325,
+    1326,  1327,  1328,  1329,  1330,  1331,     0,     0,     0,     0,
+    1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,     0,
+       0,  1193,  1220,   951,   952,   953,   954,   955,   956,   957,
+     958,   959,   960,   961,   962,     0,     0,     0,     0,     0,
+       0,  1000,   963,   964,   965,   966,   967,   968,   969,   970,
+       0,   971,   972,   973,   974,   975,   976,   977,   978,   979,
+       0,   980,     0,   981,     0,     0,     0,   982,     0,   983,
+     984,   985,   986,   987,   988,   989,   990,     0,     0,   991,
+     992,   993,     0,     0,     0,   994,   995,   996,   997,   998,
+     999,  1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,
+       0,     0,     0,  1226,     0,     0,     0,     0,     0,     0,
+       0,  1000,  1311,  1312,  1313,  1314,  1315,  1316,  1317,  1318,
+    1319,  1320,  1321,  1322,  1323,  1324,  1325,  1326,  1327,  1328,
+    1329,  1330,  1331,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,
+       0,     0,     0,  1512,     0,     0,     0,     0,     0,     0,
+       0,  1000,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,
+       0,     0,  1193,  1631,   951,   952,   953,   954,   955,   956,
+     957,   958,   959,   960,   961,   962,     0,     0,     0,     0,
+       0,     0,     0,   963,   964,   965,   966,   967,   968,   969,
+     970,     0,   971,   972,   973,   974,   975,   976,   977,   978,
+     979,     0,   980,     0,   981,     0,     0,     0,   982,     0,
+     983,   984,   985,   986,   987,   988,   989,   990,     0,     0,
+     991,   992,   993,     0,     0,     0,   994,   995,   996,   997,
+     998,   999,     0,     0,     0,     0,     0,     0,     0,     0,
+    1000,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,     0,
+       0,  1193,  1639,   951,   952,   953,   954,   955,   956,   957,
+     958,   959,   960,   961,   962,     0,     0,     0,     0,     0,
+       0,     0,   963,   964,   965,   966,   967,   968,   969,   970,
+       0,   971,   972,   973,   974,   975,   976,   977,   978,   979,
+       0,   980,     0,   981,     0,     0,     0,   982,     0,   983,
+     984,   985,   986,   987,   988,   989,   990,     0,     0,   991,
+     992,   993,     0,     0,     0,   994,   995,   996,   997,   998,
+     999,  1193,     0,   951,   952,   953,   954,   955,   956,   957,
+     958,   959,   960,   961,   962,     0,     0,     0,     0,     0,
+       0,     0,   963,   964,   965,   966,   967,   968,   969,   970,
+       0,   971,   972,   973,   974,   975,   976,   977,   978,   979,
+       0,   980,     0,   981,     0,     0,     0,   982,     0,   983,
+     984,   985,   986,   987,   988,   989,   990,     0,     0,   991,
+     992,   993,     0,     0,     0,   994,   995,   996,   997,   998,
+     999,  1193,     0,   951,   952,   953,   954,   955,   956,   957,
+     958,   959,   960,   961,   962,     0,     0,     0,     0,     0,
+       0,  1000,   963,   964,   965,   966,   967,   968,   969,   970,
+       0,   971,   972,   973,   974,   975,   976,   977,   978,   979,
+       0,   980,     0,   981,     0,     0,     0,   982,     0,   983,
+     984,   985,   986,   987,   988,   989,   990,     0,     0,   991,
+     992,   993,     0,     0,     0,   994,   995,   996,   997,   998,
+     999,  1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,
+       0,     0,  1193,  1681,   951,   952,   953,   954,   955,   956,
+     957,   958,   959,   960,   961,   962,     0,     0,     0,     0,
+       0,     0,     0,   963,   964,   965,   966,   967,   968,   969,
+     970,     0,   971,   972,   973,   974,   975,   976,   977,   978,
+     979,     0,   980,     0,   981,     0,     0,     0,   982,     0,
+     983,   984,   985,   986,   987,   988,   989,   990,     0,     0,
+     991,   992,   993,     0,     0,     0,   994,   995,   996,   997,
+     998,   999,     0,     0,     0,     0,     0,     0,     0,     0,
+    1000,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,     0,
+       0,     0,  1701,     0,     0,     0,     0,     0,     0,     0,
+    1000,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,     0,
+       0,     0,  1702,     0,     0,     0,     0,     0,     0,     0,
+    1000,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,     0,
+       0,     0,  1703,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  1000,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,
+       0,     0,  1483,  1704,   951,   952,   953,   954,   955,     0,
+       0,     0,     0,   960,   961,   962,     0,     0,     0,     0,
+       0,     0,     0,   963,   964,   965,   966,   967,   968,   969,
+     970,     0,   971,   972,   973,   974,   975,   976,   977,   978,
+     979,     0,   980,     0,   981,     0,     0,     0,     0,     0,
+     983,   984,   985,   986,   987,   988,   989,     0,     0,     0,
+       0,   992,   993,     0,     0,     0,   994,   995,   996,   997,
+     998,   999,  1073,  1074,  1075,  1076,  1077,  1078,  1079,  1080,
+    1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,  1089,  1090,
+    1484,  1485,  1486,  1487,  1488,  1489,  1493,     0,   951,   952,
+     953,   954,   955,     0,     0,     0,     0,   960,   961,   962,
+       0,     0,     0,     0,     0,     0,     0,   963,   964,   965,
+     966,   967,   968,   969,   970,     0,   971,   972,   973,   974,
+     975,   976,   977,   978,   979,     0,   980,     0,   981,     0,
+       0,     0,     0,     0,   983,   984,   985,   986,   987,   988,
+     989,     0,     0,     0,     0,   992,   993,     0,     0,     0,
+     994,   995,   996,   997,   998,   999,  1073,  1074,  1075,  1076,
+    1077,  1078,  1079,  1080,  1081,  1082,  1083,  1084,  1085,  1086,
+    1087,  1088,  1089,  1090,  1484,  1485,  1486,  1487,  1488,  1489,
+    1285,     0,   951,   952,   953,   954,   955,     0,     0,     0,
+       0,   960,   961,   962,     0,     0,     0,     0,     0,     0,
+       0,   963,   964,   965,   966,   967,   968,   969,   970,     0,
+     971,   972,   973,   974,   975,   976,   977,   978,   979,     0,
+     980,     0,   981,     0,     0,     0,     0,     0,   983,   984,
+     985,   986,   987,   988,   989,     0,     0,     0,     0,   992,
+     993,     0,     0,     0,   994,   995,   996,   997,   998,   999,
+    1073,  1074,  1075,  1076,  1077,  1078,  1079,  1080,  1081,  1082,
+    1083,  1084,  1085,  1086,  1087,  1088,  1089,  1090,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  1000,  1091,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  1092,  1490,     0,     0,
+    1093,     0,  1094,  1095,  1096,  1097,     0,  1098,  1099,  1100,
+     535,  1001,     0,  1101,     0,  1002,  1003,     0,     0,     0,
+       0,  1164,  1103,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  1000,  1091,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1092,  1490,     0,     0,  1093,     0,  1094,  1095,  1096,  1097,
+       0,  1098,  1099,  1100,   535,  1001,     0,  1101,     0,  1002,
+    1003,     0,     0,     0,     0,  1164,  1103,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  1000,
+    1091,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  1092,     0,     0,     0,  1093,     0,
+    1094,  1095,  1096,  1097,     0,  1098,  1099,  1100,   535,  1001,
+       0,  1101,     0,  1002,  1003,     0,     0,     0,  1286,  1164,
+    1103,  1285,     0,   951,   952,   953,   954,   955,     0,     0,
+       0,     0,   960,   961,   962,     0,     0,     0,     0,     0,
+       0,     0,   963,   964,   965,   966,   967,   968,   969,   970,
+       0,   971,   972,   973,   974,   975,   976,   977,   978,   979,
+       0,   980,     0,   981,     0,     0,     0,     0,     0,   983,
+     984,   985,   986,   987,   988,   989,     0,     0,     0,     0,
+     992,   993,     0,     0,     0,   994,   995,   996,   997,   998,
+     999,  1073,  1074,  1075,  1076,  1077,  1078,  1079,  1080,  1081,
+    1082,  1083,  1084,  1085,  1086,  1087,  1088,  1089,  1090,  1285,
+       0,   951,   952,   953,   954,   955,     0,     0,     0,     0,
+     960,   961,   962,     0,     0,     0,     0,     0,     0,     0,
+     963,   964,   965,   966,   967,   968,   969,   970,     0,   971,
+     972,   973,   974,   975,   976,   977,   978,   979,     0,   980,
+       0,   981,     0,     0,     0,     0,     0,   983,   984,   985,
+     986,   987,   988,   989,     0,     0,     0,     0,   992,   993,
+       0,     0,     0,   994,   995,   996,   997,   998,   999,  1073,
+    1074,  1075,  1076,  1077,  1078,  1079,  1080,  1081,  1082,  1083,
+    1084,  1085,  1086,  1087,  1088,  1089,  1090,  1687,     0,   951,
+     952,   953,   954,   955,     0,     0,     0,     0,   960,   961,
+     962,     0,     0,     0,     0,     0,     0,     0,   963,   964,
+     965,   966,   967,   968,   969,   970,     0,   971,   972,   973,
+     974,   975,   976,   977,   978,   979,     0,   980,     0,   981,
+       0,     0,     0,     0,     0,   983,   984,   985,   986,   987,
+     988,   989,     0,     0,     0,     0,   992,   993,     0,     0,
+       0,   994,   995,   996,   997,   998,   999,  1073,  1074,  1075,
+    1076,  1077,  1078,  1079,  1080,  1081,  1082,  1083,  1084,  1085,
+    1086,  1087,  1088,  1089,  1090,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1000,  1091,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  1092,     0,     0,     0,  1093,
+       0,  1094,  1095,  1096,  1097,     0,  1098,  1099,  1100,   535,
+    1001,     0,  1101,     0,  1002,  1003,     0,     0,     0,  1334,
+    1164,  1103,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  1000,  1091,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  1092,     0,     0,     0,  1093,     0,  1094,
+    1095,  1096,  1097,     0,  1098,  1099,  1100,   535,  1001,     0,
+    1101,     0,  1002,  1003,     0,     0,     0,  1335,  1164,  1103,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  1000,  1091,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  1092,     0,  1688,     0,  1093,     0,  1094,  1095,  1096,
+    1097,     0,  1098,  1099,  1100,   535,  1001,     0,  1101,     0,
+    1002,  1003,     0,     0,     0,     0,  1164,  1103,  1176,     0,
+     951,   952,   953,   954,   955,     0,     0,     0,     0,   960,
+     961,   962,     0,     0,     0,     0,     0,     0,     0,   963,
+     964,   965,   966,   967,   968,   969,   970,     0,   971,   972,
+     973,   974,   975,   976,   977,   978,   979,     0,   980,     0,
+     981,     0,     0,     0,     0,     0,   983,   984,   985,   986,
+     987,   988,   989,     0,     0,     0,     0,   992,   993,     0,
+       0,     0,   994,   995,   996,   997,   998,   999,  1073,  1074,
+    1075,  1076,  1077,  1078,  1079,  1080,  1081,  1082,  1083,  1084,
+    1085,  1086,  1087,  1088,  1089,  1090,  1276,     0,   951,   952,
+     953,   954,   955,     0,     0,     0,     0,   960,   961,   962,
+       0,     0,     0,     0,     0,     0,     0,   963,   964,   965,
+     966,   967,   968,   969,   970,     0,   971,   972,   973,   974,
+     975,   976,   977,   978,   979,     0,   980,     0,   981,     0,
+       0,     0,     0,     0,   983,   984,   985,   986,   987,   988,
+     989,     0,     0,     0,     0,   992,   993,     0,     0,     0,
+     994,   995,   996,   997,   998,   999,  1073,  1074,  1075,  1076,
+    1077,  1078,  1079,  1080,  1081,  1082,  1083,  1084,  1085,  1086,
+    1087,  1088,  1089,  1090,  1278,     0,   951,   952,   953,   954,
+     955,     0,     0,     0,     0,   960,   961,   962,     0,     0,
+       0,     0,     0,     0,     0,   963,   964,   965,   966,   967,
+     968,   969,   970,     0,   971,   972,   973,   974,   975,   976,
+     977,   978,   979,     0,   980,     0,   981,     0,     0,     0,
+       0,     0,   983,   984,   985,   986,   987,   988,   989,     0,
+       0,     0,     0,   992,   993,     0,     0,     0,   994,   995,
+     996,   997,   998,   999,  1073,  1074,  1075,  1076,  1077,  1078,
+    1079,  1080,  1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,
+    1089,  1090,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,  1000,  1091,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1092,     0,     0,     0,  1093,     0,  1094,  1095,
+    1096,  1097,     0,  1098,  1099,  1100,   535,  1001,     0,  1101,
+       0,  1002,  1003,     0,     0,     0,     0,  1164,  1103,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  1000,  1091,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1092,     0,     0,     0,  1093,     0,  1094,  1095,  1096,  1097,
+       0,  1098,  1099,  1100,   535,  1001,     0,  1101,     0,  1002,
+    1003,     0,     0,     0,     0,  1164,  1103,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  1000,  1091,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  1092,     0,
+       0,     0,  1093,     0,  1094,  1095,  1096,  1097,     0,  1098,
+    1099,  1100,   535,  1001,     0,  1101,     0,  1002,  1003,     0,
+       0,     0,     0,  1164,  1103,  1280,     0,   951,   952,   953,
+     954,   955,     0,     0,     0,     0,   960,   961,   962,     0,
+       0,     0,     0,     0,     0,     0,   963,   964,   965,   966,
+     967,   968,   969,   970,     0,   971,   972,   973,   974,   975,
+     976,   977,   978,   979,     0,   980,     0,   981,     0,     0,
+       0,     0,     0,   983,   984,   985,   986,   987,   988,   989,
+       0,     0,     0,     0,   992,   993,     0,     0,     0,   994,
+     995,   996,   997,   998,   999,  1073,  1074,  1075,  1076,  1077,
+    1078,  1079,  1080,  1081,  1082,  1083,  1084,  1085,  1086,  1087,
+    1088,  1089,  1090,  1307,     0,   951,   952,   953,   954,   955,
+       0,     0,     0,     0,   960,   961,   962,     0,     0,     0,
+       0,     0,     0,     0,   963,   964,   965,   966,   967,   968,
+     969,   970,     0,   971,   972,   973,   974,   975,   976,   977,
+     978,   979,     0,   980,     0,   981,     0,     0,     0,     0,
+       0,   983,   984,   985,   986,   987,   988,   989,     0,     0,
+       0,     0,   992,   993,     0,     0,     0,   994,   995,   996,
+     997,   998,   999,  1073,  1074,  1075,  1076,  1077,  1078,  1079,
+    1080,  1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,  1089,
+    1090,  1341,     0,   951,   952,   953,   954,   955,     0,     0,
+       0,     0,   960,   961,   962,     0,     0,     0,     0,     0,
+       0,     0,   963,   964,   965,   966,   967,   968,   969,   970,
+       0,   971,   972,   973,   974,   975,   976,   977,   978,   979,
+       0,   980,     0,   981,     0,     0,     0,     0,     0,   983,
+     984,   985,   986,   987,   988,   989,     0,     0,     0,     0,
+     992,   993,     0,     0,     0,   994,   995,   996,   997,   998,
+     999,  1073,  1074,  1075,  1076,  1077,  1078,  1079,  1080,  1081,
+    1082,  1083,  1084,  1085,  1086,  1087,  1088,  1089,  1090,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  1000,  1091,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  1092,
+       0,     0,     0,  1093,     0,  1094,  1095,  1096,  1097,     0,
+    1098,  1099,  1100,   535,  1001,     0,  1101,     0,  1002,  1003,
+       0,     0,     0,     0,  1164,  1103,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1000,  1091,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,  1092,     0,     0,
+       0,  1093,     0,  1094,  1095,  1096,  1097,     0,  1098,  1099,
+    1100,   535,  1001,     0,  1101,     0,  1002,  1003,     0,     0,
+       0,     0,  1164,  1103,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1000,  1091,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  1092,     0,     0,     0,  1093,
+       0,  1094,  1095,  1096,  1097,     0,  1098,  1099,  1100,   535,
+    1342,     0,  1101,     0,  1002,  1003,     0,     0,     0,     0,
+    1164,  1103,  1285,     0,   951,   952,   953,   954,   955,     0,
+       0,     0,     0,   960,   961,   962,     0,     0,     0,     0,
+       0,     0,     0,   963,   964,   965,   966,   967,   968,   969,
+     970,     0,   971,   972,   973,   974,   975,   976,   977,   978,
+     979,     0,   980,     0,   981,     0,     0,     0,     0,     0,
+     983,   984,   985,   986,   987,   988,   989,     0,     0,     0,
+       0,   992,   993,     0,     0,     0,   994,   995,   996,   997,
+     998,   999,  1073,  1074,  1075,  1076,  1077,  1078,  1079,  1080,
+    1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,  1089,  1090,
+    1480,     0,   951,   952,   953,   954,   955,     0,     0,     0,
+       0,   960,   961,   962,     0,     0,     0,     0,     0,     0,
+       0,   963,   964,   965,   966,   967,   968,   969,   970,     0,
+     971,   972,   973,   974,   975,   976,   977,   978,   979,     0,
+     980,     0,   981,     0,     0,     0,     0,     0,   983,   984,
+     985,   986,   987,   988,   989,     0,     0,     0,     0,   992,
+     993,     0,     0,     0,   994,   995,   996,   997,   998,   999,
+    1073,  1074,  1075,  1076,  1077,  1078,  1079,  1080,  1081,  1082,
+    1083,  1084,  1085,  1086,  1087,  1088,  1089,  1090,  1502,     0,
+     951,   952,   953,   954,   955,     0,     0,     0,     0,   960,
+     961,   962,     0,     0,     0,     0,     0,     0,     0,   963,
+     964,   965,   966,   967,   968,   969,   970,     0,   971,   972,
+     973,   974,   975,   976,   977,   978,   979,     0,   980,     0,
+     981,     0,     0,     0,     0,     0,   983,   984,   985,   986,
+     987,   988,   989,     0,     0,     0,     0,   992,   993,     0,
+       0,     0,   994,   995,   996,   997,   998,   999,  1073,  1074,
+    1075,  1076,  1077,  1078,  1079,  1080,  1081,  1082,  1083,  1084,
+    1085,  1086,  1087,  1088,  1089,  1090,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  1000,  1091,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  1092,     0,     0,     0,
+    1093,     0,  1094,  1095,  1096,  1097,     0,  1098,  1099,  1100,
+     535,  1001,     0,  1101,     0,  1002,  1003,     0,     0,     0,
+       0,  1164,  1103,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  1000,
+    1091,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  1092,     0,     0,     0,  1093,     0,
+    1094,  1095,  1096,  1097,     0,  1098,  1099,  1100,   535,  1481,
+       0,  1101,     0,  1002,  1003,     0,     0,     0,     0,  1164,
+    1103,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,  1000,  1091,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1092,     0,     0,     0,  1093,     0,  1094,  1095,
+    1096,  1097,     0,  1098,  1099,  1100,   535,  1001,     0,  1101,
+       0,  1002,  1003,     0,     0,     0,     0,  1164,  1103,  1504,
+       0,   951,   952,   953,   954,   955,     0,     0,     0,     0,
+     960,   961,   962,     0,     0,     0,     0,     0,     0,     0,
+     963,   964,   965,   966,   967,   968,   969,   970,     0,   971,
+     972,   973,   974,   975,   976,   977,   978,   979,     0,   980,
+       0,   981,     0,     0,     0,     0,     0,   983,   984,   985,
+     986,   987,   988,   989,     0,     0,     0,     0,   992,   993,
+       0,     0,     0,   994,   995,   996,   997,   998,   999,  1073,
+    1074,  1075,  1076,  1077,  1078,  1079,  1080,  1081,  1082,  1083,
+    1084,  1085,  1086,  1087,  1088,  1089,  1090,  1506,     0,   951,
+     952,   953,   954,   955,     0,     0,     0,     0,   960,   961,
+     962,     0,     0,     0,     0,     0,     0,     0,   963,   964,
+     965,   966,   967,   968,   969,   970,     0,   971,   972,   973,
+     974,   975,   976,   977,   978,   979,     0,   980,     0,   981,
+       0,     0,     0,     0,     0,   983,   984,   985,   986,   987,
+     988,   989,     0,     0,     0,     0,   992,   993,     0,     0,
+       0,   994,   995,   996,   997,   998,   999,  1073,  1074,  1075,
+    1076,  1077,  1078,  1079,  1080,  1081,  1082,  1083,  1084,  1085,
+    1086,  1087,  1088,  1089,  1090,  1513,     0,   951,   952,   953,
+     954,   955,     0,     0,     0,     0,   960,   961,   962,     0,
+       0,     0,     0,     0,     0,     0,   963,   964,   965,   966,
+     967,   968,   969,   970,     0,   971,   972,   973,   974,   975,
+     976,   977,   978,   979,     0,   980,     0,   981,     0,     0,
+       0,     0,     0,   983,   984,   985,   986,   987,   988,   989,
+       0,     0,     0,     0,   992,   993,     0,     0,     0,   994,
+     995,   996,   997,   998,   999,  1073,  1074,  1075,  1076,  1077,
+    1078,  1079,  1080,  1081,  1082,  1083,  1084,  1085,  1086,  1087,
+    1088,  1514,  1090,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  1000,  1091,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  1092,     0,     0,     0,  1093,     0,  1094,
+    1095,  1096,  1097,     0,  1098,  1099,  1100,   535,  1001,     0,
+    1101,     0,  1002,  1003,     0,     0,     0,     0,  1164,  1103,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  1000,  1091,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  1092,     0,     0,     0,  1093,     0,  1094,  1095,  1096,
+    1097,     0,  1098,  1099,  1100,   535,  1001,     0,  1101,     0,
+    1002,  1003,     0,     0,     0,     0,  1164,  1103,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  1000,  1091,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  1092,
+       0,     0,     0,  1093,     0,  1094,  1095,  1096,  1097,     0,
+    1098,  1099,  1100,   535,  1001,     0,  1101,     0,  1002,  1003,
+       0,     0,     0,     0,  1164,  1103,  1516,     0,   951,   952,
+     953,   954,   955,     0,     0,     0,     0,   960,   961,   962,
+       0,     0,     0,     0,     0,     0,     0,   963,   964,   965,
+     966,   967,   968,   969,   970,     0,   971,   972,   973,   974,
+     975,   976,   977,   978,   979,     0,   980,     0,   981,     0,
+       0,     0,     0,     0,   983,   984,   985,   986,   987,   988,
+     989,     0,     0,     0,     0,   992,   993,     0,     0,     0,
+     994,   995,   996,   997,   998,   999,  1073,  1074,  1075,  1076,
+    1077,  1078,  1079,  1080,  1081,  1082,  1083,  1084,  1085,  1086,
+    1087,  1088,  1089,  1090,  1518,     0,   951,   952,   953,   954,
+     955,     0,     0,     0,     0,   960,   961,   962,     0,     0,
+       0,     0,     0,     0,     0,   963,   964,   965,   966,   967,
+     968,   969,   970,     0,   971,   972,   973,   974,   975,   976,
+     977,   978,   979,     0,   980,     0,   981,     0,     0,     0,
+       0,     0,   983,   984,   985,   986,   987,   988,   989,     0,
+       0,     0,     0,   992,   993,     0,     0,     0,   994,   995,
+     996,   997,   998,   999,  1073,  1074,  1075,  1076,  1077,  1078,
+    1079,  1080,  1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,
+    1089,  1090,  1529,     0,   951,   952,   953,   954,   955,     0,
+       0,     0,     0,   960,   961,   962,     0,     0,     0,     0,
+       0,     0,     0,   963,   964,   965,   966,   967,   968,   969,
+     970,     0,   971,   972,   973,   974,   975,   976,   977,   978,
+     979,     0,   980,     0,   981,     0,     0,     0,     0,     0,
+     983,   984,   985,   986,   987,   988,   989,     0,     0,     0,
+       0,   992,   993,     0,     0,     0,   994,   995,   996,   997,
+     998,   999,  1073,  1074,  1075,  1076,  1077,  1078,  1079,  1080,
+    1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,  1089,  1090,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  1000,  1091,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1092,     0,     0,     0,  1093,     0,  1094,  1095,  1096,  1097,
+       0,  1098,  1099,  1100,   535,  1001,     0,  1101,     0,  1002,
+    1003,     0,     0,     0,     0,  1164,  1103,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  1000,  1091,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  1092,     0,
+       0,     0,  1093,     0,  1094,  1095,  1096,  1097,     0,  1098,
+    1099,  1100,   535,  1001,     0,  1101,     0,  1002,  1003,     0,
+       0,     0,     0,  1164,  1103,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  1000,  1091,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  1092,     0,     0,     0,
+    1093,     0,  1094,  1095,  1096,  1097,     0,  1098,  1099,  1100,
+     535,  1001,     0,  1101,     0,  1002,  1003,     0,     0,     0,
+       0,  1164,  1103,  1531,     0,   951,   952,   953,   954,   955,
+       0,     0,     0,     0,   960,   961,   962,     0,     0,     0,
+       0,     0,     0,     0,   963,   964,   965,   966,   967,   968,
+     969,   970,     0,   971,   972,   973,   974,   975,   976,   977,
+     978,   979,     0,   980,     0,   981,     0,     0,     0,     0,
+       0,   983,   984,   985,   986,   987,   988,   989,     0,     0,
+       0,     0,   992,   993,     0,     0,     0,   994,   995,   996,
+     997,   998,   999,  1073,  1074,  1075,  1076,  1077,  1078,  1079,
+    1080,  1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,  1089,
+    1090,  1533,     0,   951,   952,   953,   954,   955,     0,     0,
+       0,     0,   960,   961,   962,     0,     0,     0,     0,     0,
+       0,     0,   963,   964,   965,   966,   967,   968,   969,   970,
+       0,   971,   972,   973,   974,   975,   976,   977,   978,   979,
+       0,   980,     0,   981,     0,     0,     0,     0,     0,   983,
+     984,   985,   986,   987,   988,   989,     0,     0,     0,     0,
+     992,   993,     0,     0,     0,   994,   995,   996,   997,   998,
+     999,  1073,  1074,  1075,  1076,  1077,  1078,  1079,  1080,  1081,
+    1082,  1083,  1084,  1085,  1086,  1087,  1088,  1089,  1090,  1535,
+       0,   951,   952,   953,   954,   955,     0,     0,     0,     0,
+     960,   961,   962,     0,     0,     0,     0,     0,     0,     0,
+     963,   964,   965,   966,   967,   968,   969,   970,     0,   971,
+     972,   973,   974,   975,   976,   977,   978,   979,     0,   980,
+       0,   981,     0,     0,     0,     0,     0,   983,   984,   985,
+     986,   987,   988,   989,     0,     0,     0,     0,   992,   993,
+       0,     0,     0,   994,   995,   996,   997,   998,   999,  1073,
+    1074,  1075,  1076,  1077,  1078,  1079,  1080,  1081,  1082,  1083,
+    1084,  1085,  1086,  1087,  1088,  1089,  1090,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1000,  1091,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,  1092,     0,     0,
+       0,  1093,     0,  1094,  1095,  1096,  1097,     0,  1098,  1099,
+    1100,   535,  1001,     0,  1101,     0,  1002,  1003,     0,     0,
+       0,     0,  1164,  1103,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1000,  1091,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  1092,     0,     0,     0,  1093,
+       0,  1094,  1095,  1096,  1097,     0,  1098,  1099,  1100,   535,
+    1001,     0,  1101,     0,  1002,  1003,     0,     0,     0,     0,
+    1164,  1103,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  1000,  1091,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  1092,     0,     0,     0,  1093,     0,  1094,
+    1095,  1096,  1097,     0,  1098,  1099,  1100,   535,  1001,     0,
+    1101,     0,  1002,  1003,     0,     0,     0,     0,  1164,  1103,
+    1540,     0,   951,   952,   953,   954,   955,     0,     0,     0,
+       0,   960,   961,   962,     0,     0,     0,     0,     0,     0,
+       0,   963,   964,   965,   966,   967,   968,   969,   970,     0,
+     971,   972,   973,   974,   975,   976,   977,   978,   979,     0,
+     980,     0,   981,     0,     0,     0,     0,     0,   983,   984,
+     985,   986,   987,   988,   989,     0,     0,     0,     0,   992,
+     993,     0,     0,     0,   994,   995,   996,   997,   998,   999,
+    1073,  1074,  1075,  1076,  1077,  1078,  1079,  1080,  1081,  1082,
+    1083,  1084,  1085,  1086,  1087,  1088,  1089,  1090,  1542,     0,
+     951,   952,   953,   954,   955,     0,     0,     0,     0,   960,
+     961,   962,     0,     0,     0,     0,     0,     0,     0,   963,
+     964,   965,   966,   967,   968,   969,   970,     0,   971,   972,
+     973,   974,   975,   976,   977,   978,   979,     0,   980,     0,
+     981,     0,     0,     0,     0,     0,   983,   984,   985,   986,
+     987,   988,   989,     0,     0,     0,     0,   992,   993,     0,
+       0,     0,   994,   995,   996,   997,   998,   999,  1073,  1074,
+    1075,  1076,  1077,  1078,  1079,  1080,  1081,  1082,  1083,  1084,
+    1085,  1086,  1087,  1088,  1089,  1090,  1544,     0,   951,   952,
+     953,   954,   955,     0,     0,     0,     0,   960,   961,   962,
+       0,     0,     0,     0,     0,     0,     0,   963,   964,   965,
+     966,   967,   968,   969,   970,     0,   971,   972,   973,   974,
+     975,   976,   977,   978,   979,     0,   980,     0,   981,     0,
+       0,     0,     0,     0,   983,   984,   985,   986,   987,   988,
+     989,     0,     0,     0,     0,   992,   993,     0,     0,     0,
+     994,   995,   996,   997,   998,   999,  1073,  1074,  1075,  1076,
+    1077,  1078,  1079,  1080,  1081,  1082,  1083,  1084,  1085,  1086,
+    1087,  1088,  1089,  1090,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  1000,
+    1091,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  1092,     0,     0,     0,  1093,     0,
+    1094,  1095,  1096,  1097,     0,  1098,  1099,  1100,   535,  1001,
+       0,  1101,     0,  1002,  1003,     0,     0,     0,     0,  1164,
+    1103,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,  1000,  1091,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1092,     0,     0,     0,  1093,     0,  1094,  1095,
+    1096,  1097,     0,  1098,  1099,  1100,   535,  1001,     0,  1101,
+       0,  1002,  1003,     0,     0,     0,     0,  1164,  1103,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  1000,  1091,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1092,     0,     0,     0,  1093,     0,  1094,  1095,  1096,  1097,
+       0,  1098,  1099,  1100,   535,  1001,     0,  1101,     0,  1002,
+    1003,     0,     0,     0,     0,  1164,  1103,  1546,     0,   951,
+     952,   953,   954,   955,     0,     0,     0,     0,   960,   961,
+     962,     0,     0,     0,     0,     0,     0,     0,   963,   964,
+     965,   966,   967,   968,   969,   970,     0,   971,   972,   973,
+     974,   975,   976,   977,   978,   979,     0,   980,     0,   981,
+       0,     0,     0,     0,     0,   983,   984,   985,   986,   987,
+     988,   989,     0,     0,     0,     0,   992,   993,     0,     0,
+       0,   994,   995,   996,   997,   998,   999,  1073,  1074,  1075,
+    1076,  1077,  1078,  1079,  1080,  1081,  1082,  1083,  1084,  1085,
+    1086,  1087,  1088,  1089,  1090,  1548,     0,   951,   952,   953,
+     954,   955,     0,     0,     0,     0,   960,   961,   962,     0,
+       0,     0,     0,     0,     0,     0,   963,   964,   965,   966,
+     967,   968,   969,   970,     0,   971,   972,   973,   974,   975,
+     976,   977,   978,   979,     0,   980,     0,   981,     0,     0,
+       0,     0,     0,   983,   984,   985,   986,   987,   988,   989,
+       0,     0,     0,     0,   992,   993,     0,     0,     0,   994,
+     995,   996,   997,   998,   999,  1073,  1074,  1075,  1076,  1077,
+    1078,  1079,  1080,  1081,  1082,  1083,  1084,  1085,  1086,  1087,
+    1088,  1089,  1090,  1550,     0,   951,   952,   953,   954,   955,
+       0,     0,     0,     0,   960,   961,   962,     0,     0,     0,
+       0,     0,     0,     0,   963,   964,   965,   966,   967,   968,
+     969,   970,     0,   971,   972,   973,   974,   975,   976,   977,
+     978,   979,     0,   980,     0,   981,     0,     0,     0,     0,
+       0,   983,   984,   985,   986,   987,   988,   989,     0,     0,
+       0,     0,   992,   993,     0,     0,     0,   994,   995,   996,
+     997,   998,   999,  1073,  1074,  1075,  1076,  1077,  1078,  1079,
+    1080,  1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,  1089,
+    1090,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  1000,  1091,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  1092,     0,     0,     0,  1093,     0,  1094,  1095,  1096,
+    1097,     0,  1098,  1099,  1100,   535,  1001,     0,  1101,     0,
+    1002,  1003,     0,     0,     0,     0,  1164,  1103,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  1000,  1091,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  1092,
+       0,     0,     0,  1093,     0,  1094,  1095,  1096,  1097,     0,
+    1098,  1099,  1100,   535,  1001,     0,  1101,     0,  1002,  1003,
+       0,     0,     0,     0,  1164,  1103,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1000,  1091,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,  1092,     0,     0,
+       0,  1093,     0,  1094,  1095,  1096,  1097,     0,  1098,  1099,
+    1100,   535,  1001,     0,  1101,     0,  1002,  1003,     0,     0,
+       0,     0,  1164,  1103,  1552,     0,   951,   952,   953,   954,
+     955,     0,     0,     0,     0,   960,   961,   962,     0,     0,
+       0,     0,     0,     0,     0,   963,   964,   965,   966,   967,
+     968,   969,   970,     0,   971,   972,   973,   974,   975,   976,
+     977,   978,   979,     0,   980,     0,   981,     0,     0,     0,
+       0,     0,   983,   984,   985,   986,   987,   988,   989,     0,
+       0,     0,     0,   992,   993,     0,     0,     0,   994,   995,
+     996,   997,   998,   999,  1073,  1074,  1075,  1076,  1077,  1078,
+    1079,  1080,  1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,
+    1089,  1090,  1746,     0,   951,   952,   953,   954,   955,     0,
+       0,     0,     0,   960,   961,   962,     0,     0,     0,     0,
+       0,     0,     0,   963,   964,   965,   966,   967,   968,   969,
+     970,     0,   971,   972,   973,   974,   975,   976,   977,   978,
+     979,     0,   980,     0,   981,     0,     0,     0,     0,     0,
+     983,   984,   985,   986,   987,   988,   989,     0,     0,     0,
+       0,   992,   993,     0,     0,     0,   994,   995,   996,   997,
+     998,   999,  1073,  1074,  1075,  1076,  1077,  1078,  1079,  1080,
+    1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,  1089,  1090,
+     951,   952,   953,   954,   955,     0,     0,     0,     0,   960,
+     961,   962,     0,     0,     0,     0,     0,     0,     0,   963,
+     964,   965,   966,   967,   968,   969,   970,     0,   971,   972,
+     973,   974,   975,   976,   977,   978,   979,     0,   980,     0,
+     981,     0,     0,     0,     0,     0,   983,   984,   985,   986,
+     987,   988,   989,     0,     0,     0,     0,   992,   993,     0,
+       0,     0,   994,   995,   996,   997,   998,   999,  1073,  1074,
+    1075,  1076,  1077,  1078,  1079,  1080,  1081,  1082,  1083,  1084,
+    1085,  1086,  1087,  1088,  1089,  1090,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  1000,  1091,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  1092,     0,
+       0,     0,  1093,     0,  1094,  1095,  1096,  1097,     0,  1098,
+    1099,  1100,   535,  1001,     0,  1101,     0,  1002,  1003,     0,
+       0,     0,     0,  1164,  1103,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  1000,  1091,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  1092,     0,     0,     0,
+    1093,     0,  1094,  1095,  1096,  1097,     0,  1098,  1099,  1100,
+     535,  1001,     0,  1101,     0,  1002,  1003,     0,     0,     0,
+       0,  1164,  1103,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,  1000,  1091,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1092,     0,     0,     0,  1093,     0,  1094,  1095,
+    1096,  1097,     0,  1098,  1099,  1100,   535,  1001,     0,  1101,
+       0,  1002,  1003,     0,     0,     0,     0,  1102,  1103,   951,
+     952,   953,   954,   955,     0,     0,     0,     0,   960,   961,
+     962,     0,     0,     0,     0,     0,     0,     0,   963,   964,
+     965,   966,   967,   968,   969,   970,     0,   971,   972,   973,
+     974,   975,   976,   977,   978,   979,     0,   980,     0,   981,
+       0,     0,     0,     0,     0,   983,   984,   985,   986,   987,
+     988,   989,     0,     0,     0,     0,   992,   993,     0,     0,
+       0,   994,   995,   996,   997,   998,   999,  1073,  1074,  1075,
+    1076,  1077,  1078,  1079,  1080,  1081,  1082,  1083,  1084,  1085,
+    1086,  1087,  1088,  1089,  1090,   951,   952,   953,   954,   955,
+       0,     0,     0,     0,   960,   961,   962,     0,     0,     0,
+       0,     0,     0,     0,   963,   964,   965,   966,   967,   968,
+     969,   970,     0,   971,   972,   973,   974,   975,   976,   977,
+     978,   979,     0,   980,     0,   981,     0,     0,     0,     0,
+       0,   983,   984,   985,   986,   987,   988,   989,     0,     0,
+       0,     0,   992,   993,     0,     0,     0,   994,   995,   996,
+     997,   998,   999,  1073,  1074,  1075,  1076,  1077,  1078,  1079,
+    1080,  1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,  1089,
+    1090,   951,   952,   953,   954,   955,     0,     0,     0,     0,
+     960,   961,   962,     0,     0,     0,     0,     0,     0,     0,
+     963,   964,   965,   966,   967,   968,   969,   970,     0,   971,
+     972,   973,   974,   975,   976,   977,   978,   979,     0,   980,
+       0,   981,     0,     0,     0,     0,     0,   983,   984,   985,
+     986,   987,   988,   989,     0,     0,     0,     0,   992,   993,
+       0,     0,     0,   994,   995,   996,   997,   998,   999,  1073,
+    1074,  1075,  1076,  1077,  1078,  1079,  1080,  1081,  1082,  1083,
+    1084,  1085,  1086,  1087,  1088,  1089,  1090,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  1000,  1091,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  1092,     0,     0,     0,  1093,     0,  1094,  1095,  1096,
+    1097,     0,  1098,  1099,  1100,   535,  1001,     0,  1101,     0,
+    1002,  1003,     0,     0,     0,     0,  1123,  1103,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1000,  1091,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,  1092,     0,     0,
+       0,  1093,     0,  1094,  1095,  1096,  1097,     0,  1098,  1099,
+    1100,   535,  1001,     0,  1101,     0,  1002,  1003,     0,     0,
+       0,     0,  1125,  1103,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  1000,  1091,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  1092,     0,     0,     0,  1093,     0,  1094,
+    1095,  1096,  1097,     0,  1098,  1099,  1100,   535,  1001,     0,
+    1101,     0,  1002,  1003,     0,     0,     0,     0,  1164,  1103,
+     951,   952,   953,   954,   955,   956,   957,   958,   959,   960,
+     961,   962,     0,     0,     0,     0,     0,     0,     0,   963,
+     964,   965,   966,   967,   968,   969,   970,     0,   971,   972,
+     973,   974,   975,   976,   977,   978,   979,     0,   980,     0,
+     981,     0,     0,     0,   982,     0,   983,   984,   985,   986,
+     987,   988,   989,   990,     0,     0,   991,   992,   993,     0,
+       0,     0,   994,   995,   996,   997,   998,   999,   951,   952,
+     953,   954,   955,     0,     0,     0,     0,   960,   961,   962,
+       0,     0,     0,     0,     0,     0,     0,   963,   964,   965,
+     966,   967,   968,   969,   970,     0,   971,   972,   973,   974,
+     975,   976,   977,   978,   979,     0,   980,     0,   981,     0,
+       0,     0,     0,     0,   983,   984,   985,   986,   987,   988,
+     989,     0,     0,     0,     0,   992,   993,     0,     0,     0,
+     994,   995,   996,   997,   998,   999,  1073,  1074,  1075,  1076,
+    1077,  1078,  1079,  1080,  1081,  1082,  1083,  1084,  1085,  1086,
+    1087,  1088,  1089,  1090,   951,   952,   953,   954,   955,   956,
+     957,   958,   959,   960,   961,   962,     0,     0,     0,     0,
+       0,     0,     0,   963,   964,   965,   966,   967,   968,   969,
+     970,     0,   971,   972,   973,   974,   975,   976,   977,   978,
+     979,     0,   980,     0,   981,     0,     0,     0,   982,     0,
+     983,   984,   985,   986,   987,   988,   989,   990,     0,     0,
+     991,   992,   993,     0,     0,     0,   994,   995,   996,   997,
+     998,   999,  1293,     0,   951,   952,   953,   954,   955,   956,
+     957,   958,   959,   960,   961,   962,     0,     0,     0,     0,
+       0,     0,     0,   963,   964,   965,   966,   967,   968,   969,
+     970,     0,   971,   972,   973,   974,   975,   976,   977,   978,
+     979,     0,   980,     0,   981,     0,     0,     0,   982,     0,
+     983,   984,   985,   986,   987,   988,   989,   990,     0,     0,
+     991,   992,   993,     0,     0,     0,   994,   995,   996,   997,
+     998,   999,     0,     0,     0,     0,     0,  1000,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  1309,  1310,  1311,  1312,  1313,  1314,  1315,
+    1316,  1317,  1318,  1319,  1320,  1321,  1322,  1323,  1324,  1325,
+    1326,  1327,  1328,  1329,  1330,  1331,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,  1001,     0,     0,
+       0,  1002,  1003,     0,     0,  1004,     0,     0,  1378,     0,
+       0,     0,     0,     0,     0,  1000,  1091,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1092,     0,     0,     0,  1093,     0,  1094,  1095,  1096,  1097,
+       0,  1098,  1099,  1100,  1694,  1001,     0,  1101,     0,  1002,
+    1003,     0,     0,     0,     0,  1164,  1103,     0,     0,     0,
+       0,     0,     0,   951,   952,   953,   954,   955,   956,   957,
+     958,   959,   960,   961,   962,     0,     0,     0,     0,     0,
+       0,  1000,   963,   964,   965,   966,   967,   968,   969,   970,
+       0,   971,   972,   973,   974,   975,   976,   977,   978,   979,
+       0,   980,     0,   981,     0,     0,     0,   982,     0,   983,
+     984,   985,   986,   987,   988,   989,   990,     0,     0,   991,
+     992,   993,     0,     0,     0,   994,   995,   996,   997,   998,
+     999,  1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,
+       0,     0,  1378,     0,     0,     0,     0,     0,     0,     0,
+       0,  1000,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  1001,     0,     0,     0,  1002,  1003,     0,     0,  1004,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1000,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1001,     0,     0,     0,  1002,  1003,     0,     0,  1004
+};
+
+static const yytype_int16 yycheck[] =
+{
+     235,   203,   431,   238,   234,   909,  1178,     1,   912,     1,
+     253,   915,     1,  1230,   918,     1,     1,  1113,   912,     1,
+       1,   915,   926,     1,   918,  1006,    63,     1,   315,   264,
+      58,   266,   926,   268,  1085,   270,  1087,  1064,  1089,  1066,
+       1,  1068,  1023,  1070,  1025,  1072,  1027,   336,   909,     1,
+    1031,   912,     1,     1,   915,     1,  1107,   918,  1105,     1,
+     349,     1,  1109,   111,     1,   926,   315,     1,    57,    58,
+     315,     1,  1066,     1,  1068,   335,  1070,   345,  1072,   349,
+       1,     1,   352,   315,     1,     1,     1,     1,     1,   349,
+       1,     1,     1,     1,   315,   363,   331,    89,    90,    91,
+      92,    62,  1006,     1,     1,     1,     1,   342,   343,   344,
+     345,   346,   347,   348,   349,   350,    62,     1,     1,  1023,
+     315,  1025,     1,  1027,     1,   315,   335,  1031,   315,     1,
+       1,     1,   335,   315,     1,     1,   345,    89,    90,    91,
+      92,     1,   345,   315,     1,  1006,   575,     1,   383,   384,
+     385,     1,   315,     1,   909,     1,   350,   912,   352,     1,
+     915,     1,  1023,   918,  1025,   335,  1027,     1,   938,   939,
+    1031,   926,     1,    63,    89,    90,    91,    92,     1,   349,
+     315,     1,     1,     1,  1165,     1,     1,     1,     1,     1,
+       1,    62,     1,   357,   364,   359,   335,  1178,  1102,  1103,
+     315,     1,     1,   349,   350,   315,   352,     1,    62,  1103,
+     349,     1,   315,   352,    62,   354,     1,     1,     1,  1123,
+     315,  1125,   335,     1,     1,   315,     1,     1,    14,    15,
+       1,   466,   110,   111,   469,   470,   349,     1,   315,   352,
+       1,  1102,  1103,     1,   315,   315,     1,     1,     1,     1,
+     315,  1006,     1,     1,     1,   357,     1,   359,   345,     1,
+    1164,  1165,  1123,     1,  1125,   315,     1,     1,  1023,     1,
+    1025,     1,  1027,     1,  1178,     1,  1031,     1,  1305,     1,
+       1,     1,     1,     1,     1,     1,     1,    16,     1,     1,
+       1,     1,   349,   350,   315,   352,     1,     1,     1,   315,
+       1,     1,     1,  1164,  1165,     1,     1,     1,     1,  1213,
+     315,  1305,   349,  1294,     1,  1411,     1,  1178,   366,   315,
+       1,   349,   350,  1227,     1,   234,   235,   236,   237,     0,
+      19,  1235,     1,  1227,    20,   315,     1,   580,   315,   315,
+       1,  1235,     1,   315,   336,     1,     1,  1102,  1103,     1,
+     315,     1,  1213,     1,    21,   349,     1,   349,   350,   351,
+     352,   353,     1,   349,     1,   359,  1227,   353,  1123,   909,
+    1125,   363,   912,   362,  1235,   915,   361,   363,   918,  1596,
+     361,   363,   363,   361,   336,   363,   926,   361,   349,   350,
+    1294,   352,   353,     1,   315,     1,     1,   349,   350,   351,
+     352,   353,   363,   349,   350,   353,   352,   353,   360,  1164,
+    1165,   363,   361,   359,   363,   363,   315,   363,  1590,   361,
+     360,   336,   909,  1178,   361,   912,   363,   361,   915,   363,
+     360,   918,   360,  1294,   349,   350,   351,   352,   353,   926,
+     360,  1422,   359,   360,   360,   360,   360,   360,   363,   360,
+     360,  1432,   360,   349,   350,   351,   352,   353,     1,   349,
+       1,   358,   360,  1514,     1,   360,  1006,   363,     1,   315,
+    1521,   350,  1227,   352,  1378,   352,   360,   360,   349,   350,
+    1235,   352,   353,  1023,  1378,  1025,   315,  1027,   360,     1,
+     360,  1031,   363,   360,   360,   349,   350,   361,   352,   353,
+     360,   349,   350,   360,   352,   353,   352,   936,   350,   363,
+     360,  1415,  1416,  1417,  1418,   363,   315,  1378,  1422,  1006,
+     360,  1415,  1416,  1417,  1418,   300,   360,  1744,  1432,   349,
+     350,   351,   352,   353,   350,     1,  1023,   360,  1025,  1294,
+    1027,   360,   360,   363,  1031,   360,   360,   360,   360,   360,
+     335,   360,   352,   352,  1415,  1416,  1417,  1418,   352,   349,
+     350,  1422,  1102,  1103,   349,     1,   350,   350,   352,   352,
+       1,  1432,   350,   350,   359,   352,   350,   352,   352,   350,
+     355,   352,     1,  1123,   909,  1125,   350,   912,   352,   350,
+     915,   352,   350,   918,   352,   349,   349,   352,   352,   352,
+     352,   926,   350,   352,   352,   352,  1035,   352,  1589,  1590,
+     352,     1,     1,     1,   352,     1,  1103,   352,   352,     1,
+     352,   349,   352,  1378,  1164,  1165,   352,     1,   352,     1,
+     352,   352,   352,   352,   352,   352,   352,   352,  1178,   352,
+     352,   352,   352,  1624,  1625,  1626,  1627,   352,   352,   352,
+    1677,   352,   352,   352,     1,   315,   352,   352,   352,   352,
+    1415,  1416,  1417,  1418,   349,   352,   335,  1422,   349,   350,
+     351,   336,   349,   350,   351,   336,   335,  1432,  1165,   335,
+     349,  1006,     1,   335,   349,  1589,  1590,  1227,   349,   315,
+     349,  1178,     1,   349,   349,  1235,   335,   349,  1023,   349,
+    1025,   349,  1027,   905,   349,     1,  1031,     1,     1,     1,
+     349,     1,   349,     1,     1,     1,     1,     1,     1,     1,
+    1624,  1625,  1626,  1627,     1,     1,  1213,   335,  1589,  1590,
+     335,     1,     1,     1,     1,     1,   315,     1,  1167,   315,
+    1227,   349,  1171,   349,   349,   315,     1,     1,  1235,    63,
+       1,     1,     1,     1,  1294,     1,     1,     1,     1,    63,
+       1,     1,     1,  1624,  1625,  1626,  1627,     1,  1749,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,  1103,  1760,
+       1,     1,     1,  1764,     1,  1766,  1767,  1691,     1,    63,
+     349,   350,   335,   352,   335,   315,     1,  1691,   335,     1,
+       1,     1,   335,   349,     1,     1,   349,  1294,   349,     1,
+       1,     1,   349,     1,     1,     1,   349,     1,     1,     1,
+       1,     1,     1,   335,     1,     1,     1,     1,     1,     1,
+    1691,     1,     1,     1,  1589,  1590,     1,   349,  1378,     1,
+    1165,  1745,     1,     1,  1748,  1749,     1,     1,     1,     1,
+       1,  1745,     1,  1178,  1748,     1,  1760,  1761,  1762,     1,
+    1764,   315,  1766,  1767,     1,     1,     1,  1761,  1762,  1624,
+    1625,  1626,  1627,   315,     1,  1415,  1416,  1417,  1418,     1,
+       1,   315,  1422,   349,  1745,     1,   315,  1748,  1749,   315,
+       1,  1378,  1432,   336,   337,   338,   315,     1,   335,  1760,
+    1761,  1762,  1227,  1764,   335,  1766,  1767,     1,   345,     1,
+    1235,   315,   315,   349,  1149,   315,   315,     1,   349,     1,
+     357,   315,   359,   315,   349,   350,     1,   352,  1415,  1416,
+    1417,  1418,     1,  1163,   335,  1422,  1691,     1,     1,    57,
+      58,  1171,   357,     1,   359,  1432,   335,   335,   349,   335,
+     315,   352,     1,   335,     1,     1,     1,     1,     1,   349,
+     349,   349,     1,   349,     1,   323,   324,   349,   315,  1294,
+     328,   329,   315,     1,     1,   349,   315,   349,    89,    90,
+      91,    92,  1184,     1,  1186,   315,  1188,   315,   315,     1,
+    1745,   315,   315,  1748,  1749,     1,   349,   315,  1233,  1234,
+       1,     1,   956,   957,   958,  1760,  1761,  1762,     1,  1764,
+       1,  1766,  1767,     1,   315,   315,   335,     1,     1,   315,
+      89,    90,    91,    92,     1,     1,     1,     1,   982,     1,
+     349,     1,   349,   349,   907,   349,   990,   991,   911,   349,
+     349,   914,   315,   315,   917,   349,   357,   349,   359,  1589,
+    1590,   315,   357,  1378,   359,   349,   349,   349,   357,   349,
+     359,   349,   349,   349,   349,   349,   349,   349,   357,   315,
+     359,   349,   349,   349,   349,   349,   357,   315,   359,   349,
+     349,   349,   349,   349,  1624,  1625,  1626,  1627,   349,   349,
+    1415,  1416,  1417,  1418,   349,   349,   349,  1422,   349,   349,
+     349,   349,  1589,  1590,   349,   349,   349,  1432,   349,   349,
+     349,   315,   349,   349,   349,   349,   315,   349,   349,   349,
+     349,   349,   349,   349,   349,   349,   315,   349,   349,   349,
+     349,   349,   349,   315,   315,   349,   349,  1624,  1625,  1626,
+    1627,  1095,  1096,  1097,   349,   352,   352,   349,   349,   349,
+     366,  1691,   349,   349,   357,   315,   359,   349,   349,   349,
+     353,   349,   349,   349,   349,   349,   349,  1121,  1597,   349,
+     349,   315,   349,   349,   349,   349,   349,   349,  1132,   349,
+     349,   349,   315,   315,   349,   315,   315,   349,   315,   315,
+     349,   349,   315,   315,   349,   349,   349,   349,   349,   315,
+     349,   315,   315,   349,  1691,  1745,   315,   349,  1748,  1749,
+     315,   315,   349,   349,   349,   334,   335,   336,   337,   338,
+    1760,  1761,  1762,   315,  1764,   336,  1766,  1767,   349,   323,
+     324,   315,   315,   357,   328,   329,   330,   331,   332,   333,
+     352,   323,   324,   325,   362,   315,   328,   329,   323,   324,
+     325,   315,   315,   328,   329,   315,  1210,   315,  1745,   315,
+     349,  1748,  1749,   315,  1589,  1590,   315,   336,   315,   315,
+     315,   315,   315,  1760,  1761,  1762,   349,  1764,   315,  1766,
+    1767,   357,   315,   359,   323,   324,   325,   315,   315,   328,
+     329,   315,   349,  1528,   349,   350,   351,   352,   353,  1624,
+    1625,  1626,  1627,   315,   315,   323,   324,   315,   363,   315,
+     328,   329,   315,   335,   315,   315,  1270,  1271,  1272,     1,
+     315,   315,   315,   345,   315,   315,   315,   315,  1282,  1283,
+    1284,   315,   315,   315,   357,   357,   359,   359,   315,   315,
+     315,   315,  1296,   315,   357,   315,   359,   315,  1302,  1303,
+     357,  1305,   359,   315,   363,  1309,  1310,  1311,  1312,  1313,
+    1314,  1315,   281,   282,   283,   284,  1691,   286,     0,     1,
+     357,   315,   359,  1327,  1328,  1329,  1330,  1331,  1332,  1333,
+     315,   315,    14,    15,    16,    17,    18,    19,    20,    21,
+      72,    73,    74,    75,  1102,    77,   357,    79,   359,    81,
+     357,   357,   359,   359,   315,   315,    38,   315,    40,   335,
+      42,    43,    44,    45,    46,  1123,   315,  1125,  1620,   345,
+    1745,  1623,   335,  1748,  1749,   315,    58,    89,    90,    91,
+      92,   357,   345,   359,  1669,  1760,  1761,  1762,   335,  1764,
+     315,  1766,  1767,   315,   357,   315,   359,   315,   345,   315,
+     315,  1405,   315,   315,   315,   315,  1164,   315,   315,   315,
+     357,   315,   359,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   315,   315,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   315,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   223,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   315,   315,   315,   315,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
+     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,   269,   270,   271,
+     272,   273,   274,   275,   276,   277,  1600,   279,   280,   315,
+     315,   315,  1606,   285,   315,   287,   288,   289,   290,   291,
+     292,   293,   294,   295,   296,   297,   298,   299,   315,   315,
+     315,   315,   315,   315,   336,   315,   315,   315,   315,   315,
+     312,   313,   314,   357,   315,   315,   315,   349,   350,   351,
+     352,   353,   349,   350,   351,   352,   353,   315,   360,   315,
+     315,   363,   315,   360,   315,   315,   363,   302,   303,   304,
+     305,   306,   307,   308,   309,   310,   315,   366,   350,   278,
+     361,   349,  1676,   349,   349,   349,   358,   349,   349,   349,
+     349,   364,   349,   365,  1688,   349,   363,   349,   361,   345,
+     349,     1,  1696,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,   350,   349,   349,   349,   349,
+     349,   349,    22,    23,    24,    25,    26,    27,    28,    29,
+     366,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+     361,    41,   361,    43,   349,   349,   357,    47,   357,    49,
+      50,    51,    52,    53,    54,    55,    56,   315,   315,    59,
+      60,    61,   315,   315,  1758,    65,    66,    67,    68,    69,
+      70,     1,   315,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,   349,   356,   315,   364,   349,
+     357,   359,    22,    23,    24,    25,    26,    27,    28,    29,
+     315,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+     364,    41,   352,    43,   352,   352,   364,    47,   360,    49,
+      50,    51,    52,    53,    54,    55,    56,   360,   360,    59,
+      60,    61,   345,   360,   360,    65,    66,    67,    68,    69,
+      70,     1,   360,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,   360,   360,   360,   360,   360,
+     358,   358,    22,    23,    24,    25,    26,    27,    28,    29,
+     364,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+     364,    41,   364,    43,   364,   361,   345,    47,   366,    49,
+      50,    51,    52,    53,    54,    55,    56,   357,   361,    59,
+      60,    61,   357,   360,   360,    65,    66,    67,    68,    69,
+      70,     1,   360,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,   352,   359,   359,   359,   359,
+     359,   359,    22,    23,    24,    25,    26,    27,    28,    29,
+     359,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+     359,    41,   359,    43,   360,   345,   361,    47,   361,    49,
+      50,    51,    52,    53,    54,    55,    56,   361,   361,    59,
+      60,    61,   278,   349,   352,    65,    66,    67,    68,    69,
+      70,   320,   321,   322,   323,   324,   325,   326,   327,   328,
+     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     300,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     359,   349,   359,   359,   359,   359,   316,   317,   318,   319,
+     320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,   350,
+     359,   315,   315,   315,   315,   345,   359,   362,   357,   363,
+     350,   359,   359,   357,   354,   355,   359,   357,   358,   359,
+     360,   361,   359,   359,   359,   359,   366,   359,   359,   359,
+     300,   359,   359,   359,   359,   359,   359,   359,   359,   359,
+     359,   359,   359,   359,   359,    48,   316,   317,   318,   319,
+     320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,   359,
+     359,   359,   359,   359,   359,   359,   359,   359,   359,   359,
+     350,   359,   359,   359,   354,   355,   357,   357,   358,   359,
+     360,   361,   366,   366,   359,   359,   366,   359,   359,   359,
+     300,   359,   359,   359,   350,   364,   357,   352,   352,   315,
+     345,   111,   359,   349,   363,   349,   316,   317,   318,   319,
+     320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,   359,
+     359,   359,   359,   359,   349,   349,   349,   349,   349,   359,
+     350,   349,   349,   349,   354,   355,   349,   357,   358,   359,
+     349,   361,   349,   349,   349,   345,   366,   359,   337,   352,
+     300,   352,   362,   349,   352,   366,   364,   359,   211,  1035,
+     359,   934,   359,   390,   359,   359,   316,   317,   318,   319,
+     320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,   359,
+     359,   359,   359,   359,   359,   359,   359,   359,   359,   359,
+     350,   359,   359,   359,   354,   355,     1,   357,   358,   359,
+     359,   361,   359,   359,   359,   359,   366,   359,   359,    14,
+      15,    16,    17,    18,    19,    20,    21,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,   332,   333,   334,   335,
+     336,   337,   338,    38,   359,    40,   366,    42,    43,    44,
+      45,    46,   366,   366,   359,   359,   359,   359,   364,   366,
+    1272,   903,   905,    58,   364,   366,  1225,   391,  1274,  1274,
+     316,   317,   318,   319,   320,   321,   322,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,   332,   333,   334,   335,
+     336,   337,   338,   576,  1604,    -1,  1406,  1688,  1696,  1670,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   361,    -1,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+      -1,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
+     175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
+     195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
+     225,   226,   227,   228,   229,   230,   231,   232,   233,    -1,
+      -1,    -1,    -1,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
+     255,   256,   257,   258,   259,   260,   261,   262,   263,   264,
+     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
+     275,   276,   277,    -1,   279,   280,    -1,    -1,    -1,    -1,
+     285,    -1,   287,   288,   289,   290,   291,   292,   293,   294,
+     295,   296,   297,   298,   299,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   312,   313,   314,
+      -1,    -1,    -1,    -1,    -1,   316,   317,   318,   319,   320,
+     321,   322,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,   332,   333,   334,   335,   336,   337,   338,    -1,    -1,
+      -1,    -1,    -1,    -1,     1,   350,     3,     4,     5,     6,
+       7,    -1,    -1,   358,    -1,    12,    13,    14,   359,    -1,
+     365,    -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,
+      27,    28,    29,    -1,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    -1,    41,    -1,    43,    -1,    -1,    -1,
+      -1,    -1,    49,    50,    51,    52,    53,    54,    55,    -1,
+      -1,    -1,    -1,    60,    61,    -1,    -1,    -1,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,     1,    -1,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    -1,    -1,    -1,    65,    66,    67,    68,
+      69,    70,     1,    -1,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    -1,    -1,    -1,    65,    66,    67,    68,
+      69,    70,     1,    -1,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    -1,    -1,    -1,    65,    66,    67,    68,
+      69,    70,    -1,   300,   301,   316,   317,   318,   319,   320,
+     321,   322,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,   332,   333,   334,   335,   336,   337,   338,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   335,    -1,
+      -1,    -1,   339,    -1,   341,   342,   343,   344,   359,   346,
+     347,   348,   349,   350,    -1,   352,   353,   354,   355,    -1,
+      -1,    -1,    -1,   360,   361,    -1,   363,    -1,    -1,    -1,
+      -1,     1,    -1,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,
+      -1,   300,    22,    23,    24,    25,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,    49,
+      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    -1,    -1,    -1,    65,    66,    67,    68,    69,
+      70,   350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,
+      -1,    -1,    -1,   362,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   300,   316,   317,   318,   319,   320,   321,   322,   323,
+     324,   325,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   319,   320,   321,   322,   323,
+     324,   325,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   359,    -1,    -1,    -1,    -1,
+      -1,   350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,
+      -1,    -1,    -1,   362,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   300,   316,   317,   318,   319,   320,   321,   322,   323,
+     324,   325,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   321,   322,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,   332,   333,   334,   335,
+     336,   337,   338,    -1,    -1,   359,    -1,    -1,    -1,    -1,
+      -1,   350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,
+      -1,    -1,     1,   362,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    -1,    -1,    -1,    65,    66,    67,    68,
+      69,    70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     300,   316,   317,   318,   319,   320,   321,   322,   323,   324,
+     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   322,   323,   324,   325,   326,   327,
+     328,   329,   330,   331,   332,   333,   334,   335,   336,   337,
+     338,    -1,    -1,    -1,   359,    -1,    -1,    -1,    -1,    -1,
+     350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,    -1,
+      -1,     1,   362,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    22,    23,    24,    25,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,    49,
+      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    -1,    -1,    -1,    65,    66,    67,    68,    69,
+      70,     1,    -1,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    22,    23,    24,    25,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,    49,
+      50,    51,    52,    53,    54,    55,    56,    -1,    -1,    59,
+      60,    61,    -1,    -1,    -1,    65,    66,    67,    68,    69,
+      70,     1,    -1,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,
+      -1,   300,    22,    23,    24,    25,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,    49,
+      50,    51,    52,    53,    54,    55,    56,    -1,    -1,    59,
+      60,    61,    -1,    -1,    -1,    65,    66,    67,    68,    69,
+      70,   350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,
+      -1,    -1,     1,   362,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,
+      49,    50,    51,    52,    53,    54,    55,    56,    -1,    -1,
+      59,    60,    61,    -1,    -1,    -1,    65,    66,    67,    68,
+      69,    70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     300,   316,   317,   318,   319,   320,   321,   322,   323,   324,
+     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   359,    -1,    -1,    -1,    -1,    -1,
+     350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,    -1,
+      -1,    -1,   362,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     300,   316,   317,   318,   319,   320,   321,   322,   323,   324,
+     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   357,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,    -1,
+      -1,    -1,   362,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     300,   316,   317,   318,   319,   320,   321,   322,   323,   324,
+     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   357,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,    -1,
+      -1,     1,   362,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,
+      -1,   300,    22,    23,    24,    25,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,    49,
+      50,    51,    52,    53,    54,    55,    56,    -1,    -1,    59,
+      60,    61,    -1,    -1,    -1,    65,    66,    67,    68,    69,
+      70,   350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,
+      -1,    -1,     1,   362,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,
+      49,    50,    51,    52,    53,    54,    55,    56,    -1,    -1,
+      59,    60,    61,    -1,    -1,    -1,    65,    66,    67,    68,
+      69,    70,     1,    -1,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,
+      49,    50,    51,    52,    53,    54,    55,    56,    -1,    -1,
+      59,    60,    61,    -1,    -1,    -1,    65,    66,    67,    68,
+      69,    70,     1,    -1,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,
+      49,    50,    51,    52,    53,    54,    55,    56,    -1,    -1,
+      59,    60,    61,    -1,    -1,    -1,    65,    66,    67,    68,
+      69,    70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     300,   316,   317,   318,   319,   320,   321,   322,   323,   324,
+     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   317,   318,   319,   320,   321,   322,
+     323,   324,   325,   326,   327,   328,   329,   330,   331,   332,
+     333,   334,   335,   336,   337,   338,    -1,    -1,    -1,    -1,
+     350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,    -1,
+      -1,     1,   362,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,
+      -1,   300,    22,    23,    24,    25,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,    49,
+      50,    51,    52,    53,    54,    55,    56,    -1,    -1,    59,
+      60,    61,    -1,    -1,    -1,    65,    66,    67,    68,    69,
+      70,   350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,
+      -1,    -1,    -1,   362,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   300,   318,   319,   320,   321,   322,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,   332,   333,   334,   335,
+     336,   337,   338,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,
+      -1,    -1,    -1,   362,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   300,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,
+      -1,    -1,     1,   362,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,
+      49,    50,    51,    52,    53,    54,    55,    56,    -1,    -1,
+      59,    60,    61,    -1,    -1,    -1,    65,    66,    67,    68,
+      69,    70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     300,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,    -1,
+      -1,     1,   362,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    22,    23,    24,    25,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,    49,
+      50,    51,    52,    53,    54,    55,    56,    -1,    -1,    59,
+      60,    61,    -1,    -1,    -1,    65,    66,    67,    68,    69,
+      70,     1,    -1,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    22,    23,    24,    25,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,    49,
+      50,    51,    52,    53,    54,    55,    56,    -1,    -1,    59,
+      60,    61,    -1,    -1,    -1,    65,    66,    67,    68,    69,
+      70,     1,    -1,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,
+      -1,   300,    22,    23,    24,    25,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,    49,
+      50,    51,    52,    53,    54,    55,    56,    -1,    -1,    59,
+      60,    61,    -1,    -1,    -1,    65,    66,    67,    68,    69,
+      70,   350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,
+      -1,    -1,     1,   362,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,
+      49,    50,    51,    52,    53,    54,    55,    56,    -1,    -1,
+      59,    60,    61,    -1,    -1,    -1,    65,    66,    67,    68,
+      69,    70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     300,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,    -1,
+      -1,    -1,   362,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     300,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,    -1,
+      -1,    -1,   362,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     300,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,    -1,
+      -1,    -1,   362,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   300,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,
+      -1,    -1,     1,   362,     3,     4,     5,     6,     7,    -1,
+      -1,    -1,    -1,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    -1,    41,    -1,    43,    -1,    -1,    -1,    -1,    -1,
+      49,    50,    51,    52,    53,    54,    55,    -1,    -1,    -1,
+      -1,    60,    61,    -1,    -1,    -1,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,     1,    -1,     3,     4,
+       5,     6,     7,    -1,    -1,    -1,    -1,    12,    13,    14,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,
+      25,    26,    27,    28,    29,    -1,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    -1,    41,    -1,    43,    -1,
+      -1,    -1,    -1,    -1,    49,    50,    51,    52,    53,    54,
+      55,    -1,    -1,    -1,    -1,    60,    61,    -1,    -1,    -1,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+       1,    -1,     3,     4,     5,     6,     7,    -1,    -1,    -1,
+      -1,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    22,    23,    24,    25,    26,    27,    28,    29,    -1,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    -1,
+      41,    -1,    43,    -1,    -1,    -1,    -1,    -1,    49,    50,
+      51,    52,    53,    54,    55,    -1,    -1,    -1,    -1,    60,
+      61,    -1,    -1,    -1,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    86,    87,    88,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   300,   301,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   335,   336,    -1,    -1,
+     339,    -1,   341,   342,   343,   344,    -1,   346,   347,   348,
+     349,   350,    -1,   352,    -1,   354,   355,    -1,    -1,    -1,
+      -1,   360,   361,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   300,   301,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     335,   336,    -1,    -1,   339,    -1,   341,   342,   343,   344,
+      -1,   346,   347,   348,   349,   350,    -1,   352,    -1,   354,
+     355,    -1,    -1,    -1,    -1,   360,   361,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   300,
+     301,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   335,    -1,    -1,    -1,   339,    -1,
+     341,   342,   343,   344,    -1,   346,   347,   348,   349,   350,
+      -1,   352,    -1,   354,   355,    -1,    -1,    -1,   359,   360,
+     361,     1,    -1,     3,     4,     5,     6,     7,    -1,    -1,
+      -1,    -1,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    22,    23,    24,    25,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      -1,    41,    -1,    43,    -1,    -1,    -1,    -1,    -1,    49,
+      50,    51,    52,    53,    54,    55,    -1,    -1,    -1,    -1,
+      60,    61,    -1,    -1,    -1,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,    88,     1,
+      -1,     3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,
+      12,    13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      22,    23,    24,    25,    26,    27,    28,    29,    -1,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    -1,    41,
+      -1,    43,    -1,    -1,    -1,    -1,    -1,    49,    50,    51,
+      52,    53,    54,    55,    -1,    -1,    -1,    -1,    60,    61,
+      -1,    -1,    -1,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,     1,    -1,     3,
+       4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,    13,
+      14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,
+      24,    25,    26,    27,    28,    29,    -1,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    -1,    41,    -1,    43,
+      -1,    -1,    -1,    -1,    -1,    49,    50,    51,    52,    53,
+      54,    55,    -1,    -1,    -1,    -1,    60,    61,    -1,    -1,
+      -1,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     300,   301,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   335,    -1,    -1,    -1,   339,
+      -1,   341,   342,   343,   344,    -1,   346,   347,   348,   349,
+     350,    -1,   352,    -1,   354,   355,    -1,    -1,    -1,   359,
+     360,   361,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   300,   301,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   335,    -1,    -1,    -1,   339,    -1,   341,
+     342,   343,   344,    -1,   346,   347,   348,   349,   350,    -1,
+     352,    -1,   354,   355,    -1,    -1,    -1,   359,   360,   361,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   300,   301,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   335,    -1,   337,    -1,   339,    -1,   341,   342,   343,
+     344,    -1,   346,   347,   348,   349,   350,    -1,   352,    -1,
+     354,   355,    -1,    -1,    -1,    -1,   360,   361,     1,    -1,
+       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
+      13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,
+      23,    24,    25,    26,    27,    28,    29,    -1,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    -1,    41,    -1,
+      43,    -1,    -1,    -1,    -1,    -1,    49,    50,    51,    52,
+      53,    54,    55,    -1,    -1,    -1,    -1,    60,    61,    -1,
+      -1,    -1,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,     1,    -1,     3,     4,
+       5,     6,     7,    -1,    -1,    -1,    -1,    12,    13,    14,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,
+      25,    26,    27,    28,    29,    -1,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    -1,    41,    -1,    43,    -1,
+      -1,    -1,    -1,    -1,    49,    50,    51,    52,    53,    54,
+      55,    -1,    -1,    -1,    -1,    60,    61,    -1,    -1,    -1,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,     1,    -1,     3,     4,     5,     6,
+       7,    -1,    -1,    -1,    -1,    12,    13,    14,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,
+      27,    28,    29,    -1,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    -1,    41,    -1,    43,    -1,    -1,    -1,
+      -1,    -1,    49,    50,    51,    52,    53,    54,    55,    -1,
+      -1,    -1,    -1,    60,    61,    -1,    -1,    -1,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   300,   301,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   335,    -1,    -1,    -1,   339,    -1,   341,   342,
+     343,   344,    -1,   346,   347,   348,   349,   350,    -1,   352,
+      -1,   354,   355,    -1,    -1,    -1,    -1,   360,   361,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   300,   301,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     335,    -1,    -1,    -1,   339,    -1,   341,   342,   343,   344,
+      -1,   346,   347,   348,   349,   350,    -1,   352,    -1,   354,
+     355,    -1,    -1,    -1,    -1,   360,   361,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   300,   301,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   335,    -1,
+      -1,    -1,   339,    -1,   341,   342,   343,   344,    -1,   346,
+     347,   348,   349,   350,    -1,   352,    -1,   354,   355,    -1,
+      -1,    -1,    -1,   360,   361,     1,    -1,     3,     4,     5,
+       6,     7,    -1,    -1,    -1,    -1,    12,    13,    14,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,
+      26,    27,    28,    29,    -1,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    -1,    41,    -1,    43,    -1,    -1,
+      -1,    -1,    -1,    49,    50,    51,    52,    53,    54,    55,
+      -1,    -1,    -1,    -1,    60,    61,    -1,    -1,    -1,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    88,     1,    -1,     3,     4,     5,     6,     7,
+      -1,    -1,    -1,    -1,    12,    13,    14,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    -1,    41,    -1,    43,    -1,    -1,    -1,    -1,
+      -1,    49,    50,    51,    52,    53,    54,    55,    -1,    -1,
+      -1,    -1,    60,    61,    -1,    -1,    -1,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,     1,    -1,     3,     4,     5,     6,     7,    -1,    -1,
+      -1,    -1,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    22,    23,    24,    25,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      -1,    41,    -1,    43,    -1,    -1,    -1,    -1,    -1,    49,
+      50,    51,    52,    53,    54,    55,    -1,    -1,    -1,    -1,
+      60,    61,    -1,    -1,    -1,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,    88,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   300,   301,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   335,
+      -1,    -1,    -1,   339,    -1,   341,   342,   343,   344,    -1,
+     346,   347,   348,   349,   350,    -1,   352,    -1,   354,   355,
+      -1,    -1,    -1,    -1,   360,   361,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   300,   301,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   335,    -1,    -1,
+      -1,   339,    -1,   341,   342,   343,   344,    -1,   346,   347,
+     348,   349,   350,    -1,   352,    -1,   354,   355,    -1,    -1,
+      -1,    -1,   360,   361,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     300,   301,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   335,    -1,    -1,    -1,   339,
+      -1,   341,   342,   343,   344,    -1,   346,   347,   348,   349,
+     350,    -1,   352,    -1,   354,   355,    -1,    -1,    -1,    -1,
+     360,   361,     1,    -1,     3,     4,     5,     6,     7,    -1,
+      -1,    -1,    -1,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    -1,    41,    -1,    43,    -1,    -1,    -1,    -1,    -1,
+      49,    50,    51,    52,    53,    54,    55,    -1,    -1,    -1,
+      -1,    60,    61,    -1,    -1,    -1,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+       1,    -1,     3,     4,     5,     6,     7,    -1,    -1,    -1,
+      -1,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    22,    23,    24,    25,    26,    27,    28,    29,    -1,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    -1,
+      41,    -1,    43,    -1,    -1,    -1,    -1,    -1,    49,    50,
+      51,    52,    53,    54,    55,    -1,    -1,    -1,    -1,    60,
+      61,    -1,    -1,    -1,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    86,    87,    88,     1,    -1,
+       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
+      13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,
+      23,    24,    25,    26,    27,    28,    29,    -1,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    -1,    41,    -1,
+      43,    -1,    -1,    -1,    -1,    -1,    49,    50,    51,    52,
+      53,    54,    55,    -1,    -1,    -1,    -1,    60,    61,    -1,
+      -1,    -1,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   300,   301,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   335,    -1,    -1,    -1,
+     339,    -1,   341,   342,   343,   344,    -1,   346,   347,   348,
+     349,   350,    -1,   352,    -1,   354,   355,    -1,    -1,    -1,
+      -1,   360,   361,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   300,
+     301,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   335,    -1,    -1,    -1,   339,    -1,
+     341,   342,   343,   344,    -1,   346,   347,   348,   349,   350,
+      -1,   352,    -1,   354,   355,    -1,    -1,    -1,    -1,   360,
+     361,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   300,   301,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   335,    -1,    -1,    -1,   339,    -1,   341,   342,
+     343,   344,    -1,   346,   347,   348,   349,   350,    -1,   352,
+      -1,   354,   355,    -1,    -1,    -1,    -1,   360,   361,     1,
+      -1,     3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,
+      12,    13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      22,    23,    24,    25,    26,    27,    28,    29,    -1,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    -1,    41,
+      -1,    43,    -1,    -1,    -1,    -1,    -1,    49,    50,    51,
+      52,    53,    54,    55,    -1,    -1,    -1,    -1,    60,    61,
+      -1,    -1,    -1,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,     1,    -1,     3,
+       4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,    13,
+      14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,
+      24,    25,    26,    27,    28,    29,    -1,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    -1,    41,    -1,    43,
+      -1,    -1,    -1,    -1,    -1,    49,    50,    51,    52,    53,
+      54,    55,    -1,    -1,    -1,    -1,    60,    61,    -1,    -1,
+      -1,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,     1,    -1,     3,     4,     5,
+       6,     7,    -1,    -1,    -1,    -1,    12,    13,    14,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,
+      26,    27,    28,    29,    -1,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    -1,    41,    -1,    43,    -1,    -1,
+      -1,    -1,    -1,    49,    50,    51,    52,    53,    54,    55,
+      -1,    -1,    -1,    -1,    60,    61,    -1,    -1,    -1,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    88,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   300,   301,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   335,    -1,    -1,    -1,   339,    -1,   341,
+     342,   343,   344,    -1,   346,   347,   348,   349,   350,    -1,
+     352,    -1,   354,   355,    -1,    -1,    -1,    -1,   360,   361,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   300,   301,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   335,    -1,    -1,    -1,   339,    -1,   341,   342,   343,
+     344,    -1,   346,   347,   348,   349,   350,    -1,   352,    -1,
+     354,   355,    -1,    -1,    -1,    -1,   360,   361,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   300,   301,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   335,
+      -1,    -1,    -1,   339,    -1,   341,   342,   343,   344,    -1,
+     346,   347,   348,   349,   350,    -1,   352,    -1,   354,   355,
+      -1,    -1,    -1,    -1,   360,   361,     1,    -1,     3,     4,
+       5,     6,     7,    -1,    -1,    -1,    -1,    12,    13,    14,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,
+      25,    26,    27,    28,    29,    -1,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    -1,    41,    -1,    43,    -1,
+      -1,    -1,    -1,    -1,    49,    50,    51,    52,    53,    54,
+      55,    -1,    -1,    -1,    -1,    60,    61,    -1,    -1,    -1,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,     1,    -1,     3,     4,     5,     6,
+       7,    -1,    -1,    -1,    -1,    12,    13,    14,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,
+      27,    28,    29,    -1,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    -1,    41,    -1,    43,    -1,    -1,    -1,
+      -1,    -1,    49,    50,    51,    52,    53,    54,    55,    -1,
+      -1,    -1,    -1,    60,    61,    -1,    -1,    -1,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,     1,    -1,     3,     4,     5,     6,     7,    -1,
+      -1,    -1,    -1,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    -1,    41,    -1,    43,    -1,    -1,    -1,    -1,    -1,
+      49,    50,    51,    52,    53,    54,    55,    -1,    -1,    -1,
+      -1,    60,    61,    -1,    -1,    -1,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   300,   301,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     335,    -1,    -1,    -1,   339,    -1,   341,   342,   343,   344,
+      -1,   346,   347,   348,   349,   350,    -1,   352,    -1,   354,
+     355,    -1,    -1,    -1,    -1,   360,   361,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   300,   301,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   335,    -1,
+      -1,    -1,   339,    -1,   341,   342,   343,   344,    -1,   346,
+     347,   348,   349,   350,    -1,   352,    -1,   354,   355,    -1,
+      -1,    -1,    -1,   360,   361,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   300,   301,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   335,    -1,    -1,    -1,
+     339,    -1,   341,   342,   343,   344,    -1,   346,   347,   348,
+     349,   350,    -1,   352,    -1,   354,   355,    -1,    -1,    -1,
+      -1,   360,   361,     1,    -1,     3,     4,     5,     6,     7,
+      -1,    -1,    -1,    -1,    12,    13,    14,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    -1,    41,    -1,    43,    -1,    -1,    -1,    -1,
+      -1,    49,    50,    51,    52,    53,    54,    55,    -1,    -1,
+      -1,    -1,    60,    61,    -1,    -1,    -1,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,     1,    -1,     3,     4,     5,     6,     7,    -1,    -1,
+      -1,    -1,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    22,    23,    24,    25,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      -1,    41,    -1,    43,    -1,    -1,    -1,    -1,    -1,    49,
+      50,    51,    52,    53,    54,    55,    -1,    -1,    -1,    -1,
+      60,    61,    -1,    -1,    -1,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,    88,     1,
+      -1,     3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,
+      12,    13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      22,    23,    24,    25,    26,    27,    28,    29,    -1,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    -1,    41,
+      -1,    43,    -1,    -1,    -1,    -1,    -1,    49,    50,    51,
+      52,    53,    54,    55,    -1,    -1,    -1,    -1,    60,    61,
+      -1,    -1,    -1,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   300,   301,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   335,    -1,    -1,
+      -1,   339,    -1,   341,   342,   343,   344,    -1,   346,   347,
+     348,   349,   350,    -1,   352,    -1,   354,   355,    -1,    -1,
+      -1,    -1,   360,   361,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     300,   301,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   335,    -1,    -1,    -1,   339,
+      -1,   341,   342,   343,   344,    -1,   346,   347,   348,   349,
+     350,    -1,   352,    -1,   354,   355,    -1,    -1,    -1,    -1,
+     360,   361,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   300,   301,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   335,    -1,    -1,    -1,   339,    -1,   341,
+     342,   343,   344,    -1,   346,   347,   348,   349,   350,    -1,
+     352,    -1,   354,   355,    -1,    -1,    -1,    -1,   360,   361,
+       1,    -1,     3,     4,     5,     6,     7,    -1,    -1,    -1,
+      -1,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    22,    23,    24,    25,    26,    27,    28,    29,    -1,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    -1,
+      41,    -1,    43,    -1,    -1,    -1,    -1,    -1,    49,    50,
+      51,    52,    53,    54,    55,    -1,    -1,    -1,    -1,    60,
+      61,    -1,    -1,    -1,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    86,    87,    88,     1,    -1,
+       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
+      13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,
+      23,    24,    25,    26,    27,    28,    29,    -1,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    -1,    41,    -1,
+      43,    -1,    -1,    -1,    -1,    -1,    49,    50,    51,    52,
+      53,    54,    55,    -1,    -1,    -1,    -1,    60,    61,    -1,
+      -1,    -1,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,     1,    -1,     3,     4,
+       5,     6,     7,    -1,    -1,    -1,    -1,    12,    13,    14,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,
+      25,    26,    27,    28,    29,    -1,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    -1,    41,    -1,    43,    -1,
+      -1,    -1,    -1,    -1,    49,    50,    51,    52,    53,    54,
+      55,    -1,    -1,    -1,    -1,    60,    61,    -1,    -1,    -1,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   300,
+     301,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   335,    -1,    -1,    -1,   339,    -1,
+     341,   342,   343,   344,    -1,   346,   347,   348,   349,   350,
+      -1,   352,    -1,   354,   355,    -1,    -1,    -1,    -1,   360,
+     361,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   300,   301,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   335,    -1,    -1,    -1,   339,    -1,   341,   342,
+     343,   344,    -1,   346,   347,   348,   349,   350,    -1,   352,
+      -1,   354,   355,    -1,    -1,    -1,    -1,   360,   361,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   300,   301,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     335,    -1,    -1,    -1,   339,    -1,   341,   342,   343,   344,
+      -1,   346,   347,   348,   349,   350,    -1,   352,    -1,   354,
+     355,    -1,    -1,    -1,    -1,   360,   361,     1,    -1,     3,
+       4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,    13,
+      14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,
+      24,    25,    26,    27,    28,    29,    -1,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    -1,    41,    -1,    43,
+      -1,    -1,    -1,    -1,    -1,    49,    50,    51,    52,    53,
+      54,    55,    -1,    -1,    -1,    -1,    60,    61,    -1,    -1,
+      -1,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,     1,    -1,     3,     4,     5,
+       6,     7,    -1,    -1,    -1,    -1,    12,    13,    14,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,
+      26,    27,    28,    29,    -1,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    -1,    41,    -1,    43,    -1,    -1,
+      -1,    -1,    -1,    49,    50,    51,    52,    53,    54,    55,
+      -1,    -1,    -1,    -1,    60,    61,    -1,    -1,    -1,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
+      86,    87,    88,     1,    -1,     3,     4,     5,     6,     7,
+      -1,    -1,    -1,    -1,    12,    13,    14,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    -1,    41,    -1,    43,    -1,    -1,    -1,    -1,
+      -1,    49,    50,    51,    52,    53,    54,    55,    -1,    -1,
+      -1,    -1,    60,    61,    -1,    -1,    -1,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   300,   301,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   335,    -1,    -1,    -1,   339,    -1,   341,   342,   343,
+     344,    -1,   346,   347,   348,   349,   350,    -1,   352,    -1,
+     354,   355,    -1,    -1,    -1,    -1,   360,   361,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   300,   301,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   335,
+      -1,    -1,    -1,   339,    -1,   341,   342,   343,   344,    -1,
+     346,   347,   348,   349,   350,    -1,   352,    -1,   354,   355,
+      -1,    -1,    -1,    -1,   360,   361,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   300,   301,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   335,    -1,    -1,
+      -1,   339,    -1,   341,   342,   343,   344,    -1,   346,   347,
+     348,   349,   350,    -1,   352,    -1,   354,   355,    -1,    -1,
+      -1,    -1,   360,   361,     1,    -1,     3,     4,     5,     6,
+       7,    -1,    -1,    -1,    -1,    12,    13,    14,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,
+      27,    28,    29,    -1,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    -1,    41,    -1,    43,    -1,    -1,    -1,
+      -1,    -1,    49,    50,    51,    52,    53,    54,    55,    -1,
+      -1,    -1,    -1,    60,    61,    -1,    -1,    -1,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,     1,    -1,     3,     4,     5,     6,     7,    -1,
+      -1,    -1,    -1,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    -1,    41,    -1,    43,    -1,    -1,    -1,    -1,    -1,
+      49,    50,    51,    52,    53,    54,    55,    -1,    -1,    -1,
+      -1,    60,    61,    -1,    -1,    -1,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+       3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,
+      13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,
+      23,    24,    25,    26,    27,    28,    29,    -1,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    -1,    41,    -1,
+      43,    -1,    -1,    -1,    -1,    -1,    49,    50,    51,    52,
+      53,    54,    55,    -1,    -1,    -1,    -1,    60,    61,    -1,
+      -1,    -1,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   300,   301,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   335,    -1,
+      -1,    -1,   339,    -1,   341,   342,   343,   344,    -1,   346,
+     347,   348,   349,   350,    -1,   352,    -1,   354,   355,    -1,
+      -1,    -1,    -1,   360,   361,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   300,   301,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   335,    -1,    -1,    -1,
+     339,    -1,   341,   342,   343,   344,    -1,   346,   347,   348,
+     349,   350,    -1,   352,    -1,   354,   355,    -1,    -1,    -1,
+      -1,   360,   361,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   300,   301,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   335,    -1,    -1,    -1,   339,    -1,   341,   342,
+     343,   344,    -1,   346,   347,   348,   349,   350,    -1,   352,
+      -1,   354,   355,    -1,    -1,    -1,    -1,   360,   361,     3,
+       4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,    13,
+      14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,
+      24,    25,    26,    27,    28,    29,    -1,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    -1,    41,    -1,    43,
+      -1,    -1,    -1,    -1,    -1,    49,    50,    51,    52,    53,
+      54,    55,    -1,    -1,    -1,    -1,    60,    61,    -1,    -1,
+      -1,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,     3,     4,     5,     6,     7,
+      -1,    -1,    -1,    -1,    12,    13,    14,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    22,    23,    24,    25,    26,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    -1,    41,    -1,    43,    -1,    -1,    -1,    -1,
+      -1,    49,    50,    51,    52,    53,    54,    55,    -1,    -1,
+      -1,    -1,    60,    61,    -1,    -1,    -1,    65,    66,    67,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,     3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,
+      12,    13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      22,    23,    24,    25,    26,    27,    28,    29,    -1,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    -1,    41,
+      -1,    43,    -1,    -1,    -1,    -1,    -1,    49,    50,    51,
+      52,    53,    54,    55,    -1,    -1,    -1,    -1,    60,    61,
+      -1,    -1,    -1,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   300,   301,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   335,    -1,    -1,    -1,   339,    -1,   341,   342,   343,
+     344,    -1,   346,   347,   348,   349,   350,    -1,   352,    -1,
+     354,   355,    -1,    -1,    -1,    -1,   360,   361,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   300,   301,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   335,    -1,    -1,
+      -1,   339,    -1,   341,   342,   343,   344,    -1,   346,   347,
+     348,   349,   350,    -1,   352,    -1,   354,   355,    -1,    -1,
+      -1,    -1,   360,   361,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   300,   301,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   335,    -1,    -1,    -1,   339,    -1,   341,
+     342,   343,   344,    -1,   346,   347,   348,   349,   350,    -1,
+     352,    -1,   354,   355,    -1,    -1,    -1,    -1,   360,   361,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,
+      23,    24,    25,    26,    27,    28,    29,    -1,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    -1,    41,    -1,
+      43,    -1,    -1,    -1,    47,    -1,    49,    50,    51,    52,
+      53,    54,    55,    56,    -1,    -1,    59,    60,    61,    -1,
+      -1,    -1,    65,    66,    67,    68,    69,    70,     3,     4,
+       5,     6,     7,    -1,    -1,    -1,    -1,    12,    13,    14,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    22,    23,    24,
+      25,    26,    27,    28,    29,    -1,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    -1,    41,    -1,    43,    -1,
+      -1,    -1,    -1,    -1,    49,    50,    51,    52,    53,    54,
+      55,    -1,    -1,    -1,    -1,    60,    61,    -1,    -1,    -1,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,
+      49,    50,    51,    52,    53,    54,    55,    56,    -1,    -1,
+      59,    60,    61,    -1,    -1,    -1,    65,    66,    67,    68,
+      69,    70,     1,    -1,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    22,    23,    24,    25,    26,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,
+      49,    50,    51,    52,    53,    54,    55,    56,    -1,    -1,
+      59,    60,    61,    -1,    -1,    -1,    65,    66,    67,    68,
+      69,    70,    -1,    -1,    -1,    -1,    -1,   300,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   316,   317,   318,   319,   320,   321,   322,
+     323,   324,   325,   326,   327,   328,   329,   330,   331,   332,
+     333,   334,   335,   336,   337,   338,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   350,    -1,    -1,
+      -1,   354,   355,    -1,    -1,   358,    -1,    -1,   361,    -1,
+      -1,    -1,    -1,    -1,    -1,   300,   301,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     335,    -1,    -1,    -1,   339,    -1,   341,   342,   343,   344,
+      -1,   346,   347,   348,   349,   350,    -1,   352,    -1,   354,
+     355,    -1,    -1,    -1,    -1,   360,   361,    -1,    -1,    -1,
+      -1,    -1,    -1,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    -1,    -1,    -1,    -1,    -1,
+      -1,   300,    22,    23,    24,    25,    26,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      -1,    41,    -1,    43,    -1,    -1,    -1,    47,    -1,    49,
+      50,    51,    52,    53,    54,    55,    56,    -1,    -1,    59,
+      60,    61,    -1,    -1,    -1,    65,    66,    67,    68,    69,
+      70,   350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,
+      -1,    -1,   361,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   300,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     300,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     350,    -1,    -1,    -1,   354,   355,    -1,    -1,   358
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,     1,    17,    18,    38,    40,    42,    43,    44,    45,
+      46,    58,    95,    96,    97,    98,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,   168,   169,   170,   171,   172,   173,   174,   175,
+     176,   177,   178,   179,   180,   181,   182,   183,   184,   185,
+     186,   187,   188,   189,   190,   191,   192,   193,   194,   195,
+     196,   197,   198,   199,   200,   201,   202,   203,   204,   205,
+     206,   207,   208,   209,   210,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,   223,   224,   225,
+     226,   227,   228,   229,   230,   231,   232,   233,   238,   239,
+     240,   241,   242,   243,   244,   245,   246,   247,   248,   249,
+     250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,   267,   268,   269,
+     270,   271,   272,   273,   274,   275,   276,   277,   279,   280,
+     285,   287,   288,   289,   290,   291,   292,   293,   294,   295,
+     296,   297,   298,   299,   312,   313,   314,   350,   358,   365,
+     368,   369,   370,   371,   372,   373,   374,   375,   386,   390,
+     393,   394,   396,   397,   407,   408,   417,   315,     1,   363,
+       1,   315,   315,   315,   315,   315,   315,   315,   315,   315,
+     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
+     315,   315,   315,   315,   315,   315,   315,     1,   315,     1,
+     315,     1,   315,     1,   315,     1,   315,     1,   315,     1,
+     315,     1,   315,     1,   315,     1,   315,     1,   315,     1,
+     315,     1,   315,     1,   315,     1,   315,     1,   315,     1,
+     315,     1,   315,     1,   315,     1,   315,     1,   315,     1,
+     315,     1,   315,     1,   315,     1,   315,     1,   315,     1,
+     315,     1,   315,     1,   315,     1,   315,     1,   315,     1,
+     315,     1,   315,     1,   315,     1,   315,     1,   315,     1,
+     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
+     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
+     315,   315,   315,   315,   315,   315,     1,   352,     1,   352,
+       1,   315,   352,     1,   360,     1,   360,     1,   315,   352,
+     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
+     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
+     315,   315,   315,   315,     1,   315,     1,   315,     1,   315,
+       1,   315,   315,   315,   315,   315,   315,   315,   315,   315,
+     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
+     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
+     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
+     315,   315,   315,   315,   315,   315,   315,   315,   315,     1,
+     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
+     315,   315,   315,   315,   315,   345,   315,   315,   315,   315,
+     315,   315,   315,   315,   315,   315,   315,   315,     1,   350,
+     352,   387,   388,   389,     1,   389,   391,   392,     1,   352,
+       1,   352,     1,   352,     0,     1,   370,    14,    15,   403,
+     404,    16,   405,   406,    19,   411,   412,    20,   413,   414,
+      21,   415,   416,   345,   363,   361,   349,   350,   352,   402,
+       1,   349,     1,   349,     1,   349,     1,    89,    90,    91,
+      92,   336,   379,     1,   335,   349,   385,     1,   349,     1,
+     349,     1,   385,     1,   349,     1,   349,     1,   349,     1,
+     349,     1,   350,     1,   352,     1,   349,     1,   352,     1,
+     349,     1,   352,     1,   352,     1,   352,     1,   352,     1,
+     349,   350,   351,   352,   353,   360,   363,   376,   378,   379,
+     383,   384,   398,   399,   400,   401,   431,   432,     1,   384,
+       1,   349,     1,   349,     1,   349,   349,   349,   349,   385,
+     385,   385,   385,   349,   349,   349,   349,   349,   349,   349,
+     349,   349,   349,   349,   349,   349,   349,   349,   349,   349,
+     349,   349,   349,   352,   349,   349,   349,   349,   349,   349,
+     349,   349,   349,     1,   385,     1,   349,     1,   352,     1,
+     349,     1,   349,     1,   349,     1,   349,     1,   349,     1,
+     352,     1,   349,     1,   349,     1,   385,     1,   385,     1,
+     385,     1,   385,     1,   385,     1,   385,     1,   385,     1,
+     385,     1,   385,     1,   349,     1,   349,     1,   352,     1,
+     352,     1,   349,     1,   352,   352,   352,     1,   352,     1,
+     349,     1,   349,     1,   350,   352,     1,   350,   352,     1,
+     350,   352,     1,   350,   352,     1,   350,   352,     1,   349,
+       1,   349,     1,   349,     1,   349,     1,   349,     1,   349,
+       1,   385,     1,   385,     1,   385,     1,   350,   352,     1,
+     349,     1,   349,     1,   349,     1,   349,   399,     1,   401,
+       1,   349,     1,   349,   349,   349,   349,   349,     1,   349,
+       1,   349,     1,   349,     1,   349,     1,   349,     1,   349,
+       1,   349,     1,   349,     1,   349,     1,   349,     1,   349,
+       1,   349,     1,   349,     1,   349,     1,   349,     1,   349,
+       1,   349,     1,   349,     1,   234,   235,   236,   237,     1,
+     349,     1,   349,     1,   349,     1,   349,     1,   352,     1,
+     352,     1,   352,     1,   349,     1,   349,     1,   349,     1,
+     376,     1,   349,     1,   349,     1,   349,     1,   349,     1,
+     349,     1,   349,     1,   349,     1,   349,     1,   349,     1,
+     349,     1,   349,     1,   349,     1,   349,     1,   349,     1,
+     349,     1,   350,   352,     1,   349,   350,   349,     1,   349,
+       1,   349,     1,   349,     1,   349,     1,   349,     1,   349,
+       1,   349,     1,   352,     1,   349,     1,   349,     1,   349,
+       1,   349,     1,   349,     1,   349,   281,   282,   283,   284,
+     286,     1,   385,   349,   349,     1,   385,     1,   385,     1,
+     349,     1,   349,     1,   349,     1,   349,     1,   349,     1,
+     352,     1,   352,   357,   366,   357,     1,   363,     1,   361,
+       1,   363,   361,     1,   363,   361,     1,   363,   361,     1,
+     363,    58,   349,   350,   395,   349,   409,   364,   349,   345,
+     376,   377,   400,   366,   366,   384,   110,   111,   335,   345,
+     357,   357,   315,   315,   315,   315,   315,   387,   349,   391,
+     402,     3,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    22,    23,    24,    25,    26,    27,    28,
+      29,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      41,    43,    47,    49,    50,    51,    52,    53,    54,    55,
+      56,    59,    60,    61,    65,    66,    67,    68,    69,    70,
+     300,   350,   354,   355,   358,   433,   435,   436,   437,   441,
+     442,   450,   451,   453,   454,   457,   458,   460,   464,   465,
+     466,   470,   402,   435,   402,   435,   402,   435,   356,   315,
+     364,   435,     1,   410,   349,   357,   359,   364,     1,   336,
+     349,   381,   378,   376,   352,     1,   349,   431,     1,   431,
+     352,   352,     1,   352,     1,   352,     1,   352,     1,   352,
+       1,   352,   364,     1,   360,     1,   360,     1,   360,     1,
+     360,     1,   360,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
+      88,   301,   335,   339,   341,   342,   343,   344,   346,   347,
+     348,   352,   360,   361,   385,   423,   424,   425,   426,   427,
+     428,   433,   445,   450,   451,   452,   453,   455,   457,   458,
+     461,   462,   463,   360,   463,   360,   463,     1,   360,     1,
+     360,     1,   360,   360,     1,   360,     1,   360,     1,   360,
+       1,   360,     1,   360,     1,   360,     1,   360,     1,   360,
+     360,     1,   360,     1,   360,     1,   360,     1,   360,   360,
+     360,   360,   360,   360,   360,   463,     1,   360,     1,   360,
+       1,   360,   360,   360,   360,   360,     1,   463,   463,     1,
+     360,     1,   360,     1,   360,     1,   360,     1,   360,     1,
+     467,     1,   358,     1,   362,   436,   302,   303,   304,   305,
+     306,   307,   308,   309,   310,   350,   447,   448,   449,   315,
+     459,   358,     1,   360,   358,   364,   362,   364,   362,   364,
+     362,   364,     1,   349,   352,   345,   362,   361,   345,   377,
+     366,   111,   366,   357,   357,   361,     1,    62,   350,   352,
+     359,   398,   430,     1,    62,   352,   398,   430,     1,    62,
+     352,   398,   430,     1,    62,   352,   398,   430,     1,    62,
+     352,   398,   430,     1,   323,   324,   325,   328,   329,   418,
+     420,   418,   418,     1,   418,   446,     1,   463,     1,   463,
+       1,   463,   360,   360,   360,     1,   359,   451,   453,   457,
+     458,   463,   464,     1,   435,     1,   420,     1,   330,   331,
+     332,   333,   418,   419,     1,   420,   449,     1,   463,   316,
+     317,   318,   319,   320,   321,   322,   323,   324,   325,   326,
+     327,   328,   329,   330,   331,   332,   333,   334,   335,   336,
+     337,   338,   421,   422,   359,   359,     1,   349,   352,     1,
+     352,     1,   350,   463,   352,     1,   352,     1,   352,     1,
+     352,     1,   352,     1,   349,     1,   349,   359,     1,   359,
+     385,   359,     1,   352,     1,   352,     1,   352,     1,   352,
+     359,   359,   359,     1,   349,   359,     1,   379,   361,   434,
+     436,     1,   376,     1,   349,     1,   376,   379,   382,   359,
+     359,   359,   359,   361,   434,     1,   352,     1,   352,   349,
+     389,   349,   389,   349,   389,   360,   345,   363,   463,     1,
+     352,   450,   451,   456,   458,   361,   361,   361,   361,   278,
+     278,   395,   435,   349,   381,   352,   349,   352,   385,   352,
+     354,   385,   435,   359,   357,   359,   357,   359,   357,   359,
+     335,   345,   357,   359,   359,   357,   359,   357,   359,   357,
+     359,   357,   359,   359,   357,   359,   357,   359,   357,   359,
+     357,   359,   359,   357,   359,   357,   359,   357,   359,   357,
+     359,   359,   357,   359,   357,   359,   357,   359,   357,   359,
+       1,   350,   463,     1,    89,    90,    91,    92,    93,    94,
+     336,   380,   463,     1,   380,   463,     1,   423,   427,   350,
+     443,   444,     1,   463,     1,   463,     1,   463,   359,   359,
+     359,   362,   362,     1,    87,   463,     1,   463,     1,   463,
+       1,    87,   349,   350,   398,   429,   430,   463,   363,     1,
+     463,     1,   463,     1,   463,     1,   463,   463,   463,   463,
+       1,   463,     1,   463,     1,   463,     1,   463,     1,   463,
+       1,   463,     1,   463,   359,   357,   359,   359,   357,   359,
+     359,   359,   359,   359,   359,   359,   359,   359,   359,   359,
+     359,   359,   359,   359,   359,   359,   359,   359,   359,   359,
+     359,   359,   359,   359,   359,   359,   359,   359,   359,   435,
+      48,   359,   359,   359,   359,   359,   366,   366,   359,     1,
+      57,    58,   362,   439,   440,   359,   357,   359,   359,   359,
+     359,   359,   359,   359,   359,   463,   468,   469,   448,   364,
+     357,   359,   449,   357,   435,   435,   435,   435,   352,   352,
+     315,   362,   345,   111,   359,   359,   359,   359,   359,   362,
+      63,   349,   349,   349,     1,   350,     1,   350,   349,    63,
+     349,   349,   349,   349,    63,   349,   349,   349,   349,    63,
+     349,   349,   349,   349,    63,   349,   349,   349,   349,   363,
+     345,   359,   359,   359,   359,   359,   357,   337,   385,   352,
+     352,   362,   434,     1,   381,   376,   362,     1,   337,   438,
+     463,   366,   362,   439,   349,   463,   357,   359,   389,     1,
+     389,   362,   362,   362,   362,   349,   352,   349,   352,   359,
+     359,   359,   359,   359,   359,   359,   359,   359,   359,   359,
+     359,   359,   359,   359,   359,   359,   359,   359,   359,   359,
+     359,   359,   359,   359,   352,   385,   443,   463,     1,   349,
+     398,   364,   359,   359,   366,   366,     1,   438,   366,   435,
+     359,   359,   469,   359,   359,   359,   364,   364,   357,   381,
+     435,   366,   366,     1,   435,   463,   435,   435,   359
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   367,   368,   369,   369,   369,   370,   370,   370,   370,
+     370,   371,   370,   372,   370,   370,   373,   370,   374,   370,
+     375,   370,   370,   370,   376,   376,   376,   377,   377,   378,
+     378,   379,   379,   379,   379,   379,   380,   380,   380,   380,
+     380,   380,   380,   381,   381,   382,   382,   382,   382,   382,
+     383,   383,   383,   383,   383,   384,   384,   385,   385,   386,
+     386,   387,   387,   388,   388,   389,   389,   390,   390,   391,
+     391,   392,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,   393,   394,   394,
+     395,   395,   395,   396,   396,   396,   396,   396,   396,   396,
+     397,   397,   397,   397,   397,   397,   397,   397,   397,   397,
+     397,   397,   397,   397,   397,   397,   397,   397,   397,   398,
+     398,   399,   400,   401,   401,   402,   402,   402,   403,   403,
+     404,   404,   404,   404,   405,   406,   406,   406,   407,   407,
+     409,   408,   408,   408,   410,   408,   408,   411,   412,   412,
+     412,   413,   414,   414,   414,   415,   416,   416,   417,   417,
+     417,   417,   417,   417,   418,   418,   418,   418,   419,   419,
+     419,   419,   420,   420,   421,   421,   421,   421,   421,   421,
+     421,   422,   422,   422,   422,   423,   423,   423,   424,   424,
+     424,   425,   425,   425,   425,   425,   426,   426,   427,   427,
+     427,   428,   428,   428,   428,   428,   428,   428,   428,   428,
+     428,   428,   428,   428,   428,   428,   428,   428,   428,   428,
+     428,   428,   428,   428,   428,   428,   428,   428,   428,   428,
+     429,   429,   429,   429,   430,   430,   430,   430,   430,   431,
+     431,   431,   432,   432,   432,   432,   432,   433,   434,   434,
+     435,   435,   435,   436,   436,   436,   436,   436,   436,   436,
+     436,   437,   437,   438,   439,   439,   439,   439,   439,   439,
+     439,   439,   439,   439,   439,   440,   440,   441,   441,   441,
+     441,   442,   443,   443,   443,   444,   444,   446,   445,   447,
+     447,   447,   447,   447,   447,   447,   447,   447,   448,   449,
+     449,   450,   451,   452,   453,   454,   454,   455,   455,   455,
+     456,   456,   456,   457,   458,   459,   460,   460,   460,   461,
+     461,   461,   461,   461,   461,   461,   461,   461,   461,   461,
+     461,   462,   462,   462,   463,   463,   463,   463,   463,   463,
+     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
+     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
+     463,   463,   463,   463,   463,   463,   463,   463,   463,   463,
+     463,   463,   463,   463,   463,   464,   465,   465,   465,   466,
+     466,   466,   466,   466,   466,   466,   466,   466,   466,   466,
+     466,   466,   466,   466,   466,   466,   466,   466,   466,   466,
+     466,   466,   466,   466,   466,   466,   466,   466,   466,   466,
+     466,   466,   466,   466,   466,   466,   466,   466,   466,   466,
+     466,   466,   466,   466,   466,   466,   466,   466,   466,   466,
+     466,   466,   466,   466,   466,   466,   466,   466,   466,   466,
+     466,   466,   466,   466,   466,   466,   466,   466,   466,   466,
+     466,   466,   466,   466,   466,   466,   466,   466,   466,   466,
+     466,   466,   466,   466,   466,   466,   466,   466,   466,   466,
+     466,   466,   466,   466,   466,   466,   466,   466,   466,   466,
+     466,   466,   466,   466,   466,   466,   466,   466,   466,   466,
+     466,   466,   466,   466,   466,   466,   466,   466,   466,   466,
+     466,   466,   466,   466,   466,   466,   466,   466,   466,   466,
+     466,   466,   466,   466,   466,   466,   466,   466,   466,   466,
+     466,   466,   466,   466,   466,   466,   466,   466,   466,   466,
+     466,   466,   466,   466,   467,   466,   466,   468,   468,   468,
+     469,   470,   470,   470,   470,   470,   470,   470,   470,   470,
+     470
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     1,     2,     1,     1,     1,     1,
+       1,     0,     2,     0,     2,     1,     0,     2,     0,     2,
+       0,     2,     1,     1,     1,     1,     1,     1,     3,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     3,     3,     5,     3,
+       1,     3,     3,     5,     3,     1,     2,     1,     2,     2,
+       2,     1,     3,     1,     3,     1,     1,     2,     2,     1,
+       3,     1,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     2,     3,     2,     3,     2,
+       3,     2,     3,     2,     3,     2,     3,     2,     3,     2,
+       3,     2,     3,     2,     3,     2,     3,     2,     3,     2,
+       3,     2,     3,     2,     3,     2,     3,     2,     3,     2,
+       3,     2,     3,     2,     3,     2,     3,     2,     3,     2,
+       3,     2,     3,     2,     3,     2,     3,     2,     3,     2,
+       3,     2,     3,     2,     3,     2,     3,     2,     3,     2,
+       3,     2,     3,     2,     3,     2,     3,     2,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     2,     3,     2,
+       3,     2,     3,     2,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     5,     7,
+       9,     5,     7,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     2,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     5,     5,     5,     5,     5,     5,
+       5,     5,     5,     5,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     1,     2,     1,     1,
+       1,     1,     1,     5,     5,     7,     7,     5,     8,     8,
+       2,     2,     2,     2,     2,     2,     3,     3,     8,     8,
+       2,     8,     8,     8,     2,     2,     2,     3,     3,     1,
+       1,     7,     1,     1,     3,     1,     1,     1,     1,     1,
+       4,     7,     2,     2,     1,     4,     7,     2,     1,     1,
+       0,     5,     2,     2,     0,     8,     5,     1,     4,     7,
+       2,     1,     4,     7,     2,     1,     7,     2,     2,     2,
+       2,     2,     2,     2,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     3,     3,     3,     2,     3,     3,     3,     2,     3,
+       3,     3,     3,     2,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     2,     3,     3,     3,     2,
+       3,     3,     1,     3,     1,     3,     3,     3,     3,     1,
+       1,     1,     1,     3,     3,     3,     3,     1,     1,     3,
+       2,     1,     2,     2,     1,     1,     1,     2,     2,     1,
+       2,     3,     5,     1,     4,     5,     3,     4,     3,     2,
+       4,     5,     3,     4,     4,     2,     1,     5,     4,     2,
+       5,     3,     1,     4,     4,     3,     1,     0,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       3,     1,     2,     5,     4,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     3,     3,     3,
+       3,     1,     1,     1,     1,     2,     2,     2,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     4,     4,     2,     8,     2,     2,     2,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     4,     4,     4,     2,     3,     1,     1,     1,     3,
+       4,     4,     4,     6,     6,     6,     6,     6,     4,     2,
+       4,     4,     4,     4,     6,     6,     6,     6,     6,     4,
+       2,     4,     4,     4,     4,     6,     6,     6,     6,     6,
+       4,     2,     4,     4,     4,     4,     6,     6,     6,     6,
+       6,     4,     2,     4,     4,     4,     4,     6,     6,     6,
+       6,     6,     4,     2,     4,     4,     6,     2,     4,     4,
+       4,     2,     4,     4,     2,     4,     4,     2,     6,     6,
+       6,     4,     2,     6,     2,     4,     4,     4,     2,     4,
+       4,     4,     2,     4,     4,     2,     4,     4,     2,     4,
+       4,     2,     4,     3,     2,     4,     3,     2,     4,     3,
+       4,     2,     4,     4,     2,     4,     4,     2,     4,     4,
+       2,     4,     4,     2,     4,     4,     2,     4,     3,     1,
+       3,     1,     3,     1,     4,     3,     1,     4,     4,     4,
+       4,     4,     2,     4,     4,     2,     4,     4,     2,     3,
+       1,     3,     1,     3,     1,     3,     1,     6,     6,     2,
+       4,     4,     2,     4,     0,     5,     2,     0,     3,     1,
+       1,     3,     2,     1,     3,     2,     1,     1,     3,     2,
+       1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 3: /* statements: statements statement  */
+#line 647 "core/cfg.y"
+                             {}
+#line 5131 "core/cfg.tab.c"
+    break;
+
+  case 4: /* statements: statement  */
+#line 648 "core/cfg.y"
+                    {}
+#line 5137 "core/cfg.tab.c"
+    break;
+
+  case 5: /* statements: statements error  */
+#line 649 "core/cfg.y"
+                           { yyerror(""); YYABORT;}
+#line 5143 "core/cfg.tab.c"
+    break;
+
+  case 11: /* $@1: %empty  */
+#line 657 "core/cfg.y"
+          {rt=REQUEST_ROUTE;}
+#line 5149 "core/cfg.tab.c"
+    break;
+
+  case 13: /* $@2: %empty  */
+#line 658 "core/cfg.y"
+          {rt=FAILURE_ROUTE;}
+#line 5155 "core/cfg.tab.c"
+    break;
+
+  case 16: /* $@3: %empty  */
+#line 660 "core/cfg.y"
+          {rt=BRANCH_ROUTE;}
+#line 5161 "core/cfg.tab.c"
+    break;
+
+  case 18: /* $@4: %empty  */
+#line 661 "core/cfg.y"
+          {rt=ONSEND_ROUTE;}
+#line 5167 "core/cfg.tab.c"
+    break;
+
+  case 20: /* $@5: %empty  */
+#line 662 "core/cfg.y"
+          {rt=EVENT_ROUTE;}
+#line 5173 "core/cfg.tab.c"
+    break;
+
+  case 24: /* listen_id: ip  */
+#line 667 "core/cfg.y"
+           {
+		if ((yyvsp[0].ipaddr)){
+			tmp=ip_addr2a((yyvsp[0].ipaddr));
+			if (tmp==0) {
+				LM_CRIT("cfg. parser: bad ip address.\n");
+				(yyval.strval)=0;
+			} else {
+				(yyval.strval)=pkg_malloc(strlen(tmp)+1);
+				if ((yyval.strval)==0) {
+					PKG_MEM_CRITICAL;
+				} else {
+					strncpy((yyval.strval), tmp, strlen(tmp)+1);
+				}
+			}
+		}
+	}
+#line 5194 "core/cfg.tab.c"
+    break;
+
+  case 25: /* listen_id: STRING  */
+#line 683 "core/cfg.y"
+                 {
+		(yyval.strval)=pkg_malloc(strlen((yyvsp[0].strval))+1);
+		if ((yyval.strval)==0) {
+				PKG_MEM_CRITICAL;
+		} else {
+				strncpy((yyval.strval), (yyvsp[0].strval), strlen((yyvsp[0].strval))+1);
+		}
+	}
+#line 5207 "core/cfg.tab.c"
+    break;
+
+  case 26: /* listen_id: host_or_if  */
+#line 691 "core/cfg.y"
+                     {
+		if ((yyvsp[0].strval)){
+			(yyval.strval)=pkg_malloc(strlen((yyvsp[0].strval))+1);
+			if ((yyval.strval)==0) {
+					PKG_MEM_CRITICAL;
+			} else {
+					strncpy((yyval.strval), (yyvsp[0].strval), strlen((yyvsp[0].strval))+1);
+			}
+		}
+	}
+#line 5222 "core/cfg.tab.c"
+    break;
+
+  case 27: /* listen_id_lst: listen_id  */
+#line 705 "core/cfg.y"
+                        { (yyval.name_l)=mk_name_lst((yyvsp[0].strval), SI_IS_MHOMED); }
+#line 5228 "core/cfg.tab.c"
+    break;
+
+  case 28: /* listen_id_lst: listen_id COMMA listen_id_lst  */
+#line 706 "core/cfg.y"
+                                        { (yyval.name_l)=mk_name_lst((yyvsp[-2].strval), SI_IS_MHOMED);
+										if ((yyval.name_l)) (yyval.name_l)->next=(yyvsp[0].name_l);
+									}
+#line 5236 "core/cfg.tab.c"
+    break;
+
+  case 29: /* listen_id2: LPAREN listen_id_lst RPAREN  */
+#line 712 "core/cfg.y"
+                                    { (yyval.name_l)=(yyvsp[-1].name_l); }
+#line 5242 "core/cfg.tab.c"
+    break;
+
+  case 30: /* listen_id2: listen_id  */
+#line 713 "core/cfg.y"
+                        { (yyval.name_l)=mk_name_lst((yyvsp[0].strval), 0); }
+#line 5248 "core/cfg.tab.c"
+    break;
+
+  case 31: /* proto: UDP  */
+#line 717 "core/cfg.y"
+                { (yyval.intval)=PROTO_UDP; }
+#line 5254 "core/cfg.tab.c"
+    break;
+
+  case 32: /* proto: TCP  */
+#line 718 "core/cfg.y"
+                { (yyval.intval)=PROTO_TCP; }
+#line 5260 "core/cfg.tab.c"
+    break;
+
+  case 33: /* proto: TLS  */
+#line 719 "core/cfg.y"
+                { (yyval.intval)=PROTO_TLS; }
+#line 5266 "core/cfg.tab.c"
+    break;
+
+  case 34: /* proto: SCTP  */
+#line 720 "core/cfg.y"
+                { (yyval.intval)=PROTO_SCTP; }
+#line 5272 "core/cfg.tab.c"
+    break;
+
+  case 35: /* proto: STAR  */
+#line 721 "core/cfg.y"
+                { (yyval.intval)=0; }
+#line 5278 "core/cfg.tab.c"
+    break;
+
+  case 36: /* eqproto: UDP  */
+#line 724 "core/cfg.y"
+                { (yyval.intval)=PROTO_UDP; }
+#line 5284 "core/cfg.tab.c"
+    break;
+
+  case 37: /* eqproto: TCP  */
+#line 725 "core/cfg.y"
+                { (yyval.intval)=PROTO_TCP; }
+#line 5290 "core/cfg.tab.c"
+    break;
+
+  case 38: /* eqproto: TLS  */
+#line 726 "core/cfg.y"
+                { (yyval.intval)=PROTO_TLS; }
+#line 5296 "core/cfg.tab.c"
+    break;
+
+  case 39: /* eqproto: SCTP  */
+#line 727 "core/cfg.y"
+                { (yyval.intval)=PROTO_SCTP; }
+#line 5302 "core/cfg.tab.c"
+    break;
+
+  case 40: /* eqproto: WS  */
+#line 728 "core/cfg.y"
+                { (yyval.intval)=PROTO_WS; }
+#line 5308 "core/cfg.tab.c"
+    break;
+
+  case 41: /* eqproto: WSS  */
+#line 729 "core/cfg.y"
+                { (yyval.intval)=PROTO_WSS; }
+#line 5314 "core/cfg.tab.c"
+    break;
+
+  case 42: /* eqproto: STAR  */
+#line 730 "core/cfg.y"
+                { (yyval.intval)=0; }
+#line 5320 "core/cfg.tab.c"
+    break;
+
+  case 43: /* port: NUMBER  */
+#line 733 "core/cfg.y"
+                { (yyval.intval)=(yyvsp[0].intval); }
+#line 5326 "core/cfg.tab.c"
+    break;
+
+  case 44: /* port: STAR  */
+#line 734 "core/cfg.y"
+                { (yyval.intval)=0; }
+#line 5332 "core/cfg.tab.c"
+    break;
+
+  case 45: /* phostport: listen_id  */
+#line 737 "core/cfg.y"
+                                { (yyval.sockid)=mk_listen_id((yyvsp[0].strval), 0, 0); }
+#line 5338 "core/cfg.tab.c"
+    break;
+
+  case 46: /* phostport: listen_id COLON port  */
+#line 738 "core/cfg.y"
+                                { (yyval.sockid)=mk_listen_id((yyvsp[-2].strval), 0, (yyvsp[0].intval)); }
+#line 5344 "core/cfg.tab.c"
+    break;
+
+  case 47: /* phostport: proto COLON listen_id  */
+#line 739 "core/cfg.y"
+                                { (yyval.sockid)=mk_listen_id((yyvsp[0].strval), (yyvsp[-2].intval), 0); }
+#line 5350 "core/cfg.tab.c"
+    break;
+
+  case 48: /* phostport: proto COLON listen_id COLON port  */
+#line 740 "core/cfg.y"
+                                                { (yyval.sockid)=mk_listen_id((yyvsp[-2].strval), (yyvsp[-4].intval), (yyvsp[0].intval));}
+#line 5356 "core/cfg.tab.c"
+    break;
+
+  case 49: /* phostport: listen_id COLON error  */
+#line 741 "core/cfg.y"
+                                { (yyval.sockid)=0; yyerror("port number expected"); }
+#line 5362 "core/cfg.tab.c"
+    break;
+
+  case 50: /* listen_phostport: listen_id2  */
+#line 745 "core/cfg.y"
+                                { (yyval.sockid)=mk_listen_id2((yyvsp[0].name_l), 0, 0); }
+#line 5368 "core/cfg.tab.c"
+    break;
+
+  case 51: /* listen_phostport: listen_id2 COLON port  */
+#line 746 "core/cfg.y"
+                                { (yyval.sockid)=mk_listen_id2((yyvsp[-2].name_l), 0, (yyvsp[0].intval)); }
+#line 5374 "core/cfg.tab.c"
+    break;
+
+  case 52: /* listen_phostport: proto COLON listen_id2  */
+#line 747 "core/cfg.y"
+                                        { (yyval.sockid)=mk_listen_id2((yyvsp[0].name_l), (yyvsp[-2].intval), 0); }
+#line 5380 "core/cfg.tab.c"
+    break;
+
+  case 53: /* listen_phostport: proto COLON listen_id2 COLON port  */
+#line 748 "core/cfg.y"
+                                                { (yyval.sockid)=mk_listen_id2((yyvsp[-2].name_l), (yyvsp[-4].intval), (yyvsp[0].intval));}
+#line 5386 "core/cfg.tab.c"
+    break;
+
+  case 54: /* listen_phostport: listen_id2 COLON error  */
+#line 749 "core/cfg.y"
+                                 { (yyval.sockid)=0; yyerror("port number expected"); }
+#line 5392 "core/cfg.tab.c"
+    break;
+
+  case 55: /* id_lst: listen_phostport  */
+#line 753 "core/cfg.y"
+                                        {  (yyval.sockid)=(yyvsp[0].sockid) ; }
+#line 5398 "core/cfg.tab.c"
+    break;
+
+  case 56: /* id_lst: listen_phostport id_lst  */
+#line 754 "core/cfg.y"
+                                        { (yyval.sockid)=(yyvsp[-1].sockid);  if ((yyval.sockid)) (yyval.sockid)->next=(yyvsp[0].sockid); }
+#line 5404 "core/cfg.tab.c"
+    break;
+
+  case 58: /* intno: MINUS NUMBER  */
+#line 758 "core/cfg.y"
+                                    { (yyval.intval)=-(yyvsp[0].intval); }
+#line 5410 "core/cfg.tab.c"
+    break;
+
+  case 60: /* flags_decl: FLAGS_DECL error  */
+#line 762 "core/cfg.y"
+                                                 { yyerror("flag list expected\n"); }
+#line 5416 "core/cfg.tab.c"
+    break;
+
+  case 63: /* flag_spec: flag_name  */
+#line 768 "core/cfg.y"
+                                        { if (register_flag((yyvsp[0].strval),-1)<0)
+								yyerror("register flag failed");
+						}
+#line 5424 "core/cfg.tab.c"
+    break;
+
+  case 64: /* flag_spec: flag_name COLON NUMBER  */
+#line 771 "core/cfg.y"
+                                                       {
+						if (register_flag((yyvsp[-2].strval), (yyvsp[0].intval))<0)
+								yyerror("register flag failed");
+										}
+#line 5433 "core/cfg.tab.c"
+    break;
+
+  case 65: /* flag_name: STRING  */
+#line 777 "core/cfg.y"
+                                { (yyval.strval)=(yyvsp[0].strval); }
+#line 5439 "core/cfg.tab.c"
+    break;
+
+  case 66: /* flag_name: ID  */
+#line 778 "core/cfg.y"
+                                                { (yyval.strval)=(yyvsp[0].strval); }
+#line 5445 "core/cfg.tab.c"
+    break;
+
+  case 68: /* avpflags_decl: AVPFLAGS_DECL error  */
+#line 783 "core/cfg.y"
+                              { yyerror("avpflag list expected\n"); }
+#line 5451 "core/cfg.tab.c"
+    break;
+
+  case 71: /* avpflag_spec: flag_name  */
+#line 790 "core/cfg.y"
+                  {
+		if (register_avpflag((yyvsp[0].strval))==0)
+			yyerror("cannot declare avpflag");
+	}
+#line 5460 "core/cfg.tab.c"
+    break;
+
+  case 72: /* assign_stm: DEBUG_V EQUAL intno  */
+#line 796 "core/cfg.y"
+                            { default_core_cfg.debug=(yyvsp[0].intval); }
+#line 5466 "core/cfg.tab.c"
+    break;
+
+  case 73: /* assign_stm: DEBUG_V EQUAL error  */
+#line 797 "core/cfg.y"
+                               { yyerror("number  expected"); }
+#line 5472 "core/cfg.tab.c"
+    break;
+
+  case 74: /* assign_stm: FORK EQUAL NUMBER  */
+#line 798 "core/cfg.y"
+                             { dont_fork= ! (yyvsp[0].intval); }
+#line 5478 "core/cfg.tab.c"
+    break;
+
+  case 75: /* assign_stm: FORK EQUAL error  */
+#line 799 "core/cfg.y"
+                             { yyerror("boolean value expected"); }
+#line 5484 "core/cfg.tab.c"
+    break;
+
+  case 76: /* assign_stm: FORK_DELAY EQUAL NUMBER  */
+#line 800 "core/cfg.y"
+                                   { set_fork_delay((yyvsp[0].intval)); }
+#line 5490 "core/cfg.tab.c"
+    break;
+
+  case 77: /* assign_stm: FORK_DELAY EQUAL error  */
+#line 801 "core/cfg.y"
+                                   { yyerror("number expected"); }
+#line 5496 "core/cfg.tab.c"
+    break;
+
+  case 78: /* assign_stm: MODINIT_DELAY EQUAL NUMBER  */
+#line 802 "core/cfg.y"
+                                      { set_modinit_delay((yyvsp[0].intval)); }
+#line 5502 "core/cfg.tab.c"
+    break;
+
+  case 79: /* assign_stm: MODINIT_DELAY EQUAL error  */
+#line 803 "core/cfg.y"
+                                      { yyerror("number expected"); }
+#line 5508 "core/cfg.tab.c"
+    break;
+
+  case 80: /* assign_stm: LOGSTDERROR EQUAL NUMBER  */
+#line 804 "core/cfg.y"
+                                   { if (!config_check)  /* if set from cmd line, don't overwrite from yyparse()*/
+					if(log_stderr == 0) log_stderr=(yyvsp[0].intval);
+				   }
+#line 5516 "core/cfg.tab.c"
+    break;
+
+  case 81: /* assign_stm: LOGSTDERROR EQUAL error  */
+#line 807 "core/cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 5522 "core/cfg.tab.c"
+    break;
+
+  case 82: /* assign_stm: LOGFACILITY EQUAL ID  */
+#line 808 "core/cfg.y"
+                               {
+		if ( (i_tmp=str2facility((yyvsp[0].strval)))==-1)
+			yyerror("bad facility (see syslog(3) man page)");
+		if (!config_check)
+			default_core_cfg.log_facility=i_tmp;
+	}
+#line 5533 "core/cfg.tab.c"
+    break;
+
+  case 83: /* assign_stm: LOGFACILITY EQUAL error  */
+#line 814 "core/cfg.y"
+                                  { yyerror("ID expected"); }
+#line 5539 "core/cfg.tab.c"
+    break;
+
+  case 84: /* assign_stm: LOGNAME EQUAL STRING  */
+#line 815 "core/cfg.y"
+                               { log_name=(yyvsp[0].strval); }
+#line 5545 "core/cfg.tab.c"
+    break;
+
+  case 85: /* assign_stm: LOGNAME EQUAL error  */
+#line 816 "core/cfg.y"
+                              { yyerror("string value expected"); }
+#line 5551 "core/cfg.tab.c"
+    break;
+
+  case 86: /* assign_stm: LOGCOLOR EQUAL NUMBER  */
+#line 817 "core/cfg.y"
+                                { log_color=(yyvsp[0].intval); }
+#line 5557 "core/cfg.tab.c"
+    break;
+
+  case 87: /* assign_stm: LOGCOLOR EQUAL error  */
+#line 818 "core/cfg.y"
+                               { yyerror("boolean value expected"); }
+#line 5563 "core/cfg.tab.c"
+    break;
+
+  case 88: /* assign_stm: LOGPREFIX EQUAL STRING  */
+#line 819 "core/cfg.y"
+                                 { log_prefix_fmt=(yyvsp[0].strval); }
+#line 5569 "core/cfg.tab.c"
+    break;
+
+  case 89: /* assign_stm: LOGPREFIX EQUAL error  */
+#line 820 "core/cfg.y"
+                                { yyerror("string value expected"); }
+#line 5575 "core/cfg.tab.c"
+    break;
+
+  case 90: /* assign_stm: LOGPREFIXMODE EQUAL NUMBER  */
+#line 821 "core/cfg.y"
+                                     { log_prefix_mode=(yyvsp[0].intval); }
+#line 5581 "core/cfg.tab.c"
+    break;
+
+  case 91: /* assign_stm: LOGPREFIXMODE EQUAL error  */
+#line 822 "core/cfg.y"
+                                    { yyerror("number expected"); }
+#line 5587 "core/cfg.tab.c"
+    break;
+
+  case 92: /* assign_stm: LOGENGINETYPE EQUAL STRING  */
+#line 823 "core/cfg.y"
+                                     { _km_log_engine_type=(yyvsp[0].strval); }
+#line 5593 "core/cfg.tab.c"
+    break;
+
+  case 93: /* assign_stm: LOGENGINETYPE EQUAL error  */
+#line 824 "core/cfg.y"
+                                    { yyerror("string value expected"); }
+#line 5599 "core/cfg.tab.c"
+    break;
+
+  case 94: /* assign_stm: LOGENGINEDATA EQUAL STRING  */
+#line 825 "core/cfg.y"
+                                     { _km_log_engine_data=(yyvsp[0].strval); }
+#line 5605 "core/cfg.tab.c"
+    break;
+
+  case 95: /* assign_stm: LOGENGINEDATA EQUAL error  */
+#line 826 "core/cfg.y"
+                                    { yyerror("string value expected"); }
+#line 5611 "core/cfg.tab.c"
+    break;
+
+  case 96: /* assign_stm: XAVPVIAPARAMS EQUAL STRING  */
+#line 827 "core/cfg.y"
+                                     { _ksr_xavp_via_params.s=(yyvsp[0].strval);
+			_ksr_xavp_via_params.len=strlen((yyvsp[0].strval));
+		}
+#line 5619 "core/cfg.tab.c"
+    break;
+
+  case 97: /* assign_stm: XAVPVIAPARAMS EQUAL error  */
+#line 830 "core/cfg.y"
+                                    { yyerror("string value expected"); }
+#line 5625 "core/cfg.tab.c"
+    break;
+
+  case 98: /* assign_stm: XAVPVIAFIELDS EQUAL STRING  */
+#line 831 "core/cfg.y"
+                                     { _ksr_xavp_via_params.s=(yyvsp[0].strval);
+			_ksr_xavp_via_fields.len=strlen((yyvsp[0].strval));
+		}
+#line 5633 "core/cfg.tab.c"
+    break;
+
+  case 99: /* assign_stm: XAVPVIAFIELDS EQUAL error  */
+#line 834 "core/cfg.y"
+                                    { yyerror("string value expected"); }
+#line 5639 "core/cfg.tab.c"
+    break;
+
+  case 100: /* assign_stm: DNS EQUAL NUMBER  */
+#line 835 "core/cfg.y"
+                             { received_dns|= ((yyvsp[0].intval))?DO_DNS:0; }
+#line 5645 "core/cfg.tab.c"
+    break;
+
+  case 101: /* assign_stm: DNS EQUAL error  */
+#line 836 "core/cfg.y"
+                          { yyerror("boolean value expected"); }
+#line 5651 "core/cfg.tab.c"
+    break;
+
+  case 102: /* assign_stm: REV_DNS EQUAL NUMBER  */
+#line 837 "core/cfg.y"
+                               { received_dns|= ((yyvsp[0].intval))?DO_REV_DNS:0; }
+#line 5657 "core/cfg.tab.c"
+    break;
+
+  case 103: /* assign_stm: REV_DNS EQUAL error  */
+#line 838 "core/cfg.y"
+                              { yyerror("boolean value expected"); }
+#line 5663 "core/cfg.tab.c"
+    break;
+
+  case 104: /* assign_stm: DNS_TRY_IPV6 EQUAL NUMBER  */
+#line 839 "core/cfg.y"
+                                      { default_core_cfg.dns_try_ipv6=(yyvsp[0].intval); }
+#line 5669 "core/cfg.tab.c"
+    break;
+
+  case 105: /* assign_stm: DNS_TRY_IPV6 error  */
+#line 840 "core/cfg.y"
+                             { yyerror("boolean value expected"); }
+#line 5675 "core/cfg.tab.c"
+    break;
+
+  case 106: /* assign_stm: DNS_TRY_NAPTR EQUAL NUMBER  */
+#line 841 "core/cfg.y"
+                                       { IF_NAPTR(default_core_cfg.dns_try_naptr=(yyvsp[0].intval)); }
+#line 5681 "core/cfg.tab.c"
+    break;
+
+  case 107: /* assign_stm: DNS_TRY_NAPTR error  */
+#line 842 "core/cfg.y"
+                              { yyerror("boolean value expected"); }
+#line 5687 "core/cfg.tab.c"
+    break;
+
+  case 108: /* assign_stm: DNS_SRV_LB EQUAL NUMBER  */
+#line 843 "core/cfg.y"
+                                    { IF_DNS_FAILOVER(default_core_cfg.dns_srv_lb=(yyvsp[0].intval)); }
+#line 5693 "core/cfg.tab.c"
+    break;
+
+  case 109: /* assign_stm: DNS_SRV_LB error  */
+#line 844 "core/cfg.y"
+                           { yyerror("boolean value expected"); }
+#line 5699 "core/cfg.tab.c"
+    break;
+
+  case 110: /* assign_stm: DNS_UDP_PREF EQUAL intno  */
+#line 845 "core/cfg.y"
+                                   { IF_NAPTR(default_core_cfg.dns_udp_pref=(yyvsp[0].intval));}
+#line 5705 "core/cfg.tab.c"
+    break;
+
+  case 111: /* assign_stm: DNS_UDP_PREF error  */
+#line 846 "core/cfg.y"
+                             { yyerror("number expected"); }
+#line 5711 "core/cfg.tab.c"
+    break;
+
+  case 112: /* assign_stm: DNS_TCP_PREF EQUAL intno  */
+#line 847 "core/cfg.y"
+                                   { IF_NAPTR(default_core_cfg.dns_tcp_pref=(yyvsp[0].intval));}
+#line 5717 "core/cfg.tab.c"
+    break;
+
+  case 113: /* assign_stm: DNS_TCP_PREF error  */
+#line 848 "core/cfg.y"
+                             { yyerror("number expected"); }
+#line 5723 "core/cfg.tab.c"
+    break;
+
+  case 114: /* assign_stm: DNS_TLS_PREF EQUAL intno  */
+#line 849 "core/cfg.y"
+                                   { IF_NAPTR(default_core_cfg.dns_tls_pref=(yyvsp[0].intval));}
+#line 5729 "core/cfg.tab.c"
+    break;
+
+  case 115: /* assign_stm: DNS_TLS_PREF error  */
+#line 850 "core/cfg.y"
+                             { yyerror("number expected"); }
+#line 5735 "core/cfg.tab.c"
+    break;
+
+  case 116: /* assign_stm: DNS_SCTP_PREF EQUAL intno  */
+#line 851 "core/cfg.y"
+                                    {
+								IF_NAPTR(default_core_cfg.dns_sctp_pref=(yyvsp[0].intval)); }
+#line 5742 "core/cfg.tab.c"
+    break;
+
+  case 117: /* assign_stm: DNS_SCTP_PREF error  */
+#line 853 "core/cfg.y"
+                              { yyerror("number expected"); }
+#line 5748 "core/cfg.tab.c"
+    break;
+
+  case 118: /* assign_stm: DNS_RETR_TIME EQUAL NUMBER  */
+#line 854 "core/cfg.y"
+                                       { default_core_cfg.dns_retr_time=(yyvsp[0].intval); }
+#line 5754 "core/cfg.tab.c"
+    break;
+
+  case 119: /* assign_stm: DNS_RETR_TIME error  */
+#line 855 "core/cfg.y"
+                              { yyerror("number expected"); }
+#line 5760 "core/cfg.tab.c"
+    break;
+
+  case 120: /* assign_stm: DNS_SLOW_QUERY_MS EQUAL NUMBER  */
+#line 856 "core/cfg.y"
+                                           { default_core_cfg.dns_slow_query_ms=(yyvsp[0].intval); }
+#line 5766 "core/cfg.tab.c"
+    break;
+
+  case 121: /* assign_stm: DNS_SLOW_QUERY_MS error  */
+#line 857 "core/cfg.y"
+                                  { yyerror("number expected"); }
+#line 5772 "core/cfg.tab.c"
+    break;
+
+  case 122: /* assign_stm: DNS_RETR_NO EQUAL NUMBER  */
+#line 858 "core/cfg.y"
+                                     { default_core_cfg.dns_retr_no=(yyvsp[0].intval); }
+#line 5778 "core/cfg.tab.c"
+    break;
+
+  case 123: /* assign_stm: DNS_RETR_NO error  */
+#line 859 "core/cfg.y"
+                            { yyerror("number expected"); }
+#line 5784 "core/cfg.tab.c"
+    break;
+
+  case 124: /* assign_stm: DNS_SERVERS_NO EQUAL NUMBER  */
+#line 860 "core/cfg.y"
+                                        { default_core_cfg.dns_servers_no=(yyvsp[0].intval); }
+#line 5790 "core/cfg.tab.c"
+    break;
+
+  case 125: /* assign_stm: DNS_SERVERS_NO error  */
+#line 861 "core/cfg.y"
+                               { yyerror("number expected"); }
+#line 5796 "core/cfg.tab.c"
+    break;
+
+  case 126: /* assign_stm: DNS_USE_SEARCH EQUAL NUMBER  */
+#line 862 "core/cfg.y"
+                                        { default_core_cfg.dns_search_list=(yyvsp[0].intval); }
+#line 5802 "core/cfg.tab.c"
+    break;
+
+  case 127: /* assign_stm: DNS_USE_SEARCH error  */
+#line 863 "core/cfg.y"
+                               { yyerror("boolean value expected"); }
+#line 5808 "core/cfg.tab.c"
+    break;
+
+  case 128: /* assign_stm: DNS_SEARCH_FMATCH EQUAL NUMBER  */
+#line 864 "core/cfg.y"
+                                           { default_core_cfg.dns_search_fmatch=(yyvsp[0].intval); }
+#line 5814 "core/cfg.tab.c"
+    break;
+
+  case 129: /* assign_stm: DNS_SEARCH_FMATCH error  */
+#line 865 "core/cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 5820 "core/cfg.tab.c"
+    break;
+
+  case 130: /* assign_stm: DNS_NAPTR_IGNORE_RFC EQUAL NUMBER  */
+#line 866 "core/cfg.y"
+                                              { default_core_cfg.dns_naptr_ignore_rfc=(yyvsp[0].intval); }
+#line 5826 "core/cfg.tab.c"
+    break;
+
+  case 131: /* assign_stm: DNS_NAPTR_IGNORE_RFC error  */
+#line 867 "core/cfg.y"
+                                     { yyerror("boolean value expected"); }
+#line 5832 "core/cfg.tab.c"
+    break;
+
+  case 132: /* assign_stm: DNS_CACHE_INIT EQUAL NUMBER  */
+#line 868 "core/cfg.y"
+                                        { IF_DNS_CACHE(dns_cache_init=(yyvsp[0].intval)); }
+#line 5838 "core/cfg.tab.c"
+    break;
+
+  case 133: /* assign_stm: DNS_CACHE_INIT error  */
+#line 869 "core/cfg.y"
+                               { yyerror("boolean value expected"); }
+#line 5844 "core/cfg.tab.c"
+    break;
+
+  case 134: /* assign_stm: DNS_USE_CACHE EQUAL NUMBER  */
+#line 870 "core/cfg.y"
+                                       { IF_DNS_CACHE(default_core_cfg.use_dns_cache=(yyvsp[0].intval)); }
+#line 5850 "core/cfg.tab.c"
+    break;
+
+  case 135: /* assign_stm: DNS_USE_CACHE error  */
+#line 871 "core/cfg.y"
+                              { yyerror("boolean value expected"); }
+#line 5856 "core/cfg.tab.c"
+    break;
+
+  case 136: /* assign_stm: DNS_USE_FAILOVER EQUAL NUMBER  */
+#line 872 "core/cfg.y"
+                                          { IF_DNS_FAILOVER(default_core_cfg.use_dns_failover=(yyvsp[0].intval));}
+#line 5862 "core/cfg.tab.c"
+    break;
+
+  case 137: /* assign_stm: DNS_USE_FAILOVER error  */
+#line 873 "core/cfg.y"
+                                 { yyerror("boolean value expected"); }
+#line 5868 "core/cfg.tab.c"
+    break;
+
+  case 138: /* assign_stm: DNS_CACHE_FLAGS EQUAL NUMBER  */
+#line 874 "core/cfg.y"
+                                         { IF_DNS_CACHE(default_core_cfg.dns_cache_flags=(yyvsp[0].intval)); }
+#line 5874 "core/cfg.tab.c"
+    break;
+
+  case 139: /* assign_stm: DNS_CACHE_FLAGS error  */
+#line 875 "core/cfg.y"
+                                { yyerror("boolean value expected"); }
+#line 5880 "core/cfg.tab.c"
+    break;
+
+  case 140: /* assign_stm: DNS_CACHE_NEG_TTL EQUAL NUMBER  */
+#line 876 "core/cfg.y"
+                                           { IF_DNS_CACHE(default_core_cfg.dns_neg_cache_ttl=(yyvsp[0].intval)); }
+#line 5886 "core/cfg.tab.c"
+    break;
+
+  case 141: /* assign_stm: DNS_CACHE_NEG_TTL error  */
+#line 877 "core/cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 5892 "core/cfg.tab.c"
+    break;
+
+  case 142: /* assign_stm: DNS_CACHE_MAX_TTL EQUAL NUMBER  */
+#line 878 "core/cfg.y"
+                                           { IF_DNS_CACHE(default_core_cfg.dns_cache_max_ttl=(yyvsp[0].intval)); }
+#line 5898 "core/cfg.tab.c"
+    break;
+
+  case 143: /* assign_stm: DNS_CACHE_MAX_TTL error  */
+#line 879 "core/cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 5904 "core/cfg.tab.c"
+    break;
+
+  case 144: /* assign_stm: DNS_CACHE_MIN_TTL EQUAL NUMBER  */
+#line 880 "core/cfg.y"
+                                           { IF_DNS_CACHE(default_core_cfg.dns_cache_min_ttl=(yyvsp[0].intval)); }
+#line 5910 "core/cfg.tab.c"
+    break;
+
+  case 145: /* assign_stm: DNS_CACHE_MIN_TTL error  */
+#line 881 "core/cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 5916 "core/cfg.tab.c"
+    break;
+
+  case 146: /* assign_stm: DNS_CACHE_MEM EQUAL NUMBER  */
+#line 882 "core/cfg.y"
+                                       { IF_DNS_CACHE(default_core_cfg.dns_cache_max_mem=(yyvsp[0].intval)); }
+#line 5922 "core/cfg.tab.c"
+    break;
+
+  case 147: /* assign_stm: DNS_CACHE_MEM error  */
+#line 883 "core/cfg.y"
+                              { yyerror("boolean value expected"); }
+#line 5928 "core/cfg.tab.c"
+    break;
+
+  case 148: /* assign_stm: DNS_CACHE_GC_INT EQUAL NUMBER  */
+#line 884 "core/cfg.y"
+                                          { IF_DNS_CACHE(dns_timer_interval=(yyvsp[0].intval)); }
+#line 5934 "core/cfg.tab.c"
+    break;
+
+  case 149: /* assign_stm: DNS_CACHE_GC_INT error  */
+#line 885 "core/cfg.y"
+                                 { yyerror("boolean value expected"); }
+#line 5940 "core/cfg.tab.c"
+    break;
+
+  case 150: /* assign_stm: DNS_CACHE_DEL_NONEXP EQUAL NUMBER  */
+#line 886 "core/cfg.y"
+                                              { IF_DNS_CACHE(default_core_cfg.dns_cache_del_nonexp=(yyvsp[0].intval)); }
+#line 5946 "core/cfg.tab.c"
+    break;
+
+  case 151: /* assign_stm: DNS_CACHE_DEL_NONEXP error  */
+#line 887 "core/cfg.y"
+                                     { yyerror("boolean value expected"); }
+#line 5952 "core/cfg.tab.c"
+    break;
+
+  case 152: /* assign_stm: DNS_CACHE_REC_PREF EQUAL NUMBER  */
+#line 888 "core/cfg.y"
+                                            { IF_DNS_CACHE(default_core_cfg.dns_cache_rec_pref=(yyvsp[0].intval)); }
+#line 5958 "core/cfg.tab.c"
+    break;
+
+  case 153: /* assign_stm: DNS_CACHE_REC_PREF error  */
+#line 889 "core/cfg.y"
+                                   { yyerror("boolean value expected"); }
+#line 5964 "core/cfg.tab.c"
+    break;
+
+  case 154: /* assign_stm: AUTO_BIND_IPV6 EQUAL NUMBER  */
+#line 890 "core/cfg.y"
+                                      {IF_AUTO_BIND_IPV6(auto_bind_ipv6 = (yyvsp[0].intval));}
+#line 5970 "core/cfg.tab.c"
+    break;
+
+  case 155: /* assign_stm: AUTO_BIND_IPV6 error  */
+#line 891 "core/cfg.y"
+                               { yyerror("boolean value expected"); }
+#line 5976 "core/cfg.tab.c"
+    break;
+
+  case 156: /* assign_stm: IPV6_HEX_STYLE EQUAL STRING  */
+#line 892 "core/cfg.y"
+                                      {
+		ksr_ipv6_hex_style.s = (yyvsp[0].strval);
+		if(ksr_ipv6_hex_style.s[0]!='a' && ksr_ipv6_hex_style.s[0]!='A'
+				&& ksr_ipv6_hex_style.s[0]!='c') {
+			yyerror("expected \"a\", \"A\" or \"c\" value");
+		}
+		ksr_ipv6_hex_style.len = strlen(ksr_ipv6_hex_style.s);
+	}
+#line 5989 "core/cfg.tab.c"
+    break;
+
+  case 157: /* assign_stm: IPV6_HEX_STYLE error  */
+#line 900 "core/cfg.y"
+                               { yyerror("string value expected"); }
+#line 5995 "core/cfg.tab.c"
+    break;
+
+  case 158: /* assign_stm: BIND_IPV6_LINK_LOCAL EQUAL NUMBER  */
+#line 901 "core/cfg.y"
+                                            {sr_bind_ipv6_link_local = (yyvsp[0].intval);}
+#line 6001 "core/cfg.tab.c"
+    break;
+
+  case 159: /* assign_stm: BIND_IPV6_LINK_LOCAL error  */
+#line 902 "core/cfg.y"
+                                     { yyerror("boolean value expected"); }
+#line 6007 "core/cfg.tab.c"
+    break;
+
+  case 160: /* assign_stm: DST_BLST_INIT EQUAL NUMBER  */
+#line 903 "core/cfg.y"
+                                       { IF_DST_BLOCKLIST(dst_blocklist_init=(yyvsp[0].intval)); }
+#line 6013 "core/cfg.tab.c"
+    break;
+
+  case 161: /* assign_stm: DST_BLST_INIT error  */
+#line 904 "core/cfg.y"
+                              { yyerror("boolean value expected"); }
+#line 6019 "core/cfg.tab.c"
+    break;
+
+  case 162: /* assign_stm: USE_DST_BLST EQUAL NUMBER  */
+#line 905 "core/cfg.y"
+                                    {
+		IF_DST_BLOCKLIST(default_core_cfg.use_dst_blocklist=(yyvsp[0].intval));
+	}
+#line 6027 "core/cfg.tab.c"
+    break;
+
+  case 163: /* assign_stm: USE_DST_BLST error  */
+#line 908 "core/cfg.y"
+                             { yyerror("boolean value expected"); }
+#line 6033 "core/cfg.tab.c"
+    break;
+
+  case 164: /* assign_stm: DST_BLST_MEM EQUAL NUMBER  */
+#line 909 "core/cfg.y"
+                                    {
+		IF_DST_BLOCKLIST(default_core_cfg.blst_max_mem=(yyvsp[0].intval));
+	}
+#line 6041 "core/cfg.tab.c"
+    break;
+
+  case 165: /* assign_stm: DST_BLST_MEM error  */
+#line 912 "core/cfg.y"
+                             { yyerror("boolean value expected"); }
+#line 6047 "core/cfg.tab.c"
+    break;
+
+  case 166: /* assign_stm: DST_BLST_TTL EQUAL NUMBER  */
+#line 913 "core/cfg.y"
+                                    {
+		IF_DST_BLOCKLIST(default_core_cfg.blst_timeout=(yyvsp[0].intval));
+	}
+#line 6055 "core/cfg.tab.c"
+    break;
+
+  case 167: /* assign_stm: DST_BLST_TTL error  */
+#line 916 "core/cfg.y"
+                             { yyerror("boolean value expected"); }
+#line 6061 "core/cfg.tab.c"
+    break;
+
+  case 168: /* assign_stm: DST_BLST_GC_INT EQUAL NUMBER  */
+#line 917 "core/cfg.y"
+                                       { IF_DST_BLOCKLIST(blst_timer_interval=(yyvsp[0].intval));}
+#line 6067 "core/cfg.tab.c"
+    break;
+
+  case 169: /* assign_stm: DST_BLST_GC_INT error  */
+#line 918 "core/cfg.y"
+                                { yyerror("boolean value expected"); }
+#line 6073 "core/cfg.tab.c"
+    break;
+
+  case 170: /* assign_stm: DST_BLST_UDP_IMASK EQUAL NUMBER  */
+#line 919 "core/cfg.y"
+                                          {
+		IF_DST_BLOCKLIST(default_core_cfg.blst_udp_imask=(yyvsp[0].intval));
+	}
+#line 6081 "core/cfg.tab.c"
+    break;
+
+  case 171: /* assign_stm: DST_BLST_UDP_IMASK error  */
+#line 922 "core/cfg.y"
+                                   { yyerror("number(flags) expected"); }
+#line 6087 "core/cfg.tab.c"
+    break;
+
+  case 172: /* assign_stm: DST_BLST_TCP_IMASK EQUAL NUMBER  */
+#line 923 "core/cfg.y"
+                                          {
+		IF_DST_BLOCKLIST(default_core_cfg.blst_tcp_imask=(yyvsp[0].intval));
+	}
+#line 6095 "core/cfg.tab.c"
+    break;
+
+  case 173: /* assign_stm: DST_BLST_TCP_IMASK error  */
+#line 926 "core/cfg.y"
+                                   { yyerror("number(flags) expected"); }
+#line 6101 "core/cfg.tab.c"
+    break;
+
+  case 174: /* assign_stm: DST_BLST_TLS_IMASK EQUAL NUMBER  */
+#line 927 "core/cfg.y"
+                                          {
+		IF_DST_BLOCKLIST(default_core_cfg.blst_tls_imask=(yyvsp[0].intval));
+	}
+#line 6109 "core/cfg.tab.c"
+    break;
+
+  case 175: /* assign_stm: DST_BLST_TLS_IMASK error  */
+#line 930 "core/cfg.y"
+                                   { yyerror("number(flags) expected"); }
+#line 6115 "core/cfg.tab.c"
+    break;
+
+  case 176: /* assign_stm: DST_BLST_SCTP_IMASK EQUAL NUMBER  */
+#line 931 "core/cfg.y"
+                                           {
+		IF_DST_BLOCKLIST(default_core_cfg.blst_sctp_imask=(yyvsp[0].intval));
+	}
+#line 6123 "core/cfg.tab.c"
+    break;
+
+  case 177: /* assign_stm: DST_BLST_SCTP_IMASK error  */
+#line 934 "core/cfg.y"
+                                    { yyerror("number(flags) expected"); }
+#line 6129 "core/cfg.tab.c"
+    break;
+
+  case 178: /* assign_stm: IP_FREE_BIND EQUAL intno  */
+#line 935 "core/cfg.y"
+                                   { _sr_ip_free_bind=(yyvsp[0].intval); }
+#line 6135 "core/cfg.tab.c"
+    break;
+
+  case 179: /* assign_stm: IP_FREE_BIND EQUAL error  */
+#line 936 "core/cfg.y"
+                                   { yyerror("int value expected"); }
+#line 6141 "core/cfg.tab.c"
+    break;
+
+  case 180: /* assign_stm: PORT EQUAL NUMBER  */
+#line 937 "core/cfg.y"
+                              { port_no=(yyvsp[0].intval); }
+#line 6147 "core/cfg.tab.c"
+    break;
+
+  case 181: /* assign_stm: MAXBUFFER EQUAL NUMBER  */
+#line 938 "core/cfg.y"
+                                 { maxbuffer=(yyvsp[0].intval); }
+#line 6153 "core/cfg.tab.c"
+    break;
+
+  case 182: /* assign_stm: MAXBUFFER EQUAL error  */
+#line 939 "core/cfg.y"
+                                { yyerror("number expected"); }
+#line 6159 "core/cfg.tab.c"
+    break;
+
+  case 183: /* assign_stm: SQL_BUFFER_SIZE EQUAL NUMBER  */
+#line 940 "core/cfg.y"
+                                   { sql_buffer_size=(yyvsp[0].intval); }
+#line 6165 "core/cfg.tab.c"
+    break;
+
+  case 184: /* assign_stm: SQL_BUFFER_SIZE EQUAL error  */
+#line 941 "core/cfg.y"
+                                      { yyerror("number expected"); }
+#line 6171 "core/cfg.tab.c"
+    break;
+
+  case 185: /* assign_stm: PORT EQUAL error  */
+#line 942 "core/cfg.y"
+                              { yyerror("number expected"); }
+#line 6177 "core/cfg.tab.c"
+    break;
+
+  case 186: /* assign_stm: CHILDREN EQUAL NUMBER  */
+#line 943 "core/cfg.y"
+                                { children_no=(yyvsp[0].intval); }
+#line 6183 "core/cfg.tab.c"
+    break;
+
+  case 187: /* assign_stm: CHILDREN EQUAL error  */
+#line 944 "core/cfg.y"
+                               { yyerror("number expected"); }
+#line 6189 "core/cfg.tab.c"
+    break;
+
+  case 188: /* assign_stm: STATS_NAMESEP EQUAL STRING  */
+#line 945 "core/cfg.y"
+                                     { ksr_stats_namesep=(yyvsp[0].strval); }
+#line 6195 "core/cfg.tab.c"
+    break;
+
+  case 189: /* assign_stm: STATS_NAMESEP EQUAL error  */
+#line 946 "core/cfg.y"
+                                    { yyerror("string value expected"); }
+#line 6201 "core/cfg.tab.c"
+    break;
+
+  case 190: /* assign_stm: SOCKET_WORKERS EQUAL NUMBER  */
+#line 947 "core/cfg.y"
+                                      { socket_workers=(yyvsp[0].intval); }
+#line 6207 "core/cfg.tab.c"
+    break;
+
+  case 191: /* assign_stm: SOCKET_WORKERS EQUAL error  */
+#line 948 "core/cfg.y"
+                                     { yyerror("number expected"); }
+#line 6213 "core/cfg.tab.c"
+    break;
+
+  case 192: /* assign_stm: ASYNC_WORKERS EQUAL NUMBER  */
+#line 949 "core/cfg.y"
+                                     { async_task_set_workers((yyvsp[0].intval)); }
+#line 6219 "core/cfg.tab.c"
+    break;
+
+  case 193: /* assign_stm: ASYNC_WORKERS EQUAL error  */
+#line 950 "core/cfg.y"
+                                    { yyerror("number expected"); }
+#line 6225 "core/cfg.tab.c"
+    break;
+
+  case 194: /* assign_stm: ASYNC_USLEEP EQUAL NUMBER  */
+#line 951 "core/cfg.y"
+                                    { async_task_set_usleep((yyvsp[0].intval)); }
+#line 6231 "core/cfg.tab.c"
+    break;
+
+  case 195: /* assign_stm: ASYNC_USLEEP EQUAL error  */
+#line 952 "core/cfg.y"
+                                   { yyerror("number expected"); }
+#line 6237 "core/cfg.tab.c"
+    break;
+
+  case 196: /* assign_stm: ASYNC_NONBLOCK EQUAL NUMBER  */
+#line 953 "core/cfg.y"
+                                      { async_task_set_nonblock((yyvsp[0].intval)); }
+#line 6243 "core/cfg.tab.c"
+    break;
+
+  case 197: /* assign_stm: ASYNC_NONBLOCK EQUAL error  */
+#line 954 "core/cfg.y"
+                                     { yyerror("number expected"); }
+#line 6249 "core/cfg.tab.c"
+    break;
+
+  case 198: /* assign_stm: ASYNC_WORKERS_GROUP EQUAL STRING  */
+#line 955 "core/cfg.y"
+                                           { async_task_set_workers_group((yyvsp[0].strval)); }
+#line 6255 "core/cfg.tab.c"
+    break;
+
+  case 199: /* assign_stm: ASYNC_WORKERS_GROUP EQUAL error  */
+#line 956 "core/cfg.y"
+                                          { yyerror("string expected"); }
+#line 6261 "core/cfg.tab.c"
+    break;
+
+  case 200: /* assign_stm: CHECK_VIA EQUAL NUMBER  */
+#line 957 "core/cfg.y"
+                                 { check_via=(yyvsp[0].intval); }
+#line 6267 "core/cfg.tab.c"
+    break;
+
+  case 201: /* assign_stm: CHECK_VIA EQUAL error  */
+#line 958 "core/cfg.y"
+                                { yyerror("boolean value expected"); }
+#line 6273 "core/cfg.tab.c"
+    break;
+
+  case 202: /* assign_stm: PHONE2TEL EQUAL NUMBER  */
+#line 959 "core/cfg.y"
+                                 { phone2tel=(yyvsp[0].intval); }
+#line 6279 "core/cfg.tab.c"
+    break;
+
+  case 203: /* assign_stm: PHONE2TEL EQUAL error  */
+#line 960 "core/cfg.y"
+                                { yyerror("boolean value expected"); }
+#line 6285 "core/cfg.tab.c"
+    break;
+
+  case 204: /* assign_stm: MEMLOG EQUAL intno  */
+#line 961 "core/cfg.y"
+                             { default_core_cfg.memlog=(yyvsp[0].intval); }
+#line 6291 "core/cfg.tab.c"
+    break;
+
+  case 205: /* assign_stm: MEMLOG EQUAL error  */
+#line 962 "core/cfg.y"
+                             { yyerror("int value expected"); }
+#line 6297 "core/cfg.tab.c"
+    break;
+
+  case 206: /* assign_stm: MEMDBG EQUAL intno  */
+#line 963 "core/cfg.y"
+                             { default_core_cfg.memdbg=(yyvsp[0].intval); }
+#line 6303 "core/cfg.tab.c"
+    break;
+
+  case 207: /* assign_stm: MEMDBG EQUAL error  */
+#line 964 "core/cfg.y"
+                             { yyerror("int value expected"); }
+#line 6309 "core/cfg.tab.c"
+    break;
+
+  case 208: /* assign_stm: MEMSUM EQUAL intno  */
+#line 965 "core/cfg.y"
+                             { default_core_cfg.mem_summary=(yyvsp[0].intval); }
+#line 6315 "core/cfg.tab.c"
+    break;
+
+  case 209: /* assign_stm: MEMSUM EQUAL error  */
+#line 966 "core/cfg.y"
+                             { yyerror("int value expected"); }
+#line 6321 "core/cfg.tab.c"
+    break;
+
+  case 210: /* assign_stm: MEMSAFETY EQUAL intno  */
+#line 967 "core/cfg.y"
+                                { default_core_cfg.mem_safety=(yyvsp[0].intval); }
+#line 6327 "core/cfg.tab.c"
+    break;
+
+  case 211: /* assign_stm: MEMSAFETY EQUAL error  */
+#line 968 "core/cfg.y"
+                                { yyerror("int value expected"); }
+#line 6333 "core/cfg.tab.c"
+    break;
+
+  case 212: /* assign_stm: MEMJOIN EQUAL intno  */
+#line 969 "core/cfg.y"
+                              { default_core_cfg.mem_join=(yyvsp[0].intval); }
+#line 6339 "core/cfg.tab.c"
+    break;
+
+  case 213: /* assign_stm: MEMJOIN EQUAL error  */
+#line 970 "core/cfg.y"
+                              { yyerror("int value expected"); }
+#line 6345 "core/cfg.tab.c"
+    break;
+
+  case 214: /* assign_stm: MEMSTATUSMODE EQUAL intno  */
+#line 971 "core/cfg.y"
+                                    { default_core_cfg.mem_status_mode=(yyvsp[0].intval); }
+#line 6351 "core/cfg.tab.c"
+    break;
+
+  case 215: /* assign_stm: MEMSTATUSMODE EQUAL error  */
+#line 972 "core/cfg.y"
+                                    { yyerror("int value expected"); }
+#line 6357 "core/cfg.tab.c"
+    break;
+
+  case 216: /* assign_stm: SIP_PARSER_LOG EQUAL intno  */
+#line 973 "core/cfg.y"
+                                     { default_core_cfg.sip_parser_log=(yyvsp[0].intval); }
+#line 6363 "core/cfg.tab.c"
+    break;
+
+  case 217: /* assign_stm: SIP_PARSER_LOG EQUAL error  */
+#line 974 "core/cfg.y"
+                                     { yyerror("int value expected"); }
+#line 6369 "core/cfg.tab.c"
+    break;
+
+  case 218: /* assign_stm: SIP_PARSER_MODE EQUAL intno  */
+#line 975 "core/cfg.y"
+                                      { ksr_sip_parser_mode=(yyvsp[0].intval); }
+#line 6375 "core/cfg.tab.c"
+    break;
+
+  case 219: /* assign_stm: SIP_PARSER_MODE EQUAL error  */
+#line 976 "core/cfg.y"
+                                      { yyerror("int value expected"); }
+#line 6381 "core/cfg.tab.c"
+    break;
+
+  case 220: /* assign_stm: CORELOG EQUAL intno  */
+#line 977 "core/cfg.y"
+                              { default_core_cfg.corelog=(yyvsp[0].intval); }
+#line 6387 "core/cfg.tab.c"
+    break;
+
+  case 221: /* assign_stm: CORELOG EQUAL error  */
+#line 978 "core/cfg.y"
+                              { yyerror("int value expected"); }
+#line 6393 "core/cfg.tab.c"
+    break;
+
+  case 222: /* assign_stm: SIP_WARNING EQUAL NUMBER  */
+#line 979 "core/cfg.y"
+                                   { sip_warning=(yyvsp[0].intval); }
+#line 6399 "core/cfg.tab.c"
+    break;
+
+  case 223: /* assign_stm: SIP_WARNING EQUAL error  */
+#line 980 "core/cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 6405 "core/cfg.tab.c"
+    break;
+
+  case 224: /* assign_stm: VERSION_TABLE_CFG EQUAL STRING  */
+#line 981 "core/cfg.y"
+                                         { version_table.s=(yyvsp[0].strval);
+			version_table.len=strlen(version_table.s);
+	}
+#line 6413 "core/cfg.tab.c"
+    break;
+
+  case 225: /* assign_stm: VERSION_TABLE_CFG EQUAL error  */
+#line 984 "core/cfg.y"
+                                        { yyerror("string value expected"); }
+#line 6419 "core/cfg.tab.c"
+    break;
+
+  case 226: /* assign_stm: USER EQUAL STRING  */
+#line 985 "core/cfg.y"
+                                {
+		if (shm_initialized())
+			yyerror("user must be before any modparam or the"
+					" route blocks");
+		else if (user==0)
+			user=(yyvsp[0].strval);
+	}
+#line 6431 "core/cfg.tab.c"
+    break;
+
+  case 227: /* assign_stm: USER EQUAL ID  */
+#line 992 "core/cfg.y"
+                                {
+		if (shm_initialized())
+			yyerror("user must be before any modparam or the"
+					" route blocks");
+		else if (user==0)
+			user=(yyvsp[0].strval);
+	}
+#line 6443 "core/cfg.tab.c"
+    break;
+
+  case 228: /* assign_stm: USER EQUAL error  */
+#line 999 "core/cfg.y"
+                                { yyerror("string value expected"); }
+#line 6449 "core/cfg.tab.c"
+    break;
+
+  case 229: /* assign_stm: GROUP EQUAL STRING  */
+#line 1000 "core/cfg.y"
+                                 { group=(yyvsp[0].strval); }
+#line 6455 "core/cfg.tab.c"
+    break;
+
+  case 230: /* assign_stm: GROUP EQUAL ID  */
+#line 1001 "core/cfg.y"
+                                 { group=(yyvsp[0].strval); }
+#line 6461 "core/cfg.tab.c"
+    break;
+
+  case 231: /* assign_stm: GROUP EQUAL error  */
+#line 1002 "core/cfg.y"
+                                 { yyerror("string value expected"); }
+#line 6467 "core/cfg.tab.c"
+    break;
+
+  case 232: /* assign_stm: CHROOT EQUAL STRING  */
+#line 1003 "core/cfg.y"
+                                  { chroot_dir=(yyvsp[0].strval); }
+#line 6473 "core/cfg.tab.c"
+    break;
+
+  case 233: /* assign_stm: CHROOT EQUAL ID  */
+#line 1004 "core/cfg.y"
+                                  { chroot_dir=(yyvsp[0].strval); }
+#line 6479 "core/cfg.tab.c"
+    break;
+
+  case 234: /* assign_stm: CHROOT EQUAL error  */
+#line 1005 "core/cfg.y"
+                                  { yyerror("string value expected"); }
+#line 6485 "core/cfg.tab.c"
+    break;
+
+  case 235: /* assign_stm: WDIR EQUAL STRING  */
+#line 1006 "core/cfg.y"
+                                { working_dir=(yyvsp[0].strval); }
+#line 6491 "core/cfg.tab.c"
+    break;
+
+  case 236: /* assign_stm: WDIR EQUAL ID  */
+#line 1007 "core/cfg.y"
+                                { working_dir=(yyvsp[0].strval); }
+#line 6497 "core/cfg.tab.c"
+    break;
+
+  case 237: /* assign_stm: WDIR EQUAL error  */
+#line 1008 "core/cfg.y"
+                                { yyerror("string value expected"); }
+#line 6503 "core/cfg.tab.c"
+    break;
+
+  case 238: /* assign_stm: RUNDIR EQUAL STRING  */
+#line 1009 "core/cfg.y"
+                                  { runtime_dir=(yyvsp[0].strval); }
+#line 6509 "core/cfg.tab.c"
+    break;
+
+  case 239: /* assign_stm: RUNDIR EQUAL ID  */
+#line 1010 "core/cfg.y"
+                                  { runtime_dir=(yyvsp[0].strval); }
+#line 6515 "core/cfg.tab.c"
+    break;
+
+  case 240: /* assign_stm: RUNDIR EQUAL error  */
+#line 1011 "core/cfg.y"
+                                  { yyerror("string value expected"); }
+#line 6521 "core/cfg.tab.c"
+    break;
+
+  case 241: /* assign_stm: MHOMED EQUAL NUMBER  */
+#line 1012 "core/cfg.y"
+                              { mhomed=(yyvsp[0].intval); }
+#line 6527 "core/cfg.tab.c"
+    break;
+
+  case 242: /* assign_stm: MHOMED EQUAL error  */
+#line 1013 "core/cfg.y"
+                             { yyerror("boolean value expected"); }
+#line 6533 "core/cfg.tab.c"
+    break;
+
+  case 243: /* assign_stm: DISABLE_TCP EQUAL NUMBER  */
+#line 1014 "core/cfg.y"
+                                   {
+		#ifdef USE_TCP
+			tcp_disable=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6545 "core/cfg.tab.c"
+    break;
+
+  case 244: /* assign_stm: DISABLE_TCP EQUAL error  */
+#line 1021 "core/cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 6551 "core/cfg.tab.c"
+    break;
+
+  case 245: /* assign_stm: TCP_ACCEPT_ALIASES EQUAL NUMBER  */
+#line 1022 "core/cfg.y"
+                                          {
+		#ifdef USE_TCP
+			tcp_default_cfg.accept_aliases=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6563 "core/cfg.tab.c"
+    break;
+
+  case 246: /* assign_stm: TCP_ACCEPT_ALIASES EQUAL error  */
+#line 1029 "core/cfg.y"
+                                         { yyerror("boolean value expected"); }
+#line 6569 "core/cfg.tab.c"
+    break;
+
+  case 247: /* assign_stm: TCP_ACCEPT_UNIQUE EQUAL NUMBER  */
+#line 1030 "core/cfg.y"
+                                         {
+		#ifdef USE_TCP
+			tcp_accept_unique=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6581 "core/cfg.tab.c"
+    break;
+
+  case 248: /* assign_stm: TCP_ACCEPT_UNIQUE EQUAL error  */
+#line 1037 "core/cfg.y"
+                                        { yyerror("number expected"); }
+#line 6587 "core/cfg.tab.c"
+    break;
+
+  case 249: /* assign_stm: TCP_CONNECTION_MATCH EQUAL NUMBER  */
+#line 1038 "core/cfg.y"
+                                            {
+		#ifdef USE_TCP
+			tcp_connection_match=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6599 "core/cfg.tab.c"
+    break;
+
+  case 250: /* assign_stm: TCP_CONNECTION_MATCH EQUAL error  */
+#line 1045 "core/cfg.y"
+                                           { yyerror("number expected"); }
+#line 6605 "core/cfg.tab.c"
+    break;
+
+  case 251: /* assign_stm: TCP_CHILDREN EQUAL NUMBER  */
+#line 1046 "core/cfg.y"
+                                    {
+		#ifdef USE_TCP
+			tcp_cfg_children_no=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6617 "core/cfg.tab.c"
+    break;
+
+  case 252: /* assign_stm: TCP_CHILDREN EQUAL error  */
+#line 1053 "core/cfg.y"
+                                   { yyerror("number expected"); }
+#line 6623 "core/cfg.tab.c"
+    break;
+
+  case 253: /* assign_stm: TCP_CONNECT_TIMEOUT EQUAL intno  */
+#line 1054 "core/cfg.y"
+                                          {
+		#ifdef USE_TCP
+			tcp_default_cfg.connect_timeout_s=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6635 "core/cfg.tab.c"
+    break;
+
+  case 254: /* assign_stm: TCP_CONNECT_TIMEOUT EQUAL error  */
+#line 1061 "core/cfg.y"
+                                          { yyerror("number expected"); }
+#line 6641 "core/cfg.tab.c"
+    break;
+
+  case 255: /* assign_stm: TCP_SEND_TIMEOUT EQUAL intno  */
+#line 1062 "core/cfg.y"
+                                       {
+		#ifdef USE_TCP
+			tcp_default_cfg.send_timeout=S_TO_TICKS((yyvsp[0].intval));
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6653 "core/cfg.tab.c"
+    break;
+
+  case 256: /* assign_stm: TCP_SEND_TIMEOUT EQUAL error  */
+#line 1069 "core/cfg.y"
+                                       { yyerror("number expected"); }
+#line 6659 "core/cfg.tab.c"
+    break;
+
+  case 257: /* assign_stm: TCP_CON_LIFETIME EQUAL intno  */
+#line 1070 "core/cfg.y"
+                                       {
+		#ifdef USE_TCP
+			if ((yyvsp[0].intval)<0)
+				tcp_default_cfg.con_lifetime=-1;
+			else
+				tcp_default_cfg.con_lifetime=S_TO_TICKS((yyvsp[0].intval));
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6674 "core/cfg.tab.c"
+    break;
+
+  case 258: /* assign_stm: TCP_CON_LIFETIME EQUAL error  */
+#line 1080 "core/cfg.y"
+                                       { yyerror("number expected"); }
+#line 6680 "core/cfg.tab.c"
+    break;
+
+  case 259: /* assign_stm: TCP_POLL_METHOD EQUAL ID  */
+#line 1081 "core/cfg.y"
+                                   {
+		#ifdef USE_TCP
+			tcp_poll_method=get_poll_type((yyvsp[0].strval));
+			if (tcp_poll_method==POLL_NONE) {
+				LOG(L_CRIT, "bad poll method name:"
+						" %s\n, try one of %s.\n",
+						(yyvsp[0].strval), poll_support);
+				yyerror("bad tcp_poll_method "
+						"value");
+			}
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6699 "core/cfg.tab.c"
+    break;
+
+  case 260: /* assign_stm: TCP_POLL_METHOD EQUAL STRING  */
+#line 1095 "core/cfg.y"
+                                       {
+		#ifdef USE_TCP
+			tcp_poll_method=get_poll_type((yyvsp[0].strval));
+			if (tcp_poll_method==POLL_NONE) {
+				LOG(L_CRIT, "bad poll method name:"
+						" %s\n, try one of %s.\n",
+						(yyvsp[0].strval), poll_support);
+				yyerror("bad tcp_poll_method "
+						"value");
+			}
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6718 "core/cfg.tab.c"
+    break;
+
+  case 261: /* assign_stm: TCP_POLL_METHOD EQUAL error  */
+#line 1109 "core/cfg.y"
+                                      { yyerror("poll method name expected"); }
+#line 6724 "core/cfg.tab.c"
+    break;
+
+  case 262: /* assign_stm: TCP_MAX_CONNECTIONS EQUAL NUMBER  */
+#line 1110 "core/cfg.y"
+                                           {
+		#ifdef USE_TCP
+			tcp_max_connections=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6736 "core/cfg.tab.c"
+    break;
+
+  case 263: /* assign_stm: TCP_MAX_CONNECTIONS EQUAL error  */
+#line 1117 "core/cfg.y"
+                                          { yyerror("number expected"); }
+#line 6742 "core/cfg.tab.c"
+    break;
+
+  case 264: /* assign_stm: TLS_MAX_CONNECTIONS EQUAL NUMBER  */
+#line 1118 "core/cfg.y"
+                                           {
+		#ifdef USE_TLS
+			tls_max_connections=(yyvsp[0].intval);
+		#else
+			warn("tls support not compiled in");
+		#endif
+	}
+#line 6754 "core/cfg.tab.c"
+    break;
+
+  case 265: /* assign_stm: TLS_MAX_CONNECTIONS EQUAL error  */
+#line 1125 "core/cfg.y"
+                                          { yyerror("number expected"); }
+#line 6760 "core/cfg.tab.c"
+    break;
+
+  case 266: /* assign_stm: TCP_NO_CONNECT EQUAL NUMBER  */
+#line 1126 "core/cfg.y"
+                                      {
+		#ifdef USE_TCP
+			tcp_default_cfg.no_connect=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6772 "core/cfg.tab.c"
+    break;
+
+  case 267: /* assign_stm: TCP_NO_CONNECT EQUAL error  */
+#line 1133 "core/cfg.y"
+                                     { yyerror("boolean value expected"); }
+#line 6778 "core/cfg.tab.c"
+    break;
+
+  case 268: /* assign_stm: TCP_SOURCE_IPV4 EQUAL ipv4  */
+#line 1134 "core/cfg.y"
+                                     {
+		#ifdef USE_TCP
+			if (tcp_set_src_addr((yyvsp[0].ipaddr))<0)
+				warn("tcp_source_ipv4 failed");
+		#else
+			warn("tcp support not compiled in");
+		#endif
+		pkg_free((yyvsp[0].ipaddr));
+	}
+#line 6792 "core/cfg.tab.c"
+    break;
+
+  case 269: /* assign_stm: TCP_SOURCE_IPV4 EQUAL error  */
+#line 1143 "core/cfg.y"
+                                      { yyerror("IPv4 address expected"); }
+#line 6798 "core/cfg.tab.c"
+    break;
+
+  case 270: /* assign_stm: TCP_SOURCE_IPV6 EQUAL ipv6  */
+#line 1144 "core/cfg.y"
+                                     {
+		#ifdef USE_TCP
+				if (tcp_set_src_addr((yyvsp[0].ipaddr))<0)
+					warn("tcp_source_ipv6 failed");
+		#else
+			warn("tcp support not compiled in");
+		#endif
+		pkg_free((yyvsp[0].ipaddr));
+	}
+#line 6812 "core/cfg.tab.c"
+    break;
+
+  case 271: /* assign_stm: TCP_SOURCE_IPV6 EQUAL error  */
+#line 1153 "core/cfg.y"
+                                      { yyerror("IPv6 address expected"); }
+#line 6818 "core/cfg.tab.c"
+    break;
+
+  case 272: /* assign_stm: TCP_OPT_FD_CACHE EQUAL NUMBER  */
+#line 1154 "core/cfg.y"
+                                        {
+		#ifdef USE_TCP
+			tcp_default_cfg.fd_cache=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6830 "core/cfg.tab.c"
+    break;
+
+  case 273: /* assign_stm: TCP_OPT_FD_CACHE EQUAL error  */
+#line 1161 "core/cfg.y"
+                                       { yyerror("boolean value expected"); }
+#line 6836 "core/cfg.tab.c"
+    break;
+
+  case 274: /* assign_stm: TCP_OPT_BUF_WRITE EQUAL NUMBER  */
+#line 1162 "core/cfg.y"
+                                         {
+		#ifdef USE_TCP
+			tcp_default_cfg.async=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6848 "core/cfg.tab.c"
+    break;
+
+  case 275: /* assign_stm: TCP_OPT_BUF_WRITE EQUAL error  */
+#line 1169 "core/cfg.y"
+                                        { yyerror("boolean value expected"); }
+#line 6854 "core/cfg.tab.c"
+    break;
+
+  case 276: /* assign_stm: TCP_OPT_CONN_WQ_MAX EQUAL NUMBER  */
+#line 1170 "core/cfg.y"
+                                           {
+		#ifdef USE_TCP
+			tcp_default_cfg.tcpconn_wq_max=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6866 "core/cfg.tab.c"
+    break;
+
+  case 277: /* assign_stm: TCP_OPT_CONN_WQ_MAX error  */
+#line 1177 "core/cfg.y"
+                                    { yyerror("boolean value expected"); }
+#line 6872 "core/cfg.tab.c"
+    break;
+
+  case 278: /* assign_stm: TCP_OPT_WQ_MAX EQUAL NUMBER  */
+#line 1178 "core/cfg.y"
+                                      {
+		#ifdef USE_TCP
+			tcp_default_cfg.tcp_wq_max=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6884 "core/cfg.tab.c"
+    break;
+
+  case 279: /* assign_stm: TCP_OPT_WQ_MAX error  */
+#line 1185 "core/cfg.y"
+                               { yyerror("number expected"); }
+#line 6890 "core/cfg.tab.c"
+    break;
+
+  case 280: /* assign_stm: TCP_OPT_RD_BUF EQUAL NUMBER  */
+#line 1186 "core/cfg.y"
+                                      {
+		#ifdef USE_TCP
+			tcp_default_cfg.rd_buf_size=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6902 "core/cfg.tab.c"
+    break;
+
+  case 281: /* assign_stm: TCP_OPT_RD_BUF error  */
+#line 1193 "core/cfg.y"
+                               { yyerror("number expected"); }
+#line 6908 "core/cfg.tab.c"
+    break;
+
+  case 282: /* assign_stm: TCP_OPT_WQ_BLK EQUAL NUMBER  */
+#line 1194 "core/cfg.y"
+                                      {
+		#ifdef USE_TCP
+			tcp_default_cfg.wq_blk_size=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6920 "core/cfg.tab.c"
+    break;
+
+  case 283: /* assign_stm: TCP_OPT_WQ_BLK error  */
+#line 1201 "core/cfg.y"
+                               { yyerror("number expected"); }
+#line 6926 "core/cfg.tab.c"
+    break;
+
+  case 284: /* assign_stm: TCP_OPT_DEFER_ACCEPT EQUAL NUMBER  */
+#line 1202 "core/cfg.y"
+                                            {
+		#ifdef USE_TCP
+			tcp_default_cfg.defer_accept=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6938 "core/cfg.tab.c"
+    break;
+
+  case 285: /* assign_stm: TCP_OPT_DEFER_ACCEPT EQUAL error  */
+#line 1209 "core/cfg.y"
+                                           { yyerror("boolean value expected"); }
+#line 6944 "core/cfg.tab.c"
+    break;
+
+  case 286: /* assign_stm: TCP_OPT_DELAYED_ACK EQUAL NUMBER  */
+#line 1210 "core/cfg.y"
+                                           {
+		#ifdef USE_TCP
+			tcp_default_cfg.delayed_ack=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6956 "core/cfg.tab.c"
+    break;
+
+  case 287: /* assign_stm: TCP_OPT_DELAYED_ACK EQUAL error  */
+#line 1217 "core/cfg.y"
+                                          { yyerror("boolean value expected"); }
+#line 6962 "core/cfg.tab.c"
+    break;
+
+  case 288: /* assign_stm: TCP_OPT_SYNCNT EQUAL NUMBER  */
+#line 1218 "core/cfg.y"
+                                      {
+		#ifdef USE_TCP
+			tcp_default_cfg.syncnt=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6974 "core/cfg.tab.c"
+    break;
+
+  case 289: /* assign_stm: TCP_OPT_SYNCNT EQUAL error  */
+#line 1225 "core/cfg.y"
+                                     { yyerror("number expected"); }
+#line 6980 "core/cfg.tab.c"
+    break;
+
+  case 290: /* assign_stm: TCP_OPT_LINGER2 EQUAL NUMBER  */
+#line 1226 "core/cfg.y"
+                                       {
+		#ifdef USE_TCP
+			tcp_default_cfg.linger2=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 6992 "core/cfg.tab.c"
+    break;
+
+  case 291: /* assign_stm: TCP_OPT_LINGER2 EQUAL error  */
+#line 1233 "core/cfg.y"
+                                      { yyerror("number expected"); }
+#line 6998 "core/cfg.tab.c"
+    break;
+
+  case 292: /* assign_stm: TCP_OPT_KEEPALIVE EQUAL NUMBER  */
+#line 1234 "core/cfg.y"
+                                         {
+		#ifdef USE_TCP
+			tcp_default_cfg.keepalive=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 7010 "core/cfg.tab.c"
+    break;
+
+  case 293: /* assign_stm: TCP_OPT_KEEPALIVE EQUAL error  */
+#line 1241 "core/cfg.y"
+                                        { yyerror("boolean value expected");}
+#line 7016 "core/cfg.tab.c"
+    break;
+
+  case 294: /* assign_stm: TCP_OPT_KEEPIDLE EQUAL NUMBER  */
+#line 1242 "core/cfg.y"
+                                        {
+		#ifdef USE_TCP
+			tcp_default_cfg.keepidle=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 7028 "core/cfg.tab.c"
+    break;
+
+  case 295: /* assign_stm: TCP_OPT_KEEPIDLE EQUAL error  */
+#line 1249 "core/cfg.y"
+                                       { yyerror("number expected"); }
+#line 7034 "core/cfg.tab.c"
+    break;
+
+  case 296: /* assign_stm: TCP_OPT_KEEPINTVL EQUAL NUMBER  */
+#line 1250 "core/cfg.y"
+                                         {
+		#ifdef USE_TCP
+			tcp_default_cfg.keepintvl=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 7046 "core/cfg.tab.c"
+    break;
+
+  case 297: /* assign_stm: TCP_OPT_KEEPINTVL EQUAL error  */
+#line 1257 "core/cfg.y"
+                                        { yyerror("number expected"); }
+#line 7052 "core/cfg.tab.c"
+    break;
+
+  case 298: /* assign_stm: TCP_OPT_KEEPCNT EQUAL NUMBER  */
+#line 1258 "core/cfg.y"
+                                       {
+		#ifdef USE_TCP
+			tcp_default_cfg.keepcnt=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 7064 "core/cfg.tab.c"
+    break;
+
+  case 299: /* assign_stm: TCP_OPT_KEEPCNT EQUAL error  */
+#line 1265 "core/cfg.y"
+                                      { yyerror("number expected"); }
+#line 7070 "core/cfg.tab.c"
+    break;
+
+  case 300: /* assign_stm: TCP_OPT_CRLF_PING EQUAL NUMBER  */
+#line 1266 "core/cfg.y"
+                                         {
+		#ifdef USE_TCP
+			tcp_default_cfg.crlf_ping=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 7082 "core/cfg.tab.c"
+    break;
+
+  case 301: /* assign_stm: TCP_OPT_CRLF_PING EQUAL error  */
+#line 1273 "core/cfg.y"
+                                        { yyerror("boolean value expected"); }
+#line 7088 "core/cfg.tab.c"
+    break;
+
+  case 302: /* assign_stm: TCP_OPT_ACCEPT_NO_CL EQUAL NUMBER  */
+#line 1274 "core/cfg.y"
+                                            {
+		#ifdef USE_TCP
+			tcp_default_cfg.accept_no_cl=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 7100 "core/cfg.tab.c"
+    break;
+
+  case 303: /* assign_stm: TCP_OPT_ACCEPT_NO_CL EQUAL error  */
+#line 1281 "core/cfg.y"
+                                           { yyerror("boolean value expected"); }
+#line 7106 "core/cfg.tab.c"
+    break;
+
+  case 304: /* assign_stm: TCP_OPT_ACCEPT_HEP3 EQUAL NUMBER  */
+#line 1282 "core/cfg.y"
+                                           {
+		#ifdef USE_TCP
+			ksr_tcp_accept_hep3=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 7118 "core/cfg.tab.c"
+    break;
+
+  case 305: /* assign_stm: TCP_OPT_ACCEPT_HEP3 EQUAL error  */
+#line 1289 "core/cfg.y"
+                                          { yyerror("boolean value expected"); }
+#line 7124 "core/cfg.tab.c"
+    break;
+
+  case 306: /* assign_stm: TCP_OPT_ACCEPT_HAPROXY EQUAL NUMBER  */
+#line 1290 "core/cfg.y"
+                                              {
+		#ifdef USE_TCP
+			ksr_tcp_accept_haproxy=(yyvsp[0].intval);
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 7136 "core/cfg.tab.c"
+    break;
+
+  case 307: /* assign_stm: TCP_OPT_ACCEPT_HAPROXY EQUAL error  */
+#line 1297 "core/cfg.y"
+                                             { yyerror("boolean value expected"); }
+#line 7142 "core/cfg.tab.c"
+    break;
+
+  case 308: /* assign_stm: TCP_CLONE_RCVBUF EQUAL NUMBER  */
+#line 1299 "core/cfg.y"
+                                        {
+		#ifdef USE_TCP
+			tcp_set_clone_rcvbuf((yyvsp[0].intval));
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 7154 "core/cfg.tab.c"
+    break;
+
+  case 309: /* assign_stm: TCP_CLONE_RCVBUF EQUAL error  */
+#line 1306 "core/cfg.y"
+                                       { yyerror("number expected"); }
+#line 7160 "core/cfg.tab.c"
+    break;
+
+  case 310: /* assign_stm: TCP_REUSE_PORT EQUAL NUMBER  */
+#line 1307 "core/cfg.y"
+                                      {
+		#ifdef USE_TCP
+		#ifdef SO_REUSEPORT
+			tcp_default_cfg.reuse_port=(yyvsp[0].intval);
+		#else
+			warn("support for SO_REUSEPORT not compiled in");
+		#endif
+		#else
+			warn("tcp support not compiled in");
+		#endif
+	}
+#line 7176 "core/cfg.tab.c"
+    break;
+
+  case 311: /* assign_stm: TCP_REUSE_PORT EQUAL error  */
+#line 1318 "core/cfg.y"
+                                     { yyerror("boolean value expected"); }
+#line 7182 "core/cfg.tab.c"
+    break;
+
+  case 312: /* assign_stm: DISABLE_TLS EQUAL NUMBER  */
+#line 1319 "core/cfg.y"
+                                   {
+		#ifdef USE_TLS
+			tls_disable=(yyvsp[0].intval);
+		#else
+			warn("tls support not compiled in");
+		#endif
+	}
+#line 7194 "core/cfg.tab.c"
+    break;
+
+  case 313: /* assign_stm: DISABLE_TLS EQUAL error  */
+#line 1326 "core/cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 7200 "core/cfg.tab.c"
+    break;
+
+  case 314: /* assign_stm: ENABLE_TLS EQUAL NUMBER  */
+#line 1327 "core/cfg.y"
+                                  {
+		#ifdef USE_TLS
+			tls_disable=!((yyvsp[0].intval));
+		#else
+			warn("tls support not compiled in");
+		#endif
+	}
+#line 7212 "core/cfg.tab.c"
+    break;
+
+  case 315: /* assign_stm: ENABLE_TLS EQUAL error  */
+#line 1334 "core/cfg.y"
+                                 { yyerror("boolean value expected"); }
+#line 7218 "core/cfg.tab.c"
+    break;
+
+  case 316: /* assign_stm: TLSLOG EQUAL NUMBER  */
+#line 1335 "core/cfg.y"
+                              {
+		#ifdef CORE_TLS
+			tls_log=(yyvsp[0].intval);
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 7230 "core/cfg.tab.c"
+    break;
+
+  case 317: /* assign_stm: TLSLOG EQUAL error  */
+#line 1342 "core/cfg.y"
+                             { yyerror("int value expected"); }
+#line 7236 "core/cfg.tab.c"
+    break;
+
+  case 318: /* assign_stm: TLS_PORT_NO EQUAL NUMBER  */
+#line 1343 "core/cfg.y"
+                                   {
+		#ifdef USE_TLS
+			tls_port_no=(yyvsp[0].intval);
+		#else
+			warn("tls support not compiled in");
+		#endif
+	}
+#line 7248 "core/cfg.tab.c"
+    break;
+
+  case 319: /* assign_stm: TLS_PORT_NO EQUAL error  */
+#line 1350 "core/cfg.y"
+                                  { yyerror("number expected"); }
+#line 7254 "core/cfg.tab.c"
+    break;
+
+  case 320: /* assign_stm: TLS_METHOD EQUAL SSLv23  */
+#line 1351 "core/cfg.y"
+                                  {
+		#ifdef CORE_TLS
+			tls_method=TLS_USE_SSLv23;
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 7266 "core/cfg.tab.c"
+    break;
+
+  case 321: /* assign_stm: TLS_METHOD EQUAL SSLv2  */
+#line 1358 "core/cfg.y"
+                                 {
+		#ifdef CORE_TLS
+			tls_method=TLS_USE_SSLv2;
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 7278 "core/cfg.tab.c"
+    break;
+
+  case 322: /* assign_stm: TLS_METHOD EQUAL SSLv3  */
+#line 1365 "core/cfg.y"
+                                 {
+		#ifdef CORE_TLS
+			tls_method=TLS_USE_SSLv3;
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 7290 "core/cfg.tab.c"
+    break;
+
+  case 323: /* assign_stm: TLS_METHOD EQUAL TLSv1  */
+#line 1372 "core/cfg.y"
+                                 {
+		#ifdef CORE_TLS
+			tls_method=TLS_USE_TLSv1;
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 7302 "core/cfg.tab.c"
+    break;
+
+  case 324: /* assign_stm: TLS_METHOD EQUAL error  */
+#line 1379 "core/cfg.y"
+                                 {
+		#ifdef CORE_TLS
+			yyerror("SSLv23, SSLv2, SSLv3 or TLSv1 expected");
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 7314 "core/cfg.tab.c"
+    break;
+
+  case 325: /* assign_stm: TLS_VERIFY EQUAL NUMBER  */
+#line 1386 "core/cfg.y"
+                                  {
+		#ifdef CORE_TLS
+			tls_verify_cert=(yyvsp[0].intval);
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 7326 "core/cfg.tab.c"
+    break;
+
+  case 326: /* assign_stm: TLS_VERIFY EQUAL error  */
+#line 1393 "core/cfg.y"
+                                 { yyerror("boolean value expected"); }
+#line 7332 "core/cfg.tab.c"
+    break;
+
+  case 327: /* assign_stm: TLS_REQUIRE_CERTIFICATE EQUAL NUMBER  */
+#line 1394 "core/cfg.y"
+                                               {
+		#ifdef CORE_TLS
+			tls_require_cert=(yyvsp[0].intval);
+		#else
+			warn( "tls-in-core support not compiled in");
+		#endif
+	}
+#line 7344 "core/cfg.tab.c"
+    break;
+
+  case 328: /* assign_stm: TLS_REQUIRE_CERTIFICATE EQUAL error  */
+#line 1401 "core/cfg.y"
+                                              { yyerror("boolean value expected"); }
+#line 7350 "core/cfg.tab.c"
+    break;
+
+  case 329: /* assign_stm: TLS_CERTIFICATE EQUAL STRING  */
+#line 1402 "core/cfg.y"
+                                       {
+		#ifdef CORE_TLS
+			tls_cert_file=(yyvsp[0].strval);
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 7362 "core/cfg.tab.c"
+    break;
+
+  case 330: /* assign_stm: TLS_CERTIFICATE EQUAL error  */
+#line 1409 "core/cfg.y"
+                                      { yyerror("string value expected"); }
+#line 7368 "core/cfg.tab.c"
+    break;
+
+  case 331: /* assign_stm: TLS_PRIVATE_KEY EQUAL STRING  */
+#line 1410 "core/cfg.y"
+                                       {
+		#ifdef CORE_TLS
+			tls_pkey_file=(yyvsp[0].strval);
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 7380 "core/cfg.tab.c"
+    break;
+
+  case 332: /* assign_stm: TLS_PRIVATE_KEY EQUAL error  */
+#line 1417 "core/cfg.y"
+                                      { yyerror("string value expected"); }
+#line 7386 "core/cfg.tab.c"
+    break;
+
+  case 333: /* assign_stm: TLS_CA_LIST EQUAL STRING  */
+#line 1418 "core/cfg.y"
+                                   {
+		#ifdef CORE_TLS
+			tls_ca_file=(yyvsp[0].strval);
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 7398 "core/cfg.tab.c"
+    break;
+
+  case 334: /* assign_stm: TLS_CA_LIST EQUAL error  */
+#line 1425 "core/cfg.y"
+                                  { yyerror("string value expected"); }
+#line 7404 "core/cfg.tab.c"
+    break;
+
+  case 335: /* assign_stm: TLS_HANDSHAKE_TIMEOUT EQUAL NUMBER  */
+#line 1426 "core/cfg.y"
+                                             {
+		#ifdef CORE_TLS
+			tls_handshake_timeout=(yyvsp[0].intval);
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 7416 "core/cfg.tab.c"
+    break;
+
+  case 336: /* assign_stm: TLS_HANDSHAKE_TIMEOUT EQUAL error  */
+#line 1433 "core/cfg.y"
+                                            { yyerror("number expected"); }
+#line 7422 "core/cfg.tab.c"
+    break;
+
+  case 337: /* assign_stm: TLS_SEND_TIMEOUT EQUAL NUMBER  */
+#line 1434 "core/cfg.y"
+                                        {
+		#ifdef CORE_TLS
+			tls_send_timeout=(yyvsp[0].intval);
+		#else
+			warn("tls-in-core support not compiled in");
+		#endif
+	}
+#line 7434 "core/cfg.tab.c"
+    break;
+
+  case 338: /* assign_stm: TLS_SEND_TIMEOUT EQUAL error  */
+#line 1441 "core/cfg.y"
+                                       { yyerror("number expected"); }
+#line 7440 "core/cfg.tab.c"
+    break;
+
+  case 339: /* assign_stm: DISABLE_SCTP EQUAL NUMBER  */
+#line 1442 "core/cfg.y"
+                                    {
+		#ifdef USE_SCTP
+			sctp_disable=(yyvsp[0].intval);
+		#else
+			warn("sctp support not compiled in");
+		#endif
+	}
+#line 7452 "core/cfg.tab.c"
+    break;
+
+  case 340: /* assign_stm: DISABLE_SCTP EQUAL error  */
+#line 1449 "core/cfg.y"
+                                   { yyerror("boolean value expected"); }
+#line 7458 "core/cfg.tab.c"
+    break;
+
+  case 341: /* assign_stm: ENABLE_SCTP EQUAL NUMBER  */
+#line 1450 "core/cfg.y"
+                                   {
+		#ifdef USE_SCTP
+			sctp_disable=((yyvsp[0].intval)<=1)?!(yyvsp[0].intval):(yyvsp[0].intval);
+		#else
+			warn("sctp support not compiled in");
+		#endif
+	}
+#line 7470 "core/cfg.tab.c"
+    break;
+
+  case 342: /* assign_stm: ENABLE_SCTP EQUAL error  */
+#line 1457 "core/cfg.y"
+                                  { yyerror("boolean or number expected"); }
+#line 7476 "core/cfg.tab.c"
+    break;
+
+  case 343: /* assign_stm: SCTP_CHILDREN EQUAL NUMBER  */
+#line 1458 "core/cfg.y"
+                                     {
+		#ifdef USE_SCTP
+			sctp_children_no=(yyvsp[0].intval);
+		#else
+			warn("sctp support not compiled in");
+		#endif
+	}
+#line 7488 "core/cfg.tab.c"
+    break;
+
+  case 344: /* assign_stm: SCTP_CHILDREN EQUAL error  */
+#line 1465 "core/cfg.y"
+                                    { yyerror("number expected"); }
+#line 7494 "core/cfg.tab.c"
+    break;
+
+  case 345: /* assign_stm: SERVER_SIGNATURE EQUAL NUMBER  */
+#line 1466 "core/cfg.y"
+                                        { server_signature=(yyvsp[0].intval); }
+#line 7500 "core/cfg.tab.c"
+    break;
+
+  case 346: /* assign_stm: SERVER_SIGNATURE EQUAL error  */
+#line 1467 "core/cfg.y"
+                                       { yyerror("boolean value expected"); }
+#line 7506 "core/cfg.tab.c"
+    break;
+
+  case 347: /* assign_stm: SERVER_HEADER EQUAL STRING  */
+#line 1468 "core/cfg.y"
+                                     { server_hdr.s=(yyvsp[0].strval);
+			server_hdr.len=strlen(server_hdr.s);
+	}
+#line 7514 "core/cfg.tab.c"
+    break;
+
+  case 348: /* assign_stm: SERVER_HEADER EQUAL error  */
+#line 1471 "core/cfg.y"
+                                    { yyerror("string value expected"); }
+#line 7520 "core/cfg.tab.c"
+    break;
+
+  case 349: /* assign_stm: USER_AGENT_HEADER EQUAL STRING  */
+#line 1472 "core/cfg.y"
+                                         { user_agent_hdr.s=(yyvsp[0].strval);
+			user_agent_hdr.len=strlen(user_agent_hdr.s);
+	}
+#line 7528 "core/cfg.tab.c"
+    break;
+
+  case 350: /* assign_stm: USER_AGENT_HEADER EQUAL error  */
+#line 1475 "core/cfg.y"
+                                        { yyerror("string value expected"); }
+#line 7534 "core/cfg.tab.c"
+    break;
+
+  case 351: /* assign_stm: URI_HOST_EXTRA_CHARS EQUAL STRING  */
+#line 1476 "core/cfg.y"
+                                            { _sr_uri_host_extra_chars=(yyvsp[0].strval); }
+#line 7540 "core/cfg.tab.c"
+    break;
+
+  case 352: /* assign_stm: URI_HOST_EXTRA_CHARS EQUAL error  */
+#line 1477 "core/cfg.y"
+                                           { yyerror("string value expected"); }
+#line 7546 "core/cfg.tab.c"
+    break;
+
+  case 353: /* assign_stm: HDR_NAME_EXTRA_CHARS EQUAL STRING  */
+#line 1478 "core/cfg.y"
+                                            { _ksr_hname_extra_chars=(unsigned char*)(yyvsp[0].strval); }
+#line 7552 "core/cfg.tab.c"
+    break;
+
+  case 354: /* assign_stm: HDR_NAME_EXTRA_CHARS EQUAL error  */
+#line 1479 "core/cfg.y"
+                                           { yyerror("string value expected"); }
+#line 7558 "core/cfg.tab.c"
+    break;
+
+  case 355: /* assign_stm: REPLY_TO_VIA EQUAL NUMBER  */
+#line 1480 "core/cfg.y"
+                                    { reply_to_via=(yyvsp[0].intval); }
+#line 7564 "core/cfg.tab.c"
+    break;
+
+  case 356: /* assign_stm: REPLY_TO_VIA EQUAL error  */
+#line 1481 "core/cfg.y"
+                                   { yyerror("boolean value expected"); }
+#line 7570 "core/cfg.tab.c"
+    break;
+
+  case 357: /* assign_stm: LISTEN EQUAL id_lst  */
+#line 1482 "core/cfg.y"
+                              {
+		for(lst_tmp=(yyvsp[0].sockid); lst_tmp; lst_tmp=lst_tmp->next) {
+			if (add_listen_iface(	lst_tmp->addr_lst->name,
+									lst_tmp->addr_lst->next,
+									lst_tmp->port, lst_tmp->proto,
+									lst_tmp->flags)!=0) {
+				LM_CRIT("cfg. parser: failed to add listen address\n");
+				break;
+			}
+		}
+		free_socket_id_lst((yyvsp[0].sockid));
+	}
+#line 7587 "core/cfg.tab.c"
+    break;
+
+  case 358: /* assign_stm: LISTEN EQUAL id_lst STRNAME STRING  */
+#line 1494 "core/cfg.y"
+                                             {
+		for(lst_tmp=(yyvsp[-2].sockid); lst_tmp; lst_tmp=lst_tmp->next) {
+			if (add_listen_iface_name(lst_tmp->addr_lst->name,
+									lst_tmp->addr_lst->next,
+									lst_tmp->port, lst_tmp->proto, (yyvsp[0].strval),
+									lst_tmp->flags)!=0) {
+				LM_CRIT("cfg. parser: failed to add listen address\n");
+				break;
+			}
+		}
+		free_socket_id_lst((yyvsp[-2].sockid));
+	}
+#line 7604 "core/cfg.tab.c"
+    break;
+
+  case 359: /* assign_stm: LISTEN EQUAL id_lst ADVERTISE listen_id COLON NUMBER  */
+#line 1506 "core/cfg.y"
+                                                               {
+		for(lst_tmp=(yyvsp[-4].sockid); lst_tmp; lst_tmp=lst_tmp->next) {
+			if (add_listen_advertise_iface(	lst_tmp->addr_lst->name,
+									lst_tmp->addr_lst->next,
+									lst_tmp->port, lst_tmp->proto,
+									(yyvsp[-2].strval), (yyvsp[0].intval),
+									lst_tmp->flags)!=0) {
+				LM_CRIT("cfg. parser: failed to add listen address\n");
+				break;
+			}
+		}
+		free_socket_id_lst((yyvsp[-4].sockid));
+	}
+#line 7622 "core/cfg.tab.c"
+    break;
+
+  case 360: /* assign_stm: LISTEN EQUAL id_lst ADVERTISE listen_id COLON NUMBER STRNAME STRING  */
+#line 1519 "core/cfg.y"
+                                                                              {
+		for(lst_tmp=(yyvsp[-6].sockid); lst_tmp; lst_tmp=lst_tmp->next) {
+			if (add_listen_advertise_iface_name(lst_tmp->addr_lst->name,
+									lst_tmp->addr_lst->next,
+									lst_tmp->port, lst_tmp->proto,
+									(yyvsp[-4].strval), (yyvsp[-2].intval), (yyvsp[0].strval),
+									lst_tmp->flags)!=0) {
+				LM_CRIT("cfg. parser: failed to add listen address\n");
+				break;
+			}
+		}
+		free_socket_id_lst((yyvsp[-6].sockid));
+	}
+#line 7640 "core/cfg.tab.c"
+    break;
+
+  case 361: /* assign_stm: LISTEN EQUAL id_lst ADVERTISE listen_id  */
+#line 1532 "core/cfg.y"
+                                                  {
+		for(lst_tmp=(yyvsp[-2].sockid); lst_tmp; lst_tmp=lst_tmp->next) {
+			if (add_listen_advertise_iface(	lst_tmp->addr_lst->name,
+									lst_tmp->addr_lst->next,
+									lst_tmp->port, lst_tmp->proto,
+									(yyvsp[0].strval), 0,
+									lst_tmp->flags)!=0) {
+				LM_CRIT("cfg. parser: failed to add listen address\n");
+				break;
+			}
+		}
+		free_socket_id_lst((yyvsp[-2].sockid));
+	}
+#line 7658 "core/cfg.tab.c"
+    break;
+
+  case 362: /* assign_stm: LISTEN EQUAL id_lst ADVERTISE listen_id STRNAME STRING  */
+#line 1545 "core/cfg.y"
+                                                                 {
+		for(lst_tmp=(yyvsp[-4].sockid); lst_tmp; lst_tmp=lst_tmp->next) {
+			if (add_listen_advertise_iface_name(lst_tmp->addr_lst->name,
+									lst_tmp->addr_lst->next,
+									lst_tmp->port, lst_tmp->proto,
+									(yyvsp[-2].strval), 0, (yyvsp[0].strval),
+									lst_tmp->flags)!=0) {
+				LM_CRIT("cfg. parser: failed to add listen address\n");
+				break;
+			}
+		}
+		free_socket_id_lst((yyvsp[-4].sockid));
+	}
+#line 7676 "core/cfg.tab.c"
+    break;
+
+  case 363: /* assign_stm: LISTEN EQUAL error  */
+#line 1558 "core/cfg.y"
+                              { yyerror("ip address, interface name or"
+									" hostname expected"); }
+#line 7683 "core/cfg.tab.c"
+    break;
+
+  case 364: /* assign_stm: ALIAS EQUAL id_lst  */
+#line 1560 "core/cfg.y"
+                              {
+		for(lst_tmp=(yyvsp[0].sockid); lst_tmp; lst_tmp=lst_tmp->next){
+			add_alias(	lst_tmp->addr_lst->name,
+						strlen(lst_tmp->addr_lst->name),
+						lst_tmp->port, lst_tmp->proto);
+			for (nl_tmp=lst_tmp->addr_lst->next; nl_tmp; nl_tmp=nl_tmp->next)
+				add_alias(nl_tmp->name, strlen(nl_tmp->name),
+							lst_tmp->port, lst_tmp->proto);
+		}
+		free_socket_id_lst((yyvsp[0].sockid));
+	}
+#line 7699 "core/cfg.tab.c"
+    break;
+
+  case 365: /* assign_stm: ALIAS EQUAL error  */
+#line 1571 "core/cfg.y"
+                              { yyerror("hostname expected"); }
+#line 7705 "core/cfg.tab.c"
+    break;
+
+  case 366: /* assign_stm: SR_AUTO_ALIASES EQUAL NUMBER  */
+#line 1572 "core/cfg.y"
+                                       { sr_auto_aliases=(yyvsp[0].intval); }
+#line 7711 "core/cfg.tab.c"
+    break;
+
+  case 367: /* assign_stm: SR_AUTO_ALIASES EQUAL error  */
+#line 1573 "core/cfg.y"
+                                       { yyerror("boolean value expected"); }
+#line 7717 "core/cfg.tab.c"
+    break;
+
+  case 368: /* assign_stm: ADVERTISED_ADDRESS EQUAL listen_id  */
+#line 1574 "core/cfg.y"
+                                             {
+		if ((yyvsp[0].strval)){
+			default_global_address.s=(yyvsp[0].strval);
+			default_global_address.len=strlen((yyvsp[0].strval));
+		}
+	}
+#line 7728 "core/cfg.tab.c"
+    break;
+
+  case 369: /* assign_stm: ADVERTISED_ADDRESS EQUAL error  */
+#line 1580 "core/cfg.y"
+                                         {yyerror("ip address or hostname expected"); }
+#line 7734 "core/cfg.tab.c"
+    break;
+
+  case 370: /* assign_stm: ADVERTISED_PORT EQUAL NUMBER  */
+#line 1581 "core/cfg.y"
+                                       {
+		tmp=int2str((yyvsp[0].intval), &i_tmp);
+		if ((default_global_port.s=pkg_malloc(i_tmp))==0) {
+			PKG_MEM_CRITICAL;
+			default_global_port.len=0;
+		} else {
+			default_global_port.len=i_tmp;
+			memcpy(default_global_port.s, tmp, default_global_port.len);
+		};
+	}
+#line 7749 "core/cfg.tab.c"
+    break;
+
+  case 371: /* assign_stm: ADVERTISED_PORT EQUAL error  */
+#line 1591 "core/cfg.y"
+                                     {yyerror("ip address or hostname expected"); }
+#line 7755 "core/cfg.tab.c"
+    break;
+
+  case 372: /* assign_stm: DISABLE_CORE EQUAL NUMBER  */
+#line 1592 "core/cfg.y"
+                                    { disable_core_dump=(yyvsp[0].intval); }
+#line 7761 "core/cfg.tab.c"
+    break;
+
+  case 373: /* assign_stm: DISABLE_CORE EQUAL error  */
+#line 1593 "core/cfg.y"
+                                   { yyerror("boolean value expected"); }
+#line 7767 "core/cfg.tab.c"
+    break;
+
+  case 374: /* assign_stm: OPEN_FD_LIMIT EQUAL NUMBER  */
+#line 1594 "core/cfg.y"
+                                     { open_files_limit=(yyvsp[0].intval); }
+#line 7773 "core/cfg.tab.c"
+    break;
+
+  case 375: /* assign_stm: OPEN_FD_LIMIT EQUAL error  */
+#line 1595 "core/cfg.y"
+                                    { yyerror("number expected"); }
+#line 7779 "core/cfg.tab.c"
+    break;
+
+  case 376: /* assign_stm: SHM_MEM_SZ EQUAL NUMBER  */
+#line 1596 "core/cfg.y"
+                                  {
+		if (shm_initialized())
+			yyerror("shm/shm_mem_size must be before any modparam or the"
+					" route blocks");
+		else if (shm_mem_size == 0 || shm_mem_size == SHM_MEM_POOL_SIZE)
+			shm_mem_size=(yyvsp[0].intval) * 1024 * 1024;
+	}
+#line 7791 "core/cfg.tab.c"
+    break;
+
+  case 377: /* assign_stm: SHM_MEM_SZ EQUAL error  */
+#line 1603 "core/cfg.y"
+                                 { yyerror("number expected"); }
+#line 7797 "core/cfg.tab.c"
+    break;
+
+  case 378: /* assign_stm: SHM_FORCE_ALLOC EQUAL NUMBER  */
+#line 1604 "core/cfg.y"
+                                       {
+		if (shm_initialized())
+			yyerror("shm_force_alloc must be before any modparam or the"
+					" route blocks");
+		else
+			shm_force_alloc=(yyvsp[0].intval);
+	}
+#line 7809 "core/cfg.tab.c"
+    break;
+
+  case 379: /* assign_stm: SHM_FORCE_ALLOC EQUAL error  */
+#line 1611 "core/cfg.y"
+                                      { yyerror("boolean value expected"); }
+#line 7815 "core/cfg.tab.c"
+    break;
+
+  case 380: /* assign_stm: MLOCK_PAGES EQUAL NUMBER  */
+#line 1612 "core/cfg.y"
+                                   { mlock_pages=(yyvsp[0].intval); }
+#line 7821 "core/cfg.tab.c"
+    break;
+
+  case 381: /* assign_stm: MLOCK_PAGES EQUAL error  */
+#line 1613 "core/cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 7827 "core/cfg.tab.c"
+    break;
+
+  case 382: /* assign_stm: REAL_TIME EQUAL NUMBER  */
+#line 1614 "core/cfg.y"
+                                 { real_time=(yyvsp[0].intval); }
+#line 7833 "core/cfg.tab.c"
+    break;
+
+  case 383: /* assign_stm: REAL_TIME EQUAL error  */
+#line 1615 "core/cfg.y"
+                                { yyerror("boolean value expected"); }
+#line 7839 "core/cfg.tab.c"
+    break;
+
+  case 384: /* assign_stm: RT_PRIO EQUAL NUMBER  */
+#line 1616 "core/cfg.y"
+                               { rt_prio=(yyvsp[0].intval); }
+#line 7845 "core/cfg.tab.c"
+    break;
+
+  case 385: /* assign_stm: RT_PRIO EQUAL error  */
+#line 1617 "core/cfg.y"
+                              { yyerror("boolean value expected"); }
+#line 7851 "core/cfg.tab.c"
+    break;
+
+  case 386: /* assign_stm: RT_POLICY EQUAL NUMBER  */
+#line 1618 "core/cfg.y"
+                                 { rt_policy=(yyvsp[0].intval); }
+#line 7857 "core/cfg.tab.c"
+    break;
+
+  case 387: /* assign_stm: RT_POLICY EQUAL error  */
+#line 1619 "core/cfg.y"
+                                { yyerror("boolean value expected"); }
+#line 7863 "core/cfg.tab.c"
+    break;
+
+  case 388: /* assign_stm: RT_TIMER1_PRIO EQUAL NUMBER  */
+#line 1620 "core/cfg.y"
+                                      { rt_timer1_prio=(yyvsp[0].intval); }
+#line 7869 "core/cfg.tab.c"
+    break;
+
+  case 389: /* assign_stm: RT_TIMER1_PRIO EQUAL error  */
+#line 1621 "core/cfg.y"
+                                     { yyerror("boolean value expected"); }
+#line 7875 "core/cfg.tab.c"
+    break;
+
+  case 390: /* assign_stm: RT_TIMER1_POLICY EQUAL NUMBER  */
+#line 1622 "core/cfg.y"
+                                        { rt_timer1_policy=(yyvsp[0].intval); }
+#line 7881 "core/cfg.tab.c"
+    break;
+
+  case 391: /* assign_stm: RT_TIMER1_POLICY EQUAL error  */
+#line 1623 "core/cfg.y"
+                                       { yyerror("boolean value expected"); }
+#line 7887 "core/cfg.tab.c"
+    break;
+
+  case 392: /* assign_stm: RT_TIMER2_PRIO EQUAL NUMBER  */
+#line 1624 "core/cfg.y"
+                                      { rt_timer2_prio=(yyvsp[0].intval); }
+#line 7893 "core/cfg.tab.c"
+    break;
+
+  case 393: /* assign_stm: RT_TIMER2_PRIO EQUAL error  */
+#line 1625 "core/cfg.y"
+                                     { yyerror("boolean value expected"); }
+#line 7899 "core/cfg.tab.c"
+    break;
+
+  case 394: /* assign_stm: RT_TIMER2_POLICY EQUAL NUMBER  */
+#line 1626 "core/cfg.y"
+                                        { rt_timer2_policy=(yyvsp[0].intval); }
+#line 7905 "core/cfg.tab.c"
+    break;
+
+  case 395: /* assign_stm: RT_TIMER2_POLICY EQUAL error  */
+#line 1627 "core/cfg.y"
+                                       { yyerror("boolean value expected"); }
+#line 7911 "core/cfg.tab.c"
+    break;
+
+  case 396: /* assign_stm: MCAST_LOOPBACK EQUAL NUMBER  */
+#line 1628 "core/cfg.y"
+                                      {
+		#ifdef USE_MCAST
+			mcast_loopback=(yyvsp[0].intval);
+		#else
+			warn("no multicast support compiled in");
+		#endif
+	}
+#line 7923 "core/cfg.tab.c"
+    break;
+
+  case 397: /* assign_stm: MCAST_LOOPBACK EQUAL error  */
+#line 1635 "core/cfg.y"
+                                     { yyerror("boolean value expected"); }
+#line 7929 "core/cfg.tab.c"
+    break;
+
+  case 398: /* assign_stm: MCAST_TTL EQUAL NUMBER  */
+#line 1636 "core/cfg.y"
+                                 {
+		#ifdef USE_MCAST
+			mcast_ttl=(yyvsp[0].intval);
+		#else
+			warn("no multicast support compiled in");
+		#endif
+	}
+#line 7941 "core/cfg.tab.c"
+    break;
+
+  case 399: /* assign_stm: MCAST_TTL EQUAL error  */
+#line 1643 "core/cfg.y"
+                                { yyerror("number expected"); }
+#line 7947 "core/cfg.tab.c"
+    break;
+
+  case 400: /* assign_stm: MCAST EQUAL ID  */
+#line 1644 "core/cfg.y"
+                         {
+		#ifdef USE_MCAST
+			mcast=(yyvsp[0].strval);
+		#else
+			warn("no multicast support compiled in");
+		#endif
+	}
+#line 7959 "core/cfg.tab.c"
+    break;
+
+  case 401: /* assign_stm: MCAST EQUAL STRING  */
+#line 1651 "core/cfg.y"
+                             {
+		#ifdef USE_MCAST
+			mcast=(yyvsp[0].strval);
+		#else
+			warn("no multicast support compiled in");
+		#endif
+	}
+#line 7971 "core/cfg.tab.c"
+    break;
+
+  case 402: /* assign_stm: MCAST EQUAL error  */
+#line 1658 "core/cfg.y"
+                            { yyerror("string expected"); }
+#line 7977 "core/cfg.tab.c"
+    break;
+
+  case 403: /* assign_stm: TOS EQUAL NUMBER  */
+#line 1659 "core/cfg.y"
+                           { tos=(yyvsp[0].intval); }
+#line 7983 "core/cfg.tab.c"
+    break;
+
+  case 404: /* assign_stm: TOS EQUAL ID  */
+#line 1660 "core/cfg.y"
+                       { if (strcasecmp((yyvsp[0].strval),"IPTOS_LOWDELAY")) {
+			tos=IPTOS_LOWDELAY;
+		} else if (strcasecmp((yyvsp[0].strval),"IPTOS_THROUGHPUT")) {
+			tos=IPTOS_THROUGHPUT;
+		} else if (strcasecmp((yyvsp[0].strval),"IPTOS_RELIABILITY")) {
+			tos=IPTOS_RELIABILITY;
+#if defined(IPTOS_MINCOST)
+		} else if (strcasecmp((yyvsp[0].strval),"IPTOS_MINCOST")) {
+			tos=IPTOS_MINCOST;
+#endif
+#if defined(IPTOS_LOWCOST)
+		} else if (strcasecmp((yyvsp[0].strval),"IPTOS_LOWCOST")) {
+			tos=IPTOS_LOWCOST;
+#endif
+		} else {
+			yyerror("invalid tos value - allowed: "
+				"IPTOS_LOWDELAY,IPTOS_THROUGHPUT,"
+				"IPTOS_RELIABILITY"
+#if defined(IPTOS_LOWCOST)
+				",IPTOS_LOWCOST"
+#endif
+#if !defined(IPTOS_MINCOST)
+				",IPTOS_MINCOST"
+#endif
+				"\n");
+		}
+	}
+#line 8015 "core/cfg.tab.c"
+    break;
+
+  case 405: /* assign_stm: TOS EQUAL error  */
+#line 1687 "core/cfg.y"
+                          { yyerror("number expected"); }
+#line 8021 "core/cfg.tab.c"
+    break;
+
+  case 406: /* assign_stm: PMTU_DISCOVERY EQUAL NUMBER  */
+#line 1688 "core/cfg.y"
+                                      { pmtu_discovery=(yyvsp[0].intval); }
+#line 8027 "core/cfg.tab.c"
+    break;
+
+  case 407: /* assign_stm: PMTU_DISCOVERY error  */
+#line 1689 "core/cfg.y"
+                               { yyerror("number expected"); }
+#line 8033 "core/cfg.tab.c"
+    break;
+
+  case 408: /* assign_stm: KILL_TIMEOUT EQUAL NUMBER  */
+#line 1690 "core/cfg.y"
+                                    { ser_kill_timeout=(yyvsp[0].intval); }
+#line 8039 "core/cfg.tab.c"
+    break;
+
+  case 409: /* assign_stm: KILL_TIMEOUT EQUAL error  */
+#line 1691 "core/cfg.y"
+                                   { yyerror("number expected"); }
+#line 8045 "core/cfg.tab.c"
+    break;
+
+  case 410: /* assign_stm: MAX_WLOOPS EQUAL NUMBER  */
+#line 1692 "core/cfg.y"
+                                  { default_core_cfg.max_while_loops=(yyvsp[0].intval); }
+#line 8051 "core/cfg.tab.c"
+    break;
+
+  case 411: /* assign_stm: MAX_WLOOPS EQUAL error  */
+#line 1693 "core/cfg.y"
+                                 { yyerror("number expected"); }
+#line 8057 "core/cfg.tab.c"
+    break;
+
+  case 412: /* assign_stm: PVBUFSIZE EQUAL NUMBER  */
+#line 1694 "core/cfg.y"
+                                 { pv_set_buffer_size((yyvsp[0].intval)); }
+#line 8063 "core/cfg.tab.c"
+    break;
+
+  case 413: /* assign_stm: PVBUFSIZE EQUAL error  */
+#line 1695 "core/cfg.y"
+                                { yyerror("number expected"); }
+#line 8069 "core/cfg.tab.c"
+    break;
+
+  case 414: /* assign_stm: PVBUFSLOTS EQUAL NUMBER  */
+#line 1696 "core/cfg.y"
+                                  { pv_set_buffer_slots((yyvsp[0].intval)); }
+#line 8075 "core/cfg.tab.c"
+    break;
+
+  case 415: /* assign_stm: PVBUFSLOTS EQUAL error  */
+#line 1697 "core/cfg.y"
+                                 { yyerror("number expected"); }
+#line 8081 "core/cfg.tab.c"
+    break;
+
+  case 416: /* assign_stm: PVCACHELIMIT EQUAL NUMBER  */
+#line 1698 "core/cfg.y"
+                                    { default_core_cfg.pv_cache_limit=(yyvsp[0].intval); }
+#line 8087 "core/cfg.tab.c"
+    break;
+
+  case 417: /* assign_stm: PVCACHELIMIT EQUAL error  */
+#line 1699 "core/cfg.y"
+                                   { yyerror("number expected"); }
+#line 8093 "core/cfg.tab.c"
+    break;
+
+  case 418: /* assign_stm: PVCACHEACTION EQUAL NUMBER  */
+#line 1700 "core/cfg.y"
+                                     { default_core_cfg.pv_cache_action=(yyvsp[0].intval); }
+#line 8099 "core/cfg.tab.c"
+    break;
+
+  case 419: /* assign_stm: PVCACHEACTION EQUAL error  */
+#line 1701 "core/cfg.y"
+                                    { yyerror("number expected"); }
+#line 8105 "core/cfg.tab.c"
+    break;
+
+  case 420: /* assign_stm: HTTP_REPLY_PARSE EQUAL NUMBER  */
+#line 1702 "core/cfg.y"
+                                        { http_reply_parse=(yyvsp[0].intval); }
+#line 8111 "core/cfg.tab.c"
+    break;
+
+  case 421: /* assign_stm: HTTP_REPLY_PARSE EQUAL error  */
+#line 1703 "core/cfg.y"
+                                       { yyerror("boolean value expected"); }
+#line 8117 "core/cfg.tab.c"
+    break;
+
+  case 422: /* assign_stm: VERBOSE_STARTUP EQUAL NUMBER  */
+#line 1704 "core/cfg.y"
+                                       { ksr_verbose_startup=(yyvsp[0].intval); }
+#line 8123 "core/cfg.tab.c"
+    break;
+
+  case 423: /* assign_stm: VERBOSE_STARTUP EQUAL error  */
+#line 1705 "core/cfg.y"
+                                      { yyerror("boolean value expected"); }
+#line 8129 "core/cfg.tab.c"
+    break;
+
+  case 424: /* assign_stm: ROUTE_LOCKS_SIZE EQUAL NUMBER  */
+#line 1706 "core/cfg.y"
+                                        { ksr_route_locks_size=(yyvsp[0].intval); }
+#line 8135 "core/cfg.tab.c"
+    break;
+
+  case 425: /* assign_stm: ROUTE_LOCKS_SIZE EQUAL error  */
+#line 1707 "core/cfg.y"
+                                       { yyerror("number expected"); }
+#line 8141 "core/cfg.tab.c"
+    break;
+
+  case 426: /* assign_stm: WAIT_WORKER1_MODE EQUAL NUMBER  */
+#line 1708 "core/cfg.y"
+                                         { ksr_wait_worker1_mode=(yyvsp[0].intval); }
+#line 8147 "core/cfg.tab.c"
+    break;
+
+  case 427: /* assign_stm: WAIT_WORKER1_MODE EQUAL error  */
+#line 1709 "core/cfg.y"
+                                        { yyerror("number expected"); }
+#line 8153 "core/cfg.tab.c"
+    break;
+
+  case 428: /* assign_stm: WAIT_WORKER1_TIME EQUAL NUMBER  */
+#line 1710 "core/cfg.y"
+                                         { ksr_wait_worker1_time=(yyvsp[0].intval); }
+#line 8159 "core/cfg.tab.c"
+    break;
+
+  case 429: /* assign_stm: WAIT_WORKER1_TIME EQUAL error  */
+#line 1711 "core/cfg.y"
+                                        { yyerror("number expected"); }
+#line 8165 "core/cfg.tab.c"
+    break;
+
+  case 430: /* assign_stm: WAIT_WORKER1_USLEEP EQUAL NUMBER  */
+#line 1712 "core/cfg.y"
+                                           { ksr_wait_worker1_usleep=(yyvsp[0].intval); }
+#line 8171 "core/cfg.tab.c"
+    break;
+
+  case 431: /* assign_stm: WAIT_WORKER1_USLEEP EQUAL error  */
+#line 1713 "core/cfg.y"
+                                          { yyerror("number expected"); }
+#line 8177 "core/cfg.tab.c"
+    break;
+
+  case 432: /* assign_stm: SERVER_ID EQUAL NUMBER  */
+#line 1714 "core/cfg.y"
+                             { server_id=(yyvsp[0].intval); }
+#line 8183 "core/cfg.tab.c"
+    break;
+
+  case 433: /* assign_stm: SERVER_ID EQUAL error  */
+#line 1715 "core/cfg.y"
+                                 { yyerror("number expected"); }
+#line 8189 "core/cfg.tab.c"
+    break;
+
+  case 434: /* assign_stm: KEMI DOT ONSEND_ROUTE_CALLBACK EQUAL STRING  */
+#line 1716 "core/cfg.y"
+                                                      {
+			kemi_onsend_route_callback.s = (yyvsp[0].strval);
+			kemi_onsend_route_callback.len = strlen((yyvsp[0].strval));
+			if(kemi_onsend_route_callback.len==4
+					&& strcasecmp(kemi_onsend_route_callback.s, "none")==0) {
+				kemi_onsend_route_callback.s = "";
+				kemi_onsend_route_callback.len = 0;
+			}
+		}
+#line 8203 "core/cfg.tab.c"
+    break;
+
+  case 435: /* assign_stm: KEMI DOT ONSEND_ROUTE_CALLBACK EQUAL error  */
+#line 1725 "core/cfg.y"
+                                                     { yyerror("string expected"); }
+#line 8209 "core/cfg.tab.c"
+    break;
+
+  case 436: /* assign_stm: KEMI DOT REPLY_ROUTE_CALLBACK EQUAL STRING  */
+#line 1726 "core/cfg.y"
+                                                     {
+			kemi_reply_route_callback.s = (yyvsp[0].strval);
+			kemi_reply_route_callback.len = strlen((yyvsp[0].strval));
+			if(kemi_reply_route_callback.len==4
+					&& strcasecmp(kemi_reply_route_callback.s, "none")==0) {
+				kemi_reply_route_callback.s = "";
+				kemi_reply_route_callback.len = 0;
+			}
+		}
+#line 8223 "core/cfg.tab.c"
+    break;
+
+  case 437: /* assign_stm: KEMI DOT REPLY_ROUTE_CALLBACK EQUAL error  */
+#line 1735 "core/cfg.y"
+                                                    { yyerror("string expected"); }
+#line 8229 "core/cfg.tab.c"
+    break;
+
+  case 438: /* assign_stm: KEMI DOT EVENT_ROUTE_CALLBACK EQUAL STRING  */
+#line 1736 "core/cfg.y"
+                                                     {
+			kemi_event_route_callback.s = (yyvsp[0].strval);
+			kemi_event_route_callback.len = strlen((yyvsp[0].strval));
+			if(kemi_event_route_callback.len==4
+					&& strcasecmp(kemi_event_route_callback.s, "none")==0) {
+				kemi_event_route_callback.s = "";
+				kemi_event_route_callback.len = 0;
+			}
+		}
+#line 8243 "core/cfg.tab.c"
+    break;
+
+  case 439: /* assign_stm: KEMI DOT EVENT_ROUTE_CALLBACK EQUAL error  */
+#line 1745 "core/cfg.y"
+                                                    { yyerror("string expected"); }
+#line 8249 "core/cfg.tab.c"
+    break;
+
+  case 440: /* assign_stm: KEMI DOT RECEIVED_ROUTE_CALLBACK EQUAL STRING  */
+#line 1746 "core/cfg.y"
+                                                        {
+			kemi_received_route_callback.s = (yyvsp[0].strval);
+			kemi_received_route_callback.len = strlen((yyvsp[0].strval));
+			if(kemi_received_route_callback.len==4
+					&& strcasecmp(kemi_received_route_callback.s, "none")==0) {
+				kemi_received_route_callback.s = "";
+				kemi_received_route_callback.len = 0;
+			}
+		}
+#line 8263 "core/cfg.tab.c"
+    break;
+
+  case 441: /* assign_stm: KEMI DOT RECEIVED_ROUTE_CALLBACK EQUAL error  */
+#line 1755 "core/cfg.y"
+                                                       { yyerror("string expected"); }
+#line 8269 "core/cfg.tab.c"
+    break;
+
+  case 442: /* assign_stm: KEMI DOT PRE_ROUTING_CALLBACK EQUAL STRING  */
+#line 1756 "core/cfg.y"
+                                                     {
+			kemi_pre_routing_callback.s = (yyvsp[0].strval);
+			kemi_pre_routing_callback.len = strlen((yyvsp[0].strval));
+			if(kemi_pre_routing_callback.len==4
+					&& strcasecmp(kemi_pre_routing_callback.s, "none")==0) {
+				kemi_pre_routing_callback.s = "";
+				kemi_pre_routing_callback.len = 0;
+			}
+		}
+#line 8283 "core/cfg.tab.c"
+    break;
+
+  case 443: /* assign_stm: KEMI DOT PRE_ROUTING_CALLBACK EQUAL error  */
+#line 1765 "core/cfg.y"
+                                                    { yyerror("string expected"); }
+#line 8289 "core/cfg.tab.c"
+    break;
+
+  case 444: /* assign_stm: RECEIVED_ROUTE_MODE EQUAL intno  */
+#line 1766 "core/cfg.y"
+                                      { ksr_evrt_received_mode=(yyvsp[0].intval); }
+#line 8295 "core/cfg.tab.c"
+    break;
+
+  case 445: /* assign_stm: RECEIVED_ROUTE_MODE EQUAL error  */
+#line 1767 "core/cfg.y"
+                                           { yyerror("number  expected"); }
+#line 8301 "core/cfg.tab.c"
+    break;
+
+  case 446: /* assign_stm: MAX_RECURSIVE_LEVEL EQUAL NUMBER  */
+#line 1768 "core/cfg.y"
+                                       { set_max_recursive_level((yyvsp[0].intval)); }
+#line 8307 "core/cfg.tab.c"
+    break;
+
+  case 447: /* assign_stm: MAX_BRANCHES_PARAM EQUAL NUMBER  */
+#line 1769 "core/cfg.y"
+                                      { sr_dst_max_branches = (yyvsp[0].intval); }
+#line 8313 "core/cfg.tab.c"
+    break;
+
+  case 448: /* assign_stm: LATENCY_LOG EQUAL intno  */
+#line 1770 "core/cfg.y"
+                              { default_core_cfg.latency_log=(yyvsp[0].intval); }
+#line 8319 "core/cfg.tab.c"
+    break;
+
+  case 449: /* assign_stm: LATENCY_LOG EQUAL error  */
+#line 1771 "core/cfg.y"
+                                   { yyerror("number  expected"); }
+#line 8325 "core/cfg.tab.c"
+    break;
+
+  case 450: /* assign_stm: LATENCY_CFG_LOG EQUAL intno  */
+#line 1772 "core/cfg.y"
+                                  { default_core_cfg.latency_cfg_log=(yyvsp[0].intval); }
+#line 8331 "core/cfg.tab.c"
+    break;
+
+  case 451: /* assign_stm: LATENCY_CFG_LOG EQUAL error  */
+#line 1773 "core/cfg.y"
+                                       { yyerror("number  expected"); }
+#line 8337 "core/cfg.tab.c"
+    break;
+
+  case 452: /* assign_stm: LATENCY_LIMIT_DB EQUAL NUMBER  */
+#line 1774 "core/cfg.y"
+                                    { default_core_cfg.latency_limit_db=(yyvsp[0].intval); }
+#line 8343 "core/cfg.tab.c"
+    break;
+
+  case 453: /* assign_stm: LATENCY_LIMIT_DB EQUAL error  */
+#line 1775 "core/cfg.y"
+                                        { yyerror("number  expected"); }
+#line 8349 "core/cfg.tab.c"
+    break;
+
+  case 454: /* assign_stm: LATENCY_LIMIT_ACTION EQUAL NUMBER  */
+#line 1776 "core/cfg.y"
+                                        { default_core_cfg.latency_limit_action=(yyvsp[0].intval); }
+#line 8355 "core/cfg.tab.c"
+    break;
+
+  case 455: /* assign_stm: LATENCY_LIMIT_ACTION EQUAL error  */
+#line 1777 "core/cfg.y"
+                                            { yyerror("number  expected"); }
+#line 8361 "core/cfg.tab.c"
+    break;
+
+  case 456: /* assign_stm: LATENCY_LIMIT_CFG EQUAL NUMBER  */
+#line 1778 "core/cfg.y"
+                                     { default_core_cfg.latency_limit_cfg=(yyvsp[0].intval); }
+#line 8367 "core/cfg.tab.c"
+    break;
+
+  case 457: /* assign_stm: LATENCY_LIMIT_CFG EQUAL error  */
+#line 1779 "core/cfg.y"
+                                         { yyerror("number  expected"); }
+#line 8373 "core/cfg.tab.c"
+    break;
+
+  case 458: /* assign_stm: MSG_TIME EQUAL NUMBER  */
+#line 1780 "core/cfg.y"
+                            { sr_msg_time=(yyvsp[0].intval); }
+#line 8379 "core/cfg.tab.c"
+    break;
+
+  case 459: /* assign_stm: MSG_TIME EQUAL error  */
+#line 1781 "core/cfg.y"
+                                { yyerror("number  expected"); }
+#line 8385 "core/cfg.tab.c"
+    break;
+
+  case 460: /* assign_stm: ONSEND_RT_REPLY EQUAL NUMBER  */
+#line 1782 "core/cfg.y"
+                                       { onsend_route_reply=(yyvsp[0].intval); }
+#line 8391 "core/cfg.tab.c"
+    break;
+
+  case 461: /* assign_stm: ONSEND_RT_REPLY EQUAL error  */
+#line 1783 "core/cfg.y"
+                                      { yyerror("int value expected"); }
+#line 8397 "core/cfg.tab.c"
+    break;
+
+  case 462: /* assign_stm: UDP_MTU EQUAL NUMBER  */
+#line 1784 "core/cfg.y"
+                               { default_core_cfg.udp_mtu=(yyvsp[0].intval); }
+#line 8403 "core/cfg.tab.c"
+    break;
+
+  case 463: /* assign_stm: UDP_MTU EQUAL error  */
+#line 1785 "core/cfg.y"
+                              { yyerror("number expected"); }
+#line 8409 "core/cfg.tab.c"
+    break;
+
+  case 464: /* assign_stm: FORCE_RPORT EQUAL NUMBER  */
+#line 1787 "core/cfg.y"
+                { default_core_cfg.force_rport=(yyvsp[0].intval); fix_global_req_flags(0, 0); }
+#line 8415 "core/cfg.tab.c"
+    break;
+
+  case 465: /* assign_stm: FORCE_RPORT EQUAL error  */
+#line 1788 "core/cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 8421 "core/cfg.tab.c"
+    break;
+
+  case 466: /* assign_stm: LOCAL_RPORT EQUAL NUMBER  */
+#line 1789 "core/cfg.y"
+                                   { ksr_local_rport=(yyvsp[0].intval); }
+#line 8427 "core/cfg.tab.c"
+    break;
+
+  case 467: /* assign_stm: LOCAL_RPORT EQUAL error  */
+#line 1790 "core/cfg.y"
+                                  { yyerror("boolean value expected"); }
+#line 8433 "core/cfg.tab.c"
+    break;
+
+  case 468: /* assign_stm: UDP_MTU_TRY_PROTO EQUAL proto  */
+#line 1792 "core/cfg.y"
+                { default_core_cfg.udp_mtu_try_proto=(yyvsp[0].intval); fix_global_req_flags(0, 0); }
+#line 8439 "core/cfg.tab.c"
+    break;
+
+  case 469: /* assign_stm: UDP_MTU_TRY_PROTO EQUAL error  */
+#line 1794 "core/cfg.y"
+                { yyerror("TCP, TLS, SCTP or UDP expected"); }
+#line 8445 "core/cfg.tab.c"
+    break;
+
+  case 470: /* assign_stm: UDP4_RAW EQUAL intno  */
+#line 1795 "core/cfg.y"
+                               { IF_RAW_SOCKS(default_core_cfg.udp4_raw=(yyvsp[0].intval)); }
+#line 8451 "core/cfg.tab.c"
+    break;
+
+  case 471: /* assign_stm: UDP4_RAW EQUAL error  */
+#line 1796 "core/cfg.y"
+                               { yyerror("number expected"); }
+#line 8457 "core/cfg.tab.c"
+    break;
+
+  case 472: /* assign_stm: UDP4_RAW_MTU EQUAL NUMBER  */
+#line 1797 "core/cfg.y"
+                                    {
+		IF_RAW_SOCKS(default_core_cfg.udp4_raw_mtu=(yyvsp[0].intval));
+	}
+#line 8465 "core/cfg.tab.c"
+    break;
+
+  case 473: /* assign_stm: UDP4_RAW_MTU EQUAL error  */
+#line 1800 "core/cfg.y"
+                                   { yyerror("number expected"); }
+#line 8471 "core/cfg.tab.c"
+    break;
+
+  case 474: /* assign_stm: UDP4_RAW_TTL EQUAL NUMBER  */
+#line 1801 "core/cfg.y"
+                                    {
+		IF_RAW_SOCKS(default_core_cfg.udp4_raw_ttl=(yyvsp[0].intval));
+	}
+#line 8479 "core/cfg.tab.c"
+    break;
+
+  case 475: /* assign_stm: UDP4_RAW_TTL EQUAL error  */
+#line 1804 "core/cfg.y"
+                                   { yyerror("number expected"); }
+#line 8485 "core/cfg.tab.c"
+    break;
+
+  case 477: /* assign_stm: error EQUAL  */
+#line 1806 "core/cfg.y"
+                      { yyerror("unknown config variable"); }
+#line 8491 "core/cfg.tab.c"
+    break;
+
+  case 479: /* cfg_var_id: DEFAULT  */
+#line 1810 "core/cfg.y"
+                  { (yyval.strval)="default" ; }
+#line 8497 "core/cfg.tab.c"
+    break;
+
+  case 481: /* cfg_var_idn: DEFAULT  */
+#line 1814 "core/cfg.y"
+                  { (yyval.strval)="default" ; }
+#line 8503 "core/cfg.tab.c"
+    break;
+
+  case 482: /* cfg_var_idn: NUMBER  */
+#line 1815 "core/cfg.y"
+                 {
+		yyerror("cfg var field name - use of number or reserved token not allowed: %s",
+				yy_number_str);
+		YYERROR;
+	}
+#line 8513 "core/cfg.tab.c"
+    break;
+
+  case 483: /* cfg_var: cfg_var_id DOT cfg_var_idn EQUAL NUMBER  */
+#line 1823 "core/cfg.y"
+                                                {
+		if (cfg_declare_int((yyvsp[-4].strval), (yyvsp[-2].strval), (yyvsp[0].intval), 0, 0, NULL)) {
+			yyerror("variable cannot be declared");
+		}
+	}
+#line 8523 "core/cfg.tab.c"
+    break;
+
+  case 484: /* cfg_var: cfg_var_id DOT cfg_var_idn EQUAL STRING  */
+#line 1828 "core/cfg.y"
+                                                  {
+		if (cfg_declare_str((yyvsp[-4].strval), (yyvsp[-2].strval), (yyvsp[0].strval), NULL)) {
+			yyerror("variable cannot be declared");
+		}
+	}
+#line 8533 "core/cfg.tab.c"
+    break;
+
+  case 485: /* cfg_var: cfg_var_id DOT cfg_var_idn EQUAL NUMBER CFG_DESCRIPTION STRING  */
+#line 1833 "core/cfg.y"
+                                                                         {
+		if (cfg_declare_int((yyvsp[-6].strval), (yyvsp[-4].strval), (yyvsp[-2].intval), 0, 0, (yyvsp[0].strval))) {
+			yyerror("variable cannot be declared");
+		}
+	}
+#line 8543 "core/cfg.tab.c"
+    break;
+
+  case 486: /* cfg_var: cfg_var_id DOT cfg_var_idn EQUAL STRING CFG_DESCRIPTION STRING  */
+#line 1838 "core/cfg.y"
+                                                                         {
+		if (cfg_declare_str((yyvsp[-6].strval), (yyvsp[-4].strval), (yyvsp[-2].strval), (yyvsp[0].strval))) {
+			yyerror("variable cannot be declared");
+		}
+	}
+#line 8553 "core/cfg.tab.c"
+    break;
+
+  case 487: /* cfg_var: cfg_var_id DOT cfg_var_idn EQUAL error  */
+#line 1843 "core/cfg.y"
+                                                 {
+		yyerror("number or string expected");
+	}
+#line 8561 "core/cfg.tab.c"
+    break;
+
+  case 488: /* cfg_var: cfg_var_id LBRACK NUMBER RBRACK DOT cfg_var_idn EQUAL NUMBER  */
+#line 1846 "core/cfg.y"
+                                                                       {
+		if (cfg_ginst_var_int((yyvsp[-7].strval), (yyvsp[-5].intval), (yyvsp[-2].strval), (yyvsp[0].intval))) {
+			yyerror("variable cannot be added to the group instance");
+		}
+	}
+#line 8571 "core/cfg.tab.c"
+    break;
+
+  case 489: /* cfg_var: cfg_var_id LBRACK NUMBER RBRACK DOT cfg_var_idn EQUAL STRING  */
+#line 1851 "core/cfg.y"
+                                                                       {
+		if (cfg_ginst_var_string((yyvsp[-7].strval), (yyvsp[-5].intval), (yyvsp[-2].strval), (yyvsp[0].strval))) {
+			yyerror("variable cannot be added to the group instance");
+		}
+	}
+#line 8581 "core/cfg.tab.c"
+    break;
+
+  case 490: /* module_stm: LOADMODULE STRING  */
+#line 1859 "core/cfg.y"
+                          {
+		LM_DBG("loading module %s\n", (yyvsp[0].strval));
+			if (load_module((yyvsp[0].strval))!=0) {
+				yyerror("failed to load module");
+			}
+	}
+#line 8592 "core/cfg.tab.c"
+    break;
+
+  case 491: /* module_stm: LOADMODULE error  */
+#line 1865 "core/cfg.y"
+                                { yyerror("string expected"); }
+#line 8598 "core/cfg.tab.c"
+    break;
+
+  case 492: /* module_stm: LOADMODULEX STRING  */
+#line 1866 "core/cfg.y"
+                             {
+		LM_DBG("loading module %s\n", (yyvsp[0].strval));
+			if (load_modulex((yyvsp[0].strval))!=0) {
+				yyerror("failed to load module");
+			}
+	}
+#line 8609 "core/cfg.tab.c"
+    break;
+
+  case 493: /* module_stm: LOADMODULEX error  */
+#line 1872 "core/cfg.y"
+                                { yyerror("string expected"); }
+#line 8615 "core/cfg.tab.c"
+    break;
+
+  case 494: /* module_stm: LOADPATH STRING  */
+#line 1873 "core/cfg.y"
+                          {
+		if(mods_dir_cmd==0) {
+			LM_DBG("loading modules under %s\n", (yyvsp[0].strval));
+			printf("loading modules under config path: %s\n", (yyvsp[0].strval));
+			mods_dir = (yyvsp[0].strval);
+		} else {
+			LM_DBG("ignoring mod path given in config: %s\n", (yyvsp[0].strval));
+			printf("loading modules under command line path: %s\n", mods_dir);
+		}
+	}
+#line 8630 "core/cfg.tab.c"
+    break;
+
+  case 495: /* module_stm: LOADPATH error  */
+#line 1883 "core/cfg.y"
+                                { yyerror("string expected"); }
+#line 8636 "core/cfg.tab.c"
+    break;
+
+  case 496: /* module_stm: LOADPATH EQUAL STRING  */
+#line 1884 "core/cfg.y"
+                                {
+		if(mods_dir_cmd==0) {
+			LM_DBG("loading modules under %s\n", (yyvsp[0].strval));
+			printf("loading modules under config path: %s\n", (yyvsp[0].strval));
+			mods_dir = (yyvsp[0].strval);
+		} else {
+			LM_DBG("ignoring mod path given in config: %s\n", (yyvsp[0].strval));
+			printf("loading modules under command line path: %s\n", mods_dir);
+		}
+	}
+#line 8651 "core/cfg.tab.c"
+    break;
+
+  case 497: /* module_stm: LOADPATH EQUAL error  */
+#line 1894 "core/cfg.y"
+                                { yyerror("string expected"); }
+#line 8657 "core/cfg.tab.c"
+    break;
+
+  case 498: /* module_stm: MODPARAM LPAREN STRING COMMA STRING COMMA STRING RPAREN  */
+#line 1895 "core/cfg.y"
+                                                                  {
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+		if (set_mod_param_regex((yyvsp[-5].strval), (yyvsp[-3].strval), PARAM_STRING, (yyvsp[-1].strval)) != 0) {
+			 yyerror("Can't set module parameter");
+		}
+	}
+#line 8671 "core/cfg.tab.c"
+    break;
+
+  case 499: /* module_stm: MODPARAM LPAREN STRING COMMA STRING COMMA intno RPAREN  */
+#line 1904 "core/cfg.y"
+                                                                 {
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+		if (set_mod_param_regex((yyvsp[-5].strval), (yyvsp[-3].strval), PARAM_INT, (void*)(yyvsp[-1].intval)) != 0) {
+			 yyerror("Can't set module parameter");
+		}
+	}
+#line 8685 "core/cfg.tab.c"
+    break;
+
+  case 500: /* module_stm: MODPARAM error  */
+#line 1913 "core/cfg.y"
+                         { yyerror("Invalid arguments"); }
+#line 8691 "core/cfg.tab.c"
+    break;
+
+  case 501: /* module_stm: MODPARAMX LPAREN STRING COMMA STRING COMMA STRING RPAREN  */
+#line 1914 "core/cfg.y"
+                                                                   {
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+		if (modparamx_set((yyvsp[-5].strval), (yyvsp[-3].strval), PARAM_STRING, (yyvsp[-1].strval)) != 0) {
+			 yyerror("Can't set module parameter");
+		}
+	}
+#line 8705 "core/cfg.tab.c"
+    break;
+
+  case 502: /* module_stm: MODPARAMX LPAREN STRING COMMA STRING COMMA intno RPAREN  */
+#line 1923 "core/cfg.y"
+                                                                  {
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+		if (modparamx_set((yyvsp[-5].strval), (yyvsp[-3].strval), PARAM_INT, (void*)(yyvsp[-1].intval)) != 0) {
+			 yyerror("Can't set module parameter");
+		}
+	}
+#line 8719 "core/cfg.tab.c"
+    break;
+
+  case 503: /* module_stm: MODPARAMX LPAREN STRING COMMA STRING COMMA PVAR RPAREN  */
+#line 1932 "core/cfg.y"
+                                                                 {
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+		if (modparamx_set((yyvsp[-5].strval), (yyvsp[-3].strval), PARAM_VAR, (void*)(yyvsp[-1].strval)) != 0) {
+			 yyerror("Can't set module parameter");
+		}
+	}
+#line 8733 "core/cfg.tab.c"
+    break;
+
+  case 504: /* module_stm: MODPARAMX error  */
+#line 1941 "core/cfg.y"
+                          { yyerror("Invalid arguments"); }
+#line 8739 "core/cfg.tab.c"
+    break;
+
+  case 505: /* module_stm: CFGENGINE STRING  */
+#line 1942 "core/cfg.y"
+                           {
+		if(sr_kemi_eng_setz((yyvsp[0].strval), NULL)) {
+			yyerror("Can't set config routing engine");
+			YYABORT;
+		}
+	}
+#line 8750 "core/cfg.tab.c"
+    break;
+
+  case 506: /* module_stm: CFGENGINE error  */
+#line 1948 "core/cfg.y"
+                                { yyerror("string expected"); }
+#line 8756 "core/cfg.tab.c"
+    break;
+
+  case 507: /* module_stm: CFGENGINE EQUAL STRING  */
+#line 1949 "core/cfg.y"
+                                 {
+		if(sr_kemi_eng_setz((yyvsp[0].strval), NULL)) {
+			yyerror("Can't set config routing engine");
+			YYABORT;
+		}
+	}
+#line 8767 "core/cfg.tab.c"
+    break;
+
+  case 508: /* module_stm: CFGENGINE EQUAL error  */
+#line 1955 "core/cfg.y"
+                                { yyerror("string expected"); }
+#line 8773 "core/cfg.tab.c"
+    break;
+
+  case 509: /* ip: ipv4  */
+#line 1959 "core/cfg.y"
+              { (yyval.ipaddr)=(yyvsp[0].ipaddr); }
+#line 8779 "core/cfg.tab.c"
+    break;
+
+  case 510: /* ip: ipv6  */
+#line 1960 "core/cfg.y"
+                { (yyval.ipaddr)=(yyvsp[0].ipaddr); }
+#line 8785 "core/cfg.tab.c"
+    break;
+
+  case 511: /* ipv4: NUMBER DOT NUMBER DOT NUMBER DOT NUMBER  */
+#line 1963 "core/cfg.y"
+                                                {
+		(yyval.ipaddr)=pkg_malloc(sizeof(struct ip_addr));
+		if ((yyval.ipaddr)==0) {
+			PKG_MEM_CRITICAL;
+		} else {
+			memset((yyval.ipaddr), 0, sizeof(struct ip_addr));
+			(yyval.ipaddr)->af=AF_INET;
+			(yyval.ipaddr)->len=4;
+			if (((yyvsp[-6].intval)>255) || ((yyvsp[-6].intval)<0) ||
+				((yyvsp[-4].intval)>255) || ((yyvsp[-4].intval)<0) ||
+				((yyvsp[-2].intval)>255) || ((yyvsp[-2].intval)<0) ||
+				((yyvsp[0].intval)>255) || ((yyvsp[0].intval)<0)) {
+				yyerror("invalid ipv4 address");
+				(yyval.ipaddr)->u.addr32[0]=0;
+				/* $$=0; */
+			} else {
+				(yyval.ipaddr)->u.addr[0]=(yyvsp[-6].intval);
+				(yyval.ipaddr)->u.addr[1]=(yyvsp[-4].intval);
+				(yyval.ipaddr)->u.addr[2]=(yyvsp[-2].intval);
+				(yyval.ipaddr)->u.addr[3]=(yyvsp[0].intval);
+				/*
+				$$=htonl( ($1<<24)|
+				($3<<16)| ($5<<8)|$7 );
+				*/
+			}
+		}
+	}
+#line 8817 "core/cfg.tab.c"
+    break;
+
+  case 512: /* ipv6addr: IPV6ADDR  */
+#line 1992 "core/cfg.y"
+                 {
+		(yyval.ipaddr)=pkg_malloc(sizeof(struct ip_addr));
+		if ((yyval.ipaddr)==0) {
+			PKG_MEM_CRITICAL;
+		} else {
+			memset((yyval.ipaddr), 0, sizeof(struct ip_addr));
+			(yyval.ipaddr)->af=AF_INET6;
+			(yyval.ipaddr)->len=16;
+			if (inet_pton(AF_INET6, (yyvsp[0].strval), (yyval.ipaddr)->u.addr)<=0) {
+				yyerror("bad ipv6 address");
+			}
+		}
+	}
+#line 8835 "core/cfg.tab.c"
+    break;
+
+  case 513: /* ipv6: ipv6addr  */
+#line 2007 "core/cfg.y"
+                 { (yyval.ipaddr)=(yyvsp[0].ipaddr); }
+#line 8841 "core/cfg.tab.c"
+    break;
+
+  case 514: /* ipv6: LBRACK ipv6addr RBRACK  */
+#line 2008 "core/cfg.y"
+                                 {(yyval.ipaddr)=(yyvsp[-1].ipaddr); }
+#line 8847 "core/cfg.tab.c"
+    break;
+
+  case 515: /* route_name: NUMBER  */
+#line 2012 "core/cfg.y"
+                                {
+					tmp=int2str((yyvsp[0].intval), &i_tmp);
+					if (((yyval.strval)=pkg_malloc(i_tmp+1))==0) {
+						yyerror("out of  memory");
+						YYABORT;
+					} else {
+						memcpy((yyval.strval), tmp, i_tmp);
+						(yyval.strval)[i_tmp]=0;
+					}
+					routename = tmp;
+						}
+#line 8863 "core/cfg.tab.c"
+    break;
+
+  case 516: /* route_name: ID  */
+#line 2023 "core/cfg.y"
+                                                { routename = (yyvsp[0].strval); (yyval.strval)=(yyvsp[0].strval); }
+#line 8869 "core/cfg.tab.c"
+    break;
+
+  case 517: /* route_name: STRING  */
+#line 2024 "core/cfg.y"
+                                        { routename = (yyvsp[0].strval); (yyval.strval)=(yyvsp[0].strval); }
+#line 8875 "core/cfg.tab.c"
+    break;
+
+  case 518: /* route_main: ROUTE  */
+#line 2028 "core/cfg.y"
+                      { routename=NULL; }
+#line 8881 "core/cfg.tab.c"
+    break;
+
+  case 519: /* route_main: ROUTE_REQUEST  */
+#line 2029 "core/cfg.y"
+                                  { routename=NULL; }
+#line 8887 "core/cfg.tab.c"
+    break;
+
+  case 520: /* route_stm: route_main LBRACE actions RBRACE  */
+#line 2033 "core/cfg.y"
+                                         {
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+		push((yyvsp[-1].action), &main_rt.rlist[DEFAULT_RT]);
+	}
+#line 8899 "core/cfg.tab.c"
+    break;
+
+  case 521: /* route_stm: ROUTE LBRACK route_name RBRACK LBRACE actions RBRACE  */
+#line 2040 "core/cfg.y"
+                                                               {
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+		i_tmp=route_get(&main_rt, (yyvsp[-4].strval));
+		if (i_tmp==-1){
+			yyerror("internal error");
+			YYABORT;
+		}
+		if (main_rt.rlist[i_tmp]){
+			yyerror("duplicate route");
+			YYABORT;
+		}
+		push((yyvsp[-1].action), &main_rt.rlist[i_tmp]);
+	}
+#line 8920 "core/cfg.tab.c"
+    break;
+
+  case 522: /* route_stm: ROUTE error  */
+#line 2056 "core/cfg.y"
+                      { yyerror("invalid  route  statement"); }
+#line 8926 "core/cfg.tab.c"
+    break;
+
+  case 523: /* route_stm: ROUTE_REQUEST error  */
+#line 2057 "core/cfg.y"
+                              { yyerror("invalid  request_route  statement"); }
+#line 8932 "core/cfg.tab.c"
+    break;
+
+  case 524: /* failure_route_main: ROUTE_FAILURE  */
+#line 2060 "core/cfg.y"
+                                  { routename=NULL; }
+#line 8938 "core/cfg.tab.c"
+    break;
+
+  case 525: /* failure_route_stm: failure_route_main LBRACE actions RBRACE  */
+#line 2063 "core/cfg.y"
+                                                 {
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+		push((yyvsp[-1].action), &failure_rt.rlist[DEFAULT_RT]);
+	}
+#line 8950 "core/cfg.tab.c"
+    break;
+
+  case 526: /* failure_route_stm: ROUTE_FAILURE LBRACK route_name RBRACK LBRACE actions RBRACE  */
+#line 2070 "core/cfg.y"
+                                                                       {
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+		i_tmp=route_get(&failure_rt, (yyvsp[-4].strval));
+		if (i_tmp==-1){
+			yyerror("internal error");
+			YYABORT;
+		}
+		if (failure_rt.rlist[i_tmp]){
+			yyerror("duplicate route");
+			YYABORT;
+		}
+		push((yyvsp[-1].action), &failure_rt.rlist[i_tmp]);
+	}
+#line 8971 "core/cfg.tab.c"
+    break;
+
+  case 527: /* failure_route_stm: ROUTE_FAILURE error  */
+#line 2086 "core/cfg.y"
+                              { yyerror("invalid failure_route statement"); }
+#line 8977 "core/cfg.tab.c"
+    break;
+
+  case 528: /* route_reply_main: ROUTE_ONREPLY  */
+#line 2090 "core/cfg.y"
+                                      { routename=NULL; }
+#line 8983 "core/cfg.tab.c"
+    break;
+
+  case 529: /* route_reply_main: ROUTE_REPLY  */
+#line 2091 "core/cfg.y"
+                                { routename=NULL; }
+#line 8989 "core/cfg.tab.c"
+    break;
+
+  case 530: /* $@6: %empty  */
+#line 2096 "core/cfg.y"
+                                {rt=CORE_ONREPLY_ROUTE;}
+#line 8995 "core/cfg.tab.c"
+    break;
+
+  case 531: /* onreply_route_stm: route_reply_main LBRACE $@6 actions RBRACE  */
+#line 2096 "core/cfg.y"
+                                                                        {
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+		push((yyvsp[-1].action), &onreply_rt.rlist[DEFAULT_RT]);
+	}
+#line 9007 "core/cfg.tab.c"
+    break;
+
+  case 532: /* onreply_route_stm: ROUTE_ONREPLY error  */
+#line 2103 "core/cfg.y"
+                              { yyerror("invalid onreply_route statement"); }
+#line 9013 "core/cfg.tab.c"
+    break;
+
+  case 533: /* onreply_route_stm: ROUTE_REPLY error  */
+#line 2104 "core/cfg.y"
+                            { yyerror("invalid onreply_route statement"); }
+#line 9019 "core/cfg.tab.c"
+    break;
+
+  case 534: /* $@7: %empty  */
+#line 2106 "core/cfg.y"
+                {rt=(*(yyvsp[-1].strval)=='0' && (yyvsp[-1].strval)[1]==0)?CORE_ONREPLY_ROUTE:TM_ONREPLY_ROUTE;}
+#line 9025 "core/cfg.tab.c"
+    break;
+
+  case 535: /* onreply_route_stm: ROUTE_ONREPLY LBRACK route_name RBRACK $@7 LBRACE actions RBRACE  */
+#line 2107 "core/cfg.y"
+                                      {
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+		if (*(yyvsp[-5].strval)=='0' && (yyvsp[-5].strval)[1]==0){
+			/* onreply_route[0] {} is equivalent with onreply_route {}*/
+			push((yyvsp[-1].action), &onreply_rt.rlist[DEFAULT_RT]);
+		}else{
+			i_tmp=route_get(&onreply_rt, (yyvsp[-5].strval));
+			if (i_tmp==-1){
+				yyerror("internal error");
+				YYABORT;
+			}
+			if (onreply_rt.rlist[i_tmp]){
+				yyerror("duplicate route");
+				YYABORT;
+			}
+			push((yyvsp[-1].action), &onreply_rt.rlist[i_tmp]);
+		}
+	}
+#line 9051 "core/cfg.tab.c"
+    break;
+
+  case 536: /* onreply_route_stm: ROUTE_ONREPLY LBRACK route_name RBRACK error  */
+#line 2128 "core/cfg.y"
+                                                       {
+		yyerror("invalid onreply_route statement");
+	}
+#line 9059 "core/cfg.tab.c"
+    break;
+
+  case 537: /* branch_route_main: ROUTE_BRANCH  */
+#line 2133 "core/cfg.y"
+                                { routename=NULL; }
+#line 9065 "core/cfg.tab.c"
+    break;
+
+  case 538: /* branch_route_stm: branch_route_main LBRACE actions RBRACE  */
+#line 2136 "core/cfg.y"
+                                                {
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+		push((yyvsp[-1].action), &branch_rt.rlist[DEFAULT_RT]);
+	}
+#line 9077 "core/cfg.tab.c"
+    break;
+
+  case 539: /* branch_route_stm: ROUTE_BRANCH LBRACK route_name RBRACK LBRACE actions RBRACE  */
+#line 2143 "core/cfg.y"
+                                                                      {
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+		i_tmp=route_get(&branch_rt, (yyvsp[-4].strval));
+		if (i_tmp==-1){
+			yyerror("internal error");
+			YYABORT;
+		}
+		if (branch_rt.rlist[i_tmp]){
+			yyerror("duplicate route");
+			YYABORT;
+		}
+		push((yyvsp[-1].action), &branch_rt.rlist[i_tmp]);
+	}
+#line 9098 "core/cfg.tab.c"
+    break;
+
+  case 540: /* branch_route_stm: ROUTE_BRANCH error  */
+#line 2159 "core/cfg.y"
+                             { yyerror("invalid branch_route statement"); }
+#line 9104 "core/cfg.tab.c"
+    break;
+
+  case 541: /* send_route_main: ROUTE_SEND  */
+#line 2162 "core/cfg.y"
+                            { routename=NULL; }
+#line 9110 "core/cfg.tab.c"
+    break;
+
+  case 542: /* send_route_stm: send_route_main LBRACE actions RBRACE  */
+#line 2165 "core/cfg.y"
+                                              {
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+		push((yyvsp[-1].action), &onsend_rt.rlist[DEFAULT_RT]);
+	}
+#line 9122 "core/cfg.tab.c"
+    break;
+
+  case 543: /* send_route_stm: ROUTE_SEND LBRACK route_name RBRACK LBRACE actions RBRACE  */
+#line 2172 "core/cfg.y"
+                                                                    {
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+		i_tmp=route_get(&onsend_rt, (yyvsp[-4].strval));
+		if (i_tmp==-1){
+			yyerror("internal error");
+			YYABORT;
+		}
+		if (onsend_rt.rlist[i_tmp]){
+			yyerror("duplicate route");
+			YYABORT;
+		}
+		push((yyvsp[-1].action), &onsend_rt.rlist[i_tmp]);
+	}
+#line 9143 "core/cfg.tab.c"
+    break;
+
+  case 544: /* send_route_stm: ROUTE_SEND error  */
+#line 2188 "core/cfg.y"
+                           { yyerror("invalid onsend_route statement"); }
+#line 9149 "core/cfg.tab.c"
+    break;
+
+  case 545: /* event_route_main: ROUTE_EVENT  */
+#line 2191 "core/cfg.y"
+                              { routename=NULL; }
+#line 9155 "core/cfg.tab.c"
+    break;
+
+  case 546: /* event_route_stm: event_route_main LBRACK EVENT_RT_NAME RBRACK LBRACE actions RBRACE  */
+#line 2194 "core/cfg.y"
+                                                                           {
+		if (!shm_initialized() && init_shm()<0) {
+			yyerror("Can't initialize shared memory");
+			YYABORT;
+		}
+		i_tmp=route_get(&event_rt, (yyvsp[-4].strval));
+		if (i_tmp==-1){
+			yyerror("internal error");
+			YYABORT;
+		}
+		if (event_rt.rlist[i_tmp]){
+			yyerror("duplicate route");
+			YYABORT;
+		}
+		push((yyvsp[-1].action), &event_rt.rlist[i_tmp]);
+	}
+#line 9176 "core/cfg.tab.c"
+    break;
+
+  case 547: /* event_route_stm: ROUTE_EVENT error  */
+#line 2211 "core/cfg.y"
+                            { yyerror("invalid event_route statement"); }
+#line 9182 "core/cfg.tab.c"
+    break;
+
+  case 548: /* preprocess_stm: SUBST STRING  */
+#line 2214 "core/cfg.y"
+                     { if(pp_subst_add((yyvsp[0].strval))<0) YYERROR; }
+#line 9188 "core/cfg.tab.c"
+    break;
+
+  case 549: /* preprocess_stm: SUBST error  */
+#line 2215 "core/cfg.y"
+                      { yyerror("invalid subst preprocess statement"); }
+#line 9194 "core/cfg.tab.c"
+    break;
+
+  case 550: /* preprocess_stm: SUBSTDEF STRING  */
+#line 2216 "core/cfg.y"
+                          { if(pp_substdef_add((yyvsp[0].strval), 0)<0) YYERROR; }
+#line 9200 "core/cfg.tab.c"
+    break;
+
+  case 551: /* preprocess_stm: SUBSTDEF error  */
+#line 2217 "core/cfg.y"
+                         { yyerror("invalid substdef preprocess statement"); }
+#line 9206 "core/cfg.tab.c"
+    break;
+
+  case 552: /* preprocess_stm: SUBSTDEFS STRING  */
+#line 2218 "core/cfg.y"
+                           { if(pp_substdef_add((yyvsp[0].strval), 1)<0) YYERROR; }
+#line 9212 "core/cfg.tab.c"
+    break;
+
+  case 553: /* preprocess_stm: SUBSTDEFS error  */
+#line 2219 "core/cfg.y"
+                          { yyerror("invalid substdefs preprocess statement"); }
+#line 9218 "core/cfg.tab.c"
+    break;
+
+  case 554: /* equalop: EQUAL_T  */
+#line 2241 "core/cfg.y"
+                {(yyval.intval)=EQUAL_OP; }
+#line 9224 "core/cfg.tab.c"
+    break;
+
+  case 555: /* equalop: DIFF  */
+#line 2242 "core/cfg.y"
+                {(yyval.intval)=DIFF_OP; }
+#line 9230 "core/cfg.tab.c"
+    break;
+
+  case 556: /* equalop: STREQ  */
+#line 2243 "core/cfg.y"
+                {(yyval.intval)=EQUAL_OP; }
+#line 9236 "core/cfg.tab.c"
+    break;
+
+  case 557: /* equalop: STRDIFF  */
+#line 2244 "core/cfg.y"
+                  {(yyval.intval)=DIFF_OP; }
+#line 9242 "core/cfg.tab.c"
+    break;
+
+  case 558: /* cmpop: GT  */
+#line 2247 "core/cfg.y"
+                {(yyval.intval)=GT_OP; }
+#line 9248 "core/cfg.tab.c"
+    break;
+
+  case 559: /* cmpop: LT  */
+#line 2248 "core/cfg.y"
+                {(yyval.intval)=LT_OP; }
+#line 9254 "core/cfg.tab.c"
+    break;
+
+  case 560: /* cmpop: GTE  */
+#line 2249 "core/cfg.y"
+                {(yyval.intval)=GTE_OP; }
+#line 9260 "core/cfg.tab.c"
+    break;
+
+  case 561: /* cmpop: LTE  */
+#line 2250 "core/cfg.y"
+                {(yyval.intval)=LTE_OP; }
+#line 9266 "core/cfg.tab.c"
+    break;
+
+  case 562: /* strop: equalop  */
+#line 2253 "core/cfg.y"
+                {(yyval.intval)=(yyvsp[0].intval); }
+#line 9272 "core/cfg.tab.c"
+    break;
+
+  case 563: /* strop: MATCH  */
+#line 2254 "core/cfg.y"
+                {(yyval.intval)=MATCH_OP; }
+#line 9278 "core/cfg.tab.c"
+    break;
+
+  case 564: /* rve_equalop: EQUAL_T  */
+#line 2260 "core/cfg.y"
+                {(yyval.intval)=RVE_EQ_OP; }
+#line 9284 "core/cfg.tab.c"
+    break;
+
+  case 565: /* rve_equalop: DIFF  */
+#line 2261 "core/cfg.y"
+                {(yyval.intval)=RVE_DIFF_OP; }
+#line 9290 "core/cfg.tab.c"
+    break;
+
+  case 566: /* rve_equalop: INTEQ  */
+#line 2262 "core/cfg.y"
+                {(yyval.intval)=RVE_IEQ_OP; }
+#line 9296 "core/cfg.tab.c"
+    break;
+
+  case 567: /* rve_equalop: INTDIFF  */
+#line 2263 "core/cfg.y"
+                  {(yyval.intval)=RVE_IDIFF_OP; }
+#line 9302 "core/cfg.tab.c"
+    break;
+
+  case 568: /* rve_equalop: STREQ  */
+#line 2264 "core/cfg.y"
+                {(yyval.intval)=RVE_STREQ_OP; }
+#line 9308 "core/cfg.tab.c"
+    break;
+
+  case 569: /* rve_equalop: STRDIFF  */
+#line 2265 "core/cfg.y"
+                  {(yyval.intval)=RVE_STRDIFF_OP; }
+#line 9314 "core/cfg.tab.c"
+    break;
+
+  case 570: /* rve_equalop: MATCH  */
+#line 2266 "core/cfg.y"
+                {(yyval.intval)=RVE_MATCH_OP; }
+#line 9320 "core/cfg.tab.c"
+    break;
+
+  case 571: /* rve_cmpop: GT  */
+#line 2269 "core/cfg.y"
+                {(yyval.intval)=RVE_GT_OP; }
+#line 9326 "core/cfg.tab.c"
+    break;
+
+  case 572: /* rve_cmpop: LT  */
+#line 2270 "core/cfg.y"
+                {(yyval.intval)=RVE_LT_OP; }
+#line 9332 "core/cfg.tab.c"
+    break;
+
+  case 573: /* rve_cmpop: GTE  */
+#line 2271 "core/cfg.y"
+                {(yyval.intval)=RVE_GTE_OP; }
+#line 9338 "core/cfg.tab.c"
+    break;
+
+  case 574: /* rve_cmpop: LTE  */
+#line 2272 "core/cfg.y"
+                {(yyval.intval)=RVE_LTE_OP; }
+#line 9344 "core/cfg.tab.c"
+    break;
+
+  case 575: /* uri_type: URI  */
+#line 2279 "core/cfg.y"
+                        {(yyval.intval)=URI_O;}
+#line 9350 "core/cfg.tab.c"
+    break;
+
+  case 576: /* uri_type: FROM_URI  */
+#line 2280 "core/cfg.y"
+                        {(yyval.intval)=FROM_URI_O;}
+#line 9356 "core/cfg.tab.c"
+    break;
+
+  case 577: /* uri_type: TO_URI  */
+#line 2281 "core/cfg.y"
+                        {(yyval.intval)=TO_URI_O;}
+#line 9362 "core/cfg.tab.c"
+    break;
+
+  case 578: /* eint_op_onsend: SNDPORT  */
+#line 2288 "core/cfg.y"
+                                        { (yyval.intval)=SNDPORT_O; }
+#line 9368 "core/cfg.tab.c"
+    break;
+
+  case 579: /* eint_op_onsend: TOPORT  */
+#line 2289 "core/cfg.y"
+                                        { (yyval.intval)=TOPORT_O; }
+#line 9374 "core/cfg.tab.c"
+    break;
+
+  case 580: /* eint_op_onsend: SNDAF  */
+#line 2290 "core/cfg.y"
+                                        { (yyval.intval)=SNDAF_O; }
+#line 9380 "core/cfg.tab.c"
+    break;
+
+  case 581: /* eint_op: SRCPORT  */
+#line 2294 "core/cfg.y"
+                                { (yyval.intval)=SRCPORT_O; }
+#line 9386 "core/cfg.tab.c"
+    break;
+
+  case 582: /* eint_op: DSTPORT  */
+#line 2295 "core/cfg.y"
+                                        { (yyval.intval)=DSTPORT_O; }
+#line 9392 "core/cfg.tab.c"
+    break;
+
+  case 583: /* eint_op: AF  */
+#line 2296 "core/cfg.y"
+                                                { (yyval.intval)=AF_O; }
+#line 9398 "core/cfg.tab.c"
+    break;
+
+  case 584: /* eint_op: MSGLEN  */
+#line 2297 "core/cfg.y"
+                                        { (yyval.intval)=MSGLEN_O; }
+#line 9404 "core/cfg.tab.c"
+    break;
+
+  case 586: /* eip_op_onsend: SNDIP  */
+#line 2303 "core/cfg.y"
+                                        { onsend_check("snd_ip"); (yyval.intval)=SNDIP_O; }
+#line 9410 "core/cfg.tab.c"
+    break;
+
+  case 587: /* eip_op_onsend: TOIP  */
+#line 2304 "core/cfg.y"
+                                        { onsend_check("to_ip");  (yyval.intval)=TOIP_O; }
+#line 9416 "core/cfg.tab.c"
+    break;
+
+  case 588: /* eip_op: SRCIP  */
+#line 2307 "core/cfg.y"
+                                { (yyval.intval)=SRCIP_O; }
+#line 9422 "core/cfg.tab.c"
+    break;
+
+  case 589: /* eip_op: DSTIP  */
+#line 2308 "core/cfg.y"
+                                        { (yyval.intval)=DSTIP_O; }
+#line 9428 "core/cfg.tab.c"
+    break;
+
+  case 591: /* exp_elem: METHOD strop rval_expr  */
+#line 2316 "core/cfg.y"
+                {(yyval.expr)= mk_elem((yyvsp[-1].intval), METHOD_O, 0, RVE_ST, (yyvsp[0].rv_expr));}
+#line 9434 "core/cfg.tab.c"
+    break;
+
+  case 592: /* exp_elem: METHOD strop ID  */
+#line 2318 "core/cfg.y"
+                {(yyval.expr) = mk_elem((yyvsp[-1].intval), METHOD_O, 0, STRING_ST,(yyvsp[0].strval)); }
+#line 9440 "core/cfg.tab.c"
+    break;
+
+  case 593: /* exp_elem: METHOD strop error  */
+#line 2319 "core/cfg.y"
+                             { (yyval.expr)=0; yyerror("string expected"); }
+#line 9446 "core/cfg.tab.c"
+    break;
+
+  case 594: /* exp_elem: METHOD error  */
+#line 2321 "core/cfg.y"
+                { (yyval.expr)=0; yyerror("invalid operator,== , !=, or =~ expected"); }
+#line 9452 "core/cfg.tab.c"
+    break;
+
+  case 595: /* exp_elem: uri_type strop rval_expr  */
+#line 2323 "core/cfg.y"
+                {(yyval.expr) = mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, RVE_ST, (yyvsp[0].rv_expr)); }
+#line 9458 "core/cfg.tab.c"
+    break;
+
+  case 596: /* exp_elem: uri_type strop MYSELF  */
+#line 2325 "core/cfg.y"
+                {(yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, MYSELF_ST, 0); }
+#line 9464 "core/cfg.tab.c"
+    break;
+
+  case 597: /* exp_elem: uri_type strop error  */
+#line 2327 "core/cfg.y"
+                { (yyval.expr)=0; yyerror("string or MYSELF expected"); }
+#line 9470 "core/cfg.tab.c"
+    break;
+
+  case 598: /* exp_elem: uri_type error  */
+#line 2329 "core/cfg.y"
+                { (yyval.expr)=0; yyerror("invalid operator, == , != or =~ expected"); }
+#line 9476 "core/cfg.tab.c"
+    break;
+
+  case 599: /* exp_elem: eint_op cmpop rval_expr  */
+#line 2330 "core/cfg.y"
+                                           { (yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, RVE_ST, (yyvsp[0].rv_expr) ); }
+#line 9482 "core/cfg.tab.c"
+    break;
+
+  case 600: /* exp_elem: eint_op equalop rval_expr  */
+#line 2332 "core/cfg.y"
+                { (yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, RVE_ST, (yyvsp[0].rv_expr) ); }
+#line 9488 "core/cfg.tab.c"
+    break;
+
+  case 601: /* exp_elem: eint_op cmpop error  */
+#line 2333 "core/cfg.y"
+                                { (yyval.expr)=0; yyerror("number expected"); }
+#line 9494 "core/cfg.tab.c"
+    break;
+
+  case 602: /* exp_elem: eint_op equalop error  */
+#line 2334 "core/cfg.y"
+                                { (yyval.expr)=0; yyerror("number expected"); }
+#line 9500 "core/cfg.tab.c"
+    break;
+
+  case 603: /* exp_elem: eint_op error  */
+#line 2335 "core/cfg.y"
+                        { (yyval.expr)=0; yyerror("==, !=, <,>, >= or <=  expected"); }
+#line 9506 "core/cfg.tab.c"
+    break;
+
+  case 604: /* exp_elem: PROTO equalop eqproto  */
+#line 2337 "core/cfg.y"
+                { (yyval.expr)=mk_elem((yyvsp[-1].intval), PROTO_O, 0, NUMBER_ST, (void*)(yyvsp[0].intval) ); }
+#line 9512 "core/cfg.tab.c"
+    break;
+
+  case 605: /* exp_elem: PROTO equalop rval_expr  */
+#line 2339 "core/cfg.y"
+                { (yyval.expr)=mk_elem((yyvsp[-1].intval), PROTO_O, 0, RVE_ST, (yyvsp[0].rv_expr) ); }
+#line 9518 "core/cfg.tab.c"
+    break;
+
+  case 606: /* exp_elem: PROTO equalop error  */
+#line 2341 "core/cfg.y"
+                { (yyval.expr)=0; yyerror("protocol expected (udp, tcp, tls, sctp, ws, or wss)"); }
+#line 9524 "core/cfg.tab.c"
+    break;
+
+  case 607: /* exp_elem: SNDPROTO equalop eqproto  */
+#line 2343 "core/cfg.y"
+                { (yyval.expr)=mk_elem((yyvsp[-1].intval), SNDPROTO_O, 0, NUMBER_ST, (void*)(yyvsp[0].intval) ); }
+#line 9530 "core/cfg.tab.c"
+    break;
+
+  case 608: /* exp_elem: SNDPROTO equalop rval_expr  */
+#line 2345 "core/cfg.y"
+                { (yyval.expr)=mk_elem((yyvsp[-1].intval), SNDPROTO_O, 0, RVE_ST, (yyvsp[0].rv_expr) ); }
+#line 9536 "core/cfg.tab.c"
+    break;
+
+  case 609: /* exp_elem: SNDPROTO equalop error  */
+#line 2347 "core/cfg.y"
+                { (yyval.expr)=0; yyerror("protocol expected (udp, tcp, tls, sctp, ws, or wss)"); }
+#line 9542 "core/cfg.tab.c"
+    break;
+
+  case 610: /* exp_elem: eip_op strop ipnet  */
+#line 2348 "core/cfg.y"
+                                           { (yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, NET_ST, (yyvsp[0].ipnet)); }
+#line 9548 "core/cfg.tab.c"
+    break;
+
+  case 611: /* exp_elem: eip_op strop rval_expr  */
+#line 2349 "core/cfg.y"
+                                               {
+			s_tmp.s=0;
+			(yyval.expr)=0;
+			if (rve_is_constant((yyvsp[0].rv_expr))){
+				i_tmp=rve_guess_type((yyvsp[0].rv_expr));
+				if (i_tmp==RV_INT)
+					yyerror("string expected");
+				else if (i_tmp==RV_STR){
+					if (((rval_tmp=rval_expr_eval(0, 0, (yyvsp[0].rv_expr)))==0) ||
+								(rval_get_str(0, 0, &s_tmp, rval_tmp, 0)<0)){
+						rval_destroy(rval_tmp);
+						yyerror("bad rvalue expression");
+					}else{
+						rval_destroy(rval_tmp);
+					}
+				}else{
+					yyerror("BUG: unexpected dynamic type");
+				}
+			}else{
+					/* warn("non constant rvalue in ip comparison") */;
+			}
+			if (s_tmp.s){
+				ip_tmp=str2ip(&s_tmp);
+				if (ip_tmp==0)
+					ip_tmp=str2ip6(&s_tmp);
+				pkg_free(s_tmp.s);
+				if (ip_tmp) {
+					(yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, NET_ST,
+								mk_new_net_bitlen(ip_tmp, ip_tmp->len*8) );
+				} else {
+					(yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, RVE_ST, (yyvsp[0].rv_expr));
+				}
+			}else{
+				(yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, RVE_ST, (yyvsp[0].rv_expr));
+			}
+		}
+#line 9589 "core/cfg.tab.c"
+    break;
+
+  case 612: /* exp_elem: eip_op strop host  */
+#line 2386 "core/cfg.y"
+                { (yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, STRING_ST, (yyvsp[0].strval)); }
+#line 9595 "core/cfg.tab.c"
+    break;
+
+  case 613: /* exp_elem: eip_op strop MYSELF  */
+#line 2388 "core/cfg.y"
+                { (yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[-2].intval), 0, MYSELF_ST, 0); }
+#line 9601 "core/cfg.tab.c"
+    break;
+
+  case 614: /* exp_elem: eip_op strop error  */
+#line 2390 "core/cfg.y"
+                { (yyval.expr)=0; yyerror( "ip address or hostname expected" ); }
+#line 9607 "core/cfg.tab.c"
+    break;
+
+  case 615: /* exp_elem: eip_op error  */
+#line 2392 "core/cfg.y"
+                { (yyval.expr)=0; yyerror("invalid operator, ==, != or =~ expected");}
+#line 9613 "core/cfg.tab.c"
+    break;
+
+  case 616: /* exp_elem: MYSELF equalop uri_type  */
+#line 2395 "core/cfg.y"
+                { (yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[0].intval), 0, MYSELF_ST, 0); }
+#line 9619 "core/cfg.tab.c"
+    break;
+
+  case 617: /* exp_elem: MYSELF equalop eip_op  */
+#line 2397 "core/cfg.y"
+                { (yyval.expr)=mk_elem((yyvsp[-1].intval), (yyvsp[0].intval), 0, MYSELF_ST, 0); }
+#line 9625 "core/cfg.tab.c"
+    break;
+
+  case 618: /* exp_elem: MYSELF equalop error  */
+#line 2399 "core/cfg.y"
+                { (yyval.expr)=0; yyerror("URI, SRCIP or DSTIP expected"); }
+#line 9631 "core/cfg.tab.c"
+    break;
+
+  case 619: /* exp_elem: MYSELF error  */
+#line 2400 "core/cfg.y"
+                        { (yyval.expr)=0; yyerror ("invalid operator, == or != expected"); }
+#line 9637 "core/cfg.tab.c"
+    break;
+
+  case 620: /* ipnet: ip SLASH ip  */
+#line 2404 "core/cfg.y"
+                        { (yyval.ipnet)=mk_new_net((yyvsp[-2].ipaddr), (yyvsp[0].ipaddr)); }
+#line 9643 "core/cfg.tab.c"
+    break;
+
+  case 621: /* ipnet: ip SLASH NUMBER  */
+#line 2405 "core/cfg.y"
+                          {
+		if (((yyvsp[0].intval)<0) || ((yyvsp[0].intval)>(yyvsp[-2].ipaddr)->len*8)) {
+			yyerror("invalid bit number in netmask");
+			(yyval.ipnet)=0;
+		} else {
+			(yyval.ipnet)=mk_new_net_bitlen((yyvsp[-2].ipaddr), (yyvsp[0].intval));
+		/*
+			$$=mk_new_net($1, htonl( ($3)?~( (1<<(32-$3))-1 ):0 ) );
+		*/
+		}
+	}
+#line 9659 "core/cfg.tab.c"
+    break;
+
+  case 622: /* ipnet: ip  */
+#line 2416 "core/cfg.y"
+                { (yyval.ipnet)=mk_new_net_bitlen((yyvsp[0].ipaddr), (yyvsp[0].ipaddr)->len*8); }
+#line 9665 "core/cfg.tab.c"
+    break;
+
+  case 623: /* ipnet: ip SLASH error  */
+#line 2417 "core/cfg.y"
+                         { (yyval.ipnet)=0; yyerror("netmask (eg:255.0.0.0 or 8) expected"); }
+#line 9671 "core/cfg.tab.c"
+    break;
+
+  case 624: /* host: ID  */
+#line 2421 "core/cfg.y"
+           { (yyval.strval)=(yyvsp[0].strval); }
+#line 9677 "core/cfg.tab.c"
+    break;
+
+  case 625: /* host: host DOT ID  */
+#line 2422 "core/cfg.y"
+                      {
+		if ((yyvsp[-2].strval)){
+			(yyval.strval)=(char*)pkg_malloc(strlen((yyvsp[-2].strval))+1+strlen((yyvsp[0].strval))+1);
+			if ((yyval.strval)==0) {
+				PKG_MEM_CRITICAL;
+			} else {
+				memcpy((yyval.strval), (yyvsp[-2].strval), strlen((yyvsp[-2].strval)));
+				(yyval.strval)[strlen((yyvsp[-2].strval))]='.';
+				memcpy((yyval.strval)+strlen((yyvsp[-2].strval))+1, (yyvsp[0].strval), strlen((yyvsp[0].strval)));
+				(yyval.strval)[strlen((yyvsp[-2].strval))+1+strlen((yyvsp[0].strval))]=0;
+			}
+			pkg_free((yyvsp[-2].strval));
+		}
+		if ((yyvsp[0].strval)) pkg_free((yyvsp[0].strval));
+	}
+#line 9697 "core/cfg.tab.c"
+    break;
+
+  case 626: /* host: host MINUS ID  */
+#line 2437 "core/cfg.y"
+                        {
+		if ((yyvsp[-2].strval)){
+			(yyval.strval)=(char*)pkg_malloc(strlen((yyvsp[-2].strval))+1+strlen((yyvsp[0].strval))+1);
+			if ((yyval.strval)==0) {
+				PKG_MEM_CRITICAL;
+			} else {
+				memcpy((yyval.strval), (yyvsp[-2].strval), strlen((yyvsp[-2].strval)));
+				(yyval.strval)[strlen((yyvsp[-2].strval))]='-';
+				memcpy((yyval.strval)+strlen((yyvsp[-2].strval))+1, (yyvsp[0].strval), strlen((yyvsp[0].strval)));
+				(yyval.strval)[strlen((yyvsp[-2].strval))+1+strlen((yyvsp[0].strval))]=0;
+			}
+			pkg_free((yyvsp[-2].strval));
+		}
+		if ((yyvsp[0].strval)) pkg_free((yyvsp[0].strval));
+	}
+#line 9717 "core/cfg.tab.c"
+    break;
+
+  case 627: /* host: host DOT error  */
+#line 2452 "core/cfg.y"
+                         { (yyval.strval)=0; pkg_free((yyvsp[-2].strval)); yyerror("invalid hostname"); }
+#line 9723 "core/cfg.tab.c"
+    break;
+
+  case 628: /* host: host MINUS error  */
+#line 2453 "core/cfg.y"
+                           { (yyval.strval)=0; pkg_free((yyvsp[-2].strval)); yyerror("invalid hostname"); }
+#line 9729 "core/cfg.tab.c"
+    break;
+
+  case 631: /* host_if_id: NUMBER  */
+#line 2458 "core/cfg.y"
+                         {
+			/* get string version */
+			(yyval.strval)=pkg_malloc(strlen(yy_number_str)+1);
+			if ((yyval.strval)==0) {
+				PKG_MEM_ERROR;
+			} else {
+				strcpy((yyval.strval), yy_number_str);
+			}
+		}
+#line 9743 "core/cfg.tab.c"
+    break;
+
+  case 632: /* host_or_if: host_if_id  */
+#line 2470 "core/cfg.y"
+                   { (yyval.strval)=(yyvsp[0].strval); }
+#line 9749 "core/cfg.tab.c"
+    break;
+
+  case 633: /* host_or_if: host_or_if DOT host_if_id  */
+#line 2471 "core/cfg.y"
+                                    {
+		if ((yyvsp[-2].strval)){
+			(yyval.strval)=(char*)pkg_malloc(strlen((yyvsp[-2].strval))+1+strlen((yyvsp[0].strval))+1);
+			if ((yyval.strval)==0) {
+				PKG_MEM_CRITICAL;
+			} else {
+				memcpy((yyval.strval), (yyvsp[-2].strval), strlen((yyvsp[-2].strval)));
+				(yyval.strval)[strlen((yyvsp[-2].strval))]='.';
+				memcpy((yyval.strval)+strlen((yyvsp[-2].strval))+1, (yyvsp[0].strval), strlen((yyvsp[0].strval)));
+				(yyval.strval)[strlen((yyvsp[-2].strval))+1+strlen((yyvsp[0].strval))]=0;
+			}
+			pkg_free((yyvsp[-2].strval));
+		}
+		if ((yyvsp[0].strval)) pkg_free((yyvsp[0].strval));
+	}
+#line 9769 "core/cfg.tab.c"
+    break;
+
+  case 634: /* host_or_if: host_or_if MINUS host_if_id  */
+#line 2486 "core/cfg.y"
+                                      {
+		if ((yyvsp[-2].strval)){
+			(yyval.strval)=(char*)pkg_malloc(strlen((yyvsp[-2].strval))+1+strlen((yyvsp[0].strval))+1);
+			if ((yyval.strval)==0) {
+				PKG_MEM_CRITICAL;
+			} else {
+				memcpy((yyval.strval), (yyvsp[-2].strval), strlen((yyvsp[-2].strval)));
+				(yyval.strval)[strlen((yyvsp[-2].strval))]='-';
+				memcpy((yyval.strval)+strlen((yyvsp[-2].strval))+1, (yyvsp[0].strval), strlen((yyvsp[0].strval)));
+				(yyval.strval)[strlen((yyvsp[-2].strval))+1+strlen((yyvsp[0].strval))]=0;
+			}
+			pkg_free((yyvsp[-2].strval));
+		}
+		if ((yyvsp[0].strval)) pkg_free((yyvsp[0].strval));
+	}
+#line 9789 "core/cfg.tab.c"
+    break;
+
+  case 635: /* host_or_if: host_or_if DOT error  */
+#line 2501 "core/cfg.y"
+                               { (yyval.strval)=0; pkg_free((yyvsp[-2].strval));
+								yyerror("invalid host or interface name"); }
+#line 9796 "core/cfg.tab.c"
+    break;
+
+  case 636: /* host_or_if: host_or_if MINUS error  */
+#line 2503 "core/cfg.y"
+                                 { (yyval.strval)=0; pkg_free((yyvsp[-2].strval));
+								yyerror("invalid host or interface name"); }
+#line 9803 "core/cfg.tab.c"
+    break;
+
+  case 637: /* fcmd: cmd  */
+#line 2510 "core/cfg.y"
+            {
+		/* check if allowed */
+		if ((yyvsp[0].action) && rt==ONSEND_ROUTE) {
+			switch((yyvsp[0].action)->type) {
+				case DROP_T:
+				case LOG_T:
+				case SETFLAG_T:
+				case RESETFLAG_T:
+				case ISFLAGSET_T:
+				case IF_T:
+				case MODULE0_T:
+				case MODULE1_T:
+				case MODULE2_T:
+				case MODULE3_T:
+				case MODULE4_T:
+				case MODULE5_T:
+				case MODULE6_T:
+				case MODULEX_T:
+				case SET_FWD_NO_CONNECT_T:
+				case SET_RPL_NO_CONNECT_T:
+				case SET_FWD_CLOSE_T:
+				case SET_RPL_CLOSE_T:
+					(yyval.action)=(yyvsp[0].action);
+					break;
+				default:
+					(yyval.action)=0;
+					yyerror("command not allowed in onsend_route\n");
+			}
+		} else {
+			(yyval.action)=(yyvsp[0].action);
+		}
+	}
+#line 9840 "core/cfg.tab.c"
+    break;
+
+  case 638: /* stm: action  */
+#line 2552 "core/cfg.y"
+                { (yyval.action)=(yyvsp[0].action); }
+#line 9846 "core/cfg.tab.c"
+    break;
+
+  case 639: /* stm: LBRACE actions RBRACE  */
+#line 2553 "core/cfg.y"
+                                { (yyval.action)=(yyvsp[-1].action); }
+#line 9852 "core/cfg.tab.c"
+    break;
+
+  case 640: /* actions: actions action  */
+#line 2556 "core/cfg.y"
+                        {(yyval.action)=append_action((yyvsp[-1].action), (yyvsp[0].action)); }
+#line 9858 "core/cfg.tab.c"
+    break;
+
+  case 641: /* actions: action  */
+#line 2557 "core/cfg.y"
+                        {(yyval.action)=(yyvsp[0].action);}
+#line 9864 "core/cfg.tab.c"
+    break;
+
+  case 642: /* actions: actions error  */
+#line 2558 "core/cfg.y"
+                        { (yyval.action)=0; yyerror("bad command"); }
+#line 9870 "core/cfg.tab.c"
+    break;
+
+  case 643: /* action: fcmd SEMICOLON  */
+#line 2561 "core/cfg.y"
+                       {(yyval.action)=(yyvsp[-1].action);}
+#line 9876 "core/cfg.tab.c"
+    break;
+
+  case 644: /* action: if_cmd  */
+#line 2562 "core/cfg.y"
+                 {(yyval.action)=(yyvsp[0].action);}
+#line 9882 "core/cfg.tab.c"
+    break;
+
+  case 645: /* action: switch_cmd  */
+#line 2563 "core/cfg.y"
+                     {(yyval.action)=(yyvsp[0].action);}
+#line 9888 "core/cfg.tab.c"
+    break;
+
+  case 646: /* action: while_cmd  */
+#line 2564 "core/cfg.y"
+                    { (yyval.action)=(yyvsp[0].action); }
+#line 9894 "core/cfg.tab.c"
+    break;
+
+  case 647: /* action: ret_cmd SEMICOLON  */
+#line 2565 "core/cfg.y"
+                            { (yyval.action)=(yyvsp[-1].action); }
+#line 9900 "core/cfg.tab.c"
+    break;
+
+  case 648: /* action: assign_action SEMICOLON  */
+#line 2566 "core/cfg.y"
+                                  {(yyval.action)=(yyvsp[-1].action);}
+#line 9906 "core/cfg.tab.c"
+    break;
+
+  case 649: /* action: SEMICOLON  */
+#line 2567 "core/cfg.y"
+                                      {(yyval.action)=0;}
+#line 9912 "core/cfg.tab.c"
+    break;
+
+  case 650: /* action: fcmd error  */
+#line 2568 "core/cfg.y"
+                     { (yyval.action)=0; yyerror("bad command: missing ';'?"); }
+#line 9918 "core/cfg.tab.c"
+    break;
+
+  case 651: /* if_cmd: IF rval_expr stm  */
+#line 2571 "core/cfg.y"
+                                {
+		if ((yyvsp[-1].rv_expr) && rval_expr_int_check((yyvsp[-1].rv_expr))>=0){
+			warn_ct_rve((yyvsp[-1].rv_expr), "if");
+			(yyval.action)=mk_action( IF_T, 3, RVE_ST, (yyvsp[-1].rv_expr), ACTIONS_ST, (yyvsp[0].action), NOSUBTYPE, 0);
+			set_cfg_pos((yyval.action));
+		}else
+			YYERROR;
+	}
+#line 9931 "core/cfg.tab.c"
+    break;
+
+  case 652: /* if_cmd: IF rval_expr stm ELSE stm  */
+#line 2579 "core/cfg.y"
+                                        {
+		if ((yyvsp[-3].rv_expr) && rval_expr_int_check((yyvsp[-3].rv_expr))>=0){
+			warn_ct_rve((yyvsp[-3].rv_expr), "if");
+			(yyval.action)=mk_action( IF_T, 3, RVE_ST, (yyvsp[-3].rv_expr), ACTIONS_ST, (yyvsp[-2].action), ACTIONS_ST, (yyvsp[0].action));
+			set_cfg_pos((yyval.action));
+		}else
+			YYERROR;
+	}
+#line 9944 "core/cfg.tab.c"
+    break;
+
+  case 653: /* ct_rval: rval_expr  */
+#line 2589 "core/cfg.y"
+                   {
+			(yyval.rv_expr)=0;
+			if ((yyvsp[0].rv_expr) && !rve_is_constant((yyvsp[0].rv_expr))){
+				yyerror("constant expected");
+				YYERROR;
+			/*
+			} else if ($1 &&
+						!rve_check_type((enum rval_type*)&i_tmp, $1, 0, 0 ,0)){
+				yyerror("invalid expression (bad type)");
+			}else if ($1 && i_tmp!=RV_INT){
+				yyerror("invalid expression type, int expected\n");
+			*/
+			}else
+				(yyval.rv_expr)=(yyvsp[0].rv_expr);
+		}
+#line 9964 "core/cfg.tab.c"
+    break;
+
+  case 654: /* single_case: CASE ct_rval COLON actions  */
+#line 2606 "core/cfg.y"
+                                   {
+		(yyval.case_stms)=0;
+		if ((yyvsp[-2].rv_expr)==0) { yyerror ("bad case label"); YYERROR; }
+		else if ((((yyval.case_stms)=mk_case_stm((yyvsp[-2].rv_expr), 0, (yyvsp[0].action), &i_tmp))==0) && (i_tmp==-10)){
+				YYABORT;
+		}
+	}
+#line 9976 "core/cfg.tab.c"
+    break;
+
+  case 655: /* single_case: CASE SLASH ct_rval COLON actions  */
+#line 2613 "core/cfg.y"
+                                   {
+		(yyval.case_stms)=0;
+		if ((yyvsp[-2].rv_expr)==0) { yyerror ("bad case label"); YYERROR; }
+		else if ((((yyval.case_stms)=mk_case_stm((yyvsp[-2].rv_expr), 1, (yyvsp[0].action), &i_tmp))==0) && (i_tmp==-10)){
+				YYABORT;
+		}
+	}
+#line 9988 "core/cfg.tab.c"
+    break;
+
+  case 656: /* single_case: CASE ct_rval COLON  */
+#line 2620 "core/cfg.y"
+                             {
+		(yyval.case_stms)=0;
+		if ((yyvsp[-1].rv_expr)==0) { yyerror ("bad case label"); YYERROR; }
+		else if ((((yyval.case_stms)=mk_case_stm((yyvsp[-1].rv_expr), 0, 0, &i_tmp))==0) && (i_tmp==-10)){
+				YYABORT;
+		}
+	}
+#line 10000 "core/cfg.tab.c"
+    break;
+
+  case 657: /* single_case: CASE SLASH ct_rval COLON  */
+#line 2627 "core/cfg.y"
+                                   {
+		(yyval.case_stms)=0;
+		if ((yyvsp[-1].rv_expr)==0) { yyerror ("bad regex case label"); YYERROR; }
+		else if ((((yyval.case_stms)=mk_case_stm((yyvsp[-1].rv_expr), 1, 0, &i_tmp))==0) && (i_tmp==-10)){
+				YYABORT;
+		}
+	}
+#line 10012 "core/cfg.tab.c"
+    break;
+
+  case 658: /* single_case: DEFAULT COLON actions  */
+#line 2634 "core/cfg.y"
+                                {
+		if ((((yyval.case_stms)=mk_case_stm(0, 0, (yyvsp[0].action), &i_tmp))==0) && (i_tmp==-10)){
+				YYABORT;
+		}
+	}
+#line 10022 "core/cfg.tab.c"
+    break;
+
+  case 659: /* single_case: DEFAULT COLON  */
+#line 2639 "core/cfg.y"
+                        {
+		if ((((yyval.case_stms)=mk_case_stm(0, 0, 0, &i_tmp))==0) && (i_tmp==-10)){
+				YYABORT;
+		}
+	}
+#line 10032 "core/cfg.tab.c"
+    break;
+
+  case 660: /* single_case: CASE error COLON actions  */
+#line 2644 "core/cfg.y"
+                                   { (yyval.case_stms)=0; yyerror("bad case label"); }
+#line 10038 "core/cfg.tab.c"
+    break;
+
+  case 661: /* single_case: CASE SLASH error COLON actions  */
+#line 2645 "core/cfg.y"
+                                         { (yyval.case_stms)=0; yyerror("bad case regex label"); }
+#line 10044 "core/cfg.tab.c"
+    break;
+
+  case 662: /* single_case: CASE error COLON  */
+#line 2646 "core/cfg.y"
+                           { (yyval.case_stms)=0; yyerror("bad case label"); }
+#line 10050 "core/cfg.tab.c"
+    break;
+
+  case 663: /* single_case: CASE SLASH error COLON  */
+#line 2647 "core/cfg.y"
+                                 { (yyval.case_stms)=0; yyerror("bad case regex label"); }
+#line 10056 "core/cfg.tab.c"
+    break;
+
+  case 664: /* single_case: CASE ct_rval COLON error  */
+#line 2648 "core/cfg.y"
+                                   { (yyval.case_stms)=0; yyerror ("bad case body"); }
+#line 10062 "core/cfg.tab.c"
+    break;
+
+  case 665: /* case_stms: case_stms single_case  */
+#line 2651 "core/cfg.y"
+                              {
+		(yyval.case_stms)=(yyvsp[-1].case_stms);
+		if ((yyvsp[0].case_stms)==0) yyerror ("bad case");
+		if ((yyval.case_stms)){
+			*((yyval.case_stms)->append)=(yyvsp[0].case_stms);
+			if (*((yyval.case_stms)->append)!=0)
+				(yyval.case_stms)->append=&((*((yyval.case_stms)->append))->next);
+		}
+	}
+#line 10076 "core/cfg.tab.c"
+    break;
+
+  case 666: /* case_stms: single_case  */
+#line 2660 "core/cfg.y"
+                      {
+		(yyval.case_stms)=(yyvsp[0].case_stms);
+		if ((yyvsp[0].case_stms)==0) yyerror ("bad case");
+		else (yyval.case_stms)->append=&((yyval.case_stms)->next);
+	}
+#line 10086 "core/cfg.tab.c"
+    break;
+
+  case 667: /* switch_cmd: SWITCH rval_expr LBRACE case_stms RBRACE  */
+#line 2667 "core/cfg.y"
+                                                   {
+		(yyval.action)=0;
+		if ((yyvsp[-3].rv_expr)==0){
+			yyerror("bad expression in switch(...)");
+			YYERROR;
+		}else if ((yyvsp[-1].case_stms)==0){
+			yyerror ("bad switch body");
+			YYERROR;
+		}else if (case_check_default((yyvsp[-1].case_stms))!=0){
+			yyerror_at(&(yyvsp[-3].rv_expr)->fpos, "bad switch(): too many "
+							"\"default:\" labels\n");
+			YYERROR;
+		}else if (case_check_type((yyvsp[-1].case_stms))!=0){
+			yyerror_at(&(yyvsp[-3].rv_expr)->fpos, "bad switch(): mixed integer and"
+							" string/RE cases not allowed\n");
+			YYERROR;
+		}else{
+			(yyval.action)=mk_action(SWITCH_T, 2, RVE_ST, (yyvsp[-3].rv_expr), CASE_ST, (yyvsp[-1].case_stms));
+			if ((yyval.action)==0) {
+				yyerror("internal error");
+				YYABORT;
+			}
+			set_cfg_pos((yyval.action));
+		}
+	}
+#line 10116 "core/cfg.tab.c"
+    break;
+
+  case 668: /* switch_cmd: SWITCH rval_expr LBRACE RBRACE  */
+#line 2692 "core/cfg.y"
+                                         {
+		(yyval.action)=0;
+		warn("empty switch()");
+		if ((yyvsp[-2].rv_expr)==0){
+			yyerror("bad expression in switch(...)");
+			YYERROR;
+		}else{
+			/* it might have sideffects, so leave it for the optimizer */
+			(yyval.action)=mk_action(SWITCH_T, 2, RVE_ST, (yyvsp[-2].rv_expr), CASE_ST, 0);
+			if ((yyval.action)==0) {
+				yyerror("internal error");
+				YYABORT;
+			}
+			set_cfg_pos((yyval.action));
+		}
+	}
+#line 10137 "core/cfg.tab.c"
+    break;
+
+  case 669: /* switch_cmd: SWITCH error  */
+#line 2708 "core/cfg.y"
+                       { (yyval.action)=0; yyerror ("bad expression in switch(...)"); }
+#line 10143 "core/cfg.tab.c"
+    break;
+
+  case 670: /* switch_cmd: SWITCH rval_expr LBRACE error RBRACE  */
+#line 2710 "core/cfg.y"
+                {(yyval.action)=0; yyerror ("bad switch body"); }
+#line 10149 "core/cfg.tab.c"
+    break;
+
+  case 671: /* while_cmd: WHILE rval_expr stm  */
+#line 2714 "core/cfg.y"
+                            {
+		if ((yyvsp[-1].rv_expr) && rval_expr_int_check((yyvsp[-1].rv_expr))>=0){
+			warn_ct_rve((yyvsp[-1].rv_expr), "while");
+			(yyval.action)=mk_action( WHILE_T, 2, RVE_ST, (yyvsp[-1].rv_expr), ACTIONS_ST, (yyvsp[0].action));
+			set_cfg_pos((yyval.action));
+		}else{
+			yyerror_at(&(yyvsp[-1].rv_expr)->fpos, "bad while(...) expression");
+			YYERROR;
+		}
+	}
+#line 10164 "core/cfg.tab.c"
+    break;
+
+  case 672: /* select_param: ID  */
+#line 2733 "core/cfg.y"
+           {
+		if (sel.n >= MAX_SELECT_PARAMS-1) {
+			yyerror("Select identifier too long\n");
+		}
+		sel.params[sel.n].type = SEL_PARAM_STR;
+		sel.params[sel.n].v.s.s = (yyvsp[0].strval);
+		sel.params[sel.n].v.s.len = strlen((yyvsp[0].strval));
+		sel.n++;
+	}
+#line 10178 "core/cfg.tab.c"
+    break;
+
+  case 673: /* select_param: ID LBRACK intno RBRACK  */
+#line 2742 "core/cfg.y"
+                                 {
+		if (sel.n >= MAX_SELECT_PARAMS-2) {
+			yyerror("Select identifier too long\n");
+		}
+		sel.params[sel.n].type = SEL_PARAM_STR;
+		sel.params[sel.n].v.s.s = (yyvsp[-3].strval);
+		sel.params[sel.n].v.s.len = strlen((yyvsp[-3].strval));
+		sel.n++;
+		sel.params[sel.n].type = SEL_PARAM_INT;
+		sel.params[sel.n].v.i = (yyvsp[-1].intval);
+		sel.n++;
+	}
+#line 10195 "core/cfg.tab.c"
+    break;
+
+  case 674: /* select_param: ID LBRACK STRING RBRACK  */
+#line 2754 "core/cfg.y"
+                                  {
+		if (sel.n >= MAX_SELECT_PARAMS-2) {
+			yyerror("Select identifier too long\n");
+		}
+		sel.params[sel.n].type = SEL_PARAM_STR;
+		sel.params[sel.n].v.s.s = (yyvsp[-3].strval);
+		sel.params[sel.n].v.s.len = strlen((yyvsp[-3].strval));
+		sel.n++;
+		sel.params[sel.n].type = SEL_PARAM_STR;
+		sel.params[sel.n].v.s.s = (yyvsp[-1].strval);
+		sel.params[sel.n].v.s.len = strlen((yyvsp[-1].strval));
+		sel.n++;
+	}
+#line 10213 "core/cfg.tab.c"
+    break;
+
+  case 677: /* $@8: %empty  */
+#line 2773 "core/cfg.y"
+                    { sel.n = 0; sel.f[0] = 0; }
+#line 10219 "core/cfg.tab.c"
+    break;
+
+  case 678: /* select_id: SELECT_MARK $@8 select_params  */
+#line 2773 "core/cfg.y"
+                                                               {
+		sel_ptr = (select_t*)pkg_malloc(sizeof(select_t));
+		if (!sel_ptr) {
+			yyerror("No memory left to allocate select structure\n");
+		}
+		memcpy(sel_ptr, &sel, sizeof(select_t));
+		(yyval.select) = sel_ptr;
+	}
+#line 10232 "core/cfg.tab.c"
+    break;
+
+  case 679: /* attr_class_spec: ATTR_FROM  */
+#line 2783 "core/cfg.y"
+                  { s_attr->type |= AVP_TRACK_FROM; }
+#line 10238 "core/cfg.tab.c"
+    break;
+
+  case 680: /* attr_class_spec: ATTR_TO  */
+#line 2784 "core/cfg.y"
+                  { s_attr->type |= AVP_TRACK_TO; }
+#line 10244 "core/cfg.tab.c"
+    break;
+
+  case 681: /* attr_class_spec: ATTR_FROMURI  */
+#line 2785 "core/cfg.y"
+                       { s_attr->type |= AVP_TRACK_FROM | AVP_CLASS_URI; }
+#line 10250 "core/cfg.tab.c"
+    break;
+
+  case 682: /* attr_class_spec: ATTR_TOURI  */
+#line 2786 "core/cfg.y"
+                     { s_attr->type |= AVP_TRACK_TO | AVP_CLASS_URI; }
+#line 10256 "core/cfg.tab.c"
+    break;
+
+  case 683: /* attr_class_spec: ATTR_FROMUSER  */
+#line 2787 "core/cfg.y"
+                        { s_attr->type |= AVP_TRACK_FROM | AVP_CLASS_USER; }
+#line 10262 "core/cfg.tab.c"
+    break;
+
+  case 684: /* attr_class_spec: ATTR_TOUSER  */
+#line 2788 "core/cfg.y"
+                      { s_attr->type |= AVP_TRACK_TO | AVP_CLASS_USER; }
+#line 10268 "core/cfg.tab.c"
+    break;
+
+  case 685: /* attr_class_spec: ATTR_FROMDOMAIN  */
+#line 2789 "core/cfg.y"
+                          { s_attr->type |= AVP_TRACK_FROM | AVP_CLASS_DOMAIN; }
+#line 10274 "core/cfg.tab.c"
+    break;
+
+  case 686: /* attr_class_spec: ATTR_TODOMAIN  */
+#line 2790 "core/cfg.y"
+                        { s_attr->type |= AVP_TRACK_TO | AVP_CLASS_DOMAIN; }
+#line 10280 "core/cfg.tab.c"
+    break;
+
+  case 687: /* attr_class_spec: ATTR_GLOBAL  */
+#line 2791 "core/cfg.y"
+                      { s_attr->type |= AVP_TRACK_ALL | AVP_CLASS_GLOBAL; }
+#line 10286 "core/cfg.tab.c"
+    break;
+
+  case 688: /* attr_name_spec: ID  */
+#line 2794 "core/cfg.y"
+           { s_attr->type |= AVP_NAME_STR; s_attr->name.s.s = (yyvsp[0].strval); s_attr->name.s.len = strlen ((yyvsp[0].strval)); }
+#line 10292 "core/cfg.tab.c"
+    break;
+
+  case 691: /* attr_mark: ATTR_MARK  */
+#line 2801 "core/cfg.y"
+                  {
+		s_attr = (struct avp_spec*)pkg_malloc(sizeof(struct avp_spec));
+		if (!s_attr) { yyerror("No memory left"); YYABORT; }
+		else { memset(s_attr, 0, (sizeof(struct avp_spec))); }
+	}
+#line 10302 "core/cfg.tab.c"
+    break;
+
+  case 692: /* attr_id: attr_mark attr_spec  */
+#line 2808 "core/cfg.y"
+                            { (yyval.attr) = s_attr; }
+#line 10308 "core/cfg.tab.c"
+    break;
+
+  case 693: /* attr_id_num_idx: attr_mark attr_spec LBRACK intno RBRACK  */
+#line 2811 "core/cfg.y"
+                                                {
+		s_attr->type|= (AVP_NAME_STR | ((yyvsp[-1].intval)<0?AVP_INDEX_BACKWARD:AVP_INDEX_FORWARD));
+		s_attr->index = ((yyvsp[-1].intval)<0?-(yyvsp[-1].intval):(yyvsp[-1].intval));
+		(yyval.attr) = s_attr;
+	}
+#line 10318 "core/cfg.tab.c"
+    break;
+
+  case 694: /* attr_id_no_idx: attr_mark attr_spec LBRACK RBRACK  */
+#line 2818 "core/cfg.y"
+                                          {
+		s_attr->type|= AVP_INDEX_ALL;
+		(yyval.attr) = s_attr;
+	}
+#line 10327 "core/cfg.tab.c"
+    break;
+
+  case 701: /* attr_id_any_str: avp_pvar  */
+#line 2840 "core/cfg.y"
+                   {
+		if ((yyvsp[0].lval)->type==LV_AVP){
+			s_attr = pkg_malloc(sizeof(struct avp_spec));
+			if (!s_attr) { yyerror("No memory left"); YYABORT; }
+			else{
+				*s_attr=(yyvsp[0].lval)->lv.avps;
+			}
+			(yyval.attr)=s_attr;
+		}else
+			(yyval.attr)=0; /* not an avp, a pvar */
+		pkg_free((yyvsp[0].lval));
+	}
+#line 10344 "core/cfg.tab.c"
+    break;
+
+  case 702: /* attr_id_any_str: STRING  */
+#line 2852 "core/cfg.y"
+                 {
+		avp_spec_t *avp_spec;
+		str s;
+		int type, idx;
+		avp_spec = pkg_malloc(sizeof(*avp_spec));
+		if (!avp_spec) {
+			yyerror("Not enough memory");
+			YYABORT;
+		}
+		s.s = (yyvsp[0].strval);
+		if (s.s[0] == '$')
+			s.s++;
+		s.len = strlen(s.s);
+		if (parse_avp_name(&s, &type, &avp_spec->name, &idx)) {
+			yyerror("error when parsing AVP");
+			pkg_free(avp_spec);
+			YYABORT;
+		}
+		avp_spec->type = type;
+		avp_spec->index = idx;
+		(yyval.attr) = avp_spec;
+	}
+#line 10371 "core/cfg.tab.c"
+    break;
+
+  case 703: /* pvar: PVAR  */
+#line 2876 "core/cfg.y"
+             {
+			s_tmp.s=(yyvsp[0].strval); s_tmp.len=strlen((yyvsp[0].strval));
+			pv_spec=pv_cache_get(&s_tmp);
+			if (!pv_spec) {
+				yyerror("Can't get from cache: %s", (yyvsp[0].strval));
+				YYABORT;
+			}
+			(yyval.pvar)=pv_spec;
+		}
+#line 10385 "core/cfg.tab.c"
+    break;
+
+  case 704: /* avp_pvar: AVP_OR_PVAR  */
+#line 2887 "core/cfg.y"
+                            {
+				lval_tmp=pkg_malloc(sizeof(*lval_tmp));
+				if (!lval_tmp) {
+					yyerror("Not enough memory");
+					YYABORT;
+				}
+				memset(lval_tmp, 0, sizeof(*lval_tmp));
+				s_tmp.s=(yyvsp[0].strval); s_tmp.len=strlen(s_tmp.s);
+				lval_tmp->lv.pvs = pv_cache_get(&s_tmp);
+				if (lval_tmp->lv.pvs==NULL){
+					lval_tmp->lv.avps.type|= AVP_NAME_STR;
+					lval_tmp->lv.avps.name.s.s = s_tmp.s+1;
+					lval_tmp->lv.avps.name.s.len = s_tmp.len-1;
+					lval_tmp->type=LV_AVP;
+				}else{
+					lval_tmp->type=LV_PVAR;
+				}
+				(yyval.lval) = lval_tmp;
+				DBG("parsed ambiguous avp/pvar \"%.*s\" to %d\n",
+							s_tmp.len, s_tmp.s, lval_tmp->type);
+			}
+#line 10411 "core/cfg.tab.c"
+    break;
+
+  case 705: /* assign_op: EQUAL  */
+#line 2918 "core/cfg.y"
+              { (yyval.intval) = ASSIGN_T; }
+#line 10417 "core/cfg.tab.c"
+    break;
+
+  case 706: /* lval: attr_id_ass  */
+#line 2922 "core/cfg.y"
+                  {
+					lval_tmp=pkg_malloc(sizeof(*lval_tmp));
+					if (!lval_tmp) {
+						yyerror("Not enough memory");
+						YYABORT;
+					}
+					lval_tmp->type=LV_AVP; lval_tmp->lv.avps=*(yyvsp[0].attr);
+					pkg_free((yyvsp[0].attr)); /* free the avp spec we just copied */
+					(yyval.lval)=lval_tmp;
+				}
+#line 10432 "core/cfg.tab.c"
+    break;
+
+  case 707: /* lval: pvar  */
+#line 2932 "core/cfg.y"
+                      {
+					if (!pv_is_w((yyvsp[0].pvar)))
+						yyerror("read only pvar in assignment left side");
+					if ((yyvsp[0].pvar)->trans!=0)
+						yyerror("pvar with transformations in assignment"
+								" left side");
+					lval_tmp=pkg_malloc(sizeof(*lval_tmp));
+					if (!lval_tmp) {
+						yyerror("Not enough memory");
+						YYABORT;
+					}
+					lval_tmp->type=LV_PVAR; lval_tmp->lv.pvs=(yyvsp[0].pvar);
+					(yyval.lval)=lval_tmp;
+				}
+#line 10451 "core/cfg.tab.c"
+    break;
+
+  case 708: /* lval: avp_pvar  */
+#line 2946 "core/cfg.y"
+                      {
+					if (((yyvsp[0].lval))->type==LV_PVAR){
+						if (!pv_is_w((yyvsp[0].lval)->lv.pvs))
+							yyerror("read only pvar in assignment left side");
+						if ((yyvsp[0].lval)->lv.pvs->trans!=0)
+							yyerror("pvar with transformations in assignment"
+									" left side");
+					}
+					(yyval.lval)=(yyvsp[0].lval);
+				}
+#line 10466 "core/cfg.tab.c"
+    break;
+
+  case 709: /* rval: intno  */
+#line 2958 "core/cfg.y"
+                                {(yyval.rv_expr)=mk_rve_rval(RV_INT, (void*)(yyvsp[0].intval)); }
+#line 10472 "core/cfg.tab.c"
+    break;
+
+  case 710: /* rval: STRING  */
+#line 2959 "core/cfg.y"
+                                        {	s_tmp.s=(yyvsp[0].strval); s_tmp.len=strlen((yyvsp[0].strval));
+							(yyval.rv_expr)=mk_rve_rval(RV_STR, &s_tmp); }
+#line 10479 "core/cfg.tab.c"
+    break;
+
+  case 711: /* rval: attr_id_any  */
+#line 2961 "core/cfg.y"
+                                {(yyval.rv_expr)=mk_rve_rval(RV_AVP, (yyvsp[0].attr)); pkg_free((yyvsp[0].attr)); }
+#line 10485 "core/cfg.tab.c"
+    break;
+
+  case 712: /* rval: pvar  */
+#line 2962 "core/cfg.y"
+                                        {(yyval.rv_expr)=mk_rve_rval(RV_PVAR, (yyvsp[0].pvar)); }
+#line 10491 "core/cfg.tab.c"
+    break;
+
+  case 713: /* rval: avp_pvar  */
+#line 2963 "core/cfg.y"
+                                        {
+							switch((yyvsp[0].lval)->type){
+								case LV_AVP:
+									(yyval.rv_expr)=mk_rve_rval(RV_AVP, &(yyvsp[0].lval)->lv.avps);
+									break;
+								case LV_PVAR:
+									(yyval.rv_expr)=mk_rve_rval(RV_PVAR, (yyvsp[0].lval)->lv.pvs);
+									break;
+								default:
+									yyerror("BUG: invalid lvalue type ");
+									YYABORT;
+							}
+							pkg_free((yyvsp[0].lval)); /* not needed anymore */
+						}
+#line 10510 "core/cfg.tab.c"
+    break;
+
+  case 714: /* rval: select_id  */
+#line 2977 "core/cfg.y"
+                                        {(yyval.rv_expr)=mk_rve_rval(RV_SEL, (yyvsp[0].select)); pkg_free((yyvsp[0].select)); }
+#line 10516 "core/cfg.tab.c"
+    break;
+
+  case 715: /* rval: fcmd  */
+#line 2978 "core/cfg.y"
+                                        {(yyval.rv_expr)=mk_rve_rval(RV_ACTION_ST, (yyvsp[0].action)); }
+#line 10522 "core/cfg.tab.c"
+    break;
+
+  case 716: /* rval: exp_elem  */
+#line 2979 "core/cfg.y"
+                   { (yyval.rv_expr)=mk_rve_rval(RV_BEXPR, (yyvsp[0].expr)); }
+#line 10528 "core/cfg.tab.c"
+    break;
+
+  case 717: /* rval: LBRACE actions RBRACE  */
+#line 2980 "core/cfg.y"
+                                {(yyval.rv_expr)=mk_rve_rval(RV_ACTION_ST, (yyvsp[-1].action)); }
+#line 10534 "core/cfg.tab.c"
+    break;
+
+  case 718: /* rval: LBRACE error RBRACE  */
+#line 2981 "core/cfg.y"
+                                { (yyval.rv_expr)=0; yyerror("bad command block"); }
+#line 10540 "core/cfg.tab.c"
+    break;
+
+  case 719: /* rval: LPAREN assign_action RPAREN  */
+#line 2982 "core/cfg.y"
+                                        {(yyval.rv_expr)=mk_rve_rval(RV_ACTION_ST, (yyvsp[-1].action)); }
+#line 10546 "core/cfg.tab.c"
+    break;
+
+  case 720: /* rval: LPAREN error RPAREN  */
+#line 2983 "core/cfg.y"
+                                { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 10552 "core/cfg.tab.c"
+    break;
+
+  case 721: /* rve_un_op: NOT  */
+#line 2987 "core/cfg.y"
+                { (yyval.intval)=RVE_LNOT_OP; }
+#line 10558 "core/cfg.tab.c"
+    break;
+
+  case 722: /* rve_un_op: BIN_NOT  */
+#line 2988 "core/cfg.y"
+                                { (yyval.intval)=RVE_BNOT_OP; }
+#line 10564 "core/cfg.tab.c"
+    break;
+
+  case 723: /* rve_un_op: MINUS  */
+#line 2989 "core/cfg.y"
+                                        { (yyval.intval)=RVE_UMINUS_OP; }
+#line 10570 "core/cfg.tab.c"
+    break;
+
+  case 724: /* rval_expr: rval  */
+#line 3002 "core/cfg.y"
+                                                        { (yyval.rv_expr)=(yyvsp[0].rv_expr);
+										if ((yyval.rv_expr)==0){
+											/*yyerror("out of memory\n");*/
+											YYERROR;
+										}
+									}
+#line 10581 "core/cfg.tab.c"
+    break;
+
+  case 725: /* rval_expr: rve_un_op rval_expr  */
+#line 3008 "core/cfg.y"
+                                                        {(yyval.rv_expr)=mk_rve1((yyvsp[-1].intval), (yyvsp[0].rv_expr)); }
+#line 10587 "core/cfg.tab.c"
+    break;
+
+  case 726: /* rval_expr: INTCAST rval_expr  */
+#line 3009 "core/cfg.y"
+                                                                {(yyval.rv_expr)=mk_rve1(RVE_INT_OP, (yyvsp[0].rv_expr)); }
+#line 10593 "core/cfg.tab.c"
+    break;
+
+  case 727: /* rval_expr: STRCAST rval_expr  */
+#line 3010 "core/cfg.y"
+                                                                {(yyval.rv_expr)=mk_rve1(RVE_STR_OP, (yyvsp[0].rv_expr)); }
+#line 10599 "core/cfg.tab.c"
+    break;
+
+  case 728: /* rval_expr: rval_expr PLUS rval_expr  */
+#line 3011 "core/cfg.y"
+                                                        {(yyval.rv_expr)=mk_rve2(RVE_PLUS_OP, (yyvsp[-2].rv_expr), (yyvsp[0].rv_expr)); }
+#line 10605 "core/cfg.tab.c"
+    break;
+
+  case 729: /* rval_expr: rval_expr MINUS rval_expr  */
+#line 3012 "core/cfg.y"
+                                                        {(yyval.rv_expr)=mk_rve2(RVE_MINUS_OP, (yyvsp[-2].rv_expr), (yyvsp[0].rv_expr)); }
+#line 10611 "core/cfg.tab.c"
+    break;
+
+  case 730: /* rval_expr: rval_expr STAR rval_expr  */
+#line 3013 "core/cfg.y"
+                                                        {(yyval.rv_expr)=mk_rve2(RVE_MUL_OP, (yyvsp[-2].rv_expr), (yyvsp[0].rv_expr)); }
+#line 10617 "core/cfg.tab.c"
+    break;
+
+  case 731: /* rval_expr: rval_expr SLASH rval_expr  */
+#line 3014 "core/cfg.y"
+                                                        {(yyval.rv_expr)=mk_rve2(RVE_DIV_OP, (yyvsp[-2].rv_expr), (yyvsp[0].rv_expr)); }
+#line 10623 "core/cfg.tab.c"
+    break;
+
+  case 732: /* rval_expr: rval_expr MODULO rval_expr  */
+#line 3015 "core/cfg.y"
+                                                {(yyval.rv_expr)=mk_rve2(RVE_MOD_OP, (yyvsp[-2].rv_expr), (yyvsp[0].rv_expr)); }
+#line 10629 "core/cfg.tab.c"
+    break;
+
+  case 733: /* rval_expr: rval_expr BIN_OR rval_expr  */
+#line 3016 "core/cfg.y"
+                                                {(yyval.rv_expr)=mk_rve2(RVE_BOR_OP, (yyvsp[-2].rv_expr),  (yyvsp[0].rv_expr)); }
+#line 10635 "core/cfg.tab.c"
+    break;
+
+  case 734: /* rval_expr: rval_expr BIN_AND rval_expr  */
+#line 3017 "core/cfg.y"
+                                                {(yyval.rv_expr)=mk_rve2(RVE_BAND_OP, (yyvsp[-2].rv_expr),  (yyvsp[0].rv_expr));}
+#line 10641 "core/cfg.tab.c"
+    break;
+
+  case 735: /* rval_expr: rval_expr BIN_XOR rval_expr  */
+#line 3018 "core/cfg.y"
+                                                {(yyval.rv_expr)=mk_rve2(RVE_BXOR_OP, (yyvsp[-2].rv_expr),  (yyvsp[0].rv_expr));}
+#line 10647 "core/cfg.tab.c"
+    break;
+
+  case 736: /* rval_expr: rval_expr BIN_LSHIFT rval_expr  */
+#line 3019 "core/cfg.y"
+                                                 {(yyval.rv_expr)=mk_rve2(RVE_BLSHIFT_OP, (yyvsp[-2].rv_expr),  (yyvsp[0].rv_expr));}
+#line 10653 "core/cfg.tab.c"
+    break;
+
+  case 737: /* rval_expr: rval_expr BIN_RSHIFT rval_expr  */
+#line 3020 "core/cfg.y"
+                                                 {(yyval.rv_expr)=mk_rve2(RVE_BRSHIFT_OP, (yyvsp[-2].rv_expr),  (yyvsp[0].rv_expr));}
+#line 10659 "core/cfg.tab.c"
+    break;
+
+  case 738: /* rval_expr: rval_expr rve_cmpop rval_expr  */
+#line 3021 "core/cfg.y"
+                                                         { (yyval.rv_expr)=mk_rve2( (yyvsp[-1].intval), (yyvsp[-2].rv_expr), (yyvsp[0].rv_expr));}
+#line 10665 "core/cfg.tab.c"
+    break;
+
+  case 739: /* rval_expr: rval_expr rve_equalop rval_expr  */
+#line 3022 "core/cfg.y"
+                                                                {
+			/* comparing with $null => treat as defined or !defined */
+			if((yyvsp[0].rv_expr) != NULL && (yyvsp[0].rv_expr)->op==RVE_RVAL_OP && (yyvsp[0].rv_expr)->left.rval.type==RV_PVAR
+					&& (yyvsp[0].rv_expr)->left.rval.v.pvs.type==PVT_NULL) {
+				if((yyvsp[-1].intval)==RVE_DIFF_OP || (yyvsp[-1].intval)==RVE_IDIFF_OP
+						|| (yyvsp[-1].intval)==RVE_STRDIFF_OP) {
+					DBG("comparison with $null switched to notdefined operator\n");
+					(yyval.rv_expr)=mk_rve1(RVE_DEFINED_OP, (yyvsp[-2].rv_expr));
+				} else {
+					DBG("comparison with $null switched to defined operator\n");
+					(yyval.rv_expr)=mk_rve1(RVE_NOTDEFINED_OP, (yyvsp[-2].rv_expr));
+				}
+				/* free rve struct for $null */
+				rve_destroy((yyvsp[0].rv_expr));
+			} else {
+				(yyval.rv_expr)=mk_rve2((yyvsp[-1].intval), (yyvsp[-2].rv_expr), (yyvsp[0].rv_expr));
+			}
+		}
+#line 10688 "core/cfg.tab.c"
+    break;
+
+  case 740: /* rval_expr: rval_expr LOG_AND rval_expr  */
+#line 3040 "core/cfg.y"
+                                                { (yyval.rv_expr)=mk_rve2(RVE_LAND_OP, (yyvsp[-2].rv_expr), (yyvsp[0].rv_expr));}
+#line 10694 "core/cfg.tab.c"
+    break;
+
+  case 741: /* rval_expr: rval_expr LOG_OR rval_expr  */
+#line 3041 "core/cfg.y"
+                                                { (yyval.rv_expr)=mk_rve2(RVE_LOR_OP, (yyvsp[-2].rv_expr), (yyvsp[0].rv_expr));}
+#line 10700 "core/cfg.tab.c"
+    break;
+
+  case 742: /* rval_expr: LPAREN rval_expr RPAREN  */
+#line 3042 "core/cfg.y"
+                                                        { (yyval.rv_expr)=(yyvsp[-1].rv_expr);}
+#line 10706 "core/cfg.tab.c"
+    break;
+
+  case 743: /* rval_expr: STRLEN LPAREN rval_expr RPAREN  */
+#line 3043 "core/cfg.y"
+                                                 { (yyval.rv_expr)=mk_rve1(RVE_STRLEN_OP, (yyvsp[-1].rv_expr));}
+#line 10712 "core/cfg.tab.c"
+    break;
+
+  case 744: /* rval_expr: STREMPTY LPAREN rval_expr RPAREN  */
+#line 3044 "core/cfg.y"
+                                                   {(yyval.rv_expr)=mk_rve1(RVE_STREMPTY_OP, (yyvsp[-1].rv_expr));}
+#line 10718 "core/cfg.tab.c"
+    break;
+
+  case 745: /* rval_expr: DEFINED rval_expr  */
+#line 3045 "core/cfg.y"
+                                                                { (yyval.rv_expr)=mk_rve1(RVE_DEFINED_OP, (yyvsp[0].rv_expr));}
+#line 10724 "core/cfg.tab.c"
+    break;
+
+  case 746: /* rval_expr: SELVAL LPAREN rval_expr COMMA rval_expr COMMA rval_expr RPAREN  */
+#line 3046 "core/cfg.y"
+                                                                                 {
+				rve_tmp=mk_rve2(RVE_SELVALOPT_OP, (yyvsp[-3].rv_expr), (yyvsp[-1].rv_expr));
+				if(rve_tmp == NULL) {
+					(yyval.rv_expr)=0;
+					yyerror("faild to create tenary target expression");
+				}
+				(yyval.rv_expr)=mk_rve2(RVE_SELVALEXP_OP, (yyvsp[-5].rv_expr), rve_tmp);
+		}
+#line 10737 "core/cfg.tab.c"
+    break;
+
+  case 747: /* rval_expr: rve_un_op error  */
+#line 3054 "core/cfg.y"
+                                                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 10743 "core/cfg.tab.c"
+    break;
+
+  case 748: /* rval_expr: INTCAST error  */
+#line 3055 "core/cfg.y"
+                                                                { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 10749 "core/cfg.tab.c"
+    break;
+
+  case 749: /* rval_expr: STRCAST error  */
+#line 3056 "core/cfg.y"
+                                                                { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 10755 "core/cfg.tab.c"
+    break;
+
+  case 750: /* rval_expr: rval_expr PLUS error  */
+#line 3057 "core/cfg.y"
+                                                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 10761 "core/cfg.tab.c"
+    break;
+
+  case 751: /* rval_expr: rval_expr MINUS error  */
+#line 3058 "core/cfg.y"
+                                                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 10767 "core/cfg.tab.c"
+    break;
+
+  case 752: /* rval_expr: rval_expr STAR error  */
+#line 3059 "core/cfg.y"
+                                                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 10773 "core/cfg.tab.c"
+    break;
+
+  case 753: /* rval_expr: rval_expr SLASH error  */
+#line 3060 "core/cfg.y"
+                                                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 10779 "core/cfg.tab.c"
+    break;
+
+  case 754: /* rval_expr: rval_expr MODULO error  */
+#line 3061 "core/cfg.y"
+                                                                { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 10785 "core/cfg.tab.c"
+    break;
+
+  case 755: /* rval_expr: rval_expr BIN_OR error  */
+#line 3062 "core/cfg.y"
+                                                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 10791 "core/cfg.tab.c"
+    break;
+
+  case 756: /* rval_expr: rval_expr BIN_AND error  */
+#line 3063 "core/cfg.y"
+                                                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 10797 "core/cfg.tab.c"
+    break;
+
+  case 757: /* rval_expr: rval_expr rve_cmpop error  */
+#line 3065 "core/cfg.y"
+                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 10803 "core/cfg.tab.c"
+    break;
+
+  case 758: /* rval_expr: rval_expr rve_equalop error  */
+#line 3067 "core/cfg.y"
+                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 10809 "core/cfg.tab.c"
+    break;
+
+  case 759: /* rval_expr: rval_expr LOG_AND error  */
+#line 3068 "core/cfg.y"
+                                                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 10815 "core/cfg.tab.c"
+    break;
+
+  case 760: /* rval_expr: rval_expr LOG_OR error  */
+#line 3069 "core/cfg.y"
+                                                        { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 10821 "core/cfg.tab.c"
+    break;
+
+  case 761: /* rval_expr: STRLEN LPAREN error RPAREN  */
+#line 3070 "core/cfg.y"
+                                                { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 10827 "core/cfg.tab.c"
+    break;
+
+  case 762: /* rval_expr: STREMPTY LPAREN error RPAREN  */
+#line 3071 "core/cfg.y"
+                                                { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 10833 "core/cfg.tab.c"
+    break;
+
+  case 763: /* rval_expr: SELVAL LPAREN error RPAREN  */
+#line 3072 "core/cfg.y"
+                                                { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 10839 "core/cfg.tab.c"
+    break;
+
+  case 764: /* rval_expr: DEFINED error  */
+#line 3073 "core/cfg.y"
+                                                                { (yyval.rv_expr)=0; yyerror("bad expression"); }
+#line 10845 "core/cfg.tab.c"
+    break;
+
+  case 765: /* assign_action: lval assign_op rval_expr  */
+#line 3076 "core/cfg.y"
+                                                { (yyval.action)=mk_action((yyvsp[-1].intval), 2, LVAL_ST, (yyvsp[-2].lval),
+														 	  RVE_ST, (yyvsp[0].rv_expr));
+											set_cfg_pos((yyval.action));
+										}
+#line 10854 "core/cfg.tab.c"
+    break;
+
+  case 766: /* avpflag_oper: SETAVPFLAG  */
+#line 3094 "core/cfg.y"
+                   { (yyval.intval) = 1; }
+#line 10860 "core/cfg.tab.c"
+    break;
+
+  case 767: /* avpflag_oper: RESETAVPFLAG  */
+#line 3095 "core/cfg.y"
+                       { (yyval.intval) = 0; }
+#line 10866 "core/cfg.tab.c"
+    break;
+
+  case 768: /* avpflag_oper: ISAVPFLAGSET  */
+#line 3096 "core/cfg.y"
+                       { (yyval.intval) = -1; }
+#line 10872 "core/cfg.tab.c"
+    break;
+
+  case 769: /* cmd: FORWARD LPAREN RPAREN  */
+#line 3099 "core/cfg.y"
+                              { (yyval.action)=mk_action(FORWARD_T, 2, URIHOST_ST, 0, URIPORT_ST, 0); set_cfg_pos((yyval.action)); }
+#line 10878 "core/cfg.tab.c"
+    break;
+
+  case 770: /* cmd: FORWARD LPAREN host RPAREN  */
+#line 3100 "core/cfg.y"
+                                        { (yyval.action)=mk_action(	FORWARD_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 10884 "core/cfg.tab.c"
+    break;
+
+  case 771: /* cmd: FORWARD LPAREN STRING RPAREN  */
+#line 3101 "core/cfg.y"
+                                        { (yyval.action)=mk_action(	FORWARD_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 10890 "core/cfg.tab.c"
+    break;
+
+  case 772: /* cmd: FORWARD LPAREN ip RPAREN  */
+#line 3102 "core/cfg.y"
+                                        { (yyval.action)=mk_action(	FORWARD_T, 2, IP_ST, (void*)(yyvsp[-1].ipaddr), NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 10896 "core/cfg.tab.c"
+    break;
+
+  case 773: /* cmd: FORWARD LPAREN host COMMA NUMBER RPAREN  */
+#line 3103 "core/cfg.y"
+                                                  { (yyval.action)=mk_action(FORWARD_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 10902 "core/cfg.tab.c"
+    break;
+
+  case 774: /* cmd: FORWARD LPAREN STRING COMMA NUMBER RPAREN  */
+#line 3104 "core/cfg.y"
+                                                    {(yyval.action)=mk_action(FORWARD_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 10908 "core/cfg.tab.c"
+    break;
+
+  case 775: /* cmd: FORWARD LPAREN ip COMMA NUMBER RPAREN  */
+#line 3105 "core/cfg.y"
+                                                { (yyval.action)=mk_action(FORWARD_T, 2, IP_ST, (void*)(yyvsp[-3].ipaddr), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 10914 "core/cfg.tab.c"
+    break;
+
+  case 776: /* cmd: FORWARD LPAREN URIHOST COMMA URIPORT RPAREN  */
+#line 3106 "core/cfg.y"
+                                                      { (yyval.action)=mk_action(FORWARD_T, 2, URIHOST_ST, 0, URIPORT_ST, 0); set_cfg_pos((yyval.action)); }
+#line 10920 "core/cfg.tab.c"
+    break;
+
+  case 777: /* cmd: FORWARD LPAREN URIHOST COMMA NUMBER RPAREN  */
+#line 3107 "core/cfg.y"
+                                                     {(yyval.action)=mk_action(FORWARD_T, 2, URIHOST_ST, 0, NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 10926 "core/cfg.tab.c"
+    break;
+
+  case 778: /* cmd: FORWARD LPAREN URIHOST RPAREN  */
+#line 3108 "core/cfg.y"
+                                        { (yyval.action)=mk_action(FORWARD_T, 2, URIHOST_ST, 0, NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 10932 "core/cfg.tab.c"
+    break;
+
+  case 779: /* cmd: FORWARD error  */
+#line 3109 "core/cfg.y"
+                        { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 10938 "core/cfg.tab.c"
+    break;
+
+  case 780: /* cmd: FORWARD LPAREN error RPAREN  */
+#line 3110 "core/cfg.y"
+                                      { (yyval.action)=0; yyerror("bad forward argument"); }
+#line 10944 "core/cfg.tab.c"
+    break;
+
+  case 781: /* cmd: FORWARD_UDP LPAREN host RPAREN  */
+#line 3111 "core/cfg.y"
+                                                { (yyval.action)=mk_action(FORWARD_UDP_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 10950 "core/cfg.tab.c"
+    break;
+
+  case 782: /* cmd: FORWARD_UDP LPAREN STRING RPAREN  */
+#line 3112 "core/cfg.y"
+                                                { (yyval.action)=mk_action(FORWARD_UDP_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 10956 "core/cfg.tab.c"
+    break;
+
+  case 783: /* cmd: FORWARD_UDP LPAREN ip RPAREN  */
+#line 3113 "core/cfg.y"
+                                        { (yyval.action)=mk_action(FORWARD_UDP_T, 2, IP_ST, (void*)(yyvsp[-1].ipaddr), NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 10962 "core/cfg.tab.c"
+    break;
+
+  case 784: /* cmd: FORWARD_UDP LPAREN host COMMA NUMBER RPAREN  */
+#line 3114 "core/cfg.y"
+                                                      { (yyval.action)=mk_action(FORWARD_UDP_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 10968 "core/cfg.tab.c"
+    break;
+
+  case 785: /* cmd: FORWARD_UDP LPAREN STRING COMMA NUMBER RPAREN  */
+#line 3115 "core/cfg.y"
+                                                        {(yyval.action)=mk_action(FORWARD_UDP_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 10974 "core/cfg.tab.c"
+    break;
+
+  case 786: /* cmd: FORWARD_UDP LPAREN ip COMMA NUMBER RPAREN  */
+#line 3116 "core/cfg.y"
+                                                    { (yyval.action)=mk_action(FORWARD_UDP_T, 2, IP_ST, (void*)(yyvsp[-3].ipaddr), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 10980 "core/cfg.tab.c"
+    break;
+
+  case 787: /* cmd: FORWARD_UDP LPAREN URIHOST COMMA URIPORT RPAREN  */
+#line 3117 "core/cfg.y"
+                                                          {(yyval.action)=mk_action(FORWARD_UDP_T, 2, URIHOST_ST, 0, URIPORT_ST, 0); set_cfg_pos((yyval.action)); }
+#line 10986 "core/cfg.tab.c"
+    break;
+
+  case 788: /* cmd: FORWARD_UDP LPAREN URIHOST COMMA NUMBER RPAREN  */
+#line 3118 "core/cfg.y"
+                                                         { (yyval.action)=mk_action(FORWARD_UDP_T, 2, URIHOST_ST, 0, NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 10992 "core/cfg.tab.c"
+    break;
+
+  case 789: /* cmd: FORWARD_UDP LPAREN URIHOST RPAREN  */
+#line 3119 "core/cfg.y"
+                                            { (yyval.action)=mk_action(FORWARD_UDP_T, 2, URIHOST_ST, 0, NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 10998 "core/cfg.tab.c"
+    break;
+
+  case 790: /* cmd: FORWARD_UDP error  */
+#line 3120 "core/cfg.y"
+                            { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11004 "core/cfg.tab.c"
+    break;
+
+  case 791: /* cmd: FORWARD_UDP LPAREN error RPAREN  */
+#line 3121 "core/cfg.y"
+                                          { (yyval.action)=0; yyerror("bad forward_udp argument"); }
+#line 11010 "core/cfg.tab.c"
+    break;
+
+  case 792: /* cmd: FORWARD_TCP LPAREN host RPAREN  */
+#line 3122 "core/cfg.y"
+                                                { (yyval.action)=mk_action(FORWARD_TCP_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 11016 "core/cfg.tab.c"
+    break;
+
+  case 793: /* cmd: FORWARD_TCP LPAREN STRING RPAREN  */
+#line 3123 "core/cfg.y"
+                                                { (yyval.action)=mk_action(FORWARD_TCP_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 11022 "core/cfg.tab.c"
+    break;
+
+  case 794: /* cmd: FORWARD_TCP LPAREN ip RPAREN  */
+#line 3124 "core/cfg.y"
+                                        { (yyval.action)=mk_action(FORWARD_TCP_T, 2, IP_ST, (void*)(yyvsp[-1].ipaddr), NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 11028 "core/cfg.tab.c"
+    break;
+
+  case 795: /* cmd: FORWARD_TCP LPAREN host COMMA NUMBER RPAREN  */
+#line 3125 "core/cfg.y"
+                                                      { (yyval.action)=mk_action(FORWARD_TCP_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 11034 "core/cfg.tab.c"
+    break;
+
+  case 796: /* cmd: FORWARD_TCP LPAREN STRING COMMA NUMBER RPAREN  */
+#line 3126 "core/cfg.y"
+                                                        {(yyval.action)=mk_action(FORWARD_TCP_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 11040 "core/cfg.tab.c"
+    break;
+
+  case 797: /* cmd: FORWARD_TCP LPAREN ip COMMA NUMBER RPAREN  */
+#line 3127 "core/cfg.y"
+                                                    { (yyval.action)=mk_action(FORWARD_TCP_T, 2, IP_ST, (void*)(yyvsp[-3].ipaddr), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 11046 "core/cfg.tab.c"
+    break;
+
+  case 798: /* cmd: FORWARD_TCP LPAREN URIHOST COMMA URIPORT RPAREN  */
+#line 3128 "core/cfg.y"
+                                                          {(yyval.action)=mk_action(FORWARD_TCP_T, 2, URIHOST_ST, 0, URIPORT_ST, 0); set_cfg_pos((yyval.action)); }
+#line 11052 "core/cfg.tab.c"
+    break;
+
+  case 799: /* cmd: FORWARD_TCP LPAREN URIHOST COMMA NUMBER RPAREN  */
+#line 3129 "core/cfg.y"
+                                                         { (yyval.action)=mk_action(FORWARD_TCP_T, 2, URIHOST_ST, 0, NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 11058 "core/cfg.tab.c"
+    break;
+
+  case 800: /* cmd: FORWARD_TCP LPAREN URIHOST RPAREN  */
+#line 3130 "core/cfg.y"
+                                            { (yyval.action)=mk_action(FORWARD_TCP_T, 2, URIHOST_ST, 0, NUMBER_ST, 0); set_cfg_pos((yyval.action)); }
+#line 11064 "core/cfg.tab.c"
+    break;
+
+  case 801: /* cmd: FORWARD_TCP error  */
+#line 3131 "core/cfg.y"
+                            { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11070 "core/cfg.tab.c"
+    break;
+
+  case 802: /* cmd: FORWARD_TCP LPAREN error RPAREN  */
+#line 3132 "core/cfg.y"
+                                          { (yyval.action)=0; yyerror("bad forward_tcp argument"); }
+#line 11076 "core/cfg.tab.c"
+    break;
+
+  case 803: /* cmd: FORWARD_TLS LPAREN host RPAREN  */
+#line 3133 "core/cfg.y"
+                                         {
+		#ifdef USE_TLS
+			(yyval.action)=mk_action(FORWARD_TLS_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+	}
+#line 11089 "core/cfg.tab.c"
+    break;
+
+  case 804: /* cmd: FORWARD_TLS LPAREN STRING RPAREN  */
+#line 3141 "core/cfg.y"
+                                           {
+		#ifdef USE_TLS
+			(yyval.action)=mk_action(FORWARD_TLS_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+	}
+#line 11102 "core/cfg.tab.c"
+    break;
+
+  case 805: /* cmd: FORWARD_TLS LPAREN ip RPAREN  */
+#line 3149 "core/cfg.y"
+                                        {
+		#ifdef USE_TLS
+			(yyval.action)=mk_action(FORWARD_TLS_T, 2, IP_ST, (void*)(yyvsp[-1].ipaddr), NUMBER_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+	}
+#line 11115 "core/cfg.tab.c"
+    break;
+
+  case 806: /* cmd: FORWARD_TLS LPAREN host COMMA NUMBER RPAREN  */
+#line 3157 "core/cfg.y"
+                                                      {
+		#ifdef USE_TLS
+			(yyval.action)=mk_action(FORWARD_TLS_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+	}
+#line 11128 "core/cfg.tab.c"
+    break;
+
+  case 807: /* cmd: FORWARD_TLS LPAREN STRING COMMA NUMBER RPAREN  */
+#line 3165 "core/cfg.y"
+                                                        {
+		#ifdef USE_TLS
+			(yyval.action)=mk_action(FORWARD_TLS_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+	}
+#line 11141 "core/cfg.tab.c"
+    break;
+
+  case 808: /* cmd: FORWARD_TLS LPAREN ip COMMA NUMBER RPAREN  */
+#line 3173 "core/cfg.y"
+                                                    {
+		#ifdef USE_TLS
+			(yyval.action)=mk_action(FORWARD_TLS_T, 2, IP_ST, (void*)(yyvsp[-3].ipaddr), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+					}
+#line 11154 "core/cfg.tab.c"
+    break;
+
+  case 809: /* cmd: FORWARD_TLS LPAREN URIHOST COMMA URIPORT RPAREN  */
+#line 3181 "core/cfg.y"
+                                                          {
+		#ifdef USE_TLS
+			(yyval.action)=mk_action(FORWARD_TLS_T, 2, URIHOST_ST, 0, URIPORT_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+	}
+#line 11167 "core/cfg.tab.c"
+    break;
+
+  case 810: /* cmd: FORWARD_TLS LPAREN URIHOST COMMA NUMBER RPAREN  */
+#line 3189 "core/cfg.y"
+                                                         {
+		#ifdef USE_TLS
+			(yyval.action)=mk_action(FORWARD_TLS_T, 2, URIHOST_ST, 0, NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+	}
+#line 11180 "core/cfg.tab.c"
+    break;
+
+  case 811: /* cmd: FORWARD_TLS LPAREN URIHOST RPAREN  */
+#line 3197 "core/cfg.y"
+                                            {
+		#ifdef USE_TLS
+			(yyval.action)=mk_action(FORWARD_TLS_T, 2, URIHOST_ST, 0, NUMBER_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+	}
+#line 11193 "core/cfg.tab.c"
+    break;
+
+  case 812: /* cmd: FORWARD_TLS error  */
+#line 3205 "core/cfg.y"
+                            { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11199 "core/cfg.tab.c"
+    break;
+
+  case 813: /* cmd: FORWARD_TLS LPAREN error RPAREN  */
+#line 3206 "core/cfg.y"
+                                          { (yyval.action)=0;
+									yyerror("bad forward_tls argument"); }
+#line 11206 "core/cfg.tab.c"
+    break;
+
+  case 814: /* cmd: FORWARD_SCTP LPAREN host RPAREN  */
+#line 3208 "core/cfg.y"
+                                          {
+		#ifdef USE_SCTP
+			(yyval.action)=mk_action(FORWARD_SCTP_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("sctp support not compiled in");
+		#endif
+	}
+#line 11219 "core/cfg.tab.c"
+    break;
+
+  case 815: /* cmd: FORWARD_SCTP LPAREN STRING RPAREN  */
+#line 3216 "core/cfg.y"
+                                            {
+		#ifdef USE_SCTP
+			(yyval.action)=mk_action(FORWARD_SCTP_T, 2, STRING_ST, (yyvsp[-1].strval), NUMBER_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("sctp support not compiled in");
+		#endif
+	}
+#line 11232 "core/cfg.tab.c"
+    break;
+
+  case 816: /* cmd: FORWARD_SCTP LPAREN ip RPAREN  */
+#line 3224 "core/cfg.y"
+                                        {
+		#ifdef USE_SCTP
+			(yyval.action)=mk_action(FORWARD_SCTP_T, 2, IP_ST, (void*)(yyvsp[-1].ipaddr), NUMBER_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("sctp support not compiled in");
+		#endif
+	}
+#line 11245 "core/cfg.tab.c"
+    break;
+
+  case 817: /* cmd: FORWARD_SCTP LPAREN host COMMA NUMBER RPAREN  */
+#line 3232 "core/cfg.y"
+                                                       {
+		#ifdef USE_SCTP
+			(yyval.action)=mk_action(FORWARD_SCTP_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST,
+							(void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("sctp support not compiled in");
+		#endif
+	}
+#line 11259 "core/cfg.tab.c"
+    break;
+
+  case 818: /* cmd: FORWARD_SCTP LPAREN STRING COMMA NUMBER RPAREN  */
+#line 3241 "core/cfg.y"
+                                                         {
+		#ifdef USE_SCTP
+			(yyval.action)=mk_action(FORWARD_SCTP_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST,
+							(void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("sctp support not compiled in");
+		#endif
+	}
+#line 11273 "core/cfg.tab.c"
+    break;
+
+  case 819: /* cmd: FORWARD_SCTP LPAREN ip COMMA NUMBER RPAREN  */
+#line 3250 "core/cfg.y"
+                                                     {
+		#ifdef USE_SCTP
+			(yyval.action)=mk_action(FORWARD_SCTP_T, 2, IP_ST, (void*)(yyvsp[-3].ipaddr), NUMBER_ST,
+							(void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("sctp support not compiled in");
+		#endif
+					}
+#line 11287 "core/cfg.tab.c"
+    break;
+
+  case 820: /* cmd: FORWARD_SCTP LPAREN URIHOST COMMA URIPORT RPAREN  */
+#line 3259 "core/cfg.y"
+                                                           {
+		#ifdef USE_SCTP
+			(yyval.action)=mk_action(FORWARD_SCTP_T, 2, URIHOST_ST, 0, URIPORT_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("sctp support not compiled in");
+		#endif
+	}
+#line 11300 "core/cfg.tab.c"
+    break;
+
+  case 821: /* cmd: FORWARD_SCTP LPAREN URIHOST COMMA NUMBER RPAREN  */
+#line 3267 "core/cfg.y"
+                                                          {
+		#ifdef USE_SCTP
+			(yyval.action)=mk_action(FORWARD_SCTP_T, 2, URIHOST_ST, 0, NUMBER_ST,
+							(void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("sctp support not compiled in");
+		#endif
+	}
+#line 11314 "core/cfg.tab.c"
+    break;
+
+  case 822: /* cmd: FORWARD_SCTP LPAREN URIHOST RPAREN  */
+#line 3276 "core/cfg.y"
+                                             {
+		#ifdef USE_SCTP
+			(yyval.action)=mk_action(FORWARD_SCTP_T, 2, URIHOST_ST, 0, NUMBER_ST, 0); set_cfg_pos((yyval.action));
+		#else
+			(yyval.action)=0;
+			yyerror("tls support not compiled in");
+		#endif
+	}
+#line 11327 "core/cfg.tab.c"
+    break;
+
+  case 823: /* cmd: FORWARD_SCTP error  */
+#line 3284 "core/cfg.y"
+                             { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11333 "core/cfg.tab.c"
+    break;
+
+  case 824: /* cmd: FORWARD_SCTP LPAREN error RPAREN  */
+#line 3285 "core/cfg.y"
+                                           { (yyval.action)=0;
+									yyerror("bad forward_sctp argument"); }
+#line 11340 "core/cfg.tab.c"
+    break;
+
+  case 825: /* cmd: LOG_TOK LPAREN STRING RPAREN  */
+#line 3287 "core/cfg.y"
+                                        {(yyval.action)=mk_action(LOG_T, 2, NUMBER_ST,
+										(void*)(L_DBG+1), STRING_ST, (yyvsp[-1].strval));
+									set_cfg_pos((yyval.action)); }
+#line 11348 "core/cfg.tab.c"
+    break;
+
+  case 826: /* cmd: LOG_TOK LPAREN NUMBER COMMA STRING RPAREN  */
+#line 3290 "core/cfg.y"
+                                                        {(yyval.action)=mk_action(LOG_T, 2, NUMBER_ST, (void*)(yyvsp[-3].intval), STRING_ST, (yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 11354 "core/cfg.tab.c"
+    break;
+
+  case 827: /* cmd: LOG_TOK error  */
+#line 3291 "core/cfg.y"
+                                        { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11360 "core/cfg.tab.c"
+    break;
+
+  case 828: /* cmd: LOG_TOK LPAREN error RPAREN  */
+#line 3292 "core/cfg.y"
+                                        { (yyval.action)=0; yyerror("bad log argument"); }
+#line 11366 "core/cfg.tab.c"
+    break;
+
+  case 829: /* cmd: SETFLAG LPAREN NUMBER RPAREN  */
+#line 3293 "core/cfg.y"
+                                        {
+							if (check_flag((yyvsp[-1].intval))==-1)
+								yyerror("bad flag value");
+							(yyval.action)=mk_action(SETFLAG_T, 1, NUMBER_ST,
+													(void*)(yyvsp[-1].intval));
+							set_cfg_pos((yyval.action));
+									}
+#line 11378 "core/cfg.tab.c"
+    break;
+
+  case 830: /* cmd: SETFLAG LPAREN flag_name RPAREN  */
+#line 3300 "core/cfg.y"
+                                                {
+							i_tmp=get_flag_no((yyvsp[-1].strval), strlen((yyvsp[-1].strval)));
+							if (i_tmp<0) yyerror("flag not declared");
+							(yyval.action)=mk_action(SETFLAG_T, 1, NUMBER_ST,
+										(void*)(long)i_tmp);
+							set_cfg_pos((yyval.action));
+									}
+#line 11390 "core/cfg.tab.c"
+    break;
+
+  case 831: /* cmd: SETFLAG error  */
+#line 3307 "core/cfg.y"
+                                        { (yyval.action)=0; yyerror("missing '(' or ')'?"); }
+#line 11396 "core/cfg.tab.c"
+    break;
+
+  case 832: /* cmd: RESETFLAG LPAREN NUMBER RPAREN  */
+#line 3308 "core/cfg.y"
+                                         {
+							if (check_flag((yyvsp[-1].intval))==-1)
+								yyerror("bad flag value");
+							(yyval.action)=mk_action(RESETFLAG_T, 1, NUMBER_ST, (void*)(yyvsp[-1].intval));
+							set_cfg_pos((yyval.action));
+									}
+#line 11407 "core/cfg.tab.c"
+    break;
+
+  case 833: /* cmd: RESETFLAG LPAREN flag_name RPAREN  */
+#line 3314 "core/cfg.y"
+                                                {
+							i_tmp=get_flag_no((yyvsp[-1].strval), strlen((yyvsp[-1].strval)));
+							if (i_tmp<0) yyerror("flag not declared");
+							(yyval.action)=mk_action(RESETFLAG_T, 1, NUMBER_ST,
+										(void*)(long)i_tmp);
+							set_cfg_pos((yyval.action));
+									}
+#line 11419 "core/cfg.tab.c"
+    break;
+
+  case 834: /* cmd: RESETFLAG error  */
+#line 3321 "core/cfg.y"
+                                        { (yyval.action)=0; yyerror("missing '(' or ')'?"); }
+#line 11425 "core/cfg.tab.c"
+    break;
+
+  case 835: /* cmd: ISFLAGSET LPAREN NUMBER RPAREN  */
+#line 3322 "core/cfg.y"
+                                         {
+							if (check_flag((yyvsp[-1].intval))==-1)
+								yyerror("bad flag value");
+							(yyval.action)=mk_action(ISFLAGSET_T, 1, NUMBER_ST, (void*)(yyvsp[-1].intval));
+							set_cfg_pos((yyval.action));
+									}
+#line 11436 "core/cfg.tab.c"
+    break;
+
+  case 836: /* cmd: ISFLAGSET LPAREN flag_name RPAREN  */
+#line 3328 "core/cfg.y"
+                                                {
+							i_tmp=get_flag_no((yyvsp[-1].strval), strlen((yyvsp[-1].strval)));
+							if (i_tmp<0) yyerror("flag not declared");
+							(yyval.action)=mk_action(ISFLAGSET_T, 1, NUMBER_ST,
+										(void*)(long)i_tmp);
+							set_cfg_pos((yyval.action));
+									}
+#line 11448 "core/cfg.tab.c"
+    break;
+
+  case 837: /* cmd: ISFLAGSET error  */
+#line 3335 "core/cfg.y"
+                          { (yyval.action)=0; yyerror("missing '(' or ')'?"); }
+#line 11454 "core/cfg.tab.c"
+    break;
+
+  case 838: /* cmd: avpflag_oper LPAREN attr_id_any_str COMMA flag_name RPAREN  */
+#line 3336 "core/cfg.y"
+                                                                     {
+		i_tmp=get_avpflag_no((yyvsp[-1].strval));
+		if (i_tmp==0) yyerror("avpflag not declared");
+		(yyval.action)=mk_action(AVPFLAG_OPER_T, 3, AVP_ST, (yyvsp[-3].attr), NUMBER_ST, (void*)(long)i_tmp, NUMBER_ST, (void*)(yyvsp[-5].intval));
+		set_cfg_pos((yyval.action));
+	}
+#line 11465 "core/cfg.tab.c"
+    break;
+
+  case 839: /* cmd: avpflag_oper LPAREN attr_id_any_str COMMA error RPAREN  */
+#line 3342 "core/cfg.y"
+                                                                 {
+		(yyval.action)=0; yyerror("error parsing flag name");
+	}
+#line 11473 "core/cfg.tab.c"
+    break;
+
+  case 840: /* cmd: avpflag_oper LPAREN error COMMA flag_name RPAREN  */
+#line 3345 "core/cfg.y"
+                                                           {
+		(yyval.action)=0; yyerror("error parsing first parameter (avp or string)");
+	}
+#line 11481 "core/cfg.tab.c"
+    break;
+
+  case 841: /* cmd: avpflag_oper LPAREN error RPAREN  */
+#line 3348 "core/cfg.y"
+                                           { (yyval.action)=0; yyerror("bad parameters"); }
+#line 11487 "core/cfg.tab.c"
+    break;
+
+  case 842: /* cmd: avpflag_oper error  */
+#line 3349 "core/cfg.y"
+                             { (yyval.action)=0; yyerror("missing '(' or ')'?"); }
+#line 11493 "core/cfg.tab.c"
+    break;
+
+  case 843: /* cmd: ERROR LPAREN STRING COMMA STRING RPAREN  */
+#line 3350 "core/cfg.y"
+                                                  {(yyval.action)=mk_action(ERROR_T, 2, STRING_ST, (yyvsp[-3].strval), STRING_ST, (yyvsp[-1].strval));
+			set_cfg_pos((yyval.action));
+	}
+#line 11501 "core/cfg.tab.c"
+    break;
+
+  case 844: /* cmd: ERROR error  */
+#line 3353 "core/cfg.y"
+                      { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11507 "core/cfg.tab.c"
+    break;
+
+  case 845: /* cmd: ERROR LPAREN error RPAREN  */
+#line 3354 "core/cfg.y"
+                                    { (yyval.action)=0; yyerror("bad error argument"); }
+#line 11513 "core/cfg.tab.c"
+    break;
+
+  case 846: /* cmd: ROUTE LPAREN rval_expr RPAREN  */
+#line 3355 "core/cfg.y"
+                                        {
+		if ((yyvsp[-1].rv_expr)) {
+			(yyval.action) = mk_action(ROUTE_T, 1, RVE_ST, (void*)(yyvsp[-1].rv_expr));
+			set_cfg_pos((yyval.action));
+		} else {
+			(yyval.action) = 0;
+			YYERROR;
+		}
+	}
+#line 11527 "core/cfg.tab.c"
+    break;
+
+  case 847: /* cmd: ROUTE LPAREN ID RPAREN  */
+#line 3364 "core/cfg.y"
+                                        {
+		if ((yyvsp[-1].strval)) {
+			(yyval.action) = mk_action(ROUTE_T, 1, STRING_ST, (void*)(yyvsp[-1].strval));
+			set_cfg_pos((yyval.action));
+		} else {
+			(yyval.action) = 0;
+			YYERROR;
+		}
+	}
+#line 11541 "core/cfg.tab.c"
+    break;
+
+  case 848: /* cmd: ROUTE error  */
+#line 3373 "core/cfg.y"
+                      { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11547 "core/cfg.tab.c"
+    break;
+
+  case 849: /* cmd: ROUTE LPAREN error RPAREN  */
+#line 3374 "core/cfg.y"
+                                    { (yyval.action)=0; yyerror("bad route argument"); }
+#line 11553 "core/cfg.tab.c"
+    break;
+
+  case 850: /* cmd: EXEC LPAREN STRING RPAREN  */
+#line 3375 "core/cfg.y"
+                                        { (yyval.action)=mk_action(EXEC_T, 1, STRING_ST, (yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 11559 "core/cfg.tab.c"
+    break;
+
+  case 851: /* cmd: SET_HOST LPAREN STRING RPAREN  */
+#line 3376 "core/cfg.y"
+                                        { (yyval.action)=mk_action(SET_HOST_T, 1, STRING_ST, (yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 11565 "core/cfg.tab.c"
+    break;
+
+  case 852: /* cmd: SET_HOST error  */
+#line 3377 "core/cfg.y"
+                         { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11571 "core/cfg.tab.c"
+    break;
+
+  case 853: /* cmd: SET_HOST LPAREN error RPAREN  */
+#line 3378 "core/cfg.y"
+                                       { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 11577 "core/cfg.tab.c"
+    break;
+
+  case 854: /* cmd: PREFIX LPAREN STRING RPAREN  */
+#line 3379 "core/cfg.y"
+                                      { (yyval.action)=mk_action(PREFIX_T, 1, STRING_ST,  (yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 11583 "core/cfg.tab.c"
+    break;
+
+  case 855: /* cmd: PREFIX error  */
+#line 3380 "core/cfg.y"
+                       { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11589 "core/cfg.tab.c"
+    break;
+
+  case 856: /* cmd: PREFIX LPAREN error RPAREN  */
+#line 3381 "core/cfg.y"
+                                     { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 11595 "core/cfg.tab.c"
+    break;
+
+  case 857: /* cmd: STRIP_TAIL LPAREN NUMBER RPAREN  */
+#line 3382 "core/cfg.y"
+                                          { (yyval.action)=mk_action(STRIP_TAIL_T, 1, NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 11601 "core/cfg.tab.c"
+    break;
+
+  case 858: /* cmd: STRIP_TAIL error  */
+#line 3383 "core/cfg.y"
+                           { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11607 "core/cfg.tab.c"
+    break;
+
+  case 859: /* cmd: STRIP_TAIL LPAREN error RPAREN  */
+#line 3384 "core/cfg.y"
+                                         { (yyval.action)=0; yyerror("bad argument, number expected"); }
+#line 11613 "core/cfg.tab.c"
+    break;
+
+  case 860: /* cmd: STRIP LPAREN NUMBER RPAREN  */
+#line 3385 "core/cfg.y"
+                                     { (yyval.action)=mk_action(STRIP_T, 1, NUMBER_ST, (void*) (yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 11619 "core/cfg.tab.c"
+    break;
+
+  case 861: /* cmd: STRIP error  */
+#line 3386 "core/cfg.y"
+                      { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11625 "core/cfg.tab.c"
+    break;
+
+  case 862: /* cmd: STRIP LPAREN error RPAREN  */
+#line 3387 "core/cfg.y"
+                                    { (yyval.action)=0; yyerror("bad argument, number expected"); }
+#line 11631 "core/cfg.tab.c"
+    break;
+
+  case 863: /* cmd: SET_USERPHONE LPAREN RPAREN  */
+#line 3388 "core/cfg.y"
+                                      { (yyval.action)=mk_action(SET_USERPHONE_T, 0); set_cfg_pos((yyval.action)); }
+#line 11637 "core/cfg.tab.c"
+    break;
+
+  case 864: /* cmd: SET_USERPHONE error  */
+#line 3389 "core/cfg.y"
+                              { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11643 "core/cfg.tab.c"
+    break;
+
+  case 865: /* cmd: REMOVE_BRANCH LPAREN intno RPAREN  */
+#line 3390 "core/cfg.y"
+                                            {
+			(yyval.action)=mk_action(REMOVE_BRANCH_T, 1, NUMBER_ST, (void*)(yyvsp[-1].intval));
+			set_cfg_pos((yyval.action));
+	}
+#line 11652 "core/cfg.tab.c"
+    break;
+
+  case 866: /* cmd: REMOVE_BRANCH LPAREN RPAREN  */
+#line 3394 "core/cfg.y"
+                                      {
+			(yyval.action)=mk_action(REMOVE_BRANCH_T, 0);
+			set_cfg_pos((yyval.action));
+	}
+#line 11661 "core/cfg.tab.c"
+    break;
+
+  case 867: /* cmd: REMOVE_BRANCH error  */
+#line 3398 "core/cfg.y"
+                              { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11667 "core/cfg.tab.c"
+    break;
+
+  case 868: /* cmd: REMOVE_BRANCH LPAREN error RPAREN  */
+#line 3399 "core/cfg.y"
+                                            { (yyval.action)=0; yyerror("bad argument, number expected"); }
+#line 11673 "core/cfg.tab.c"
+    break;
+
+  case 869: /* cmd: CLEAR_BRANCHES LPAREN RPAREN  */
+#line 3400 "core/cfg.y"
+                                       { (yyval.action)=mk_action(CLEAR_BRANCHES_T, 0); set_cfg_pos((yyval.action)); }
+#line 11679 "core/cfg.tab.c"
+    break;
+
+  case 870: /* cmd: SET_HOSTPORT LPAREN STRING RPAREN  */
+#line 3401 "core/cfg.y"
+                                            { (yyval.action)=mk_action(SET_HOSTPORT_T, 1, STRING_ST, (yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 11685 "core/cfg.tab.c"
+    break;
+
+  case 871: /* cmd: SET_HOSTPORT error  */
+#line 3402 "core/cfg.y"
+                             { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11691 "core/cfg.tab.c"
+    break;
+
+  case 872: /* cmd: SET_HOSTPORT LPAREN error RPAREN  */
+#line 3403 "core/cfg.y"
+                                           { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 11697 "core/cfg.tab.c"
+    break;
+
+  case 873: /* cmd: SET_HOSTPORTTRANS LPAREN STRING RPAREN  */
+#line 3404 "core/cfg.y"
+                                                 { (yyval.action)=mk_action(SET_HOSTPORTTRANS_T, 1, STRING_ST, (yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 11703 "core/cfg.tab.c"
+    break;
+
+  case 874: /* cmd: SET_HOSTPORTTRANS error  */
+#line 3405 "core/cfg.y"
+                                  { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11709 "core/cfg.tab.c"
+    break;
+
+  case 875: /* cmd: SET_HOSTPORTTRANS LPAREN error RPAREN  */
+#line 3406 "core/cfg.y"
+                                                { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 11715 "core/cfg.tab.c"
+    break;
+
+  case 876: /* cmd: SET_PORT LPAREN STRING RPAREN  */
+#line 3407 "core/cfg.y"
+                                        { (yyval.action)=mk_action(SET_PORT_T, 1, STRING_ST, (yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 11721 "core/cfg.tab.c"
+    break;
+
+  case 877: /* cmd: SET_PORT error  */
+#line 3408 "core/cfg.y"
+                         { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11727 "core/cfg.tab.c"
+    break;
+
+  case 878: /* cmd: SET_PORT LPAREN error RPAREN  */
+#line 3409 "core/cfg.y"
+                                       { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 11733 "core/cfg.tab.c"
+    break;
+
+  case 879: /* cmd: SET_USER LPAREN STRING RPAREN  */
+#line 3410 "core/cfg.y"
+                                        { (yyval.action)=mk_action(SET_USER_T, 1, STRING_ST, (yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 11739 "core/cfg.tab.c"
+    break;
+
+  case 880: /* cmd: SET_USER error  */
+#line 3411 "core/cfg.y"
+                         { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11745 "core/cfg.tab.c"
+    break;
+
+  case 881: /* cmd: SET_USER LPAREN error RPAREN  */
+#line 3412 "core/cfg.y"
+                                       { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 11751 "core/cfg.tab.c"
+    break;
+
+  case 882: /* cmd: SET_USERPASS LPAREN STRING RPAREN  */
+#line 3413 "core/cfg.y"
+                                            { (yyval.action)=mk_action(SET_USERPASS_T, 1, STRING_ST, (yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 11757 "core/cfg.tab.c"
+    break;
+
+  case 883: /* cmd: SET_USERPASS error  */
+#line 3414 "core/cfg.y"
+                             { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11763 "core/cfg.tab.c"
+    break;
+
+  case 884: /* cmd: SET_USERPASS LPAREN error RPAREN  */
+#line 3415 "core/cfg.y"
+                                           { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 11769 "core/cfg.tab.c"
+    break;
+
+  case 885: /* cmd: SET_URI LPAREN STRING RPAREN  */
+#line 3416 "core/cfg.y"
+                                       { (yyval.action)=mk_action(SET_URI_T, 1, STRING_ST,(yyvsp[-1].strval)); set_cfg_pos((yyval.action)); }
+#line 11775 "core/cfg.tab.c"
+    break;
+
+  case 886: /* cmd: SET_URI error  */
+#line 3417 "core/cfg.y"
+                        { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11781 "core/cfg.tab.c"
+    break;
+
+  case 887: /* cmd: SET_URI LPAREN error RPAREN  */
+#line 3418 "core/cfg.y"
+                                      { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 11787 "core/cfg.tab.c"
+    break;
+
+  case 888: /* cmd: REVERT_URI LPAREN RPAREN  */
+#line 3419 "core/cfg.y"
+                                   { (yyval.action)=mk_action(REVERT_URI_T, 0); set_cfg_pos((yyval.action)); }
+#line 11793 "core/cfg.tab.c"
+    break;
+
+  case 889: /* cmd: REVERT_URI  */
+#line 3420 "core/cfg.y"
+                     { (yyval.action)=mk_action(REVERT_URI_T, 0); set_cfg_pos((yyval.action)); }
+#line 11799 "core/cfg.tab.c"
+    break;
+
+  case 890: /* cmd: FORCE_RPORT LPAREN RPAREN  */
+#line 3421 "core/cfg.y"
+                                        { (yyval.action)=mk_action(FORCE_RPORT_T, 0); set_cfg_pos((yyval.action)); }
+#line 11805 "core/cfg.tab.c"
+    break;
+
+  case 891: /* cmd: FORCE_RPORT  */
+#line 3422 "core/cfg.y"
+                        {(yyval.action)=mk_action(FORCE_RPORT_T, 0); set_cfg_pos((yyval.action)); }
+#line 11811 "core/cfg.tab.c"
+    break;
+
+  case 892: /* cmd: ADD_LOCAL_RPORT LPAREN RPAREN  */
+#line 3423 "core/cfg.y"
+                                        { (yyval.action)=mk_action(ADD_LOCAL_RPORT_T, 0); set_cfg_pos((yyval.action)); }
+#line 11817 "core/cfg.tab.c"
+    break;
+
+  case 893: /* cmd: ADD_LOCAL_RPORT  */
+#line 3424 "core/cfg.y"
+                                {(yyval.action)=mk_action(ADD_LOCAL_RPORT_T, 0); set_cfg_pos((yyval.action)); }
+#line 11823 "core/cfg.tab.c"
+    break;
+
+  case 894: /* cmd: FORCE_TCP_ALIAS LPAREN NUMBER RPAREN  */
+#line 3425 "core/cfg.y"
+                                                {
+		#ifdef USE_TCP
+			(yyval.action)=mk_action(FORCE_TCP_ALIAS_T, 1, NUMBER_ST, (void*)(yyvsp[-1].intval));
+			set_cfg_pos((yyval.action));
+		#else
+			yyerror("tcp support not compiled in");
+		#endif
+	}
+#line 11836 "core/cfg.tab.c"
+    break;
+
+  case 895: /* cmd: FORCE_TCP_ALIAS LPAREN RPAREN  */
+#line 3433 "core/cfg.y"
+                                        {
+		#ifdef USE_TCP
+			(yyval.action)=mk_action(FORCE_TCP_ALIAS_T, 0);
+			set_cfg_pos((yyval.action));
+		#else
+			yyerror("tcp support not compiled in");
+		#endif
+	}
+#line 11849 "core/cfg.tab.c"
+    break;
+
+  case 896: /* cmd: FORCE_TCP_ALIAS  */
+#line 3441 "core/cfg.y"
+                                                        {
+		#ifdef USE_TCP
+			(yyval.action)=mk_action(FORCE_TCP_ALIAS_T, 0);
+			set_cfg_pos((yyval.action));
+		#else
+			yyerror("tcp support not compiled in");
+		#endif
+	}
+#line 11862 "core/cfg.tab.c"
+    break;
+
+  case 897: /* cmd: FORCE_TCP_ALIAS LPAREN error RPAREN  */
+#line 3449 "core/cfg.y"
+                                                {(yyval.action)=0; yyerror("bad argument, number expected"); }
+#line 11868 "core/cfg.tab.c"
+    break;
+
+  case 898: /* cmd: UDP_MTU_TRY_PROTO LPAREN proto RPAREN  */
+#line 3451 "core/cfg.y"
+                { (yyval.action)=mk_action(UDP_MTU_TRY_PROTO_T, 1, NUMBER_ST, (yyvsp[-1].intval)); set_cfg_pos((yyval.action)); }
+#line 11874 "core/cfg.tab.c"
+    break;
+
+  case 899: /* cmd: UDP_MTU_TRY_PROTO LPAREN error RPAREN  */
+#line 3453 "core/cfg.y"
+                { (yyval.action)=0; yyerror("bad argument, UDP, TCP, TLS or SCTP expected"); }
+#line 11880 "core/cfg.tab.c"
+    break;
+
+  case 900: /* cmd: SET_ADV_ADDRESS LPAREN listen_id RPAREN  */
+#line 3454 "core/cfg.y"
+                                                  {
+		(yyval.action)=0;
+		if ((str_tmp=pkg_malloc(sizeof(str)))==0) {
+			PKG_MEM_CRITICAL;
+		} else {
+			str_tmp->s=(yyvsp[-1].strval);
+			str_tmp->len=(yyvsp[-1].strval)?strlen((yyvsp[-1].strval)):0;
+			(yyval.action)=mk_action(SET_ADV_ADDR_T, 1, STR_ST, str_tmp);
+			set_cfg_pos((yyval.action));
+		}
+	}
+#line 11896 "core/cfg.tab.c"
+    break;
+
+  case 901: /* cmd: SET_ADV_ADDRESS LPAREN error RPAREN  */
+#line 3465 "core/cfg.y"
+                                              { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 11902 "core/cfg.tab.c"
+    break;
+
+  case 902: /* cmd: SET_ADV_ADDRESS error  */
+#line 3466 "core/cfg.y"
+                                {(yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11908 "core/cfg.tab.c"
+    break;
+
+  case 903: /* cmd: SET_ADV_PORT LPAREN NUMBER RPAREN  */
+#line 3467 "core/cfg.y"
+                                            {
+		(yyval.action)=0;
+		tmp=int2str((yyvsp[-1].intval), &i_tmp);
+		if ((str_tmp=pkg_malloc(sizeof(str)))==0) {
+			PKG_MEM_CRITICAL;
+		} else {
+			if ((str_tmp->s=pkg_malloc(i_tmp))==0) {
+				PKG_MEM_CRITICAL;
+			} else {
+				memcpy(str_tmp->s, tmp, i_tmp);
+				str_tmp->len=i_tmp;
+				(yyval.action)=mk_action(SET_ADV_PORT_T, 1, STR_ST, str_tmp);
+				set_cfg_pos((yyval.action));
+			}
+		}
+	}
+#line 11929 "core/cfg.tab.c"
+    break;
+
+  case 904: /* cmd: SET_ADV_PORT LPAREN error RPAREN  */
+#line 3483 "core/cfg.y"
+                                           { (yyval.action)=0; yyerror("bad argument, string expected"); }
+#line 11935 "core/cfg.tab.c"
+    break;
+
+  case 905: /* cmd: SET_ADV_PORT error  */
+#line 3484 "core/cfg.y"
+                              {(yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11941 "core/cfg.tab.c"
+    break;
+
+  case 906: /* cmd: FORCE_SEND_SOCKET LPAREN phostport RPAREN  */
+#line 3485 "core/cfg.y"
+                                                    {
+		(yyval.action)=mk_action(FORCE_SEND_SOCKET_T, 1, SOCKID_ST, (yyvsp[-1].sockid));
+		set_cfg_pos((yyval.action));
+	}
+#line 11950 "core/cfg.tab.c"
+    break;
+
+  case 907: /* cmd: FORCE_SEND_SOCKET LPAREN error RPAREN  */
+#line 3489 "core/cfg.y"
+                                                {
+		(yyval.action)=0; yyerror("bad argument, [proto:]host[:port] expected");
+	}
+#line 11958 "core/cfg.tab.c"
+    break;
+
+  case 908: /* cmd: FORCE_SEND_SOCKET error  */
+#line 3492 "core/cfg.y"
+                                  {(yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 11964 "core/cfg.tab.c"
+    break;
+
+  case 909: /* cmd: SET_FWD_NO_CONNECT LPAREN RPAREN  */
+#line 3493 "core/cfg.y"
+                                                {
+		(yyval.action)=mk_action(SET_FWD_NO_CONNECT_T, 0); set_cfg_pos((yyval.action));
+	}
+#line 11972 "core/cfg.tab.c"
+    break;
+
+  case 910: /* cmd: SET_FWD_NO_CONNECT  */
+#line 3496 "core/cfg.y"
+                                {
+		(yyval.action)=mk_action(SET_FWD_NO_CONNECT_T, 0); set_cfg_pos((yyval.action));
+	}
+#line 11980 "core/cfg.tab.c"
+    break;
+
+  case 911: /* cmd: SET_RPL_NO_CONNECT LPAREN RPAREN  */
+#line 3499 "core/cfg.y"
+                                                {
+		(yyval.action)=mk_action(SET_RPL_NO_CONNECT_T, 0); set_cfg_pos((yyval.action));
+	}
+#line 11988 "core/cfg.tab.c"
+    break;
+
+  case 912: /* cmd: SET_RPL_NO_CONNECT  */
+#line 3502 "core/cfg.y"
+                                {
+		(yyval.action)=mk_action(SET_RPL_NO_CONNECT_T, 0); set_cfg_pos((yyval.action));
+	}
+#line 11996 "core/cfg.tab.c"
+    break;
+
+  case 913: /* cmd: SET_FWD_CLOSE LPAREN RPAREN  */
+#line 3505 "core/cfg.y"
+                                        {
+		(yyval.action)=mk_action(SET_FWD_CLOSE_T, 0); set_cfg_pos((yyval.action));
+	}
+#line 12004 "core/cfg.tab.c"
+    break;
+
+  case 914: /* cmd: SET_FWD_CLOSE  */
+#line 3508 "core/cfg.y"
+                        {
+		(yyval.action)=mk_action(SET_FWD_CLOSE_T, 0); set_cfg_pos((yyval.action));
+	}
+#line 12012 "core/cfg.tab.c"
+    break;
+
+  case 915: /* cmd: SET_RPL_CLOSE LPAREN RPAREN  */
+#line 3511 "core/cfg.y"
+                                        {
+		(yyval.action)=mk_action(SET_RPL_CLOSE_T, 0); set_cfg_pos((yyval.action));
+	}
+#line 12020 "core/cfg.tab.c"
+    break;
+
+  case 916: /* cmd: SET_RPL_CLOSE  */
+#line 3514 "core/cfg.y"
+                        {
+		(yyval.action)=mk_action(SET_RPL_CLOSE_T, 0); set_cfg_pos((yyval.action));
+	}
+#line 12028 "core/cfg.tab.c"
+    break;
+
+  case 917: /* cmd: CFG_SELECT LPAREN STRING COMMA NUMBER RPAREN  */
+#line 3517 "core/cfg.y"
+                                                       {
+		(yyval.action)=mk_action(CFG_SELECT_T, 2, STRING_ST, (yyvsp[-3].strval), NUMBER_ST, (void*)(yyvsp[-1].intval)); set_cfg_pos((yyval.action));
+	}
+#line 12036 "core/cfg.tab.c"
+    break;
+
+  case 918: /* cmd: CFG_SELECT LPAREN STRING COMMA rval_expr RPAREN  */
+#line 3520 "core/cfg.y"
+                                                          {
+		(yyval.action)=mk_action(CFG_SELECT_T, 2, STRING_ST, (yyvsp[-3].strval), RVE_ST, (yyvsp[-1].rv_expr)); set_cfg_pos((yyval.action));
+	}
+#line 12044 "core/cfg.tab.c"
+    break;
+
+  case 919: /* cmd: CFG_SELECT error  */
+#line 3523 "core/cfg.y"
+                           { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 12050 "core/cfg.tab.c"
+    break;
+
+  case 920: /* cmd: CFG_SELECT LPAREN error RPAREN  */
+#line 3524 "core/cfg.y"
+                                         { (yyval.action)=0; yyerror("bad arguments, string and number expected"); }
+#line 12056 "core/cfg.tab.c"
+    break;
+
+  case 921: /* cmd: CFG_RESET LPAREN STRING RPAREN  */
+#line 3525 "core/cfg.y"
+                                         {
+		(yyval.action)=mk_action(CFG_RESET_T, 1, STRING_ST, (yyvsp[-1].strval)); set_cfg_pos((yyval.action));
+	}
+#line 12064 "core/cfg.tab.c"
+    break;
+
+  case 922: /* cmd: CFG_RESET error  */
+#line 3528 "core/cfg.y"
+                          { (yyval.action)=0; yyerror("missing '(' or ')' ?"); }
+#line 12070 "core/cfg.tab.c"
+    break;
+
+  case 923: /* cmd: CFG_RESET LPAREN error RPAREN  */
+#line 3529 "core/cfg.y"
+                                        { (yyval.action)=0; yyerror("bad arguments, string expected"); }
+#line 12076 "core/cfg.tab.c"
+    break;
+
+  case 924: /* $@9: %empty  */
+#line 3530 "core/cfg.y"
+             {
+		if (mod_func_action != NULL) {
+			LM_ERR("function used inside params of another function: %s\n", (yyvsp[0].strval));
+			yyerror("use of function execution inside params not allowed\n");
+			ksr_exit(-1);
+		}
+		mod_func_action = mk_action(MODULE0_T, 2, MODEXP_ST, NULL, NUMBER_ST, 0);
+		}
+#line 12089 "core/cfg.tab.c"
+    break;
+
+  case 925: /* cmd: ID $@9 LPAREN func_params RPAREN  */
+#line 3537 "core/cfg.y"
+                                                {
+		mod_func_action->val[0].u.data =
+			find_export_record((yyvsp[-4].strval), mod_func_action->val[1].u.number, rt);
+		if (mod_func_action->val[0].u.data == 0) {
+			if (find_export_record((yyvsp[-4].strval), mod_func_action->val[1].u.number, 0) ) {
+					LM_ERR("misused command %s\n", (yyvsp[-4].strval));
+					yyerror("Command cannot be used in the block\n");
+			} else {
+				LM_ERR("cfg. parser: failed to find command %s (params %ld)\n",
+						(yyvsp[-4].strval), mod_func_action->val[1].u.number);
+				yyerror("unknown command, missing loadmodule?\n");
+			}
+			free_mod_func_action(mod_func_action);
+			mod_func_action=0;
+		}else{
+			if (mod_func_action && mod_f_params_pre_fixup(mod_func_action)<0) {
+				/* error messages are printed inside the function */
+				/* free_mod_func_action(mod_func_action); */
+				mod_func_action = 0;
+				YYERROR;
+			}
+		}
+		(yyval.action) = mod_func_action;
+		set_cfg_pos((yyval.action));
+		mod_func_action = NULL;
+	}
+#line 12120 "core/cfg.tab.c"
+    break;
+
+  case 926: /* cmd: ID error  */
+#line 3563 "core/cfg.y"
+                                                        { yyerror("'('')' expected (function call)");}
+#line 12126 "core/cfg.tab.c"
+    break;
+
+  case 928: /* func_params: func_params COMMA func_param  */
+#line 3567 "core/cfg.y"
+                                       { }
+#line 12132 "core/cfg.tab.c"
+    break;
+
+  case 929: /* func_params: func_param  */
+#line 3568 "core/cfg.y"
+                     {}
+#line 12138 "core/cfg.tab.c"
+    break;
+
+  case 930: /* func_param: rval_expr  */
+#line 3571 "core/cfg.y"
+                  {
+		if ((yyvsp[0].rv_expr) && mod_func_action->val[1].u.number < MAX_ACTIONS-2) {
+			mod_func_action->val[mod_func_action->val[1].u.number+2].type =
+				RVE_ST;
+			mod_func_action->val[mod_func_action->val[1].u.number+2].u.data =
+				(yyvsp[0].rv_expr);
+			mod_func_action->val[1].u.number++;
+		} else if ((yyvsp[0].rv_expr)) {
+			yyerror("Too many arguments\n");
+			YYERROR;
+		} else {
+			YYERROR;
+		}
+	}
+#line 12157 "core/cfg.tab.c"
+    break;
+
+  case 931: /* ret_cmd: DROP LPAREN RPAREN  */
+#line 3588 "core/cfg.y"
+                                        {
+		(yyval.action)=mk_action(DROP_T, 2, NUMBER_ST, 0, NUMBER_ST,
+						(void*)(DROP_R_F|EXIT_R_F)); set_cfg_pos((yyval.action));
+	}
+#line 12166 "core/cfg.tab.c"
+    break;
+
+  case 932: /* ret_cmd: DROP rval_expr  */
+#line 3592 "core/cfg.y"
+                                {
+		(yyval.action)=mk_action(DROP_T, 2, RVE_ST, (yyvsp[0].rv_expr), NUMBER_ST,
+						(void*)(DROP_R_F|EXIT_R_F)); set_cfg_pos((yyval.action));
+	}
+#line 12175 "core/cfg.tab.c"
+    break;
+
+  case 933: /* ret_cmd: DROP  */
+#line 3596 "core/cfg.y"
+                                        {
+		(yyval.action)=mk_action(DROP_T, 2, NUMBER_ST, 0, NUMBER_ST,
+						(void*)(DROP_R_F|EXIT_R_F)); set_cfg_pos((yyval.action));
+	}
+#line 12184 "core/cfg.tab.c"
+    break;
+
+  case 934: /* ret_cmd: EXIT LPAREN RPAREN  */
+#line 3600 "core/cfg.y"
+                                        {
+		(yyval.action)=mk_action(DROP_T, 2, NUMBER_ST, (void*)1, NUMBER_ST,
+						(void*)EXIT_R_F);
+		set_cfg_pos((yyval.action));
+	}
+#line 12194 "core/cfg.tab.c"
+    break;
+
+  case 935: /* ret_cmd: EXIT rval_expr  */
+#line 3605 "core/cfg.y"
+                                {
+		(yyval.action)=mk_action(DROP_T, 2, RVE_ST, (yyvsp[0].rv_expr), NUMBER_ST, (void*)EXIT_R_F);
+		set_cfg_pos((yyval.action));
+	}
+#line 12203 "core/cfg.tab.c"
+    break;
+
+  case 936: /* ret_cmd: EXIT  */
+#line 3609 "core/cfg.y"
+                                        {
+		(yyval.action)=mk_action(DROP_T, 2, NUMBER_ST, (void*)1, NUMBER_ST,
+						(void*)EXIT_R_F);
+		set_cfg_pos((yyval.action));
+	}
+#line 12213 "core/cfg.tab.c"
+    break;
+
+  case 937: /* ret_cmd: RETURN  */
+#line 3614 "core/cfg.y"
+                                        {
+		(yyval.action)=mk_action(DROP_T, 2, NUMBER_ST, (void*)1, NUMBER_ST,
+						(void*)RETURN_R_F); set_cfg_pos((yyval.action));
+	}
+#line 12222 "core/cfg.tab.c"
+    break;
+
+  case 938: /* ret_cmd: RETURN LPAREN RPAREN  */
+#line 3618 "core/cfg.y"
+                                        {
+		(yyval.action)=mk_action(DROP_T, 2, NUMBER_ST, (void*)1, NUMBER_ST,
+						(void*)RETURN_R_F); set_cfg_pos((yyval.action));
+	}
+#line 12231 "core/cfg.tab.c"
+    break;
+
+  case 939: /* ret_cmd: RETURN rval_expr  */
+#line 3622 "core/cfg.y"
+                                {
+		(yyval.action)=mk_action(DROP_T, 2, RVE_ST, (yyvsp[0].rv_expr), NUMBER_ST, (void*)RETURN_R_F);
+		set_cfg_pos((yyval.action));
+	}
+#line 12240 "core/cfg.tab.c"
+    break;
+
+  case 940: /* ret_cmd: BREAK  */
+#line 3626 "core/cfg.y"
+                                        {
+		(yyval.action)=mk_action(DROP_T, 2, NUMBER_ST, 0, NUMBER_ST, (void*)BREAK_R_F);
+		set_cfg_pos((yyval.action));
+	}
+#line 12249 "core/cfg.tab.c"
+    break;
+
+
+#line 12253 "core/cfg.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 3632 "core/cfg.y"
+
+
+static void get_cpos(struct cfg_pos* pos)
+{
+	pos->s_line=startline;
+	pos->e_line=line;
+	pos->s_col=startcolumn;
+	pos->e_col=column-1;
+	if(finame==0)
+		finame = (cfg_file!=0)?cfg_file:"default";
+	pos->fname=finame;
+	pos->rname=(routename!=0)?routename:default_routename;
+}
+
+
+static void warn_at(struct cfg_pos* p, char* format, ...)
+{
+	va_list ap;
+	char s[256];
+
+	va_start(ap, format);
+	vsnprintf(s, sizeof(s), format, ap);
+	va_end(ap);
+	if (p->e_line!=p->s_line)
+		LM_WARN("warning in config file %s, from line %d, column %d to"
+					" line %d, column %d: %s\n",
+					p->fname, p->s_line, p->s_col, p->e_line, p->e_col, s);
+	else if (p->s_col!=p->e_col)
+		LM_WARN("warning in config file %s, line %d, column %d-%d: %s\n",
+					p->fname, p->s_line, p->s_col, p->e_col, s);
+	else
+		LM_WARN("warning in config file %s, line %d, column %d: %s\n",
+				p->fname, p->s_line, p->s_col, s);
+	cfg_warnings++;
+}
+
+
+
+static void yyerror_at(struct cfg_pos* p, char* format, ...)
+{
+	va_list ap;
+	char s[256];
+
+	va_start(ap, format);
+	vsnprintf(s, sizeof(s), format, ap);
+	va_end(ap);
+	if (p->e_line!=p->s_line)
+		LM_CRIT("parse error in config file %s, from line %d, column %d"
+					" to line %d, column %d: %s\n",
+					p->fname, p->s_line, p->s_col, p->e_line, p->e_col, s);
+	else if (p->s_col!=p->e_col)
+		LM_CRIT("parse error in config file %s, line %d, column %d-%d: %s\n",
+					p->fname, p->s_line, p->s_col, p->e_col, s);
+	else
+		LM_CRIT("parse error in config file %s, line %d, column %d: %s\n",
+					p->fname, p->s_line, p->s_col, s);
+	cfg_errors++;
+}
+
+
+
+static void warn(char* format, ...)
+{
+	va_list ap;
+	char s[256];
+	struct cfg_pos pos;
+
+	get_cpos(&pos);
+	va_start(ap, format);
+	vsnprintf(s, sizeof(s), format, ap);
+	va_end(ap);
+	warn_at(&pos, s);
+}
+
+
+
+static void yyerror(char* format, ...)
+{
+	va_list ap;
+	char s[256];
+	struct cfg_pos pos;
+
+	get_cpos(&pos);
+	va_start(ap, format);
+	vsnprintf(s, sizeof(s), format, ap);
+	va_end(ap);
+	yyerror_at(&pos, s);
+}
+
+
+
+/** mk_rval_expr_v wrapper.
+ *  checks mk_rval_expr_v return value and sets the cfg. pos
+ *  (line and column numbers)
+ *  @return rval_expr* on success, 0 on error (@see mk_rval_expr_v)
+ */
+static struct rval_expr* mk_rve_rval(enum rval_type type, void* v)
+{
+	struct rval_expr* ret;
+	struct cfg_pos pos;
+
+	get_cpos(&pos);
+	ret=mk_rval_expr_v(type, v, &pos);
+	if (ret==0){
+		yyerror("internal error: failed to create rval expr");
+		/* YYABORT; */
+	}
+	return ret;
+}
+
+
+/** mk_rval_expr1 wrapper.
+ *  checks mk_rval_expr1 return value (!=0 and type checking)
+ *  @return rval_expr* on success, 0 on error (@see mk_rval_expr1)
+ */
+static struct rval_expr* mk_rve1(enum rval_expr_op op, struct rval_expr* rve1)
+{
+	struct rval_expr* ret;
+	struct rval_expr* bad_rve;
+	enum rval_type type, bad_t, exp_t;
+
+	if (rve1==0)
+		return 0;
+	ret=mk_rval_expr1(op, rve1, &rve1->fpos);
+	if (ret && (rve_check_type(&type, ret, &bad_rve, &bad_t, &exp_t)!=1)){
+		yyerror_at(&rve1->fpos, "bad expression: type mismatch"
+					" (%s instead of %s)", rval_type_name(bad_t),
+					rval_type_name(exp_t));
+		rve_destroy(ret);
+		ret=0;
+	}
+	return ret;
+}
+
+
+/** mk_rval_expr2 wrapper.
+ *  checks mk_rval_expr2 return value (!=0 and type checking)
+ *  @return rval_expr* on success, 0 on error (@see mk_rval_expr2)
+ */
+static struct rval_expr* mk_rve2(enum rval_expr_op op, struct rval_expr* rve1,
+									struct rval_expr* rve2)
+{
+	struct rval_expr* ret;
+	struct rval_expr* bad_rve;
+	enum rval_type type, bad_t, exp_t;
+	struct cfg_pos pos;
+
+	if ((rve1==0) || (rve2==0))
+		return 0;
+	bad_rve=0;
+	bad_t=0;
+	exp_t=0;
+	cfg_pos_join(&pos, &rve1->fpos, &rve2->fpos);
+	ret=mk_rval_expr2(op, rve1, rve2, &pos);
+	if (ret && (rve_check_type(&type, ret, &bad_rve, &bad_t, &exp_t)!=1)){
+		if (bad_rve)
+			yyerror_at(&pos, "bad expression: type mismatch:"
+						" %s instead of %s at (%d,%d)",
+						rval_type_name(bad_t), rval_type_name(exp_t),
+						bad_rve->fpos.s_line, bad_rve->fpos.s_col);
+		else
+			yyerror("BUG: unexpected null \"bad\" expression\n");
+		rve_destroy(ret);
+		ret=0;
+	}
+	return ret;
+}
+
+
+/** check if the expression is an int.
+ * if the expression does not evaluate to an int return -1 and
+ * log an error.
+ * @return 0 success, no warnings; 1 success but warnings; -1 on error */
+static int rval_expr_int_check(struct rval_expr *rve)
+{
+	struct rval_expr* bad_rve;
+	enum rval_type type, bad_t, exp_t;
+
+	if (rve==0){
+		yyerror("invalid expression");
+		return -1;
+	}else if (!rve_check_type(&type, rve, &bad_rve, &bad_t ,&exp_t)){
+		if (bad_rve)
+			yyerror_at(&rve->fpos, "bad expression: type mismatch:"
+						" %s instead of %s at (%d,%d)",
+						rval_type_name(bad_t), rval_type_name(exp_t),
+						bad_rve->fpos.s_line, bad_rve->fpos.s_col);
+		else
+			yyerror("BUG: unexpected null \"bad\" expression\n");
+		return -1;
+	}else if (type!=RV_INT && type!=RV_NONE){
+		warn_at(&rve->fpos, "non-int expression (you might want to use"
+				" casts)\n");
+		return 1;
+	}
+	return 0;
+}
+
+
+/** warn if the expression is constant.
+ * @return 0 on success (no warning), 1 when warning */
+static int warn_ct_rve(struct rval_expr *rve, char* name)
+{
+	if (rve && rve_is_constant(rve)){
+		warn_at(&rve->fpos, "constant value in %s%s",
+				name?name:"expression", name?"(...)":"");
+		return 1;
+	}
+	return 0;
+}
+
+
+static struct name_lst* mk_name_lst(char* host, int flags)
+{
+	struct name_lst* l;
+	if (host==0) return 0;
+	l=pkg_malloc(sizeof(struct name_lst));
+	if (l==0) {
+		PKG_MEM_CRITICAL;
+	} else {
+		memset(l, 0, sizeof(struct name_lst));
+		l->name=host;
+		l->flags=flags;
+		l->next=0;
+	}
+	return l;
+}
+
+
+static struct socket_id* mk_listen_id(char* host, int proto, int port)
+{
+	struct socket_id* l;
+	if (host==0) return 0;
+	l=pkg_malloc(sizeof(struct socket_id));
+	if (l==0) {
+		PKG_MEM_CRITICAL;
+	} else {
+		memset(l, 0, sizeof(struct socket_id));
+		l->addr_lst=mk_name_lst(host, 0);
+		if (l->addr_lst==0){
+			pkg_free(l);
+			return 0;
+		}
+		l->flags=0;
+		l->port=port;
+		l->proto=proto;
+		l->next=0;
+	}
+	return l;
+}
+
+
+static void free_name_lst(struct name_lst* lst)
+{
+	struct name_lst* tmp;
+
+	while(lst){
+		tmp=lst;
+		lst=lst->next;
+		pkg_free(tmp);
+	}
+}
+
+
+static struct socket_id* mk_listen_id2(struct name_lst* addr_l, int proto,
+										int port)
+{
+	struct socket_id* l;
+	if (addr_l==0) return 0;
+	l=pkg_malloc(sizeof(struct socket_id));
+	if (l==0) {
+		PKG_MEM_CRITICAL;
+	} else {
+		memset(l, 0, sizeof(struct socket_id));
+		l->flags=addr_l->flags;
+		l->port=port;
+		l->proto=proto;
+		l->addr_lst=addr_l;
+		l->next=0;
+	}
+	return l;
+}
+
+
+static void free_socket_id(struct socket_id* i)
+{
+	free_name_lst(i->addr_lst);
+	pkg_free(i);
+}
+
+
+static void free_socket_id_lst(struct socket_id* lst)
+{
+	struct socket_id* tmp;
+
+	while(lst){
+		tmp=lst;
+		lst=lst->next;
+		free_socket_id(tmp);
+	}
+}
+
+
+/** create a temporary case statmenet structure.
+ *  *err will be filled in case of error (return == 0):
+ *   -1 - non constant expression
+ *   -2 - expression error (bad type)
+ *   -10 - memory allocation error
+ */
+static struct case_stms* mk_case_stm(struct rval_expr* ct, int is_re,
+											struct action* a, int* err)
+{
+	struct case_stms* s;
+	struct rval_expr* bad_rve;
+	enum rval_type type, bad_t, exp_t;
+	enum match_str_type t;
+
+	t=MATCH_UNKNOWN;
+	if (ct){
+		/* if ct!=0 => case, else if ct==0 is a default */
+		if (!rve_is_constant(ct)){
+			yyerror_at(&ct->fpos, "non constant expression in case");
+			*err=-1;
+			return 0;
+		}
+		if (rve_check_type(&type, ct, &bad_rve, &bad_t, &exp_t)!=1){
+			yyerror_at(&ct->fpos, "bad expression: type mismatch:"
+							" %s instead of %s at (%d,%d)",
+							rval_type_name(bad_t), rval_type_name(exp_t),
+							bad_rve->fpos.s_line, bad_rve->fpos.s_col);
+			*err=-2;
+			return 0;
+		}
+		if (is_re)
+			t=MATCH_RE;
+		else if (type==RV_STR)
+			t=MATCH_STR;
+		else
+			t=MATCH_INT;
+	}
+
+	s=pkg_malloc(sizeof(*s));
+	if (s==0) {
+		yyerror("internal error: memory allocation failure");
+		*err=-10;
+	} else {
+		memset(s, 0, sizeof(*s));
+		s->ct_rve=ct;
+		s->type=t;
+		s->actions=a;
+		s->next=0;
+		s->append=0;
+	}
+	return s;
+}
+
+
+/*
+ * @return 0 on success, -1 on error.
+ */
+static int case_check_type(struct case_stms* stms)
+{
+	struct case_stms* c;
+	struct case_stms* s;
+
+	for(c=stms; c ; c=c->next){
+		if (!c->ct_rve) continue;
+		for (s=c->next; s; s=s->next){
+			if (!s->ct_rve) continue;
+			if ((s->type!=c->type) &&
+				!(	(c->type==MATCH_STR || c->type==MATCH_RE) &&
+					(s->type==MATCH_STR || s->type==MATCH_RE) ) ){
+					yyerror_at(&s->ct_rve->fpos, "type mismatch in case");
+					return -1;
+			}
+		}
+	}
+	return 0;
+}
+
+
+/*
+ * @return 0 on success, -1 on error.
+ */
+static int case_check_default(struct case_stms* stms)
+{
+	struct case_stms* c;
+	int default_no;
+
+	default_no=0;
+	for(c=stms; c ; c=c->next)
+		if (c->ct_rve==0) default_no++;
+	return (default_no<=1)?0:-1;
+}
+
+
+
+/** fixes the parameters and the type of a module function call.
+ * It is done here instead of fix action, to have quicker feedback
+ * on error cases (e.g. passing a non constant to a function with a
+ * declared fixup)
+ * The rest of the fixup is done inside do_action().
+ * @param a - filled module function call (MODULE*_T) action structure
+ *            complete with parameters, starting at val[2] and parameter
+ *            number at val[1].
+ * @return 0 on success, -1 on error (it will also print the error msg.).
+ *
+ */
+static int mod_f_params_pre_fixup(struct action* a)
+{
+	ksr_cmd_export_t* cmd_exp;
+	action_u_t* params;
+	int param_no;
+	struct rval_expr* rve;
+	struct rvalue* rv;
+	int r;
+	str s;
+
+	cmd_exp = a->val[0].u.data;
+	param_no = a->val[1].u.number;
+	params = &a->val[2];
+
+	switch(cmd_exp->param_no) {
+		case 0:
+			a->type = MODULE0_T;
+			break;
+		case 1:
+			a->type = MODULE1_T;
+			break;
+		case 2:
+			a->type = MODULE2_T;
+			break;
+		case 3:
+			a->type = MODULE3_T;
+			break;
+		case 4:
+			a->type = MODULE4_T;
+			break;
+		case 5:
+			a->type = MODULE5_T;
+			break;
+		case 6:
+			a->type = MODULE6_T;
+			break;
+		case VAR_PARAM_NO:
+			a->type = MODULEX_T;
+			break;
+		default:
+			yyerror("function %s: bad definition"
+					" (invalid number of parameters)", cmd_exp->name);
+			return -1;
+	}
+
+	if ( cmd_exp->fixup) {
+		if (is_fparam_rve_fixup(cmd_exp->fixup))
+			/* mark known fparam rve safe fixups */
+			cmd_exp->fixup_flags  |= FIXUP_F_FPARAM_RVE;
+		else if (!(cmd_exp->fixup_flags & FIXUP_F_FPARAM_RVE) &&
+				 cmd_exp->free_fixup == 0) {
+			/* v0 or v1 functions that have fixups and no coresp. fixup_free
+			   functions, need constant, string params.*/
+			for (r=0; r < param_no; r++) {
+				rve=params[r].u.data;
+				if (!rve_is_constant(rve)) {
+					yyerror_at(&rve->fpos, "function %s: parameter %d is not"
+								" constant\n", cmd_exp->name, r+1);
+					return -1;
+				}
+				if ((rv = rval_expr_eval(0, 0, rve)) == 0 ||
+						rval_get_str(0, 0, &s, rv, 0) < 0 ) {
+					/* out of mem or bug ? */
+					rval_destroy(rv);
+					yyerror_at(&rve->fpos, "function %s: bad parameter %d"
+									" expression\n", cmd_exp->name, r+1);
+					return -1;
+				}
+				rval_destroy(rv);
+				rve_destroy(rve);
+				params[r].type = STRING_ST; /* asciiz */
+				params[r].u.string = s.s;
+				params[r].u.str.len = s.len; /* not used right now */
+			}
+		}
+	}/* else
+		if no fixups are present, the RVEs can be transformed
+		into strings at runtime, allowing seamless var. use
+		even with old functions.
+		Further optimizations -> in fix_actions()
+		*/
+	return 0;
+}
+
+
+
+/** frees a filled module function call action structure.
+ * @param a - filled module function call action structure
+ *            complete with parameters, starting at val[2] and parameter
+ *            number at val[1].
+ */
+static void free_mod_func_action(struct action* a)
+{
+	action_u_t* params;
+	int param_no;
+	int r;
+
+	param_no = a->val[1].u.number;
+	params = &a->val[2];
+
+	for (r=0; r < param_no; r++)
+		if (params[r].u.data)
+			rve_destroy(params[r].u.data);
+	pkg_free(a);
+}
+
+
+
+/*
+int main(int argc, char ** argv)
+{
+	if (yyparse()!=0)
+		fprintf(stderr, "parsing error\n");
+}
+*/
@@ -46,6 +46,8 @@
 #include "core_cmd.h"
 #include "cfg_core.h"
 #include "ppcfg.h"
+#include "udp_server.h"
+#include "async_task.h"
 
 #ifdef USE_DNS_CACHE
 void dns_cache_debug(rpc_t* rpc, void* ctx);
@@ -461,6 +463,71 @@ static void core_psa(rpc_t* rpc, void* c)
 	}
 }
 
+static const char* core_psload_doc[] = {
+	"Returns the load of running processes (busy/idle time and messages).",
+		/* Documentation string */
+	0	/* Method signature(s) */
+};
+
+
+static void core_psload(rpc_t* rpc, void* c)
+{
+	int p;
+	void *handle;
+	proc_load_info_t li;
+
+	for (p=0; p<*process_count;p++) {
+		if (proc_load_get(p, &li) < 0)
+			continue;
+		if (rpc->add(c, "{", &handle) < 0)
+			return;
+		rpc->struct_add(handle, "dddsfffddd",
+				"IDX", p,
+				"PID", pt[p].pid,
+				"RANK", pt[p].rank,
+				"DSC", pt[p].desc,
+				"MSGS", (double)li.msgs,
+				"BUSY", (double)li.busy_us / 1000000.0,
+				"IDLE", (double)li.idle_us / 1000000.0,
+				"LOAD", (int)li.load,
+				"LAST_MSGS", (int)li.lmsgs,
+				"LAST_LOAD", (int)li.lload);
+	}
+}
+
+static const char* core_async_tasks_doc[] = {
+	"Returns the state of the async task queues.",
+		/* Documentation string */
+	0	/* Method signature(s) */
+};
+
+static const char* core_udp_rxq_doc[] = {
+	"Returns the kernel receive queue state of the udp sockets.",
+		/* Documentation string */
+	0	/* Method signature(s) */
+};
+
+
+static void core_udp_rxq(rpc_t* rpc, void* c)
+{
+	struct socket_info *si;
+	void *handle;
+	unsigned int rxq, rcvbuf, drops;
+
+	for (si=udp_listen; si; si=si->next) {
+		if (si->socket < 0
+				|| udp_rcv_queue_info(si->socket, &rxq, &rcvbuf, &drops) < 0)
+			continue;
+		if (rpc->add(c, "{", &handle) < 0)
+			return;
+		rpc->struct_add(handle, "Sddd",
+				"SOCKET", &si->sock_str,
+				"RXQ", (int)rxq,
+				"RCVBUF", (int)rcvbuf,
+				"DROPS", (int)drops);
+	}
+}
+
 static const char* core_pwd_doc[] = {
 	"Returns the working directory of server.",    /* Documentation string */
 	0                                              /* Method signature(s) */
@@ -1081,6 +1148,9 @@ static rpc_export_t core_rpc_methods[] = {
 	{"core.ps",                core_ps,                core_ps_doc,                RET_ARRAY},
 	{"core.psx",               core_psx,               core_psx_doc,               RET_ARRAY},
 	{"core.psa",               core_psa,               core_psa_doc,               RET_ARRAY},
+	{"core.psload",            core_psload,            core_psload_doc,            RET_ARRAY},
+	{"core.udp_rxq",           core_udp_rxq,           core_udp_rxq_doc,           RET_ARRAY},
+	{"core.async_tasks",       async_task_rpc_stats,   core_async_tasks_doc,       RET_ARRAY},
 	{"core.pwd",               core_pwd,               core_pwd_doc,               RET_ARRAY},
 	{"core.arg",               core_arg,               core_arg_doc,               RET_ARRAY},
 	{"core.kill",              core_kill,              core_kill_doc,              0        },
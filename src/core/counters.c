@@ -98,6 +98,14 @@ int counters_initialized(void)
 	return 1;
 }
 
+/** checks if new counters can still be registered.
+ * @return 1 before counters_prefork_init() was called, 0 after it.
+ */
+int counter_register_allowed(void)
+{
+	return (cnts_max_rows == 0) ? 1 : 0;
+}
+
 /** init the coutner hash table(s).
  * @return 0 on success, -1 on error.
  */
@@ -316,7 +324,7 @@ static struct grp_record* grp_hash_get_create(str* group)
 static struct counter_record* cnt_hash_add(
 							str* group, str* name,
 							int flags, counter_cbk_f cbk,
-							void* param, const char* doc)
+							void* param, const char* doc, int slots)
 {
 	struct str_hash_entry* e;
 	struct counter_record* cnt_rec;
@@ -324,10 +332,12 @@ static struct counter_record* cnt_hash_add(
 	struct counter_record** p;
 	counter_array_t* v;
 	int doc_len;
+	int last_id;
 	int n;
+	int i;
 
 	e = 0;
-	if (cnts_no >= MAX_COUNTER_ID)
+	if (cnts_no + slots - 1 >= MAX_COUNTER_ID)
 		/* too many counters */
 		goto error;
 	grp_rec = grp_hash_get_create(group);
@@ -350,7 +360,7 @@ static struct counter_record* cnt_hash_add(
 	cnt_rec->name.len = name->len;
 	cnt_rec->doc.s = cnt_rec->name.s + name->len +1;
 	cnt_rec->doc.len = doc_len;
-	cnt_rec->h.id = cnts_no++;
+	cnt_rec->h.id = cnts_no;
 	cnt_rec->flags = flags;
 	cnt_rec->cbk_param = param;
 	cnt_rec->cbk = cbk;
@@ -368,14 +378,16 @@ static struct counter_record* cnt_hash_add(
 	   is used only until counters_prefork_init() (after that the
 	   array is replaced with a shm version with all the needed rows).
 	 */
-	if (cnt_rec->h.id >= _cnts_row_len || _cnts_vals == 0) {
+	/* a counter can use more consecutive ids (slots), e.g. histograms */
+	last_id = cnt_rec->h.id + slots - 1;
+	if (last_id >= _cnts_row_len || _cnts_vals == 0) {
 		/* array to small or not yet allocated => reallocate/allocate it
 		   (min size PREINIT_CNTS_VALS_SIZE, max MAX_COUNTER_ID)
 		 */
-		n = (cnt_rec->h.id < PREINIT_CNTS_VALS_SIZE) ?
+		n = (last_id < PREINIT_CNTS_VALS_SIZE) ?
 				PREINIT_CNTS_VALS_SIZE :
-				((2 * (cnt_rec->h.id + (cnt_rec->h.id == 0)) < MAX_COUNTER_ID)?
-					(2 * (cnt_rec->h.id + (cnt_rec->h.id == 0))) :
+				((2 * last_id < MAX_COUNTER_ID)?
+					(2 * last_id) :
 					MAX_COUNTER_ID + 1);
 		v = pkg_realloc(_cnts_vals, n * sizeof(*_cnts_vals));
 		if (v == 0)
@@ -388,18 +400,21 @@ static struct counter_record* cnt_hash_add(
 		_cnts_row_len = n; /* record new length */
 	}
 	/* add a pointer to it in the records array */
-	if (cnt_id2record_size <= cnt_rec->h.id) {
+	while (cnt_id2record_size <= last_id) {
 		/* must increase the array */
 		p = pkg_realloc(cnt_id2record,
 						2 * cnt_id2record_size * sizeof(*cnt_id2record));
 		if (p == 0)
 			goto error;
 		cnt_id2record = p;
+		memset(&cnt_id2record[cnt_id2record_size], 0,
+				cnt_id2record_size * sizeof(*cnt_id2record));
 		cnt_id2record_size *= 2;
-		memset(&cnt_id2record[cnt_rec->h.id], 0,
-				(cnt_id2record_size - cnt_rec->h.id) * sizeof(*cnt_id2record));
 	}
-	cnt_id2record[cnt_rec->h.id] = cnt_rec;
+	/* extra slots point to the same record */
+	for (i = cnt_rec->h.id; i <= last_id; i++)
+		cnt_id2record[i] = cnt_rec;
+	cnts_no += slots;
 	/* add into the hash */
 	str_hash_add(&cnts_hash_table, e);
 	/* insert it sorted in the per group list */
@@ -463,40 +478,26 @@ static struct counter_record* cnt_hash_get_create(
 								str* group, str* name,
 								int flags,
 								counter_cbk_f cbk,
-								void* param, const char* doc)
+								void* param, const char* doc, int slots)
 {
 	struct counter_record* ret;
 
 	ret = cnt_hash_lookup(group, name);
 	if (ret)
 		return ret;
-	return cnt_hash_add(group, name, flags, cbk, param, doc);
+	return cnt_hash_add(group, name, flags, cbk, param, doc, slots);
 }
 
 
 
-/** register a new counter.
- * Can be called only before forking (e.g. from mod_init() or
- * init_child(PROC_INIT)).
- * @param handle - result parameter, it will be filled with the counter
- *                  handle on success (can be null if not needed).
- * @param group - group name
- * @param name  - counter name (group.name must be unique).
- * @param flags  - counter flags: one of CNT_F_*.
- * @param cbk   - read callback function (if set it will be called each time
- *                  someone will call counter_get()).
- * @param cbk_param - callback param.
- * @param doc       - description/documentation string.
- * @param reg_flags - register flags: 1 - don't fail if counter already
- *                    registered (act like counter_lookup(handle, group, name).
- * @return 0 on succes, < 0 on error (-1 not init or malloc error, -2 already
- *         registered (and register_flags & 1 == 0).
+/** register a new counter using slots consecutive ids (internal version).
+ * @see counter_register() and counter_register_hist().
  */
-int counter_register(	counter_handle_t* handle, const char* group,
-						const char* name, int flags,
+static int counter_register_slots(	counter_handle_t* handle,
+						const char* group, const char* name, int flags,
 						counter_cbk_f cbk, void* cbk_param,
 						const char* doc,
-						int reg_flags)
+						int reg_flags, int slots)
 {
 	str grp;
 	str n;
@@ -517,14 +518,15 @@ int counter_register(	counter_handle_t* handle, const char* group,
 	grp.len = strlen(group);
 	cnt_rec = cnt_hash_lookup(&grp, &n);
 	if (cnt_rec) {
-		if (reg_flags & 1)
+		if ((reg_flags & 1) && ((cnt_rec->flags ^ flags) & CNT_F_HISTOGRAM)==0)
 			goto found;
 		else {
 			if (handle) handle->id = 0;
 			return -2;
 		}
 	} else
-		cnt_rec = cnt_hash_get_create(&grp, &n, flags, cbk, cbk_param, doc);
+		cnt_rec = cnt_hash_get_create(&grp, &n, flags, cbk, cbk_param, doc,
+						slots);
 	if (unlikely(cnt_rec == 0))
 		goto error;
 found:
@@ -537,6 +539,59 @@ error:
 
 
 
+/** register a new counter.
+ * Can be called only before forking (e.g. from mod_init() or
+ * init_child(PROC_INIT)).
+ * @param handle - result parameter, it will be filled with the counter
+ *                  handle on success (can be null if not needed).
+ * @param group - group name
+ * @param name  - counter name (group.name must be unique).
+ * @param flags  - counter flags: one of CNT_F_*.
+ * @param cbk   - read callback function (if set it will be called each time
+ *                  someone will call counter_get()).
+ * @param cbk_param - callback param.
+ * @param doc       - description/documentation string.
+ * @param reg_flags - register flags: 1 - don't fail if counter already
+ *                    registered (act like counter_lookup(handle, group, name).
+ * @return 0 on succes, < 0 on error (-1 not init or malloc error, -2 already
+ *         registered (and register_flags & 1 == 0).
+ */
+int counter_register(	counter_handle_t* handle, const char* group,
+						const char* name, int flags,
+						counter_cbk_f cbk, void* cbk_param,
+						const char* doc,
+						int reg_flags)
+{
+	return counter_register_slots(handle, group, name,
+				flags & ~CNT_F_HISTOGRAM, cbk, cbk_param, doc, reg_flags, 1);
+}
+
+
+
+/** register a new histogram counter.
+ * Can be called only before forking (e.g. from mod_init() or
+ * init_child(PROC_INIT)). The values are recorded with counter_hist_add().
+ * @param handle - result parameter, it will be filled with the counter
+ *                  handle on success (can be null if not needed).
+ * @param group - group name
+ * @param name  - counter name (group.name must be unique).
+ * @param flags  - counter flags: one of CNT_F_*.
+ * @param doc       - description/documentation string.
+ * @param reg_flags - register flags: 1 - don't fail if the histogram is
+ *                    already registered.
+ * @return 0 on succes, < 0 on error (-1 not init or malloc error, -2 already
+ *         registered (and register_flags & 1 == 0) or not a histogram).
+ */
+int counter_register_hist(counter_handle_t* handle, const char* group,
+						const char* name, int flags, const char* doc,
+						int reg_flags)
+{
+	return counter_register_slots(handle, group, name,
+				flags | CNT_F_HISTOGRAM, 0, 0, doc, reg_flags, CNT_HIST_SLOTS);
+}
+
+
+
 /** fill in the handle of an existing counter (str parameters).
   * @param handle - filled with the corresp. handle on success.
   * @param group - counter group name. If "" the first matching
@@ -672,6 +727,12 @@ void counter_reset(counter_handle_t handle)
 	}
 	if (unlikely(cnt_id2record[handle.id]->flags & CNT_F_NO_RESET))
 		return;
+	if (unlikely(cnt_id2record[handle.id]->flags & CNT_F_HISTOGRAM)) {
+		for (r=0; r < cnts_max_rows; r++)
+			memset(&_cnts_vals[r * _cnts_row_len + handle.id], 0,
+					CNT_HIST_SLOTS * sizeof(*_cnts_vals));
+		return;
+	}
 	for (r=0; r < cnts_max_rows; r++)
 		counter_pprocess_val(r, handle) = 0;
 	return;
@@ -679,6 +740,107 @@ void counter_reset(counter_handle_t handle)
 
 
 
+/** check if a counter is a histogram.
+ * @param handle - counter handle obtained using counter_lookup() or
+ *                 counter_register_hist().
+ * @return 1 if histogram, 0 if not.
+ */
+int counter_is_hist(counter_handle_t handle)
+{
+	if (unlikely(cnt_id2record == 0 || handle.id == 0
+				|| handle.id >= cnts_no))
+		return 0;
+	return (cnt_id2record[handle.id]->h.id == handle.id
+			&& (cnt_id2record[handle.id]->flags & CNT_F_HISTOGRAM)) ? 1 : 0;
+}
+
+
+
+/** get the histogram values aggregated over all processes.
+ * @param handle - histogram counter handle.
+ * @param hv - result parameter, filled with the aggregated values.
+ * @return 0 on success, -1 on error.
+ * Note: it's racy (values can be updated while reading).
+ */
+int counter_get_hist(counter_handle_t handle, counter_hist_t* hv)
+{
+	counter_array_t* row;
+	int r;
+	int b;
+
+	if (unlikely(_cnts_vals == 0 || cnt_id2record == 0)) {
+		/* not init yet */
+		LM_BUG("counters not fully initialized yet\n");
+		return -1;
+	}
+	if (unlikely(!counter_is_hist(handle))) {
+		LM_BUG("invalid histogram counter id %d\n", handle.id);
+		return -1;
+	}
+	memset(hv, 0, sizeof(*hv));
+	for (r = 0; r < cnts_max_rows; r++) {
+		row = &_cnts_vals[r * _cnts_row_len + handle.id];
+		hv->count += row[0].v;
+		hv->sum += row[CNT_HIST_SUM].v;
+		for (b = 0; b < CNT_HIST_BUCKETS; b++)
+			hv->buckets[b] += row[CNT_HIST_BUCKET0 + b].v;
+	}
+	return 0;
+}
+
+
+
+/** return the upper limit (inclusive) of a histogram bucket.
+ * @param b - bucket index.
+ * @return upper limit, ULONG_MAX for the last bucket (+Inf).
+ */
+unsigned long counter_hist_bucket_le(int b)
+{
+	int k;
+
+	if (b <= 0)
+		return 0;
+	if (b >= CNT_HIST_BUCKETS - 1)
+		return ULONG_MAX;
+	k = b - 1;
+	if (k < 2)
+		return (unsigned long)k + 1;
+	return ((2UL | ((k - 2) & 1)) + 1) << ((k - 2) / 2);
+}
+
+
+
+/** estimate a percentile from aggregated histogram values.
+ * @param hv - aggregated histogram values.
+ * @param pct - percentile (0 - 100).
+ * @return upper limit of the bucket holding the percentile, 0 if empty.
+ */
+unsigned long counter_hist_quantile(counter_hist_t* hv, int pct)
+{
+	counter_val_t total;
+	counter_val_t n;
+	counter_val_t rank;
+	int b;
+
+	total = 0;
+	for (b = 0; b < CNT_HIST_BUCKETS; b++)
+		total += hv->buckets[b];
+	if (total <= 0)
+		return 0;
+	rank = (total * pct + 99) / 100;
+	if (rank <= 0)
+		rank = 1;
+	n = 0;
+	for (b = 0; b < CNT_HIST_BUCKETS; b++) {
+		n += hv->buckets[b];
+		if (n >= rank)
+			return counter_hist_bucket_le(b);
+	}
+	return ULONG_MAX;
+}
+
+
+
 /** return the name for counter handle.
  * @param handle - counter handle obtained using counter_lookup() or
  *                 counter_register().
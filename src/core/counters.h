@@ -29,15 +29,36 @@
  *    counter_lookup(&h, "my_counters", "foo");
  *  4. get a counter value (the handle can be obtained like above)
  *    val = counter_get(h);
+ *
+ *  Histogram counters (e.g. for latencies):
+ *  1. register (before forking):
+ *    counter_register_hist(&h, "my_counters", "foo_time_us", 0,
+ *                           "foo time in microseconds", 0);
+ *  2. record a value:
+ *    counter_hist_add(h, duration_us);
+ *  3. get the aggregated buckets:
+ *    counter_get_hist(h, &hv);
+ *  counter_get_val(h) on a histogram returns the number of recorded values.
  */
 
 #ifndef __counters_h
 #define __counters_h
 
 #include "pt.h"
+#include "bit_scan.h"
 
 /* counter flags */
 #define CNT_F_NO_RESET 1 /* don't reset */
+#define CNT_F_HISTOGRAM 2 /* histogram, set internally by counter_register_hist */
+
+/* histogram counters - log-linear buckets, two per power of 2, first
+ * bucket for 0 and last one for values above 2^31 (+Inf).
+ * A histogram uses CNT_HIST_SLOTS consecutive entries of a process row:
+ * the recorded values count (at the handle id), the sum and the buckets */
+#define CNT_HIST_BUCKETS 64
+#define CNT_HIST_SUM 1
+#define CNT_HIST_BUCKET0 2
+#define CNT_HIST_SLOTS (CNT_HIST_BUCKET0 + CNT_HIST_BUCKETS)
 
 #define KSR_STATS_NAMESEP "_"
 
@@ -77,6 +98,16 @@ struct counter_def_s {
 typedef struct counter_def_s counter_def_t;
 
 
+/* aggregated (all processes) histogram values */
+struct counter_hist_s {
+	counter_val_t count;
+	counter_val_t sum;
+	counter_val_t buckets[CNT_HIST_BUCKETS];
+};
+
+typedef struct counter_hist_s counter_hist_t;
+
+
 
 extern counter_array_t* _cnts_vals;
 extern int _cnts_row_len; /* number of elements per row */
@@ -84,6 +115,7 @@ extern int _cnts_row_len; /* number of elements per row */
 
 
 int counters_initialized(void);
+int counter_register_allowed(void);
 int init_counters(void);
 void destroy_counters(void);
 int counters_prefork_init(int max_process_no);
@@ -106,6 +138,14 @@ char* counter_get_name(counter_handle_t handle);
 char* counter_get_group(counter_handle_t handle);
 char* counter_get_doc(counter_handle_t handle);
 
+int counter_register_hist(counter_handle_t* handle, const char* group,
+						const char* name, int flags, const char* doc,
+						int reg_flags);
+int counter_is_hist(counter_handle_t handle);
+int counter_get_hist(counter_handle_t handle, counter_hist_t* hv);
+unsigned long counter_hist_bucket_le(int b);
+unsigned long counter_hist_quantile(counter_hist_t* hv, int pct);
+
 /** gets the per process value of counter h for process p_no.
  *  Note that if used before counter_prefork_init() process_no is 0
  *  and _cnts_vals will point into a temporary one "row"  array.
@@ -136,6 +176,46 @@ inline static void counter_add(counter_handle_t handle, int v)
 
 
 
+/** returns the histogram bucket index for a value.
+ * Buckets upper limits (inclusive) are 0, 1, 2, 3, 4, 6, 8, 12, 16, ...
+ * @param v - value.
+ */
+inline static int counter_hist_bucket(unsigned long v)
+{
+	int e;
+	int b;
+
+	if (v == 0)
+		return 0;
+	v--;
+	if (v < 2)
+		return (int)v + 1;
+	e = bit_scan_reverse(v);
+	b = 3 + (e - 1) * 2 + (int)((v >> (e - 1)) & 1);
+	return (b < CNT_HIST_BUCKETS) ? b : CNT_HIST_BUCKETS - 1;
+}
+
+
+
+/** records a value in a histogram counter.
+ * Only the current process row is updated, no locking needed.
+ * @param handle - histogram counter handle (see counter_register_hist()).
+ * @param v - value.
+ */
+inline static void counter_hist_add(counter_handle_t handle, unsigned long v)
+{
+	counter_array_t* row;
+
+	if (handle.id == 0)
+		return;
+	row = &_cnts_vals[process_no * _cnts_row_len + handle.id];
+	row[0].v++;
+	row[CNT_HIST_SUM].v += v;
+	row[CNT_HIST_BUCKET0 + counter_hist_bucket(v)].v++;
+}
+
+
+
 void counter_iterate_grp_names(void (*cbk)(void* p, str* grp_name), void* p);
 void counter_iterate_grp_var_names(	const char* group,
 									void (*cbk)(void* p, str* var_name),
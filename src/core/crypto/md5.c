@@ -142,13 +142,16 @@ U_MD5Final(unsigned char digest[MD5_DIGEST_LENGTH], MD5_CTX *ctx)
 
 /* #define F1(x, y, z) (x & y | ~x & z) */
 #define F1(x, y, z) (z ^ (x & (y ^ z)))
-#define F2(x, y, z) F1(z, x, y)
+/* F1(z, x, y) - the two terms never have common bits, so they can be
+ * added, which lets the compiler fold them into the step sum */
+#define F2(x, y, z) ((x & z) + (y & ~z))
 #define F3(x, y, z) (x ^ y ^ z)
 #define F4(x, y, z) (y ^ (x | ~z))
 
-/* This is the central step in the MD5 algorithm. */
+/* This is the central step in the MD5 algorithm.
+ * The data is added first, as it does not depend on the previous step. */
 #define MD5STEP(f, w, x, y, z, data, s) \
-	( w += f(x, y, z) + data,  w = w<<s | w>>(32-s),  w += x )
+	( w += data,  w += f(x, y, z),  w = w<<s | w>>(32-s),  w += x )
 
 /*
  * The core of the MD5 algorithm, this alters an existing MD5 hash to
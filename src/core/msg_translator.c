@@ -3313,6 +3313,8 @@ int sip_msg_update_buffer(sip_msg_t *msg, str *obuf)
 	msg->rpl_send_flags = tmp.rpl_send_flags;
 	msg->dst_uri = tmp.dst_uri;
 	msg->path_vec = tmp.path_vec;
+	/* same id, pid and buf pointer - let the users of the content know */
+	msg->buf_gen = tmp.buf_gen + 1;
 
 	memcpy(msg->buf, obuf->s, obuf->len);
 	msg->len = obuf->len;
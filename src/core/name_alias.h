@@ -32,18 +32,28 @@
 
 #include "str.h"
 #include "dprint.h"
+#include "hashes.h"
 #include "mem/mem.h"
 
+/* number of slots in the aliases hash table (power of 2) */
+#define HOST_ALIAS_HASH_SIZE 1024
 
 typedef struct host_alias{
 	str alias;
 	unsigned short port;
 	unsigned short proto;
 	struct host_alias* next;
+	struct host_alias* hnext; /* next in the same hash slot */
 } host_alias_t;
 
 
 extern struct host_alias* aliases;
+/* aliases indexed by the case insensitive hash of the name, port and
+ * proto are not part of the key to keep the 0 wildcard matching */
+extern struct host_alias* aliases_hash[HOST_ALIAS_HASH_SIZE];
+
+#define host_alias_hash(name, len) \
+	(get_hash1_case_raw((name), (len)) & (HOST_ALIAS_HASH_SIZE-1))
 
 
 /** returns 1 if  name is in the alias list; if port=0, port no is ignored
@@ -58,7 +68,7 @@ static inline int grep_aliases(char* name, int len, unsigned short port,
 		name++;
 		len-=2;
 	}
-	for(a=aliases;a;a=a->next) {
+	for(a=aliases_hash[host_alias_hash(name, len)];a;a=a->hnext) {
 		LM_DBG("matching (%d:%.*s:%d) vs. (%d:%.*s:%d)\n",
 				proto, len, name, port, a->proto, a->alias.len, a->alias.s,
 				a->port);
@@ -81,6 +91,7 @@ static inline int add_alias(char* name, int len, unsigned short port,
 								unsigned short proto)
 {
 	struct host_alias* a;
+	unsigned int h;
 
 	if ((port) && (proto)) {
 		/* don't add if there is already an alias matching it */
@@ -89,7 +100,7 @@ static inline int add_alias(char* name, int len, unsigned short port,
 		}
 	} else {
 		/* don't add if already in the list with port or proto ==0*/
-		for(a=aliases;a;a=a->next) {
+		for(a=aliases_hash[host_alias_hash(name, len)];a;a=a->hnext) {
 			if ((a->alias.len==len) && (a->port==port) && (a->proto==proto)
 					&& (strncasecmp(a->alias.s, name, len)==0)) {
 				return 0;
@@ -111,6 +122,9 @@ static inline int add_alias(char* name, int len, unsigned short port,
 	a->proto=proto;
 	a->next=aliases;
 	aliases=a;
+	h=host_alias_hash(name, len);
+	a->hnext=aliases_hash[h];
+	aliases_hash[h]=a;
 	return 1;
 error:
 	PKG_MEM_ERROR;
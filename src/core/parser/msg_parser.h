@@ -386,6 +386,8 @@ typedef struct sip_msg {
 	str ruid;
 	str location_ua;
 	int otcpid; /*!< outbound tcp connection id, if known */
+	unsigned int buf_gen; /*!< incremented when the content of buf is
+							updated in place (e.g., msg_apply_changes()) */
 
 	/* structure with fields that are needed for local processing
 	 * - not cloned to shm, reset to 0 in the clone */
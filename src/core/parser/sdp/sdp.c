@@ -35,25 +35,123 @@
 #include "sdp.h"
 #include "sdp_helpr_funcs.h"
 
-#define SDP_USE_PKG_MEM 0
-#define SDP_USE_SHM_MEM 1
 
 #define HOLD_IP_STR "0.0.0.0"
 #define HOLD_IP_LEN 7
 
+#define SDP_ALIGN(_s) (((_s) + sizeof(long) - 1) & ~(sizeof(long) - 1))
+
+/* min size of an extra pkg chunk, when the estimation was too low */
+#define SDP_ARENA_MIN 1024
+
 /**
- * Creates and initialize a new sdp_info structure
+ * pkg memory chunk where the parsed cells are carved from
  */
-static inline int new_sdp(struct sip_msg* _m)
+typedef struct sdp_arena {
+	struct sdp_arena *next;
+	char *pos;
+	char *end;
+} sdp_arena_t;
+
+/**
+ * Get zeroed memory for a parsed cell from the arena of the sdp.
+ */
+static void *sdp_arena_alloc(sdp_info_t* _sdp, int size)
+{
+	sdp_arena_t *a;
+	void *p;
+	int asize;
+
+	size = SDP_ALIGN(size);
+	a = (sdp_arena_t*)_sdp->arena;
+	if (a == NULL || a->pos + size > a->end) {
+		asize = (size > SDP_ARENA_MIN) ? size : SDP_ARENA_MIN;
+		a = (sdp_arena_t*)pkg_malloc(SDP_ALIGN(sizeof(sdp_arena_t)) + asize);
+		if (a == NULL) {
+			PKG_MEM_ERROR;
+			return NULL;
+		}
+		a->pos = (char*)a + SDP_ALIGN(sizeof(sdp_arena_t));
+		a->end = a->pos + asize;
+		a->next = (sdp_arena_t*)_sdp->arena;
+		_sdp->arena = a;
+	}
+	p = a->pos;
+	a->pos += size;
+	memset(p, 0, size);
+	return p;
+}
+
+/**
+ * Estimate the memory needed for the parsed cells, with a single pass
+ * over the lines of the body, counting sessions, streams, payloads and
+ * ICE candidates.
+ */
+static int sdp_estimate_size(str *body)
+{
+	char *p, *q, *end;
+	int sessions = 1;
+	int streams = 0;
+	int payloads = 0;
+	int ices = 0;
+
+	p = body->s;
+	end = body->s + body->len;
+	while (p + 1 < end) {
+		q = memchr(p, '\n', end - p);
+		if (q == NULL)
+			q = end;
+		if (p[1] == '=') {
+			switch (*p) {
+				case 'v':
+					sessions++;
+					break;
+				case 'm':
+					streams++;
+					for (; p < q; p++) {
+						if (*p == ' ')
+							payloads++;
+					}
+					break;
+				case 'a':
+					if (q - p > 12 && strncasecmp(p, "a=candidate:", 12) == 0)
+						ices++;
+					break;
+			}
+		}
+		p = q + 1;
+	}
+
+	return sessions * SDP_ALIGN(sizeof(sdp_session_cell_t))
+		+ streams * (SDP_ALIGN(sizeof(sdp_stream_cell_t)) + sizeof(long))
+		+ payloads * (SDP_ALIGN(sizeof(sdp_payload_attr_t))
+				+ sizeof(sdp_payload_attr_t*))
+		+ ices * SDP_ALIGN(sizeof(sdp_ice_attr_t));
+}
+
+/**
+ * Creates and initialize a new sdp_info structure, with the first
+ * arena chunk in the same pkg block
+ */
+static inline int new_sdp(struct sip_msg* _m, str* body)
 {
 	sdp_info_t* sdp;
+	sdp_arena_t *a;
+	int asize;
 
-	sdp = (sdp_info_t*)pkg_malloc(sizeof(sdp_info_t));
+	asize = sdp_estimate_size(body);
+	sdp = (sdp_info_t*)pkg_malloc(SDP_ALIGN(sizeof(sdp_info_t))
+			+ SDP_ALIGN(sizeof(sdp_arena_t)) + asize);
 	if (sdp == NULL) {
 		PKG_MEM_ERROR;
 		return -1;
 	}
 	memset( sdp, 0, sizeof(sdp_info_t));
+	a = (sdp_arena_t*)((char*)sdp + SDP_ALIGN(sizeof(sdp_info_t)));
+	a->next = NULL;
+	a->pos = (char*)a + SDP_ALIGN(sizeof(sdp_arena_t));
+	a->end = a->pos + asize;
+	sdp->arena = a;
 	sdp->type = MSG_BODY_SDP;
 	sdp->free = (free_msg_body_f)free_sdp;
 	_m->body = (msg_body_t*)sdp;
@@ -67,15 +165,12 @@ static inline int new_sdp(struct sip_msg* _m)
 static inline sdp_session_cell_t *add_sdp_session(sdp_info_t* _sdp, int session_num, str* cnt_disp)
 {
 	sdp_session_cell_t *session;
-	int len;
 
-	len = sizeof(sdp_session_cell_t);
-	session = (sdp_session_cell_t*)pkg_malloc(len);
+	session = (sdp_session_cell_t*)sdp_arena_alloc(_sdp,
+			sizeof(sdp_session_cell_t));
 	if (session == NULL) {
-		PKG_MEM_ERROR;
 		return NULL;
 	}
-	memset( session, 0, len);
 
 	session->session_num = session_num;
 	if (cnt_disp != NULL) {
@@ -94,19 +189,17 @@ static inline sdp_session_cell_t *add_sdp_session(sdp_info_t* _sdp, int session_
 /**
  * Allocate a new stream cell.
  */
-static inline sdp_stream_cell_t *add_sdp_stream(sdp_session_cell_t* _session, int stream_num,
+static inline sdp_stream_cell_t *add_sdp_stream(sdp_info_t* _sdp,
+		sdp_session_cell_t* _session, int stream_num,
 		str* media, str* port, str* transport, str* payloads, int is_rtp, int pf, str* sdp_ip)
 {
 	sdp_stream_cell_t *stream;
-	int len;
 
-	len = sizeof(sdp_stream_cell_t);
-	stream = (sdp_stream_cell_t*)pkg_malloc(len);
+	stream = (sdp_stream_cell_t*)sdp_arena_alloc(_sdp,
+			sizeof(sdp_stream_cell_t));
 	if (stream == NULL) {
-		PKG_MEM_ERROR;
 		return NULL;
 	}
-	memset( stream, 0, len);
 
 	stream->stream_num = stream_num;
 
@@ -136,18 +229,16 @@ static inline sdp_stream_cell_t *add_sdp_stream(sdp_session_cell_t* _session, in
 /**
  * Allocate a new payload.
  */
-static inline sdp_payload_attr_t *add_sdp_payload(sdp_stream_cell_t* _stream, int payload_num, str* payload)
+static inline sdp_payload_attr_t *add_sdp_payload(sdp_info_t* _sdp,
+		sdp_stream_cell_t* _stream, int payload_num, str* payload)
 {
 	sdp_payload_attr_t *payload_attr;
-	int len;
 
-	len = sizeof(sdp_payload_attr_t);
-	payload_attr = (sdp_payload_attr_t*)pkg_malloc(len);
+	payload_attr = (sdp_payload_attr_t*)sdp_arena_alloc(_sdp,
+			sizeof(sdp_payload_attr_t));
 	if (payload_attr == NULL) {
-		PKG_MEM_ERROR;
 		return NULL;
 	}
-	memset( payload_attr, 0, len);
 
 	payload_attr->payload_num = payload_num;
 	payload_attr->rtp_payload.s = payload->s;
@@ -161,11 +252,34 @@ static inline sdp_payload_attr_t *add_sdp_payload(sdp_stream_cell_t* _stream, in
 	return payload_attr;
 }
 
+/**
+ * Allocate a new ice attribute.
+ */
+static inline sdp_ice_attr_t *add_sdp_ice(sdp_info_t* _sdp,
+		sdp_stream_cell_t* _stream, sdp_ice_attr_t *ice)
+{
+	sdp_ice_attr_t *ice_attr;
+
+	ice_attr = (sdp_ice_attr_t*)sdp_arena_alloc(_sdp, sizeof(sdp_ice_attr_t));
+	if (ice_attr == NULL) {
+		return NULL;
+	}
+	memcpy(ice_attr, ice, sizeof(sdp_ice_attr_t));
+
+	/* Insert the new ice attribute */
+	ice_attr->next = _stream->ice_attr;
+	_stream->ice_attr = ice_attr;
+	_stream->ice_attrs_num++;
+
+	return ice_attr;
+}
+
 
 /**
  * Initialize fast access pointers.
  */
-static inline sdp_payload_attr_t** init_p_payload_attr(sdp_stream_cell_t* _stream, int pkg)
+static inline sdp_payload_attr_t** init_p_payload_attr(sdp_info_t* _sdp,
+		sdp_stream_cell_t* _stream)
 {
 	int payloads_num, i;
 	sdp_payload_attr_t *payload;
@@ -179,20 +293,9 @@ static inline sdp_payload_attr_t** init_p_payload_attr(sdp_stream_cell_t* _strea
 		LM_ERR("Invalid number of payloads\n");
 		return NULL;
 	}
-	if (pkg == SDP_USE_PKG_MEM) {
-		_stream->p_payload_attr = (sdp_payload_attr_t**)pkg_malloc(payloads_num * sizeof(sdp_payload_attr_t*));
-	} else if (pkg == SDP_USE_SHM_MEM) {
-		_stream->p_payload_attr = (sdp_payload_attr_t**)shm_malloc(payloads_num * sizeof(sdp_payload_attr_t*));
-	} else {
-		LM_ERR("undefined memory type\n");
-		return NULL;
-	}
+	_stream->p_payload_attr = (sdp_payload_attr_t**)sdp_arena_alloc(_sdp,
+			payloads_num * sizeof(sdp_payload_attr_t*));
 	if (_stream->p_payload_attr == NULL) {
-		if (pkg == SDP_USE_PKG_MEM) {
-			PKG_MEM_ERROR;
-		} else if (pkg == SDP_USE_SHM_MEM) {
-			SHM_MEM_ERROR;
-		}
 		return NULL;
 	}
 
@@ -206,6 +309,31 @@ static inline sdp_payload_attr_t** init_p_payload_attr(sdp_stream_cell_t* _strea
 	return _stream->p_payload_attr;
 }
 
+/**
+ * Find a payload by its number, starting with the position given by
+ * hint - the rtpmap and fmtp lines follow usually the order of the m-line
+ */
+static inline sdp_payload_attr_t *sdp_payload_lookup(sdp_stream_cell_t *stream,
+		str *rtp_payload, int *hint)
+{
+	sdp_payload_attr_t *payload;
+	int i, k;
+
+	for (k=0; k<stream->payloads_num; k++) {
+		i = *hint + k;
+		if (i >= stream->payloads_num)
+			i -= stream->payloads_num;
+		payload = stream->p_payload_attr[i];
+		if (rtp_payload->len == payload->rtp_payload.len &&
+			(strncmp(rtp_payload->s, payload->rtp_payload.s, rtp_payload->len)==0)) {
+			*hint = (i + 1 < stream->payloads_num) ? i + 1 : 0;
+			return payload;
+		}
+	}
+
+	return NULL;
+}
+
 /*
  * Setters ...
  */
@@ -371,7 +499,10 @@ static int parse_sdp_session(str *sdp_body, int session_num, str *cnt_disp, sdp_
 	sdp_session_cell_t *session;
 	sdp_stream_cell_t *stream;
 	sdp_payload_attr_t *payload_attr;
+	sdp_ice_attr_t ice_attr;
 	int parse_payload_attr;
+	int payload_hint;
+	char ac;
 	str fmtp_string;
 	str remote_candidates = {"a:remote-candidates:", 20};
 
@@ -491,7 +622,7 @@ static int parse_sdp_session(str *sdp_body, int session_num, str *cnt_disp, sdp_
 		}
 
 		/* Allocate a stream cell */
-		stream = add_sdp_stream(session, stream_num, &sdp_media, &sdp_port, &sdp_transport, &sdp_payload, is_rtp, pf, &sdp_ip);
+		stream = add_sdp_stream(_sdp, session, stream_num, &sdp_media, &sdp_port, &sdp_transport, &sdp_payload, is_rtp, pf, &sdp_ip);
 		if (stream == 0) return -1;
 
         /* Store fast access ptr to raw stream */
@@ -518,7 +649,7 @@ static int parse_sdp_session(str *sdp_body, int session_num, str *cnt_disp, sdp_
 				a1p = eat_token_end(tmpstr1.s, tmpstr1.s + tmpstr1.len);
 				payload.s = tmpstr1.s;
 				payload.len = a1p - tmpstr1.s;
-				payload_attr = add_sdp_payload(stream, payloadnum, &payload);
+				payload_attr = add_sdp_payload(_sdp, stream, payloadnum, &payload);
 				if (payload_attr == NULL) return -1;
 				tmpstr1.len -= payload.len;
 				tmpstr1.s = a1p;
@@ -531,7 +662,7 @@ static int parse_sdp_session(str *sdp_body, int session_num, str *cnt_disp, sdp_
 			}
 
 			/* Initialize fast access pointers */
-			if (NULL == init_p_payload_attr(stream, SDP_USE_PKG_MEM)) {
+			if (NULL == init_p_payload_attr(_sdp, stream)) {
 				return -1;
 			}
 			parse_payload_attr = 1;
@@ -540,6 +671,7 @@ static int parse_sdp_session(str *sdp_body, int session_num, str *cnt_disp, sdp_
 		}
 
 		payload_attr = 0;
+		payload_hint = 0;
 		/* Let's figure out the atributes */
 		a1p = find_sdp_line(m1p, m2p, 'a');
 		a2p = a1p;
@@ -549,38 +681,43 @@ static int parse_sdp_session(str *sdp_body, int session_num, str *cnt_disp, sdp_
 				break;
 			tmpstr1.s = a2p;
 			tmpstr1.len = m2p - a2p;
+			/* first char of the attribute name, to try only the
+			 * extractors that can match it */
+			ac = (tmpstr1.len > 2) ? (tmpstr1.s[2] | 0x20) : 0;
 
-			if (parse_payload_attr && extract_ptime(&tmpstr1, &stream->ptime) == 0) {
+			if (ac == 'p' && parse_payload_attr && extract_ptime(&tmpstr1, &stream->ptime) == 0) {
 				a1p = stream->ptime.s + stream->ptime.len;
-			} else if (parse_payload_attr && extract_sendrecv_mode(&tmpstr1,
+			} else if ((ac == 's' || ac == 'r' || ac == 'i')
+					&& parse_payload_attr && extract_sendrecv_mode(&tmpstr1,
 					&stream->sendrecv_mode, &stream->is_on_hold) == 0) {
 				a1p = stream->sendrecv_mode.s + stream->sendrecv_mode.len;
-			} else if (parse_payload_attr && extract_rtpmap(&tmpstr1, &rtp_payload, &rtp_enc, &rtp_clock, &rtp_params) == 0) {
+			} else if (ac == 'r' && parse_payload_attr && extract_rtpmap(&tmpstr1, &rtp_payload, &rtp_enc, &rtp_clock, &rtp_params) == 0) {
 				if (rtp_params.len != 0 && rtp_params.s != NULL) {
 					a1p = rtp_params.s + rtp_params.len;
 				} else {
 					a1p = rtp_clock.s + rtp_clock.len;
 				}
-				payload_attr = (sdp_payload_attr_t*)get_sdp_payload4payload(stream, &rtp_payload);
+				payload_attr = sdp_payload_lookup(stream, &rtp_payload, &payload_hint);
 				set_sdp_payload_attr(payload_attr, &rtp_enc, &rtp_clock, &rtp_params);
-			} else if (extract_rtcp(&tmpstr1, &stream->rtcp_port) == 0) {
+			} else if (ac == 'r' && extract_rtcp(&tmpstr1, &stream->rtcp_port) == 0) {
 				a1p = stream->rtcp_port.s + stream->rtcp_port.len;
-			} else if (parse_payload_attr && extract_fmtp(&tmpstr1,&rtp_payload,&fmtp_string) == 0){
+			} else if (ac == 'f' && parse_payload_attr && extract_fmtp(&tmpstr1,&rtp_payload,&fmtp_string) == 0){
 				a1p = fmtp_string.s + fmtp_string.len;
-				payload_attr = (sdp_payload_attr_t*)get_sdp_payload4payload(stream, &rtp_payload);
+				payload_attr = sdp_payload_lookup(stream, &rtp_payload, &payload_hint);
 				set_sdp_payload_fmtp(payload_attr, &fmtp_string);
-			} else if (parse_payload_attr && extract_candidate(&tmpstr1, stream) == 0) {
-			        a1p += 2;
-			} else if (parse_payload_attr && extract_field(&tmpstr1, &stream->remote_candidates,
+			} else if (ac == 'c' && parse_payload_attr && extract_candidate(&tmpstr1, &ice_attr) == 0) {
+				if (add_sdp_ice(_sdp, stream, &ice_attr) == NULL) return -1;
+				a1p += 2;
+			} else if (ac == 'r' && parse_payload_attr && extract_field(&tmpstr1, &stream->remote_candidates,
 								       remote_candidates) == 0) {
 			        a1p += 2;
-			} else if (extract_accept_types(&tmpstr1, &stream->accept_types) == 0) {
+			} else if (ac == 'a' && extract_accept_types(&tmpstr1, &stream->accept_types) == 0) {
 				a1p = stream->accept_types.s + stream->accept_types.len;
-			} else if (extract_accept_wrapped_types(&tmpstr1, &stream->accept_wrapped_types) == 0) {
+			} else if (ac == 'a' && extract_accept_wrapped_types(&tmpstr1, &stream->accept_wrapped_types) == 0) {
 				a1p = stream->accept_wrapped_types.s + stream->accept_wrapped_types.len;
-			} else if (extract_max_size(&tmpstr1, &stream->max_size) == 0) {
+			} else if (ac == 'm' && extract_max_size(&tmpstr1, &stream->max_size) == 0) {
 				a1p = stream->max_size.s + stream->max_size.len;
-			} else if (extract_path(&tmpstr1, &stream->path) == 0) {
+			} else if (ac == 'p' && extract_path(&tmpstr1, &stream->path) == 0) {
 				a1p = stream->path.s + stream->path.len;
 			} else {
 				/* unknown a= line, ignore -- jump over it */
@@ -736,7 +873,7 @@ int parse_sdp(struct sip_msg* _m)
 		switch (mime&0x00ff) {
 		case SUBTYPE_SDP:
 			/* LM_DBG("SUBTYPE_SDP: %d\n",mime&0x00ff); */
-			if (new_sdp(_m) < 0) {
+			if (new_sdp(_m, &body) < 0) {
 				LM_ERR("Can't create sdp\n");
 				return -1;
 			}
@@ -763,7 +900,7 @@ int parse_sdp(struct sip_msg* _m)
 			/* LM_DBG("SUBTYPE_MIXED: %d <%.*s>\n",mime&0x00ff,_m->content_type->body.len,_m->content_type->body.s); */
 			if(get_mixed_part_delimiter(&(_m->content_type->body),&mp_delimiter) > 0) {
 				/*LM_DBG("got delimiter: <%.*s>\n",mp_delimiter.len,mp_delimiter.s); */
-				if (new_sdp(_m) < 0) {
+				if (new_sdp(_m, &body) < 0) {
 					LM_ERR("Can't create sdp\n");
 					return -1;
 				}
@@ -798,40 +935,17 @@ int parse_sdp(struct sip_msg* _m)
 void free_sdp(sdp_info_t** _sdp)
 {
 	sdp_info_t *sdp = *_sdp;
-	sdp_session_cell_t *session, *l_session;
-	sdp_stream_cell_t *stream, *l_stream;
-	sdp_payload_attr_t *payload, *l_payload;
-        sdp_ice_attr_t *tmp;
+	sdp_arena_t *a, *l_a;
 
 	LM_DBG("_sdp = %p\n", _sdp);
 	if (sdp == NULL) return;
 	LM_DBG("sdp = %p\n", sdp);
-	session = sdp->sessions;
-	LM_DBG("session = %p\n", session);
-	while (session) {
-		l_session = session;
-		session = session->next;
-		stream = l_session->streams;
-		while (stream) {
-			l_stream = stream;
-			stream = stream->next;
-			payload = l_stream->payload_attr;
-			while (payload) {
-				l_payload = payload;
-				payload = payload->next;
-				pkg_free(l_payload);
-			}
-			if (l_stream->p_payload_attr) {
-				pkg_free(l_stream->p_payload_attr);
-			}
-			while (l_stream->ice_attr) {
-			    tmp = l_stream->ice_attr->next;
-			    pkg_free(l_stream->ice_attr);
-			    l_stream->ice_attr = tmp;
-			}
-			pkg_free(l_stream);
-		}
-		pkg_free(l_session);
+	/* the last chunk is in the same block with the sdp structure */
+	a = (sdp_arena_t*)sdp->arena;
+	while (a && a->next) {
+		l_a = a;
+		a = a->next;
+		pkg_free(l_a);
 	}
 	pkg_free(sdp);
 	*_sdp = NULL;
@@ -925,240 +1039,138 @@ void print_sdp(sdp_info_t* sdp, int log_level)
 }
 
 /*
- * Free cloned stream.
+ * The clones are flat: a single shm block with the cells at the start
+ * and the text of the fields after them.
  */
-void free_cloned_sdp_stream(sdp_stream_cell_t *_stream)
-{
-	sdp_stream_cell_t *stream, *l_stream;
-	sdp_payload_attr_t *payload, *l_payload;
 
-	stream = _stream;
-	while (stream) {
-		l_stream = stream;
-		stream = stream->next;
-		payload = l_stream->payload_attr;
-		while (payload) {
-			l_payload = payload;
-			payload = payload->next;
-			shm_free(l_payload);
-		}
-		if (l_stream->p_payload_attr) {
-			shm_free(l_stream->p_payload_attr);
-		}
-		shm_free(l_stream);
-	}
-}
+#define SDP_CLONE_STR(_dst, _src, _p) \
+	do { \
+		if ((_src).len) { \
+			(_dst).s = (_p); \
+			(_dst).len = (_src).len; \
+			memcpy((_p), (_src).s, (_src).len); \
+			(_p) += (_src).len; \
+		} \
+	} while(0)
 
 /*
  * Free cloned session.
  */
 void free_cloned_sdp_session(sdp_session_cell_t *_session)
 {
-	sdp_session_cell_t *session, *l_session;
-
-	session = _session;
-	while (session) {
-		l_session = session;
-		session = l_session->next;
-		free_cloned_sdp_stream(l_session->streams);
-		shm_free(l_session);
-	}
+	if (_session)
+		shm_free(_session);
 }
 
 void free_cloned_sdp(sdp_info_t* sdp)
 {
-	free_cloned_sdp_session(sdp->sessions);
-	shm_free(sdp);
+	if (sdp)
+		shm_free(sdp);
 }
 
-sdp_payload_attr_t * clone_sdp_payload_attr(sdp_payload_attr_t *attr)
+/*
+ * Size of the cells (csize) and of the text (tsize) of a stream clone.
+ */
+static void clone_sdp_stream_size(sdp_stream_cell_t *stream, int *csize,
+		int *tsize)
 {
-	sdp_payload_attr_t * clone_attr;
-	int len;
-	char *p;
-
-	if (attr == NULL) {
-		LM_ERR("arg:NULL\n");
-		return NULL;
-	}
+	sdp_payload_attr_t *attr;
+	int i;
 
-	len = sizeof(sdp_payload_attr_t) +
-			attr->rtp_payload.len +
+	*csize += SDP_ALIGN(sizeof(sdp_stream_cell_t))
+		+ SDP_ALIGN(stream->payloads_num * sizeof(sdp_payload_attr_t*))
+		+ stream->payloads_num * SDP_ALIGN(sizeof(sdp_payload_attr_t));
+	/* NOTE: we are not cloning RFC4975 attributes */
+	*tsize += stream->ip_addr.len +
+			stream->media.len +
+			stream->port.len +
+			stream->transport.len +
+			stream->sendrecv_mode.len +
+			stream->ptime.len +
+			stream->payloads.len +
+			stream->bw_type.len +
+			stream->bw_width.len +
+			stream->rtcp_port.len;
+	for (i=0;i<stream->payloads_num;i++) {
+		attr = stream->p_payload_attr[i];
+		*tsize += attr->rtp_payload.len +
 			attr->rtp_enc.len +
 			attr->rtp_clock.len +
 			attr->rtp_params.len +
 			attr->fmtp_string.len;
-	clone_attr = (sdp_payload_attr_t*)shm_malloc(len);
-	if (clone_attr == NULL) {
-		SHM_MEM_ERROR;
-		return NULL;
-	}
-	memset( clone_attr, 0, len);
-	p = (char*)(clone_attr+1);
-
-	clone_attr->payload_num = attr->payload_num;
-
-	if (attr->rtp_payload.len) {
-		clone_attr->rtp_payload.s = p;
-		clone_attr->rtp_payload.len = attr->rtp_payload.len;
-		memcpy( p, attr->rtp_payload.s, attr->rtp_payload.len);
-		p += attr->rtp_payload.len;
-	}
-
-	if (attr->rtp_enc.len) {
-		clone_attr->rtp_enc.s = p;
-		clone_attr->rtp_enc.len = attr->rtp_enc.len;
-		memcpy( p, attr->rtp_enc.s, attr->rtp_enc.len);
-		p += attr->rtp_enc.len;
-	}
-
-	if (attr->rtp_clock.len) {
-		clone_attr->rtp_clock.s = p;
-		clone_attr->rtp_clock.len = attr->rtp_clock.len;
-		memcpy( p, attr->rtp_clock.s, attr->rtp_clock.len);
-		p += attr->rtp_clock.len;
 	}
+}
 
-	if (attr->rtp_params.len) {
-		clone_attr->rtp_params.s = p;
-		clone_attr->rtp_params.len = attr->rtp_params.len;
-		memcpy( p, attr->rtp_params.s, attr->rtp_params.len);
-		p += attr->rtp_params.len;
-	}
+/*
+ * Size of the cells (csize) and of the text (tsize) of a session clone.
+ */
+static void clone_sdp_session_size(sdp_session_cell_t *session, int *csize,
+		int *tsize)
+{
+	sdp_stream_cell_t *stream;
 
-	if (attr->fmtp_string.len) {
-		clone_attr->fmtp_string.s = p;
-		clone_attr->fmtp_string.len = attr->fmtp_string.len;
-		memcpy( p, attr->fmtp_string.s, attr->fmtp_string.len);
-		p += attr->fmtp_string.len;
+	*csize += SDP_ALIGN(sizeof(sdp_session_cell_t));
+	*tsize += session->cnt_disp.len +
+		session->ip_addr.len +
+		session->o_ip_addr.len +
+		session->o_sess_version.len +
+		session->bw_type.len +
+		session->bw_width.len;
+	for (stream=session->streams; stream; stream=stream->next) {
+		clone_sdp_stream_size(stream, csize, tsize);
 	}
-
-	return clone_attr;
 }
 
-sdp_stream_cell_t * clone_sdp_stream_cell(sdp_stream_cell_t *stream)
+/*
+ * Clone a stream inside the block, cells taken from cp and text from tp.
+ */
+static sdp_stream_cell_t *clone_sdp_stream_flat(sdp_stream_cell_t *stream,
+		char **cp, char **tp)
 {
 	sdp_stream_cell_t *clone_stream;
-	sdp_payload_attr_t *clone_payload_attr, *payload_attr;
-	int len, i;
+	sdp_payload_attr_t *clone_attr, *attr;
 	char *p;
+	int i;
 
-	if (stream == NULL) {
-		LM_ERR("arg:NULL\n");
-		return NULL;
-	}
-
-	/* NOTE: we are not cloning RFC4975 attributes */
-	len = sizeof(sdp_stream_cell_t) +
-			stream->ip_addr.len +
-			stream->media.len +
-			stream->port.len +
-			stream->transport.len +
-			stream->sendrecv_mode.len +
-			stream->ptime.len +
-			stream->payloads.len +
-			stream->bw_type.len +
-			stream->bw_width.len +
-			stream->rtcp_port.len;
-	clone_stream = (sdp_stream_cell_t*)shm_malloc(len);
-	if (clone_stream == NULL) {
-		SHM_MEM_ERROR;
-		return NULL;
+	clone_stream = (sdp_stream_cell_t*)*cp;
+	*cp += SDP_ALIGN(sizeof(sdp_stream_cell_t));
+	if (stream->payloads_num) {
+		clone_stream->p_payload_attr = (sdp_payload_attr_t**)*cp;
+		*cp += SDP_ALIGN(stream->payloads_num * sizeof(sdp_payload_attr_t*));
 	}
-	memset( clone_stream, 0, len);
-	p = (char*)(clone_stream+1);
+	p = *tp;
 
-	payload_attr = NULL;
 	for (i=0;i<stream->payloads_num;i++) {
-		clone_payload_attr = clone_sdp_payload_attr(stream->p_payload_attr[i]);
-		if (clone_payload_attr == NULL) {
-			LM_ERR("unable to clone attributes for payload[%d]\n", i);
-			goto error;
-		}
-		clone_payload_attr->next = payload_attr;
-		payload_attr = clone_payload_attr;
+		attr = stream->p_payload_attr[i];
+		clone_attr = (sdp_payload_attr_t*)*cp;
+		*cp += SDP_ALIGN(sizeof(sdp_payload_attr_t));
+		clone_attr->payload_num = attr->payload_num;
+		SDP_CLONE_STR(clone_attr->rtp_payload, attr->rtp_payload, p);
+		SDP_CLONE_STR(clone_attr->rtp_enc, attr->rtp_enc, p);
+		SDP_CLONE_STR(clone_attr->rtp_clock, attr->rtp_clock, p);
+		SDP_CLONE_STR(clone_attr->rtp_params, attr->rtp_params, p);
+		SDP_CLONE_STR(clone_attr->fmtp_string, attr->fmtp_string, p);
+		clone_stream->p_payload_attr[i] = clone_attr;
+		clone_attr->next = clone_stream->payload_attr;
+		clone_stream->payload_attr = clone_attr;
 	}
-	clone_stream->payload_attr = payload_attr;
-
 	clone_stream->payloads_num = stream->payloads_num;
-	if (clone_stream->payloads_num) {
-		if (NULL == init_p_payload_attr(clone_stream, SDP_USE_SHM_MEM)) {
-			goto error;
-		}
-	}
 
 	clone_stream->stream_num = stream->stream_num;
 	clone_stream->pf = stream->pf;
-
-	if (stream->ip_addr.len) {
-		clone_stream->ip_addr.s = p;
-		clone_stream->ip_addr.len = stream->ip_addr.len;
-		memcpy( p, stream->ip_addr.s, stream->ip_addr.len);
-		p += stream->ip_addr.len;
-	}
-
 	clone_stream->is_rtp = stream->is_rtp;
-
-	if (stream->media.len) {
-		clone_stream->media.s = p;
-		clone_stream->media.len = stream->media.len;
-		memcpy( p, stream->media.s, stream->media.len);
-		p += stream->media.len;
-	}
-
-	if (stream->port.len) {
-		clone_stream->port.s = p;
-		clone_stream->port.len = stream->port.len;
-		memcpy( p, stream->port.s, stream->port.len);
-		p += stream->port.len;
-	}
-
-	if (stream->transport.len) {
-		clone_stream->transport.s = p;
-		clone_stream->transport.len = stream->transport.len;
-		memcpy( p, stream->transport.s, stream->transport.len);
-		p += stream->transport.len;
-	}
-
-	if (stream->sendrecv_mode.len) {
-		clone_stream->sendrecv_mode.s = p;
-		clone_stream->sendrecv_mode.len = stream->sendrecv_mode.len;
-		memcpy( p, stream->sendrecv_mode.s, stream->sendrecv_mode.len);
-		p += stream->sendrecv_mode.len;
-	}
-
-	if (stream->ptime.len) {
-		clone_stream->ptime.s = p;
-		clone_stream->ptime.len = stream->ptime.len;
-		memcpy( p, stream->ptime.s, stream->ptime.len);
-		p += stream->ptime.len;
-	}
-
-	if (stream->payloads.len) {
-		clone_stream->payloads.s = p;
-		clone_stream->payloads.len = stream->payloads.len;
-		memcpy( p, stream->payloads.s, stream->payloads.len);
-		p += stream->payloads.len;
-	}
-
-	if (stream->bw_type.len) {
-		clone_stream->bw_type.s = p;
-		clone_stream->bw_type.len = stream->bw_type.len;
-		p += stream->bw_type.len;
-	}
-
-	if (stream->bw_width.len) {
-		clone_stream->bw_width.s = p;
-		clone_stream->bw_width.len = stream->bw_width.len;
-		p += stream->bw_width.len;
-	}
-
-	if (stream->rtcp_port.len) {
-		clone_stream->rtcp_port.s = p;
-		clone_stream->rtcp_port.len = stream->rtcp_port.len;
-		memcpy( p, stream->rtcp_port.s, stream->rtcp_port.len);
-		p += stream->rtcp_port.len;
-	}
+	clone_stream->is_on_hold = stream->is_on_hold;
+
+	SDP_CLONE_STR(clone_stream->ip_addr, stream->ip_addr, p);
+	SDP_CLONE_STR(clone_stream->media, stream->media, p);
+	SDP_CLONE_STR(clone_stream->port, stream->port, p);
+	SDP_CLONE_STR(clone_stream->transport, stream->transport, p);
+	SDP_CLONE_STR(clone_stream->sendrecv_mode, stream->sendrecv_mode, p);
+	SDP_CLONE_STR(clone_stream->ptime, stream->ptime, p);
+	SDP_CLONE_STR(clone_stream->payloads, stream->payloads, p);
+	SDP_CLONE_STR(clone_stream->bw_type, stream->bw_type, p);
+	SDP_CLONE_STR(clone_stream->bw_width, stream->bw_width, p);
+	SDP_CLONE_STR(clone_stream->rtcp_port, stream->rtcp_port, p);
 
 	/* NOTE: we are not cloning RFC4975 attributes:
 	 * - path
@@ -1167,55 +1179,32 @@ sdp_stream_cell_t * clone_sdp_stream_cell(sdp_stream_cell_t *stream)
 	 * - accept_wrapped_types
 	 */
 
+	*tp = p;
 	return clone_stream;
-error:
-	free_cloned_sdp_stream(clone_stream);
-	return NULL;
 }
 
-sdp_session_cell_t * clone_sdp_session_cell(sdp_session_cell_t *session)
+/*
+ * Clone a session with its streams inside the block.
+ */
+static sdp_session_cell_t *clone_sdp_session_flat(sdp_session_cell_t *session,
+		char **cp, char **tp)
 {
 	sdp_session_cell_t *clone_session;
 	sdp_stream_cell_t *clone_stream, *prev_clone_stream, *stream;
-	int len, i;
 	char *p;
 
-	if (session == NULL) {
-		LM_ERR("arg:NULL\n");
-		return NULL;
-	}
-	len = sizeof(sdp_session_cell_t) +
-		session->cnt_disp.len +
-		session->ip_addr.len +
-		session->o_ip_addr.len +
-		session->bw_type.len +
-		session->bw_width.len;
-	clone_session = (sdp_session_cell_t*)shm_malloc(len);
-	if (clone_session == NULL) {
-		SHM_MEM_ERROR;
-		return NULL;
-	}
-	memset( clone_session, 0, len);
-	p = (char*)(clone_session+1);
-
-	if (session->streams_num) {
-		stream=session->streams;
-		clone_stream=clone_sdp_stream_cell(stream);
-		if (clone_stream==NULL) {
-			goto error;
-		}
-		clone_session->streams=clone_stream;
-		prev_clone_stream=clone_stream;
-		stream=stream->next;
-		for (i=1;i<session->streams_num;i++) {
-			clone_stream=clone_sdp_stream_cell(stream);
-			if (clone_stream==NULL) {
-				goto error;
-			}
-			prev_clone_stream->next=clone_stream;
-			prev_clone_stream=clone_stream;
-			stream=stream->next;
+	clone_session = (sdp_session_cell_t*)*cp;
+	*cp += SDP_ALIGN(sizeof(sdp_session_cell_t));
+
+	prev_clone_stream = NULL;
+	for (stream=session->streams; stream; stream=stream->next) {
+		clone_stream = clone_sdp_stream_flat(stream, cp, tp);
+		if (prev_clone_stream) {
+			prev_clone_stream->next = clone_stream;
+		} else {
+			clone_session->streams = clone_stream;
 		}
+		prev_clone_stream = clone_stream;
 	}
 
 	clone_session->session_num = session->session_num;
@@ -1223,52 +1212,49 @@ sdp_session_cell_t * clone_sdp_session_cell(sdp_session_cell_t *session)
 	clone_session->o_pf = session->o_pf;
 	clone_session->streams_num = session->streams_num;
 
-	if (session->cnt_disp.len) {
-		clone_session->cnt_disp.s = p;
-		clone_session->cnt_disp.len = session->cnt_disp.len;
-		memcpy( p, session->cnt_disp.s, session->cnt_disp.len);
-		p += session->cnt_disp.len;
-	}
+	p = *tp;
+	SDP_CLONE_STR(clone_session->cnt_disp, session->cnt_disp, p);
+	SDP_CLONE_STR(clone_session->ip_addr, session->ip_addr, p);
+	SDP_CLONE_STR(clone_session->o_ip_addr, session->o_ip_addr, p);
+	SDP_CLONE_STR(clone_session->o_sess_version, session->o_sess_version, p);
+	SDP_CLONE_STR(clone_session->bw_type, session->bw_type, p);
+	SDP_CLONE_STR(clone_session->bw_width, session->bw_width, p);
+	*tp = p;
 
-	if (session->ip_addr.len) {
-		clone_session->ip_addr.s = p;
-		clone_session->ip_addr.len = session->ip_addr.len;
-		memcpy( p, session->ip_addr.s, session->ip_addr.len);
-		p += session->ip_addr.len;
-	}
+	return clone_session;
+}
 
-	if (session->o_ip_addr.len) {
-		clone_session->o_ip_addr.s = p;
-		clone_session->o_ip_addr.len = session->o_ip_addr.len;
-		memcpy( p, session->o_ip_addr.s, session->o_ip_addr.len);
-		p += session->o_ip_addr.len;
-	}
+sdp_session_cell_t * clone_sdp_session_cell(sdp_session_cell_t *session)
+{
+	sdp_session_cell_t *clone_session;
+	int csize, tsize;
+	char *cp, *tp;
 
-	if (session->bw_type.len) {
-		clone_session->bw_type.s = p;
-		clone_session->bw_type.len = session->bw_type.len;
-		memcpy( p, session->bw_type.s, session->bw_type.len);
-		p += session->bw_type.len;
+	if (session == NULL) {
+		LM_ERR("arg:NULL\n");
+		return NULL;
 	}
-
-	if (session->bw_width.len) {
-		clone_session->bw_width.s = p;
-		clone_session->bw_width.len = session->bw_width.len;
-		memcpy( p, session->bw_width.s, session->bw_width.len);
-		p += session->bw_width.len;
+	csize = 0;
+	tsize = 0;
+	clone_sdp_session_size(session, &csize, &tsize);
+	cp = (char*)shm_malloc(csize + tsize);
+	if (cp == NULL) {
+		SHM_MEM_ERROR;
+		return NULL;
 	}
+	memset(cp, 0, csize + tsize);
+	tp = cp + csize;
+	clone_session = clone_sdp_session_flat(session, &cp, &tp);
 
 	return clone_session;
-error:
-	free_cloned_sdp_session(clone_session);
-	return NULL;
 }
 
 sdp_info_t * clone_sdp_info(struct sip_msg* _m)
 {
 	sdp_info_t *clone_sdp_info, *sdp_info=(sdp_info_t*)_m->body;
 	sdp_session_cell_t *clone_session, *prev_clone_session, *session;
-	int i, len;
+	int csize, tsize;
+	char *cp, *tp;
 
 	if (sdp_info==NULL) {
 		LM_ERR("no sdp to clone\n");
@@ -1283,41 +1269,35 @@ sdp_info_t * clone_sdp_info(struct sip_msg* _m)
 		return NULL;
 	}
 
-	len = sizeof(sdp_info_t);
-	clone_sdp_info = (sdp_info_t*)shm_malloc(len);
-	if (clone_sdp_info == NULL) {
+	csize = SDP_ALIGN(sizeof(sdp_info_t));
+	tsize = 0;
+	for (session=sdp_info->sessions; session; session=session->next) {
+		clone_sdp_session_size(session, &csize, &tsize);
+	}
+	cp = (char*)shm_malloc(csize + tsize);
+	if (cp == NULL) {
 		SHM_MEM_ERROR;
 		return NULL;
 	}
+	memset(cp, 0, csize + tsize);
+	tp = cp + csize;
+	clone_sdp_info = (sdp_info_t*)cp;
+	cp += SDP_ALIGN(sizeof(sdp_info_t));
 	LM_DBG("clone_sdp_info: %p\n", clone_sdp_info);
-	memset( clone_sdp_info, 0, len);
 	LM_DBG("we have %d sessions\n", sdp_info->sessions_num);
 	clone_sdp_info->sessions_num = sdp_info->sessions_num;
 	clone_sdp_info->streams_num = sdp_info->streams_num;
 
-	session=sdp_info->sessions;
-	clone_session=clone_sdp_session_cell(session);
-	if (clone_session==NULL) {
-		goto error;
-	}
-	clone_sdp_info->sessions=clone_session;
-	prev_clone_session=clone_session;
-	session=session->next;
-	for (i=1;i<sdp_info->sessions_num;i++) {
-		clone_session=clone_sdp_session_cell(session);
-		if (clone_session==NULL) {
-			goto error;
+	prev_clone_session = NULL;
+	for (session=sdp_info->sessions; session; session=session->next) {
+		clone_session = clone_sdp_session_flat(session, &cp, &tp);
+		if (prev_clone_session) {
+			prev_clone_session->next = clone_session;
+		} else {
+			clone_sdp_info->sessions = clone_session;
 		}
-		prev_clone_session->next=clone_session;
-		prev_clone_session=clone_session;
-		session=session->next;
+		prev_clone_session = clone_session;
 	}
 
 	return clone_sdp_info;
-error:
-	free_cloned_sdp(clone_sdp_info);
-	return NULL;
 }
-
-#undef SDP_USE_PKG_MEM
-#undef SDP_USE_SHM_MEM
@@ -125,6 +125,7 @@ typedef struct sdp_info {
 	int streams_num;  /**< total number of streams for all SDP sessions */
 	str raw_sdp;      /* Pointer to the Raw SDP (Might be embedded in multipart body) */
 	struct sdp_session_cell *sessions;
+	void *arena;      /**< pkg memory chunks holding the parsed cells */
 } sdp_info_t;
 
 
@@ -33,6 +33,7 @@
 #include "../parser_f.h"
 #include "../parse_hname2.h"
 #include "sdp.h"
+#include "sdp_helpr_funcs.h"
 
 
 static struct {
@@ -252,36 +253,10 @@ int extract_fmtp( str *body, str *fmtp_payload, str *fmtp_string )
 }
 
 
-/**
- * Allocate a new ice attribute
- */
-static inline sdp_ice_attr_t *add_sdp_ice(sdp_stream_cell_t* _stream)
-{
-	sdp_ice_attr_t *ice_attr;
-	int len;
-
-	len = sizeof(sdp_ice_attr_t);
-	ice_attr = (sdp_ice_attr_t *)pkg_malloc(len);
-	if (ice_attr == NULL) {
-	    PKG_MEM_ERROR;
-	    return NULL;
-	}
-	memset( ice_attr, 0, len);
-
-	/* Insert the new ice attribute */
-	ice_attr->next = _stream->ice_attr;
-	_stream->ice_attr = ice_attr;
-	_stream->ice_attrs_num++;
-
-	return ice_attr;
-}
-
-
-int extract_candidate(str *body, sdp_stream_cell_t *stream)
+int extract_candidate(str *body, sdp_ice_attr_t *ice_attr)
 {
     char *space, *start;
     int len, fl;
-    sdp_ice_attr_t *ice_attr;
 
     if ((body->len < 12) || (strncasecmp(body->s, "a=candidate:", 12) != 0)) {
 	/*LM_DBG("We are not pointing to an a=candidate: attribute =>`%.*s'\n", body->len, body->s); */
@@ -307,11 +282,7 @@ int extract_candidate(str *body, sdp_stream_cell_t *stream)
 	return -1;
     }
 
-    ice_attr = add_sdp_ice(stream);
-    if (ice_attr == NULL) {
-	LM_ERR("failed to add ice attribute\n");
-	return -1;
-    }
+    memset(ice_attr, 0, sizeof(sdp_ice_attr_t));
 
     /* currently only foundation and component-id are parsed */
     /* if needed, parse more */
@@ -408,13 +379,7 @@ int extract_bwidth(str *body, str *bwtype, str *bwwitdth)
 	char *cp, *cp1;
 	int len;
 
-	cp1 = NULL;
-	for (cp = body->s; (len = body->s + body->len - cp) > 0;) {
-		cp1 = (char*)ser_memmem(cp, "b=", len, 2);
-		if (cp1 == NULL || cp1[-1] == '\n' || cp1[-1] == '\r')
-			break;
-		cp = cp1 + 2;
-	}
+	cp1 = find_sdp_line(body->s, body->s + body->len, 'b');
 	if (cp1 == NULL)
 		return -1;
 
@@ -444,13 +409,7 @@ int extract_mediaip(str *body, str *mediaip, int *pf, char *line)
 	char *cp, *cp1;
 	int len;
 
-	cp1 = NULL;
-	for (cp = body->s; (len = body->s + body->len - cp) > 0;) {
-		cp1 = (char*)ser_memmem(cp, line, len, 2);
-		if (cp1 == NULL || cp1[-1] == '\n' || cp1[-1] == '\r')
-			break;
-		cp = cp1 + 2;
-	}
+	cp1 = find_sdp_line(body->s, body->s + body->len, line[0]);
 	if (cp1 == NULL)
 		return -1;
 
@@ -508,15 +467,9 @@ int extract_mediaip(str *body, str *mediaip, int *pf, char *line)
 int extract_media_attr(str *body, str *mediamedia, str *mediaport, str *mediatransport, str *mediapayload, int *is_rtp)
 {
 	char *cp, *cp1;
-	int len, i;
-
-	cp1 = NULL;
-	for (cp = body->s; (len = body->s + body->len - cp) > 0;) {
-		cp1 = (char*)ser_memmem(cp, "m=", len, 2);
-		if (cp1 == NULL || cp1[-1] == '\n' || cp1[-1] == '\r')
-			break;
-		cp = cp1 + 2;
-	}
+	int i;
+
+	cp1 = find_sdp_line(body->s, body->s + body->len, 'm');
 	if (cp1 == NULL) {
 		LM_ERR("no `m=' in SDP\n");
 		return -1;
@@ -666,32 +619,18 @@ int extract_sess_version(str* oline, str* sess_version) {
 
 char *find_sdp_line(char* p, char* plimit, char linechar)
 {
-	static char linehead[3] = "x=";
-	char *cp, *cp1;
-	linehead[0] = linechar;
-	/* Iterate through body */
-	cp = p;
-	for (;;) {
-		if (cp >= plimit)
-			return NULL;
-		cp1 = ser_memmem(cp, linehead, plimit-cp, 2);
-		if (cp1 == NULL)
-			return NULL;
-		/*
-		 * As it is body, we assume it has previous line and we can
-		 * lookup previous character.
-		 */
-		if (cp1[-1] == '\n' || cp1[-1] == '\r')
-			return cp1;
-		/*
-		 * Having such data, but not at line beginning.
-		 * Skip them and reiterate. ser_memmem() will find next
-		 * occurence.
-		 */
-		if (plimit - cp1 < 2)
-			return NULL;
-		cp = cp1 + 2;
+	char *cp;
+
+	/*
+	 * Walk the line ends, without matching the line type inside the lines.
+	 * As it is body, we assume it has previous line and we can
+	 * lookup previous character.
+	 */
+	for (cp = p - 1; cp + 2 < plimit; cp++) {
+		if ((*cp == '\n' || *cp == '\r') && cp[1] == linechar && cp[2] == '=')
+			return cp + 1;
 	}
+	return NULL;
 }
 
 
@@ -36,9 +36,12 @@
 #include "cfg_core.h"
 #endif
 #include "daemonize.h"
+#include "counters.h"
+#include "udp_server.h"
 
 #include <stdio.h>
 #include <time.h> /* time(), used to initialize random numbers */
+#include <sys/time.h>
 
 #define FORK_DONT_WAIT  /* child doesn't wait for parent before starting
 						 * => faster startup, but the child should not assume
@@ -122,6 +125,7 @@ int init_pt(int proc_no)
 	pt[process_no].rank=PROC_MAIN;
 	memcpy(pt[process_no].desc,"main",5);
 	*process_count=1;
+	proc_load_start();
 	return 0;
 }
 
@@ -333,6 +337,7 @@ int fork_process(int child_id, char *desc, int make_sock)
 				unix_tcp_sock=sockfd[1];
 			}
 		#endif
+		proc_load_start();
 		if (child_id!=PROC_NOCHLDINIT) {
 			if(init_child(child_id) < 0) {
 				LM_ERR("init_child failed for process %d, pid %d, \"%s\"\n",
@@ -476,6 +481,7 @@ int fork_tcp_process(int child_id, char *desc, int r, int *reader_fd_1)
 		unix_tcp_sock=sockfd[1];
 		close(reader_fd[0]);
 		if (reader_fd_1) *reader_fd_1=reader_fd[1];
+		proc_load_start();
 		if (child_id!=PROC_NOCHLDINIT) {
 			if (init_child(child_id) < 0) {
 				LM_ERR("init_child failed for process %d, pid %d, \"%s\"\n",
@@ -611,3 +617,176 @@ int sr_instance_ready(void)
 	_sr_instance_ready = 1;
 	return 1;
 }
+
+
+/**
+ * start the load accounting for current process
+ */
+void proc_load_start(void)
+{
+	struct timeval tv;
+
+	if(pt==NULL)
+		return;
+	gettimeofday(&tv, NULL);
+	memset(&pt[process_no].load, 0, sizeof(proc_load_t));
+	pt[process_no].load.stime_us = (unsigned long long)tv.tv_sec * 1000000
+			+ tv.tv_usec;
+	pt[process_no].load.wsec = (unsigned int)tv.tv_sec;
+}
+
+/**
+ * account a processed message - tvb and tve are the start and end times
+ */
+void proc_load_update(struct timeval *tvb, struct timeval *tve)
+{
+	proc_load_t *pl;
+	long long d;
+
+	if(pt==NULL)
+		return;
+	pl = &pt[process_no].load;
+	d = (long long)(tve->tv_sec - tvb->tv_sec) * 1000000
+			+ (tve->tv_usec - tvb->tv_usec);
+	if(d < 0)
+		d = 0;
+	if(pl->wsec != (unsigned int)tve->tv_sec) {
+		if(pl->wsec + 1 == (unsigned int)tve->tv_sec) {
+			pl->pmsgs = pl->wmsgs;
+			pl->pbusy_us = pl->wbusy_us;
+		} else {
+			pl->pmsgs = 0;
+			pl->pbusy_us = 0;
+		}
+		pl->wsec = (unsigned int)tve->tv_sec;
+		pl->wmsgs = 0;
+		pl->wbusy_us = 0;
+	}
+	pl->msgs++;
+	pl->busy_us += d;
+	pl->wmsgs++;
+	pl->wbusy_us += d;
+}
+
+/**
+ * compute the load values of the process at index idx in process table
+ * - the values are read without locking, being updated only by the owner
+ * @return 0 on success, -1 on error
+ */
+int proc_load_get(int idx, proc_load_info_t *li)
+{
+	proc_load_t pl;
+	struct timeval tv;
+	unsigned long long now;
+	unsigned long long up;
+
+	if(pt==NULL || idx<0 || idx>=*process_count)
+		return -1;
+	memcpy(&pl, &pt[idx].load, sizeof(proc_load_t));
+	memset(li, 0, sizeof(proc_load_info_t));
+	gettimeofday(&tv, NULL);
+	now = (unsigned long long)tv.tv_sec * 1000000 + tv.tv_usec;
+	li->msgs = pl.msgs;
+	li->busy_us = pl.busy_us;
+	if(pl.stime_us==0 || now<=pl.stime_us)
+		return 0;
+	up = now - pl.stime_us;
+	li->idle_us = (up > pl.busy_us) ? (up - pl.busy_us) : 0;
+	li->load = (unsigned int)((pl.busy_us * 100) / up);
+	/* last complete one second window */
+	if(pl.wsec == (unsigned int)tv.tv_sec) {
+		li->lmsgs = pl.pmsgs;
+		li->lload = pl.pbusy_us / 10000;
+	} else if(pl.wsec + 1 == (unsigned int)tv.tv_sec) {
+		li->lmsgs = pl.wmsgs;
+		li->lload = pl.wbusy_us / 10000;
+	}
+	if(li->load > 100)
+		li->load = 100;
+	if(li->lload > 100)
+		li->lload = 100;
+	return 0;
+}
+
+enum proc_load_stat {
+	PROC_LOAD_MPS = 0,
+	PROC_LOAD_BUSY_AVG,
+	PROC_LOAD_BUSY_MAX,
+	PROC_LOAD_UDP_RXQ,
+	PROC_LOAD_UDP_DROPS
+};
+
+/**
+ * callback for the load counters
+ */
+static counter_val_t proc_load_cnt(counter_handle_t h, void *what)
+{
+	proc_load_info_t li;
+	struct socket_info *si;
+	unsigned int rxq, rcvbuf, drops;
+	counter_val_t v;
+	int w;
+	int i, n;
+
+	w = (int)(long)what;
+	v = 0;
+	n = 0;
+	switch(w) {
+		case PROC_LOAD_UDP_RXQ:
+		case PROC_LOAD_UDP_DROPS:
+			for(si = udp_listen; si; si = si->next) {
+				if(si->socket < 0
+						|| udp_rcv_queue_info(si->socket, &rxq, &rcvbuf,
+								&drops) < 0)
+					continue;
+				v += (w == PROC_LOAD_UDP_RXQ) ? rxq : drops;
+			}
+			return v;
+		default:
+			if(pt==NULL || process_count==NULL)
+				return 0;
+			for(i = 0; i < *process_count; i++) {
+				/* only the sip workers */
+				if(w != PROC_LOAD_MPS && pt[i].rank <= 0)
+					continue;
+				if(proc_load_get(i, &li) < 0)
+					continue;
+				if(w == PROC_LOAD_MPS) {
+					v += li.lmsgs;
+				} else if(w == PROC_LOAD_BUSY_MAX) {
+					if(li.lload > v)
+						v = li.lload;
+				} else {
+					v += li.lload;
+					n++;
+				}
+			}
+			if(w == PROC_LOAD_BUSY_AVG && n > 0)
+				v /= n;
+			return v;
+	}
+}
+
+static counter_def_t proc_load_cnt_defs[] = {
+	{0, "msgs_per_sec", 0, proc_load_cnt, (void*)(long)PROC_LOAD_MPS,
+		"number of messages processed by all processes in the last second."},
+	{0, "busy_pct", 0, proc_load_cnt, (void*)(long)PROC_LOAD_BUSY_AVG,
+		"average busy percent of the sip workers in the last second."},
+	{0, "busy_pct_max", 0, proc_load_cnt, (void*)(long)PROC_LOAD_BUSY_MAX,
+		"busy percent of the most loaded sip worker in the last second."},
+	{0, "udp_rxq_bytes", 0, proc_load_cnt, (void*)(long)PROC_LOAD_UDP_RXQ,
+		"sum of the kernel receive queues of the udp sockets."},
+	{0, "udp_drops", 0, proc_load_cnt, (void*)(long)PROC_LOAD_UDP_DROPS,
+		"datagrams dropped by the kernel on the udp sockets."},
+	{0, 0, 0, 0, 0, 0 }
+};
+
+/**
+ * register the load counters - must be called before forking
+ */
+int proc_load_init_stats(void)
+{
+	if (counter_register_array("load", proc_load_cnt_defs) < 0)
+		return -1;
+	return 0;
+}
@@ -26,6 +26,7 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <stdlib.h>
+#include <sys/time.h>
 
 #include "globals.h"
 #include "timer.h"
@@ -34,6 +35,30 @@
 
 #define MAX_PT_DESC			128
 
+/* per process load accounting, written only by the owner process
+ * (see receive_msg()) - the current and previous one second windows
+ * give the recent load without a timer */
+typedef struct proc_load {
+	unsigned long long stime_us;  /* accounting start time */
+	unsigned long long busy_us;   /* time spent processing messages */
+	unsigned long long msgs;      /* number of processed messages */
+	unsigned int wsec;            /* second of the current window */
+	unsigned int wmsgs;           /* messages in the current window */
+	unsigned int wbusy_us;        /* busy time in the current window */
+	unsigned int pmsgs;           /* messages in the previous window */
+	unsigned int pbusy_us;        /* busy time in the previous window */
+} proc_load_t;
+
+/* load values computed from proc_load_t (see proc_load_get()) */
+typedef struct proc_load_info {
+	unsigned long long msgs;
+	unsigned long long busy_us;
+	unsigned long long idle_us;
+	unsigned int load;            /* busy percent since start */
+	unsigned int lmsgs;           /* messages in the last second */
+	unsigned int lload;           /* busy percent in the last second */
+} proc_load_info_t;
+
 struct process_table {
 	int pid;
 #ifdef USE_TCP
@@ -43,6 +68,7 @@ struct process_table {
 	int status;     /* set to 1 when child init is done */
 	int rank;       /* rank of process */
 	char desc[MAX_PT_DESC];
+	proc_load_t load;
 };
 
 extern struct process_table *pt;
@@ -102,4 +128,9 @@ int sr_instance_started(void);
 
 int sr_instance_ready(void);
 
+int proc_load_init_stats(void);
+void proc_load_start(void);
+void proc_load_update(struct timeval *tvb, struct timeval *tve);
+int proc_load_get(int idx, proc_load_info_t *li);
+
 #endif
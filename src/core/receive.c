@@ -54,6 +54,7 @@
 #include "cfg/cfg.h"
 #include "core_stats.h"
 #include "kemi.h"
+#include "pt.h"
 
 #ifdef DEBUG_DMALLOC
 #include <mem/dmalloc.h>
@@ -284,11 +285,10 @@ int ksr_evrt_pre_routing(sip_msg_t *msg)
 	return 0;
 }
 
-/** Receive message
- *  WARNING: buf must be 0 terminated (buf[len]=0) or some things might
- * break (e.g.: modules/textops)
+/** parse and route a received message (see receive_msg())
  */
-int receive_msg(char *buf, unsigned int len, receive_info_t *rcv_info)
+static int receive_msg_run(char *buf, unsigned int len,
+		receive_info_t *rcv_info)
 {
 	struct sip_msg *msg = NULL;
 	struct run_act_ctx ctx;
@@ -631,6 +631,23 @@ error00:
 	return -1;
 }
 
+/** Receive message
+ *  WARNING: buf must be 0 terminated (buf[len]=0) or some things might
+ * break (e.g.: modules/textops)
+ */
+int receive_msg(char *buf, unsigned int len, receive_info_t *rcv_info)
+{
+	struct timeval tvb, tve;
+	int ret;
+
+	/* busy time accounting for the process load stats */
+	gettimeofday(&tvb, NULL);
+	ret = receive_msg_run(buf, len, rcv_info);
+	gettimeofday(&tve, NULL);
+	proc_load_update(&tvb, &tve);
+	return ret;
+}
+
 /**
  * clean up msg environment, such as avp, xavp and xavu lists
  */
@@ -40,7 +40,8 @@ enum rpc_flags {
 };
 
 typedef enum rpc_capabilities {
-	RPC_DELAYED_REPLY = (1 <<0)  /* delayed reply support */
+	RPC_DELAYED_REPLY = (1 <<0), /* delayed reply support */
+	RPC_STREAM_REPLY = (1 <<1)   /* streamed reply support (flush) */
 } rpc_capabilities_t;
 
 struct rpc_delayed_ctx;
@@ -56,6 +57,7 @@ typedef int (*rpc_struct_add_f)(void* ctx, char* fmt, ...);                /*!<
 typedef int (*rpc_array_add_f)(void* ctx, char* fmt, ...);                 /*!< Add values in an array */
 typedef int (*rpc_struct_scan_f)(void* ctx, char* fmt, ...);               /*!< Scan attributes of a structure */
 typedef int (*rpc_struct_printf_f)(void* ctx, char* name, char* fmt, ...); /*!< Struct version of rpc_printf */
+typedef int (*rpc_flush_f)(void* ctx);                                     /*!< Send the result built so far (streamed reply) */
 
 /* returns the supported capabilities */
 typedef rpc_capabilities_t (*rpc_capabilities_f)(void* ctx);
@@ -82,8 +84,29 @@ typedef struct rpc {
 	rpc_capabilities_f capabilities;
 	rpc_delayed_ctx_new_f delayed_ctx_new;
 	rpc_delayed_ctx_close_f delayed_ctx_close;
+	rpc_flush_f flush;
 } rpc_t;
 
+/*! number of records a dump command adds between two stream flushes */
+#define RPC_STREAM_BATCH 64
+
+/**
+ * Send to the client the part of the result added so far, when the
+ * transport supports streamed replies (RPC_STREAM_REPLY capability).
+ * Meant for commands printing large data sets, to be called between
+ * records and outside of any lock. After it, new values can be added
+ * only to the structures and arrays added last (or to their parents),
+ * all other handles obtained before are no longer valid.
+ * Return 0 on success or when streaming is not supported, <0 on error.
+ */
+static inline int rpc_stream_flush(rpc_t* rpc, void* ctx)
+{
+	if(rpc->flush==0) {
+		return 0;
+	}
+	return rpc->flush(ctx);
+}
+
 
 typedef struct rpc_delayed_ctx{
 	rpc_t rpc;
@@ -53,6 +53,7 @@
 #include "mem/mem.h"
 #include "ut.h"
 #include "resolve.h"
+#include "hashes.h"
 #include "name_alias.h"
 
 
@@ -603,6 +604,218 @@ found:
 }
 
 
+/* hash index over the names and addresses of the listen sockets, used by
+ * grep_sock_info() instead of walking all the lists and comparing each
+ * name, advertised name and extra address (built by ksr_sock_info_index_build()
+ * once the listen sockets are fixed, dropped on any list change) */
+typedef struct si_index_item {
+	str name;                    /* host name or address string */
+	struct ip_addr* ip6;         /* ipv6 address (name is empty) */
+	struct socket_info* si;
+	struct socket_info** list;   /* list of the socket */
+	unsigned int seq;            /* position in the grep_sock_info() walk */
+	struct si_index_item* next;
+} si_index_item_t;
+
+static si_index_item_t** _ksr_si_index = NULL;
+static unsigned int _ksr_si_index_size = 0;
+
+static void ksr_sock_info_index_reset(void)
+{
+	if(_ksr_si_index!=NULL) {
+		pkg_free(_ksr_si_index);
+		_ksr_si_index = NULL;
+		_ksr_si_index_size = 0;
+	}
+}
+
+/* adds a name key (item=NULL only counts it) */
+static void si_index_add_name(si_index_item_t** item, str* name,
+		struct socket_info* si, struct socket_info** list, unsigned int seq,
+		int* n)
+{
+	si_index_item_t** it;
+	unsigned int h;
+
+	if(name->s==NULL || name->len<=0) {
+		return;
+	}
+	if(item!=NULL) {
+		(*item)->name = *name;
+		(*item)->ip6 = NULL;
+		(*item)->si = si;
+		(*item)->list = list;
+		(*item)->seq = seq;
+		(*item)->next = NULL;
+		h = get_hash1_case_raw(name->s, name->len) & (_ksr_si_index_size-1);
+		/* keep the walk order inside the slot */
+		for(it=&_ksr_si_index[h]; *it; it=&(*it)->next);
+		*it = *item;
+		(*item)++;
+	}
+	(*n)++;
+}
+
+/* adds an ipv6 address key (item=NULL only counts it) */
+static void si_index_add_ip6(si_index_item_t** item, struct ip_addr* ip,
+		struct socket_info* si, struct socket_info** list, unsigned int seq,
+		int* n)
+{
+	si_index_item_t** it;
+	unsigned int h;
+
+	if(ip->af!=AF_INET6) {
+		return;
+	}
+	if(item!=NULL) {
+		(*item)->name.s = NULL;
+		(*item)->name.len = 0;
+		(*item)->ip6 = ip;
+		(*item)->si = si;
+		(*item)->list = list;
+		(*item)->seq = seq;
+		(*item)->next = NULL;
+		h = get_hash1_raw((char*)ip->u.addr, ip->len)
+				& (_ksr_si_index_size-1);
+		for(it=&_ksr_si_index[h]; *it; it=&(*it)->next);
+		*it = *item;
+		(*item)++;
+	}
+	(*n)++;
+}
+
+/* walks the sockets in the grep_sock_info() order and adds the keys
+ * compared by si_hname_cmp() for each of them */
+static int si_index_fill(si_index_item_t** item)
+{
+	struct socket_info* si;
+	struct socket_info** list;
+	struct addr_info* ai;
+	unsigned short c_proto;
+	unsigned int seq;
+	int n;
+
+	n = 0;
+	seq = 0;
+	c_proto = PROTO_UDP;
+	do {
+		list = get_sock_info_list(c_proto);
+		if(list==0) {
+			continue;
+		}
+		for(si=*list; si; si=si->next) {
+			seq++;
+			si_index_add_name(item, &si->name, si, list, seq, &n);
+			si_index_add_ip6(item, &si->address, si, list, seq, &n);
+			if(!(si->flags&SI_IS_IP)) {
+				si_index_add_name(item, &si->address_str, si, list, seq, &n);
+			}
+			if(si->useinfo.name.s!=NULL) {
+				si_index_add_name(item, &si->useinfo.name, si, list, seq, &n);
+				si_index_add_ip6(item, &si->useinfo.address, si, list, seq,
+						&n);
+				if(!(si->flags&SI_IS_IP)) {
+					si_index_add_name(item, &si->useinfo.address_str, si, list,
+							seq, &n);
+				}
+			}
+			for(ai=si->addr_info_lst; ai; ai=ai->next) {
+				si_index_add_name(item, &ai->name, si, list, seq, &n);
+				si_index_add_ip6(item, &ai->address, si, list, seq, &n);
+				if(!(ai->flags&SI_IS_IP)) {
+					si_index_add_name(item, &ai->address_str, si, list, seq,
+							&n);
+				}
+			}
+		}
+	} while((c_proto=next_proto(c_proto)));
+	return n;
+}
+
+/* builds the hash index of the listen sockets
+ * returns 0 on success, -1 on error */
+int ksr_sock_info_index_build(void)
+{
+	si_index_item_t* item;
+	unsigned int size;
+	int n;
+
+	ksr_sock_info_index_reset();
+	n = si_index_fill(NULL);
+	for(size=16; size<2*n; size<<=1);
+	_ksr_si_index = (si_index_item_t**)pkg_malloc(
+			size*sizeof(si_index_item_t*) + n*sizeof(si_index_item_t));
+	if(_ksr_si_index==NULL) {
+		PKG_MEM_ERROR;
+		return -1;
+	}
+	memset(_ksr_si_index, 0, size*sizeof(si_index_item_t*));
+	_ksr_si_index_size = size;
+	item = (si_index_item_t*)(_ksr_si_index + size);
+	si_index_fill(&item);
+	LM_DBG("indexed %d socket keys in %u slots\n", n, size);
+	return 0;
+}
+
+/* port and proto matching of grep_sock_info() for an index item */
+static inline int si_index_match(si_index_item_t* it, unsigned short port,
+		unsigned short proto)
+{
+	if(port && it->si->port_no!=port && it->si->useinfo.port_no!=port) {
+		return 0;
+	}
+	if(proto==PROTO_NONE) {
+		return 1;
+	}
+	if(it->list==get_sock_info_list(proto)) {
+		return 1;
+	}
+#ifdef USE_TLS
+	if(proto==PROTO_WS && it->list==&tls_listen) {
+		return 1;
+	}
+#endif
+	return 0;
+}
+
+/* grep_sock_info() over the hash index, hname without [] */
+static struct socket_info* si_index_lookup(str* hname, unsigned short port,
+		unsigned short proto)
+{
+	si_index_item_t* it;
+	si_index_item_t* found;
+	struct ip_addr* ip6;
+	unsigned int h;
+
+	found = NULL;
+	h = get_hash1_case_raw(hname->s, hname->len) & (_ksr_si_index_size-1);
+	for(it=_ksr_si_index[h]; it; it=it->next) {
+		if(it->ip6==NULL && it->name.len==hname->len
+				&& strncasecmp(it->name.s, hname->s, hname->len)==0
+				&& si_index_match(it, port, proto)) {
+			found = it;
+			break;
+		}
+	}
+	ip6 = str2ip6(hname);
+	if(ip6) {
+		h = get_hash1_raw((char*)ip6->u.addr, ip6->len)
+				& (_ksr_si_index_size-1);
+		for(it=_ksr_si_index[h]; it; it=it->next) {
+			if(found && it->seq>=found->seq) {
+				break;
+			}
+			if(it->ip6!=NULL && ip_addr_cmp(ip6, it->ip6)
+					&& si_index_match(it, port, proto)) {
+				found = it;
+				break;
+			}
+		}
+	}
+	return (found)?found->si:NULL;
+}
+
+
 /* checks if the proto: host:port is one of the address we listen on
  * and returns the corresponding socket_info structure.
  * if port==0, the  port number is ignored
@@ -627,6 +840,10 @@ struct socket_info* grep_sock_info(str* host, unsigned short port,
 		hname.len-=2;
 	}
 
+	if (likely(_ksr_si_index!=NULL)) {
+		return si_index_lookup(&hname, port, proto);
+	}
+
 	c_proto=(proto!=PROTO_NONE)?proto:PROTO_UDP;
 retry:
 	do {
@@ -824,6 +1041,8 @@ static struct socket_info* new_sock2list(char* name, struct name_lst* addr_l,
 									struct socket_info** list)
 {
 	struct socket_info* si;
+
+	ksr_sock_info_index_reset();
 	/* allocates si and si->name in new pkg memory */
 	si=new_sock_info(name, addr_l, port, proto, usename, useport, sockname, flags);
 	if (si==0){
@@ -870,6 +1089,7 @@ static struct socket_info* new_sock2list_after(char* name,
 {
 	struct socket_info* si;
 
+	ksr_sock_info_index_reset();
 	si=new_sock_info(name, addr_l, port, proto, usename, useport, sockname, flags);
 	if (si==0){
 		LM_ERR("new_sock_info failed\n");
@@ -1583,6 +1803,7 @@ static int fix_socket_list(struct socket_info **list, int* type_flags)
 	struct addr_info* tmp_ail_next;
 	struct addr_info* ail_next;
 
+	ksr_sock_info_index_reset();
 	if (type_flags)
 		*type_flags=0;
 	/* try to change all the interface names into addresses
@@ -94,6 +94,7 @@ int add_listen_advertise_iface_name(char* name, struct name_lst* nlst,
 						char *useaddr, unsigned short useport, char *sockname,
 						enum si_flags flags);
 int fix_all_socket_lists(void);
+int ksr_sock_info_index_build(void);
 void print_all_socket_lists(void);
 void print_aliases(void);
 
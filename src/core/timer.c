@@ -47,6 +47,7 @@
 #include "locking.h"
 #include "sched_yield.h"
 #include "cfg/cfg_struct.h"
+#include "counters.h"
 
 
 /* how often will the timer handler be called (in ticks) */
@@ -71,6 +72,12 @@ static volatile int run_timer=0;
 static int timer_id=0;
 
 static gen_lock_t* timer_lock=0;
+
+/* delay between the expire time and the run of the timer handlers (ms) */
+static counter_handle_t timer_lag_hist;
+#define TIMER_LAG_ADD(t, tl) \
+	counter_hist_add(timer_lag_hist, \
+			TICKS_GT((t), (tl)->expire)?TICKS_TO_MS((t)-(tl)->expire):0)
 static struct timer_ln* volatile* running_timer=0;/* running timer handler */
 static int in_timer=0;
 
@@ -193,6 +200,10 @@ int init_timer()
 
 	ret=-1;
 
+	if (counter_register_hist(&timer_lag_hist, "load", "timer_lag_ms", 0,
+				"delay of the timer handlers from the expire time"
+				" (milliseconds)", 0) < 0)
+		goto error;
 	/* init the locks */
 	timer_lock=lock_alloc();
 	if (timer_lock==0){
@@ -853,6 +864,7 @@ inline static void timer_list_expire(ticks_t t, struct timer_head* h
 #ifdef TIMER_DEBUG
 			tl->expires_no++;
 #endif
+			TIMER_LAG_ADD(t, tl);
 			UNLOCK_TIMER_LIST(); /* acts also as write barrier */
 				ret=tl->f(t, tl, tl->data);
 				/* reset the configuration group handles */
@@ -1100,6 +1112,7 @@ void slow_timer_main()
 				tl->expires_no++;
 #endif
 				SET_RUNNING_SLOW(tl);
+				TIMER_LAG_ADD(*ticks, tl);
 				UNLOCK_SLOW_TIMER_LIST();
 					if(likely(tl->f)) {
 						ret=tl->f(*ticks, tl, tl->data);
@@ -59,6 +59,11 @@
 #ifdef USE_MCAST
 #include <net/if.h>
 #endif /* USE_MCAST */
+#include <sys/ioctl.h>
+#ifdef __OS_linux
+#include <linux/sockios.h>
+#include <linux/sock_diag.h>
+#endif /* __OS_linux */
 
 
 #ifdef DBG_MSG_QA
@@ -624,3 +629,48 @@ raw_again:
 #endif /* USE_RAW_SOCKS */
 	return n;
 }
+
+
+
+/**
+ * get the receive queue state of an udp socket
+ * - rxq: bytes waiting in the kernel receive queue
+ * - rcvbuf: size of the receive buffer (0 if not available)
+ * - drops: datagrams dropped by the kernel (0 if not available)
+ * On Linux with SO_MEMINFO the values include the kernel buffer overhead,
+ * being directly comparable with rcvbuf; otherwise the size of the next
+ * pending datagram is returned (SIOCINQ/FIONREAD).
+ * @return 0 on success, -1 on error
+ */
+int udp_rcv_queue_info(int fd, unsigned int *rxq, unsigned int *rcvbuf,
+		unsigned int *drops)
+{
+	int n;
+#if defined(SO_MEMINFO) && defined(__OS_linux)
+	unsigned int meminfo[SK_MEMINFO_VARS];
+	socklen_t optlen;
+
+	optlen = sizeof(meminfo);
+	memset(meminfo, 0, sizeof(meminfo));
+	if(getsockopt(fd, SOL_SOCKET, SO_MEMINFO, meminfo, &optlen) == 0) {
+		*rxq = meminfo[SK_MEMINFO_RMEM_ALLOC];
+		*rcvbuf = meminfo[SK_MEMINFO_RCVBUF];
+		*drops = (optlen > SK_MEMINFO_DROPS * sizeof(unsigned int))
+					? meminfo[SK_MEMINFO_DROPS] : 0;
+		return 0;
+	}
+#endif
+	*rcvbuf = 0;
+	*drops = 0;
+#ifdef SIOCINQ
+	if(ioctl(fd, SIOCINQ, &n) < 0)
+#else
+	if(ioctl(fd, FIONREAD, &n) < 0)
+#endif
+	{
+		*rxq = 0;
+		return -1;
+	}
+	*rxq = (unsigned int)n;
+	return 0;
+}
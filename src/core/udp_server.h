@@ -38,6 +38,8 @@
 int udp_init(struct socket_info* si);
 int udp_send(struct dest_info* dst, char *buf, unsigned len);
 int udp_rcv_loop(void);
+int udp_rcv_queue_info(int fd, unsigned int *rxq, unsigned int *rcvbuf,
+		unsigned int *drops);
 
 
 #endif
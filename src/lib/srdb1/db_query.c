@@ -38,10 +38,14 @@
 #include "db_query.h"
 #include "../../core/globals.h"
 #include "../../core/timer.h"
+#include "../../core/counters.h"
 
 static str  sql_str;
 static char *sql_buf = NULL;
 
+/* histogram of the query execution time (microseconds) */
+static counter_handle_t db_query_time_hist;
+
 static inline int db_do_submit_query(const db1_con_t* _h, const str *_query,
 		int (*submit_query)(const db1_con_t*, const str*))
 {
@@ -50,19 +54,22 @@ static inline int db_do_submit_query(const db1_con_t* _h, const str *_query,
 	struct timezone tz;
 	unsigned int tdiff;
 
-	if(unlikely(cfg_get(core, core_cfg, latency_limit_db)>0)
-			&& is_printable(cfg_get(core, core_cfg, latency_log))) {
+	if(db_query_time_hist.id
+			|| (unlikely(cfg_get(core, core_cfg, latency_limit_db)>0)
+				&& is_printable(cfg_get(core, core_cfg, latency_log)))) {
 		gettimeofday(&tvb, &tz);
 	}
 
 	ret = submit_query(_h, _query);
 
-	if(unlikely(cfg_get(core, core_cfg, latency_limit_db)>0)
-			&& is_printable(cfg_get(core, core_cfg, latency_log))) {
+	if(tvb.tv_sec != 0) {
 		gettimeofday(&tve, &tz);
 		tdiff = (tve.tv_sec - tvb.tv_sec) * 1000000
 					   + (tve.tv_usec - tvb.tv_usec);
-		if(tdiff >= cfg_get(core, core_cfg, latency_limit_db)) {
+		counter_hist_add(db_query_time_hist, tdiff);
+		if(unlikely(cfg_get(core, core_cfg, latency_limit_db)>0)
+				&& is_printable(cfg_get(core, core_cfg, latency_log))
+				&& tdiff >= cfg_get(core, core_cfg, latency_limit_db)) {
 			LOG(cfg_get(core, core_cfg, latency_log),
 					"alert - query execution too long [%u us] for [%.*s]\n",
 				   tdiff, _query->len<100?_query->len:100, _query->s);
@@ -404,6 +411,13 @@ int db_do_replace(const db1_con_t* _h, const db_key_t* _k, const db_val_t* _v,
 
 int db_query_init(void)
 {
+	if (db_query_time_hist.id == 0 && counter_register_allowed()
+			&& counter_register_hist(&db_query_time_hist, "db",
+					"query_time_us", 0,
+					"execution time of the database queries (microseconds)",
+					1) < 0) {
+		LM_WARN("failed to register the query time histogram\n");
+	}
     if (sql_buf != NULL)
     {
         LM_DBG("sql_buf not NULL on init\n");
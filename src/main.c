@@ -488,6 +488,7 @@ unsigned short tls_port_no=0; /* default port */
 #endif
 
 struct host_alias* aliases=0; /* name aliases list */
+struct host_alias* aliases_hash[HOST_ALIAS_HASH_SIZE]; /* aliases index */
 
 /* Parameter to child_init */
 int child_rank = 0;
@@ -2148,6 +2149,8 @@ int main(int argc, char** argv)
 	/* init counters / stats */
 	if (init_counters() == -1)
 		goto error;
+	if (proc_load_init_stats() == -1)
+		goto error;
 #ifdef USE_TCP
 	init_tcp_options(); /* set the defaults before the config */
 #endif
@@ -3000,6 +3003,10 @@ try_again:
 		fprintf(stderr, "ERROR: error while initializing modules\n");
 		goto error;
 	}
+	/* listen sockets are final now (modules may add some in mod_init) */
+	if (ksr_sock_info_index_build() != 0) {
+		goto error;
+	}
 	
 	/* initialize process_table, add core process no. (calc_proc_no()) to the
 	 * processes registered from the modules*/
@@ -202,6 +202,8 @@ static param_export_t params[] = {
 	{"otn_in_flight_no",       PARAM_INT,    &otn_in_flight_no      },
 	{"otn_in_flight_order",    PARAM_INT,    &otn_in_flight_k       },
 	{"nid_pool_no",            PARAM_INT,    &nid_pool_no           },
+	{"nid_pool_cpu",           PARAM_INT,    &nid_pool_cpu          },
+	{"nonce_node_id",          PARAM_INT,    &auth_node_id          },
 	{"force_stateless_reply",  PARAM_INT,    &force_stateless_reply },
 	{"realm_prefix",           PARAM_STRING, &auth_realm_prefix.s   },
 	{"use_domain",             PARAM_INT,    &auth_use_domain       },
@@ -354,6 +356,16 @@ static int mod_init(void)
 			}
 			break;
 	}
+	if (auth_node_id<0 || auth_node_id>255) {
+		LM_ERR("invalid nonce_node_id %d (valid values: 0..255)\n",
+				auth_node_id);
+		return -1;
+	}
+	if (nonce_init_counters()<0) {
+		LM_ERR("failed to register the counters\n");
+		return -1;
+	}
+
 	if (otn_enabled){
 #ifdef USE_OT_NONCE
 		if (nid_crt==0) init_nonce_id();
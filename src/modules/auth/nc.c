@@ -40,6 +40,7 @@ unsigned nc_array_size; /* 2^k == 1<<nc_array_bits (in nc_t and not
 #include <assert.h>
 
 static unsigned int* nc_array=0;
+static void* nc_array_block=0; /* nc_array before alignment, for shm_free */
 
 
 unsigned nc_partition_size; /* array partition == nc_array_size/nc_pool_no*/
@@ -124,7 +125,8 @@ int init_nonce_count()
 
 	/*  array size should be multiple of sizeof(unsigned int) since we
 	 *  access it as an uint array */
-	nc_array=shm_malloc(sizeof(nc_t)*ROUND_INT(nc_array_size));
+	nc_array=nid_shm_malloc_aligned(sizeof(nc_t)*ROUND_INT(nc_array_size),
+			&nc_array_block);
 	if (nc_array==0){
 		LM_ERR("init_nonce_count: memory allocation failure, consider"
 				" either decreasing nc_array_size of increasing the"
@@ -145,10 +147,11 @@ error:
 
 void destroy_nonce_count()
 {
-	if (nc_array){
-		shm_free(nc_array);
-		nc_array=0;
+	if (nc_array_block){
+		shm_free(nc_array_block);
+		nc_array_block=0;
 	}
+	nc_array=0;
 }
 
 /* given the nonce id i and pool/partition p, produces an index in the
@@ -29,15 +29,24 @@
  *                          compiled
  */
 
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE /* sched_getcpu() */
+#endif
+
 unsigned int nid_pool_no; /* number of index pools, 2^k */
+int nid_pool_cpu=0; /* select the pool by cpu instead of process */
 
 #if defined USE_NC || defined USE_OT_NONCE
 
+#include <stdlib.h> /* random() */
+#include <sched.h> /* sched_getcpu() */
 #include "nid.h"
 #include "../../core/dprint.h"
 #include "../../core/bit_scan.h"
+#include "../../core/mem/shm_mem.h"
 
 struct pool_index* nid_crt=0;
+static void* nid_crt_block=0;
 
 
 /* instead of storing only the 2^k size we store also k
@@ -70,7 +79,8 @@ int init_nonce_id()
 	}
 	nid_pool_no=pool_no;
 
-	nid_crt=shm_malloc(sizeof(*nid_crt)*nid_pool_no);
+	nid_crt=nid_shm_malloc_aligned(sizeof(*nid_crt)*nid_pool_no,
+			&nid_crt_block);
 	if (nid_crt==0){
 		LM_ERR("init_nonce_id: memory allocation failure\n");
 		return -1;
@@ -90,10 +100,44 @@ error:
 
 void destroy_nonce_id()
 {
-	if (nid_crt){
-		shm_free(nid_crt);
-		nid_crt=0;
+	if (nid_crt_block){
+		shm_free(nid_crt_block);
+		nid_crt_block=0;
 	}
+	nid_crt=0;
+}
+
+
+
+/* the per pool arrays are written with atomic ops from all the processes,
+ * aligning them to CACHELINE_SIZE makes sure that two pools never share
+ * a cacheline (the partitions sizes are multiples of CACHELINE_SIZE) */
+void* nid_shm_malloc_aligned(unsigned long size, void** raw)
+{
+	char* p;
+
+	p=shm_malloc(size+CACHELINE_SIZE-1);
+	*raw=p;
+	if (p==0)
+		return 0;
+	return (void*)(((unsigned long)p+CACHELINE_SIZE-1) &
+						~((unsigned long)CACHELINE_SIZE-1));
+}
+
+
+
+/* processes running on the same cpu share the same pool => the pool
+ * index and array cachelines stay local to that cpu */
+unsigned int nid_cpu_pool(void)
+{
+#ifdef __linux__
+	int cpu;
+
+	cpu=sched_getcpu();
+	if (likely(cpu>=0))
+		return (unsigned int)cpu & nid_pool_mask;
+#endif /* __linux__ */
+	return process_no & nid_pool_mask;
 }
 
 #endif  /*if  defined USE_NC || defined USE_OT_NONCE */
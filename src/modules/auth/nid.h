@@ -33,10 +33,12 @@
 #define _nid_h
 
 extern unsigned nid_pool_no; /* number of index pools */
+extern int nid_pool_cpu; /* select the pool by cpu instead of process */
 
 #if defined USE_NC || defined USE_OT_NONCE
 
 #include "../../core/atomic_ops.h"
+#include "../../core/compiler_opt.h"
 #include "../../core/pt.h" /* process_no */
 
 /* id incremenet, to avoid cacheline ping-pong and cover all the
@@ -73,13 +75,21 @@ extern unsigned int nid_pool_mask; /* mask for computing the current pool*/
 int init_nonce_id();
 void destroy_nonce_id();
 
+/* shm_malloc() a CACHELINE_SIZE aligned block; *raw is set to the pointer
+ * that has to be passed to shm_free() */
+void* nid_shm_malloc_aligned(unsigned long size, void** raw);
+
+/* pool for the cpu the current process runs on */
+unsigned int nid_cpu_pool(void);
+
 
 /* get current index in pool p */
 #define nid_get(p) \
 	atomic_get(&nid_crt[(p)].id)
 
-/* get pool for the current process */
-#define nid_get_pool()  (process_no & nid_pool_mask)
+/* get pool for the current process (or cpu, if nid_pool_cpu is set) */
+#define nid_get_pool() \
+	(unlikely(nid_pool_cpu) ? nid_cpu_pool() : (process_no & nid_pool_mask))
 
 /* inc the specified index and return its new value */
 #define nid_inc(pool) \
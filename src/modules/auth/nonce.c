@@ -54,6 +54,32 @@ int auth_checks_ind = 0;
  */
 unsigned int nonce_auth_max_drift = 3; /* in s */
 
+/* id of this node, added to the nonces (0 - disabled) */
+int auth_node_id = 0;
+
+struct nonce_counters_h nonce_cnts_h;
+
+static counter_def_t nonce_cnt_defs[] = {
+	{&nonce_cnts_h.replay, "nonce_replay", 0, 0, 0,
+		"nonces rejected because they were used before"},
+	{&nonce_cnts_h.id_overflow, "nonce_id_overflow", 0, 0, 0,
+		"nonces rejected because their pool slot was reused by newer nonces"},
+	{&nonce_cnts_h.nc_overflow, "nonce_nc_overflow", 0, 0, 0,
+		"nonces rejected because the nonce-count got too big"},
+	{&nonce_cnts_h.inv_pool, "nonce_inv_pool", 0, 0, 0,
+		"nonces rejected because of an invalid pool number"},
+	{&nonce_cnts_h.foreign, "nonce_foreign", 0, 0, 0,
+		"nonces generated by other nodes, rejected as stale"},
+	{0, 0, 0, 0, 0, 0}
+};
+
+int nonce_init_counters(void)
+{
+	if (counter_register_array("auth", nonce_cnt_defs) < 0)
+		return -1;
+	return 0;
+}
+
 /** Select extra check configuration based on request type.
  * This function determines which configuration variable for
  * extra authentication checks is to be used based on the
@@ -85,16 +111,46 @@ int get_auth_checks(struct sip_msg* msg)
 
 
 
+/* fills the second MD5 of a bin_nonce union, over the message parts
+ * selected by the auth extra checks (cfg) and secret2 */
+inline static void calc_bin_nonce_md5_2(union bin_nonce* b_nonce, int cfg,
+		str* secret2, struct sip_msg* msg)
+{
+	MD5_CTX ctx;
+	str* s;
+
+	MD5Init(&ctx);
+	if (cfg & AUTH_CHECK_FULL_URI) {
+		s = GET_RURI(msg);
+		MD5Update(&ctx, s->s, s->len);
+	}
+	if ((cfg & AUTH_CHECK_CALLID) &&
+			!(parse_headers(msg, HDR_CALLID_F, 0) < 0 || msg->callid == 0)) {
+		MD5Update(&ctx, msg->callid->body.s, msg->callid->body.len);
+	}
+	if ((cfg & AUTH_CHECK_FROMTAG) &&
+			!(parse_from_header(msg) < 0 )) {
+		MD5Update(&ctx, get_from(msg)->tag_value.s,
+				get_from(msg)->tag_value.len);
+	}
+	if (cfg & AUTH_CHECK_SRC_IP) {
+		U_MD5Update(&ctx, msg->rcv.src_ip.u.addr, msg->rcv.src_ip.len);
+	}
+	MD5Update(&ctx, secret2->s, secret2->len);
+	MD5Final(&b_nonce->n.md5_2[0], &ctx);
+}
+
 /* takes a pre-filled bin_nonce union (see BIN_NONCE_PREPARE), fills the
  * MD5s and returns the length of the binary nonce (cannot return error).
+ * If md5_2 is 0, only the first MD5 is computed, the second one can be
+ * filled later with calc_bin_nonce_md5_2() (when it is really needed).
  * See calc_nonce below for more details.*/
 inline static int calc_bin_nonce_md5(union bin_nonce* b_nonce, int cfg,
 		str* secret1, str* secret2,
-		struct sip_msg* msg)
+		struct sip_msg* msg, int md5_2)
 {
 	MD5_CTX ctx;
 
-	str* s;
 	int len;
 
 	MD5Init(&ctx);
@@ -114,25 +170,8 @@ inline static int calc_bin_nonce_md5(union bin_nonce* b_nonce, int cfg,
 		MD5Update(&ctx, secret1->s, secret1->len);
 		MD5Final(&b_nonce->n.md5_1[0], &ctx);
 		/* second MD5(auth_extra_checks) */
-		MD5Init(&ctx);
-		if (cfg & AUTH_CHECK_FULL_URI) {
-			s = GET_RURI(msg);
-			MD5Update(&ctx, s->s, s->len);
-		}
-		if ((cfg & AUTH_CHECK_CALLID) &&
-				!(parse_headers(msg, HDR_CALLID_F, 0) < 0 || msg->callid == 0)) {
-			MD5Update(&ctx, msg->callid->body.s, msg->callid->body.len);
-		}
-		if ((cfg & AUTH_CHECK_FROMTAG) &&
-				!(parse_from_header(msg) < 0 )) {
-			MD5Update(&ctx, get_from(msg)->tag_value.s,
-					get_from(msg)->tag_value.len);
-		}
-		if (cfg & AUTH_CHECK_SRC_IP) {
-			U_MD5Update(&ctx, msg->rcv.src_ip.u.addr, msg->rcv.src_ip.len);
-		}
-		MD5Update(&ctx, secret2->s, secret2->len);
-		MD5Final(&b_nonce->n.md5_2[0], &ctx);
+		if (md5_2)
+			calc_bin_nonce_md5_2(b_nonce, cfg, secret2, msg);
 	}else{
 		/* no extra checks => only one md5 */
 		len = 4 + 4 + 16;
@@ -213,7 +252,7 @@ int calc_nonce(char* nonce, int *nonce_len, int cfg, int since, int expires,
 	union bin_nonce b_nonce;
 	int len;
 	if (unlikely(*nonce_len < MAX_NONCE_LEN)) {
-		len=get_nonce_len(cfg, pf & NF_VALID_NC_ID);
+		len=get_nonce_len(cfg, pf & (NF_VALID_NC_ID | NF_VALID_OT_ID));
 		if (unlikely(*nonce_len<len)){
 			*nonce_len=len;
 			return -1;
@@ -221,7 +260,7 @@ int calc_nonce(char* nonce, int *nonce_len, int cfg, int since, int expires,
 	}
 
 	BIN_NONCE_PREPARE(&b_nonce, expires, since, n_id, pf, cfg, msg);
-	len=calc_bin_nonce_md5(&b_nonce, cfg, secret1, secret2, msg);
+	len=calc_bin_nonce_md5(&b_nonce, cfg, secret1, secret2, msg, 1);
 	*nonce_len=base64_enc(&b_nonce.raw[0], len,
 			(unsigned char*)nonce, *nonce_len);
 	assert(*nonce_len>=0); /*FIXME*/
@@ -317,6 +356,7 @@ int check_nonce(auth_body_t* auth, str* secret1, str* secret2,
 #if defined USE_NC || defined USE_OT_NONCE
 	unsigned int n_id;
 	unsigned char pf;
+	unsigned char node;
 #endif /* USE_NC || USE_OT_NONCE */
 #ifdef USE_NC
 	unsigned int nc;
@@ -338,6 +378,8 @@ int check_nonce(auth_body_t* auth, str* secret1, str* secret2,
 	 * to make sure they can be used even if the nonce is shorter */
 	b_nonce.n.nid_pf=0;
 	b_nonce.n_small.nid_pf=0;
+	b_nonce.n.nid_node=0;
+	b_nonce.n_small.nid_node=0;
 #endif /* USE_NC || USE_OT_NONCE */
 
 	/* decode nonce */
@@ -379,85 +421,114 @@ int check_nonce(auth_body_t* auth, str* secret1, str* secret2,
 	if (cfg){
 		b_nonce2.n.nid_i=b_nonce.n.nid_i;
 		b_nonce2.n.nid_pf=b_nonce.n.nid_pf;
+		b_nonce2.n.nid_node=b_nonce.n.nid_node;
 		pf=b_nonce.n.nid_pf;
 		n_id=ntohl(b_nonce.n.nid_i);
+		node=b_nonce.n.nid_node;
 	}else{
 		b_nonce2.n_small.nid_i=b_nonce.n_small.nid_i;
 		b_nonce2.n_small.nid_pf=b_nonce.n_small.nid_pf;
+		b_nonce2.n_small.nid_node=b_nonce.n_small.nid_node;
 		pf=b_nonce.n_small.nid_pf;
 		n_id=ntohl(b_nonce.n_small.nid_i);
+		node=b_nonce.n_small.nid_node;
 	}
-#ifdef UE_NC
+#ifdef USE_NC
 	if (unlikely(nc_enabled && !(pf & NF_VALID_NC_ID)) )
 		/* nounce count enabled, but nonce is not marked as nonce count ready
 		 * or is too short => either an old nonce (should
 		 * be caught by the ser start time  check) or truncated nonce  */
 		return 4; /* return stale for now */
-}
 #endif /* USE_NC */
 #ifdef USE_OT_NONCE
-if (unlikely(otn_enabled && !(pf & NF_VALID_OT_ID))){
-	/* same as above for one-time-nonce */
-	return 4; /* return stale for now */
-}
+	if (unlikely(otn_enabled && !(pf & NF_VALID_OT_ID))){
+		/* same as above for one-time-nonce */
+		return 4; /* return stale for now */
+	}
 #endif  /* USE_OT_NONCE */
-/* don't check if we got the expected length, if the length is smaller
- * then expected then  the md5 check below will fail (since the nid
- * members of the bin_nonce struct will be 0); if the length is bigger
- * and it was not caught by the base64_dec above, and the md5 matches,
- * we ignore the extra stuff */
+	/* don't check if we got the expected length, if the length is smaller
+	 * then expected then  the md5 check below will fail (since the nid
+	 * members of the bin_nonce struct will be 0); if the length is bigger
+	 * and it was not caught by the base64_dec above, and the md5 matches,
+	 * we ignore the extra stuff */
 #endif /* USE_NC || USE_OT_NONCE */
-b_nonce2_len=calc_bin_nonce_md5(&b_nonce2, cfg, secret1, secret2, msg);
-if (!memcmp(&b_nonce.n.md5_1[0], &b_nonce2.n.md5_1[0], 16)) {
-#ifdef USE_NC
-	/* if nounce-count checks enabled & auth. headers has nc */
-	if (nc_enabled && (pf & NF_VALID_NC_ID) && auth->digest.nc.s &&
-			auth->digest.nc.len){
-		if ((auth->digest.nc.len != 8) ||
-				l8hex2int(auth->digest.nc.s, &nc) != 0) {
-			LM_ERR("bad nc value %.*s\n", auth->digest.nc.len, auth->digest.nc.s);
-			return 5; /* invalid nc */
+	/* the 2nd md5 (auth extra checks) is computed only if the first one
+	 * matches and the checks are not skipped because of a valid nc */
+	b_nonce2_len=calc_bin_nonce_md5(&b_nonce2, cfg, secret1, secret2, msg, 0);
+	if (!memcmp(&b_nonce.n.md5_1[0], &b_nonce2.n.md5_1[0], 16)) {
+#if defined USE_NC || defined USE_OT_NONCE
+		/* valid nonce generated by another node: its nonce-count or
+		 * one-time-nonce state is there => stale, to get a local nonce */
+		if (auth_node_id && (pf & (NF_VALID_NC_ID | NF_VALID_OT_ID)) &&
+				node != (unsigned char)auth_node_id) {
+			counter_inc(nonce_cnts_h.foreign);
+			return 4;
 		}
-		switch(nc_check_val(n_id, pf & NF_POOL_NO_MASK, nc)){
-			case NC_OK:
-				/* don't perform extra checks or one-time nonce checks
-				 * anymore, if we have nc */
-				goto check_stale;
-			case NC_ID_OVERFLOW: /* id too old => stale */
-			case NC_TOO_BIG:  /* nc overlfow => force re-auth => stale */
-			case NC_REPLAY:    /* nc seen before => re-auth => stale */
-			case NC_INV_POOL: /* pool-no too big, maybe ser restart?*/
-				return 4; /* stale */
+#endif /* USE_NC || USE_OT_NONCE */
+#ifdef USE_NC
+		/* if nounce-count checks enabled & auth. headers has nc */
+		if (nc_enabled && (pf & NF_VALID_NC_ID) && auth->digest.nc.s &&
+				auth->digest.nc.len){
+			if ((auth->digest.nc.len != 8) ||
+					l8hex2int(auth->digest.nc.s, &nc) != 0) {
+				LM_ERR("bad nc value %.*s\n", auth->digest.nc.len,
+						auth->digest.nc.s);
+				return 5; /* invalid nc */
+			}
+			switch(nc_check_val(n_id, pf & NF_POOL_NO_MASK, nc)){
+				case NC_OK:
+					/* don't perform extra checks or one-time nonce checks
+					 * anymore, if we have nc */
+					goto check_stale;
+				case NC_ID_OVERFLOW: /* id too old => stale */
+					counter_inc(nonce_cnts_h.id_overflow);
+					return 4;
+				case NC_TOO_BIG:  /* nc overlfow => force re-auth => stale */
+					counter_inc(nonce_cnts_h.nc_overflow);
+					return 4;
+				case NC_REPLAY:    /* nc seen before => re-auth => stale */
+					counter_inc(nonce_cnts_h.replay);
+					return 4;
+				case NC_INV_POOL: /* pool-no too big, maybe ser restart?*/
+					counter_inc(nonce_cnts_h.inv_pool);
+					return 4; /* stale */
+			}
 		}
-	}
 #endif /* USE_NC */
 #ifdef USE_OT_NONCE
-	if (otn_enabled && (pf & NF_VALID_OT_ID)){
-		switch(otn_check_id(n_id, pf & NF_POOL_NO_MASK)){
-			case OTN_OK:
-				/* continue in case auth extra checks are enabled */
-				break;
-			case OTN_ID_OVERFLOW:
-			case OTN_INV_POOL:
-			case OTN_REPLAY:
-				return 6; /* reused */
+		if (otn_enabled && (pf & NF_VALID_OT_ID)){
+			switch(otn_check_id(n_id, pf & NF_POOL_NO_MASK)){
+				case OTN_OK:
+					/* continue in case auth extra checks are enabled */
+					break;
+				case OTN_ID_OVERFLOW:
+					counter_inc(nonce_cnts_h.id_overflow);
+					return 6; /* reused */
+				case OTN_INV_POOL:
+					counter_inc(nonce_cnts_h.inv_pool);
+					return 6; /* reused */
+				case OTN_REPLAY:
+					counter_inc(nonce_cnts_h.replay);
+					return 6; /* reused */
+			}
 		}
-	}
 #endif
-	if (cfg) {
-		if (unlikely(b_nonce_len != b_nonce2_len))
-			return 2; /* someone truncated our nonce? */
-		if (memcmp(&b_nonce.n.md5_2[0], &b_nonce2.n.md5_2[0], 16))
-			return 3; /* auth_extra_checks failed */
-	}
+		if (cfg) {
+			if (unlikely(b_nonce_len != b_nonce2_len))
+				return 2; /* someone truncated our nonce? */
+			if (msg)
+				calc_bin_nonce_md5_2(&b_nonce2, cfg, secret2, msg);
+			if (memcmp(&b_nonce.n.md5_2[0], &b_nonce2.n.md5_2[0], 16))
+				return 3; /* auth_extra_checks failed */
+		}
 #ifdef USE_NC
 check_stale:
 #endif /* USE_NC */
-	if (unlikely(is_bin_nonce_stale(&b_nonce, t)))
-		return 4;
-	return 0;
-}
+		if (unlikely(is_bin_nonce_stale(&b_nonce, t)))
+			return 4;
+		return 0;
+	}
 
-return 2;
+	return 2;
 }
 
@@ -29,6 +29,7 @@
 #include "../../core/parser/digest/digest.h"
 #include "../../core/str.h"
 #include "../../core/basex.h"
+#include "../../core/counters.h"
 #include <time.h>
 
 
@@ -51,6 +52,10 @@
  * the pool no:
  * bit7 : on => nid & pool are valid for nonce-count
  * bit6 : on => nid & pool are valid for one-time nonce
+ * If nonce_node_id is set, the id of the node that generated the nonce is
+ * added after pf (1 byte, covered by the first MD5):
+ *  ... | nid(4) | pf(1) | node(1)
+ * All the nodes sharing the secret must use the same setting.
  */
 #if defined USE_NC || defined USE_OT_NONCE
 #define NF_VALID_NC_ID 128
@@ -60,7 +65,8 @@
 #endif
 
 #if defined USE_NC || defined USE_OT_NONCE
-#define nonce_nid_extra_size (sizeof(unsigned int)+sizeof(unsigned char))
+#define nonce_nid_extra_size \
+	(sizeof(unsigned int)+sizeof(unsigned char)+(auth_node_id?1:0))
 
 #else /* USE_NC || USE_OT_NONCE*/
 
@@ -77,6 +83,7 @@ struct bin_nonce_str{
 	unsigned int nid_i;
 	unsigned char nid_pf; /* pool no & flags:
 							* bits 7, 6 = flags, bits 5..0 pool no*/
+	unsigned char nid_node; /* optional, id of the node (nonce_node_id) */
 #endif /* USE_NC || USE_OT_NONCE */
 };
 
@@ -89,6 +96,7 @@ struct bin_nonce_small_str{
 	unsigned int nid_i;
 	unsigned char nid_pf; /* pool no & flags:
 							* bits 7, 6 = flags, bits 5..0 pool no*/
+	unsigned char nid_node; /* optional, id of the node (nonce_node_id) */
 #endif /* USE_NC || USE_OT_NONCE */
 };
 
@@ -114,9 +122,11 @@ union bin_nonce{
 		if (cfg && msg){ \
 			(bn)->n.nid_i=htonl(id_v); \
 			(bn)->n.nid_pf=(pf_v); \
+			(bn)->n.nid_node=(unsigned char)auth_node_id; \
 		}else{ \
 			(bn)->n_small.nid_i=htonl(id_v); \
 			(bn)->n_small.nid_pf=(pf_v); \
+			(bn)->n_small.nid_node=(unsigned char)auth_node_id; \
 		} \
 	}while(0)
 #else /* USE_NC || USE_OT_NONCE */
@@ -132,16 +142,17 @@ union bin_nonce{
  * or if nc_enabled:
  * expires_t | since_t | MD5...| MD5... | nonce_id | flag+pool_no(1 byte)
  * => 4 + 4 + 16 + 16 + 4 + 1 = 45 bytes
+ * and 1 more byte for the node id, if nonce_node_id is set
  * (sizeof(struct) cannot be used safely since structs can be padded
  *  by the compiler if not defined with special attrs)
  */
 #if defined USE_NC || defined USE_OT_NONCE
-#define MAX_BIN_NONCE_LEN (4 + 4 + 16 + 16 + 4 +1)
-#define MAX_NOCFG_BIN_NONCE_LEN (4 + 4 + 16 + 4 + 1)
+#define MAX_BIN_NONCE_LEN (4 + 4 + 16 + 16 + 4 + 1 + 1)
+#define MAX_NOCFG_BIN_NONCE_LEN (4 + 4 + 16 + 4 + 1 + 1)
 
 #define get_bin_nonce_len(cfg, nid_enabled) \
-	( ( (cfg)?MAX_BIN_NONCE_LEN:MAX_NOCFG_BIN_NONCE_LEN ) - \
-		(!(nid_enabled))*nonce_nid_extra_size )
+	( ( (cfg)?(4 + 4 + 16 + 16):(4 + 4 + 16) ) + \
+		(!!(nid_enabled))*nonce_nid_extra_size )
 
 #else /* USE_NC || USE_OT_NONCE */
 #define MAX_BIN_NONCE_LEN (4 + 4 + 16 + 16)
@@ -194,6 +205,22 @@ extern int auth_checks_ind;
  */
 extern unsigned int  nonce_auth_max_drift;
 
+/* id of this node, added to the nonces (0 - disabled) */
+extern int auth_node_id;
+
+/* nonce replay protection counters */
+struct nonce_counters_h {
+	counter_handle_t replay;
+	counter_handle_t id_overflow;
+	counter_handle_t nc_overflow;
+	counter_handle_t inv_pool;
+	counter_handle_t foreign;
+};
+
+extern struct nonce_counters_h nonce_cnts_h;
+
+int nonce_init_counters(void);
+
 
 int get_auth_checks(struct sip_msg* msg);
 
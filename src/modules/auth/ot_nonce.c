@@ -41,6 +41,7 @@ unsigned otn_in_flight_no; /* 2^k == 1<<oth_in_flight_k */
 #include <assert.h>
 
 static otn_cell_t * otn_array=0;
+static void* otn_array_block=0; /* otn_array before alignment, for shm_free */
 
 
 unsigned otn_partition_size; /* partition==otn_in_flight_no/nid_pool_no*/
@@ -126,7 +127,8 @@ int init_ot_nonce()
 
 	/*  array size should be multiple of sizeof(otn_cell_t) since we
 	 *  access it as an otn_cell_t array */
-	otn_array=shm_malloc(ROUND2TYPE((otn_in_flight_no+7)/8, otn_cell_t));
+	otn_array=nid_shm_malloc_aligned(
+			ROUND2TYPE((otn_in_flight_no+7)/8, otn_cell_t), &otn_array_block);
 	if (otn_array==0){
 		LM_ERR("init_ot_nonce: memory allocation failure, consider"
 				" either decreasing otn_in_flight_no of increasing the"
@@ -146,10 +148,11 @@ error:
 
 void destroy_ot_nonce()
 {
-	if (otn_array){
-		shm_free(otn_array);
-		otn_array=0;
+	if (otn_array_block){
+		shm_free(otn_array_block);
+		otn_array_block=0;
 	}
+	otn_array=0;
 }
 
 /* given the nonce id i and pool/partition p, produces a bit index in the
@@ -217,16 +220,20 @@ enum otn_check_ret otn_check_id(nid_t id, unsigned pool)
 	b=get_otn_cell_bit(n);          /* bit pos corresponding to n */
 	b_mask= (otn_cell_t)1<<b;
 
+	/* test and set, so that two processes receiving the same nonce at the
+	 * same time cannot both accept it */
 #ifdef OTN_CELL_T_LONG
-	v=atomic_get_long(&oth_array[i]);
-	if (unlikely(v & b_mask))
-		return OTN_REPLAY;
-	atomic_or_long((long*)&otn_array[i],  b_mask);
+	do{
+		v=atomic_get_long((long*)&otn_array[i]);
+		if (unlikely(v & b_mask))
+			return OTN_REPLAY;
+	}while(atomic_cmpxchg_long((long*)&otn_array[i], v, v | b_mask)!=v);
 #else
-	v=atomic_get_int(&otn_array[i]);
-	if (unlikely(v & b_mask))
-		return OTN_REPLAY;
-	atomic_or_int((int*)&otn_array[i],  b_mask);
+	do{
+		v=atomic_get_int((int*)&otn_array[i]);
+		if (unlikely(v & b_mask))
+			return OTN_REPLAY;
+	}while(atomic_cmpxchg_int((int*)&otn_array[i], v, v | b_mask)!=v);
 #endif /* OTN_CELL_T_LONG */
 	return 0;
 }
@@ -8,6 +8,7 @@
 #include "peermanager.h"
 #include "peerstatemachine.h"
 #include "receiver.h"
+#include "worker.h"
 #include "../../core/str.h"
 #include "../../core/dprint.h"
 
@@ -19,6 +20,7 @@ extern char *dp_states[];
 static const char* cdp_rpc_disable_peer_doc[2] 	= 	{"disable diameter peer", 0 };
 static const char* cdp_rpc_enable_peer_doc[2] 	= 	{"enable diameter peer", 0 };
 static const char* cdp_rpc_list_peers_doc[2] 	= 	{"list diameter peers and their state", 0 };
+static const char* cdp_rpc_worker_queues_doc[2] = 	{"list the worker task queues and their wait times", 0 };
 
 static void cdp_rpc_enable_peer(rpc_t* rpc, void* ctx)
 {
@@ -132,10 +134,46 @@ static void cdp_rpc_list_peers(rpc_t* rpc, void* ctx)
 	lock_release(peer_list_lock);
 }
 
+static void cdp_rpc_worker_queues(rpc_t* rpc, void* ctx)
+{
+	void *th;
+	task_queue_t *q;
+	int i, len, peak;
+	unsigned int total, avg, wmax;
+
+	for (i = 0; i < worker_queues_count(); i++) {
+		q = worker_queue(i);
+		lock_get(q->lock);
+		len = (q->end - q->start + q->max) % q->max;
+		peak = q->peak;
+		total = (unsigned int)q->total;
+		avg = (q->total > 0) ? (unsigned int)(q->wait / q->total) : 0;
+		wmax = q->wait_max;
+		lock_release(q->lock);
+
+		if (rpc->add(ctx, "{", &th) < 0) {
+			rpc->fault(ctx, 500, "Internal error creating rpc");
+			return;
+		}
+		if (rpc->struct_add(th, "ddddudu",
+					"Queue", i,
+					"Length", len,
+					"Max", q->max - 1,
+					"Peak", peak,
+					"Taken", total,
+					"Avg wait us", (int)avg,
+					"Max wait us", wmax) < 0) {
+			rpc->fault(ctx, 500, "Internal error creating queue struct");
+			return;
+		}
+	}
+}
+
 rpc_export_t cdp_rpc[] = {
 	{"cdp.disable_peer",	cdp_rpc_disable_peer,   cdp_rpc_disable_peer_doc,   0},
 	{"cdp.enable_peer",   	cdp_rpc_enable_peer,   	cdp_rpc_enable_peer_doc,   	0},
 	{"cdp.list_peers",   	cdp_rpc_list_peers,   	cdp_rpc_list_peers_doc,   	0},
+	{"cdp.worker_queues",	cdp_rpc_worker_queues,	cdp_rpc_worker_queues_doc,	RET_ARRAY},
 	{0, 0, 0, 0}
 };
 
@@ -23,6 +23,9 @@ counter_def_t cdp_cnt_defs[] = {
 int cdp_init_counters() {
 	if (counter_register_array("cdp", cdp_cnt_defs) < 0)
 		goto error;
+	if (counter_register_hist(&cdp_cnts_h.queue_wait, "cdp", "queue_wait_us",
+				0, "time spent by the tasks in the worker queues (usec)", 0) < 0)
+		goto error;
 	return 0;
 error:
 	return -1;
@@ -9,6 +9,7 @@ struct cdp_counters_h {
 	counter_handle_t replies_response_time;
 	counter_handle_t avg_response_time;
 	counter_handle_t queuelength;
+	counter_handle_t queue_wait;
 };
 
 int cdp_init_counters();
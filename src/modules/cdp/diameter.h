@@ -224,6 +224,8 @@ typedef struct avp {
 	AAAVendorId vendorId;	/**< AVP vendor id 						*/
 	str data;				/**< AVP payload						*/
 	unsigned char free_it;	/**< if to free the payload when done	*/
+	unsigned char in_msg;	/**< allocated in the same block with the decoded
+							  message - freed only with the message */
 } AAA_AVP;
 
 
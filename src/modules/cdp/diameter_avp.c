@@ -204,8 +204,11 @@ AAAReturnCode  AAAAddAVPToMessage(
 		else
 			msg->avpList.tail = avp;
 	} else {
-		/* look after avp from position */
-		for(avp_t=msg->avpList.head;avp_t&&avp_t!=position;avp_t=avp_t->next);
+		/* look after avp from position - appending is the common case */
+		if (position==msg->avpList.tail)
+			avp_t=position;
+		else
+			for(avp_t=msg->avpList.head;avp_t&&avp_t!=position;avp_t=avp_t->next);
 		if (!avp_t) {
 			LM_ERR("AAAAddAVPToMessage: the \"position\" avp is not in"
 					"\"msg\" message!!\n");
@@ -362,7 +365,9 @@ AAAReturnCode  AAAFreeAVP(AAA_AVP **avp)
 	if ( (*avp)->free_it && (*avp)->data.s )
 		shm_free((*avp)->data.s);
 
-	shm_free( *avp );
+	/* the AVPs of a decoded message are released with the message */
+	if ( !(*avp)->in_msg )
+		shm_free( *avp );
 	avp = 0;
 
 	return AAA_ERR_SUCCESS;
@@ -516,6 +521,7 @@ AAA_AVP* AAACloneAVP( AAA_AVP *avp , unsigned char clone_data)
 	}
 	memcpy( n_avp, avp, sizeof(AAA_AVP));
 	n_avp->next = n_avp->prev = 0;
+	n_avp->in_msg = 0;
 
 	if (clone_data) {
 		/* clone the avp data */
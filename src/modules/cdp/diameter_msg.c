@@ -408,10 +408,10 @@ AAAReturnCode  AAAFreeAVPList(AAA_AVP_LIST *avpList)
  */
 AAAReturnCode  AAAFreeMessage(AAAMessage **msg)
 {
-	LM_DBG("AAAFreeMessage: Freeing message (%p) %d\n",*msg,(*msg)->commandCode);
 	/* param check */
 	if (!msg || !(*msg))
 		goto done;
+	LM_DBG("AAAFreeMessage: Freeing message (%p) %d\n",*msg,(*msg)->commandCode);
 
 	/* free the avp list */
 	AAAFreeAVPList(&((*msg)->avpList));
@@ -448,8 +448,85 @@ AAAReturnCode  AAASetMessageResultCode(
 
 
 
+void set_avp_fields( AAA_AVPCode code, AAA_AVP *avp);
+
+/**
+ *  Walks the AVPs of a received buffer, checking that they fit in it.
+ *  The AVP data is not copied, it points inside the buffer.
+ * @param ptr - start of the first AVP
+ * @param end - end of the buffer
+ * @param avps - array to fill with the AVPs, or NULL to only count them
+ * @returns the number of AVPs or -1 on error
+ */
+static int AAAWalkAVPs(unsigned char *ptr, unsigned char *end, AAA_AVP *avps)
+{
+	AAA_AVP       *avp;
+	unsigned int  avp_code;
+	unsigned char avp_flags;
+	unsigned int  avp_len;
+	unsigned int  avp_vendorID;
+	unsigned int  avp_data_len;
+	int n = 0;
+
+	while (ptr < end) {
+		if (ptr+AVP_HDR_SIZE(0x80)>end){
+			LM_ERR("AAATranslateMessage: source buffer to short!! "
+					"Cannot read the whole AVP header!\n");
+			return -1;
+		}
+		/* avp code */
+		avp_code = get_4bytes( ptr );
+		ptr += AVP_CODE_SIZE;
+		/* avp flags */
+		avp_flags = (unsigned char)*ptr;
+		ptr += AVP_FLAGS_SIZE;
+		/* avp length */
+		avp_len = get_3bytes( ptr );
+		ptr += AVP_LENGTH_SIZE;
+		if (avp_len<AVP_HDR_SIZE(avp_flags)) {
+			LM_ERR("AAATranslateMessage: invalid AVP len [%d]\n",
+					avp_len);
+			return -1;
+		}
+		/* avp vendor-ID */
+		avp_vendorID = 0;
+		if (avp_flags&AAA_AVP_FLAG_VENDOR_SPECIFIC) {
+			avp_vendorID = get_4bytes( ptr );
+			ptr += AVP_VENDOR_ID_SIZE;
+		}
+		/* data length */
+		avp_data_len = avp_len-AVP_HDR_SIZE(avp_flags);
+		/*check the data length */
+		if ( end-ptr<avp_data_len) {
+			LM_ERR("AAATranslateMessage: source buffer to short!! "
+					"Cannot read a whole data for AVP!\n");
+			return -1;
+		}
+
+		if (avps) {
+			avp = &avps[n];
+			avp->code = avp_code;
+			avp->flags = avp_flags;
+			avp->vendorId = avp_vendorID;
+			set_avp_fields( avp_code, avp);
+			avp->data.s = (char*) ptr;
+			avp->data.len = avp_data_len;
+			avp->free_it = 0;
+			avp->in_msg = 1;
+		}
+		n++;
+
+		if (end-ptr < to_32x_len( avp_data_len ))
+			break;
+		ptr += to_32x_len( avp_data_len );
+	}
+	return n;
+}
+
 /**
  *  This function convert message from the network format to the AAAMessage structure (decoder).
+ *  The AVPs are allocated in a single block with the message and their
+ *  data points inside the source buffer, so nothing is copied.
  * @param source - the source char buffer
  * @param sourceLen - the length of the input buffer
  * @param attach_buf - whether to attach the input buffer to the message
@@ -463,12 +540,9 @@ AAAMessage* AAATranslateMessage( unsigned char* source, unsigned int sourceLen,
 	AAAMessage    *msg = 0;
 	unsigned char version;
 	unsigned int  msg_len;
-	AAA_AVP       *avp;
-	unsigned int  avp_code;
-	unsigned char avp_flags;
-	unsigned int  avp_len;
-	unsigned int  avp_vendorID;
-	unsigned int  avp_data_len;
+	AAA_AVP       *avps;
+	int           avps_no;
+	int           i;
 
 	/* check the params */
 	if( !source || !sourceLen || sourceLen<AAA_MSG_HDR_SIZE) {
@@ -476,19 +550,8 @@ AAAMessage* AAATranslateMessage( unsigned char* source, unsigned int sourceLen,
 		goto error;
 	}
 
-	/* inits */
-	msg = 0;
-	avp = 0;
 	ptr = source;
 
-	/* alloc a new message structure */
-	msg = (AAAMessage*)shm_malloc(sizeof(AAAMessage));
-	if (!msg) {
-		LM_ERR("AAATranslateMessage: no more free memory!!\n");
-		goto error;
-	}
-	memset(msg,0,sizeof(AAAMessage));
-
 	/* get the version */
 	version = (unsigned char)*ptr;
 	ptr += VER_SIZE;
@@ -506,6 +569,24 @@ AAAMessage* AAATranslateMessage( unsigned char* source, unsigned int sourceLen,
 				" buffer len [%d]\n",msg_len,sourceLen);
 		goto error;
 	}
+	if (msg_len<AAA_MSG_HDR_SIZE) {
+		LM_ERR("AAATranslateMessage: AAA message len [%d] too short\n",
+				msg_len);
+		goto error;
+	}
+
+	/* count the AVPs, to allocate them together with the message */
+	avps_no = AAAWalkAVPs(source+AAA_MSG_HDR_SIZE, source+msg_len, 0);
+	if (avps_no<0)
+		goto error;
+
+	/* alloc a new message structure */
+	msg = (AAAMessage*)shm_malloc(sizeof(AAAMessage)+avps_no*sizeof(AAA_AVP));
+	if (!msg) {
+		LM_ERR("AAATranslateMessage: no more free memory!!\n");
+		goto error;
+	}
+	memset(msg,0,sizeof(AAAMessage)+avps_no*sizeof(AAA_AVP));
 
 	/* command flags */
 	msg->flags = *ptr;
@@ -527,52 +608,30 @@ AAAMessage* AAATranslateMessage( unsigned char* source, unsigned int sourceLen,
 	msg->endtoendId = ntohl(*((unsigned int*)ptr));
 	ptr += END_TO_END_IDENTIFIER_SIZE;
 
-	/* start decoding the AVPS */
-	while (ptr < source+msg_len) {
-		if (ptr+AVP_HDR_SIZE(0x80)>source+msg_len){
-			LM_ERR("AAATranslateMessage: source buffer to short!! "
-					"Cannot read the whole AVP header!\n");
-			goto error;
-		}
-		/* avp code */
-		avp_code = get_4bytes( ptr );
-		ptr += AVP_CODE_SIZE;
-		/* avp flags */
-		avp_flags = (unsigned char)*ptr;
-		ptr += AVP_FLAGS_SIZE;
-		/* avp length */
-		avp_len = get_3bytes( ptr );
-		ptr += AVP_LENGTH_SIZE;
-		if (avp_len<1) {
-			LM_ERR("AAATranslateMessage: invalid AVP len [%d]\n",
-					avp_len);
-			goto error;
-		}
-		/* avp vendor-ID */
-		avp_vendorID = 0;
-		if (avp_flags&AAA_AVP_FLAG_VENDOR_SPECIFIC) {
-			avp_vendorID = get_4bytes( ptr );
-			ptr += AVP_VENDOR_ID_SIZE;
-		}
-		/* data length */
-		avp_data_len = avp_len-AVP_HDR_SIZE(avp_flags);
-		/*check the data length */
-		if ( source+msg_len<ptr+avp_data_len) {
-			LM_ERR("AAATranslateMessage: source buffer to short!! "
-					"Cannot read a whole data for AVP!\n");
-			goto error;
+	/* decode the AVPS and link them into the message */
+	if (avps_no>0) {
+		avps = (AAA_AVP*)(msg+1);
+		AAAWalkAVPs(ptr, source+msg_len, avps);
+		for(i=0;i<avps_no;i++) {
+			avps[i].prev = (i>0)?&avps[i-1]:0;
+			avps[i].next = (i<avps_no-1)?&avps[i+1]:0;
+			/* update the short-cuts - the last one wins, but for the
+			 * session id, which is the first one without vendor */
+			switch (avps[i].code) {
+				case AVP_Session_Id:
+					if (!msg->sessionId && !avps[i].vendorId)
+						msg->sessionId = &avps[i];
+					break;
+				case AVP_Origin_Host: msg->orig_host = &avps[i];break;
+				case AVP_Origin_Realm: msg->orig_realm = &avps[i];break;
+				case AVP_Destination_Host: msg->dest_host = &avps[i];break;
+				case AVP_Destination_Realm: msg->dest_realm = &avps[i];break;
+				case AVP_Result_Code: msg->res_code = &avps[i];break;
+				case AVP_Auth_Session_State: msg->auth_ses_state = &avps[i];break;
+			}
 		}
-
-		/* create the AVP */
-		avp = AAACreateAVP( avp_code, avp_flags, avp_vendorID, (char*) ptr,
-				avp_data_len, AVP_DONT_FREE_DATA);
-		if (!avp)
-			goto error;
-
-		/* link the avp into aaa message to the end */
-		AAAAddAVPToMessage( msg, avp, msg->avpList.tail);
-
-		ptr += to_32x_len( avp_data_len );
+		msg->avpList.head = &avps[0];
+		msg->avpList.tail = &avps[avps_no-1];
 	}
 
 	/* link the buffer to the message */
@@ -581,8 +640,6 @@ AAAMessage* AAATranslateMessage( unsigned char* source, unsigned int sourceLen,
 		msg->buf.len = msg_len;
 	}
 
-	msg->sessionId = AAAFindMatchingAVP(msg,0,AVP_Session_Id,0,0);
-
 	//AAAPrintMessage( msg );
 	return  msg;
 error:
@@ -48,6 +48,7 @@
 #include <sys/time.h>
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <sys/ioctl.h>
 #include <signal.h>
 #include <netinet/in.h>
@@ -73,6 +74,9 @@
 
 extern dp_config *config;		/**< Configuration for this diameter peer 	*/
 
+/** max number of messages taken from a send pipe and written at once */
+#define CDP_SEND_BATCH 16
+
 int dp_add_pid(pid_t pid);
 void dp_del_pid(pid_t pid);
 
@@ -626,6 +630,47 @@ error_and_reset:
 	return 0;
 }
 
+/**
+ * Writes a batch of messages taken from the send pipe on the peer socket.
+ * The messages are written with a single writev() call, so that a burst of
+ * requests towards the same peer results in as few syscalls as possible.
+ * @param sp - the serviced peer
+ * @param msgs - the messages to write
+ * @param n - the number of messages
+ * @returns 1 on success, 0 on error (the connection should be dropped)
+ */
+static int send_batch(serviced_peer_t *sp,AAAMessage **msgs,int n)
+{
+	struct iovec iov[CDP_SEND_BATCH];
+	int i,cnt,len=0;
+
+	for(i=0;i<n;i++){
+		iov[i].iov_base = msgs[i]->buf.s;
+		iov[i].iov_len = msgs[i]->buf.len;
+		len += msgs[i]->buf.len;
+	}
+	while( (cnt=writev(sp->tcp_socket,iov,n))==-1 ) {
+		if (errno==EINTR)
+			continue;
+		LM_ERR("select_recv(): [%.*s] write on socket [%d] returned error> %s... dropping\n",
+				sp->p?sp->p->fqdn.len:0,
+				sp->p?sp->p->fqdn.s:0,
+				sp->tcp_socket,
+				strerror(errno));
+		return 0;
+	}
+	if (cnt!=len){
+		LM_ERR("select_recv(): [%.*s] write on socket [%d] only wrote %d/%d bytes... dropping\n",
+				sp->p?sp->p->fqdn.len:0,
+				sp->p?sp->p->fqdn.s:0,
+				sp->tcp_socket,
+				cnt,
+				len);
+		return 0;
+	}
+	return 1;
+}
+
 /**
  * Selects once on sockets for receiving and sending stuff.
  * Monitors:
@@ -639,7 +684,8 @@ int receive_loop(peer *original_peer)
 	fd_set rfds,efds;
 	struct timeval tv;
 	int n,max=0,cnt=0;
-	AAAMessage *msg=0;
+	AAAMessage *msgs[CDP_SEND_BATCH];
+	int i,nmsgs;
 	serviced_peer_t *sp,*sp2;
 	peer *p;
 	int fd=-1;
@@ -754,7 +800,7 @@ int receive_loop(peer *original_peer)
 						if (sp->send_pipe_fd>=0 && FD_ISSET(sp->send_pipe_fd,&rfds)) {
 							/* send */
 							LM_DBG("select_recv(): There is something on the send pipe\n");
-							cnt = read(sp->send_pipe_fd,&msg,sizeof(AAAMessage *));
+							cnt = read(sp->send_pipe_fd,msgs,sizeof(msgs));
 							if (cnt==0){
 								//This is very stupid and might not work well - dropped messages... to be fixed
 								LM_INFO("select_recv(): ReOpening pipe for read. This should not happen...\n");
@@ -762,40 +808,23 @@ int receive_loop(peer *original_peer)
 								sp->send_pipe_fd = open(sp->send_pipe_name.s, O_RDONLY | O_NDELAY);
 								goto receive;
 							}
-							if (cnt<sizeof(AAAMessage *)){
+							if (cnt<(int)sizeof(AAAMessage *)){
 								if (cnt<0) LM_ERR("select_recv(): Error reading from send pipe\n");
 								goto receive;
 							}
-							LM_DBG("select_recv(): Send pipe says [%p] %d\n",msg,cnt);
+							/* pointers are written atomically, so only whole ones are read */
+							nmsgs = cnt/sizeof(AAAMessage *);
+							LM_DBG("select_recv(): Send pipe says %d messages\n",nmsgs);
 							if (sp->tcp_socket<0){
 								LM_ERR("select_recv(): got a signal to send something, but the connection was not opened\n");
-							} else {
-								while( (cnt=write(sp->tcp_socket,msg->buf.s,msg->buf.len))==-1 ) {
-									if (errno==EINTR)
-										continue;
-									LM_ERR("select_recv(): [%.*s] write on socket [%d] returned error> %s... dropping\n",
-											sp->p?sp->p->fqdn.len:0,
-											sp->p?sp->p->fqdn.s:0,
-											sp->tcp_socket,
-											strerror(errno));
-									AAAFreeMessage(&msg);
-									close(sp->tcp_socket);
-									goto drop_peer;
-								}
-
-								if (cnt!=msg->buf.len){
-									LM_ERR("select_recv(): [%.*s] write on socket [%d] only wrote %d/%d bytes... dropping\n",
-											sp->p?sp->p->fqdn.len:0,
-											sp->p?sp->p->fqdn.s:0,
-											sp->tcp_socket,
-											cnt,
-											msg->buf.len);
-									AAAFreeMessage(&msg);
-									close(sp->tcp_socket);
-									goto drop_peer;
-								}
+							} else if (!send_batch(sp,msgs,nmsgs)){
+								for(i=0;i<nmsgs;i++)
+									AAAFreeMessage(&msgs[i]);
+								close(sp->tcp_socket);
+								goto drop_peer;
 							}
-							AAAFreeMessage(&msg);
+							for(i=0;i<nmsgs;i++)
+								AAAFreeMessage(&msgs[i]);
 							//don't return, maybe there is something to read
 						}
 receive:
@@ -48,7 +48,7 @@
 #include "cdp_stats.h"
 
 extern struct cdp_counters_h cdp_cnts_h;
-cdp_trans_list_t *trans_list=0;		/**< list of transactions */
+cdp_trans_list_t *trans_list=0;		/**< table of transactions, hashed by hop-by-hop id */
 
 /**
  * Initializes the transaction structure.
@@ -57,15 +57,22 @@ cdp_trans_list_t *trans_list=0;		/**< list of transactions */
  */
 int cdp_trans_init()
 {
-	trans_list = shm_malloc(sizeof(cdp_trans_list_t));
+	int i;
+
+	trans_list = shm_malloc(CDP_TRANS_HASH_SIZE * sizeof(cdp_trans_list_t));
 	if (!trans_list){
-		LOG_NO_MEM("shm",sizeof(cdp_trans_list_t));
+		LOG_NO_MEM("shm",CDP_TRANS_HASH_SIZE * sizeof(cdp_trans_list_t));
 		return 0;
 	}
-	trans_list->head = 0;
-	trans_list->tail = 0;
-	trans_list->lock = lock_alloc();
-	trans_list->lock = lock_init(trans_list->lock);
+	memset(trans_list, 0, CDP_TRANS_HASH_SIZE * sizeof(cdp_trans_list_t));
+	for(i=0;i<CDP_TRANS_HASH_SIZE;i++){
+		trans_list[i].lock = lock_alloc();
+		if (!trans_list[i].lock){
+			LOG_NO_MEM("shm",sizeof(gen_lock_t));
+			return 0;
+		}
+		trans_list[i].lock = lock_init(trans_list[i].lock);
+	}
 
 	add_timer(1,0,cdp_trans_timer,0);
 	return 1;
@@ -74,15 +81,19 @@ int cdp_trans_init()
 int cdp_trans_destroy()
 {
 	cdp_trans_t *t=0;
+	int i;
 	if (trans_list){
-		lock_get(trans_list->lock);
-		while(trans_list->head){
-			t = trans_list->head;
-			trans_list->head = t->next;
-			cdp_free_trans(t);
+		for(i=0;i<CDP_TRANS_HASH_SIZE;i++){
+			if (!trans_list[i].lock) continue;
+			lock_get(trans_list[i].lock);
+			while(trans_list[i].head){
+				t = trans_list[i].head;
+				trans_list[i].head = t->next;
+				cdp_free_trans(t);
+			}
+			lock_destroy(trans_list[i].lock);
+			lock_dealloc((void*)trans_list[i].lock);
 		}
-		lock_destroy(trans_list->lock);
-		lock_dealloc((void*)trans_list->lock);
 		shm_free(trans_list);
 		trans_list = 0;
 	}
@@ -90,7 +101,7 @@ int cdp_trans_destroy()
 	return 1;
 }
 /**
- * Create and add a transaction to the transaction list.
+ * Create and add a transaction to the transaction table.
  * @param msg - the message that this related to
  * @param cb - callback to be called on response or time-out
  * @param ptr - generic pointer to pass to the callback on call
@@ -102,6 +113,7 @@ cdp_trans_t* cdp_add_trans(AAAMessage *msg,AAATransactionCallback_f *cb,
 		void *ptr,int timeout,int auto_drop)
 {
 	cdp_trans_t *x;
+	cdp_trans_list_t *l;
 	x = shm_malloc(sizeof(cdp_trans_t));
 	if (!x) {
 		LOG_NO_MEM("shm",sizeof(cdp_trans_t));
@@ -123,54 +135,93 @@ cdp_trans_t* cdp_add_trans(AAAMessage *msg,AAATransactionCallback_f *cb,
 	x->auto_drop = auto_drop;
 	x->next = 0;
 
-	lock_get(trans_list->lock);
-	x->prev = trans_list->tail;
-	if (trans_list->tail) trans_list->tail->next = x;
-	trans_list->tail = x;
-	if (!trans_list->head) trans_list->head = x;
-	lock_release(trans_list->lock);
+	l = &trans_list[cdp_trans_hash(x->hopbyhopid)];
+	lock_get(l->lock);
+	x->prev = l->tail;
+	if (l->tail) l->tail->next = x;
+	l->tail = x;
+	if (!l->head) l->head = x;
+	lock_release(l->lock);
 	return x;
 }
 
 /**
- * Remove from the list and deallocate a transaction.
- * @param msg - the message that relates to that particular transaction
+ * Find and unlink the transaction of a message from a slot.
+ * Must be called with the slot lock.
+ * @param l - the slot
+ * @param msg - the message that this transaction relates to
+ * @param e2e - match on the end-to-end id instead of the hop-by-hop id
+ * @returns the cdp_trans_t* if found or NULL if not
  */
-void del_trans(AAAMessage *msg)
+static inline cdp_trans_t* cdp_unlink_trans(cdp_trans_list_t *l,
+		AAAMessage *msg, int e2e)
 {
 	cdp_trans_t *x;
-	lock_get(trans_list->lock);
-	x = trans_list->head;
-	while(x&& x->endtoendid!=msg->endtoendId && x->hopbyhopid!=msg->hopbyhopId) x = x->next;
+	x = l->head;
+	if (e2e)
+		while(x && x->endtoendid!=msg->endtoendId) x = x->next;
+	else
+		while(x && x->hopbyhopid!=msg->hopbyhopId) x = x->next;
 	if (x){
 		if (x->prev) x->prev->next = x->next;
-		else trans_list->head = x->next;
+		else l->head = x->next;
 		if (x->next) x->next->prev = x->prev;
-		else trans_list->tail = x->prev;
-		cdp_free_trans(x);
+		else l->tail = x->prev;
 	}
-	lock_release(trans_list->lock);
+	return x;
 }
 
 /**
- * Return and remove the transaction from the transaction list.
+ * Find and unlink the transaction of a message.
+ * The answers carry the hop-by-hop id of the request, so the slot of that
+ * id is checked first. If it has no such transaction, the end-to-end id is
+ * looked up in all the slots, as the old single list lookup matched on
+ * either id (e.g., for a relay that does not keep the hop-by-hop id).
  * @param msg - the message that this transaction relates to
  * @returns the cdp_trans_t* if found or NULL if not
  */
-cdp_trans_t* cdp_take_trans(AAAMessage *msg)
+static cdp_trans_t* cdp_lookup_unlink_trans(AAAMessage *msg)
 {
 	cdp_trans_t *x;
-	lock_get(trans_list->lock);
-	x = trans_list->head;
-	while(x&& x->endtoendid!=msg->endtoendId && x->hopbyhopid!=msg->hopbyhopId) x = x->next;
-	if (x){
-		if (x->prev) x->prev->next = x->next;
-		else trans_list->head = x->next;
-		if (x->next) x->next->prev = x->prev;
-		else trans_list->tail = x->prev;
+	cdp_trans_list_t *l;
+	int i;
+
+	l = &trans_list[cdp_trans_hash(msg->hopbyhopId)];
+	lock_get(l->lock);
+	x = cdp_unlink_trans(l,msg,0);
+	lock_release(l->lock);
+	if (x) return x;
+
+	for(i=0;i<CDP_TRANS_HASH_SIZE;i++){
+		l = &trans_list[i];
+		if (!l->head) continue;
+		lock_get(l->lock);
+		x = cdp_unlink_trans(l,msg,1);
+		lock_release(l->lock);
+		if (x) return x;
 	}
-	lock_release(trans_list->lock);
-	return x;
+	return 0;
+}
+
+/**
+ * Remove from the table and deallocate a transaction.
+ * @param msg - the message that relates to that particular transaction
+ */
+void del_trans(AAAMessage *msg)
+{
+	cdp_trans_t *x;
+	x = cdp_lookup_unlink_trans(msg);
+	if (x) cdp_free_trans(x);
+}
+
+/**
+ * Return and remove the transaction from the transaction table.
+ * @param msg - the message that this transaction relates to
+ * @returns the cdp_trans_t* if found or NULL if not
+ */
+cdp_trans_t* cdp_take_trans(AAAMessage *msg)
+{
+	return cdp_lookup_unlink_trans(msg);
 }
 
 /**
@@ -191,30 +242,36 @@ void cdp_free_trans(cdp_trans_t *x)
 int cdp_trans_timer(time_t now, void* ptr)
 {
 	cdp_trans_t *x,*n;
-	lock_get(trans_list->lock);
-	x = trans_list->head;
-	while(x)
-	{
-		if (now>x->expires){
-			counter_inc(cdp_cnts_h.timeout);		//Transaction has timed out waiting for response
-
-			x->ans = 0;
-			if (x->cb){
-				(x->cb)(1,*(x->ptr),0, (now - x->expires));
-			}
-			n = x->next;
+	cdp_trans_list_t *l;
+	int i;
+	for(i=0;i<CDP_TRANS_HASH_SIZE;i++){
+		l = &trans_list[i];
+		if (!l->head) continue;
+		lock_get(l->lock);
+		x = l->head;
+		while(x)
+		{
+			if (now>x->expires){
+				counter_inc(cdp_cnts_h.timeout);		//Transaction has timed out waiting for response
 
-			if (x->prev) x->prev->next = x->next;
-			else trans_list->head = x->next;
-			if (x->next) x->next->prev = x->prev;
-			else trans_list->tail = x->prev;
-			if (x->auto_drop) cdp_free_trans(x);
+				x->ans = 0;
+				if (x->cb){
+					(x->cb)(1,*(x->ptr),0, (now - x->expires));
+				}
+				n = x->next;
 
-			x = n;
-		} else
-			x = x->next;
+				if (x->prev) x->prev->next = x->next;
+				else l->head = x->next;
+				if (x->next) x->next->prev = x->prev;
+				else l->tail = x->prev;
+				if (x->auto_drop) cdp_free_trans(x);
+
+				x = n;
+			} else
+				x = x->next;
+		}
+		lock_release(l->lock);
 	}
-	lock_release(trans_list->lock);
 	return 1;
 }
 
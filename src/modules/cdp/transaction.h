@@ -69,6 +69,12 @@ typedef struct {
 	cdp_trans_t *head,*tail;		/**< first, last transactions in the list */
 } cdp_trans_list_t;
 
+/** number of slots in the transaction table - must be a power of 2 */
+#define CDP_TRANS_HASH_SIZE 1024
+
+/** slot of a transaction in the table, by hop-by-hop id */
+#define cdp_trans_hash(hbh) ((hbh) & (CDP_TRANS_HASH_SIZE - 1))
+
 int cdp_trans_init();
 int cdp_trans_destroy();
 
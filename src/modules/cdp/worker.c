@@ -57,6 +57,7 @@
 #include "diameter_peer.h"
 
 #include "../../core/cfg/cfg_struct.h"
+#include "../../core/hashes.h"
 #include "cdp_stats.h"
 
 /* defined in ../diameter_peer.c */
@@ -66,34 +67,100 @@ void dp_del_pid(pid_t pid);
 extern dp_config *config; /**< Configuration for this diameter peer 	*/
 extern struct cdp_counters_h cdp_cnts_h;
 
-task_queue_t *tasks; /**< queue of tasks */
+task_queue_t *tasks = 0; /**< array of task queues, one per worker or a shared one */
+static int tasks_no = 0; /**< number of task queues */
 
 cdp_cb_list_t *callbacks; /**< list of callbacks for message processing */
 
 extern unsigned int workerq_latency_threshold; /**<max delay for putting task into worker queue */
 extern unsigned int workerq_length_threshold_percentage;	/**< default threshold for worker queue length, percentage of max queue length */
+extern int workerq_affinity; /**< if each worker has its own task queue */
+
 /**
- * Initializes the worker structures, like the task queue.
+ * Current time in microseconds, used for the queue wait metrics.
  */
-void worker_init() {
-	tasks = shm_malloc(sizeof (task_queue_t));
+static inline unsigned long long worker_now_us()
+{
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return (unsigned long long)tv.tv_sec * 1000000 + tv.tv_usec;
+}
 
-	tasks->lock = lock_alloc();
-	tasks->lock = lock_init(tasks->lock);
+/**
+ * Number of tasks waiting in a queue (to be called with the queue lock or
+ * just as a hint).
+ */
+static inline int task_queue_len(task_queue_t *q)
+{
+	return (q->end - q->start + q->max) % q->max;
+}
 
-	sem_new(tasks->empty, 0);
+/**
+ * Initializes one task queue.
+ * @param q - the queue
+ * @param max - size of the queue array
+ * @returns 0 on success, -1 on error
+ */
+static int task_queue_init(task_queue_t *q, int max)
+{
+	q->lock = lock_alloc();
+	if (!q->lock) goto out_of_memory;
+	q->lock = lock_init(q->lock);
+
+	sem_new(q->empty, 0);
+
+	sem_new(q->full, 1);
+
+	q->start = 0;
+	q->end = 0;
+	q->max = max;
+	q->queue = shm_malloc(q->max * sizeof (task_t));
+	if (!q->queue) {
+		LOG_NO_MEM("shm", q->max * sizeof (task_t));
+		goto out_of_memory;
+	}
+	memset(q->queue, 0, q->max * sizeof (task_t));
+	return 0;
+out_of_memory:
+	return -1;
+}
 
-	sem_new(tasks->full, 1);
+/**
+ * Releases the resources of one task queue.
+ */
+static void task_queue_free(task_queue_t *q)
+{
+	if (q->lock) {
+		lock_destroy(q->lock);
+		lock_dealloc((void*) q->lock);
+		q->lock = 0;
+	}
+	sem_free(q->full);
+	sem_free(q->empty);
+	if (q->queue) shm_free(q->queue);
+	q->queue = 0;
+}
 
-	tasks->start = 0;
-	tasks->end = 0;
-	tasks->max = config->queue_length;
-	tasks->queue = shm_malloc(tasks->max * sizeof (task_t));
-	if (!tasks->queue) {
-		LOG_NO_MEM("shm", tasks->max * sizeof (task_t));
+/**
+ * Initializes the worker structures, like the task queues.
+ * With workerq_affinity each worker gets its own queue, sized so that all
+ * the queues together hold the configured queue_length.
+ */
+void worker_init() {
+	int i, max;
+
+	tasks_no = (workerq_affinity && config->workers > 1) ? config->workers : 1;
+	max = config->queue_length / tasks_no;
+	if (max < 2) max = 2;
+
+	tasks = shm_malloc(tasks_no * sizeof (task_queue_t));
+	if (!tasks) {
+		LOG_NO_MEM("shm", tasks_no * sizeof (task_queue_t));
 		goto out_of_memory;
 	}
-	memset(tasks->queue, 0, tasks->max * sizeof (task_t));
+	memset(tasks, 0, tasks_no * sizeof (task_queue_t));
+	for (i = 0; i < tasks_no; i++)
+		if (task_queue_init(&tasks[i], max) < 0) goto out_of_memory;
 
 	callbacks = shm_malloc(sizeof (cdp_cb_list_t));
 	if (!callbacks) goto out_of_memory;
@@ -102,14 +169,10 @@ void worker_init() {
 	return;
 out_of_memory:
 	if (tasks) {
-		if (tasks->lock) {
-			lock_destroy(tasks->lock);
-			lock_dealloc(&(tasks->lock));
-		}
-		sem_free(tasks->full);
-		sem_free(tasks->empty);
-		if (tasks->queue) shm_free(tasks->queue);
+		for (i = 0; i < tasks_no; i++)
+			task_queue_free(&tasks[i]);
 		shm_free(tasks);
+		tasks = 0;
 	}
 	if (callbacks) shm_free(callbacks);
 }
@@ -118,7 +181,8 @@ out_of_memory:
  * Destroys the worker structures.
  */
 void worker_destroy() {
-	int i, sval = 0;
+	int i, k, sval = 0, workers;
+	task_queue_t *q;
 	if (callbacks) {
 		while (callbacks->head)
 			cb_remove(callbacks->head);
@@ -126,38 +190,40 @@ void worker_destroy() {
 	}
 
 	// to deny runing the poison queue again
+	workers = config->workers;
 	config->workers = 0;
 	if (tasks) {
-		lock_get(tasks->lock);
-		for (i = 0; i < tasks->max; i++) {
-			if (tasks->queue[i].msg) AAAFreeMessage(&(tasks->queue[i].msg));
-			tasks->queue[i].msg = 0;
-			tasks->queue[i].p = 0;
+		for (k = 0; k < tasks_no; k++) {
+			q = &tasks[k];
+			lock_get(q->lock);
+			for (i = 0; i < q->max; i++) {
+				if (q->queue[i].msg) AAAFreeMessage(&(q->queue[i].msg));
+				q->queue[i].msg = 0;
+				q->queue[i].p = 0;
+			}
+			lock_release(q->lock);
 		}
-		lock_release(tasks->lock);
 
 		LM_INFO("Unlocking workers waiting on empty queue...\n");
-		for (i = 0; i < config->workers; i++)
-			sem_release(tasks->empty);
+		for (i = 0; i < workers; i++)
+			sem_release(tasks[i % tasks_no].empty);
 		LM_INFO("Unlocking workers waiting on full queue...\n");
 		i = 0;
-		while (sem_getvalue(tasks->full, &sval) == 0)
-			if (sval <= 0) {
-				sem_release(tasks->full);
-				i = 1;
-			} else break;
+		for (k = 0; k < tasks_no; k++) {
+			while (sem_getvalue(tasks[k].full, &sval) == 0)
+				if (sval <= 0) {
+					sem_release(tasks[k].full);
+					i = 1;
+				} else break;
+		}
 		sleep(i);
 
-		lock_get(tasks->lock);
-		shm_free(tasks->queue);
-		lock_destroy(tasks->lock);
-		lock_dealloc((void*) tasks->lock);
-
-		//lock_release(tasks->empty);
-		sem_free(tasks->full);
-		sem_free(tasks->empty);
-
+		for (k = 0; k < tasks_no; k++) {
+			lock_get(tasks[k].lock);
+			task_queue_free(&tasks[k]);
+		}
 		shm_free(tasks);
+		tasks = 0;
 	}
 }
 
@@ -200,7 +266,42 @@ void cb_remove(cdp_cb_t *cb) {
 }
 
 /**
- * Adds a message as a task to the task queue.
+ * Selects the task queue for a message.
+ * Messages of the same session (or from the same peer, if there is no
+ * session) go to the same worker, keeping them in order and the worker
+ * caches warm. If that queue is full the least loaded one is used instead.
+ * @param p - the peer that the message was received from
+ * @param msg - the message
+ * @returns the index of the queue
+ */
+static int task_queue_select(peer *p, AAAMessage *msg) {
+	unsigned int h;
+	int i, idx, n, min;
+
+	if (tasks_no == 1) return 0;
+	if (msg->sessionId && msg->sessionId->data.len > 0)
+		h = get_hash1_raw(msg->sessionId->data.s, msg->sessionId->data.len);
+	else if (p && p->fqdn.len > 0)
+		h = get_hash1_raw(p->fqdn.s, p->fqdn.len);
+	else
+		h = msg->hopbyhopId;
+	idx = h % tasks_no;
+
+	/* lengths are read without locking - just a hint */
+	min = task_queue_len(&tasks[idx]);
+	if (min < tasks[idx].max - 1) return idx;
+	for (i = 0; i < tasks_no; i++) {
+		n = task_queue_len(&tasks[i]);
+		if (n < min) {
+			min = n;
+			idx = i;
+		}
+	}
+	return idx;
+}
+
+/**
+ * Adds a message as a task to the task queue of a worker.
  * This blocks if the task queue is full, until there is space.
  * @param p - the peer that the message was received from
  * @param msg - the message
@@ -210,27 +311,29 @@ int put_task(peer *p, AAAMessage *msg) {
 
 	struct timeval start, stop;
 	int num_tasks, length_percentage;
+	task_queue_t *q;
 
 	long elapsed_useconds=0, elapsed_seconds=0, elapsed_millis=0;
-	lock_get(tasks->lock);
+	q = &tasks[task_queue_select(p, msg)];
+	lock_get(q->lock);
 
 	gettimeofday(&start, NULL);
-	while ((tasks->end + 1) % tasks->max == tasks->start) {
-		lock_release(tasks->lock);
+	while ((q->end + 1) % q->max == q->start) {
+		lock_release(q->lock);
 
 		if (*shutdownx) {
-			sem_release(tasks->full);
+			sem_release(q->full);
 			return 0;
 		}
 
-		sem_get(tasks->full);
+		sem_get(q->full);
 
 		if (*shutdownx) {
-			sem_release(tasks->full);
+			sem_release(q->full);
 			return 0;
 		}
 
-		lock_get(tasks->lock);
+		lock_get(q->lock);
 	}
 
 	counter_inc(cdp_cnts_h.queuelength);
@@ -246,68 +349,92 @@ int put_task(peer *p, AAAMessage *msg) {
 				workerq_latency_threshold, elapsed_millis);
 	}
 
-	tasks->queue[tasks->end].p = p;
-	tasks->queue[tasks->end].msg = msg;
-	tasks->end = (tasks->end + 1) % tasks->max;
-	if (sem_release(tasks->empty) < 0)
+	q->queue[q->end].p = p;
+	q->queue[q->end].msg = msg;
+	q->queue[q->end].qtime = (unsigned long long)stop.tv_sec * 1000000
+			+ stop.tv_usec;
+	q->end = (q->end + 1) % q->max;
+	num_tasks = task_queue_len(q);
+	if (num_tasks > q->peak) q->peak = num_tasks;
+	if (sem_release(q->empty) < 0)
 		LM_WARN("Error releasing tasks->empty semaphore > %s!\n", strerror(errno));
-	lock_release(tasks->lock);
+	lock_release(q->lock);
 
 	if(workerq_length_threshold_percentage > 0) {
-		num_tasks = tasks->end - tasks->start;
-		length_percentage = num_tasks/tasks->max*100;
+		length_percentage = num_tasks*100/q->max;
 		if(length_percentage > workerq_length_threshold_percentage) {
 			LM_WARN("Queue length has exceeded length threshold percentage"
 					" [%i] and is length [%i]\n", length_percentage, num_tasks);
 		}
 	}
-	//int num_tasks = tasks->end - tasks->start;
-	//LM_ERR("Added task to task queue.  Queue length [%i]\n", num_tasks);
-
 
 	return 1;
 }
 
 /**
- * Remove and return the first task from the queue (FIFO).
+ * Remove and return the first task from the queue of a worker (FIFO).
  * This blocks until there is something in the queue.
+ * @param id - id of the worker
  * @returns the first task from the queue or an empty task on error (eg. shutdown in progress)
  */
-task_t take_task() {
-	task_t t = {0, 0};
-	lock_get(tasks->lock);
-	while (tasks->start == tasks->end) {
-		lock_release(tasks->lock);
+task_t take_task(int id) {
+	task_t t = {0, 0, 0};
+	task_queue_t *q;
+	unsigned long long w;
+
+	q = &tasks[id % tasks_no];
+	lock_get(q->lock);
+	while (q->start == q->end) {
+		lock_release(q->lock);
 		if (*shutdownx) {
-			sem_release(tasks->empty);
+			sem_release(q->empty);
 			return t;
 		}
-		sem_get(tasks->empty);
+		sem_get(q->empty);
 		if (*shutdownx) {
-			sem_release(tasks->empty);
+			sem_release(q->empty);
 			return t;
 		}
 
-		lock_get(tasks->lock);
+		lock_get(q->lock);
 	}
 
 	counter_add(cdp_cnts_h.queuelength, -1);
-	t = tasks->queue[tasks->start];
-	tasks->queue[tasks->start].msg = 0;
-	tasks->start = (tasks->start + 1) % tasks->max;
-	if (sem_release(tasks->full) < 0)
+	t = q->queue[q->start];
+	q->queue[q->start].msg = 0;
+	q->start = (q->start + 1) % q->max;
+	w = worker_now_us();
+	w = (w > t.qtime) ? w - t.qtime : 0;
+	q->total++;
+	q->wait += w;
+	if (w > q->wait_max) q->wait_max = (unsigned int)w;
+	if (sem_release(q->full) < 0)
 		LM_WARN("Error releasing tasks->full semaphore > %s!\n", strerror(errno));
-	lock_release(tasks->lock);
-
-	//int num_tasks = tasks->end - tasks->start;
-	//LM_ERR("Taken task from task queue.  Queue length [%i]\n", num_tasks);
+	lock_release(q->lock);
 
+	counter_hist_add(cdp_cnts_h.queue_wait, (unsigned long)w);
 
 	return t;
 }
 
 /**
- * Poisons the worker queue.
+ * Number of task queues.
+ */
+int worker_queues_count() {
+	return (tasks) ? tasks_no : 0;
+}
+
+/**
+ * Returns a task queue, to be inspected for statistics.
+ * @param idx - index of the queue
+ */
+task_queue_t *worker_queue(int idx) {
+	if (!tasks || idx < 0 || idx >= tasks_no) return 0;
+	return &tasks[idx];
+}
+
+/**
+ * Poisons the worker queues.
  * Actually it just releases the task queue locks so that the workers get to evaluate
  * if a shutdown is in process and exit.
  */
@@ -315,7 +442,7 @@ void worker_poison_queue() {
 	int i;
 	if (config->workers && tasks)
 		for (i = 0; i < config->workers; i++)
-			if (sem_release(tasks->empty) < 0)
+			if (sem_release(tasks[i % tasks_no].empty) < 0)
 				LM_WARN("Error releasing tasks->empty semaphore > %s!\n", strerror(errno));
 }
 
@@ -334,13 +461,13 @@ void worker_process(int id) {
 	while (1) {
 		if (shutdownx && (*shutdownx)) break;
 		cfg_update();
-		t = take_task();
+		t = take_task(id);
 		if (!t.msg) {
 			if (shutdownx && (*shutdownx)) break;
-			LM_INFO("[%d] got empty task Q(%d/%d)\n", id, tasks->start, tasks->end);
+			LM_INFO("[%d] got empty task\n", id);
 			continue;
 		}
-		LM_DBG("worker_process(): [%d] got task Q(%d/%d)\n", id, tasks->start, tasks->end);
+		LM_DBG("worker_process(): [%d] got task\n", id);
 		r = is_req(t.msg);
 		for (cb = callbacks->head; cb; cb = cb->next)
 			(*(cb->cb))(t.p, t.msg, *(cb->ptr));
@@ -55,6 +55,7 @@ typedef int (*worker_init_function)(int rank);
 typedef struct _task_t {
 	peer *p;			/**< peer that the message was received from */
 	AAAMessage *msg;	/**< diameter message received */
+	unsigned long long qtime;	/**< time when the task was queued (usec) */
 } task_t;
 
 /** task queue */
@@ -66,6 +67,10 @@ typedef struct {
 	task_t *queue;		/**< array holding the tasks */
 	gen_sem_t *empty;	/**< id of semaphore for signaling an empty queue */
 	gen_sem_t *full;	/**< id of semaphore for signaling an full queue */
+	unsigned int peak;	/**< highest number of tasks seen in the queue */
+	unsigned long long total;	/**< number of tasks taken from the queue */
+	unsigned long long wait;	/**< total time spent by the tasks in the queue (usec) */
+	unsigned int wait_max;	/**< highest time spent by a task in the queue (usec) */
 } task_queue_t;
 
 /** callback function to be called on message processing */
@@ -92,7 +97,9 @@ int cb_add(cdp_cb_f cb,void *ptr);
 void cb_remove(cdp_cb_t *cb);
 
 int put_task(peer *p,AAAMessage *msg);
-task_t take_task();
+task_t take_task(int id);
+int worker_queues_count();
+task_queue_t *worker_queue(int idx);
 
 
 void worker_poison_queue();
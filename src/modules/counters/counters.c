@@ -31,6 +31,7 @@
 #include "../../core/dprint.h"
 #include "../../core/compiler_opt.h"
 #include "../../core/counters.h"
+#include "../../core/ut.h"
 #include "../../core/kemi.h"
 
 MODULE_VERSION
@@ -94,6 +95,12 @@ static const char* cnt_grp_get_all_doc[] = {
 	"list all counter names and values in a specified group", 0
 };
 
+static void cnt_get_hist_rpc(rpc_t* rpc, void* ctx);
+static const char* cnt_get_hist_doc[] = {
+	"get histogram counter values - count, sum, percentiles and buckets"
+	" (group and counter name required)", 0
+};
+
 static void cnt_help_rpc(rpc_t* rpc, void* ctx);
 static const char* cnt_help_doc[] = {
 	"print the description of a counter (group and counter name required).", 0
@@ -111,6 +118,7 @@ static rpc_export_t counters_rpc[] = {
 	{"cnt.var_list", cnt_var_list_rpc, cnt_var_list_doc, RET_ARRAY },
 	{"cnt.get_vars", cnt_grp_get_all_rpc, cnt_grp_get_all_doc, 0 },
 	{"cnt.grp_get_all", cnt_grp_get_all_rpc, cnt_grp_get_all_doc, 0 },
+	{"cnt.get_hist", cnt_get_hist_rpc, cnt_get_hist_doc, 0},
 	{"cnt.help", cnt_help_rpc, cnt_help_doc, 0},
 	{ 0, 0, 0, 0}
 };
@@ -499,6 +507,64 @@ static void cnt_grp_get_all_rpc(rpc_t* rpc, void* c)
 
 
 
+/* bucket upper limits as strings, used as structure field names */
+static char cnt_hist_le_names[CNT_HIST_BUCKETS][INT2STR_MAX_LEN];
+
+static void cnt_get_hist_rpc(rpc_t* rpc, void* c)
+{
+	char* group;
+	char* name;
+	counter_handle_t h;
+	counter_hist_t hv;
+	counter_val_t cv;
+	void* s;
+	void* sb;
+	int b;
+
+	if (rpc->scan(c, "ss", &group, &name) < 2) {
+		/* rpc->fault(c, 400, "group and counter name required"); */
+		return;
+	}
+	if (counter_lookup(&h, group, name) < 0) {
+		rpc->fault(c, 400, "non-existent counter %s.%s\n", group, name);
+		return;
+	}
+	if (!counter_is_hist(h) || counter_get_hist(h, &hv) < 0) {
+		rpc->fault(c, 400, "counter %s.%s is not a histogram\n", group, name);
+		return;
+	}
+	if (cnt_hist_le_names[0][0] == 0) {
+		for (b = 0; b < CNT_HIST_BUCKETS - 1; b++)
+			snprintf(cnt_hist_le_names[b], INT2STR_MAX_LEN, "%lu",
+					counter_hist_bucket_le(b));
+		strcpy(cnt_hist_le_names[CNT_HIST_BUCKETS - 1], "+Inf");
+	}
+	if (rpc->add(c, "{", &s) < 0)
+		return;
+	/* printed as strings, the values (sum in particular) can go over
+	 * 32 bits */
+	rpc->struct_printf(s, "count", "%lu", (unsigned long)hv.count);
+	rpc->struct_printf(s, "sum", "%lu", (unsigned long)hv.sum);
+	rpc->struct_printf(s, "avg", "%lu",
+			(unsigned long)((hv.count>0) ? hv.sum / hv.count : 0));
+	rpc->struct_printf(s, "p50", "%lu", counter_hist_quantile(&hv, 50));
+	rpc->struct_printf(s, "p90", "%lu", counter_hist_quantile(&hv, 90));
+	rpc->struct_printf(s, "p99", "%lu", counter_hist_quantile(&hv, 99));
+	if (rpc->struct_add(s, "{", "buckets", &sb) < 0)
+		return;
+	/* cumulative values, only for buckets with recorded values */
+	cv = 0;
+	for (b = 0; b < CNT_HIST_BUCKETS; b++) {
+		if (hv.buckets[b] == 0)
+			continue;
+		cv += hv.buckets[b];
+		rpc->struct_printf(sb, cnt_hist_le_names[b], "%lu",
+				(unsigned long)cv);
+	}
+}
+
+
+
 static void cnt_help_rpc(rpc_t* rpc, void* ctx)
 {
 	char* group;
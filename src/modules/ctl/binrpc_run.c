@@ -27,6 +27,7 @@
 #include "../../core/clist.h"
 #include "io_listener.h"
 #include "ctl.h"
+#include "ctl_limits.h"
 
 #include <stdio.h>  /* vsnprintf */
 #include <stdlib.h> /* strtod */
@@ -630,6 +631,8 @@ int process_rpc_req(unsigned char* buf, int size, int* bytes_needed,
 	rpc_export_t* rpc_e;
 	struct binrpc_ctx f_ctx;
 	struct binrpc_parse_ctx* ctx;
+	struct ctl_limit* lim;
+	int busy;
 
 	if(ksr_shutdown_phase()) {
 		/* during shutdown - no more RPC command handling */
@@ -685,7 +688,14 @@ int process_rpc_req(unsigned char* buf, int size, int* bytes_needed,
 		goto end;
 	}
 	f_ctx.method=val.u.strval.s;
+	lim=ctl_limit_enter(val.u.strval.s, &busy);
+	if (busy){
+		rpc_fault(&f_ctx, CTL_LIMIT_FAULT_CODE,
+				"too many concurrent %s commands", val.u.strval.s);
+		goto end;
+	}
 	rpc_e->function(&binrpc_callbacks, &f_ctx);
+	ctl_limit_leave(lim);
 	if (f_ctx.replied==0){
 		if ((binrpc_pkt_len(&f_ctx.out.pkt)==0)
 			&& f_ctx.err_code && f_ctx.err_phrase.s
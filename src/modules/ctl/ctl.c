@@ -26,6 +26,7 @@
 #include "../../core/cfg/cfg_struct.h"
 #include "ctrl_socks.h"
 #include "io_listener.h"
+#include "ctl_limits.h"
 
 #include <sys/types.h>
 #include <sys/socket.h> /* socketpair */
@@ -54,6 +55,7 @@ static cmd_export_t cmds[]={
 static int usock_mode=0600; /* permissions, default rw-------*/
 static int usock_uid=-1; /* username and group for the unix sockets*/
 static int usock_gid=-1;
+static int ctl_workers=1; /* number of processes serving the ctl sockets */
 
 /* if set try to automatically convert values to the requested type in
    rpc->scan (default: not set) */
@@ -68,6 +70,7 @@ static int add_fifo_socket(modparam_t type, void * val);
 #endif
 static int fix_user(modparam_t type, void * val);
 static int fix_group(modparam_t type, void * val);
+static int add_rpc_limit(modparam_t type, void * val);
 
 
 static void  ctrl_listen_ls_rpc(rpc_t* rpc, void* ctx);
@@ -78,11 +81,13 @@ void io_listen_conn_rpc(rpc_t* rpc, void* ctx);
 static char* io_listen_who_doc[]={ "list open connections", 0 };
 static char* io_listen_conn_doc[]={ "returns number of open connections", 0 };
 static char* ctl_listen_ls_doc[]={ "list ctl listen sockets", 0 };
+static char* ctl_limits_doc[]={ "list rpc command concurrency limits", 0 };
 
 static rpc_export_t ctl_rpc[]={
 	{"ctl.who",         io_listen_who_rpc, (const char**)io_listen_who_doc, 0},
 	{"ctl.connections", io_listen_conn_rpc,(const char**)io_listen_conn_doc,0},
 	{"ctl.listen",      ctrl_listen_ls_rpc,(const char**)ctl_listen_ls_doc, 0},
+	{"ctl.limits",      ctl_limits_rpc,    (const char**)ctl_limits_doc, RET_ARRAY},
 	{ 0, 0, 0, 0}
 };
 
@@ -98,6 +103,8 @@ static param_export_t params[]={
 	{"binrpc_max_body_size",        PARAM_INT, &binrpc_max_body_size         },
 	{"binrpc_struct_max_body_size", PARAM_INT, &binrpc_struct_max_body_size  },
 	{"binrpc_buffer_size", PARAM_INT, &binrpc_buffer_size  },
+	{"workers",		PARAM_INT,						&ctl_workers			 },
+	{"rpc_limit",	PARAM_STRING|PARAM_USE_FUNC,	(void*) add_rpc_limit	 },
 	{0,0,0} 
 }; /* no params */
 
@@ -214,6 +221,18 @@ error:
 	return -1;
 }
 
+
+
+static int add_rpc_limit(modparam_t type, void * val)
+{
+	if ((type & PARAM_STRING)==0){
+		LOG(L_CRIT, "BUG: ctl: add_rpc_limit: bad parameter type %d\n",
+					type);
+		return -1;
+	}
+	return ctl_limit_add((char*)val);
+}
+
 #define CTL_SOCKET_PATH_SIZE	128
 
 static int mod_init(void)
@@ -229,6 +248,8 @@ static int mod_init(void)
 		binrpc_struct_max_body_size = 1;
 	binrpc_max_body_size *= 1024;
 	binrpc_struct_max_body_size *= 1024;
+	if (ctl_workers<=0)
+		ctl_workers = 1;
 
 	if (listen_lst==0) {
 		if(strcmp(runtime_dir, RUN_DIR)==0) {
@@ -293,10 +314,12 @@ static int mod_init(void)
 	}
 	if (ctrl_sock_lst){
 		/* we will fork */
-		register_procs(1); /* we will be creating an extra process */
-		register_fds(fd_no);
-		/* The child process will keep updating its local configuration */
-		cfg_register_child(1);
+		register_procs(ctl_workers); /* one extra process per worker */
+		register_fds(fd_no*ctl_workers);
+		/* The child processes will keep updating their local configuration */
+		cfg_register_child(ctl_workers);
+		if (ctl_limits_init()<0)
+			goto error;
 	}
 #ifdef USE_FIFO
 	fifo_rpc_init();
@@ -311,6 +334,7 @@ error:
 static int mod_child(int rank)
 {
 	int pid;
+	int i;
 	struct ctrl_socket* cs;
 	static int rpc_handler=0;
 
@@ -320,26 +344,47 @@ static int mod_child(int rank)
 	/* we want to fork(), but only from one process */
 	if ((rank == PROC_MAIN ) && (ctrl_sock_lst)){ /* FIXME: no fork ?? */
 		DBG("ctl: mod_child(%d), ctrl_sock_lst=%p\n", rank, ctrl_sock_lst);
-		/* fork, but make sure we know not to close our own sockets when
-		 * ctl child_init will be called for the new child */
-		rpc_handler=1;
-		/* child should start with a correct estimated used fds number*/
-		register_fds(MAX_IO_READ_CONNECTIONS);
-		pid=fork_process(PROC_RPC, "ctl handler", 1);
-		DBG("ctl: mod_child(%d), fork_process=%d, csl=%p\n",
-				rank, pid, ctrl_sock_lst);
-		if (pid<0){
-			goto error;
-		}
-		if (pid == 0){ /* child */
-			is_main=0;
-			DBG("ctl: %d io_listen_loop(%d, %p)\n",
-					rank, fd_no, ctrl_sock_lst);
-			io_listen_loop(fd_no, ctrl_sock_lst);
-		}else{ /* parent */
-			/* not used in parent */
-			register_fds(-MAX_IO_READ_CONNECTIONS);
-			rpc_handler=0;
+		/* all the workers inherit the same listen sockets and wait on them,
+		 * so the kernel hands each new connection or datagram to one of
+		 * the idle workers, while the busy ones run their commands */
+		for (i=0; i<ctl_workers; i++){
+			/* fork, but make sure we know not to close our own sockets when
+			 * ctl child_init will be called for the new child */
+			rpc_handler=1;
+			/* child should start with a correct estimated used fds number*/
+			register_fds(MAX_IO_READ_CONNECTIONS);
+			pid=fork_process(PROC_RPC, "ctl handler", 1);
+			DBG("ctl: mod_child(%d), fork_process=%d, csl=%p\n",
+					rank, pid, ctrl_sock_lst);
+			if (pid<0){
+				goto error;
+			}
+			if (pid == 0){ /* child */
+				is_main=0;
+#ifdef USE_FIFO
+				if (i>0){
+					/* a fifo must have only one reader, else the requests
+					 * would be split among the workers */
+					for (cs=ctrl_sock_lst; cs; cs=cs->next){
+						if (cs->transport!=FIFO_SOCK)
+							continue;
+						if (cs->fd>=0) close(cs->fd);
+						cs->fd=-1;
+						if (cs->write_fd!=-1){
+							close(cs->write_fd);
+							cs->write_fd=-1;
+						}
+					}
+				}
+#endif
+				DBG("ctl: %d io_listen_loop(%d, %p) worker %d\n",
+						rank, fd_no, ctrl_sock_lst, i);
+				io_listen_loop(fd_no, ctrl_sock_lst);
+			}else{ /* parent */
+				/* not used in parent */
+				register_fds(-MAX_IO_READ_CONNECTIONS);
+				rpc_handler=0;
+			}
 		}
 	}
 	if (rank!=PROC_RPC || !rpc_handler){
@@ -413,6 +458,7 @@ static void mod_destroy(void)
 		free_ctrl_socket_list(ctrl_sock_lst);
 		ctrl_sock_lst=0;
 	}
+	ctl_limits_destroy();
 }
 
 
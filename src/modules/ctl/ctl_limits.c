@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2021 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * Kamailio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * Kamailio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* per rpc command concurrency limits
+ *
+ * The limits are configured with modparam("ctl", "rpc_limit", "name=N"),
+ * where name is either a full rpc command name (e.g. "ul.dump") or a prefix
+ * ending in '*' (e.g. "htable.*"). The list is built in pkg memory before
+ * forking, so every ctl worker has its own copy, but the counters are kept
+ * in shared memory and updated with atomic operations, so the limit applies
+ * to all the workers together.
+ */
+
+#include <string.h>
+
+#include "../../core/dprint.h"
+#include "../../core/ut.h"
+#include "../../core/trim.h"
+#include "../../core/mem/mem.h"
+#include "../../core/mem/shm_mem.h"
+#include "ctl_limits.h"
+
+
+static struct ctl_limit* ctl_limits_lst=0;
+static struct ctl_limit_cnt* ctl_limits_cnt=0; /* shm counters array */
+
+
+
+/* parses "name=N" and adds it to the limits list
+ * returns 0 on success, -1 on error */
+int ctl_limit_add(char* s)
+{
+	struct ctl_limit* l;
+	struct ctl_limit** ll;
+	char* eq;
+	str sn;
+	unsigned int max;
+	int len;
+
+	eq=strrchr(s, '=');
+	if (eq==0 || eq==s){
+		LM_ERR("bad rpc_limit \"%s\", expected name=N\n", s);
+		return -1;
+	}
+	sn.s=eq+1;
+	sn.len=strlen(sn.s);
+	trim(&sn);
+	if (sn.len==0 || str2int(&sn, &max)<0 || max==0){
+		LM_ERR("bad rpc_limit value in \"%s\"\n", s);
+		return -1;
+	}
+	len=(int)(eq-s);
+	while(len>0 && (s[len-1]==' ' || s[len-1]=='\t')) len--;
+	while(len>0 && (*s==' ' || *s=='\t')){ s++; len--; }
+	if (len==0){
+		LM_ERR("empty rpc command name in rpc_limit\n");
+		return -1;
+	}
+	l=pkg_malloc(sizeof(*l)+len+1);
+	if (l==0){
+		PKG_MEM_ERROR;
+		return -1;
+	}
+	memset(l, 0, sizeof(*l));
+	l->name=(char*)(l+1);
+	memcpy(l->name, s, len);
+	l->name[len]=0;
+	l->len=len;
+	if (l->name[len-1]=='*'){
+		l->prefix=1;
+		l->len--;
+	}
+	l->max=(int)max;
+	/* keep the config order, the first matching entry is used */
+	for (ll=&ctl_limits_lst; *ll; ll=&(*ll)->next);
+	*ll=l;
+	return 0;
+}
+
+
+
+/* allocates the shared counters, must be called from mod_init */
+int ctl_limits_init(void)
+{
+	struct ctl_limit* l;
+	int n;
+
+	n=0;
+	for (l=ctl_limits_lst; l; l=l->next)
+		n++;
+	if (n==0)
+		return 0;
+	ctl_limits_cnt=shm_malloc(n*sizeof(struct ctl_limit_cnt));
+	if (ctl_limits_cnt==0){
+		SHM_MEM_ERROR;
+		return -1;
+	}
+	n=0;
+	for (l=ctl_limits_lst; l; l=l->next){
+		l->cnt=&ctl_limits_cnt[n++];
+		atomic_set(&l->cnt->active, 0);
+		atomic_set(&l->cnt->rejected, 0);
+	}
+	return 0;
+}
+
+
+
+void ctl_limits_destroy(void)
+{
+	struct ctl_limit* l;
+
+	while(ctl_limits_lst){
+		l=ctl_limits_lst;
+		ctl_limits_lst=l->next;
+		pkg_free(l);
+	}
+	if (ctl_limits_cnt){
+		shm_free(ctl_limits_cnt);
+		ctl_limits_cnt=0;
+	}
+}
+
+
+
+/* looks up the limit for method and reserves an execution slot
+ * returns the limit that must be released with ctl_limit_leave() after
+ * the command was run, or 0 if the command is not limited or the limit
+ * was reached (in the later case *busy is set to 1) */
+struct ctl_limit* ctl_limit_enter(char* method, int* busy)
+{
+	struct ctl_limit* l;
+	int len;
+
+	*busy=0;
+	if (ctl_limits_lst==0 || ctl_limits_cnt==0)
+		return 0;
+	len=strlen(method);
+	for (l=ctl_limits_lst; l; l=l->next){
+		if (l->prefix){
+			if (len>=l->len && memcmp(l->name, method, l->len)==0)
+				break;
+		}else if (len==l->len && memcmp(l->name, method, len)==0){
+			break;
+		}
+	}
+	if (l==0)
+		return 0;
+	if (atomic_add(&l->cnt->active, 1)>l->max){
+		atomic_dec(&l->cnt->active);
+		atomic_inc(&l->cnt->rejected);
+		*busy=1;
+		return 0;
+	}
+	return l;
+}
+
+
+
+void ctl_limit_leave(struct ctl_limit* l)
+{
+	if (l)
+		atomic_dec(&l->cnt->active);
+}
+
+
+
+void ctl_limits_rpc(rpc_t* rpc, void* ctx)
+{
+	struct ctl_limit* l;
+	void* th;
+
+	for (l=ctl_limits_lst; l; l=l->next){
+		if (l->cnt==0)
+			continue;
+		if (rpc->add(ctx, "{", &th)<0)
+			return;
+		rpc->struct_add(th, "sddd",
+				"name", l->name,
+				"max", l->max,
+				"active", atomic_get(&l->cnt->active),
+				"rejected", atomic_get(&l->cnt->rejected));
+	}
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2021 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * Kamailio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * Kamailio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/* per rpc command concurrency limits, shared by all the ctl workers */
+
+#ifndef _ctl_limits_h
+#define _ctl_limits_h
+
+#include "../../core/atomic_ops.h"
+#include "../../core/rpc.h"
+
+#define CTL_LIMIT_FAULT_CODE	503
+
+struct ctl_limit_cnt{
+	atomic_t active;   /* commands running now in all the ctl workers */
+	atomic_t rejected; /* commands refused because of the limit */
+};
+
+struct ctl_limit{
+	char* name;   /* rpc command name or prefix (if ending in '*') */
+	int len;      /* name length, without the '*' for prefixes */
+	int prefix;
+	int max;      /* max. concurrent executions */
+	struct ctl_limit_cnt* cnt; /* shm */
+	struct ctl_limit* next;
+};
+
+int ctl_limit_add(char* s);
+int ctl_limits_init(void);
+void ctl_limits_destroy(void);
+
+struct ctl_limit* ctl_limit_enter(char* method, int* busy);
+void ctl_limit_leave(struct ctl_limit* l);
+
+void ctl_limits_rpc(rpc_t* rpc, void* ctx);
+
+#endif
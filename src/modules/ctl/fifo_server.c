@@ -88,6 +88,7 @@
 #include "fifo_server.h"
 #include "io_listener.h"
 #include "ctl.h"
+#include "ctl_limits.h"
 
 
 #define MAX_FIFO_COMMAND        128    /* Maximum length of a FIFO server command */
@@ -668,6 +669,8 @@ int fifo_process(char* msg_buf, int size, int* bytes_needed, void *sh,
 					void** saved_state)
 {
 	rpc_export_t* exp;
+	struct ctl_limit* lim;
+	int busy;
 	char* buf;
 	int line_len;
 	char *file_sep;
@@ -766,7 +769,14 @@ process:
 			goto consume;
 		}
 
+		lim = ctl_limit_enter(context.method, &busy);
+		if (busy) {
+			rpc_fault(&context, CTL_LIMIT_FAULT_CODE,
+					"Too many concurrent '%s' commands", context.method);
+			goto consume;
+		}
 		exp->function(&func_param, &context);
+		ctl_limit_leave(lim);
 
 	consume:
 		if (!context.reply_sent) {
@@ -218,6 +218,8 @@ void io_listen_loop(int fd_no, struct ctrl_socket* cs_lst)
 		goto error;
 	/* add all the sockets we listen on for connections */
 	for (cs=cs_lst; cs; cs=cs->next){
+		if (cs->fd<0)
+			continue; /* not served by this worker (e.g. fifo) */
 		switch(cs->transport){
 			case UDP_SOCK:
 			case UNIXD_SOCK:
@@ -2431,14 +2431,23 @@ static void internal_rpc_print_dlgs(rpc_t *rpc, void *c, int with_context)
 {
 	dlg_cell_t *dlg;
 	unsigned int i;
+	int n;
 
+	n = 0;
 	for( i=0 ; i<d_table->size ; i++ ) {
 		dlg_lock( d_table, &(d_table->entries[i]) );
 
 		for( dlg=d_table->entries[i].first ; dlg ; dlg=dlg->next ) {
 			internal_rpc_print_dlg(rpc, c, dlg, with_context);
+			n++;
 		}
 		dlg_unlock( d_table, &(d_table->entries[i]) );
+		/* send out the dialogs printed so far, outside of the entry lock */
+		if(n >= RPC_STREAM_BATCH) {
+			n = 0;
+			if(rpc_stream_flush(rpc, c) < 0)
+				return;
+		}
 	}
 }
 
@@ -55,6 +55,7 @@
 #include "../../core/script_cb.h"
 #include "../../core/kemi.h"
 #include "../../core/fmsg.h"
+#include "../../core/counters.h"
 
 #include "ds_ht.h"
 #include "api.h"
@@ -105,6 +106,7 @@ static int *_ds_ping_active = NULL;
 extern int ds_force_dst;
 extern str ds_event_callback;
 extern int ds_ping_latency_stats;
+extern counter_handle_t ds_ping_latency_hist;
 extern float ds_latency_estimator_alpha;
 extern int ds_attrs_none;
 extern param_t *ds_db_extra_attrs_list;
@@ -2845,6 +2847,7 @@ int ds_update_latency(int group, str *address, int code)
 				&& strncasecmp(ds_dest->uri.s, address->s, address->len) == 0) {
 			struct timeval now;
 			int latency_ms;
+			long long latency_us;
 			/* Destination address found, this is the gateway that was pinged. */
 			state = ds_dest->flags;
 			if (!(state & DS_PROBING_DST)) {
@@ -2854,10 +2857,14 @@ int ds_update_latency(int group, str *address, int code)
 			if (code == 408 && latency_stats->timeout < UINT32_MAX)
 				latency_stats->timeout++;
 			gettimeofday(&now, NULL);
-			latency_ms = (now.tv_sec - latency_stats->start.tv_sec)*1000
-		            + (now.tv_usec - latency_stats->start.tv_usec)/1000;
-			if (code != 408)
+			latency_us = (long long)(now.tv_sec - latency_stats->start.tv_sec)
+					* 1000000 + (now.tv_usec - latency_stats->start.tv_usec);
+			latency_ms = (int)(latency_us / 1000);
+			if (code != 408) {
 				latency_stats_update(latency_stats, latency_ms);
+				counter_hist_add(ds_ping_latency_hist,
+						(latency_us > 0) ? latency_us : 0);
+			}
 
 			LM_DBG("[%d]latency[%d]avg[%.2f][%.*s]code[%d]rweight[%d]\n",
 					latency_stats->count, latency_ms,
@@ -52,6 +52,7 @@
 #include "../../core/rpc.h"
 #include "../../core/rpc_lookup.h"
 #include "../../core/kemi.h"
+#include "../../core/counters.h"
 
 #include "ds_ht.h"
 #include "dispatch.h"
@@ -101,6 +102,7 @@ str ds_ping_method = str_init("OPTIONS");
 str ds_ping_from   = str_init("sip:dispatcher@localhost");
 static int ds_ping_interval = 0;
 int ds_ping_latency_stats = 0;
+counter_handle_t ds_ping_latency_hist;
 int ds_latency_estimator_alpha_i = 900;
 float ds_latency_estimator_alpha = 0.9f;
 int ds_probing_mode = DS_PROBE_NONE;
@@ -345,6 +347,15 @@ static int mod_init(void)
 			return -1;
 		}
 	}
+	if(ds_ping_latency_stats
+			&& counter_register_hist(&ds_ping_latency_hist, "dispatcher",
+					   "ping_latency_us", 0,
+					   "latency of the keepalive requests (microseconds)", 0)
+					   < 0) {
+		LM_ERR("failed to register the ping latency histogram\n");
+		return -1;
+	}
+
 	/* copy threshholds to config */
 	cfg_get(dispatcher, dispatcher_cfg, probing_threshold) = probing_threshold;
 	cfg_get(dispatcher, dispatcher_cfg, inactive_threshold) =
@@ -1510,9 +1521,11 @@ static const char *dispatcher_rpc_list_doc[2] = {
 		"Return the content of dispatcher sets", 0};
 
 /**
- *
+ * add the sets to the rpc reply
+ * - nb counts the destinations added since the last stream flush
  */
-int ds_rpc_print_set(ds_set_t *node, rpc_t *rpc, void *ctx, void *rpc_handle)
+int ds_rpc_print_set(ds_set_t *node, rpc_t *rpc, void *ctx, void *rpc_handle,
+		int *nb)
 {
 	int i = 0, rc = 0;
 	void *rh;
@@ -1529,7 +1542,7 @@ int ds_rpc_print_set(ds_set_t *node, rpc_t *rpc, void *ctx, void *rpc_handle)
 		return 0;
 
 	for(; i < 2; ++i) {
-		rc = ds_rpc_print_set(node->next[i], rpc, ctx, rpc_handle);
+		rc = ds_rpc_print_set(node->next[i], rpc, ctx, rpc_handle, nb);
 		if(rc != 0)
 			return rc;
 	}
@@ -1624,6 +1637,14 @@ int ds_rpc_print_set(ds_set_t *node, rpc_t *rpc, void *ctx, void *rpc_handle)
 		}
 	}
 
+	/* send out the destinations added so far */
+	*nb += node->nr;
+	if(*nb >= RPC_STREAM_BATCH) {
+		*nb = 0;
+		if(rpc_stream_flush(rpc, ctx) < 0)
+			return -1;
+	}
+
 	return 0;
 }
 
@@ -1634,6 +1655,7 @@ static void dispatcher_rpc_list(rpc_t *rpc, void *ctx)
 {
 	void *th;
 	void *ih;
+	int nb = 0;
 
 	ds_set_t *dslist = ds_get_list();
 	int dslistnr = ds_get_list_nr();
@@ -1654,7 +1676,7 @@ static void dispatcher_rpc_list(rpc_t *rpc, void *ctx)
 		return;
 	}
 
-	ds_rpc_print_set(dslist, rpc, ctx, ih);
+	ds_rpc_print_set(dslist, rpc, ctx, ih, &nb);
 
 	return;
 }
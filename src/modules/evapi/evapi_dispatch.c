@@ -29,7 +29,10 @@
 #include <sys/types.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
+#include <sys/uio.h>
+#include <sys/time.h>
 #include <fcntl.h>
+#include <errno.h>
 
 #include <ev.h>
 
@@ -40,6 +43,9 @@
 #include "../../core/receive.h"
 #include "../../core/kemi.h"
 #include "../../core/fmsg.h"
+#include "../../core/counters.h"
+#include "../../core/locking.h"
+#include "../../core/mem/shm_mem.h"
 
 #include "evapi_dispatch.h"
 
@@ -49,10 +55,19 @@ static int _evapi_netstring_format = 1;
 extern str _evapi_event_callback;
 extern int _evapi_dispatcher_pid;
 extern int _evapi_max_clients;
+extern int _evapi_ring_size;
+extern int _evapi_client_queue_size;
 
 #define EVAPI_IPADDR_SIZE	64
 #define EVAPI_TAG_SIZE	64
 #define CLIENT_BUFFER_SIZE	32768
+/* max number of queued events written with one writev() */
+#define EVAPI_IOV_SIZE	64
+/* max number of events taken at once from the ring */
+#define EVAPI_RING_BATCH	64
+
+typedef struct _evapi_msg evapi_msg_t;
+
 typedef struct _evapi_client {
 	int connected;
 	int sock;
@@ -63,6 +78,13 @@ typedef struct _evapi_client {
 	str  stag;
 	char rbuffer[CLIENT_BUFFER_SIZE];
 	unsigned int rpos;
+	/* write queue - events not yet written to the client socket */
+	evapi_msg_t **wq;
+	unsigned int wq_head;
+	unsigned int wq_count;
+	unsigned int wq_offset; /* bytes already written from the head event */
+	int wio_active;
+	struct ev_io wio;
 } evapi_client_t;
 
 typedef struct _evapi_env {
@@ -71,11 +93,48 @@ typedef struct _evapi_env {
 	str msg;
 } evapi_env_t;
 
-typedef struct _evapi_msg {
+struct _evapi_msg {
 	str data;
 	str tag;
 	int unicast;
-} evapi_msg_t;
+	int refs; /* used only by the dispatcher process */
+	unsigned long long stime; /* relay time (usec) */
+};
+
+/* events passed by the sip workers to the dispatcher - the dispatcher is
+ * woken up (via notify socket) only when the ring goes from empty to
+ * non-empty, then it takes the events in batches */
+typedef struct _evapi_ring {
+	gen_lock_t lock;
+	unsigned int size;
+	unsigned int head;
+	unsigned int count;
+	int wpending; /* last wake up failed - the next push has to retry */
+	evapi_msg_t **items;
+} evapi_ring_t;
+
+static evapi_ring_t *_evapi_ring = NULL;
+
+typedef struct _evapi_counters_h {
+	counter_handle_t ring_dropped;
+	counter_handle_t client_dropped;
+	counter_handle_t sent;
+	counter_handle_t latency;
+} evapi_counters_h_t;
+
+static evapi_counters_h_t _evapi_cnts_h;
+
+static counter_def_t _evapi_cnt_defs[] = {
+	{&_evapi_cnts_h.ring_dropped, "ring_dropped", 0, 0, 0,
+		"events dropped because the dispatcher ring was full"},
+	{&_evapi_cnts_h.client_dropped, "client_dropped", 0, 0, 0,
+		"events dropped because a client write queue was full"},
+	{&_evapi_cnts_h.sent, "sent", 0, 0, 0,
+		"events written to the clients"},
+	{0, 0, 0, 0, 0, 0}
+};
+
+static struct ev_loop *_evapi_loop = NULL;
 
 #define EVAPI_MAX_CLIENTS	_evapi_max_clients
 
@@ -179,6 +238,272 @@ int evapi_run_cfg_route(evapi_env_t *evenv, int rt, str *rtname)
 	return 0;
 }
 
+/**
+ *
+ */
+static unsigned long long evapi_time_us(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return (unsigned long long)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+/**
+ *
+ */
+int evapi_init_counters(void)
+{
+	if(counter_register_array("evapi", _evapi_cnt_defs) < 0) {
+		return -1;
+	}
+	if(counter_register_hist(&_evapi_cnts_h.latency, "evapi", "latency_us",
+				0, "time from relay until the event is queued to the"
+				" clients (usec)", 0) < 0) {
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ *
+ */
+int evapi_init_ring(void)
+{
+	if(_evapi_ring_size <= 0) {
+		return 0;
+	}
+	_evapi_ring = (evapi_ring_t*)shm_malloc(sizeof(evapi_ring_t)
+			+ _evapi_ring_size * sizeof(evapi_msg_t*));
+	if(_evapi_ring == NULL) {
+		SHM_MEM_ERROR;
+		return -1;
+	}
+	memset(_evapi_ring, 0, sizeof(evapi_ring_t));
+	_evapi_ring->items = (evapi_msg_t**)((char*)_evapi_ring
+			+ sizeof(evapi_ring_t));
+	_evapi_ring->size = _evapi_ring_size;
+	if(lock_init(&_evapi_ring->lock) == NULL) {
+		LM_ERR("cannot init the ring lock\n");
+		shm_free(_evapi_ring);
+		_evapi_ring = NULL;
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ *
+ */
+void evapi_destroy_ring(void)
+{
+	if(_evapi_ring == NULL) {
+		return;
+	}
+	lock_destroy(&_evapi_ring->lock);
+	while(_evapi_ring->count > 0) {
+		shm_free(_evapi_ring->items[_evapi_ring->head]);
+		_evapi_ring->head = (_evapi_ring->head + 1) % _evapi_ring->size;
+		_evapi_ring->count--;
+	}
+	shm_free(_evapi_ring);
+	_evapi_ring = NULL;
+}
+
+/**
+ * wake up the dispatcher - return 0 on success, -1 on error
+ */
+static int evapi_ring_wakeup(void)
+{
+	evapi_msg_t *wakeup = NULL;
+	ssize_t ret;
+
+	do {
+		ret = write(_evapi_notify_sockets[1], &wakeup, sizeof(evapi_msg_t*));
+	} while(ret < 0 && errno == EINTR);
+	return (ret == sizeof(evapi_msg_t*)) ? 0 : -1;
+}
+
+/**
+ * add an event to the ring and wake up the dispatcher if it was empty
+ * - return 0 on success, -1 if the ring is full
+ */
+static int evapi_ring_push(evapi_msg_t *emsg)
+{
+	int wake;
+
+	lock_get(&_evapi_ring->lock);
+	if(_evapi_ring->count >= _evapi_ring->size) {
+		lock_release(&_evapi_ring->lock);
+		return -1;
+	}
+	_evapi_ring->items[(_evapi_ring->head + _evapi_ring->count)
+			% _evapi_ring->size] = emsg;
+	wake = (_evapi_ring->count == 0 || _evapi_ring->wpending);
+	_evapi_ring->wpending = 0;
+	_evapi_ring->count++;
+	lock_release(&_evapi_ring->lock);
+
+	if(wake && evapi_ring_wakeup() < 0) {
+		/* the event stays in the ring - make the next push wake up the
+		 * dispatcher instead of waiting for the ring to be empty again */
+		lock_get(&_evapi_ring->lock);
+		_evapi_ring->wpending = 1;
+		lock_release(&_evapi_ring->lock);
+		LM_ERR("failed to wake up the evapi dispatcher (%d: %s)\n",
+				errno, strerror(errno));
+	}
+	return 0;
+}
+
+/**
+ * take up to max events from the ring
+ */
+static int evapi_ring_pop(evapi_msg_t **emsgs, int max)
+{
+	int n;
+
+	lock_get(&_evapi_ring->lock);
+	for(n = 0; n < max && _evapi_ring->count > 0; n++) {
+		emsgs[n] = _evapi_ring->items[_evapi_ring->head];
+		_evapi_ring->head = (_evapi_ring->head + 1) % _evapi_ring->size;
+		_evapi_ring->count--;
+	}
+	lock_release(&_evapi_ring->lock);
+	return n;
+}
+
+/**
+ *
+ */
+static void evapi_msg_unref(evapi_msg_t *emsg)
+{
+	emsg->refs--;
+	if(emsg->refs <= 0) {
+		shm_free(emsg);
+	}
+}
+
+/**
+ * drop all the events queued for a client
+ */
+static void evapi_client_wq_reset(int cidx)
+{
+	evapi_client_t *c;
+
+	c = &_evapi_clients[cidx];
+	if(c->wio_active) {
+		ev_io_stop(_evapi_loop, &c->wio);
+		c->wio_active = 0;
+	}
+	while(c->wq_count > 0) {
+		evapi_msg_unref(c->wq[c->wq_head]);
+		c->wq_head = (c->wq_head + 1) % _evapi_client_queue_size;
+		c->wq_count--;
+	}
+	c->wq_head = 0;
+	c->wq_offset = 0;
+}
+
+/**
+ * write as much as possible from the client queue, coalescing the events
+ * in one writev() call - if the socket is full, wait for it to become
+ * writable
+ */
+static void evapi_client_flush(int cidx)
+{
+	evapi_client_t *c;
+	struct iovec iov[EVAPI_IOV_SIZE];
+	evapi_msg_t *emsg;
+	unsigned int k;
+	int n;
+	ssize_t wlen;
+
+	c = &_evapi_clients[cidx];
+	while(c->wq_count > 0) {
+		for(n = 0; n < EVAPI_IOV_SIZE && n < c->wq_count; n++) {
+			emsg = c->wq[(c->wq_head + n) % _evapi_client_queue_size];
+			iov[n].iov_base = emsg->data.s;
+			iov[n].iov_len = emsg->data.len;
+		}
+		iov[0].iov_base = (char*)iov[0].iov_base + c->wq_offset;
+		iov[0].iov_len -= c->wq_offset;
+
+		wlen = writev(c->sock, iov, n);
+		if(wlen < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			if(errno == EAGAIN || errno == EWOULDBLOCK) {
+				break;
+			}
+			LM_DBG("failed to write on socket %d index [%d] (%d: %s)\n",
+					c->sock, cidx, errno, strerror(errno));
+			evapi_client_wq_reset(cidx);
+			return;
+		}
+		/* release the fully written events */
+		for(k = 0; k < (unsigned int)n && wlen >= iov[k].iov_len; k++) {
+			wlen -= iov[k].iov_len;
+			evapi_msg_unref(c->wq[c->wq_head]);
+			c->wq_head = (c->wq_head + 1) % _evapi_client_queue_size;
+			c->wq_count--;
+			c->wq_offset = 0;
+			counter_inc(_evapi_cnts_h.sent);
+		}
+		if(k < (unsigned int)n) {
+			/* partial write - socket buffer is full */
+			c->wq_offset += wlen;
+			break;
+		}
+	}
+
+	if(c->wq_count > 0) {
+		if(!c->wio_active) {
+			ev_io_start(_evapi_loop, &c->wio);
+			c->wio_active = 1;
+		}
+	} else if(c->wio_active) {
+		ev_io_stop(_evapi_loop, &c->wio);
+		c->wio_active = 0;
+	}
+}
+
+/**
+ *
+ */
+static void evapi_flush_clients(void)
+{
+	int i;
+
+	for(i=0; i<EVAPI_MAX_CLIENTS; i++) {
+		if(_evapi_clients[i].connected==1 && _evapi_clients[i].sock>=0
+				&& _evapi_clients[i].wq_count>0
+				&& !_evapi_clients[i].wio_active) {
+			evapi_client_flush(i);
+		}
+	}
+}
+
+/**
+ * client socket is writable again
+ */
+void evapi_send_client(struct ev_loop *loop, struct ev_io *watcher,
+		int revents)
+{
+	int cidx;
+
+	cidx = (int)(long)watcher->data;
+	if(_evapi_clients==NULL || cidx<0 || cidx>=EVAPI_MAX_CLIENTS) {
+		return;
+	}
+	if(_evapi_clients[cidx].connected==0 || _evapi_clients[cidx].sock<0) {
+		evapi_client_wq_reset(cidx);
+		return;
+	}
+	evapi_client_flush(cidx);
+}
+
 /**
  *
  */
@@ -188,6 +513,7 @@ int evapi_close_connection(int cidx)
 		return -1;
 	if(_evapi_clients[cidx].connected==1
 			&& _evapi_clients[cidx].sock >= 0) {
+		evapi_client_wq_reset(cidx);
 		close(_evapi_clients[cidx].sock);
 		_evapi_clients[cidx].connected = 0;
 		_evapi_clients[cidx].sock = -1;
@@ -280,30 +606,47 @@ void evapi_close_notify_sockets_parent(void)
 }
 
 /**
- *
+ * add the event to the write queues of the matching clients - the queues
+ * are written by evapi_flush_clients()
  */
 int evapi_dispatch_notify(evapi_msg_t *emsg)
 {
 	int i;
 	int n;
-	int wlen;
+	int nfull;
+	evapi_client_t *c;
 
 	if(_evapi_clients==NULL) {
 		return 0;
 	}
 
+	if(emsg->stime > 0) {
+		counter_hist_add(_evapi_cnts_h.latency,
+				(unsigned long)(evapi_time_us() - emsg->stime));
+	}
+
 	n = 0;
+	nfull = 0;
 	for(i=0; i<EVAPI_MAX_CLIENTS; i++) {
 		if(_evapi_clients[i].connected==1 && _evapi_clients[i].sock>=0) {
 			if(emsg->tag.s==NULL || (emsg->tag.len == _evapi_clients[i].stag.len
 						&& strncmp(_evapi_clients[i].stag.s,
 									emsg->tag.s, emsg->tag.len)==0)) {
-				wlen = write(_evapi_clients[i].sock, emsg->data.s,
-						emsg->data.len);
-				if(wlen!=emsg->data.len) {
-					LM_DBG("failed to write all packet (%d out of %d) on socket"
-							" %d index [%d]\n",
-							wlen, emsg->data.len, _evapi_clients[i].sock, i);
+				c = &_evapi_clients[i];
+				if(c->wq_count >= _evapi_client_queue_size) {
+					LM_DBG("write queue full on socket %d index [%d]\n",
+							c->sock, i);
+					if (emsg->unicast){
+						/* try the next matching client */
+						nfull++;
+						continue;
+					}
+					counter_inc(_evapi_cnts_h.client_dropped);
+				} else {
+					c->wq[(c->wq_head + c->wq_count)
+							% _evapi_client_queue_size] = emsg;
+					c->wq_count++;
+					emsg->refs++;
 				}
 				n++;
 				if (emsg->unicast){
@@ -313,6 +656,10 @@ int evapi_dispatch_notify(evapi_msg_t *emsg)
 		}
 	}
 
+	if(emsg->unicast && n == 0 && nfull > 0) {
+		/* the write queues of all the matching clients were full */
+		counter_inc(_evapi_cnts_h.client_dropped);
+	}
 	LM_DBG("the message was sent to %d clients\n", n);
 
 	return n;
@@ -356,6 +703,9 @@ void evapi_recv_client(struct ev_loop *loop, struct ev_io *watcher, int revents)
 			CLIENT_BUFFER_SIZE - 1 - _evapi_clients[i].rpos, 0);
 
 	if(rlen < 0) {
+		if(errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+			return;
+		}
 		LM_ERR("cannot read the client message\n");
 		_evapi_clients[i].rpos = 0;
 		return;
@@ -372,6 +722,7 @@ void evapi_recv_client(struct ev_loop *loop, struct ev_io *watcher, int revents)
 		evapi_run_cfg_route(&evenv, _evapi_rts.con_closed,
 				&_evapi_rts.con_closed_name);
 		_evapi_clients[i].connected = 0;
+		evapi_client_wq_reset(i);
 		if(_evapi_clients[i].sock>=0) {
 			close(_evapi_clients[i].sock);
 		}
@@ -552,6 +903,19 @@ void evapi_accept_client(struct ev_loop *loop, struct ev_io *watcher, int revent
 						&optval, optlen) < 0) {
 				LM_WARN("failed to enable keepalive on socket %d\n", csock);
 			}
+			/* events are written from the client write queue, a slow
+			 * client must not block the dispatcher */
+			optval = fcntl(csock, F_GETFL);
+			if(optval<0 || fcntl(csock, F_SETFL, optval | O_NONBLOCK)<0) {
+				LM_WARN("failed to set non-blocking socket %d\n", csock);
+			}
+			ev_io_init(&_evapi_clients[i].wio, evapi_send_client, csock,
+					EV_WRITE);
+			_evapi_clients[i].wio.data = (void*)(long)i;
+			_evapi_clients[i].wio_active = 0;
+			_evapi_clients[i].wq_head = 0;
+			_evapi_clients[i].wq_count = 0;
+			_evapi_clients[i].wq_offset = 0;
 			_evapi_clients[i].connected = 1;
 			_evapi_clients[i].sock = csock;
 			_evapi_clients[i].af = caddr.sa_family;
@@ -583,6 +947,27 @@ void evapi_accept_client(struct ev_loop *loop, struct ev_io *watcher, int revent
 	ev_io_start(loop, evapi_client);
 }
 
+/**
+ * dispatch all the events from the ring, taking them in batches, then
+ * write the client queues
+ */
+static void evapi_ring_drain(void)
+{
+	evapi_msg_t *emsgs[EVAPI_RING_BATCH];
+	int n;
+	int i;
+
+	do {
+		n = evapi_ring_pop(emsgs, EVAPI_RING_BATCH);
+		for(i = 0; i < n; i++) {
+			emsgs[i]->refs = 1;
+			evapi_dispatch_notify(emsgs[i]);
+			evapi_msg_unref(emsgs[i]);
+		}
+	} while(n == EVAPI_RING_BATCH);
+	evapi_flush_clients();
+}
+
 /**
  *
  */
@@ -601,15 +986,25 @@ void evapi_recv_notify(struct ev_loop *loop, struct ev_io *watcher, int revents)
 	/* read message from client */
 	rlen = read(watcher->fd, &emsg, sizeof(evapi_msg_t*));
 
-	if(rlen != sizeof(evapi_msg_t*) || emsg==NULL) {
+	if(rlen != sizeof(evapi_msg_t*)) {
 		LM_ERR("cannot read the sip worker message\n");
 		return;
 	}
 
+	if(emsg==NULL) {
+		/* wake up - events are in the ring */
+		if(_evapi_ring!=NULL) {
+			evapi_ring_drain();
+		}
+		return;
+	}
+
 	LM_DBG("received [%p] [%.*s] (%d)\n", (void*)emsg,
 			emsg->data.len, emsg->data.s, emsg->data.len);
+	emsg->refs = 1;
 	evapi_dispatch_notify(emsg);
-	shm_free(emsg);
+	evapi_msg_unref(emsg);
+	evapi_flush_clients();
 }
 
 /**
@@ -639,6 +1034,12 @@ int evapi_run_dispatcher(char *laddr, int lport)
 	memset(_evapi_clients, 0, sizeof(evapi_client_t) * EVAPI_MAX_CLIENTS);
 	for(i=0; i<EVAPI_MAX_CLIENTS; i++) {
 		_evapi_clients[i].sock = -1;
+		_evapi_clients[i].wq = (evapi_msg_t**)malloc(sizeof(evapi_msg_t*)
+				* _evapi_client_queue_size);
+		if(_evapi_clients[i].wq==NULL) {
+			LM_ERR("failed to allocate client write queue\n");
+			exit(-1);
+		}
 	}
 	loop = ev_default_loop(0);
 
@@ -646,6 +1047,7 @@ int evapi_run_dispatcher(char *laddr, int lport)
 		LM_ERR("cannot get libev loop\n");
 		return -1;
 	}
+	_evapi_loop = loop;
 
 	memset(&ai_hints, 0, sizeof(struct addrinfo));
 	ai_hints.ai_family = AF_UNSPEC;		/* allow IPv4 or IPv6 */
@@ -774,10 +1176,18 @@ int _evapi_relay(str *evdata, str *ctag, int unicast)
 	if (unicast){
 		emsg->unicast = unicast;
 	}
+	emsg->stime = evapi_time_us();
 
 	LM_DBG("sending [%p] [%.*s] (%d)\n", (void*)emsg, emsg->data.len,
 			emsg->data.s, emsg->data.len);
-	if(_evapi_notify_sockets[1]!=-1) {
+	if(_evapi_notify_sockets[1]!=-1 && _evapi_ring!=NULL) {
+		if(evapi_ring_push(emsg)<0) {
+			shm_free(emsg);
+			counter_inc(_evapi_cnts_h.ring_dropped);
+			LM_DBG("evapi dispatcher ring is full - event dropped\n");
+			return -1;
+		}
+	} else if(_evapi_notify_sockets[1]!=-1) {
 		len = write(_evapi_notify_sockets[1], &emsg, sizeof(evapi_msg_t*));
 		if(len<=0) {
 			shm_free(emsg);
@@ -788,12 +1198,14 @@ int _evapi_relay(str *evdata, str *ctag, int unicast)
 		cfg_update();
 		LM_DBG("dispatching [%p] [%.*s] (%d)\n", (void*)emsg,
 				emsg->data.len, emsg->data.s, emsg->data.len);
+		emsg->refs = 1;
 		if(evapi_dispatch_notify(emsg) == 0) {
-			shm_free(emsg);
+			evapi_msg_unref(emsg);
 			LM_WARN("message not delivered - no client connected\n");
 			return -1;
 		}
-		shm_free(emsg);
+		evapi_msg_unref(emsg);
+		evapi_flush_clients();
 	}
 	return 0;
 }
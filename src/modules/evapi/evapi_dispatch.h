@@ -27,6 +27,11 @@
 
 int evapi_init_notify_sockets(void);
 
+int evapi_init_ring(void);
+void evapi_destroy_ring(void);
+
+int evapi_init_counters(void);
+
 void evapi_close_notify_sockets_child(void);
 
 void evapi_close_notify_sockets_parent(void);
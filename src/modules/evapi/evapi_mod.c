@@ -54,6 +54,8 @@ static int   _evapi_netstring_format_param = 1;
 str _evapi_event_callback = STR_NULL;
 int _evapi_dispatcher_pid = -1;
 int _evapi_max_clients = 8;
+int _evapi_ring_size = 8192;
+int _evapi_client_queue_size = 4096;
 
 static str _evapi_data = STR_NULL;
 static int _evapi_data_size = 0;
@@ -103,6 +105,8 @@ static param_export_t params[]={
 	{"netstring_format",  INT_PARAM,   &_evapi_netstring_format_param},
 	{"event_callback",    PARAM_STR,   &_evapi_event_callback},
 	{"max_clients",       PARAM_INT,   &_evapi_max_clients},
+	{"ring_size",         PARAM_INT,   &_evapi_ring_size},
+	{"client_queue_size", PARAM_INT,   &_evapi_client_queue_size},
 	{0, 0, 0}
 };
 
@@ -160,6 +164,21 @@ static int mod_init(void)
 		_evapi_bind_addr = _evapi_bind_param;
 	}
 
+	if(_evapi_client_queue_size <= 0) {
+		LM_ERR("invalid client_queue_size: %d\n", _evapi_client_queue_size);
+		return -1;
+	}
+
+	if(evapi_init_ring()<0) {
+		LM_ERR("failed to initialize the events ring\n");
+		return -1;
+	}
+
+	if(evapi_init_counters()<0) {
+		LM_ERR("failed to register the counters\n");
+		return -1;
+	}
+
 	/* add space for one extra process */
 	register_procs(1 + _evapi_workers);
 
@@ -242,6 +261,7 @@ static int child_init(int rank)
  */
 static void mod_destroy(void)
 {
+	evapi_destroy_ring();
 }
 
 #define evapi_malloc malloc
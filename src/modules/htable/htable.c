@@ -1471,6 +1471,7 @@ static void  htable_rpc_dump(rpc_t* rpc, void* c)
 	ht_t *ht;
 	ht_cell_t *it;
 	int i;
+	int n;
 	void* th;
 	void* ih;
 	void* vh;
@@ -1486,6 +1487,7 @@ static void  htable_rpc_dump(rpc_t* rpc, void* c)
 		rpc->fault(c, 500, "No such htable");
 		return;
 	}
+	n = 0;
 	for(i=0; i<ht->htsize; i++)
 	{
 		ht_slot_lock(ht, i);
@@ -1533,9 +1535,16 @@ static void  htable_rpc_dump(rpc_t* rpc, void* c)
 					}
 				}
 				it = it->next;
+				n++;
 			}
 		}
 		ht_slot_unlock(ht, i);
+		/* send out the items added so far, outside of the slot lock */
+		if(n >= RPC_STREAM_BATCH) {
+			n = 0;
+			if(rpc_stream_flush(rpc, c) < 0)
+				return;
+		}
 	}
 
 	return;
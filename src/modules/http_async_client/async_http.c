@@ -51,6 +51,7 @@
 #include "../../modules/tm/tm_load.h"
 
 #include "async_http.h"
+#include "hm_cache.h"
 
 /* tm */
 extern struct tm_binds tmb;
@@ -273,6 +274,91 @@ done:
 	return;
 }
 
+/*
+ * build the identity of a query that can be coalesced or cached: GET
+ * without body, same url, headers, credentials and tls/transfer options
+ * - every option that can change the reply has to be part of the key, so a
+ *   query is never answered with a reply fetched with other credentials or
+ *   with a weaker tls verification
+ * - returns 1 and a pkg allocated key, or 0 if the query has no identity
+ */
+static int async_query_key(async_query_t *aq, str *key)
+{
+	int i;
+	int len;
+	char *p;
+	char *sp[5];
+	int n;
+
+	key->s = NULL;
+	key->len = 0;
+	if (!coalesce_queries && !hm_cache_enabled())
+		return 0;
+	if (aq->query_params.body.s && aq->query_params.body.len > 0)
+		return 0;
+	if (aq->query_params.method != AH_METH_DEFAULT
+			&& aq->query_params.method != AH_METH_GET)
+		return 0;
+
+	sp[0] = aq->query_params.username;
+	sp[1] = aq->query_params.password;
+	sp[2] = aq->query_params.tls_client_cert;
+	sp[3] = aq->query_params.tls_client_key;
+	sp[4] = aq->query_params.tls_ca_path;
+	n = sizeof(sp) / sizeof(sp[0]);
+
+	/* options line: verify peer, verify host, redirect and auth method */
+	len = aq->query.len + 1 + 3 + INT2STR_MAX_LEN + 1;
+	for (i = 0 ; i < aq->query_params.headers.len ; i++)
+		len += strlen(aq->query_params.headers.t[i]) + 1;
+	/* the string options are always present and prefixed by their length,
+	 * so the values cannot be shifted from one field to another */
+	for (i = 0 ; i < n ; i++)
+		len += INT2STR_MAX_LEN + 1 + (sp[i] ? strlen(sp[i]) : 0) + 1;
+
+	key->s = (char*)pkg_malloc(len + 1);
+	if (key->s == NULL) {
+		LM_ERR("no more pkg memory\n");
+		return 0;
+	}
+	p = key->s;
+	memcpy(p, aq->query.s, aq->query.len);
+	p += aq->query.len;
+	*p++ = '\n';
+	p += sprintf(p, "%c%c%c%u\n",
+			aq->query_params.tls_verify_peer ? 'P' : '-',
+			aq->query_params.tls_verify_host ? 'H' : '-',
+			aq->query_params.follow_redirect ? 'R' : '-',
+			aq->query_params.authmethod);
+	for (i = 0 ; i < n ; i++)
+		p += sprintf(p, "%d:%s\n", sp[i] ? (int)strlen(sp[i]) : 0,
+				sp[i] ? sp[i] : "");
+	for (i = 0 ; i < aq->query_params.headers.len ; i++)
+		p += sprintf(p, "%s\n", aq->query_params.headers.t[i]);
+	key->len = p - key->s;
+
+	return 1;
+}
+
+/* answer the query from the response cache */
+static int async_query_cached(async_query_t *aq, str *key)
+{
+	struct http_m_reply reply;
+	str result = {0, 0};
+
+	if (hm_cache_get(key, core_hash(key, 0, 0), &reply.retcode, &result) != 1)
+		return 0;
+
+	LM_DBG("query [%.*s] answered from cache\n", aq->query.len, aq->query.s);
+	update_stat(cache_hits, 1);
+	memset(&reply.time, 0, sizeof(http_m_time_t));
+	reply.error[0] = '\0';
+	reply.result = &result;
+	async_http_cb(&reply, aq);
+	pkg_free(result.s);
+	return 1;
+}
+
 void notification_socket_cb(int fd, short event, void *arg)
 {
 	(void)fd; /* unused */
@@ -286,6 +372,7 @@ void notification_socket_cb(int fd, short event, void *arg)
 	http_m_params_t query_params;
 
 	str query;
+	str key = {0, 0};
 
 	if ((received = recvfrom(worker->notication_socket[0],
 			&aq, sizeof(async_query_t*),
@@ -301,6 +388,11 @@ void notification_socket_cb(int fd, short event, void *arg)
 
 	query = ((str)aq->query);
 
+	if (async_query_key(aq, &key) && hm_cache_enabled()
+			&& async_query_cached(aq, &key)) {
+		pkg_free(key.s);
+		return;
+	}
 	memset(&query_params, 0, sizeof(http_m_params_t));
 	query_params.timeout = aq->query_params.timeout;
 	query_params.follow_redirect = aq->query_params.follow_redirect;
@@ -390,12 +482,16 @@ void notification_socket_cb(int fd, short event, void *arg)
 
 	LM_DBG("query received: [%.*s] (%p)\n", query.len, query.s, aq);
 
-	if (new_request(&query, &query_params, async_http_cb, aq) < 0) {
+	if (new_request(&query, (key.s) ? &key : NULL, &query_params,
+				async_http_cb, aq) < 0) {
 		LM_ERR("Cannot create request for %.*s\n", query.len, query.s);
 		free_async_query(aq);
 	}
 
 done:
+	if (key.s) {
+		pkg_free(key.s);
+	}
 	if (query_params.tls_client_cert) {
 		shm_free(query_params.tls_client_cert);
 		query_params.tls_client_cert = NULL;
@@ -623,7 +719,14 @@ int async_push_query(async_query_t *aq)
 
 	query = ((str)aq->query);
 
-	worker = rr++ % num_workers;
+	if (coalesce_queries && !(aq->query_params.body.s && aq->query_params.body.len > 0)
+			&& (aq->query_params.method == AH_METH_DEFAULT
+				|| aq->query_params.method == AH_METH_GET)) {
+		/* same worker for identical queries, so they can be coalesced */
+		worker = core_hash(&query, 0, 0) % num_workers;
+	} else {
+		worker = rr++ % num_workers;
+	}
 	len = write(workers[worker].notication_socket[1], &aq, sizeof(async_query_t*));
 	if(len<=0) {
 		LM_ERR("failed to pass the query to async workers\n");
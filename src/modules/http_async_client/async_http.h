@@ -48,6 +48,7 @@
 #include "http_multi.h"
 
 extern int num_workers;
+extern int coalesce_queries;
 
 extern int http_timeout; /* query timeout in ms */
 extern int tcp_keepalive; 
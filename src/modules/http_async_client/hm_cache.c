@@ -0,0 +1,401 @@
+/**
+ * Copyright (C) 2021 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * This file is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ *
+ * This file is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/*! \file
+ * \brief  Kamailio http_async_client :: Shared response cache
+ * \ingroup http_async_client
+ *
+ * Replies to GET requests are kept in shared memory for the time allowed
+ * by their Cache-Control header, so all the async workers can answer
+ * identical queries without sending them again. The size of a reply and
+ * the size of the whole cache are limited, when the cache is full the
+ * oldest replies of the slot are dropped to make room for the new one.
+ */
+
+#include <string.h>
+#include <ctype.h>
+
+#include "../../core/dprint.h"
+#include "../../core/ut.h"
+#include "../../core/mem/shm_mem.h"
+#include "../../core/mem/mem.h"
+#include "../../core/atomic_ops.h"
+
+#include "hm_cache.h"
+
+int cache_size = 0;		 /* number of slots, 0 - cache disabled */
+int cache_max_ttl = 300; /* upper limit for the max-age of the replies */
+int cache_max_item_size = 65536;  /* max size of a cached reply */
+int cache_max_size = 4194304;	  /* max size of all the cached replies */
+
+static hm_cache_slot_t *_hm_cache = NULL;
+static atomic_t *_hm_cache_used = NULL; /* shm bytes used by the items */
+
+/**
+ *
+ */
+int hm_cache_init(void)
+{
+	int i;
+
+	if(cache_size <= 0) {
+		return 0;
+	}
+	if(cache_max_size <= 0 || cache_max_item_size <= 0) {
+		LM_ERR("invalid cache size limits\n");
+		return -1;
+	}
+	_hm_cache = (hm_cache_slot_t *)shm_malloc(
+			cache_size * sizeof(hm_cache_slot_t) + sizeof(atomic_t));
+	if(_hm_cache == NULL) {
+		SHM_MEM_ERROR;
+		return -1;
+	}
+	memset(_hm_cache, 0, cache_size * sizeof(hm_cache_slot_t));
+	_hm_cache_used = (atomic_t *)(_hm_cache + cache_size);
+	atomic_set(_hm_cache_used, 0);
+	for(i = 0; i < cache_size; i++) {
+		if(lock_init(&_hm_cache[i].lock) == NULL) {
+			LM_ERR("cannot init the lock for slot %d\n", i);
+			shm_free(_hm_cache);
+			_hm_cache = NULL;
+			_hm_cache_used = NULL;
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/**
+ *
+ */
+static void hm_cache_item_free(hm_cache_item_t *it)
+{
+	atomic_add(_hm_cache_used, -it->size);
+	shm_free(it);
+}
+
+/**
+ *
+ */
+void hm_cache_destroy(void)
+{
+	hm_cache_item_t *it;
+	hm_cache_item_t *it0;
+	int i;
+
+	if(_hm_cache == NULL) {
+		return;
+	}
+	for(i = 0; i < cache_size; i++) {
+		it = _hm_cache[i].first;
+		while(it) {
+			it0 = it;
+			it = it->next;
+			hm_cache_item_free(it0);
+		}
+		lock_destroy(&_hm_cache[i].lock);
+	}
+	shm_free(_hm_cache);
+	_hm_cache = NULL;
+	_hm_cache_used = NULL;
+}
+
+/**
+ *
+ */
+int hm_cache_enabled(void)
+{
+	return (_hm_cache != NULL) ? 1 : 0;
+}
+
+/**
+ * remove expired items of the slot - must be called with the slot locked
+ */
+static void hm_cache_slot_clean(hm_cache_slot_t *slot, time_t now)
+{
+	hm_cache_item_t *it;
+	hm_cache_item_t *prev;
+	hm_cache_item_t *it0;
+
+	prev = NULL;
+	it = slot->first;
+	while(it) {
+		if(it->expires <= now) {
+			it0 = it;
+			it = it->next;
+			if(prev) {
+				prev->next = it;
+			} else {
+				slot->first = it;
+			}
+			slot->esize--;
+			hm_cache_item_free(it0);
+			continue;
+		}
+		prev = it;
+		it = it->next;
+	}
+}
+
+/**
+ * look up a reply in the cache
+ * - on hit, result is a pkg copy of the reply that has to be freed by caller
+ * @return 1 on hit, 0 on miss, -1 on error
+ */
+int hm_cache_get(str *key, unsigned int hashid, long *retcode, str *result)
+{
+	hm_cache_slot_t *slot;
+	hm_cache_item_t *it;
+	time_t now;
+	int ret;
+
+	if(_hm_cache == NULL) {
+		return 0;
+	}
+	now = time(NULL);
+	slot = &_hm_cache[hashid % cache_size];
+	ret = 0;
+	lock_get(&slot->lock);
+	for(it = slot->first; it; it = it->next) {
+		if(it->hashid == hashid && it->key.len == key->len
+				&& memcmp(it->key.s, key->s, key->len) == 0) {
+			break;
+		}
+	}
+	if(it != NULL) {
+		if(it->expires <= now) {
+			hm_cache_slot_clean(slot, now);
+		} else {
+			result->s = (char *)pkg_malloc(it->result.len + 1);
+			if(result->s == NULL) {
+				PKG_MEM_ERROR;
+				ret = -1;
+			} else {
+				memcpy(result->s, it->result.s, it->result.len);
+				result->s[it->result.len] = '\0';
+				result->len = it->result.len;
+				*retcode = it->retcode;
+				ret = 1;
+			}
+		}
+	}
+	lock_release(&slot->lock);
+	return ret;
+}
+
+/**
+ * add a reply in the cache for ttl seconds
+ */
+int hm_cache_put(
+		str *key, unsigned int hashid, long retcode, str *result, int ttl)
+{
+	hm_cache_slot_t *slot;
+	hm_cache_item_t *it;
+	hm_cache_item_t *prev;
+	time_t now;
+	int len;
+
+	if(_hm_cache == NULL || ttl <= 0) {
+		return 0;
+	}
+	if(result->len > cache_max_item_size) {
+		LM_DBG("reply for [%.*s] too big to be cached (%d)\n", key->len,
+				key->s, result->len);
+		return 0;
+	}
+	len = sizeof(hm_cache_item_t) + key->len + 1 + result->len + 1;
+	it = (hm_cache_item_t *)shm_malloc(len);
+	if(it == NULL) {
+		SHM_MEM_ERROR;
+		return -1;
+	}
+	memset(it, 0, sizeof(hm_cache_item_t));
+	it->hashid = hashid;
+	it->retcode = retcode;
+	it->key.s = (char *)it + sizeof(hm_cache_item_t);
+	memcpy(it->key.s, key->s, key->len);
+	it->key.s[key->len] = '\0';
+	it->key.len = key->len;
+	it->result.s = it->key.s + key->len + 1;
+	memcpy(it->result.s, result->s, result->len);
+	it->result.s[result->len] = '\0';
+	it->result.len = result->len;
+	now = time(NULL);
+	it->expires = now + ttl;
+	it->size = len;
+
+	slot = &_hm_cache[hashid % cache_size];
+	lock_get(&slot->lock);
+	hm_cache_slot_clean(slot, now);
+	/* replace the old reply for the same key */
+	prev = NULL;
+	for(it->next = slot->first; it->next; it->next = it->next->next) {
+		if(it->next->hashid == hashid && it->next->key.len == key->len
+				&& memcmp(it->next->key.s, key->s, key->len) == 0) {
+			if(prev) {
+				prev->next = it->next->next;
+			} else {
+				slot->first = it->next->next;
+			}
+			slot->esize--;
+			hm_cache_item_free(it->next);
+			break;
+		}
+		prev = it->next;
+	}
+	/* reserve the room, dropping the oldest replies of the slot if the
+	 * cache is full */
+	if(atomic_add(_hm_cache_used, len) > cache_max_size) {
+		while(slot->first != NULL
+				&& atomic_get(_hm_cache_used) > cache_max_size) {
+			prev = NULL;
+			for(it->next = slot->first; it->next->next;
+					it->next = it->next->next) {
+				prev = it->next;
+			}
+			if(prev) {
+				prev->next = NULL;
+			} else {
+				slot->first = NULL;
+			}
+			slot->esize--;
+			hm_cache_item_free(it->next);
+		}
+		if(atomic_get(_hm_cache_used) > cache_max_size) {
+			lock_release(&slot->lock);
+			LM_DBG("cache full - reply for [%.*s] not cached\n", key->len,
+					key->s);
+			hm_cache_item_free(it);
+			return 0;
+		}
+	}
+	it->next = slot->first;
+	slot->first = it;
+	slot->esize++;
+	lock_release(&slot->lock);
+
+	LM_DBG("cached reply for [%.*s] - ttl %d\n", key->len, key->s, ttl);
+	return 0;
+}
+
+/**
+ * get the value of a cache directive with numeric argument
+ */
+static int hm_cache_directive_int(char *p, char *end)
+{
+	int v = 0;
+
+	while(p < end && (*p == ' ' || *p == '\t')) {
+		p++;
+	}
+	if(p >= end || *p != '=') {
+		return -1;
+	}
+	p++;
+	while(p < end && (*p == ' ' || *p == '\t' || *p == '"')) {
+		p++;
+	}
+	if(p >= end || !isdigit((unsigned char)*p)) {
+		return -1;
+	}
+	while(p < end && isdigit((unsigned char)*p)) {
+		v = v * 10 + (*p - '0');
+		if(v > cache_max_ttl) {
+			return cache_max_ttl;
+		}
+		p++;
+	}
+	return v;
+}
+
+/**
+ * compute the caching time of a reply from its Cache-Control header
+ * - result is the reply with headers (the last header block is used when
+ *   there are provisional replies or redirects)
+ * @return the time to live in seconds, 0 if the reply cannot be cached
+ */
+int hm_cache_ttl(str *result)
+{
+	char *p;
+	char *end;
+	char *hdrs;
+	char *hend;
+	char *v;
+	char *vend;
+	int maxage = -1;
+	int smaxage = -1;
+	int ttl;
+
+	if(result == NULL || result->s == NULL || cache_max_ttl <= 0) {
+		return 0;
+	}
+	end = result->s + result->len;
+	/* find the header block of the last response */
+	hdrs = result->s;
+	for(p = result->s; p + 4 < end; p++) {
+		if(p[0] == '\r' && p[1] == '\n' && p[2] == '\r' && p[3] == '\n') {
+			if(end - (p + 4) > 5 && strncmp(p + 4, "HTTP/", 5) == 0) {
+				hdrs = p + 4;
+				p += 3;
+				continue;
+			}
+			break;
+		}
+	}
+	hend = p;
+	for(p = hdrs; p < hend; p++) {
+		if(p[0] != '\n' || hend - p < 15
+				|| strncasecmp(p + 1, "Cache-Control:", 14) != 0) {
+			continue;
+		}
+		v = p + 15;
+		vend = v;
+		while(vend < hend && *vend != '\r' && *vend != '\n') {
+			vend++;
+		}
+		for(p = v; p < vend; p++) {
+			if(vend - p >= 8
+					&& (strncasecmp(p, "no-store", 8) == 0
+							|| strncasecmp(p, "no-cache", 8) == 0)) {
+				return 0;
+			}
+			if(vend - p >= 7 && strncasecmp(p, "private", 7) == 0) {
+				return 0;
+			}
+			if(vend - p >= 8 && strncasecmp(p, "s-maxage", 8) == 0) {
+				smaxage = hm_cache_directive_int(p + 8, vend);
+				p += 7;
+			} else if(vend - p >= 7 && strncasecmp(p, "max-age", 7) == 0
+					  && (p == v || p[-1] != '-')) {
+				maxage = hm_cache_directive_int(p + 7, vend);
+				p += 6;
+			}
+		}
+		break;
+	}
+	ttl = (smaxage >= 0) ? smaxage : maxage;
+	if(ttl <= 0) {
+		return 0;
+	}
+	return (ttl > cache_max_ttl) ? cache_max_ttl : ttl;
+}
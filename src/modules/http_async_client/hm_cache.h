@@ -0,0 +1,68 @@
+/**
+ * Copyright (C) 2021 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * This file is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ *
+ * This file is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/*! \file
+ * \brief  Kamailio http_async_client :: Shared response cache
+ * \ingroup http_async_client
+ */
+
+
+#ifndef _HM_CACHE_
+#define _HM_CACHE_
+
+#include <time.h>
+
+#include "../../core/str.h"
+#include "../../core/locking.h"
+
+extern int cache_size;
+extern int cache_max_ttl;
+extern int cache_max_item_size;
+extern int cache_max_size;
+
+typedef struct hm_cache_item
+{
+	unsigned int hashid;
+	str key;
+	long retcode;
+	str result;
+	time_t expires;
+	int size; /* shm bytes used by the item */
+	struct hm_cache_item *next;
+} hm_cache_item_t;
+
+typedef struct hm_cache_slot
+{
+	hm_cache_item_t *first;
+	unsigned int esize;
+	gen_lock_t lock;
+} hm_cache_slot_t;
+
+int hm_cache_init(void);
+void hm_cache_destroy(void);
+int hm_cache_enabled(void);
+int hm_cache_get(str *key, unsigned int hashid, long *retcode, str *result);
+int hm_cache_put(
+		str *key, unsigned int hashid, long retcode, str *result, int ttl);
+int hm_cache_ttl(str *result);
+
+#endif
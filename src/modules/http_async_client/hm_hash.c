@@ -150,10 +150,64 @@ struct http_m_cell *http_m_cell_lookup(CURL *p)
 	return 0;
 }
 
+/*!
+ * \brief Index a cell in progress by the identity of its query
+ * \return 0 on success, -1 on failure
+ */
+int link_http_m_cell_key(struct http_m_cell *cell, str *key, unsigned int khash)
+{
+	struct http_m_entry *hmt_entry;
+
+	cell->key.s = (char*)shm_malloc(key->len + 1);
+	if (cell->key.s==0) {
+		LM_ERR("no more shm mem\n");
+		return -1;
+	}
+	memcpy(cell->key.s, key->s, key->len);
+	cell->key.s[key->len] = '\0';
+	cell->key.len = key->len;
+	cell->khash = khash;
+
+	hmt_entry = &(hm_table->entries[khash & (hm_table->size-1)]);
+	cell->kprev = 0;
+	cell->knext = hmt_entry->kfirst;
+	if (hmt_entry->kfirst)
+		hmt_entry->kfirst->kprev = cell;
+	hmt_entry->kfirst = cell;
+
+	return 0;
+}
+
+/*!
+ * \brief Find a cell in progress for an identical query
+ */
+struct http_m_cell *http_m_cell_key_lookup(str *key, unsigned int khash)
+{
+	struct http_m_cell	*current_cell;
+
+	for (current_cell = hm_table->entries[khash & (hm_table->size-1)].kfirst;
+			current_cell; current_cell = current_cell->knext) {
+		if (current_cell->khash == khash && current_cell->key.len == key->len
+				&& memcmp(current_cell->key.s, key->s, key->len) == 0) {
+			return current_cell;
+		}
+	}
+	return 0;
+}
+
 void free_http_m_cell(struct http_m_cell *cell)
 {
+	struct http_m_waiter *w;
+
 	if (!cell) return;
 
+	while (cell->waiters) {
+		w = cell->waiters;
+		cell->waiters = w->next;
+		shm_free(w);
+	}
+	if (cell->key.s) shm_free(cell->key.s);
+
 	if(cell->params.headers) {
 		if(cell->params.headers) curl_slist_free_all(cell->params.headers);
 	}
@@ -97,6 +97,14 @@ typedef struct hm_params {
 	int tcp_ka_interval;
 } http_m_params_t;
 
+/*! callback of a query coalesced with an identical one in progress */
+typedef struct http_m_waiter
+{
+	http_multi_cbe_t cb;
+	void *param;
+	struct http_m_waiter *next;
+} http_m_waiter_t;
+
 typedef struct http_m_cell
 {
 	struct http_m_cell	*next;
@@ -120,6 +128,12 @@ typedef struct http_m_cell
 	http_multi_cbe_t cb;
 	void *param;
 
+	str key;			 /* query identity for coalescing, if any */
+	unsigned int khash;
+	struct http_m_cell *knext;
+	struct http_m_cell *kprev;
+	struct http_m_waiter *waiters;
+
 	struct http_m_reply *reply;
 } http_m_cell_t;
 
@@ -127,6 +141,7 @@ typedef struct http_m_entry
 {
 	struct http_m_cell 	*first;
 	struct http_m_cell 	*last;
+	struct http_m_cell 	*kfirst; /* cells in progress indexed by key */
 } http_m_entry_t;
 
 /*! main http multi table */
@@ -141,6 +156,8 @@ struct http_m_cell* build_http_m_cell(void *p);
 void link_http_m_cell(struct http_m_cell *cell);
 struct http_m_cell *http_m_cell_lookup(CURL *p);
 void free_http_m_cell(struct http_m_cell *cell);
+int link_http_m_cell_key(struct http_m_cell *cell, str *key, unsigned int khash);
+struct http_m_cell *http_m_cell_key_lookup(str *key, unsigned int khash);
 
 static inline void unlink_http_m_cell(struct http_m_cell *hmt_cell)
 {
@@ -158,6 +175,18 @@ static inline void unlink_http_m_cell(struct http_m_cell *hmt_cell)
 			hmt_entry->first = hmt_cell->next;
 
 		hmt_cell->next = hmt_cell->prev = 0;
+
+		if (hmt_cell->key.s) {
+			/* not anymore a target for coalescing */
+			hmt_entry = &(hm_table->entries[hmt_cell->khash & (hm_table->size-1)]);
+			if (hmt_cell->knext)
+				hmt_cell->knext->kprev = hmt_cell->kprev;
+			if (hmt_cell->kprev)
+				hmt_cell->kprev->knext = hmt_cell->knext;
+			else if (hmt_entry->kfirst == hmt_cell)
+				hmt_entry->kfirst = hmt_cell->knext;
+			hmt_cell->knext = hmt_cell->kprev = 0;
+		}
 	}
 	return;
 }
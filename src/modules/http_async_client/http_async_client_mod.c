@@ -57,6 +57,7 @@
 
 
 #include "async_http.h"
+#include "hm_cache.h"
 
 MODULE_VERSION
 
@@ -70,6 +71,8 @@ int tcp_keepalive = 0; /* TCP keepalives (default disabled) */
 int tcp_ka_idle = 0; /* TCP keep-alive idle time wait */
 int tcp_ka_interval = 0; /* TCP keep-alive interval */
 int hash_size = 2048;
+int coalesce_queries = 0; /* share the reply of identical GET queries */
+int max_host_connections = 0; /* per host connections limit of a worker */
 int tls_version = 0; // Use default SSL version in HTTPS requests (see curl/curl.h)
 int tls_verify_host = 1; // By default verify host in HTTPS requests
 int tls_verify_peer = 1; // By default verify peer in HTTPS requests
@@ -120,6 +123,8 @@ stat_var *requests;
 stat_var *replies;
 stat_var *errors;
 stat_var *timeouts;
+stat_var *coalesced;
+stat_var *cache_hits;
 
 enum http_req_name_t {
 	E_HRN_ALL = 0,
@@ -160,6 +165,12 @@ static param_export_t params[]={
 	{"tcp_keepalive",	    INT_PARAM,		&tcp_keepalive},
 	{"tcp_ka_idle",	        INT_PARAM,		&tcp_ka_idle},
 	{"tcp_ka_interval",	    INT_PARAM,		&tcp_ka_interval},
+	{"coalesce_queries",	INT_PARAM,		&coalesce_queries},
+	{"cache_size",			INT_PARAM,		&cache_size},
+	{"cache_max_ttl",		INT_PARAM,		&cache_max_ttl},
+	{"cache_max_item_size",	INT_PARAM,		&cache_max_item_size},
+	{"cache_max_size",		INT_PARAM,		&cache_max_size},
+	{"max_host_connections",	INT_PARAM,		&max_host_connections},
 	{0, 0, 0}
 };
 
@@ -169,6 +180,8 @@ stat_export_t mod_stats[] = {
         {"replies", 	STAT_NO_RESET, &replies 	},
         {"errors",      STAT_NO_RESET, &errors       	},
         {"timeouts",    STAT_NO_RESET, &timeouts	},
+        {"coalesced",   STAT_NO_RESET, &coalesced	},
+        {"cache_hits",  STAT_NO_RESET, &cache_hits	},
         {0, 0, 0}
 };
 
@@ -301,6 +314,12 @@ static int mod_init(void)
 		memset(&tmb, 0, sizeof(tm_api_t));
 	}
 
+	/* init the shared response cache */
+	if (hm_cache_init() < 0) {
+		LM_ERR("failed to init the response cache\n");
+		return -1;
+	}
+
 	/* allocate workers array */
 	workers = shm_malloc(num_workers * sizeof(*workers));
 	if(workers == NULL) {
@@ -390,6 +409,7 @@ static int child_init(int rank)
  */
 static void mod_destroy(void)
 {
+	hm_cache_destroy();
 }
 
 /**
@@ -33,6 +33,7 @@
 #include "../../core/ut.h"
 #include "../../core/hashes.h"
 #include "http_multi.h"
+#include "hm_cache.h"
 
 extern int hash_size;
 /*! global http multi table */
@@ -292,6 +293,20 @@ size_t write_cb(void *ptr, size_t size, size_t nmemb, void *data)
 	return realsize;
 }
 
+/* run the callbacks of the queries coalesced with the one of the cell */
+static void http_m_run_waiters(struct http_m_cell *cell, struct http_m_reply *reply)
+{
+	struct http_m_waiter *w;
+
+	while (cell->waiters) {
+		w = cell->waiters;
+		cell->waiters = w->next;
+		LM_DBG("coalesced query reply for cell %p (param=%p)\n", cell, w->param);
+		w->cb(reply, w->param);
+		shm_free(w);
+	}
+}
+
 void reply_error(struct http_m_cell *cell)
 {
 	struct http_m_reply *reply;
@@ -315,6 +330,7 @@ void reply_error(struct http_m_cell *cell)
 
 	if (cell) {
 		cell->cb(reply, cell->param);
+		http_m_run_waiters(cell, reply);
 	}
 
 	pkg_free(reply);
@@ -403,11 +419,18 @@ int init_http_multi(struct event_base *evbase, struct http_m_global *wg)
 	curl_multi_setopt(g->multi, CURLMOPT_TIMERFUNCTION, multi_timer_cb);
 	curl_multi_setopt(g->multi, CURLMOPT_TIMERDATA, g);
 	curl_multi_setopt(g->multi, CURLMOPT_PIPELINING, CURLPIPE_NOTHING);
+#if LIBCURL_VERSION_NUM >= 0x071e00
+	if (max_host_connections > 0) {
+		/* the requests over the limit are queued by libcurl */
+		curl_multi_setopt(g->multi, CURLMOPT_MAX_HOST_CONNECTIONS,
+				(long)max_host_connections);
+	}
+#endif
 
 	return init_http_m_table(hash_size);
 }
 
-int new_request(str *query, http_m_params_t *query_params, http_multi_cbe_t cb, void *param)
+int new_request(str *query, str *key, http_m_params_t *query_params, http_multi_cbe_t cb, void *param)
 {
 
 	LM_DBG("received query %.*s with timeout %d, tls_verify_peer %d, tls_verify_host %d (param=%p)\n", 
@@ -417,12 +440,40 @@ int new_request(str *query, http_m_params_t *query_params, http_multi_cbe_t cb,
 	CURLMcode rc;
 
 	struct http_m_cell *cell;
+	struct http_m_waiter *w;
+	unsigned int khash = 0;
 
 	update_stat(requests, 1);
 
 	easy = NULL;
 	cell = NULL;
 
+	if (key && key->len > 0) {
+		khash = core_hash(key, 0, 0);
+		if (coalesce_queries)
+			cell = http_m_cell_key_lookup(key, khash);
+		if (cell) {
+			/* identical query in progress - wait for its reply */
+			w = (struct http_m_waiter*)shm_malloc(sizeof(struct http_m_waiter));
+			if (w == NULL) {
+				LM_ERR("no more shm mem\n");
+				update_stat(errors, 1);
+				return -1;
+			}
+			w->cb = cb;
+			w->param = param;
+			w->next = cell->waiters;
+			cell->waiters = w;
+			if (query_params->headers) {
+				curl_slist_free_all(query_params->headers);
+				query_params->headers = NULL;
+			}
+			update_stat(coalesced, 1);
+			LM_DBG("query %.*s coalesced with cell %p\n", query->len, query->s, cell);
+			return 0;
+		}
+	}
+
 	easy = curl_easy_init();
 	if (!easy) {
 		LM_ERR("curl_easy_init() failed!\n");
@@ -441,6 +492,14 @@ int new_request(str *query, http_m_params_t *query_params, http_multi_cbe_t cb,
 
 	link_http_m_cell(cell);
 
+	if (key && key->len > 0 && link_http_m_cell_key(cell, key, khash) < 0) {
+		unlink_http_m_cell(cell);
+		free_http_m_cell(cell);
+		curl_easy_cleanup(easy);
+		update_stat(errors, 1);
+		return -1;
+	}
+
 	cell->global = g;
 	cell->easy=easy;
 	cell->error[0] = '\0';
@@ -557,6 +616,7 @@ error:
 		LM_DBG("cleaning up curl handler %p\n", easy);
 		curl_easy_cleanup(easy);
     }
+    unlink_http_m_cell(cell);
     free_http_m_cell(cell);
     return -1;
 }
@@ -607,7 +667,14 @@ void check_multi_info(struct http_m_global *g)
 					cell->reply->time.starttransfer=(uint32_t)(tmp_time*1000000);
 				
 				cell->reply->error[0] = '\0';
+				if (cell->key.s && cell->reply->retcode == 200
+						&& hm_cache_enabled()) {
+					hm_cache_put(&cell->key, cell->khash, cell->reply->retcode,
+							cell->reply->result,
+							hm_cache_ttl(cell->reply->result));
+				}
 				cell->cb(cell->reply, cell->param);
+				http_m_run_waiters(cell, cell->reply);
 
 				LM_DBG("reply: [%d] %.*s [%d]\n", (int)cell->reply->retcode, cell->reply->result->len, cell->reply->result->s, cell->reply->result->len);
 				update_stat(replies, 1);
@@ -70,6 +70,7 @@ typedef struct raw_http_client_conn
 	int http_follow_redirect;
 	int authmethod;
 	int keep_connections;
+	int http2;
 
 	struct raw_http_client_conn *next;
 } raw_http_client_conn_t;
@@ -110,6 +111,7 @@ static cfg_option_t http_client_options[] = {
 		{"httpproxyport", .f = cfg_parse_int_opt},						/* 15 */
 		{"authmethod", .f = cfg_parse_int_opt},							/* 16 */
 		{"keepconnections", .f = cfg_parse_int_opt},					/* 17 */
+		{"http2", .f = cfg_parse_bool_opt},								/* 18 */
 		{0}};
 
 /*! Count the number of connections 
@@ -227,6 +229,7 @@ int curl_parse_param(char *val)
 	unsigned int tlsversion = default_tls_version;
 	unsigned int authmethod = default_authmethod;
 	unsigned int keep_connections = default_keep_connections;
+	unsigned int http2 = default_http2;
 
 	str in;
 	char *p;
@@ -485,6 +488,16 @@ int curl_parse_param(char *val)
 				ciphersuites = tok;
 				LM_DBG("curl [%.*s] - cipher_suites [%.*s]\n", pit->name.len,
 						pit->name.s, ciphersuites.len, ciphersuites.s);
+			} else if(pit->name.len == 5
+					  && strncmp(pit->name.s, "http2", 5) == 0) {
+				if(str2int(&tok, &http2) != 0 || (http2 != 0 && http2 != 1)) {
+					LM_WARN("curl connection [%.*s]: http2 bad value. "
+							"Using default\n",
+							name.len, name.s);
+					http2 = default_http2;
+				}
+				LM_DBG("curl [%.*s] - http2 [%d]\n", pit->name.len,
+						pit->name.s, http2);
 			} else {
 				LM_ERR("curl Unknown parameter [%.*s] \n", pit->name.len,
 						pit->name.s);
@@ -508,6 +521,7 @@ int curl_parse_param(char *val)
 	cc->schema = schema;
 	cc->authmethod = authmethod;
 	cc->keep_connections = keep_connections;
+	cc->http2 = http2;
 	cc->failover = failover;
 	cc->useragent = as_asciiz(&useragent);
 	cc->url = url;
@@ -619,6 +633,7 @@ int curl_parse_conn(void *param, cfg_parser_t *parser, unsigned int flags)
 	raw_cc->tlsversion = default_tls_version;
 	raw_cc->authmethod = default_authmethod;
 	raw_cc->keep_connections = default_keep_connections;
+	raw_cc->http2 = default_http2;
 
 	for(i = 0; tls_versions[i].name; i++) {
 		tls_versions[i].param = &raw_cc->tlsversion;
@@ -642,6 +657,7 @@ int curl_parse_conn(void *param, cfg_parser_t *parser, unsigned int flags)
 	http_client_options[15].param = &raw_cc->http_proxy_port;
 	http_client_options[16].param = &raw_cc->authmethod;
 	http_client_options[17].param = &raw_cc->keep_connections;
+	http_client_options[18].param = &raw_cc->http2;
 
 	cfg_set_options(parser, http_client_options);
 
@@ -718,6 +734,7 @@ int fixup_raw_http_client_conn_list(void)
 		cc->maxdatasize = raw_cc->maxdatasize;
 		cc->http_follow_redirect = raw_cc->http_follow_redirect;
 		cc->keep_connections = raw_cc->keep_connections;
+		cc->http2 = raw_cc->http2;
 
 		LM_DBG("cname: [%.*s] url: [%.*s] username [%s] password [%s] failover "
 			   "[%.*s] timeout [%d] useragent [%s] maxdatasize [%d]\n",
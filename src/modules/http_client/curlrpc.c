@@ -78,8 +78,60 @@ static void curl_rpc_listcon(rpc_t *rpc, void *ctx)
 	return;
 }
 
+static const char *curl_rpc_poolstats_doc[2] = {
+		"List the curl handle and connection reuse stats per connection", 0};
+
+
+/*
+ * RPC command to print the reuse stats of the connection definitions
+ */
+static void curl_rpc_poolstats(rpc_t *rpc, void *ctx)
+{
+	void *th;
+	void *rh;
+	curl_con_t *cc;
+
+	cc = _curl_con_root;
+	if(cc == NULL) {
+		LM_ERR("no connection definitions\n");
+		rpc->fault(ctx, 500, "No Connection Definitions");
+		return;
+	}
+
+	/* add entry node */
+	if(rpc->add(ctx, "{", &th) < 0) {
+		rpc->fault(ctx, 500, "Internal error root reply");
+		return;
+	}
+
+	while(cc) {
+		if(rpc->struct_add(th, "{", "CONNECTION", &rh) < 0) {
+			rpc->fault(ctx, 500, "Internal error set structure");
+			return;
+		}
+
+		if(rpc->struct_add(rh, "Sddduuuu", "NAME", &cc->name, "KEEP",
+				   (int)cc->keep_connections, "HTTP2", (int)cc->http2,
+				   "SHARE", (int)default_share_handles, "REQUESTS",
+				   (unsigned int)counter_get_val(cc->cnt_requests),
+				   "HANDLE_REUSE",
+				   (unsigned int)counter_get_val(cc->cnt_hreuse),
+				   "CONN_NEW", (unsigned int)counter_get_val(cc->cnt_cnew),
+				   "CONN_REUSE",
+				   (unsigned int)counter_get_val(cc->cnt_creuse))
+				< 0) {
+			rpc->fault(ctx, 500, "Internal error set structure");
+			return;
+		}
+		cc = cc->next;
+	}
+	return;
+}
+
 rpc_export_t curl_rpc_cmds[] = {
 		{"httpclient.listcon", curl_rpc_listcon, curl_rpc_listcon_doc, 0},
+		{"httpclient.poolstats", curl_rpc_poolstats, curl_rpc_poolstats_doc,
+				0},
 		{0, 0, 0, 0}};
 
 /**
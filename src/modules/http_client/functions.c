@@ -68,9 +68,14 @@ typedef struct
 	unsigned int oneline;
 	unsigned int maxdatasize;
 	unsigned int keep_connections;
+	unsigned int http2;
+	curl_con_t *conn;
 	curl_con_pkg_t *pconn;
 } curl_query_t;
 
+/*! Per-process curl handle for the requests without connection definition */
+static CURL *_curl_phandle = NULL;
+
 
 /*
  * curl write function that saves received data as zero terminated
@@ -109,6 +114,24 @@ size_t write_function(void *ptr, size_t size, size_t nmemb, void *stream_ptr)
 }
 
 
+/*! Keep the curl handle for the next request of the process or close it
+ */
+static void curl_release_handle(CURL *curl, const curl_query_t *const params)
+{
+	if(params->pconn) {
+		if(params->keep_connections) {
+			params->pconn->curl = curl; /* Save connection, don't close */
+			return;
+		}
+	} else if(default_share_handles) {
+		_curl_phandle = curl;
+		return;
+	}
+	/* Cleanup and close - bye bye and thank you for all the bytes. With the
+	 * share handle, the network connection stays in the process cache */
+	curl_easy_cleanup(curl);
+}
+
 /*! Send query to server, optionally post data.
  */
 static int curL_request_url(struct sip_msg *_m, const char *_met,
@@ -123,6 +146,8 @@ static int curL_request_url(struct sip_msg *_m, const char *_met,
 	str rval = STR_NULL;
 	double download_size = 0;
 	struct curl_slist *headerlist = NULL;
+	CURLSH *share = NULL;
+	int hreuse = 0;
 
 	memset(&stream, 0, sizeof(curl_res_stream_t));
 	stream.max_size = (size_t)params->maxdatasize;
@@ -137,7 +162,14 @@ static int curL_request_url(struct sip_msg *_m, const char *_met,
 				   "possible\n");
 			curl = params->pconn->curl; /* Reuse existing handle */
 			curl_easy_reset(curl);		/* Reset handle */
+			params->pconn->curl = NULL;
+			hreuse = 1;
 		}
+	} else if(_curl_phandle != NULL) {
+		curl = _curl_phandle; /* Reuse the process handle */
+		curl_easy_reset(curl);
+		_curl_phandle = NULL;
+		hreuse = 1;
 	}
 
 
@@ -158,6 +190,23 @@ static int curL_request_url(struct sip_msg *_m, const char *_met,
 	res = curl_easy_setopt(
 			curl, CURLOPT_REDIR_PROTOCOLS, CURLPROTO_HTTP | CURLPROTO_HTTPS);
 
+	share = curl_share_get();
+	if(share != NULL) {
+		/* DNS cache, TLS sessions and connections common to the process */
+		res |= curl_easy_setopt(curl, CURLOPT_SHARE, share);
+	}
+	if(params->http2) {
+#if LIBCURL_VERSION_NUM >= 0x072f00
+		/* not added to res - libcurl without HTTP/2 support falls back
+		 * to HTTP/1.1 */
+		curl_easy_setopt(
+				curl, CURLOPT_HTTP_VERSION, (long)CURL_HTTP_VERSION_2TLS);
+		/* wait for a connection that can be multiplexed instead of
+		 * opening a new one */
+		curl_easy_setopt(curl, CURLOPT_PIPEWAIT, 1L);
+#endif
+	}
+
 	if(_met != NULL) {
 		/* Enforce method (GET, PUT, ...) */
 		res |= curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, _met);
@@ -281,6 +330,23 @@ static int curL_request_url(struct sip_msg *_m, const char *_met,
 			params->pconn->querytime = totaltime;
 			params->pconn->connecttime = connecttime;
 		}
+		if(params->conn) {
+			long nconn = 0;
+
+			counter_inc(params->conn->cnt_requests);
+			if(hreuse) {
+				counter_inc(params->conn->cnt_hreuse);
+			}
+			if(res == CURLE_OK
+					&& curl_easy_getinfo(curl, CURLINFO_NUM_CONNECTS, &nconn)
+							   == CURLE_OK) {
+				if(nconn > 0) {
+					counter_inc(params->conn->cnt_cnew);
+				} else {
+					counter_inc(params->conn->cnt_creuse);
+				}
+			}
+		}
 	}
 
 	/* Cleanup */
@@ -331,12 +397,7 @@ static int curL_request_url(struct sip_msg *_m, const char *_met,
 		if(params->pconn) {
 			params->pconn->last_result = res;
 		}
-		if(params->pconn && params->keep_connections) {
-			params->pconn->curl = curl; /* Save connection, don't close */
-		} else {
-			/* Cleanup and close - bye bye and thank you for all the bytes */
-			curl_easy_cleanup(curl);
-		}
+		curl_release_handle(curl, params);
 		if(stream.buf) {
 			pkg_free(stream.buf);
 		}
@@ -436,17 +497,17 @@ static int curL_request_url(struct sip_msg *_m, const char *_met,
 			if(params->failovercon != NULL) {
 				LM_ERR("FAILURE: Trying failover to curl con (%s)\n",
 						params->failovercon);
+				curl_release_handle(curl, params);
+				if(stream.buf != NULL) {
+					pkg_free(stream.buf);
+				}
 				return (1000 + stat);
 			}
 		}
 	}
 
 	/* CURLcode curl_easy_getinfo(CURL *curl, CURLINFO info, ... ); */
-	if(params->pconn && params->keep_connections) {
-		params->pconn->curl = curl; /* Save connection, don't close */
-	} else {
-		curl_easy_cleanup(curl);
-	}
+	curl_release_handle(curl, params);
 	if(stream.buf != NULL) {
 		pkg_free(stream.buf);
 	}
@@ -582,6 +643,7 @@ int curl_con_query_url_f(struct sip_msg *_m, const str *connection,
 	query_params.timeout = conn->timeout;
 	query_params.http_follow_redirect = conn->http_follow_redirect;
 	query_params.keep_connections = conn->keep_connections;
+	query_params.http2 = conn->http2;
 	query_params.oneline = 0;
 	query_params.maxdatasize = maxdatasize;
 	query_params.netinterface = default_netinterface;
@@ -590,6 +652,7 @@ int curl_con_query_url_f(struct sip_msg *_m, const str *connection,
 		failovercon = as_asciiz(&conn->failover);
 	}
 	query_params.failovercon = failovercon;
+	query_params.conn = conn;
 	query_params.pconn = pconn;
 	if(conn->http_proxy) {
 		query_params.http_proxy = conn->http_proxy;
@@ -661,6 +724,7 @@ int http_client_request_c(sip_msg_t *_m, char *_url, str *_dst, char *_body,
 	query_params.verify_host = default_tls_verify_host;
 	query_params.timeout = default_connection_timeout;
 	query_params.http_follow_redirect = default_http_follow_redirect;
+	query_params.http2 = default_http2;
 	query_params.oneline = default_query_result;
 	query_params.maxdatasize = default_query_maxdatasize;
 	query_params.netinterface = default_netinterface;
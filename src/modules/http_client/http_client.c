@@ -93,6 +93,9 @@ unsigned int default_http_follow_redirect =
 		0; /*!< Follow HTTP redirects CURLOPT_FOLLOWLOCATION */
 unsigned int default_keep_connections =
 		0; /*!< Keep http connections open for reuse */
+unsigned int default_http2 = 0; /*!< Negotiate HTTP/2 with the servers */
+unsigned int default_share_handles =
+		1; /*!< Share DNS, TLS sessions and connections in a process */
 str default_useragent = {CURL_USER_AGENT,
 		CURL_USER_AGENT_LEN}; /*!< Default CURL useragent. Default "Kamailio Curl " */
 unsigned int default_maxdatasize = 0; /*!< Default download size. 0=disabled */
@@ -113,6 +116,8 @@ str http_client_config_file = STR_NULL;
 
 static curl_version_info_data *curl_info;
 
+static CURLSH *_curl_share = NULL; /*!< Per-process curl share handle */
+
 /* Module management function prototypes */
 static int mod_init(void);
 static int child_init(int);
@@ -209,6 +214,8 @@ static param_export_t params[] = {
 	{"httpcon",  PARAM_STRING|USE_FUNC_PARAM, (void*)curl_con_param},
 	{"authmethod", PARAM_INT, &default_authmethod },
 	{"keep_connections", PARAM_INT, &default_keep_connections },
+	{"http2", PARAM_INT, &default_http2 },
+	{"share_handles", PARAM_INT, &default_share_handles },
 	{"query_result", PARAM_INT, &default_query_result },
 	{"query_maxdatasize", PARAM_INT, &default_query_maxdatasize },
 	{"netinterface", PARAM_STRING,  &default_netinterface },
@@ -268,6 +275,76 @@ static void curl_counter_init()
 			"Counter of failed connections (not 200 OK)", 0);
 }
 
+/* Init the counters of each connection definition */
+static int curl_con_counter_init(void)
+{
+	curl_con_t *cc;
+	char cname[128];
+
+	for(cc = _curl_con_root; cc != NULL; cc = cc->next) {
+		snprintf(cname, sizeof(cname), "%.*s_requests", cc->name.len,
+				cc->name.s);
+		if(counter_register(&cc->cnt_requests, "httpclient", cname, 0, 0, 0,
+				   "Requests sent over the connection", 0)
+				< 0) {
+			return -1;
+		}
+		snprintf(cname, sizeof(cname), "%.*s_handle_reuse", cc->name.len,
+				cc->name.s);
+		if(counter_register(&cc->cnt_hreuse, "httpclient", cname, 0, 0, 0,
+				   "Requests done with a curl handle kept in the process", 0)
+				< 0) {
+			return -1;
+		}
+		snprintf(cname, sizeof(cname), "%.*s_conn_new", cc->name.len,
+				cc->name.s);
+		if(counter_register(&cc->cnt_cnew, "httpclient", cname, 0, 0, 0,
+				   "Requests that opened a new network connection", 0)
+				< 0) {
+			return -1;
+		}
+		snprintf(cname, sizeof(cname), "%.*s_conn_reuse", cc->name.len,
+				cc->name.s);
+		if(counter_register(&cc->cnt_creuse, "httpclient", cname, 0, 0, 0,
+				   "Requests that reused an open network connection", 0)
+				< 0) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/*! Returns the per-process curl share handle, created at first use
+ *
+ * The share handle makes the DNS cache, the TLS session ids and (with
+ * libcurl >= 7.57.0) the connection cache common to all curl handles of
+ * the process, so requests to the same server reuse the open connections
+ * and TLS sessions even when the curl handle is not kept.
+ * Kamailio processes are single threaded, therefore no lock functions
+ * are set.
+ */
+CURLSH *curl_share_get(void)
+{
+	if(default_share_handles == 0) {
+		return NULL;
+	}
+	if(_curl_share != NULL) {
+		return _curl_share;
+	}
+	_curl_share = curl_share_init();
+	if(_curl_share == NULL) {
+		LM_ERR("failed to init curl share handle\n");
+		default_share_handles = 0;
+		return NULL;
+	}
+	curl_share_setopt(_curl_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+	curl_share_setopt(_curl_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x073900
+	curl_share_setopt(_curl_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
+	return _curl_share;
+}
+
 
 /* Module initialization function */
 static int mod_init(void)
@@ -293,7 +370,6 @@ static int mod_init(void)
 	}
 
 	curl_counter_init();
-	counter_add(connections, curl_connection_count());
 
 	if(default_tls_version >= CURL_SSLVERSION_LAST) {
 		LM_WARN("tlsversion %d unsupported value. Using libcurl default\n",
@@ -308,6 +384,12 @@ static int mod_init(void)
 		}
 	}
 
+	counter_add(connections, curl_connection_count());
+	if(curl_con_counter_init() < 0) {
+		LM_ERR("failed to register the connection counters\n");
+		return -1;
+	}
+
 	if(default_connection_timeout == 0) {
 		LM_ERR("CURL connection timeout set to zero. Using default 4 secs\n");
 		default_connection_timeout = 4;
@@ -339,6 +421,8 @@ static int mod_init(void)
 	LM_DBG("**** init http_client: Auth method: %d \n", default_authmethod);
 	LM_DBG("**** init http_client: Keep Connections open: %d \n",
 			default_keep_connections);
+	LM_DBG("**** init http_client: HTTP/2: %d Share handles: %d\n",
+			default_http2, default_share_handles);
 
 	LM_DBG("**** Extra: Curl supports %s %s %s \n",
 			(curl_info->features & CURL_VERSION_SSL ? "TLS" : ""),
@@ -377,6 +461,10 @@ static int child_init(int rank)
 static void destroy(void)
 {
 	/* Cleanup curl */
+	if(_curl_share != NULL) {
+		curl_share_cleanup(_curl_share);
+		_curl_share = NULL;
+	}
 	curl_global_cleanup();
 	destroy_shmlock();
 }
@@ -62,6 +62,9 @@ extern unsigned int
 		default_authmethod; /*!< authentication method - Basic, Digest or both */
 extern unsigned int
 		default_keep_connections; /*!< Keep http connections open for reuse */
+extern unsigned int default_http2; /*!< Negotiate HTTP/2 with the servers */
+extern unsigned int
+		default_share_handles; /*!< Share DNS, TLS sessions and connections */
 extern unsigned int default_query_result; /*!< Default query result mode */
 extern unsigned int default_query_maxdatasize; /*!< Default query result maximum download size */
 
@@ -112,12 +115,17 @@ typedef struct _curl_con
 	unsigned int verify_host; /*!< TRUE if server CN/SAN to be verified */
 	int http_follow_redirect; /*!< TRUE if we should follow HTTP 302 redirects */
 	unsigned int keep_connections; /*!< TRUE to keep curl connections open */
+	unsigned int http2;			   /*!< TRUE to negotiate HTTP/2 */
 	unsigned int port;			   /*!< The port to connect to */
 	int timeout;				   /*!< Timeout for this connection */
 	unsigned int maxdatasize;	  /*!< Maximum data download on GET or POST */
 	curl_res_stream_t *stream;	 /*!< Curl stream */
 	char *http_proxy;			   /*!< HTTP proxy for this connection */
 	unsigned int http_proxy_port;  /*!< HTTP proxy port for this connection */
+	counter_handle_t cnt_requests; /*!< Requests sent over this connection */
+	counter_handle_t cnt_hreuse;   /*!< Requests done with a kept curl handle */
+	counter_handle_t cnt_cnew;	 /*!< Requests that opened a new connection */
+	counter_handle_t cnt_creuse;   /*!< Requests that reused a connection */
 	struct _curl_con *next;		   /*!< next connection */
 } curl_con_t;
 
@@ -141,6 +149,9 @@ typedef struct _curl_con_pkg
 	struct _curl_con_pkg *next; /*!< next connection */
 } curl_con_pkg_t;
 
+/*! Returns the per-process curl share handle */
+extern CURLSH *curl_share_get(void);
+
 /*! Returns true if CURL supports TLS */
 extern int curl_support_tls();
 
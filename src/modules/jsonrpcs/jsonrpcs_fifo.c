@@ -428,6 +428,42 @@ error:
 	return 0;
 }
 
+typedef struct jsonrpc_fifo_stream {
+	str *rpath;          /* reply fifo name */
+	FILE *reply_stream;  /* opened with the first chunk */
+} jsonrpc_fifo_stream_t;
+
+/* write a chunk of a streamed reply to the reply fifo */
+static int jsonrpc_fifo_stream_write(void *sparam, char *buf, int len,
+		int last)
+{
+	jsonrpc_fifo_stream_t *fs;
+	int nw;
+
+	fs = (jsonrpc_fifo_stream_t*)sparam;
+	if(fs->reply_stream==NULL) {
+		if(fs->rpath->len<=0) {
+			LM_ERR("no reply fifo for the streamed reply\n");
+			return -1;
+		}
+		fs->reply_stream = jsonrpc_open_reply_fifo(fs->rpath);
+		if (fs->reply_stream==NULL) {
+			LM_ERR("cannot open reply fifo: %.*s\n", fs->rpath->len,
+					fs->rpath->s);
+			return -1;
+		}
+	}
+	if(len>0) {
+		nw = fwrite(buf, 1, len, fs->reply_stream);
+		if(nw < len) {
+			LM_ERR("failed to write the reply chunk to fifo: %d out of %d\n",
+					nw, len);
+			return -1;
+		}
+	}
+	return 0;
+}
+
 #define JSONRPC_BUF_IN_SIZE	8192
 static void jsonrpc_fifo_server(FILE *fifo_stream)
 {
@@ -439,6 +475,7 @@ static void jsonrpc_fifo_server(FILE *fifo_stream)
 	str srpath;
 	int nw;
 	jsonrpc_plain_reply_t* jr = NULL;
+	jsonrpc_fifo_stream_t fstream;
 
 	while(1) {
 		/* update the local config framework structures */
@@ -457,7 +494,17 @@ static void jsonrpc_fifo_server(FILE *fifo_stream)
 		LM_DBG("preparing to execute fifo jsonrpc [%.*s]\n", scmd.len, scmd.s);
 		srpath.s = buf_rpath;
 		srpath.len = 128;
-		if(jsonrpc_exec_ex(&scmd, &srpath)<0) {
+		fstream.rpath = &srpath;
+		fstream.reply_stream = NULL;
+		nw = jsonrpc_exec_stream(&scmd, &srpath,
+				(jsonrpc_stream_reply & 2)?jsonrpc_fifo_stream_write:NULL,
+				&fstream);
+		if(fstream.reply_stream!=NULL) {
+			/* reply was streamed */
+			fclose(fstream.reply_stream);
+			continue;
+		}
+		if(nw<0) {
 			LM_ERR("failed to execute the json document from fifo stream\n");
 			continue;
 		}
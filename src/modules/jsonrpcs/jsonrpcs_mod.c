@@ -42,6 +42,7 @@
 #include "../../core/cfg/cfg_struct.h"
 #include "../../core/resolve.h"
 #include "../../core/ip_addr.h"
+#include "../../core/forward.h"
 #include "../../core/sip_msg_clone.h"
 #include "../../core/data_lump.h"
 #include "../../core/data_lump_rpl.h"
@@ -78,6 +79,10 @@ static int jsonrpc_transport = 6; /* fifo + datagram */
 
 static int jsonrpc_pretty_format = 1;
 
+/*!< streamed replies: 0 - disabled; 1 - http; 2 - fifo; 4 - datagram */
+int jsonrpc_stream_reply = 0;
+int jsonrpc_stream_chunk_size = 16384;
+
 static int jsonrpc_register_rpc(void);
 
 static int mod_init(void);
@@ -161,6 +166,8 @@ static param_export_t params[] = {
 	{"dgram_group",      PARAM_INT,    &jsonrpc_dgram_unix_socket_gid},
 	{"dgram_user",       PARAM_STRING, &jsonrpc_dgram_unix_socket_uid_s},
 	{"dgram_user",       PARAM_INT,    &jsonrpc_dgram_unix_socket_uid},
+	{"stream_reply",     PARAM_INT,    &jsonrpc_stream_reply},
+	{"stream_chunk_size", PARAM_INT,   &jsonrpc_stream_chunk_size},
 
 	{0, 0, 0}
 };
@@ -220,6 +227,7 @@ static void jsonrpc_set_plain_reply(int rcode, str *rtext, str *rbody,
 	}
 	_jsonrpc_plain_reply.rcode = rcode;
 	_jsonrpc_plain_reply.rtext = *rtext;
+	_jsonrpc_plain_reply.streamed = 0;
 	if(rbody) {
 		_jsonrpc_plain_reply.rbody = *rbody;
 	} else {
@@ -321,6 +329,399 @@ static void jsonrpc_fault(jsonrpc_ctx_t* ctx, int code, char* fmt, ...)
 }
 
 
+/** Builds the error object of the reply for the fault set in context.
+ */
+static srjson_t *jsonrpc_fault_node(jsonrpc_ctx_t* ctx)
+{
+	srjson_t *nj = NULL;
+	int i;
+
+	nj = srjson_CreateObject(ctx->jrpl);
+	if(nj==NULL) {
+		return NULL;
+	}
+	srjson_AddNumberToObject(ctx->jrpl, nj, "code",
+			ctx->error_code);
+	for(i=0; _jsonrpc_error_table[i].code!=0
+			&& _jsonrpc_error_table[i].code!=ctx->error_code; i++);
+	if(_jsonrpc_error_table[i].code!=0) {
+		srjson_AddStrStrToObject(ctx->jrpl, nj,
+			"message", 7,
+			_jsonrpc_error_table[i].text.s,
+			_jsonrpc_error_table[i].text.len);
+	} else {
+		if(ctx->error_text.len>0) {
+			srjson_AddStrStrToObject(ctx->jrpl, nj,
+					"message", 7,
+					ctx->error_text.s, ctx->error_text.len);
+		} else {
+			srjson_AddStrStrToObject(ctx->jrpl, nj,
+					"message", 7, "Unexpected Error", 16);
+		}
+	}
+	return nj;
+}
+
+
+/** Appends data to the buffer of a streamed reply.
+ */
+static int jsonrpc_stream_add(jsonrpc_ctx_t *ctx, const char *s, int len)
+{
+	jsonrpc_stream_t *st = &ctx->stream;
+	char *nbuf;
+	int nsize;
+
+	if(st->len + len + JSONRPC_STREAM_HEADROOM + JSONRPC_STREAM_TAILROOM
+			> st->size) {
+		nsize = (st->size>0)?st->size:(jsonrpc_stream_chunk_size
+				+ JSONRPC_STREAM_HEADROOM + JSONRPC_STREAM_TAILROOM);
+		while(st->len + len + JSONRPC_STREAM_HEADROOM
+				+ JSONRPC_STREAM_TAILROOM > nsize) {
+			nsize *= 2;
+		}
+		nbuf = (char*)pkg_realloc(st->buf, nsize);
+		if(nbuf==NULL) {
+			PKG_MEM_ERROR;
+			return -1;
+		}
+		st->buf = nbuf;
+		st->size = nsize;
+	}
+	memcpy(st->buf + JSONRPC_STREAM_HEADROOM + st->len, s, len);
+	st->len += len;
+	return 0;
+}
+
+/** Appends the name of an object member to a streamed reply.
+ */
+static int jsonrpc_stream_add_name(jsonrpc_ctx_t *ctx, char *name)
+{
+	char ebuf[8];
+	char *p;
+	char *b;
+
+	if(name==NULL) {
+		name = "";
+	}
+	if(jsonrpc_stream_add(ctx, "\"", 1)<0) {
+		return -1;
+	}
+	for(b=p=name; *p; p++) {
+		if(*p!='"' && *p!='\\' && (unsigned char)*p>=0x20) {
+			continue;
+		}
+		if(jsonrpc_stream_add(ctx, b, p - b)<0) {
+			return -1;
+		}
+		if(*p=='"' || *p=='\\') {
+			ebuf[0] = '\\';
+			ebuf[1] = *p;
+			if(jsonrpc_stream_add(ctx, ebuf, 2)<0) {
+				return -1;
+			}
+		} else {
+			snprintf(ebuf, 8, "\\u%04x", (unsigned char)*p);
+			if(jsonrpc_stream_add(ctx, ebuf, 6)<0) {
+				return -1;
+			}
+		}
+		b = p + 1;
+	}
+	if(jsonrpc_stream_add(ctx, b, p - b)<0) {
+		return -1;
+	}
+	return jsonrpc_stream_add(ctx, "\":", 2);
+}
+
+/** Appends a json node, with all its members, to a streamed reply.
+ */
+static int jsonrpc_stream_add_node(jsonrpc_ctx_t *ctx, srjson_doc_t *jdoc,
+		srjson_t *nj)
+{
+	char *v;
+	int ret;
+
+	v = srjson_PrintUnformatted(jdoc, nj);
+	if(v==NULL) {
+		LM_ERR("failed to print the json node\n");
+		return -1;
+	}
+	ret = jsonrpc_stream_add(ctx, v, strlen(v));
+	jdoc->free_fn(v);
+	return ret;
+}
+
+/** Starts a new member inside the open container of a level.
+ */
+static int jsonrpc_stream_add_member(jsonrpc_ctx_t *ctx, int level,
+		srjson_t *nj)
+{
+	jsonrpc_stream_t *st = &ctx->stream;
+
+	if(st->nitems[level]>0) {
+		if(jsonrpc_stream_add(ctx, ",", 1)<0) {
+			return -1;
+		}
+	}
+	st->nitems[level]++;
+	if(st->node[level]->type==srjson_Object) {
+		return jsonrpc_stream_add_name(ctx, nj->string);
+	}
+	return 0;
+}
+
+/** Serializes the members of an open container of the streamed reply.
+ *
+ * The written members are removed from the reply document. The last member
+ * is kept open if it is an array or object, unless the container has to be
+ * finished (closed), because new members can still be added to it.
+ */
+static int jsonrpc_stream_level(jsonrpc_ctx_t *ctx, int level, int finish)
+{
+	jsonrpc_stream_t *st = &ctx->stream;
+	srjson_t *node;
+	srjson_t *nj;
+
+	node = st->node[level];
+	nj = node->child;
+	if(level + 1 < st->depth && nj == st->node[level+1]) {
+		/* member opened by a previous flush */
+		if(nj->next==NULL && finish==0) {
+			return jsonrpc_stream_level(ctx, level + 1, 0);
+		}
+		if(jsonrpc_stream_level(ctx, level + 1, 1)<0) {
+			return -1;
+		}
+		srjson_DeleteItemFromArray(ctx->jrpl, node, 0);
+		nj = node->child;
+	}
+	while(nj!=NULL) {
+		if(nj->next==NULL && finish==0 && level + 1 < JSONRPC_STREAM_DEPTH
+				&& (nj->type==srjson_Object || nj->type==srjson_Array)) {
+			/* keep the last container open */
+			if(jsonrpc_stream_add_member(ctx, level, nj)<0) {
+				return -1;
+			}
+			if(jsonrpc_stream_add(ctx,
+						(nj->type==srjson_Object)?"{":"[", 1)<0) {
+				return -1;
+			}
+			st->node[level+1] = nj;
+			st->nitems[level+1] = 0;
+			st->depth = level + 2;
+			return jsonrpc_stream_level(ctx, level + 1, 0);
+		}
+		if(jsonrpc_stream_add_member(ctx, level, nj)<0) {
+			return -1;
+		}
+		if(jsonrpc_stream_add_node(ctx, ctx->jrpl, nj)<0) {
+			return -1;
+		}
+		srjson_DeleteItemFromArray(ctx->jrpl, node, 0);
+		nj = node->child;
+	}
+	if(finish) {
+		if(jsonrpc_stream_add(ctx,
+					(node->type==srjson_Object)?"}":"]", 1)<0) {
+			return -1;
+		}
+		st->depth = level;
+	}
+	return 0;
+}
+
+/** Writes the buffered data of the streamed reply to the transport.
+ */
+static int jsonrpc_stream_write(jsonrpc_ctx_t *ctx, int last)
+{
+	jsonrpc_stream_t *st = &ctx->stream;
+
+	if(st->len==0 && last==0) {
+		return 0;
+	}
+	if(st->buf==NULL && jsonrpc_stream_add(ctx, "", 0)<0) {
+		return -1;
+	}
+	if(st->swrite(st->sparam, st->buf + JSONRPC_STREAM_HEADROOM,
+				st->len, last)<0) {
+		LM_ERR("failed to write the reply chunk %d (%d bytes)\n",
+				st->nchunks, st->len);
+		st->error = 1;
+		return -1;
+	}
+	st->nchunks++;
+	st->len = 0;
+	return 0;
+}
+
+/** Implementation of rpc_flush function of the management API.
+ *
+ * If streaming is enabled for the request, it serializes the part of the
+ * result added so far and writes it out when the buffered data exceeds the
+ * chunk size.
+ * @return 0 on success or if streaming is not enabled, a negative number
+ *            on error
+ */
+static int jsonrpc_flush(jsonrpc_ctx_t* ctx)
+{
+	jsonrpc_stream_t *st = &ctx->stream;
+
+	if(!(ctx->flags & JSONRPC_STREAM_F) || ctx->reply_sent
+			|| ctx->error_code!=0) {
+		return 0;
+	}
+	if(st->error) {
+		return -1;
+	}
+	if(st->active==0) {
+		if(ctx->rpl_node==NULL || (ctx->rpl_node->type!=srjson_Object
+					&& ctx->rpl_node->type!=srjson_Array)) {
+			return 0;
+		}
+		if(jsonrpc_stream_add(ctx, "{\"jsonrpc\":\"2.0\",\"result\":", 26)<0
+				|| jsonrpc_stream_add(ctx,
+					(ctx->rpl_node->type==srjson_Object)?"{":"[", 1)<0) {
+			goto error;
+		}
+		st->node[0] = ctx->rpl_node;
+		st->nitems[0] = 0;
+		st->depth = 1;
+		st->active = 1;
+	}
+	if(jsonrpc_stream_level(ctx, 0, 0)<0) {
+		goto error;
+	}
+	if(st->len >= jsonrpc_stream_chunk_size) {
+		return jsonrpc_stream_write(ctx, 0);
+	}
+	return 0;
+
+error:
+	LM_ERR("failed to serialize the reply\n");
+	st->error = 1;
+	return -1;
+}
+
+/** Completes a streamed reply and writes out the last chunk.
+ */
+static int jsonrpc_stream_end(jsonrpc_ctx_t* ctx)
+{
+	jsonrpc_stream_t *st = &ctx->stream;
+	srjson_t *nj;
+
+	if(st->error) {
+		LM_ERR("the streamed reply is incomplete (%d chunks)\n", st->nchunks);
+		goto done;
+	}
+	if(jsonrpc_stream_level(ctx, 0, 1)<0) {
+		goto error;
+	}
+	if(ctx->error_code != 0) {
+		/* fault after a part of the result was sent - the error object is
+		 * added, so the client can detect the incomplete result */
+		LM_ERR("fault after sending %d chunks of the reply\n", st->nchunks);
+		nj = jsonrpc_fault_node(ctx);
+		if(nj!=NULL) {
+			if(jsonrpc_stream_add(ctx, ",\"error\":", 9)<0
+					|| jsonrpc_stream_add_node(ctx, ctx->jrpl, nj)<0) {
+				srjson_Delete(ctx->jrpl, nj);
+				goto error;
+			}
+			srjson_Delete(ctx->jrpl, nj);
+		}
+	}
+	if(ctx->jreq!=NULL && ctx->jreq->root!=NULL) {
+		nj = srjson_GetObjectItem(ctx->jreq, ctx->jreq->root, "id");
+		if(nj!=NULL) {
+			if(jsonrpc_stream_add(ctx, ",\"id\":", 6)<0
+					|| jsonrpc_stream_add_node(ctx, ctx->jreq, nj)<0) {
+				goto error;
+			}
+		}
+	}
+	if(jsonrpc_stream_add(ctx, "}", 1)<0) {
+		goto error;
+	}
+	if(jsonrpc_stream_write(ctx, 1)<0) {
+		goto done;
+	}
+	LM_DBG("streamed reply sent in %d chunks\n", st->nchunks);
+
+done:
+	if(ctx->msg==NULL) {
+		jsonrpc_set_plain_reply(ctx->http_code, &ctx->http_text, NULL,
+				ctx->jrpl->free_fn);
+		_jsonrpc_plain_reply.streamed = 1;
+	}
+	return (st->error)?-1:0;
+
+error:
+	LM_ERR("failed to serialize the end of the reply\n");
+	st->error = 1;
+	goto done;
+}
+
+/** Writes a chunk of a streamed reply over http, using chunked transfer
+ * encoding.
+ */
+static int jsonrpc_stream_write_http(void *sparam, char *buf, int len,
+		int last)
+{
+	static str jsonrpc_http_hdrs = str_init("HTTP/1.1 200 OK\r\n"
+			"Content-Type: application/json\r\n"
+			"Transfer-Encoding: chunked\r\n\r\n");
+	jsonrpc_ctx_t *ctx;
+	struct dest_info dst;
+	char hbuf[JSONRPC_STREAM_HEADROOM];
+	char *p;
+	int plen;
+	int n;
+
+	ctx = (jsonrpc_ctx_t*)sparam;
+	init_dst_from_rcv(&dst, &ctx->msg->rcv);
+	if(ctx->stream.nchunks==0) {
+		if(msg_send(&dst, jsonrpc_http_hdrs.s, jsonrpc_http_hdrs.len)<0) {
+			LM_ERR("failed to send the http reply headers\n");
+			return -1;
+		}
+	}
+	p = buf;
+	plen = 0;
+	if(len>0) {
+		n = snprintf(hbuf, JSONRPC_STREAM_HEADROOM, "%x\r\n", len);
+		p = buf - n;
+		memcpy(p, hbuf, n);
+		memcpy(buf + len, "\r\n", 2);
+		plen = n + len + 2;
+	}
+	if(last) {
+		memcpy(p + plen, "0\r\n\r\n", 5);
+		plen += 5;
+	}
+	if(msg_send(&dst, p, plen)<0) {
+		LM_ERR("failed to send the http reply chunk\n");
+		return -1;
+	}
+	return 0;
+}
+
+/** Returns 1 if the reply to the http request can be streamed.
+ */
+static int jsonrpc_stream_http_ready(sip_msg_t *msg)
+{
+	if(!(jsonrpc_stream_reply & 1) || msg->first_line.type!=SIP_REQUEST) {
+		return 0;
+	}
+	/* chunked transfer encoding requires http/1.1 */
+	if(msg->first_line.u.request.version.len!=8
+			|| strncmp(msg->first_line.u.request.version.s,
+				"HTTP/1.1", 8)!=0) {
+		return 0;
+	}
+	return 1;
+}
+
+
 /** Implementation of rpc_send function required by the management API.
  *
  * This is the function that will be called whenever a management function
@@ -337,36 +738,20 @@ static void jsonrpc_fault(jsonrpc_ctx_t* ctx, int code, char* fmt, ...)
 static int jsonrpc_send(jsonrpc_ctx_t* ctx)
 {
 	srjson_t *nj = NULL;
-	int i;
 	str rbuf;
 
 	if (ctx->reply_sent) return 1;
 
 	ctx->reply_sent = 1;
 
+	if(ctx->stream.active) {
+		return jsonrpc_stream_end(ctx);
+	}
+
 	if(ctx->error_code != 0) {
 		/* fault handling */
-		nj = srjson_CreateObject(ctx->jrpl);
+		nj = jsonrpc_fault_node(ctx);
 		if(nj!=NULL) {
-			srjson_AddNumberToObject(ctx->jrpl, nj, "code",
-					ctx->error_code);
-			for(i=0; _jsonrpc_error_table[i].code!=0
-					&& _jsonrpc_error_table[i].code!=ctx->error_code; i++);
-			if(_jsonrpc_error_table[i].code!=0) {
-				srjson_AddStrStrToObject(ctx->jrpl, nj,
-					"message", 7,
-					_jsonrpc_error_table[i].text.s,
-					_jsonrpc_error_table[i].text.len);
-			} else {
-				if(ctx->error_text.len>0) {
-					srjson_AddStrStrToObject(ctx->jrpl, nj,
-							"message", 7,
-							ctx->error_text.s, ctx->error_text.len);
-				} else {
-					srjson_AddStrStrToObject(ctx->jrpl, nj,
-							"message", 7, "Unexpected Error", 16);
-				}
-			}
 			srjson_AddItemToObject(ctx->jrpl, ctx->jrpl->root, "error", nj);
 		}
 	} else {
@@ -535,6 +920,11 @@ static int jsonrpc_add(jsonrpc_ctx_t* ctx, char* fmt, ...)
 
 	jsonrpc_delayed_reply_ctx_init(ctx);
 
+	if(ctx->stream.active && !(ctx->flags & RET_ARRAY)) {
+		LM_ERR("cannot replace the result of a streamed reply\n");
+		return -1;
+	}
+
 	va_start(ap, fmt);
 	while(*fmt) {
 		if (*fmt == '{' || *fmt == '[') {
@@ -724,6 +1114,11 @@ static int jsonrpc_rpl_printf(jsonrpc_ctx_t* ctx, char* fmt, ...)
 
 	jsonrpc_delayed_reply_ctx_init(ctx);
 
+	if(ctx->stream.active && !(ctx->flags & RET_ARRAY)) {
+		LM_ERR("cannot replace the result of a streamed reply\n");
+		return -1;
+	}
+
 	buf = tbuf;
 	buf_size = JSONRPC_PRINT_VALUE_BUF_LEN;
 	while (1) {
@@ -979,6 +1374,10 @@ static void jsonrpc_clean_context(jsonrpc_ctx_t* ctx)
 		ctx->rpl_node = NULL;
 	}
 	srjson_DeleteDoc(ctx->jrpl);
+	if(ctx->stream.buf!=NULL) {
+		pkg_free(ctx->stream.buf);
+		ctx->stream.buf = NULL;
+	}
 }
 
 
@@ -987,6 +1386,9 @@ static void jsonrpc_clean_context(jsonrpc_ctx_t* ctx)
 static rpc_capabilities_t jsonrpc_capabilities(jsonrpc_ctx_t* ctx)
 {
 	/* support for async commands - delayed response */
+	if(ctx->flags & JSONRPC_STREAM_F) {
+		return RPC_DELAYED_REPLY | RPC_STREAM_REPLY;
+	}
 	return RPC_DELAYED_REPLY;
 }
 
@@ -1052,7 +1454,7 @@ static struct rpc_delayed_ctx* jsonrpc_delayed_ctx_new(jsonrpc_ctx_t* ctx)
 	ret->rpc=func_param;
 	ret->reply_ctx=(char*)ret+ROUND_POINTER(sizeof(*ret));
 	r_ctx=ret->reply_ctx;
-	r_ctx->flags=ctx->flags | JSONRPC_DELAYED_CTX_F;
+	r_ctx->flags=(ctx->flags & ~JSONRPC_STREAM_F) | JSONRPC_DELAYED_CTX_F;
 	r_ctx->transport=ctx->transport;
 	ctx->flags |= JSONRPC_DELAYED_REPLY_F;
 	r_ctx->msg=shm_msg;
@@ -1196,6 +1598,11 @@ static int mod_init(void)
 	func_param.delayed_ctx_new   = (rpc_delayed_ctx_new_f)jsonrpc_delayed_ctx_new;
 	func_param.delayed_ctx_close =
 		(rpc_delayed_ctx_close_f)jsonrpc_delayed_ctx_close;
+	func_param.flush             = (rpc_flush_f)jsonrpc_flush;
+
+	if(jsonrpc_stream_chunk_size<=0) {
+		jsonrpc_stream_chunk_size = 16384;
+	}
 
 	jsonrpc_register_rpc();
 
@@ -1307,6 +1714,11 @@ static int ki_jsonrpcs_dispatch(sip_msg_t* msg)
 		goto send_reply;
 	}
 	ctx->flags = rpce->flags;
+	if(jsonrpc_stream_http_ready(msg)) {
+		ctx->stream.swrite = jsonrpc_stream_write_http;
+		ctx->stream.sparam = ctx;
+		ctx->flags |= JSONRPC_STREAM_F;
+	}
 	nj = srjson_GetObjectItem(ctx->jreq, ctx->jreq->root, "params");
 	if(nj!=NULL && nj->type!=srjson_Array && nj->type!=srjson_Object) {
 		LM_ERR("params field is not an array or object\n");
@@ -1334,6 +1746,15 @@ static int jsonrpc_dispatch(sip_msg_t* msg, char* s1, char* s2)
 }
 
 int jsonrpc_exec_ex(str *cmd, str *rpath)
+{
+	return jsonrpc_exec_stream(cmd, rpath, NULL, NULL);
+}
+
+/** Executes the jsonrpc command, streaming the reply with the writer
+ * function when it is not NULL.
+ */
+int jsonrpc_exec_stream(str *cmd, str *rpath, jsonrpc_stream_write_f swrite,
+		void *sparam)
 {
 	rpc_export_t* rpce;
 	jsonrpc_ctx_t* ctx;
@@ -1416,6 +1837,11 @@ int jsonrpc_exec_ex(str *cmd, str *rpath)
 		goto send_reply;
 	}
 	ctx->flags = rpce->flags;
+	if(swrite!=NULL) {
+		ctx->stream.swrite = swrite;
+		ctx->stream.sparam = sparam;
+		ctx->flags |= JSONRPC_STREAM_F;
+	}
 	nj = srjson_GetObjectItem(ctx->jreq, ctx->jreq->root, "params");
 	if(nj!=NULL && nj->type!=srjson_Array && nj->type!=srjson_Object) {
 		LM_ERR("params field is not an array or object\n");
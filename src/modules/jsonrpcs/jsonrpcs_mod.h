@@ -30,6 +30,43 @@
 #include "../../core/utils/srjson.h"
 
 #define JSONRPC_ID_SIZE	64
+#define JSONRPC_STREAM_DEPTH	16
+
+/* free space kept before and after the data given to the stream writer,
+ * it can be used by the writer to add transport framing */
+#define JSONRPC_STREAM_HEADROOM	16
+#define JSONRPC_STREAM_TAILROOM	8
+
+/** Writes a chunk of a streamed reply to the transport.
+ * @param sparam transport specific parameter
+ * @param buf the chunk of the json document
+ * @param len the length of the chunk
+ * @param last set to 1 for the last chunk of the reply
+ * @return 0 on success, a negative number on error
+ */
+typedef int (*jsonrpc_stream_write_f)(void *sparam, char *buf, int len,
+		int last);
+
+/** The state of a streamed reply.
+ *
+ * The result is serialized by the flush operation of the RPC API, all the
+ * nodes added before are written out and removed from the reply document,
+ * except the containers on the path to the last added node, which stay
+ * open to get more members.
+ */
+typedef struct jsonrpc_stream {
+	jsonrpc_stream_write_f swrite; /**< Transport writer, NULL if disabled */
+	void *sparam;          /**< Parameter for the transport writer */
+	int active;            /**< Set after the first part was serialized */
+	int depth;             /**< Number of open containers */
+	srjson_t *node[JSONRPC_STREAM_DEPTH];  /**< The open containers */
+	int nitems[JSONRPC_STREAM_DEPTH];      /**< Members written per level */
+	char *buf;             /**< Buffer for the serialized data */
+	int size;              /**< Size of the buffer */
+	int len;               /**< Length of the data in the buffer */
+	int nchunks;           /**< Number of chunks written out */
+	int error;             /**< Set if writing to the transport failed */
+} jsonrpc_stream_t;
 
 /** The context of the jsonrpc request being processed.
  *
@@ -57,12 +94,14 @@ typedef struct jsonrpc_ctx {
 	int transport;         /**< RPC transport */
 	int jsrid_type;        /**< type for Json RPC id value */
 	char jsrid_val[JSONRPC_ID_SIZE]; /**< value for Json RPC id */
+	jsonrpc_stream_t stream; /**< State of streamed reply */
 } jsonrpc_ctx_t;
 
 /* extra rpc_ctx_t flags */
 /* first 8 bits reserved for rpc flags (e.g. RET_ARRAY) */
 #define JSONRPC_DELAYED_CTX_F	256
 #define JSONRPC_DELAYED_REPLY_F	512
+#define JSONRPC_STREAM_F	1024
 
 #define JSONRPC_TRANS_NONE	0
 #define JSONRPC_TRANS_HTTP	1
@@ -73,11 +112,17 @@ typedef struct jsonrpc_plain_reply {
 	int rcode;         /**< reply code */
 	str rtext;         /**< reply reason text */
 	str rbody;         /**< reply body */
+	int streamed;      /**< set if the body was written out in chunks */
 } jsonrpc_plain_reply_t;
 
 jsonrpc_plain_reply_t* jsonrpc_plain_reply_get(void);
 
 int jsonrpc_exec_ex(str *cmd, str *rpath);
+int jsonrpc_exec_stream(str *cmd, str *rpath, jsonrpc_stream_write_f swrite,
+		void *sparam);
+
+extern int jsonrpc_stream_reply;
+extern int jsonrpc_stream_chunk_size;
 
 #endif
 
@@ -556,6 +556,26 @@ static int jsonrpc_dgram_send_data(int fd, char* buf, unsigned int len,
 	return n;
 }
 
+/* send a chunk of a streamed reply, in as many datagrams as needed */
+static int jsonrpc_dgram_stream_write(void *sparam, char *buf, int len,
+		int last)
+{
+	int n;
+
+	while(len>0) {
+		n = (len>JSONRPC_DGRAM_BUF_SIZE)?JSONRPC_DGRAM_BUF_SIZE:len;
+		if(jsonrpc_dgram_send_data(*(int*)sparam, buf, n,
+					(struct sockaddr*)&jsonrpc_dgram_reply_addr,
+					jsonrpc_dgram_reply_addr_len,
+					jsonrpc_dgram_timeout)!=n) {
+			return -1;
+		}
+		buf += n;
+		len -= n;
+	}
+	return 0;
+}
+
 void jsonrpc_dgram_server(int rx_sock)
 {
 	int ret;
@@ -618,12 +638,18 @@ void jsonrpc_dgram_server(int rx_sock)
 
 		LM_DBG("buf is %s and we have received %i bytes\n",
 				scmd.s, scmd.len);
-		if(jsonrpc_exec_ex(&scmd, NULL)<0) {
+		if(jsonrpc_exec_stream(&scmd, NULL,
+					(jsonrpc_stream_reply & 4)?jsonrpc_dgram_stream_write:NULL,
+					&rx_sock)<0) {
 			LM_ERR("failed to execute the json document from datagram\n");
 			continue;
 		}
 
 		jr = jsonrpc_plain_reply_get();
+		if(jr->streamed) {
+			/* reply sent already in chunks */
+			continue;
+		}
 		LM_DBG("command executed - result: [%d] [%p] [%.*s]\n",
 				jr->rcode, jr->rbody.s,
 				jr->rbody.len, jr->rbody.s);
@@ -45,6 +45,8 @@
 #include "../../core/kemi.h"
 #include "../../core/rpc.h"
 #include "../../core/rpc_lookup.h"
+#include "../../core/pt.h"
+#include "../../core/cfg/cfg_struct.h"
 
 #include "kfk.h"
 
@@ -56,6 +58,7 @@ static rpc_export_t rpc_cmds[];
 static int mod_init(void);
 static void mod_destroy(void);
 static int child_init(int rank);
+static int kafka_fork_producers(void);
 static int fixup_kafka_send(void** param, int param_no);
 static int w_kafka_send(struct sip_msg* msg, char* ptopic, char *pmessage);
 static int w_kafka_send_key(struct sip_msg *msg, char *ptopic, char *pmessage, char *pkey);
@@ -64,6 +67,8 @@ static int w_kafka_send_key(struct sip_msg *msg, char *ptopic, char *pmessage, c
  * Variables and functions to deal with module parameters.
  */
 char *brokers_param = NULL; /**< List of brokers. */
+static int producer_processes = 0; /**< Dedicated producer processes. */
+static int queue_size = 65536; /**< Queue size for producer processes. */
 static int kafka_conf_param(modparam_t type, void *val);
 static int kafka_topic_param(modparam_t type, void *val);
 
@@ -85,6 +90,8 @@ static param_export_t params[]={
 	{"brokers", PARAM_STRING, &brokers_param},
 	{"configuration", PARAM_STRING|USE_FUNC_PARAM, (void*)kafka_conf_param},
 	{"topic", PARAM_STRING|USE_FUNC_PARAM, (void*)kafka_topic_param},
+	{"producer_processes", PARAM_INT, &producer_processes},
+	{"queue_size", PARAM_INT, &queue_size},
     {0, 0, 0}
 };
 
@@ -117,6 +124,19 @@ static int mod_init(void)
 		LM_ERR("Failed to initialize statistics\n");
 		return -1;
 	}
+
+	if (producer_processes > 0) {
+		if (queue_size <= 0) {
+			LM_ERR("Invalid queue_size: %d\n", queue_size);
+			return -1;
+		}
+		if (kfk_queue_init(queue_size)) {
+			LM_ERR("Failed to initialize producer queue\n");
+			return -1;
+		}
+		register_procs(producer_processes);
+		cfg_register_child(producer_processes);
+	}
 	
 	return 0;
 }
@@ -130,6 +150,14 @@ static int child_init(int rank)
 	if (rank==PROC_INIT || rank==PROC_TCP_MAIN)
 		return 0;
 
+	if (producer_processes > 0) {
+		/* Workers add the messages to the queue, only the producer
+		 * processes have a producer handle. */
+		if (rank != PROC_MAIN)
+			return 0;
+		return kafka_fork_producers();
+	}
+
 	if (kfk_init(brokers_param)) {
 		LM_ERR("Failed to initialize Kafka\n");
 		return -1;
@@ -137,12 +165,42 @@ static int child_init(int rank)
 	return 0;
 }
 
+/**
+ * \brief Create the producer processes.
+ */
+static int kafka_fork_producers(void)
+{
+	int pid;
+	int i;
+
+	for (i = 0; i < producer_processes; i++) {
+		pid = fork_process(PROC_NOCHLDINIT, "Kafka Producer", 1);
+		if (pid < 0)
+			return -1; /* error */
+		if (pid == 0) {
+			/* child */
+			if (cfg_child_init())
+				return -1;
+			if (kfk_init(brokers_param)) {
+				LM_ERR("Failed to initialize Kafka producer: %d\n", i);
+				return -1;
+			}
+			kfk_producer_run(i + 1);
+			/* never returns */
+		}
+	}
+
+	return 0;
+}
+
 static void mod_destroy(void)
 {
 	LM_DBG("cleaning up\n");
 
 	kfk_close();
 
+	kfk_queue_close();
+
 	kfk_stats_close();
 }
 
@@ -431,6 +489,41 @@ static void rpc_kafka_stats_topic(rpc_t *rpc, void *ctx)
 	}
 }
 
+static void rpc_kafka_stats_topics(rpc_t *rpc, void *ctx)
+{
+	kfk_stats_rpc_topics(rpc, ctx);
+}
+
+static void rpc_kafka_queue(rpc_t *rpc, void *ctx)
+{
+	unsigned int count = 0;
+	unsigned int size = 0;
+	void *th;
+
+	kfk_queue_get(&count, &size);
+	if (rpc->add(ctx, "{", &th) < 0) {
+		rpc->fault(ctx, 500, "Internal error creating rpc");
+		return;
+	}
+	if (rpc->struct_add(th, "ddd",
+				"producers", producer_processes,
+				"queued", (int)count,
+				"size", (int)size) < 0) {
+		rpc->fault(ctx, 500, "Internal error adding queue info");
+		return;
+	}
+}
+
+static const char* rpc_kafka_stats_topics_doc[2] = {
+	"Print delivery statistics for all topics",
+	0
+};
+
+static const char* rpc_kafka_queue_doc[2] = {
+	"Print the state of the producer processes queue",
+	0
+};
+
 static const char* rpc_kafka_stats_doc[2] = {
 	"Print general topic independent statistics",
 	0
@@ -444,5 +537,8 @@ static const char* rpc_kafka_stats_topic_doc[2] = {
 static rpc_export_t rpc_cmds[] = {
 	{"kafka.stats", rpc_kafka_stats, rpc_kafka_stats_doc, 0},
 	{"kafka.stats_topic", rpc_kafka_stats_topic, rpc_kafka_stats_topic_doc, 0},
+	{"kafka.stats_topics", rpc_kafka_stats_topics, rpc_kafka_stats_topics_doc,
+		RET_ARRAY},
+	{"kafka.queue", rpc_kafka_queue, rpc_kafka_queue_doc, 0},
 	{0, 0, 0, 0}
 };
@@ -28,6 +28,9 @@
  */
 
 #include <syslog.h> /* For log levels. */
+#include <stdint.h>
+#include <inttypes.h>
+#include <sys/time.h>
 #include <librdkafka/rdkafka.h>
 
 #include "../../core/dprint.h"
@@ -35,6 +38,9 @@
 #include "../../core/mem/pkg.h"
 #include "../../core/mem/shm_mem.h"
 #include "../../core/locking.h"
+#include "../../core/cfg/cfg_struct.h"
+
+#include "kfk.h"
 
 /**
  * \brief data type for a configuration property.
@@ -75,9 +81,40 @@ typedef struct kfk_stats_s {
 	str *topic_name; /**< Name of the topic, or NULL for general statistics. */
 	uint64_t total; /**< Total number of messages sent. */
 	uint64_t error; /**< Number of failed messages to sent. */
+	uint64_t dropped; /**< Messages dropped because the queue was full. */
+	uint64_t latency_sum; /**< Sum of delivery latencies (usec). */
+	uint64_t latency_max; /**< Maximum delivery latency (usec). */
 	struct kfk_stats_s *next; /**< Next element in stats list. */
 } kfk_stats_t;
 
+/**
+ * \brief message queued by a worker for the producer processes.
+ *
+ * Topic, payload and key are stored in the same shm block.
+ */
+typedef struct kfk_qmsg_s {
+	str topic;
+	str message;
+	str key;
+	uint64_t qtime; /**< Time when the message was queued (usec). */
+} kfk_qmsg_t;
+
+/**
+ * \brief queue between the workers and the producer processes.
+ */
+typedef struct kfk_queue_s {
+	gen_lock_t lock;
+	unsigned int size;
+	unsigned int head;
+	unsigned int count;
+	kfk_qmsg_t **items;
+} kfk_queue_t;
+
+static kfk_queue_t *kfk_queue = NULL;
+
+#define KFK_PRODUCER_BATCH 256 /**< Max messages taken at once from queue. */
+#define KFK_PRODUCER_POLL 10 /**< Poll timeout when queue is empty (ms). */
+
 /* Static variables. */
 static rd_kafka_conf_t *rk_conf = NULL;  /* Configuration object */
 static rd_kafka_t *rk = NULL; /* Producer instance handle */
@@ -105,9 +142,22 @@ static int kfk_conf_configure();
 static int kfk_topic_list_configure();
 static int kfk_topic_exist(str *topic_name);
 static rd_kafka_topic_t* kfk_topic_get(str *topic_name);
-static int kfk_stats_add(const char *topic, rd_kafka_resp_err_t err);
+static int kfk_stats_add(const char *topic, rd_kafka_resp_err_t err,
+		uint64_t latency);
+static void kfk_stats_dropped(str *topic);
 static void kfk_stats_topic_free(kfk_stats_t *st_topic);
 
+/**
+ * \brief current time in microseconds.
+ */
+static uint64_t kfk_time_us()
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
 /**
  * \brief Kafka logger callback
  */
@@ -183,8 +233,16 @@ static void kfk_msg_delivered (rd_kafka_t *rk,
 		LM_ERR("Cannot get topic name for delivered message\n");
 		return;
 	}
-	
-	kfk_stats_add(topic_name, rkmessage->err);
+
+	/* The opaque holds the time when the message was queued. Unsigned
+	 * difference, it can be truncated on 32 bits architectures. */
+	uint64_t latency = 0;
+	if (rkmessage->_private) {
+		latency = (uintptr_t)kfk_time_us()
+				- (uintptr_t)rkmessage->_private;
+	}
+
+	kfk_stats_add(topic_name, rkmessage->err, latency);
 	
 	if (rkmessage->err) {
 		LM_ERR("RDKAFKA Message delivery failed: %s\n",
@@ -818,15 +876,32 @@ clean:
 }
 
 /**
- * \brief send a message to a topic.
+ * \brief check if a topic is configured (without a producer handle).
  *
- * \param topic_name name of the topic
- * \param message message to send.
- * \param key to send.
+ * \return 1 if topic is configured, 0 otherwise.
+ */
+static int kfk_topic_configured(str *topic_name)
+{
+	kfk_topic_t *ktopic;
+
+	for (ktopic = kfk_topic; ktopic; ktopic = ktopic->next) {
+		if (topic_name->len == ktopic->topic_name->len &&
+			strncmp(topic_name->s, ktopic->topic_name->s, topic_name->len) == 0) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/**
+ * \brief produce a message with the local producer handle.
+ *
+ * \param qtime time when the message was queued (usec).
  *
  * \return 0 on success.
  */
-int kfk_message_send(str *topic_name, str *message, str *key)
+static int kfk_produce(str *topic_name, str *message, str *key,
+		uint64_t qtime)
 {
     /* Get topic from name. */
 	rd_kafka_topic_t *rkt = kfk_topic_get(topic_name);
@@ -858,7 +933,7 @@ int kfk_message_send(str *topic_name, str *message, str *key)
 			/* Message opaque, provided in
 			 * delivery report callback as
 			 * msg_opaque. */
-			NULL) == -1) {
+			(void*)(uintptr_t)qtime) == -1) {
 		rd_kafka_resp_err_t err = rd_kafka_last_error();
 		LM_ERR("Error sending message: %s\n", rd_kafka_err2str(err));
 
@@ -867,6 +942,31 @@ int kfk_message_send(str *topic_name, str *message, str *key)
 
 	LM_DBG("Message sent\n");
 
+	return 0;
+}
+
+/**
+ * \brief send a message to a topic.
+ *
+ * With producer processes the message is added to the shared queue,
+ * otherwise it is produced with the producer handle of this process.
+ *
+ * \param topic_name name of the topic
+ * \param message message to send.
+ * \param key to send.
+ *
+ * \return 0 on success.
+ */
+int kfk_message_send(str *topic_name, str *message, str *key)
+{
+	if (kfk_queue) {
+		return kfk_queue_push(topic_name, message, key);
+	}
+
+	if (kfk_produce(topic_name, message, key, kfk_time_us())) {
+		return -1;
+	}
+
 	/* Poll to handle delivery reports */
 	rd_kafka_poll(rk, 0);
 	LM_DBG("Message polled\n");
@@ -874,6 +974,180 @@ int kfk_message_send(str *topic_name, str *message, str *key)
 	return 0;
 }
 
+/**
+ * \brief Initialize the queue for the producer processes.
+ *
+ * \param size maximum number of queued messages.
+ * \return 0 on success.
+ */
+int kfk_queue_init(int size)
+{
+	kfk_queue = shm_malloc(sizeof(kfk_queue_t) + size * sizeof(kfk_qmsg_t*));
+	if (!kfk_queue) {
+		LM_ERR("Out of shared memory\n");
+		return -1;
+	}
+	memset(kfk_queue, 0, sizeof(kfk_queue_t));
+	kfk_queue->items = (kfk_qmsg_t**)(kfk_queue + 1);
+	kfk_queue->size = size;
+	if (lock_init(&kfk_queue->lock) == NULL) {
+		LM_ERR("cannot init queue lock\n");
+		shm_free(kfk_queue);
+		kfk_queue = NULL;
+		return -1;
+	}
+
+	return 0;
+}
+
+/**
+ * \brief Close the queue for the producer processes.
+ */
+void kfk_queue_close()
+{
+	if (!kfk_queue) {
+		return;
+	}
+
+	lock_destroy(&kfk_queue->lock);
+	while (kfk_queue->count > 0) {
+		shm_free(kfk_queue->items[kfk_queue->head]);
+		kfk_queue->head = (kfk_queue->head + 1) % kfk_queue->size;
+		kfk_queue->count--;
+	}
+	shm_free(kfk_queue);
+	kfk_queue = NULL;
+}
+
+/**
+ * \brief add a message to the queue of the producer processes.
+ *
+ * \return 0 on success.
+ */
+int kfk_queue_push(str *topic_name, str *message, str *key)
+{
+	kfk_qmsg_t *qmsg;
+	int klen;
+
+	if (!kfk_topic_configured(topic_name)) {
+		LM_ERR("Topic not found: %.*s\n", topic_name->len, topic_name->s);
+		return -1;
+	}
+
+	klen = (key != NULL && key->s != NULL && key->len > 0) ? key->len : 0;
+	qmsg = shm_malloc(sizeof(kfk_qmsg_t) + topic_name->len + message->len
+			+ klen);
+	if (!qmsg) {
+		LM_ERR("Out of shared memory\n");
+		return -1;
+	}
+	qmsg->topic.s = (char*)(qmsg + 1);
+	qmsg->topic.len = topic_name->len;
+	memcpy(qmsg->topic.s, topic_name->s, topic_name->len);
+	qmsg->message.s = qmsg->topic.s + qmsg->topic.len;
+	qmsg->message.len = message->len;
+	memcpy(qmsg->message.s, message->s, message->len);
+	qmsg->key.s = qmsg->message.s + qmsg->message.len;
+	qmsg->key.len = klen;
+	if (klen) {
+		memcpy(qmsg->key.s, key->s, klen);
+	}
+	qmsg->qtime = kfk_time_us();
+
+	lock_get(&kfk_queue->lock);
+	if (kfk_queue->count >= kfk_queue->size) {
+		lock_release(&kfk_queue->lock);
+		shm_free(qmsg);
+		kfk_stats_dropped(topic_name);
+		LM_ERR("Queue full, message dropped (topic: %.*s)\n",
+			   topic_name->len, topic_name->s);
+		return -1;
+	}
+	kfk_queue->items[(kfk_queue->head + kfk_queue->count)
+			% kfk_queue->size] = qmsg;
+	kfk_queue->count++;
+	lock_release(&kfk_queue->lock);
+
+	return 0;
+}
+
+/**
+ * \brief take up to max messages from the queue.
+ */
+static int kfk_queue_pop(kfk_qmsg_t **qmsgs, int max)
+{
+	int n;
+
+	lock_get(&kfk_queue->lock);
+	for (n = 0; n < max && kfk_queue->count > 0; n++) {
+		qmsgs[n] = kfk_queue->items[kfk_queue->head];
+		kfk_queue->head = (kfk_queue->head + 1) % kfk_queue->size;
+		kfk_queue->count--;
+	}
+	lock_release(&kfk_queue->lock);
+
+	return n;
+}
+
+/**
+ * \brief Get the queue length and size.
+ */
+void kfk_queue_get(unsigned int *count, unsigned int *size)
+{
+	*count = 0;
+	*size = 0;
+	if (!kfk_queue) {
+		return;
+	}
+	lock_get(&kfk_queue->lock);
+	*count = kfk_queue->count;
+	*size = kfk_queue->size;
+	lock_release(&kfk_queue->lock);
+}
+
+/**
+ * \brief main loop of a producer process.
+ *
+ * Messages are taken in batches from the queue, librdkafka groups them
+ * in bigger requests to the brokers (see linger.ms configuration).
+ */
+void kfk_producer_run(int rank)
+{
+	kfk_qmsg_t *qmsgs[KFK_PRODUCER_BATCH];
+	rd_kafka_resp_err_t err;
+	int n;
+	int i;
+
+	LM_DBG("Started producer process: %d\n", rank);
+
+	for (;;) {
+		cfg_update();
+
+		n = kfk_queue_pop(qmsgs, KFK_PRODUCER_BATCH);
+		for (i = 0; i < n; i++) {
+			if (kfk_produce(&qmsgs[i]->topic, &qmsgs[i]->message,
+						&qmsgs[i]->key, qmsgs[i]->qtime)) {
+				err = rd_kafka_last_error();
+				if (err == RD_KAFKA_RESP_ERR__QUEUE_FULL) {
+					/* Local librdkafka queue is full, wait for some
+					 * delivery reports and try again. */
+					rd_kafka_poll(rk, 100);
+					if (kfk_produce(&qmsgs[i]->topic, &qmsgs[i]->message,
+								&qmsgs[i]->key, qmsgs[i]->qtime) == 0) {
+						shm_free(qmsgs[i]);
+						continue;
+					}
+				}
+				kfk_stats_dropped(&qmsgs[i]->topic);
+			}
+			shm_free(qmsgs[i]);
+		}
+
+		/* Serve delivery reports, wait a bit only if the queue is empty. */
+		rd_kafka_poll(rk, (n == KFK_PRODUCER_BATCH) ? 0 : KFK_PRODUCER_POLL);
+	}
+}
+
 /**
  * \brief Initialize statistics.
  *
@@ -955,7 +1229,7 @@ static void kfk_stats_topic_free(kfk_stats_t *st_topic)
  * \return the new kfk_stats_t on success.
  * \return NULL on error.
  */
-static kfk_stats_t* kfk_stats_topic_new(const char *topic, rd_kafka_resp_err_t err)
+static kfk_stats_t* kfk_stats_topic_new(const char *topic, int topic_len)
 {
 	kfk_stats_t *st = NULL;
 
@@ -963,7 +1237,6 @@ static kfk_stats_t* kfk_stats_topic_new(const char *topic, rd_kafka_resp_err_t e
 		LM_ERR("No topic\n");
 		goto error;
 	}
-	int topic_len = strlen(topic);
 	if (topic_len == 0) {
 		LM_ERR("Void topic\n");
 		goto error;
@@ -991,11 +1264,6 @@ static kfk_stats_t* kfk_stats_topic_new(const char *topic, rd_kafka_resp_err_t e
 	memcpy(st->topic_name->s, topic, topic_len);
 	st->topic_name->s[topic_len] = '\0';
 	st->topic_name->len = topic_len;
-	
-	st->total++;
-	if (err) {
-		st->error++;
-	}
 
 	return st;
 	
@@ -1008,12 +1276,50 @@ error:
 	return NULL;
 }
 
+/**
+ * \brief get the stats node for a topic, creating it if needed.
+ *
+ * Must be called with stats_lock taken.
+ *
+ * \return the stats node or NULL on error.
+ */
+static kfk_stats_t* kfk_stats_topic_lookup(const char *topic, int topic_len)
+{
+	kfk_stats_t **stats_pre = &(stats_general->next);
+	while (*stats_pre != NULL) {
+		LM_DBG("Topic search: %.*s\n", (*stats_pre)->topic_name->len,
+				   (*stats_pre)->topic_name->s);
+		if ((*stats_pre)->topic_name->len == topic_len &&
+			strncmp(topic, (*stats_pre)->topic_name->s, (*stats_pre)->topic_name->len) == 0) {
+			/* Topic match. */
+			LM_DBG("Topic match: %.*s\n", (*stats_pre)->topic_name->len,
+				   (*stats_pre)->topic_name->s);
+			return *stats_pre;
+		}
+
+		stats_pre = &((*stats_pre)->next);
+	}
+
+	/* Topic not found. */
+	LM_DBG("Topic: %.*s not found\n", topic_len, topic);
+
+	/* Add a new stats topic. */
+	*stats_pre = kfk_stats_topic_new(topic, topic_len);
+	if (*stats_pre == NULL) {
+		LM_ERR("Failed to create stats for topic: %.*s\n", topic_len, topic);
+	}
+	return *stats_pre;
+}
+
 /**
  * \brief add a new message delivery to statistics.
  *
+ * \param latency time from queueing until delivery report (usec).
+ *
  * \return 0 on success.
  */
-static int kfk_stats_add(const char *topic, rd_kafka_resp_err_t err)
+static int kfk_stats_add(const char *topic, rd_kafka_resp_err_t err,
+		uint64_t latency)
 {
 	LM_DBG("Adding stats: (topic: %s) (error: %d)\n",
 		   topic, err);
@@ -1031,55 +1337,32 @@ static int kfk_stats_add(const char *topic, rd_kafka_resp_err_t err)
 	if (err) {
 		stats_general->error++;
 	}
+	stats_general->latency_sum += latency;
+	if (latency > stats_general->latency_max) {
+		stats_general->latency_max = latency;
+	}
 
 	LM_DBG("General stats: total = %" PRIu64 "  error = %" PRIu64 "\n",
 		   stats_general->total, stats_general->error);
 
-	kfk_stats_t **stats_pre = &(stats_general->next);
-	while (*stats_pre != NULL) {
-		LM_DBG("Topic search: %.*s\n", (*stats_pre)->topic_name->len,
-				   (*stats_pre)->topic_name->s);
-		if ((*stats_pre)->topic_name->len == topic_len &&
-			strncmp(topic, (*stats_pre)->topic_name->s, (*stats_pre)->topic_name->len) == 0) {
-			/* Topic match. */
-			LM_DBG("Topic match: %.*s\n", (*stats_pre)->topic_name->len,
-				   (*stats_pre)->topic_name->s);
-			break;
-		}
-
-		stats_pre = &((*stats_pre)->next);
-	}
-
-	if (*stats_pre == NULL) {
-		/* Topic not found. */
-		LM_DBG("Topic: %s not found\n", topic);
-		
-		/* Add a new stats topic. */
-		kfk_stats_t *new_topic = NULL;
-		new_topic = kfk_stats_topic_new(topic, err);
-		if (!new_topic) {
-			LM_ERR("Failed to create stats for topic: %s\n", topic);
-			goto error;
-		}
-
-		*stats_pre = new_topic;
-		LM_DBG("Created Topic stats (%s): total = %" PRIu64 "  error = %" PRIu64 "\n",
-			   topic, new_topic->total, new_topic->error);
-
-		goto clean;
+	kfk_stats_t *current = kfk_stats_topic_lookup(topic, topic_len);
+	if (!current) {
+		goto error;
 	}
 
-	/* Topic found. Increase statistics. */
-	kfk_stats_t *current = *stats_pre;
+	/* Increase topic statistics. */
 	current->total++;
 	if (err) {
 		current->error++;
 	}
+	current->latency_sum += latency;
+	if (latency > current->latency_max) {
+		current->latency_max = latency;
+	}
 
 	LM_DBG("Topic stats (%s): total = %" PRIu64 "  error = %" PRIu64 "\n",
 		   topic, current->total, current->error);
 
-clean:
 	lock_release(stats_lock);
 	
 	return 0;
@@ -1090,6 +1373,24 @@ error:
 	return -1;
 }
 
+/**
+ * \brief count a message that could not be queued or produced.
+ */
+static void kfk_stats_dropped(str *topic)
+{
+	kfk_stats_t *current;
+
+	lock_get(stats_lock);
+
+	stats_general->dropped++;
+	current = kfk_stats_topic_lookup(topic->s, topic->len);
+	if (current) {
+		current->dropped++;
+	}
+
+	lock_release(stats_lock);
+}
+
 /**
  * \brief Get total statistics.
  *
@@ -1155,3 +1456,36 @@ clean:
 
 	return 0;
 }
+
+/**
+ * \brief add the statistics of all topics to a RPC reply.
+ */
+void kfk_stats_rpc_topics(rpc_t *rpc, void *ctx)
+{
+	kfk_stats_t *st;
+	void *th;
+
+	lock_get(stats_lock);
+
+	for (st = stats_general->next; st; st = st->next) {
+		if (rpc->add(ctx, "{", &th) < 0) {
+			rpc->fault(ctx, 500, "Internal error creating rpc");
+			break;
+		}
+		/* 64 bit counters are printed as strings */
+		if (rpc->struct_add(th, "S", "topic", st->topic_name) < 0
+				|| rpc->struct_printf(th, "total", "%" PRIu64, st->total) < 0
+				|| rpc->struct_printf(th, "error", "%" PRIu64, st->error) < 0
+				|| rpc->struct_printf(th, "dropped", "%" PRIu64,
+					st->dropped) < 0
+				|| rpc->struct_printf(th, "latency_avg_us", "%" PRIu64,
+					(st->total > 0) ? st->latency_sum / st->total : 0) < 0
+				|| rpc->struct_printf(th, "latency_max_us", "%" PRIu64,
+					st->latency_max) < 0) {
+			rpc->fault(ctx, 500, "Internal error adding topic");
+			break;
+		}
+	}
+
+	lock_release(stats_lock);
+}
@@ -30,6 +30,9 @@
 #ifndef _KFK_H
 #define _KFK_H
 
+#include "../../core/str.h"
+#include "../../core/rpc.h"
+
 /**
  * \brief Initialize kafka functionality.
  *
@@ -64,6 +67,36 @@ int kfk_topic_parse(char *spec);
  */
 int kfk_message_send(str *topic_name, str *message, str *key);
 
+/**
+ * \brief Initialize the queue for the producer processes.
+ *
+ * \param size maximum number of queued messages.
+ * \return 0 on success.
+ */
+int kfk_queue_init(int size);
+
+/**
+ * \brief Close the queue for the producer processes.
+ */
+void kfk_queue_close();
+
+/**
+ * \brief add a message to the queue of the producer processes.
+ *
+ * \return 0 on success.
+ */
+int kfk_queue_push(str *topic_name, str *message, str *key);
+
+/**
+ * \brief Get the queue length and size.
+ */
+void kfk_queue_get(unsigned int *count, unsigned int *size);
+
+/**
+ * \brief main loop of a producer process.
+ */
+void kfk_producer_run(int rank);
+
 /**
  * \brief Initialize statistics.
  *
@@ -97,4 +130,9 @@ int kfk_stats_get(uint64_t *msg_total, uint64_t *msg_error);
  */
 int kfk_stats_topic_get(str *s_topic, uint64_t *msg_total, uint64_t *msg_error);
 
+/**
+ * \brief add the statistics of all topics to a RPC reply.
+ */
+void kfk_stats_rpc_topics(rpc_t *rpc, void *ctx);
+
 #endif /* KFK_H */
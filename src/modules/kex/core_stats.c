@@ -408,6 +408,8 @@ struct rpc_list_params {
 };
 
 
+static int _stats_hist_pct[] = { 50, 90, 99, 0 };
+
 /**
  * Satistic getter RPC callback.
  */
@@ -416,6 +418,8 @@ static void rpc_get_grp_vars_cbk(void* p, str* g, str* n, counter_handle_t h)
 	struct rpc_list_params *packed_params;
 	rpc_t* rpc;
 	void* ctx;
+	counter_hist_t hv;
+	int i;
 
 	packed_params = p;
 	rpc = packed_params->rpc;
@@ -423,6 +427,17 @@ static void rpc_get_grp_vars_cbk(void* p, str* g, str* n, counter_handle_t h)
 
 	rpc->rpl_printf(ctx, "%.*s:%.*s = %lu",
 		g->len, g->s, n->len, n->s, counter_get_val(h));
+
+	/* histograms - the value above is the count, add sum and percentiles */
+	if (!counter_is_hist(h) || counter_get_hist(h, &hv) < 0)
+		return;
+	rpc->rpl_printf(ctx, "%.*s:%.*s_sum = %lu",
+		g->len, g->s, n->len, n->s, (unsigned long)hv.sum);
+	for (i=0; _stats_hist_pct[i]; i++) {
+		rpc->rpl_printf(ctx, "%.*s:%.*s_p%d = %lu",
+			g->len, g->s, n->len, n->s, _stats_hist_pct[i],
+			counter_hist_quantile(&hv, _stats_hist_pct[i]));
+	}
 }
 
 /**
@@ -513,9 +528,26 @@ static void rpc_fetch_add_stat(rpc_t* rpc, void* ctx, void* hst, char* g, char*
 static void rpc_fetch_grp_vars_cbk(void* p, str* g, str* n, counter_handle_t h)
 {
 	struct rpc_list_params *packed_params = p;
+	counter_hist_t hv;
+	char nbuf[128];
+	int i;
 
 	rpc_fetch_add_stat(packed_params->rpc, packed_params->ctx, packed_params->hst,
 					   g->s, n->s, counter_get_val(h), packed_params->numeric);
+
+	/* histograms - the value above is the count, add sum and percentiles */
+	if (!counter_is_hist(h) || counter_get_hist(h, &hv) < 0)
+		return;
+	snprintf(nbuf, 127, "%s_sum", n->s);
+	rpc_fetch_add_stat(packed_params->rpc, packed_params->ctx, packed_params->hst,
+					   g->s, nbuf, (unsigned long)hv.sum, packed_params->numeric);
+	for (i=0; _stats_hist_pct[i]; i++) {
+		snprintf(nbuf, 127, "%s_p%d", n->s, _stats_hist_pct[i]);
+		rpc_fetch_add_stat(packed_params->rpc, packed_params->ctx,
+					packed_params->hst, g->s, nbuf,
+					counter_hist_quantile(&hv, _stats_hist_pct[i]),
+					packed_params->numeric);
+	}
 }
 
 /**
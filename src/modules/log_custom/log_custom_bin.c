@@ -0,0 +1,279 @@
+/**
+ * Copyright (C) 2021 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * This file is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ *
+ * This file is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+
+#include "../../core/dprint.h"
+#include "../../core/pt.h"
+#include "../../core/hashes.h"
+#include "../../core/action.h"
+#include "../../core/sr_module.h"
+
+#include "log_custom_bin.h"
+
+static char *_lc_bin_dir = NULL;
+static int _lc_bin_size = 0;
+
+/* per process mapping of the ring file */
+static lc_bin_hdr_t *_lc_bin_hdr = NULL;
+static char *_lc_bin_ring = NULL;
+static size_t _lc_bin_msize = 0;
+static int _lc_bin_pid = 0; /* process owning the mapping */
+
+static inline uint64_t lc_bin_tsus(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return (uint64_t)tv.tv_sec * 1000000 + (uint64_t)tv.tv_usec;
+}
+
+/**
+ *
+ */
+int lc_bin_init(char *dir, int size)
+{
+	struct stat st;
+
+	if(dir == NULL || *dir == '\0') {
+		return 0;
+	}
+	if(size < 4096) {
+		LM_WARN("ring size too small (%d) - using 4096\n", size);
+		size = 4096;
+	}
+	if(stat(dir, &st) < 0 || !S_ISDIR(st.st_mode)) {
+		LM_ERR("binary log directory [%s] not accessible\n", dir);
+		return -1;
+	}
+	_lc_bin_dir = dir;
+	_lc_bin_size = LC_BIN_ALIGN(size);
+	return 0;
+}
+
+/**
+ *
+ */
+int lc_bin_child_init(int rank)
+{
+	char fpath[256];
+	int fd;
+	void *p;
+	int n;
+
+	if(_lc_bin_dir == NULL || rank == PROC_INIT) {
+		return 0;
+	}
+	if(_lc_bin_hdr != NULL) {
+		if(_lc_bin_pid == my_pid()) {
+			/* already done for another rank of this process (e.g.,
+			 * PROC_MAIN and PROC_SIPINIT in no fork mode) */
+			return 0;
+		}
+		/* mapping of the parent process, inherited by fork */
+		munmap(_lc_bin_hdr, _lc_bin_msize);
+		_lc_bin_hdr = NULL;
+		_lc_bin_ring = NULL;
+	}
+
+	n = snprintf(fpath, sizeof(fpath), "%s/kamailio-%d.lcbin", _lc_bin_dir,
+			process_no);
+	if(n < 0 || n >= sizeof(fpath)) {
+		LM_ERR("binary log file path too long\n");
+		return -1;
+	}
+	fd = open(fpath, O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP);
+	if(fd < 0) {
+		LM_ERR("failed to open file [%s] (%d: %s)\n", fpath, errno,
+				strerror(errno));
+		return -1;
+	}
+	_lc_bin_msize = sizeof(lc_bin_hdr_t) + _lc_bin_size;
+	if(ftruncate(fd, _lc_bin_msize) < 0) {
+		LM_ERR("failed to resize file [%s] (%d: %s)\n", fpath, errno,
+				strerror(errno));
+		close(fd);
+		return -1;
+	}
+	p = mmap(NULL, _lc_bin_msize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if(p == MAP_FAILED) {
+		LM_ERR("failed to map file [%s] (%d: %s)\n", fpath, errno,
+				strerror(errno));
+		return -1;
+	}
+	_lc_bin_hdr = (lc_bin_hdr_t *)p;
+	_lc_bin_ring = (char *)p + sizeof(lc_bin_hdr_t);
+	_lc_bin_pid = my_pid();
+
+	memset(_lc_bin_hdr, 0, sizeof(lc_bin_hdr_t));
+	_lc_bin_hdr->version = LC_BIN_VERSION;
+	_lc_bin_hdr->hsize = sizeof(lc_bin_hdr_t);
+	_lc_bin_hdr->size = _lc_bin_size;
+	_lc_bin_hdr->stime = lc_bin_tsus();
+	_lc_bin_hdr->pid = my_pid();
+	_lc_bin_hdr->pno = process_no;
+	if(pt != NULL) {
+		strncpy(_lc_bin_hdr->pdesc, pt[process_no].desc,
+				sizeof(_lc_bin_hdr->pdesc) - 1);
+	}
+	/* magic set last - the file is valid from now on */
+	_lc_bin_hdr->magic = LC_BIN_MAGIC;
+
+	return 0;
+}
+
+/**
+ *
+ */
+void lc_bin_destroy(void)
+{
+	if(_lc_bin_hdr == NULL) {
+		return;
+	}
+	msync(_lc_bin_hdr, _lc_bin_msize, MS_ASYNC);
+	munmap(_lc_bin_hdr, _lc_bin_msize);
+	_lc_bin_hdr = NULL;
+	_lc_bin_ring = NULL;
+}
+
+/**
+ *
+ */
+int lc_bin_enabled(void)
+{
+	return (_lc_bin_hdr != NULL) ? 1 : 0;
+}
+
+/**
+ * advance the tail past the records overlapping [from, to)
+ */
+static void lc_bin_reclaim(uint64_t from, uint64_t to)
+{
+	lc_bin_rec_t *r;
+	uint64_t tail;
+
+	if(_lc_bin_hdr->wrapped == 0) {
+		return;
+	}
+	tail = _lc_bin_hdr->tail;
+	while(tail >= from && tail < to) {
+		if(_lc_bin_size - tail < sizeof(lc_bin_rec_t)) {
+			tail = 0;
+			break;
+		}
+		r = (lc_bin_rec_t *)(_lc_bin_ring + tail);
+		if(r->size == 0) {
+			tail = 0;
+			break;
+		}
+		tail += r->size;
+		if(tail >= _lc_bin_size) {
+			tail = 0;
+			break;
+		}
+	}
+	_lc_bin_hdr->tail = tail;
+}
+
+/**
+ *
+ */
+int lc_bin_write(sip_msg_t *msg, int etype, str *payload)
+{
+	lc_bin_rec_t *r;
+	char *rname;
+	uint64_t head;
+	int rlen;
+	int plen;
+	int rsize;
+
+	if(_lc_bin_hdr == NULL) {
+		return -1;
+	}
+	if(etype <= LC_BIN_EV_PAD || etype > 255) {
+		LM_ERR("invalid event type: %d\n", etype);
+		return -1;
+	}
+
+	rname = get_cfg_crt_route_name();
+	rlen = (rname != NULL) ? strlen(rname) : 0;
+	if(rlen > 255) {
+		rlen = 255;
+	}
+	plen = (payload != NULL && payload->s != NULL) ? payload->len : 0;
+	if(plen > LC_BIN_PAYLOAD_MAX) {
+		plen = LC_BIN_PAYLOAD_MAX;
+	}
+	rsize = LC_BIN_ALIGN(sizeof(lc_bin_rec_t) + rlen + plen);
+
+	head = _lc_bin_hdr->head;
+	if(head + rsize > _lc_bin_size) {
+		/* no wrap inside a record - pad the rest of the ring and restart */
+		_lc_bin_hdr->wrapped = 1;
+		lc_bin_reclaim(head, _lc_bin_size);
+		if(_lc_bin_size - head >= sizeof(lc_bin_rec_t)) {
+			r = (lc_bin_rec_t *)(_lc_bin_ring + head);
+			memset(r, 0, sizeof(lc_bin_rec_t));
+			r->size = _lc_bin_size - head;
+			r->etype = LC_BIN_EV_PAD;
+		}
+		head = 0;
+	}
+	lc_bin_reclaim(head, head + rsize);
+
+	r = (lc_bin_rec_t *)(_lc_bin_ring + head);
+	r->size = rsize;
+	r->etype = etype;
+	r->rlen = rlen;
+	r->plen = plen;
+	r->flags = 0;
+	r->tsus = lc_bin_tsus();
+	r->msgid = 0;
+	r->cidhash = 0;
+	if(msg != NULL) {
+		r->msgid = msg->id;
+		if(parse_headers(msg, HDR_CALLID_F, 0) == 0 && msg->callid != NULL) {
+			r->cidhash = get_hash1_raw(
+					msg->callid->body.s, msg->callid->body.len);
+		}
+	}
+	if(rlen > 0) {
+		memcpy((char *)r + sizeof(lc_bin_rec_t), rname, rlen);
+	}
+	if(plen > 0) {
+		memcpy((char *)r + sizeof(lc_bin_rec_t) + rlen, payload->s, plen);
+	}
+
+	_lc_bin_hdr->head = head + rsize;
+	_lc_bin_hdr->nrecs++;
+
+	return 0;
+}
@@ -0,0 +1,83 @@
+/**
+ * Copyright (C) 2021 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * This file is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ *
+ * This file is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#ifndef _LOG_CUSTOM_BIN_H_
+#define _LOG_CUSTOM_BIN_H_
+
+#include <stdint.h>
+
+#include "../../core/str.h"
+#include "../../core/parser/msg_parser.h"
+
+/*
+ * Binary event log layout - one memory mapped ring file per process.
+ *
+ * The file starts with a lc_bin_hdr_t, followed by 'size' bytes of ring
+ * space. Records are 8 bytes aligned and never wrap around the end of the
+ * ring - the remaining space is filled with a LC_BIN_EV_PAD record instead.
+ * 'tail' is the offset of the oldest complete record, 'head' is the offset
+ * where the next record is written. The layout must be kept in sync with
+ * utils/lcbindec/lcbindec.c.
+ */
+
+#define LC_BIN_MAGIC 0x42434c4b /* "KLCB" */
+#define LC_BIN_VERSION 1
+
+#define LC_BIN_EV_PAD 0
+
+#define LC_BIN_PAYLOAD_MAX 1024
+#define LC_BIN_ALIGN(x) (((x) + 7) & ~7)
+
+typedef struct lc_bin_hdr {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t hsize;     /* size of this header */
+	uint32_t size;      /* size of the ring space */
+	uint32_t wrapped;   /* set once the ring has been filled */
+	uint64_t head;      /* offset of next write */
+	uint64_t tail;      /* offset of the oldest record */
+	uint64_t nrecs;     /* total records written */
+	uint64_t stime;     /* start time (microseconds since epoch) */
+	int32_t pid;
+	int32_t pno;        /* index in the process table */
+	char pdesc[64];     /* process description */
+} lc_bin_hdr_t;
+
+typedef struct lc_bin_rec {
+	uint16_t size;      /* total record size, including padding */
+	uint8_t etype;      /* event type - 0 is reserved for padding */
+	uint8_t rlen;       /* length of the route name */
+	uint16_t plen;      /* length of the payload */
+	uint16_t flags;     /* reserved */
+	uint32_t msgid;     /* sip message id */
+	uint32_t cidhash;   /* hash over Call-ID value */
+	uint64_t tsus;      /* timestamp (microseconds since epoch) */
+	/* followed by rlen bytes of route name and plen bytes of payload */
+} lc_bin_rec_t;
+
+int lc_bin_init(char *dir, int size);
+int lc_bin_child_init(int rank);
+void lc_bin_destroy(void);
+int lc_bin_enabled(void);
+int lc_bin_write(sip_msg_t *msg, int etype, str *payload);
+
+#endif
@@ -34,26 +34,36 @@
 #include "../../core/udp_server.h"
 #include "../../core/kemi.h"
 
+#include "log_custom_bin.h"
+
 MODULE_VERSION
 
 static int _lc_log_udp = 0;
 static struct dest_info _lc_udp_dst = {0};
 
+static char *_lc_bin_dir = NULL;
+static int _lc_bin_size = 1024*1024;
+
 static int  mod_init(void);
 static int  child_init(int);
 static void mod_destroy(void);
 
 static int w_log_udp(struct sip_msg* msg, char* txt, char* p2);
+static int w_log_bin(struct sip_msg* msg, char* etype, char* txt);
 
 void _lc_core_log_udp(int lpriority, const char *format, ...);
 
 static cmd_export_t cmds[]={
 	{"log_udp", (cmd_function)w_log_udp, 1, fixup_spve_null,
 		0, ANY_ROUTE},
+	{"log_bin", (cmd_function)w_log_bin, 2, fixup_igp_spve,
+		fixup_free_igp_spve, ANY_ROUTE},
 	{0, 0, 0, 0, 0, 0}
 };
 
 static param_export_t params[]={
+	{"bin_dir",  PARAM_STRING, &_lc_bin_dir},
+	{"bin_size", PARAM_INT,    &_lc_bin_size},
 	{0, 0, 0}
 };
 
@@ -75,6 +85,9 @@ struct module_exports exports = {
  */
 static int mod_init(void)
 {
+	if(lc_bin_init(_lc_bin_dir, _lc_bin_size)<0) {
+		return -1;
+	}
 	return 0;
 }
 
@@ -83,7 +96,10 @@ static int mod_init(void)
  */
 static int child_init(int rank)
 {
-	if(rank!=PROC_INIT)
+	if(lc_bin_child_init(rank)<0)
+		return -1;
+
+	if(rank!=PROC_INIT || _lc_udp_dst.to.s.sa_family==0)
 		return 0;
 
 	_lc_udp_dst.proto = PROTO_UDP;
@@ -108,6 +124,7 @@ static int child_init(int rank)
  */
 static void mod_destroy(void)
 {
+	lc_bin_destroy();
 }
 
 /**
@@ -133,6 +150,32 @@ static int w_log_udp(struct sip_msg* msg, char* txt, char* p2)
 	return ret;
 }
 
+/**
+ *
+ */
+static int w_log_bin(struct sip_msg* msg, char* etype, char* txt)
+{
+	int ietype;
+	str stxt;
+
+	if(!lc_bin_enabled())
+		return 1;
+
+	if(fixup_get_ivalue(msg, (gparam_t*)etype, &ietype)!=0) {
+		LM_ERR("unable to get event type parameter\n");
+		return -1;
+	}
+	if(fixup_get_svalue(msg, (gparam_t*)txt, &stxt)!=0) {
+		LM_ERR("unable to get text parameter\n");
+		return -1;
+	}
+
+	if(lc_bin_write(msg, ietype, &stxt)<0)
+		return -1;
+
+	return 1;
+}
+
 #define LC_LOG_MSG_MAX_SIZE	16384
 void _lc_core_log_udp(int lpriority, const char *format, ...)
 {
@@ -170,6 +213,20 @@ int ki_log_udp(sip_msg_t *msg, str *txt)
 
 }
 
+/**
+ *
+ */
+static int ki_log_bin(sip_msg_t *msg, int etype, str *txt)
+{
+	if(!lc_bin_enabled())
+		return 1;
+
+	if(lc_bin_write(msg, etype, txt)<0)
+		return -1;
+
+	return 1;
+}
+
 /**
  *
  */
@@ -180,6 +237,11 @@ static sr_kemi_t sr_kemi_log_custom_exports[] = {
 		{ SR_KEMIP_STR, SR_KEMIP_NONE, SR_KEMIP_NONE,
 			SR_KEMIP_NONE, SR_KEMIP_NONE, SR_KEMIP_NONE }
 	},
+	{ str_init("log_custom"), str_init("log_bin"),
+		SR_KEMIP_INT, ki_log_bin,
+		{ SR_KEMIP_INT, SR_KEMIP_STR, SR_KEMIP_NONE,
+			SR_KEMIP_NONE, SR_KEMIP_NONE, SR_KEMIP_NONE }
+	},
 
 	{ {0, 0}, {0, 0}, 0, NULL, { 0, 0, 0, 0, 0, 0 } }
 };
@@ -192,6 +254,8 @@ int mod_register(char *path, int *dlflags, void *p1, void *p2)
 	struct sip_uri next_hop, *u;
 	char *p;
 
+	sr_kemi_modules_add(sr_kemi_log_custom_exports);
+
 	if(_km_log_engine_type==0 || _km_log_engine_data==0)
 		return 0;
 
@@ -227,6 +291,5 @@ int mod_register(char *path, int *dlflags, void *p1, void *p2)
 		return -1;
 	}
 
-	sr_kemi_modules_add(sr_kemi_log_custom_exports);
 	return 0;
 }
@@ -24,6 +24,12 @@
 #include <unistd.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#ifdef __OS_linux
+#include <sys/eventfd.h>
+#define MQ_CONSUMER_EVENTFD
+#endif
 
 #include "../../core/dprint.h"
 #include "../../core/mem/mem.h"
@@ -32,6 +38,8 @@
 #include "../../core/ut.h"
 #include "../../core/shm_init.h"
 #include "../../core/fmsg.h"
+#include "../../core/xavp.h"
+#include "../../core/atomic_ops.h"
 
 #include "mqueue_api.h"
 #include "mqueue_db.h"
@@ -46,6 +54,155 @@ static mq_head_t *_mq_head_list = NULL;
  */
 static mq_pv_t *_mq_pv_list = NULL;
 
+/* default number of slots and max size of key plus value for ring queues */
+#define MQ_RING_SIZE	1024
+#define MQ_RING_ISIZE	256
+
+/* max number of items fetched at once in a xavp */
+#define MQ_FETCH_XAVP_MAX	256
+
+#define mq_ring_slot(rg, pos) \
+	((mq_ring_item_t*)((rg)->items + ((pos) & (rg)->mask) * (rg)->istep))
+
+/**
+ * add an item to the ring queue
+ * - multi-producer safe, a slot is owned after moving the tail over it
+ * @return 0 on success, -2 if the queue is full
+ */
+static int mq_ring_push(mq_ring_t *rg, str *key, str *val)
+{
+	mq_ring_item_t *it;
+	unsigned int pos;
+	unsigned int seq;
+	char *p;
+	int dif;
+
+	pos = rg->tail;
+	for(;;) {
+		it = mq_ring_slot(rg, pos);
+		seq = it->seq;
+		membar_read();
+		dif = (int)(seq - pos);
+		if(dif == 0) {
+			if((unsigned int)atomic_cmpxchg_int((volatile int*)&rg->tail,
+						(int)pos, (int)(pos + 1)) == pos) {
+				break;
+			}
+			pos = rg->tail;
+		} else if(dif < 0) {
+			/* full */
+			return -2;
+		} else {
+			pos = rg->tail;
+		}
+	}
+	p = (char*)it + sizeof(mq_ring_item_t);
+	memcpy(p, key->s, key->len);
+	p[key->len] = '\0';
+	memcpy(p + key->len + 1, val->s, val->len);
+	p[key->len + 1 + val->len] = '\0';
+	it->klen = key->len;
+	it->vlen = val->len;
+	/* publish the item */
+	membar_write();
+	it->seq = pos + 1;
+	return 0;
+}
+
+/**
+ * get the oldest item from the ring queue, copying it in mi (if not null)
+ * - multi-consumer safe, a slot is owned after moving the head over it
+ * @return 0 on success, -2 if the queue is empty
+ */
+static int mq_ring_pop(mq_ring_t *rg, mq_item_t *mi)
+{
+	mq_ring_item_t *it;
+	unsigned int pos;
+	unsigned int seq;
+	char *p;
+	int dif;
+
+	pos = rg->head;
+	for(;;) {
+		it = mq_ring_slot(rg, pos);
+		seq = it->seq;
+		membar_read();
+		dif = (int)(seq - (pos + 1));
+		if(dif == 0) {
+			if((unsigned int)atomic_cmpxchg_int((volatile int*)&rg->head,
+						(int)pos, (int)(pos + 1)) == pos) {
+				break;
+			}
+			pos = rg->head;
+		} else if(dif < 0) {
+			/* empty */
+			return -2;
+		} else {
+			pos = rg->head;
+		}
+	}
+	if(mi != NULL) {
+		p = (char*)it + sizeof(mq_ring_item_t);
+		mi->key.len = it->klen;
+		memcpy(mi->key.s, p, it->klen + 1);
+		mi->val.s = mi->key.s + it->klen + 1;
+		mi->val.len = it->vlen;
+		memcpy(mi->val.s, p + it->klen + 1, it->vlen + 1);
+		mi->next = NULL;
+	}
+	/* release the slot for the next round of the producers */
+	membar();
+	it->seq = pos + rg->mask + 1;
+	return 0;
+}
+
+/**
+ * allocate a private item buffer able to hold a ring queue item
+ */
+static mq_item_t *mq_ring_item_new(mq_ring_t *rg)
+{
+	mq_item_t *mi;
+
+	mi = (mq_item_t*)pkg_malloc(sizeof(mq_item_t) + rg->isize + 2);
+	if(mi==NULL)
+	{
+		PKG_MEM_ERROR;
+		return NULL;
+	}
+	memset(mi, 0, sizeof(mq_item_t));
+	mi->key.s = (char*)mi + sizeof(mq_item_t);
+	return mi;
+}
+
+/**
+ * release the item fetched in the process
+ */
+static void mq_pv_item_free(mq_pv_t *mp)
+{
+	if(mp->item!=NULL && mp->item!=mp->ritem)
+		shm_free(mp->item);
+	mp->item = NULL;
+}
+
+/**
+ * wake up the consumer process if it waits for items
+ */
+static void mq_consumer_wake(mq_head_t *mh)
+{
+	unsigned long long v = 1;
+
+	if(mh->consumer==0)
+		return;
+	membar();
+	if(mh->csleep==0)
+		return;
+	if(atomic_cmpxchg_int((volatile int*)&mh->csleep, 1, 0)!=1)
+		return;
+	if(write(mh->efd[1], &v, sizeof(v))<0 && errno!=EAGAIN)
+		LM_ERR("failed to wake up consumer of: %.*s (%d)\n",
+				mh->name.len, mh->name.s, errno);
+}
+
 /**
  *
  */
@@ -86,6 +243,8 @@ void mq_destroy(void)
 		mh1 = mh;
 		mh = mh->next;
 		lock_destroy(&mh1->lock);
+		if(mh1->ring!=NULL)
+			shm_free(mh1->ring);
 		shm_free(mh1);
 	}
 	_mq_head_list = 0;
@@ -94,6 +253,8 @@ void mq_destroy(void)
 	{
 		mp1 = mp;
 		mp = mp->next;
+		if(mp1->ritem!=NULL)
+			pkg_free(mp1->ritem);
 		pkg_free(mp1);
 	}
 }
@@ -155,6 +316,8 @@ int mq_head_add(str *name, int msize)
 	mh->name.len = name->len;
 	mh->name.s[name->len] = '\0';
 	mh->msize = msize;
+	mh->efd[0] = -1;
+	mh->efd[1] = -1;
 	mh->next = _mq_head_list;
 	_mq_head_list = mh;
 
@@ -209,6 +372,118 @@ int mq_set_dbmode(str *name, int dbmode)
 	return -1;
 }
 
+/**
+ * turn the queue in a ring buffer with isize bytes for key plus value
+ */
+int mq_set_ring(str *name, int isize)
+{
+	mq_head_t *mh = NULL;
+	mq_ring_t *rg = NULL;
+	unsigned int size;
+	unsigned int i;
+	int istep;
+
+	mh = mq_head_get(name);
+	if(mh==NULL)
+		return -1;
+	if(isize<=0)
+		isize = MQ_RING_ISIZE;
+	if(mh->msize<=0)
+		mh->msize = MQ_RING_SIZE;
+	for(size=1; size<(unsigned int)mh->msize; size<<=1);
+	istep = (sizeof(mq_ring_item_t) + isize + 2 + 7) & ~7;
+
+	rg = (mq_ring_t*)shm_malloc(sizeof(mq_ring_t) + size * istep);
+	if(rg==NULL)
+	{
+		LM_ERR("no more shm for: %.*s\n", name->len, name->s);
+		return -1;
+	}
+	memset(rg, 0, sizeof(mq_ring_t));
+	rg->mask = size - 1;
+	rg->isize = isize;
+	rg->istep = istep;
+	rg->items = (char*)rg + sizeof(mq_ring_t);
+	for(i=0; i<size; i++)
+		mq_ring_slot(rg, i)->seq = i;
+	mh->msize = (int)size;
+	mh->ring = rg;
+	return 0;
+}
+
+/**
+ *
+ */
+int mq_set_consumer(str *name)
+{
+	mq_head_t *mh = NULL;
+
+	mh = mq_head_get(name);
+	if(mh==NULL)
+		return -1;
+	mh->consumer = 1;
+	return 0;
+}
+
+/**
+ * create the wake up channels for the queues with consumer process
+ * @return number of consumer processes, -1 on error
+ */
+int mq_consumer_init(void)
+{
+	mq_head_t *mh = NULL;
+	int n = 0;
+	int val;
+
+	for(mh=_mq_head_list; mh!=NULL; mh=mh->next)
+	{
+		if(mh->consumer==0)
+			continue;
+		n++;
+#ifdef MQ_CONSUMER_EVENTFD
+		mh->efd[0] = eventfd(0, 0);
+		if(mh->efd[0] >= 0) {
+			mh->efd[1] = mh->efd[0];
+			continue;
+		}
+		LM_WARN("failed to create eventfd for: %.*s (%d: %s) - using pipe\n",
+				mh->name.len, mh->name.s, errno, strerror(errno));
+#endif
+		if(pipe(mh->efd)<0)
+		{
+			LM_ERR("failed to create pipe for: %.*s (%d: %s)\n",
+					mh->name.len, mh->name.s, errno, strerror(errno));
+			return -1;
+		}
+		val = fcntl(mh->efd[1], F_GETFL, 0);
+		if(val<0 || fcntl(mh->efd[1], F_SETFL, val | O_NONBLOCK)<0)
+			LM_WARN("failed to set nonblock flag for: %.*s\n",
+					mh->name.len, mh->name.s);
+	}
+	return n;
+}
+
+/**
+ * block the consumer process until items are added to the queue
+ */
+void mq_consumer_wait(mq_head_t *mh)
+{
+	char buf[64];
+
+	mh->csleep = 1;
+	membar();
+	if(mq_head_csize(mh)>0) {
+		mh->csleep = 0;
+		return;
+	}
+	if(read(mh->efd[0], buf, sizeof(buf))<0 && errno!=EINTR) {
+		LM_ERR("failed to wait for items in: %.*s (%d)\n",
+				mh->name.len, mh->name.s, errno);
+		mh->csleep = 0;
+		sleep_us(100000);
+	}
+}
+
 /**
  *
  */
@@ -238,14 +513,19 @@ int mq_head_fetch(str *name)
 	mp = mq_pv_get(name);
 	if(mp==NULL)
 		return -1;
-	if(mp->item!=NULL)
-	{
-		shm_free(mp->item);
-		mp->item = NULL;
-	}
+	mq_pv_item_free(mp);
 	mh = mq_head_get(name);
 	if(mh==NULL)
 		return -1;
+	if(mh->ring!=NULL)
+	{
+		if(mp->ritem==NULL && (mp->ritem = mq_ring_item_new(mh->ring))==NULL)
+			return -1;
+		if(mq_ring_pop(mh->ring, mp->ritem)<0)
+			return -2;
+		mp->item = mp->ritem;
+		return 0;
+	}
 	lock_get(&mh->lock);
 
 	if(mh->ifirst==NULL)
@@ -276,11 +556,7 @@ void mq_pv_free(str *name)
 	mp = mq_pv_get(name);
 	if(mp==NULL)
 		return;
-	if(mp->item!=NULL)
-	{
-		shm_free(mp->item);
-		mp->item = NULL;
-	}
+	mq_pv_item_free(mp);
 }
 
 /**
@@ -298,6 +574,22 @@ int mq_item_add(str *qname, str *key, str *val)
 		LM_ERR("mqueue not found: %.*s\n", qname->len, qname->s);
 		return -1;
 	}
+	if(mh->ring!=NULL)
+	{
+		if(key->len + val->len > mh->ring->isize)
+		{
+			LM_ERR("item too large (%d) for: %.*s\n", key->len + val->len,
+					qname->len, qname->s);
+			return -1;
+		}
+		while(mq_ring_push(mh->ring, key, val)==-2)
+		{
+			/* full - drop the oldest item */
+			mq_ring_pop(mh->ring, NULL);
+		}
+		mq_consumer_wake(mh);
+		return 0;
+	}
 	len = sizeof(mq_item_t) + key->len + val->len + 2;
 	mi = (mq_item_t*)shm_malloc(len);
 	if(mi==NULL)
@@ -338,9 +630,111 @@ int mq_item_add(str *qname, str *key, str *val)
 		shm_free(mi);
 	}
 	lock_release(&mh->lock);
+	mq_consumer_wake(mh);
 	return 0;
 }
 
+/**
+ * build the xavp list with key and val of an item
+ */
+static sr_xavp_t *mq_item_xavp(mq_item_t *mi)
+{
+	sr_xavp_t *xlist = NULL;
+	sr_xval_t xval;
+	str kname = str_init("key");
+	str vname = str_init("val");
+
+	memset(&xval, 0, sizeof(sr_xval_t));
+	xval.type = SR_XTYPE_STR;
+	xval.v.s = mi->val;
+	if(xavp_add_value(&vname, &xval, &xlist)==NULL)
+		goto error;
+	xval.v.s = mi->key;
+	if(xavp_add_value(&kname, &xval, &xlist)==NULL)
+		goto error;
+	return xlist;
+
+error:
+	LM_ERR("failed to add item to xavp\n");
+	if(xlist!=NULL)
+		xavp_destroy_list(&xlist);
+	return NULL;
+}
+
+/**
+ * fetch up to n items at once, each added as xavp xname with the fields
+ * key and val - the oldest item is at index 0
+ * @return number of items, -2 if the queue is empty, -1 on error
+ */
+int mq_fetch_xavp(str *name, str *xname, int n)
+{
+	mq_head_t *mh = NULL;
+	mq_item_t *mi = NULL;
+	mq_item_t *mi1 = NULL;
+	sr_xavp_t *xl[MQ_FETCH_XAVP_MAX];
+	sr_xval_t xval;
+	int k;
+	int i;
+
+	mh = mq_head_get(name);
+	if(mh==NULL)
+	{
+		LM_ERR("mqueue not found: %.*s\n", name->len, name->s);
+		return -1;
+	}
+	if(n<=0 || n>MQ_FETCH_XAVP_MAX)
+		n = MQ_FETCH_XAVP_MAX;
+
+	k = 0;
+	if(mh->ring!=NULL)
+	{
+		if((mi = mq_ring_item_new(mh->ring))==NULL)
+			return -1;
+		while(k<n && mq_ring_pop(mh->ring, mi)==0)
+			xl[k++] = mq_item_xavp(mi);
+		pkg_free(mi);
+	} else {
+		/* detach the items with one lock hold */
+		lock_get(&mh->lock);
+		mi = mh->ifirst;
+		for(mi1=NULL; k<n && mh->ifirst!=NULL; k++)
+		{
+			mi1 = mh->ifirst;
+			mh->ifirst = mh->ifirst->next;
+			mh->csize--;
+		}
+		if(mh->ifirst==NULL)
+			mh->ilast = NULL;
+		if(mi1!=NULL)
+			mi1->next = NULL;
+		lock_release(&mh->lock);
+		for(i=0; mi!=NULL && i<k; i++)
+		{
+			mi1 = mi;
+			mi = mi->next;
+			xl[i] = mq_item_xavp(mi1);
+			shm_free(mi1);
+		}
+	}
+	if(k==0)
+		return -2;
+
+	memset(&xval, 0, sizeof(sr_xval_t));
+	xval.type = SR_XTYPE_XAVP;
+	for(i=k-1; i>=0; i--)
+	{
+		if(xl[i]==NULL)
+			continue;
+		xval.v.xavp = xl[i];
+		if(xavp_add_value(xname, &xval, NULL)==NULL)
+		{
+			LM_ERR("failed to add xavp: %.*s\n", xname->len, xname->s);
+			xavp_destroy_list(&xl[i]);
+		}
+	}
+	return k;
+}
+
 /**
  *
  */
@@ -519,6 +913,27 @@ int _mq_get_csize(str *name)
 	if(mh == NULL)
 		return -1;
 
+	mqueue_size = mq_head_csize(mh);
+
+	return mqueue_size;
+}
+
+/**
+ * Return the number of items in the queue
+ */
+int mq_head_csize(mq_head_t *mh)
+{
+	int mqueue_size = 0;
+
+	if(mh->ring != NULL) {
+		mqueue_size = (int)(mh->ring->tail - mh->ring->head);
+		if(mqueue_size < 0)
+			mqueue_size = 0;
+		else if(mqueue_size > mh->msize)
+			mqueue_size = mh->msize;
+		return mqueue_size;
+	}
+
 	lock_get(&mh->lock);
 	mqueue_size = mh->csize;
 	lock_release(&mh->lock);
@@ -36,6 +36,33 @@ typedef struct _mq_item
 	struct _mq_item *next;
 } mq_item_t;
 
+#define MQ_CACHELINE_SIZE 64
+
+/**
+ * ring queue slot header - key and value are stored after it
+ */
+typedef struct _mq_ring_item
+{
+	volatile unsigned int seq;
+	int klen;
+	int vlen;
+} mq_ring_item_t;
+
+/**
+ * bounded ring queue, lock free for producers and consumers
+ */
+typedef struct _mq_ring
+{
+	volatile unsigned int head;   /* next position to consume */
+	char pad1[MQ_CACHELINE_SIZE - sizeof(unsigned int)];
+	volatile unsigned int tail;   /* next position to produce */
+	char pad2[MQ_CACHELINE_SIZE - sizeof(unsigned int)];
+	unsigned int mask;
+	int isize;                    /* max size of key plus value */
+	int istep;                    /* size of a slot */
+	char *items;
+} mq_ring_t;
+
 /**
  *
  */
@@ -48,6 +75,10 @@ typedef struct _mq_head
 	gen_lock_t lock;
 	mq_item_t *ifirst;
 	mq_item_t *ilast;
+	mq_ring_t *ring;          /* set for ring queues */
+	int consumer;             /* has a consumer process */
+	int efd[2];               /* consumer wake up (eventfd or pipe) */
+	volatile int csleep;      /* consumer waits for items */
 	struct _mq_head *next;
 } mq_head_t;
 
@@ -58,6 +89,7 @@ typedef struct _mq_pv
 {
 	str *name;
 	mq_item_t *item;
+	mq_item_t *ritem;         /* private buffer for ring queue items */
 	struct _mq_pv *next;
 } mq_pv_t;
 
@@ -80,7 +112,13 @@ int mq_item_add(str *qname, str *key, str *val);
 mq_head_t *mq_head_get(str *name);
 
 int _mq_get_csize(str *);
+int mq_head_csize(mq_head_t *mh);
 int mq_set_dbmode(str *, int dbmode);
+int mq_set_ring(str *name, int isize);
+int mq_set_consumer(str *name);
+int mq_consumer_init(void);
+void mq_consumer_wait(mq_head_t *mh);
+int mq_fetch_xavp(str *name, str *xname, int n);
 
 #endif
 
@@ -35,6 +35,11 @@
 #include "../../core/parser/parse_param.h"
 #include "../../core/shm_init.h"
 #include "../../core/kemi.h"
+#include "../../core/pt.h"
+#include "../../core/fmsg.h"
+#include "../../core/route.h"
+#include "../../core/receive.h"
+#include "../../core/cfg/cfg_struct.h"
 
 #include "mqueue_api.h"
 #include "mqueue_db.h"
@@ -43,18 +48,25 @@
 MODULE_VERSION
 
 static int  mod_init(void);
+static int  child_init(int);
 static void mod_destroy(void);
 
 static int w_mq_fetch(struct sip_msg* msg, char* mq, char* str2);
 static int w_mq_size(struct sip_msg *msg, char *mq, char *str2);
 static int w_mq_add(struct sip_msg* msg, char* mq, char* key, char* val);
 static int w_mq_pv_free(struct sip_msg* msg, char* mq, char* str2);
+static int w_mq_fetch_xavp(struct sip_msg* msg, char* mq, char* xname,
+		char* n);
 int mq_param(modparam_t type, void *val);
 static int fixup_mq_add(void** param, int param_no);
+static int fixup_mq_fetch_xavp(void** param, int param_no);
 static int bind_mq(mq_api_t* api);
 
 static int mqueue_rpc_init(void);
 
+static str _mq_event_callback = STR_NULL;
+static int _mq_consumers = 0;
+
 
 static pv_export_t mod_pvs[] = {
 	{ {"mqk", sizeof("mqk")-1}, PVT_OTHER, pv_get_mqk, 0,
@@ -76,6 +88,8 @@ static cmd_export_t cmds[]={
 		0, ANY_ROUTE},
 	{"mq_size", (cmd_function) w_mq_size, 1, fixup_spve_null,
 		0, ANY_ROUTE},
+	{"mq_fetch_xavp", (cmd_function)w_mq_fetch_xavp, 3, fixup_mq_fetch_xavp,
+		0, ANY_ROUTE},
 	{"bind_mq", (cmd_function)bind_mq, 1, 0,
 		0, ANY_ROUTE},
 	{0, 0, 0, 0, 0, 0}
@@ -84,6 +98,7 @@ static cmd_export_t cmds[]={
 static param_export_t params[]={
 	{"db_url",          PARAM_STR, &mqueue_db_url},
 	{"mqueue",          PARAM_STRING|USE_FUNC_PARAM, (void*)mq_param},
+	{"event_callback",  PARAM_STR, &_mq_event_callback},
 	{0, 0, 0}
 };
 
@@ -96,7 +111,7 @@ struct module_exports exports = {
 	mod_pvs,        /* exported pseudo-variables */
 	0,              /* response function */
 	mod_init,       /* module initialization function */
-	0,              /* per child init function */
+	child_init,     /* per child init function */
 	mod_destroy     /* destroy function */
 };
 
@@ -115,6 +130,119 @@ static int mod_init(void)
 		return 1;
 	}
 
+	_mq_consumers = mq_consumer_init();
+	if(_mq_consumers < 0) {
+		LM_ERR("failed to init the consumers\n");
+		return 1;
+	}
+	if(_mq_consumers > 0) {
+		register_procs(_mq_consumers);
+		cfg_register_child(_mq_consumers);
+	}
+
+	return 0;
+}
+
+/**
+ * run the event route for the item fetched from the queue
+ */
+static void mq_consumer_run_route(int rt, str *evname)
+{
+	int backup_rt;
+	struct run_act_ctx ctx;
+	sip_msg_t *fmsg;
+	sip_msg_t tmsg;
+	sr_kemi_eng_t *keng = NULL;
+
+	if(faked_msg_get_new(&tmsg)<0) {
+		LM_ERR("failed to get a new faked message\n");
+		return;
+	}
+	fmsg = &tmsg;
+	backup_rt = get_route_type();
+	set_route_type(EVENT_ROUTE);
+	init_run_actions_ctx(&ctx);
+	if(rt>=0) {
+		run_top_route(event_rt.rlist[rt], fmsg, 0);
+	} else {
+		keng = sr_kemi_eng_get();
+		if(keng!=NULL) {
+			if(sr_kemi_route(keng, fmsg, EVENT_ROUTE,
+						&_mq_event_callback, evname)<0) {
+				LM_ERR("error running event route kemi callback\n");
+			}
+		}
+	}
+	set_route_type(backup_rt);
+	free_sip_msg(fmsg);
+	ksr_msg_env_reset();
+}
+
+/**
+ * consumer process main loop - waits for items added to the queue
+ * and runs event_route[mqueue:name] for each of them
+ */
+static void mq_consumer_loop(mq_head_t *mh)
+{
+	char rtname[128];
+	str evname;
+	int rt = -1;
+
+	evname.len = snprintf(rtname, sizeof(rtname), "mqueue:%.*s",
+			mh->name.len, mh->name.s);
+	if(evname.len<0 || evname.len>=sizeof(rtname)) {
+		LM_ERR("queue name too long: %.*s\n", mh->name.len, mh->name.s);
+		return;
+	}
+	evname.s = rtname;
+	if(_mq_event_callback.s==NULL || _mq_event_callback.len<=0) {
+		rt = route_lookup(&event_rt, rtname);
+		if(rt<0 || event_rt.rlist[rt]==NULL) {
+			LM_WARN("no event_route[%s] - items are discarded\n", rtname);
+			rt = -1;
+		}
+	}
+
+	for(;;) {
+		cfg_update();
+		if(mq_head_fetch(&mh->name)<0) {
+			mq_consumer_wait(mh);
+			continue;
+		}
+		if(rt>=0 || _mq_event_callback.len>0)
+			mq_consumer_run_route(rt, &evname);
+		mq_pv_free(&mh->name);
+	}
+}
+
+/**
+ * init module children
+ */
+static int child_init(int rank)
+{
+	mq_head_t *mh;
+	char pname[64];
+	int pid;
+
+	if(rank!=PROC_MAIN || _mq_consumers<=0)
+		return 0;
+
+	for(mh=mq_head_get(NULL); mh!=NULL; mh=mh->next) {
+		if(mh->consumer==0)
+			continue;
+		snprintf(pname, sizeof(pname), "MQueue Consumer %.*s",
+				mh->name.len, mh->name.s);
+		pid = fork_process(PROC_NOCHLDINIT, pname, 1);
+		if(pid<0)
+			return -1; /* error */
+		if(pid==0) {
+			/* child */
+			if(cfg_child_init())
+				return -1;
+			mq_consumer_loop(mh);
+			exit(-1);
+		}
+	}
 	return 0;
 }
 
@@ -200,6 +328,23 @@ static int w_mq_pv_free(struct sip_msg* msg, char* mq, char* str2)
 	return 1;
 }
 
+static int w_mq_fetch_xavp(struct sip_msg* msg, char* mq, char* xname,
+		char* n)
+{
+	int num = 0;
+	str q;
+	str x;
+
+	if(fixup_get_svalue(msg, (gparam_t*)mq, &q)<0
+			|| fixup_get_svalue(msg, (gparam_t*)xname, &x)<0
+			|| fixup_get_ivalue(msg, (gparam_t*)n, &num)<0)
+	{
+		LM_ERR("cannot get the parameters\n");
+		return -1;
+	}
+	return mq_fetch_xavp(&q, &x, num);
+}
+
 int mq_param(modparam_t type, void *val)
 {
 	str mqs;
@@ -209,6 +354,9 @@ int mq_param(modparam_t type, void *val)
 	str qname = {0, 0};
 	int msize = 0;
 	int dbmode = 0;
+	int ring = 0;
+	int isize = 0;
+	int consumer = 0;
 
 	if(val==NULL)
 		return -1;
@@ -236,6 +384,15 @@ int mq_param(modparam_t type, void *val)
 		} else if(pit->name.len==6
 				&& strncasecmp(pit->name.s, "dbmode", 6)==0) {
 			str2sint(&pit->body, &dbmode);
+		} else if(pit->name.len==4
+				&& strncasecmp(pit->name.s, "ring", 4)==0) {
+			str2sint(&pit->body, &ring);
+		} else if(pit->name.len==8
+				&& strncasecmp(pit->name.s, "itemsize", 8)==0) {
+			str2sint(&pit->body, &isize);
+		} else if(pit->name.len==8
+				&& strncasecmp(pit->name.s, "consumer", 8)==0) {
+			str2sint(&pit->body, &consumer);
 		}  else {
 			LM_ERR("unknown param: %.*s\n", pit->name.len, pit->name.s);
 			free_params(params_list);
@@ -254,6 +411,14 @@ int mq_param(modparam_t type, void *val)
 		free_params(params_list);
 		return -1;
 	}
+	if(ring == 1 && mq_set_ring(&qname, isize)<0)
+	{
+		LM_ERR("cannot set ring mode for mqueue: %.*s\n", mqs.len, mqs.s);
+		free_params(params_list);
+		return -1;
+	}
+	if(consumer == 1)
+		mq_set_consumer(&qname);
 	LM_INFO("mqueue param: [%.*s|%d]\n", qname.len, qname.s, dbmode);
 	if(dbmode == 1 || dbmode == 2) {
 		if(mqueue_db_load_queue(&qname)<0)
@@ -278,6 +443,19 @@ static int fixup_mq_add(void** param, int param_no)
     return E_UNSPEC;
 }
 
+static int fixup_mq_fetch_xavp(void** param, int param_no)
+{
+	if(param_no==1 || param_no==2) {
+		return fixup_spve_null(param, 1);
+	}
+	if(param_no==3) {
+		return fixup_igp_null(param, 1);
+	}
+
+	LM_ERR("invalid parameter number %d\n", param_no);
+	return E_UNSPEC;
+}
+
 static int bind_mq(mq_api_t* api)
 {
 	if (!api)
@@ -339,9 +517,7 @@ static void mqueue_rpc_get_sizes(rpc_t* rpc, void* ctx)
 			rpc->fault(ctx, 500, "Server error");
 			return;
 		}
-		lock_get(&mh->lock);
-		size = mh->csize;
-		lock_release(&mh->lock);
+		size = mq_head_csize(mh);
 		rpc->struct_add(vh, "Sd",
 				"name", &mh->name,
 				"size", size
@@ -472,6 +648,14 @@ static int ki_mq_size(sip_msg_t *msg, str *mq)
 	return ret;
 }
 
+/**
+ *
+ */
+static int ki_mq_fetch_xavp(sip_msg_t* msg, str* mq, str* xname, int n)
+{
+	return mq_fetch_xavp(mq, xname, n);
+}
+
 /**
  *
  */
@@ -577,6 +761,11 @@ static sr_kemi_t sr_kemi_mqueue_exports[] = {
 		{ SR_KEMIP_STR, SR_KEMIP_NONE, SR_KEMIP_NONE,
 			SR_KEMIP_NONE, SR_KEMIP_NONE, SR_KEMIP_NONE }
 	},
+	{ str_init("mqueue"), str_init("mq_fetch_xavp"),
+		SR_KEMIP_INT, ki_mq_fetch_xavp,
+		{ SR_KEMIP_STR, SR_KEMIP_STR, SR_KEMIP_INT,
+			SR_KEMIP_NONE, SR_KEMIP_NONE, SR_KEMIP_NONE }
+	},
 	{ str_init("mqueue"), str_init("mq_pv_free"),
 		SR_KEMIP_INT, ki_mq_pv_free,
 		{ SR_KEMIP_STR, SR_KEMIP_NONE, SR_KEMIP_NONE,
@@ -0,0 +1,554 @@
+/**
+ * Copyright (C) 2021 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * This file is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ *
+ * This file is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../core/sr_module.h"
+#include "../../core/dprint.h"
+#include "../../core/ut.h"
+#include "../../core/trim.h"
+#include "../../core/mod_fix.h"
+#include "../../core/data_lump.h"
+#include "../../core/data_lump_rpl.h"
+#include "../../core/counters.h"
+#include "../../core/bit_scan.h"
+#include "../../core/timer_proc.h"
+#include "../../core/rpc.h"
+#include "../../core/rpc_lookup.h"
+#include "../../core/kemi.h"
+#include "../../core/rand/fastrand.h"
+#include "../../core/parser/parse_methods.h"
+#include "../../modules/sl/sl.h"
+
+#include "ovl_load.h"
+
+MODULE_VERSION
+
+static int mod_init(void);
+static int child_init(int);
+static void mod_destroy(void);
+
+static int w_ovl_check(sip_msg_t *msg, char *p1, char *p2);
+static int w_ovl_check_prio(sip_msg_t *msg, char *pprio, char *p2);
+static int w_ovl_reply(sip_msg_t *msg, char *p1, char *p2);
+static int w_ovl_via_feedback(sip_msg_t *msg, char *p1, char *p2);
+
+static int ovl_init_rpc(void);
+
+static int _ovl_interval = 500;
+static int _ovl_retry_after = 5;
+static int _ovl_oc_validity = 500;
+static int _ovl_default_priority = OVL_PRIO_NEVER;
+static str _ovl_method_priority =
+		str_init("INVITE=0;MESSAGE=0;OPTIONS=0;SUBSCRIBE=1;PUBLISH=1;"
+				 "REGISTER=2");
+
+/* priority per method, indexed by the bit of the method value */
+#define OVL_METHODS_SIZE 32
+static int _ovl_mprio[OVL_METHODS_SIZE];
+
+sl_api_t _ovl_slb;
+
+static counter_handle_t _ovl_cnt_checked;
+static counter_handle_t _ovl_cnt_rejected;
+
+static counter_val_t ovl_cnt_state(counter_handle_t h, void *what);
+
+/* clang-format off */
+static counter_def_t ovl_cnt_defs[] = {
+	{&_ovl_cnt_checked, "checked", 0, 0, 0,
+		"number of requests checked for overload."},
+	{&_ovl_cnt_rejected, "rejected", 0, 0, 0,
+		"number of requests rejected due to overload."},
+	{0, "load", 0, ovl_cnt_state, (void*)(long)0,
+		"overall load in percent of the configured limits."},
+	{0, "drop_pct", 0, ovl_cnt_state, (void*)(long)1,
+		"percent of the priority 0 requests being rejected."},
+	{0, 0, 0, 0, 0, 0 }
+};
+
+static cmd_export_t cmds[]={
+	{"ovl_check", (cmd_function)w_ovl_check, 0, 0,
+		0, REQUEST_ROUTE},
+	{"ovl_check_prio", (cmd_function)w_ovl_check_prio, 1, fixup_igp_null,
+		fixup_free_igp_null, REQUEST_ROUTE},
+	{"ovl_reply", (cmd_function)w_ovl_reply, 0, 0,
+		0, REQUEST_ROUTE},
+	{"ovl_via_feedback", (cmd_function)w_ovl_via_feedback, 0, 0,
+		0, ONREPLY_ROUTE},
+	{0, 0, 0, 0, 0, 0}
+};
+
+static param_export_t params[]={
+	{"interval",         PARAM_INT, &_ovl_interval},
+	{"busy_limit",       PARAM_INT, &_ovl_cfg.busy_limit},
+	{"shm_limit",        PARAM_INT, &_ovl_cfg.shm_limit},
+	{"rxq_limit",        PARAM_INT, &_ovl_cfg.rxq_limit},
+	{"max_transactions", PARAM_INT, &_ovl_cfg.max_transactions},
+	{"low_watermark",    PARAM_INT, &_ovl_cfg.low_watermark},
+	{"drop_step",        PARAM_INT, &_ovl_cfg.drop_step},
+	{"drop_max",         PARAM_INT, &_ovl_cfg.drop_max},
+	{"retry_after",      PARAM_INT, &_ovl_retry_after},
+	{"oc_validity",      PARAM_INT, &_ovl_oc_validity},
+	{"method_priority",  PARAM_STR, &_ovl_method_priority},
+	{"default_priority", PARAM_INT, &_ovl_default_priority},
+	{0, 0, 0}
+};
+
+struct module_exports exports = {
+	"overload",
+	DEFAULT_DLFLAGS, /* dlopen flags */
+	cmds,
+	params,
+	0,              /* exported RPC methods */
+	0,              /* exported pseudo-variables */
+	0,              /* response function */
+	mod_init,       /* module initialization function */
+	child_init,     /* per child init function */
+	mod_destroy    	/* destroy function */
+};
+/* clang-format on */
+
+
+/**
+ * parse the list of method priorities: METHOD=prio;...
+ */
+static int ovl_parse_method_priority(str *mp)
+{
+	str s;
+	str t;
+	char *p;
+	char *end;
+	int prio;
+	int i;
+	enum request_method m;
+
+	for(i = 0; i < OVL_METHODS_SIZE; i++) {
+		_ovl_mprio[i] = _ovl_default_priority;
+	}
+	if(mp->s == NULL || mp->len <= 0) {
+		return 0;
+	}
+	p = mp->s;
+	end = mp->s + mp->len;
+	while(p < end) {
+		s.s = p;
+		while(p < end && *p != ';') {
+			p++;
+		}
+		s.len = p - s.s;
+		p++;
+		trim(&s);
+		if(s.len == 0) {
+			continue;
+		}
+		t.s = q_memchr(s.s, '=', s.len);
+		if(t.s == NULL) {
+			goto error;
+		}
+		t.len = s.s + s.len - t.s - 1;
+		s.len = t.s - s.s;
+		t.s++;
+		trim(&s);
+		trim(&t);
+		if(s.len == 0 || str2sint(&t, &prio) < 0 || prio < 0) {
+			goto error;
+		}
+		if(parse_method_name(&s, &m) < 0 || m == METHOD_UNDEF
+				|| m == METHOD_OTHER) {
+			LM_ERR("unsupported method [%.*s]\n", s.len, s.s);
+			return -1;
+		}
+		_ovl_mprio[bit_scan_forward32((unsigned int)m)] = prio;
+	}
+	return 0;
+
+error:
+	LM_ERR("invalid method priority at [%.*s]\n", s.len, s.s);
+	return -1;
+}
+
+/**
+ * init module function
+ */
+static int mod_init(void)
+{
+	if(sl_load_api(&_ovl_slb) != 0) {
+		LM_ERR("cannot bind to SL API\n");
+		return -1;
+	}
+	if(_ovl_interval < 10) {
+		LM_WARN("interval too low (%d) - using 10ms\n", _ovl_interval);
+		_ovl_interval = 10;
+	}
+	if(_ovl_cfg.drop_max > 100) {
+		_ovl_cfg.drop_max = 100;
+	}
+	if(_ovl_default_priority > OVL_PRIO_NEVER) {
+		_ovl_default_priority = OVL_PRIO_NEVER;
+	}
+	if(ovl_parse_method_priority(&_ovl_method_priority) < 0) {
+		return -1;
+	}
+	if(ovl_init() < 0) {
+		return -1;
+	}
+	if(counter_register_array("overload", ovl_cnt_defs) < 0) {
+		LM_ERR("failed to register counters\n");
+		return -1;
+	}
+	if(ovl_init_rpc() < 0) {
+		LM_ERR("failed to register RPC commands\n");
+		return -1;
+	}
+	register_basic_timers(1);
+	return 0;
+}
+
+/**
+ * @brief Initialize module children
+ */
+static int child_init(int rank)
+{
+	if(rank != PROC_MAIN) {
+		return 0;
+	}
+	if(fork_basic_utimer(PROC_TIMER, "OVERLOAD TIMER", 1 /*socks flag*/,
+			   ovl_timer, NULL, 1000 * _ovl_interval /*milliseconds*/)
+			< 0) {
+		LM_ERR("failed to register overload timer as process\n");
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ * destroy module function
+ */
+static void mod_destroy(void)
+{
+	ovl_destroy();
+}
+
+/**
+ *
+ */
+static counter_val_t ovl_cnt_state(counter_handle_t h, void *what)
+{
+	if(_ovl_state == NULL) {
+		return 0;
+	}
+	return ((int)(long)what == 0) ? _ovl_state->load : _ovl_state->drop;
+}
+
+/**
+ *
+ */
+static int ki_ovl_check_prio(sip_msg_t *msg, int prio)
+{
+	counter_inc(_ovl_cnt_checked);
+	if(ovl_reject(prio)) {
+		counter_inc(_ovl_cnt_rejected);
+		return -1;
+	}
+	return 1;
+}
+
+/**
+ *
+ */
+static int ki_ovl_check(sip_msg_t *msg)
+{
+	int m;
+
+	if(msg->first_line.type != SIP_REQUEST) {
+		return 1;
+	}
+	m = msg->first_line.u.request.method_value;
+	if(m == METHOD_UNDEF || m == METHOD_OTHER) {
+		return ki_ovl_check_prio(msg, _ovl_default_priority);
+	}
+	return ki_ovl_check_prio(msg, _ovl_mprio[bit_scan_forward32(m)]);
+}
+
+/**
+ *
+ */
+static int w_ovl_check(sip_msg_t *msg, char *p1, char *p2)
+{
+	return ki_ovl_check(msg);
+}
+
+/**
+ *
+ */
+static int w_ovl_check_prio(sip_msg_t *msg, char *pprio, char *p2)
+{
+	int prio;
+
+	if(fixup_get_ivalue(msg, (gparam_t *)pprio, &prio) != 0) {
+		LM_ERR("cannot get the priority value\n");
+		return -1;
+	}
+	return ki_ovl_check_prio(msg, prio);
+}
+
+#define OVL_RETRY_AFTER "Retry-After: "
+#define OVL_RETRY_AFTER_LEN (sizeof(OVL_RETRY_AFTER) - 1)
+
+/**
+ * send 503 reply with Retry-After - the interval is randomized in
+ * [retry_after, 2*retry_after) to avoid synchronized retries
+ */
+static int ki_ovl_reply(sip_msg_t *msg)
+{
+	str reason = str_init("Service Unavailable");
+	char hbuf[OVL_RETRY_AFTER_LEN + INT2STR_MAX_LEN + CRLF_LEN];
+	char *ra;
+	int ralen;
+	int v;
+
+	if(_ovl_retry_after > 0) {
+		v = _ovl_retry_after + fastrand_max(_ovl_retry_after - 1);
+		ra = int2str((unsigned long)v, &ralen);
+		memcpy(hbuf, OVL_RETRY_AFTER, OVL_RETRY_AFTER_LEN);
+		memcpy(hbuf + OVL_RETRY_AFTER_LEN, ra, ralen);
+		memcpy(hbuf + OVL_RETRY_AFTER_LEN + ralen, CRLF, CRLF_LEN);
+		if(add_lump_rpl(msg, hbuf, OVL_RETRY_AFTER_LEN + ralen + CRLF_LEN,
+				   LUMP_RPL_HDR)
+				== 0) {
+			LM_ERR("failed to add Retry-After header\n");
+			return -1;
+		}
+	}
+	if(_ovl_slb.freply(msg, 503, &reason) < 0) {
+		LM_ERR("failed to send the reply\n");
+		return -1;
+	}
+	return 1;
+}
+
+/**
+ *
+ */
+static int w_ovl_reply(sip_msg_t *msg, char *p1, char *p2)
+{
+	return ki_ovl_reply(msg);
+}
+
+/**
+ * replace a via param with the content of buf (pkg allocated)
+ */
+static int ovl_via_param_set(sip_msg_t *msg, via_param_t *vp, char *buf,
+		int len)
+{
+	struct lump *anchor;
+
+	anchor = del_lump(msg, vp->start - msg->buf, vp->size, 0);
+	if(anchor == NULL) {
+		LM_ERR("failed to remove via param\n");
+		pkg_free(buf);
+		return -1;
+	}
+	if(insert_new_lump_after(anchor, buf, len, 0) == NULL) {
+		LM_ERR("failed to add via param\n");
+		pkg_free(buf);
+		return -1;
+	}
+	return 0;
+}
+
+#define OVL_OC_ALGO "oc-algo=\"loss\""
+#define OVL_OC_ALGO_LEN (sizeof(OVL_OC_ALGO) - 1)
+
+/**
+ * RFC 7339 - set the overload control parameters in the Via header of the
+ * upstream client (the second Via of the reply), if it has 'oc' param
+ */
+static int ki_ovl_via_feedback(sip_msg_t *msg)
+{
+	via_param_t *vp;
+	via_param_t *vp_oc;
+	via_param_t *vp_algo;
+	char *buf;
+	int len;
+	int n;
+
+	if(msg->first_line.type != SIP_REPLY || _ovl_state == NULL) {
+		return -1;
+	}
+	if(_ovl_state->drop == 0) {
+		return 1;
+	}
+	if(parse_headers(msg, HDR_VIA2_F, 0) < 0 || msg->via2 == NULL) {
+		LM_DBG("no second via header\n");
+		return -1;
+	}
+	vp_oc = NULL;
+	vp_algo = NULL;
+	for(vp = msg->via2->param_lst; vp; vp = vp->next) {
+		if(vp->name.len == 2 && strncasecmp(vp->name.s, "oc", 2) == 0) {
+			vp_oc = vp;
+		} else if(vp->name.len == 7
+				  && strncasecmp(vp->name.s, "oc-algo", 7) == 0) {
+			vp_algo = vp;
+		}
+	}
+	if(vp_oc == NULL) {
+		/* upstream does not support overload control */
+		return -1;
+	}
+
+	len = 64 + ((vp_algo == NULL) ? (OVL_OC_ALGO_LEN + 1) : 0);
+	buf = (char *)pkg_malloc(len);
+	if(buf == NULL) {
+		PKG_MEM_ERROR;
+		return -1;
+	}
+	n = snprintf(buf, len, "oc=%d;oc-validity=%d;oc-seq=%u%s",
+			_ovl_state->drop, _ovl_oc_validity, _ovl_state->seq,
+			(vp_algo == NULL) ? ";" OVL_OC_ALGO : "");
+	if(n < 0 || n >= len) {
+		pkg_free(buf);
+		return -1;
+	}
+	if(ovl_via_param_set(msg, vp_oc, buf, n) < 0) {
+		return -1;
+	}
+	if(vp_algo != NULL) {
+		buf = (char *)pkg_malloc(OVL_OC_ALGO_LEN);
+		if(buf == NULL) {
+			PKG_MEM_ERROR;
+			return -1;
+		}
+		memcpy(buf, OVL_OC_ALGO, OVL_OC_ALGO_LEN);
+		if(ovl_via_param_set(msg, vp_algo, buf, OVL_OC_ALGO_LEN) < 0) {
+			return -1;
+		}
+	}
+	return 1;
+}
+
+/**
+ *
+ */
+static int w_ovl_via_feedback(sip_msg_t *msg, char *p1, char *p2)
+{
+	return ki_ovl_via_feedback(msg);
+}
+
+/**
+ *
+ */
+static const char *ovl_rpc_status_doc[2] = {
+	"Overload control status", 0
+};
+
+/**
+ *
+ */
+static void ovl_rpc_status(rpc_t *rpc, void *ctx)
+{
+	void *th;
+
+	if(_ovl_state == NULL) {
+		rpc->fault(ctx, 500, "Not initialized");
+		return;
+	}
+	if(rpc->add(ctx, "{", &th) < 0) {
+		rpc->fault(ctx, 500, "Internal error creating rpc");
+		return;
+	}
+	if(rpc->struct_add(th, "ddddddu",
+			"load", _ovl_state->load,
+			"busy", _ovl_state->busy,
+			"shm", _ovl_state->shm,
+			"rxq", _ovl_state->rxq,
+			"transactions", _ovl_state->tmx,
+			"drop", _ovl_state->drop,
+			"seq", _ovl_state->seq) < 0) {
+		rpc->fault(ctx, 500, "Internal error adding values");
+		return;
+	}
+}
+
+/* clang-format off */
+rpc_export_t ovl_rpc_cmds[] = {
+	{"overload.status", ovl_rpc_status,
+		ovl_rpc_status_doc, 0},
+	{0, 0, 0, 0}
+};
+/* clang-format on */
+
+/**
+ *
+ */
+static int ovl_init_rpc(void)
+{
+	if(rpc_register_array(ovl_rpc_cmds) != 0) {
+		LM_ERR("failed to register RPC commands\n");
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ *
+ */
+/* clang-format off */
+static sr_kemi_t sr_kemi_overload_exports[] = {
+	{ str_init("overload"), str_init("ovl_check"),
+		SR_KEMIP_INT, ki_ovl_check,
+		{ SR_KEMIP_NONE, SR_KEMIP_NONE, SR_KEMIP_NONE,
+			SR_KEMIP_NONE, SR_KEMIP_NONE, SR_KEMIP_NONE }
+	},
+	{ str_init("overload"), str_init("ovl_check_prio"),
+		SR_KEMIP_INT, ki_ovl_check_prio,
+		{ SR_KEMIP_INT, SR_KEMIP_NONE, SR_KEMIP_NONE,
+			SR_KEMIP_NONE, SR_KEMIP_NONE, SR_KEMIP_NONE }
+	},
+	{ str_init("overload"), str_init("ovl_reply"),
+		SR_KEMIP_INT, ki_ovl_reply,
+		{ SR_KEMIP_NONE, SR_KEMIP_NONE, SR_KEMIP_NONE,
+			SR_KEMIP_NONE, SR_KEMIP_NONE, SR_KEMIP_NONE }
+	},
+	{ str_init("overload"), str_init("ovl_via_feedback"),
+		SR_KEMIP_INT, ki_ovl_via_feedback,
+		{ SR_KEMIP_NONE, SR_KEMIP_NONE, SR_KEMIP_NONE,
+			SR_KEMIP_NONE, SR_KEMIP_NONE, SR_KEMIP_NONE }
+	},
+
+	{ {0, 0}, {0, 0}, 0, NULL, { 0, 0, 0, 0, 0, 0 } }
+};
+/* clang-format on */
+
+/**
+ *
+ */
+int mod_register(char *path, int *dlflags, void *p1, void *p2)
+{
+	sr_kemi_modules_add(sr_kemi_overload_exports);
+	return 0;
+}
@@ -0,0 +1,244 @@
+/**
+ * Copyright (C) 2021 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * This file is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ *
+ * This file is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "../../core/dprint.h"
+#include "../../core/globals.h"
+#include "../../core/pt.h"
+#include "../../core/socket_info.h"
+#include "../../core/udp_server.h"
+#include "../../core/mem/shm_mem.h"
+#include "../../core/rand/fastrand.h"
+#include "../../modules/tm/tm_load.h"
+
+#include "ovl_load.h"
+
+ovl_state_t *_ovl_state = NULL;
+
+ovl_cfg_t _ovl_cfg = {
+	90, /* busy_limit */
+	90, /* shm_limit */
+	50, /* rxq_limit */
+	0,  /* max_transactions */
+	85, /* low_watermark */
+	10, /* drop_step */
+	100 /* drop_max */
+};
+
+static struct tm_binds _ovl_tmb;
+static int _ovl_tmb_loaded = 0;
+
+/**
+ *
+ */
+int ovl_init(void)
+{
+	if(_ovl_cfg.max_transactions > 0) {
+		if(load_tm_api(&_ovl_tmb) < 0) {
+			LM_ERR("max_transactions requires tm module\n");
+			return -1;
+		}
+		_ovl_tmb_loaded = 1;
+	}
+	_ovl_state = (ovl_state_t *)shm_malloc(sizeof(ovl_state_t));
+	if(_ovl_state == NULL) {
+		SHM_MEM_ERROR;
+		return -1;
+	}
+	memset(_ovl_state, 0, sizeof(ovl_state_t));
+	_ovl_state->seq = (unsigned int)time(NULL);
+	return 0;
+}
+
+/**
+ *
+ */
+void ovl_destroy(void)
+{
+	if(_ovl_state != NULL) {
+		shm_free(_ovl_state);
+		_ovl_state = NULL;
+	}
+}
+
+/**
+ * average busy percent of the sip workers in the last second
+ */
+static int ovl_load_busy(void)
+{
+	proc_load_info_t li;
+	int i;
+	int n;
+	int v;
+
+	n = 0;
+	v = 0;
+	for(i = 0; i < *process_count; i++) {
+		if(pt[i].rank <= 0 || proc_load_get(i, &li) < 0) {
+			continue;
+		}
+		v += li.lload;
+		n++;
+	}
+	return (n > 0) ? v / n : 0;
+}
+
+/**
+ * occupancy percent of the udp receive queues
+ */
+static int ovl_load_rxq(void)
+{
+	struct socket_info *si;
+	unsigned int rxq, rcvbuf, drops;
+	unsigned long long q;
+	unsigned long long b;
+
+	q = 0;
+	b = 0;
+	for(si = udp_listen; si; si = si->next) {
+		if(si->socket < 0
+				|| udp_rcv_queue_info(si->socket, &rxq, &rcvbuf, &drops) < 0
+				|| rcvbuf == 0) {
+			continue;
+		}
+		q += rxq;
+		b += rcvbuf;
+	}
+	return (b > 0) ? (int)(q * 100 / b) : 0;
+}
+
+/**
+ * used shared memory percent
+ */
+static int ovl_load_shm(void)
+{
+	unsigned long avail;
+
+	if(shm_mem_size == 0) {
+		return 0;
+	}
+	avail = shm_available_safe();
+	if(avail >= shm_mem_size) {
+		return 0;
+	}
+	return (int)((shm_mem_size - avail) * 100 / shm_mem_size);
+}
+
+/**
+ * active transactions
+ */
+static int ovl_load_tmx(void)
+{
+	struct t_proc_stats all;
+
+	if(_ovl_tmb_loaded == 0) {
+		return 0;
+	}
+	memset(&all, 0, sizeof(struct t_proc_stats));
+	if(_ovl_tmb.get_stats(&all) < 0) {
+		return 0;
+	}
+	return (int)(all.transactions - all.deleted);
+}
+
+#define OVL_PCT(v, l) (((l) > 0) ? ((v)*100 / (l)) : 0)
+
+/**
+ * timer callback - update the overload state
+ */
+void ovl_timer(unsigned int ticks, void *param)
+{
+	int load;
+	int v;
+	int drop;
+
+	if(_ovl_state == NULL) {
+		return;
+	}
+	_ovl_state->busy = ovl_load_busy();
+	_ovl_state->shm = ovl_load_shm();
+	_ovl_state->rxq = ovl_load_rxq();
+	_ovl_state->tmx = ovl_load_tmx();
+
+	load = OVL_PCT(_ovl_state->busy, _ovl_cfg.busy_limit);
+	v = OVL_PCT(_ovl_state->shm, _ovl_cfg.shm_limit);
+	if(v > load) {
+		load = v;
+	}
+	v = OVL_PCT(_ovl_state->rxq, _ovl_cfg.rxq_limit);
+	if(v > load) {
+		load = v;
+	}
+	v = OVL_PCT(_ovl_state->tmx, _ovl_cfg.max_transactions);
+	if(v > load) {
+		load = v;
+	}
+	_ovl_state->load = load;
+
+	drop = _ovl_state->drop;
+	if(load >= 100) {
+		drop += _ovl_cfg.drop_step;
+		if(drop > _ovl_cfg.drop_max) {
+			drop = _ovl_cfg.drop_max;
+		}
+	} else if(load < _ovl_cfg.low_watermark) {
+		drop -= _ovl_cfg.drop_step;
+		if(drop < 0) {
+			drop = 0;
+		}
+	}
+	if(drop != _ovl_state->drop) {
+		LM_DBG("load %d (busy %d shm %d rxq %d tmx %d) - drop %d => %d\n",
+				load, _ovl_state->busy, _ovl_state->shm, _ovl_state->rxq,
+				_ovl_state->tmx, _ovl_state->drop, drop);
+		_ovl_state->drop = drop;
+		_ovl_state->seq++;
+	}
+}
+
+/**
+ * decide if a request with priority prio has to be rejected
+ * - the priority lowers the drop rate with 10% per level
+ * @return 1 if it has to be rejected, 0 otherwise
+ */
+int ovl_reject(int prio)
+{
+	int drop;
+
+	if(_ovl_state == NULL || prio >= OVL_PRIO_NEVER) {
+		return 0;
+	}
+	drop = _ovl_state->drop;
+	if(prio > 0) {
+		drop -= prio * 10;
+	}
+	if(drop <= 0) {
+		return 0;
+	}
+	if(drop >= 100) {
+		return 1;
+	}
+	return (fastrand_max(99) < (unsigned int)drop) ? 1 : 0;
+}
@@ -0,0 +1,67 @@
+/**
+ * Copyright (C) 2021 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * This file is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ *
+ * This file is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#ifndef _OVL_LOAD_H_
+#define _OVL_LOAD_H_
+
+/* priority of the requests that are never rejected */
+#define OVL_PRIO_NEVER 10
+
+/*
+ * Overload state - updated by the timer process, read without locking
+ * by the sip workers (all fields are int sized).
+ *
+ * The load components are in percent of their configured limits, 'load'
+ * being the maximum of them. 'drop' is the percent of the priority 0
+ * requests to be rejected - it grows with 'drop_step' at each interval
+ * while the load is over 100 and decreases the same way when the load
+ * goes under the low watermark (RFC 7339 loss based algorithm).
+ */
+typedef struct ovl_state {
+	int load;           /* overall load (percent of the limits) */
+	int busy;           /* average busy percent of the sip workers */
+	int shm;            /* used shared memory percent */
+	int rxq;            /* udp receive queues occupancy percent */
+	int tmx;            /* active transactions */
+	int drop;           /* percent of requests to reject */
+	unsigned int seq;   /* changed every time 'drop' is updated */
+} ovl_state_t;
+
+typedef struct ovl_cfg {
+	int busy_limit;
+	int shm_limit;
+	int rxq_limit;
+	int max_transactions;
+	int low_watermark;
+	int drop_step;
+	int drop_max;
+} ovl_cfg_t;
+
+extern ovl_state_t *_ovl_state;
+extern ovl_cfg_t _ovl_cfg;
+
+int ovl_init(void);
+void ovl_destroy(void);
+void ovl_timer(unsigned int ticks, void *param);
+int ovl_reject(int prio);
+
+#endif
@@ -32,14 +32,21 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
-#include <pcre.h>
+
+#define PCRE2_CODE_UNIT_WIDTH 8
+#include <pcre2.h>
+
 #include "../../core/sr_module.h"
 #include "../../core/dprint.h"
 #include "../../core/pt.h"
 #include "../../core/mem/shm_mem.h"
 #include "../../core/str.h"
+#include "../../core/ut.h"
+#include "../../core/hashes.h"
 #include "../../core/locking.h"
 #include "../../core/mod_fix.h"
+#include "../../core/pvar.h"
+#include "../../core/lvalue.h"
 #include "../../core/rpc.h"
 #include "../../core/rpc_lookup.h"
 #include "../../core/kemi.h"
@@ -53,9 +60,56 @@ MODULE_VERSION
 #define MAX_GROUPS 20            /*!< Max number of groups */
 #define GROUP_MAX_SIZE 8192      /*!< Max size of a group */
 
+/*! name of the capturing group wrapping the pattern of a line */
+#define RX_LINE_NAME "rxl"
+#define RX_LINE_NAME_SIZE 16
+
+/*! max size of a subject kept in the match cache */
+#define RX_CACHE_SUBJECT_MAX 128
+
 
 static int regex_init_rpc(void);
 
+
+/*! \brief
+ * A generation of the compiled groups. The groups are compiled by the
+ * process doing the (re)load and stored serialized in shared memory. The
+ * other processes decode them into a local copy (and JIT compile it)
+ * when they see a new generation, without compiling the patterns again.
+ */
+typedef struct rx_gen {
+	int id;                 /*!< generation id */
+	int ngroups;            /*!< number of groups */
+	int *nlines;            /*!< number of patterns (lines) per group */
+	uint8_t *bytes;         /*!< serialized compiled groups */
+} rx_gen_t;
+
+typedef struct rx_shared {
+	volatile int gen_id;    /*!< id of the current generation */
+	rx_gen_t *gen;          /*!< current generation */
+} rx_shared_t;
+
+/*! \brief Per process copy of the current generation */
+typedef struct rx_local {
+	int gen_id;
+	int ngroups;
+	pcre2_code **codes;
+	pcre2_match_data **mdata;
+	int *nlines;
+	int **lnums;            /*!< capturing group numbers of the lines */
+} rx_local_t;
+
+typedef struct rx_cache_entry {
+	int gen_id;
+	int group;
+	unsigned int hashid;
+	int ret;
+	int idx;
+	int len;
+	char subject[RX_CACHE_SUBJECT_MAX];
+} rx_cache_entry_t;
+
+
 /*
  * Locking variables
  */
@@ -72,15 +126,20 @@ static int pcre_caseless         = 0;
 static int pcre_multiline        = 0;
 static int pcre_dotall           = 0;
 static int pcre_extended         = 0;
+static int pcre_jit              = 1;
+static int match_cache_size      = 0;
 
 
 /*
  * Module internal parameter variables
  */
-static pcre **pcres;
-static pcre ***pcres_addr;
-static int *num_pcres;
-static int pcre_options = 0x00000000;
+static rx_shared_t *_rx_shared = NULL;
+static rx_local_t _rx_local = {0};
+static rx_cache_entry_t *_rx_cache = NULL;
+static uint32_t pcre_options = 0x00000000;
+static pcre2_general_context *pcre_gctx = NULL;
+static pcre2_general_context *pcre_shm_gctx = NULL;
+static pcre2_compile_context *pcre_cctx = NULL;
 
 
 /*
@@ -94,6 +153,8 @@ static void destroy(void);
  * Module internal functions
  */
 static int load_pcres(int);
+static int rx_local_refresh(void);
+static void rx_local_free(rx_local_t *rxl);
 static void free_shared_memory(void);
 
 
@@ -102,6 +163,9 @@ static void free_shared_memory(void);
  */
 static int w_pcre_match(struct sip_msg* _msg, char* _s1, char* _s2);
 static int w_pcre_match_group(struct sip_msg* _msg, char* _s1, char* _s2);
+static int w_pcre_match_group_index(struct sip_msg* _msg, char* _s1,
+		char* _s2, char* _s3);
+static int fixup_pcre_match_group_index(void** param, int param_no);
 
 
 /*
@@ -115,6 +179,9 @@ static cmd_export_t cmds[] =
 		REQUEST_ROUTE|FAILURE_ROUTE|ONREPLY_ROUTE|BRANCH_ROUTE|LOCAL_ROUTE },
 	{ "pcre_match_group", (cmd_function)w_pcre_match_group, 1, fixup_spve_null, 0,
 		REQUEST_ROUTE|FAILURE_ROUTE|ONREPLY_ROUTE|BRANCH_ROUTE|LOCAL_ROUTE },
+	{ "pcre_match_group_index", (cmd_function)w_pcre_match_group_index, 3,
+		fixup_pcre_match_group_index, 0,
+		REQUEST_ROUTE|FAILURE_ROUTE|ONREPLY_ROUTE|BRANCH_ROUTE|LOCAL_ROUTE },
 	{ 0, 0, 0, 0, 0, 0 }
 };
 
@@ -130,6 +197,8 @@ static param_export_t params[] = {
 	{"pcre_multiline",      INT_PARAM,  &pcre_multiline      },
 	{"pcre_dotall",         INT_PARAM,  &pcre_dotall         },
 	{"pcre_extended",       INT_PARAM,  &pcre_extended       },
+	{"pcre_jit",            INT_PARAM,  &pcre_jit            },
+	{"match_cache_size",    INT_PARAM,  &match_cache_size    },
 	{0, 0, 0}
 };
 
@@ -151,6 +220,33 @@ struct module_exports exports = {
 };
 
 
+/*
+ * Memory management functions for the PCRE2 library
+ */
+static void *pcre2_pkg_malloc(PCRE2_SIZE size, void *ext)
+{
+	return pkg_malloc(size);
+}
+
+static void pcre2_pkg_free(void *ptr, void *ext)
+{
+	if (ptr) {
+		pkg_free(ptr);
+	}
+}
+
+static void *pcre2_shm_malloc(PCRE2_SIZE size, void *ext)
+{
+	return shm_malloc(size);
+}
+
+static void pcre2_shm_free(void *ptr, void *ext)
+{
+	if (ptr) {
+		shm_free(ptr);
+	}
+}
+
 
 /*! \brief
  * Init module function
@@ -163,6 +259,37 @@ static int mod_init(void)
 		return -1;
 	}
 
+	pcre_gctx = pcre2_general_context_create(pcre2_pkg_malloc,
+			pcre2_pkg_free, NULL);
+	if (pcre_gctx == NULL) {
+		LM_ERR("cannot create the pcre2 general context\n");
+		return -1;
+	}
+	pcre_cctx = pcre2_compile_context_create(pcre_gctx);
+	if (pcre_cctx == NULL) {
+		LM_ERR("cannot create the pcre2 compile context\n");
+		goto err;
+	}
+
+	/* PCRE options */
+	if (pcre_caseless != 0) {
+		LM_DBG("PCRE CASELESS enabled\n");
+		pcre_options = pcre_options | PCRE2_CASELESS;
+	}
+	if (pcre_multiline != 0) {
+		LM_DBG("PCRE MULTILINE enabled\n");
+		pcre_options = pcre_options | PCRE2_MULTILINE;
+	}
+	if (pcre_dotall != 0) {
+		LM_DBG("PCRE DOTALL enabled\n");
+		pcre_options = pcre_options | PCRE2_DOTALL;
+	}
+	if (pcre_extended != 0) {
+		LM_DBG("PCRE EXTENDED enabled\n");
+		pcre_options = pcre_options | PCRE2_EXTENDED;
+	}
+	LM_DBG("PCRE options: %i\n", pcre_options);
+
 	/* Group matching feature */
 	if (file == NULL) {
 		LM_NOTICE("'file' parameter is not set, group matching disabled\n");
@@ -176,39 +303,23 @@ static int mod_init(void)
 		if (lock_init(reload_lock) == NULL) {
 			LM_ERR("cannot init the reload_lock\n");
 			lock_dealloc(reload_lock);
+			reload_lock = NULL;
 			goto err;
 		}
 
-		/* PCRE options */
-		if (pcre_caseless != 0) {
-			LM_DBG("PCRE CASELESS enabled\n");
-			pcre_options = pcre_options | PCRE_CASELESS;
-		}
-		if (pcre_multiline != 0) {
-			LM_DBG("PCRE MULTILINE enabled\n");
-			pcre_options = pcre_options | PCRE_MULTILINE;
-		}
-		if (pcre_dotall != 0) {
-			LM_DBG("PCRE DOTALL enabled\n");
-			pcre_options = pcre_options | PCRE_DOTALL;
-		}
-		if (pcre_extended != 0) {
-			LM_DBG("PCRE EXTENDED enabled\n");
-			pcre_options = pcre_options | PCRE_EXTENDED;
-		}
-		LM_DBG("PCRE options: %i\n", pcre_options);
-
-		/* Pointer to pcres */
-		if ((pcres_addr = shm_malloc(sizeof(pcre **))) == 0) {
-			LM_ERR("no memory for pcres_addr\n");
+		pcre_shm_gctx = pcre2_general_context_create(pcre2_shm_malloc,
+				pcre2_shm_free, NULL);
+		if (pcre_shm_gctx == NULL) {
+			LM_ERR("cannot create the pcre2 shm general context\n");
 			goto err;
 		}
 
-		/* Integer containing the number of pcres */
-		if ((num_pcres = shm_malloc(sizeof(int))) == 0) {
-			LM_ERR("no memory for num_pcres\n");
+		/* Pointer to the current generation of pcres */
+		if ((_rx_shared = shm_malloc(sizeof(rx_shared_t))) == 0) {
+			LM_ERR("no memory for the shared pcres\n");
 			goto err;
 		}
+		memset(_rx_shared, 0, sizeof(rx_shared_t));
 
 		/* Load the pcres */
 		LM_DBG("loading pcres...\n");
@@ -216,6 +327,11 @@ static int mod_init(void)
 			LM_ERR("failed to load pcres\n");
 			goto err;
 		}
+		/* decode and JIT compile before forking, the copy is inherited */
+		if (rx_local_refresh() < 0) {
+			LM_ERR("failed to prepare the pcres\n");
+			goto err;
+		}
 	}
 
 	return 0;
@@ -228,28 +344,44 @@ err:
 
 static void destroy(void)
 {
+	rx_local_free(&_rx_local);
 	free_shared_memory();
 }
 
 
-/*! \brief Convert the file content into regular expresions and store them in pcres */
+/*! \brief Free a generation of compiled groups */
+static void rx_gen_free(rx_gen_t *gen)
+{
+	if (gen == NULL) {
+		return;
+	}
+	if (gen->bytes) {
+		pcre2_serialize_free(gen->bytes);
+	}
+	shm_free(gen);
+}
+
+
+/*! \brief Convert the file content into regular expresions and store them
+ * as a new generation in shared memory */
 static int load_pcres(int action)
 {
-	int i, j;
+	int i, k;
 	FILE *f;
 	char line[FILE_MAX_LINE];
 	char **patterns = NULL;
-	pcre *pcre_tmp = NULL;
-	size_t pcre_size;
-	int pcre_rc;
-	const char *pcre_error;
-	int pcre_erroffset;
+	int *nlines = NULL;
+	pcre2_code **pcres_tmp = NULL;
+	int pcre_error_num;
+	PCRE2_SIZE pcre_erroffset;
+	PCRE2_UCHAR pcre_error[128];
+	uint8_t *bytes = NULL;
+	PCRE2_SIZE bytes_size;
 	int num_pcres_tmp = 0;
-	pcre **pcres_tmp = NULL;
+	rx_gen_t *gen = NULL;
+	rx_gen_t *old;
 	int llen;
-
-	/* Get the lock */
-	lock_get(reload_lock);
+	int plen;
 
 	if (!(f = fopen(file, "r"))) {
 		LM_ERR("could not open file '%s'\n", file);
@@ -264,6 +396,13 @@ static int load_pcres(int action)
 	}
 	memset(patterns, 0, sizeof(char*) * max_groups);
 
+	if ((nlines = pkg_malloc(sizeof(int) * max_groups)) == 0) {
+		LM_ERR("no more memory for nlines\n");
+		fclose(f);
+		goto err;
+	}
+	memset(nlines, 0, sizeof(int) * max_groups);
+
 	for (i=0; i<max_groups; i++) {
 		if ((patterns[i] = pkg_malloc(sizeof(char) * group_max_size)) == 0) {
 			LM_ERR("no more memory for patterns[%d]\n", i);
@@ -273,7 +412,9 @@ static int load_pcres(int action)
 		memset(patterns[i], 0, group_max_size);
 	}
 
-	/* Read the file and extract the patterns */
+	/* Read the file and extract the patterns - each line is wrapped in
+	 * a named capturing group and the lines of a group are alternatives:
+	 * (?<rxl0>line0)|(?<rxl1>line1)|... */
 	memset(line, 0, FILE_MAX_LINE);
 	i = -1;
 	while (fgets(line, FILE_MAX_LINE-4, f) != NULL) {
@@ -300,39 +441,29 @@ static int load_pcres(int action)
 				fclose(f);
 				goto err;
 			}
-			/* Start the regular expression with '(' */
-			patterns[i][0] = '(';
-			patterns[i][1] = '\0';
 			memset(line, 0, FILE_MAX_LINE);
 			continue;
 		}
 
+		/* Delete the ending '\n' */
 		llen = strlen(line);
+		if (line[llen - 1] == '\n') {
+			line[--llen] = '\0';
+		}
+
 		/* Check if the patter size is too big (aprox) */
-		if (strlen(patterns[i]) + llen >= group_max_size - 4) {
+		plen = strlen(patterns[i]);
+		if (plen + llen + RX_LINE_NAME_SIZE >= group_max_size - 4) {
 			LM_ERR("pattern max file exceeded\n");
 			fclose(f);
 			goto err;
 		}
 
-		/* Append ')' at the end of the line */
-		if (line[llen - 1] == '\n') {
-			line[llen - 1] = ')';
-			line[llen] = '\n';
-			line[llen + 1] = '\0';
-		} else {
-			/* This is the last char in the file and it's not \n */
-			line[llen] = ')';
-			line[llen + 1] = '\0';
-		}
-
-		/* Append '(' at the beginning of the line */
-		llen = strlen(patterns[i]);
-		memcpy(patterns[i]+llen, "(", 1);
-		llen++;
-
-		/* Append the line to the current pattern (including the ending 0) */
-		memcpy(patterns[i] + llen, line, strlen(line) + 1);
+		/* Append the line as the next alternative */
+		snprintf(patterns[i] + plen, group_max_size - plen,
+				"%s(?<" RX_LINE_NAME "%d>%s)",
+				(nlines[i] > 0) ? "|" : "", nlines[i], line);
+		nlines[i]++;
 
 		memset(line, 0, FILE_MAX_LINE);
 	}
@@ -345,31 +476,11 @@ static int load_pcres(int action)
 		goto err;
 	}
 
-	/* Fix the patterns */
+	/* Convert empty groups in unmatcheable regular expression ^$ */
 	for (i=0; i < num_pcres_tmp; i++) {
-
-		/* Convert empty groups in unmatcheable regular expression ^$ */
-		if (strlen(patterns[i]) == 1) {
-			patterns[i][0] = '^';
-			patterns[i][1] = '$';
-			patterns[i][2] = '\0';
-			continue;
-		}
-
-		/* Delete possible '\n' at the end of the pattern */
-		if (patterns[i][strlen(patterns[i])-1] == '\n') {
-			patterns[i][strlen(patterns[i])-1] = '\0';
-		}
-
-		/* Replace '\n' with '|' (except at the end of the pattern) */
-		for (j=0; j < strlen(patterns[i]); j++) {
-			if (patterns[i][j] == '\n' && j != strlen(patterns[i])-1) {
-				patterns[i][j] = '|';
-			}
+		if (nlines[i] == 0) {
+			strcpy(patterns[i], "^$");
 		}
-
-		/* Add ')' at the end of the pattern */
-		patterns[i][strlen(patterns[i])] = ')';
 	}
 
 	/* Log the group patterns */
@@ -380,7 +491,7 @@ static int load_pcres(int action)
 	}
 
 	/* Temporal pointer of pcres */
-	if ((pcres_tmp = pkg_malloc(sizeof(pcre *) * num_pcres_tmp)) == 0) {
+	if ((pcres_tmp = pkg_malloc(sizeof(pcre2_code *) * num_pcres_tmp)) == 0) {
 		LM_ERR("no more memory for pcres_tmp\n");
 		goto err;
 	}
@@ -391,59 +502,54 @@ static int load_pcres(int action)
 	/* Compile the patters */
 	for (i=0; i<num_pcres_tmp; i++) {
 
-		pcre_tmp = pcre_compile(patterns[i], pcre_options, &pcre_error,
-				&pcre_erroffset, NULL);
-		if (pcre_tmp == NULL) {
+		pcres_tmp[i] = pcre2_compile((PCRE2_SPTR)patterns[i],
+				PCRE2_ZERO_TERMINATED, pcre_options, &pcre_error_num,
+				&pcre_erroffset, pcre_cctx);
+		if (pcres_tmp[i] == NULL) {
+			pcre2_get_error_message(pcre_error_num, pcre_error,
+					sizeof(pcre_error));
 			LM_ERR("pcre_tmp compilation of '%s' failed at offset %d: %s\n",
-					patterns[i], pcre_erroffset, pcre_error);
-			goto err;
-		}
-		pcre_rc = pcre_fullinfo(pcre_tmp, NULL, PCRE_INFO_SIZE, &pcre_size);
-		if (pcre_rc) {
-			printf("pcre_fullinfo on compiled pattern[%i] yielded error: %d\n",
-					i, pcre_rc);
-			goto err;
-		}
-
-		if ((pcres_tmp[i] = pkg_malloc(pcre_size)) == 0) {
-			LM_ERR("no more memory for pcres_tmp[%i]\n", i);
+					patterns[i], (int)pcre_erroffset, pcre_error);
 			goto err;
 		}
-
-		memcpy(pcres_tmp[i], pcre_tmp, pcre_size);
-		pcre_free(pcre_tmp);
 		pkg_free(patterns[i]);
 		patterns[i] = NULL;
 	}
 
-	/* Copy to shared memory */
-	if (action == RELOAD) {
-		for(i=0; i<*num_pcres; i++) {  /* Use the previous num_pcres value */
-			if (pcres[i]) {
-				shm_free(pcres[i]);
-			}
-		}
-		shm_free(pcres);
-	}
-	if ((pcres = shm_malloc(sizeof(pcre *) * num_pcres_tmp)) == 0) {
-		LM_ERR("no more memory for pcres\n");
+	/* Serialize in shared memory */
+	if (pcre2_serialize_encode((const pcre2_code **)pcres_tmp, num_pcres_tmp,
+				&bytes, &bytes_size, pcre_shm_gctx) < 0) {
+		LM_ERR("failed to serialize the pcres\n");
 		goto err;
 	}
-	memset(pcres, 0, sizeof(pcre *) * num_pcres_tmp);
-	for (i=0; i<num_pcres_tmp; i++) {
-		pcre_rc = pcre_fullinfo(pcres_tmp[i], NULL, PCRE_INFO_SIZE, &pcre_size);
-		if ((pcres[i] = shm_malloc(pcre_size)) == 0) {
-			LM_ERR("no more memory for pcres[%i]\n", i);
-			goto err;
-		}
-		memcpy(pcres[i], pcres_tmp[i], pcre_size);
+	if ((gen = shm_malloc(sizeof(rx_gen_t) + num_pcres_tmp * sizeof(int)))
+			== 0) {
+		LM_ERR("no more memory for the pcres generation\n");
+		goto err;
 	}
-	*num_pcres = num_pcres_tmp;
-	*pcres_addr = pcres;
+	memset(gen, 0, sizeof(rx_gen_t));
+	gen->ngroups = num_pcres_tmp;
+	gen->nlines = (int*)((char*)gen + sizeof(rx_gen_t));
+	memcpy(gen->nlines, nlines, num_pcres_tmp * sizeof(int));
+	gen->bytes = bytes;
+	bytes = NULL;
+
+	/* Swap the generation - the processes decode the current generation
+	 * under the lock, so the old one is not used anymore after it */
+	lock_get(reload_lock);
+	old = _rx_shared->gen;
+	gen->id = _rx_shared->gen_id + 1;
+	_rx_shared->gen = gen;
+	_rx_shared->gen_id = gen->id;
+	lock_release(reload_lock);
+	rx_gen_free(old);
+
+	LM_DBG("pcres generation %d loaded (%d groups, %d bytes)\n",
+			gen->id, gen->ngroups, (int)bytes_size);
 
 	/* Free used memory */
 	for (i=0; i<num_pcres_tmp; i++) {
-		pkg_free(pcres_tmp[i]);
+		pcre2_code_free(pcres_tmp[i]);
 	}
 	pkg_free(pcres_tmp);
 	/* Free allocated slots for unused patterns */
@@ -451,7 +557,7 @@ static int load_pcres(int action)
 		pkg_free(patterns[i]);
 	}
 	pkg_free(patterns);
-	lock_release(reload_lock);
+	pkg_free(nlines);
 
 	return 0;
 
@@ -464,53 +570,152 @@ err:
 		}
 		pkg_free(patterns);
 	}
+	if (nlines) {
+		pkg_free(nlines);
+	}
 	if (pcres_tmp) {
-		for (i=0; i<num_pcres_tmp; i++) {
-			if (pcres_tmp[i]) {
-				pkg_free(pcres_tmp[i]);
+		for (k=0; k<num_pcres_tmp; k++) {
+			if (pcres_tmp[k]) {
+				pcre2_code_free(pcres_tmp[k]);
 			}
 		}
 		pkg_free(pcres_tmp);
 	}
-	if (reload_lock) {
-		lock_release(reload_lock);
+	if (bytes) {
+		pcre2_serialize_free(bytes);
 	}
-	if (action == START) {
-		free_shared_memory();
+	if (gen) {
+		shm_free(gen);
 	}
 	return -1;
 }
 
 
-static void free_shared_memory(void)
+/*! \brief Free the process local copy of the pcres */
+static void rx_local_free(rx_local_t *rxl)
 {
 	int i;
 
-	if (pcres) {
-		for(i=0; i<*num_pcres; i++) {
-			if (pcres[i]) {
-				shm_free(pcres[i]);
-			}
+	for (i=0; i<rxl->ngroups; i++) {
+		if (rxl->mdata && rxl->mdata[i]) {
+			pcre2_match_data_free(rxl->mdata[i]);
 		}
-		shm_free(pcres);
-		pcres = NULL;
+		if (rxl->codes && rxl->codes[i]) {
+			pcre2_code_free(rxl->codes[i]);
+		}
+	}
+	if (rxl->codes) {
+		/* mdata, nlines and lnums are in the same block */
+		pkg_free(rxl->codes);
+	}
+	memset(rxl, 0, sizeof(rx_local_t));
+}
+
+
+/*! \brief Update the process local copy of the pcres to the current
+ * generation */
+static int rx_local_refresh(void)
+{
+	rx_local_t rxl;
+	rx_gen_t *gen;
+	char name[RX_LINE_NAME_SIZE];
+	int size;
+	int *lnums;
+	int rc;
+	int i, k;
+
+	memset(&rxl, 0, sizeof(rx_local_t));
+
+	lock_get(reload_lock);
+	gen = _rx_shared->gen;
+	if (gen == NULL) {
+		lock_release(reload_lock);
+		LM_ERR("no pcres loaded\n");
+		return -1;
+	}
+	if (gen->id == _rx_local.gen_id) {
+		lock_release(reload_lock);
+		return 0;
 	}
 
-	if (num_pcres) {
-		shm_free(num_pcres);
-		num_pcres = NULL;
+	size = 0;
+	for (i=0; i<gen->ngroups; i++) {
+		size += gen->nlines[i];
+	}
+	rxl.codes = pkg_malloc(gen->ngroups * (sizeof(pcre2_code*)
+				+ sizeof(pcre2_match_data*) + sizeof(int) + sizeof(int*))
+			+ size * sizeof(int));
+	if (rxl.codes == NULL) {
+		lock_release(reload_lock);
+		PKG_MEM_ERROR;
+		return -1;
 	}
+	memset(rxl.codes, 0, gen->ngroups * sizeof(pcre2_code*));
+	rxl.mdata = (pcre2_match_data**)(rxl.codes + gen->ngroups);
+	memset(rxl.mdata, 0, gen->ngroups * sizeof(pcre2_match_data*));
+	rxl.lnums = (int**)(rxl.mdata + gen->ngroups);
+	rxl.nlines = (int*)(rxl.lnums + gen->ngroups);
+	lnums = rxl.nlines + gen->ngroups;
+	memcpy(rxl.nlines, gen->nlines, gen->ngroups * sizeof(int));
+	rxl.gen_id = gen->id;
+	rxl.ngroups = gen->ngroups;
+
+	rc = pcre2_serialize_decode(rxl.codes, gen->ngroups, gen->bytes,
+			pcre_gctx);
+	lock_release(reload_lock);
+
+	if (rc < 0) {
+		LM_ERR("failed to decode the pcres generation %d (%d)\n",
+				rxl.gen_id, rc);
+		rxl.ngroups = 0;
+		pkg_free(rxl.codes);
+		return -1;
+	}
+
+	for (i=0; i<rxl.ngroups; i++) {
+		if (pcre_jit != 0) {
+			rc = pcre2_jit_compile(rxl.codes[i], PCRE2_JIT_COMPLETE);
+			if (rc < 0) {
+				LM_DBG("JIT compilation of group %d not done (%d)\n", i, rc);
+			}
+		}
+		rxl.mdata[i] = pcre2_match_data_create_from_pattern(rxl.codes[i],
+				pcre_gctx);
+		if (rxl.mdata[i] == NULL) {
+			LM_ERR("no more memory for the match data of group %d\n", i);
+			rx_local_free(&rxl);
+			return -1;
+		}
+		/* capturing group number of each line */
+		rxl.lnums[i] = lnums;
+		for (k=0; k<rxl.nlines[i]; k++) {
+			snprintf(name, RX_LINE_NAME_SIZE, RX_LINE_NAME "%d", k);
+			lnums[k] = pcre2_substring_number_from_name(rxl.codes[i],
+					(PCRE2_SPTR)name);
+		}
+		lnums += rxl.nlines[i];
+	}
+
+	rx_local_free(&_rx_local);
+	memcpy(&_rx_local, &rxl, sizeof(rx_local_t));
+	LM_DBG("using pcres generation %d\n", _rx_local.gen_id);
+	return 0;
+}
+
 
-	if (pcres_addr) {
-		shm_free(pcres_addr);
-		pcres_addr = NULL;
+static void free_shared_memory(void)
+{
+	if (_rx_shared) {
+		rx_gen_free(_rx_shared->gen);
+		shm_free(_rx_shared);
+		_rx_shared = NULL;
 	}
 
 	if (reload_lock) {
 		lock_destroy(reload_lock);
 		lock_dealloc(reload_lock);
 		reload_lock = NULL;
-    }
+	}
 }
 
 
@@ -521,42 +726,52 @@ static void free_shared_memory(void)
 /*! \brief Return true if the argument matches the regular expression parameter */
 static int ki_pcre_match(sip_msg_t* msg, str* string, str* regex)
 {
-	pcre *pcre_re = NULL;
+	pcre2_code *pcre_re = NULL;
+	pcre2_match_data *pcre_md = NULL;
 	int pcre_rc;
-	const char *pcre_error;
-	int pcre_erroffset;
+	int pcre_error_num = 0;
+	PCRE2_UCHAR pcre_error[128];
+	PCRE2_SIZE pcre_erroffset;
 
-	pcre_re = pcre_compile(regex->s, pcre_options, &pcre_error, &pcre_erroffset, NULL);
+	pcre_re = pcre2_compile((PCRE2_SPTR)regex->s, (PCRE2_SIZE)regex->len,
+			pcre_options, &pcre_error_num, &pcre_erroffset, pcre_cctx);
 	if (pcre_re == NULL) {
+		pcre2_get_error_message(pcre_error_num, pcre_error, sizeof(pcre_error));
 		LM_ERR("pcre_re compilation of '%s' failed at offset %d: %s\n",
-				regex->s, pcre_erroffset, pcre_error);
+				regex->s, (int)pcre_erroffset, pcre_error);
 		return -4;
 	}
 
-	pcre_rc = pcre_exec(
+	pcre_md = pcre2_match_data_create_from_pattern(pcre_re, pcre_gctx);
+	if (pcre_md == NULL) {
+		LM_ERR("no more memory for the match data\n");
+		pcre2_code_free(pcre_re);
+		return -4;
+	}
+	pcre_rc = pcre2_match(
 		pcre_re,                    /* the compiled pattern */
-		NULL,                       /* no extra data - we didn't study the pattern */
-		string->s,                  /* the matching string */
-		(int)(string->len),         /* the length of the subject */
+		(PCRE2_SPTR)string->s,      /* the matching string */
+		(PCRE2_SIZE)(string->len),  /* the length of the subject */
 		0,                          /* start at offset 0 in the string */
 		0,                          /* default options */
-		NULL,                       /* output vector for substring information */
-		0);                         /* number of elements in the output vector */
+		pcre_md,                    /* the match data block */
+		NULL);                      /* default match context */
+
+	pcre2_match_data_free(pcre_md);
+	pcre2_code_free(pcre_re);
 
 	/* Matching failed: handle error cases */
 	if (pcre_rc < 0) {
 		switch(pcre_rc) {
-			case PCRE_ERROR_NOMATCH:
+			case PCRE2_ERROR_NOMATCH:
 				LM_DBG("'%s' doesn't match '%s'\n", string->s, regex->s);
 				break;
 			default:
 				LM_DBG("matching error '%d'\n", pcre_rc);
 				break;
 		}
-		pcre_free(pcre_re);
 		return -1;
 	}
-	pcre_free(pcre_re);
 	LM_DBG("'%s' matches '%s'\n", string->s, regex->s);
 	return 1;
 }
@@ -591,10 +806,38 @@ static int w_pcre_match(struct sip_msg* _msg, char* _s1, char* _s2)
 	return ki_pcre_match(_msg, &string, &regex);
 }
 
-/*! \brief Return true if the string argument matches the pattern group parameter */
-static int ki_pcre_match_group(sip_msg_t* _msg, str* string, int num_pcre)
+/*! \brief Look up the result of a group match in the process cache */
+static rx_cache_entry_t *rx_cache_get(str *string, int num_pcre,
+		unsigned int *hashid)
 {
+	if (match_cache_size <= 0 || string->len > RX_CACHE_SUBJECT_MAX) {
+		return NULL;
+	}
+	if (_rx_cache == NULL) {
+		_rx_cache = pkg_malloc(match_cache_size * sizeof(rx_cache_entry_t));
+		if (_rx_cache == NULL) {
+			PKG_MEM_ERROR;
+			match_cache_size = 0;
+			return NULL;
+		}
+		memset(_rx_cache, 0, match_cache_size * sizeof(rx_cache_entry_t));
+	}
+	*hashid = get_hash1_raw(string->s, string->len) + num_pcre;
+	return &_rx_cache[*hashid % match_cache_size];
+}
+
+/*! \brief Match the string against a group, the index of the matching
+ * pattern in the group is set in idx (-1 if not known) */
+static int rx_match_group(str* string, int num_pcre, int *idx)
+{
+	rx_cache_entry_t *ce;
+	unsigned int hashid = 0;
+	PCRE2_SIZE *ovector;
 	int pcre_rc;
+	int *lnums;
+	int k;
+
+	*idx = -1;
 
 	/* Check if group matching feature is enabled */
 	if (file == NULL) {
@@ -602,48 +845,102 @@ static int ki_pcre_match_group(sip_msg_t* _msg, str* string, int num_pcre)
 		return -2;
 	}
 
-	if (num_pcre >= *num_pcres) {
+	if (_rx_local.gen_id != _rx_shared->gen_id) {
+		if (rx_local_refresh() < 0 && _rx_local.ngroups == 0) {
+			return -4;
+		}
+	}
+
+	if (num_pcre < 0 || num_pcre >= _rx_local.ngroups) {
 		LM_ERR("invalid pcre index '%i', there are %i pcres\n", num_pcre,
-				*num_pcres);
+				_rx_local.ngroups);
 		return -4;
 	}
 
-	lock_get(reload_lock);
+	ce = rx_cache_get(string, num_pcre, &hashid);
+	if (ce != NULL && ce->gen_id == _rx_local.gen_id && ce->hashid == hashid
+			&& ce->group == num_pcre && ce->len == string->len
+			&& memcmp(ce->subject, string->s, string->len) == 0) {
+		*idx = ce->idx;
+		return ce->ret;
+	}
 
-	pcre_rc = pcre_exec(
-		(*pcres_addr)[num_pcre],    /* the compiled pattern */
-		NULL,                       /* no extra data - we didn't study the pattern */
-		string->s,                  /* the matching string */
-		(int)(string->len),         /* the length of the subject */
+	pcre_rc = pcre2_match(
+		_rx_local.codes[num_pcre],  /* the compiled pattern */
+		(PCRE2_SPTR)string->s,      /* the matching string */
+		(PCRE2_SIZE)(string->len),  /* the length of the subject */
 		0,                          /* start at offset 0 in the string */
 		0,                          /* default options */
-		NULL,                       /* output vector for substring information */
-		0);                         /* number of elements in the output vector */
-
-	lock_release(reload_lock);
+		_rx_local.mdata[num_pcre],  /* the match data block */
+		NULL);                      /* default match context */
 
 	/* Matching failed: handle error cases */
 	if (pcre_rc < 0) {
 		switch(pcre_rc) {
-			case PCRE_ERROR_NOMATCH:
-				LM_DBG("'%s' doesn't match pcres[%i]\n", string->s, num_pcre);
+			case PCRE2_ERROR_NOMATCH:
+				LM_DBG("'%.*s' doesn't match pcres[%i]\n", string->len,
+						string->s, num_pcre);
 				break;
 			default:
 				LM_DBG("matching error '%d'\n", pcre_rc);
-				break;
+				/* not cached */
+				return -1;
 		}
-		return -1;
 	} else {
-		LM_DBG("'%s' matches pcres[%i]\n", string->s, num_pcre);
-		return 1;
+		/* the named group of the matching line is the one set */
+		ovector = pcre2_get_ovector_pointer(_rx_local.mdata[num_pcre]);
+		lnums = _rx_local.lnums[num_pcre];
+		for (k=0; k<_rx_local.nlines[num_pcre]; k++) {
+			if (lnums[k] > 0 && lnums[k] < pcre_rc
+					&& ovector[2*lnums[k]] != PCRE2_UNSET) {
+				*idx = k;
+				break;
+			}
+		}
+		LM_DBG("'%.*s' matches pcres[%i] (pattern %d)\n", string->len,
+				string->s, num_pcre, *idx);
+	}
+
+	if (ce != NULL) {
+		ce->gen_id = _rx_local.gen_id;
+		ce->group = num_pcre;
+		ce->hashid = hashid;
+		ce->ret = (pcre_rc < 0) ? -1 : 1;
+		ce->idx = *idx;
+		ce->len = string->len;
+		memcpy(ce->subject, string->s, string->len);
 	}
+	return (pcre_rc < 0) ? -1 : 1;
 }
 
 /*! \brief Return true if the string argument matches the pattern group parameter */
-static int w_pcre_match_group(struct sip_msg* _msg, char* _s1, char* _s2)
+static int ki_pcre_match_group(sip_msg_t* _msg, str* string, int num_pcre)
 {
-	str string, group;
-	unsigned int num_pcre = 0;
+	int idx;
+
+	return rx_match_group(string, num_pcre, &idx);
+}
+
+/*! \brief Return the index of the pattern matching the string argument in
+ * the group parameter, negative if none matches */
+static int ki_pcre_match_group_index(sip_msg_t* _msg, str* string,
+		int num_pcre)
+{
+	int idx;
+	int ret;
+
+	ret = rx_match_group(string, num_pcre, &idx);
+	if (ret < 0) {
+		return ret;
+	}
+	return (idx >= 0) ? idx : -1;
+}
+
+/*! \brief Get the string and the group of the group matching functions */
+static int rx_get_group_params(struct sip_msg* _msg, char* _s1, char* _s2,
+		str *string, unsigned int *num_pcre)
+{
+	str group;
 
 	if (_s1 == NULL) {
 		LM_ERR("bad parameters\n");
@@ -651,25 +948,88 @@ static int w_pcre_match_group(struct sip_msg* _msg, char* _s1, char* _s2)
 	}
 
 	if (_s2 == NULL) {
-		num_pcre = 0;
+		*num_pcre = 0;
 	} else {
 		if (fixup_get_svalue(_msg, (gparam_p)_s2, &group))
 		{
 			LM_ERR("cannot print the format for second param\n");
 			return -5;
 		}
-		str2int(&group, &num_pcre);
+		str2int(&group, num_pcre);
 	}
 
-	if (fixup_get_svalue(_msg, (gparam_p)_s1, &string))
+	if (fixup_get_svalue(_msg, (gparam_p)_s1, string))
 	{
 		LM_ERR("cannot print the format for first param\n");
 		return -5;
 	}
+	return 0;
+}
+
+/*! \brief Return true if the string argument matches the pattern group parameter */
+static int w_pcre_match_group(struct sip_msg* _msg, char* _s1, char* _s2)
+{
+	str string;
+	unsigned int num_pcre = 0;
+	int ret;
+
+	if ((ret = rx_get_group_params(_msg, _s1, _s2, &string, &num_pcre)) < 0) {
+		return ret;
+	}
 
 	return ki_pcre_match_group(_msg, &string, (int)num_pcre);
 }
 
+/*! \brief Return true if the string argument matches the pattern group
+ * parameter and set the index of the matching pattern in the variable */
+static int w_pcre_match_group_index(struct sip_msg* _msg, char* _s1,
+		char* _s2, char* _s3)
+{
+	str string;
+	unsigned int num_pcre = 0;
+	pv_spec_t *dst;
+	pv_value_t val;
+	int idx;
+	int ret;
+
+	if ((ret = rx_get_group_params(_msg, _s1, _s2, &string, &num_pcre)) < 0) {
+		return ret;
+	}
+
+	ret = rx_match_group(&string, (int)num_pcre, &idx);
+	if (ret < 0) {
+		return ret;
+	}
+
+	dst = (pv_spec_t*)_s3;
+	memset(&val, 0, sizeof(pv_value_t));
+	val.flags = PV_TYPE_INT|PV_VAL_INT;
+	val.ri = idx;
+	if (dst->setf(_msg, &dst->pvp, (int)EQ_T, &val) < 0) {
+		LM_ERR("failed to set the index of the matching pattern\n");
+		return -5;
+	}
+	return ret;
+}
+
+static int fixup_pcre_match_group_index(void** param, int param_no)
+{
+	if (param_no == 1 || param_no == 2) {
+		return fixup_spve_null(param, 1);
+	}
+	if (param_no == 3) {
+		if (fixup_pvar_null(param, 1) != 0) {
+			LM_ERR("failed to fixup the result pvar\n");
+			return -1;
+		}
+		if (((pv_spec_t*)(*param))->setf == NULL) {
+			LM_ERR("the result pvar is not writable\n");
+			return -1;
+		}
+	}
+	return 0;
+}
+
 
 /*
  * RPC functions
@@ -690,7 +1050,7 @@ void regex_rpc_reload(rpc_t* rpc, void* ctx)
 		rpc->fault(ctx, 500, "Failed to reload");
 		return;
 	}
-	LM_INFO("reload success\n");
+	LM_INFO("reload success (generation %d)\n", _rx_shared->gen_id);
 
 }
 
@@ -733,6 +1093,11 @@ static sr_kemi_t sr_kemi_regex_exports[] = {
 		{ SR_KEMIP_STR, SR_KEMIP_INT, SR_KEMIP_NONE,
 			SR_KEMIP_NONE, SR_KEMIP_NONE, SR_KEMIP_NONE }
 	},
+	{ str_init("regex"), str_init("pcre_match_group_index"),
+		SR_KEMIP_INT, ki_pcre_match_group_index,
+		{ SR_KEMIP_STR, SR_KEMIP_INT, SR_KEMIP_NONE,
+			SR_KEMIP_NONE, SR_KEMIP_NONE, SR_KEMIP_NONE }
+	},
 
 	{ {0, 0}, {0, 0}, 0, NULL, { 0, 0, 0, 0, 0, 0 } }
 };
@@ -47,6 +47,7 @@
 
 
 extern int reg_lookup_filter_mode;
+extern int reg_lookup_branch_cache;
 
 typedef struct reg_lookup_filter {
 	uint32_t factive;
@@ -99,6 +100,197 @@ static int has_to_tag(struct sip_msg* msg)
 	return (get_to(msg)->tag_value.len > 0) ? 1 : 0;
 }
 
+/*! \brief
+ * compute the path vector and its first hop to be used as destination
+ * for a contact, skipping the first hop if it is local
+ * \return 0 on success, -1 on error
+ */
+static int reg_contact_path_dst(ucontact_t* ptr, str* path_str, str* path_dst)
+{
+	sip_uri_t path_uri;
+
+	/* make a copy, so any change we need to make here does not mess up
+	 * the structure in usrloc */
+	*path_str = ptr->path;
+	if (get_path_dst_uri(path_str, path_dst) < 0) {
+		LM_ERR("failed to get dst_uri for Path\n");
+		return -1;
+	}
+	if (path_check_local > 0) {
+		if (parse_uri(path_dst->s, path_dst->len, &path_uri) < 0){
+			LM_ERR("failed to parse the Path URI\n");
+			return -1;
+		}
+		if (check_self(&(path_uri.host), 0, 0)) {
+			/* first hop in path vector is local - check for additional hops
+			 * and if present, point to next one */
+			if (path_str->len > (path_dst->len + 3)) {
+				path_str->s = path_str->s + path_dst->len + 3;
+				path_str->len = path_str->len - path_dst->len - 3;
+				if (get_path_dst_uri(path_str, path_dst) < 0) {
+					LM_ERR("failed to get second dst_uri for Path\n");
+					return -1;
+				}
+			} else {
+				/* no more hops */
+				path_dst->s = NULL;
+				path_dst->len = 0;
+			}
+		}
+	}
+	return 0;
+}
+
+/*! \brief
+ * Per process cache of the contacts of the looked up records, with the
+ * fields needed to build the branches copied in private memory and the
+ * Path destination already computed. An item is valid as long as the
+ * usrloc record has the same version, letting lookup release the usrloc
+ * lock right after checking it. One item per slot, indexed by aor hash.
+ */
+typedef struct reg_bcache_contact {
+	ucontact_t c;            /*!< copy of the usrloc contact */
+	str path_str;            /*!< path vector for the branch */
+	str path_dst;            /*!< first hop of the path vector */
+	int path_err;            /*!< path destination could not be computed */
+} reg_bcache_contact_t;
+
+typedef struct reg_bcache_item {
+	unsigned int version;    /*!< version of the usrloc record */
+	str aor;
+	int ncontacts;
+	reg_bcache_contact_t *contacts;
+} reg_bcache_item_t;
+
+static reg_bcache_item_t **_reg_bcache = NULL;
+
+#define reg_bcache_str_cp(_d, _s, _p) \
+	do { \
+		if((_s).s!=NULL && (_s).len>0) { \
+			memcpy((_p), (_s).s, (_s).len); \
+			(_d).s = (_p); \
+			(_d).len = (_s).len; \
+			(_p) += (_s).len; \
+		} else { \
+			(_d).s = NULL; \
+			(_d).len = 0; \
+		} \
+	} while(0)
+
+/*! \brief
+ * get the cached contacts for a record, building them if the record changed
+ * - to be called with the record locked
+ * \return the cache item or NULL if the record cannot be cached
+ */
+static reg_bcache_item_t* reg_bcache_get(urecord_t* r)
+{
+	reg_bcache_item_t *it;
+	reg_bcache_contact_t *bc;
+	ucontact_t *ptr;
+	unsigned int slot;
+	int size;
+	int n;
+	char *p;
+
+	if(r->version==0) {
+		return NULL;
+	}
+	if(_reg_bcache==NULL) {
+		_reg_bcache = (reg_bcache_item_t**)pkg_malloc(
+				reg_lookup_branch_cache*sizeof(reg_bcache_item_t*));
+		if(_reg_bcache==NULL) {
+			PKG_MEM_ERROR;
+			return NULL;
+		}
+		memset(_reg_bcache, 0, reg_lookup_branch_cache*sizeof(reg_bcache_item_t*));
+	}
+	slot = r->aorhash & (reg_lookup_branch_cache-1);
+	it = _reg_bcache[slot];
+	if(it!=NULL && it->version==r->version) {
+		return it;
+	}
+
+	size = sizeof(reg_bcache_item_t) + r->aor.len;
+	n = 0;
+	for(ptr=r->contacts; ptr; ptr=ptr->next) {
+		if(ptr->xavp!=NULL) {
+			/* contact xavps are cloned from usrloc at lookup time */
+			return NULL;
+		}
+		size += sizeof(reg_bcache_contact_t) + ptr->c.len + ptr->received.len
+			+ ptr->path.len + ptr->instance.len + ptr->ruid.len
+			+ ptr->user_agent.len;
+		n++;
+	}
+	if(it!=NULL) {
+		pkg_free(it);
+		_reg_bcache[slot] = NULL;
+	}
+	it = (reg_bcache_item_t*)pkg_malloc(size);
+	if(it==NULL) {
+		PKG_MEM_ERROR;
+		return NULL;
+	}
+	memset(it, 0, sizeof(reg_bcache_item_t));
+	it->version = r->version;
+	it->ncontacts = n;
+	it->contacts = (reg_bcache_contact_t*)(it + 1);
+	p = (char*)(it->contacts + n);
+	memcpy(p, r->aor.s, r->aor.len);
+	it->aor.s = p;
+	it->aor.len = r->aor.len;
+	p += r->aor.len;
+
+	for(ptr=r->contacts, bc=it->contacts; ptr; ptr=ptr->next, bc++) {
+		memset(bc, 0, sizeof(reg_bcache_contact_t));
+		memcpy(&bc->c, ptr, sizeof(ucontact_t));
+		bc->c.aor = &it->aor;
+		bc->c.xavp = NULL;
+		reg_bcache_str_cp(bc->c.c, ptr->c, p);
+		reg_bcache_str_cp(bc->c.received, ptr->received, p);
+		reg_bcache_str_cp(bc->c.path, ptr->path, p);
+		reg_bcache_str_cp(bc->c.instance, ptr->instance, p);
+		reg_bcache_str_cp(bc->c.ruid, ptr->ruid, p);
+		reg_bcache_str_cp(bc->c.user_agent, ptr->user_agent, p);
+		/* strings not used for branches */
+		bc->c.callid.s = NULL;
+		bc->c.callid.len = 0;
+		bc->c.uniq.s = NULL;
+		bc->c.uniq.len = 0;
+		bc->c.prev = (bc==it->contacts)?NULL:&(bc-1)->c;
+		bc->c.next = (ptr->next)?&(bc+1)->c:NULL;
+		if(bc->c.path.len>0) {
+			bc->path_err = reg_contact_path_dst(&bc->c, &bc->path_str,
+					&bc->path_dst);
+		}
+	}
+	_reg_bcache[slot] = it;
+	return it;
+}
+
+/*! \brief
+ * path vector and destination for a contact, from cache if it is there
+ * \return 0 on success, -1 on error
+ */
+static inline int reg_lookup_path_dst(ucontact_t* ptr, int cached,
+		str* path_str, str* path_dst)
+{
+	reg_bcache_contact_t *bc;
+
+	if(!cached) {
+		return reg_contact_path_dst(ptr, path_str, path_dst);
+	}
+	/* the contact is the first field of the cache structure */
+	bc = (reg_bcache_contact_t*)ptr;
+	if(bc->path_err) {
+		LM_ERR("failed to get dst_uri for Path\n");
+		return -1;
+	}
+	*path_str = bc->path_str;
+	*path_dst = bc->path_dst;
+	return 0;
+}
+
 #define allowed_method(_msg, _c) \
 	( !method_filtering || ((_msg)->REQ_METHOD)&((_c)->methods) || \
 	  has_to_tag(_msg) )
@@ -240,9 +432,9 @@ int lookup_helper(struct sip_msg* _m, udomain_t* _d, str* _uri, int _mode)
 	str inst = {0};
 	unsigned int ahash = 0;
 	sr_xavp_t *xavp=NULL;
-	sip_uri_t path_uri;
 	str path_str;
 	branch_t *nbranch;
+	reg_bcache_item_t *bcache = NULL;
 
 	ret = -1;
 
@@ -300,7 +492,17 @@ int lookup_helper(struct sip_msg* _m, udomain_t* _d, str* _uri, int _mode)
 			return -1;
 		}
 
-		ptr = r->contacts;
+		if (reg_lookup_branch_cache > 0) {
+			bcache = reg_bcache_get(r);
+		}
+		if (bcache != NULL) {
+			/* continue with the private copy of the contacts */
+			ul.release_urecord(r);
+			ul.unlock_udomain(_d, &aor);
+			ptr = (bcache->ncontacts > 0) ? &bcache->contacts[0].c : NULL;
+		} else {
+			ptr = r->contacts;
+		}
 		ret = -1;
 		/* look first for an un-expired and suported contact */
 		while (ptr) {
@@ -375,36 +577,11 @@ int lookup_helper(struct sip_msg* _m, udomain_t* _d, str* _uri, int _mode)
 		 * received-uri because in that case the last hop towards the uac
 		 * has to handle NAT. - agranig */
 		if (ptr->path.s && ptr->path.len) {
-			/* make a copy, so any change we need to make here does not mess up the structure in usrloc */
-			path_str = ptr->path;
-			if (get_path_dst_uri(&path_str, &path_dst) < 0) {
-				LM_ERR("failed to get dst_uri for Path\n");
+			if (reg_lookup_path_dst(ptr, (bcache!=NULL), &path_str,
+						&path_dst) < 0) {
 				ret = -3;
 				goto done;
 			}
-			if (path_check_local > 0) {
-				if (parse_uri(path_dst.s, path_dst.len, &path_uri) < 0){
-					LM_ERR("failed to parse the Path URI\n");
-					ret = -3;
-					goto done;
-				}
-				if (check_self(&(path_uri.host), 0, 0)) {
-					/* first hop in path vector is local - check for additional hops and if present, point to next one */
-					if (path_str.len > (path_dst.len + 3)) {
-						path_str.s = path_str.s + path_dst.len + 3;
-						path_str.len = path_str.len - path_dst.len - 3;
-						if (get_path_dst_uri(&path_str, &path_dst) < 0) {
-							LM_ERR("failed to get second dst_uri for Path\n");
-							ret = -3;
-							goto done;
-						}
-					} else {
-						/* no more hops */
-						path_dst.s = NULL;
-						path_dst.len = 0;
-					}
-				}
-			}
 		} else {
 			path_dst.s = NULL;
 			path_dst.len = 0;
@@ -489,32 +666,10 @@ int lookup_helper(struct sip_msg* _m, udomain_t* _d, str* _uri, int _mode)
 				&& reg_lookup_filter_match(ptr)) {
 			path_dst.len = 0;
 			if(ptr->path.s && ptr->path.len) {
-				path_str = ptr->path;
-				if (get_path_dst_uri(&path_str, &path_dst) < 0) {
-					LM_ERR("failed to get dst_uri for Path\n");
+				if (reg_lookup_path_dst(ptr, (bcache!=NULL), &path_str,
+							&path_dst) < 0) {
 					continue;
 				}
-				if (path_check_local > 0) {
-					if (parse_uri(path_dst.s, path_dst.len, &path_uri) < 0) {
-						LM_ERR("failed to parse the Path URI\n");
-						continue;
-					}
-					if (check_self(&(path_uri.host), 0, 0)) {
-						/* first hop in path vector is local - check for additional hops and if present, point to next one */
-						if (path_str.len > (path_dst.len + 3)) {
-							path_str.s = path_str.s + path_dst.len + 3;
-							path_str.len = path_str.len - path_dst.len - 3;
-							if (get_path_dst_uri(&path_str, &path_dst) < 0) {
-								LM_ERR("failed to get second dst_uri for Path\n");
-								continue;
-							}
-						} else {
-							/* no more hops */
-							path_dst.s = NULL;
-							path_dst.len = 0;
-						}
-					}
-				}
 			} else {
 				path_dst.s = NULL;
 				path_dst.len = 0;
@@ -556,8 +711,10 @@ int lookup_helper(struct sip_msg* _m, udomain_t* _d, str* _uri, int _mode)
 	}
 
 done:
-	ul.release_urecord(r);
-	ul.unlock_udomain(_d, &aor);
+	if (bcache == NULL) {
+		ul.release_urecord(r);
+		ul.unlock_udomain(_d, &aor);
+	}
 	return ret;
 }
 
@@ -139,6 +139,8 @@ int reg_expire_event_rt = -1; /* default disabled */
 str reg_event_callback = STR_NULL;
 
 int reg_lookup_filter_mode = 0;
+int reg_lookup_branch_cache = 0;
+int reg_refresh_fast_path = 0;
 int reg_min_expires_mode = 0;
 
 sr_kemi_eng_t *keng = NULL;
@@ -250,6 +252,8 @@ static param_export_t params[] = {
 	{"contact_max_size",   INT_PARAM, &contact_max_size					},
 	{"event_callback",     PARAM_STR, &reg_event_callback				},
 	{"lookup_filter_mode", INT_PARAM, &reg_lookup_filter_mode			},
+	{"lookup_branch_cache", INT_PARAM, &reg_lookup_branch_cache			},
+	{"refresh_fast_path",  INT_PARAM, &reg_refresh_fast_path				},
 	{"min_expires_mode",   PARAM_INT, &reg_min_expires_mode				},
 	{"use_expired_contacts",  INT_PARAM, &default_registrar_cfg.use_expired_contacts	 },
 	{0, 0, 0}
@@ -296,6 +300,7 @@ static int mod_init(void)
 	str s;
 	bind_usrloc_t bind_usrloc;
 	qvalue_t dq;
+	int i;
 
 	if(sruid_init(&_reg_sruid, '-', "uloc", SRUID_INC) < 0) {
 		return -1;
@@ -340,6 +345,12 @@ static int mod_init(void)
 		rcv_avp_type = 0;
 	}
 
+	if (reg_lookup_branch_cache > 0) {
+		/* number of slots has to be power of 2 */
+		for (i = 1; i < reg_lookup_branch_cache; i <<= 1);
+		reg_lookup_branch_cache = i;
+	}
+
 	bind_usrloc = (bind_usrloc_t)find_export("ul_bind_usrloc", 1, 0);
 	if (!bind_usrloc) {
 		LM_ERR("Can't bind to the usrloc module."
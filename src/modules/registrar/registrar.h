@@ -110,6 +110,7 @@ extern sl_api_t slb;
 
 extern int reg_expire_event_rt;
 extern int reg_min_expires_mode;
+extern int reg_refresh_fast_path;
 
 extern stat_var *accepted_registrations;
 extern stat_var *rejected_registrations;
@@ -758,6 +758,11 @@ static inline int update_contacts(struct sip_msg* _m, urecord_t* _r, int _mode,
 					goto error;
 				}
 				rc = 3;
+			} else if (reg_refresh_fast_path && !_mode
+					&& ul.refresh_ucontact(_r, c, ci) == 0) {
+				/* refresh with the same attributes - updated in place */
+				LM_DBG("contact <%.*s> refreshed\n", c->c.len, c->c.s);
+				rc = 2;
 			} else {
 				/* do update */
 				if(_mode)
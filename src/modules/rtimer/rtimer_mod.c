@@ -25,6 +25,13 @@
 #include <sys/ipc.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <errno.h>
+#include <time.h>
+#include <stdint.h>
+#ifdef __OS_linux
+#include <sys/timerfd.h>
+#define RTIMER_TIMERFD
+#endif
 
 #include "../../core/sr_module.h"
 #include "../../core/timer.h"
@@ -41,6 +48,11 @@
 #include "../../core/parser/parse_param.h"
 #include "../../core/fmsg.h"
 #include "../../core/kemi.h"
+#include "../../core/locking.h"
+#include "../../core/async_task.h"
+#include "../../core/rpc.h"
+#include "../../core/rpc_lookup.h"
+#include "../../core/cfg/cfg_struct.h"
 
 
 MODULE_VERSION
@@ -55,16 +67,41 @@ typedef struct _stm_route {
 	struct _stm_route *next;
 } stm_route_t;
 
+/* execution statistics of a timer - in shm, updated by all its workers */
+typedef struct _stm_stats {
+	gen_lock_t lock;
+	unsigned long long runs;       /* number of route executions */
+	unsigned long long exec_us;    /* sum of the execution times */
+	unsigned int exec_max_us;      /* highest execution time */
+	unsigned long long overruns;   /* executions longer than the interval */
+	unsigned long long missed;     /* ticks lost because of late wakeups */
+	unsigned long long skipped;    /* ticks not dispatched to the pool */
+	unsigned int drift_max_us;     /* highest wakeup delay */
+	int queued;                    /* tasks pushed but not started yet */
+} stm_stats_t;
+
 typedef struct _stm_timer {
 	str name;
 	unsigned int mode;
 	unsigned int flags;
 	unsigned int interval;
+	str group;
+	async_wgroup_t *awg;
+	stm_stats_t *stats;
 	stm_route_t *rt;
 	struct _stm_timer *next;
 } stm_timer_t;
 
+/* route execution dispatched to the async workers */
+typedef struct _stm_task {
+	stm_timer_t *timer;
+	stm_route_t *rt;
+	int worker;
+} stm_task_t;
+
 #define RTIMER_INTERVAL_USEC	(1<<0)
+#define RTIMER_ASYNC			(1<<1)
+#define RTIMER_PRECISE			(1<<2)
 
 stm_timer_t *_stm_list = NULL;
 
@@ -77,6 +114,11 @@ int stm_e_param(modparam_t type, void* val);
 void stm_timer_exec(unsigned int ticks, int worker, void *param);
 void stm_main_timer_exec(unsigned int ticks, void *param);
 int stm_get_worker(struct sip_msg *msg, pv_param_t *param, pv_value_t *res);
+static void stm_timer_run(unsigned int ticks, int worker, stm_timer_t *it);
+static int fork_precise_timer(int child_id, char* desc, int worker,
+		stm_timer_t *it);
+
+static rpc_export_t rtimer_rpc_cmds[];
 
 static pv_export_t rtimer_pvs[] = {
 	{{"rtimer_worker", (sizeof("rtimer_worker")-1)}, PVT_OTHER, stm_get_worker, 0,	0, 0, 0, 0},
@@ -96,7 +138,7 @@ struct module_exports exports= {
 	DEFAULT_DLFLAGS, /* dlopen flags */
 	0,
 	params,
-	0,           /* exported RPC methods */
+	rtimer_rpc_cmds, /* exported RPC methods */
 	rtimer_pvs,  /* exported pseudo-variables */
 	0,
 	mod_init,    /* module initialization function */
@@ -125,6 +167,31 @@ static int mod_init(void)
 	it = _stm_list;
 	while(it)
 	{
+		it->stats = (stm_stats_t*)shm_malloc(sizeof(stm_stats_t));
+		if(it->stats==NULL)
+		{
+			SHM_MEM_ERROR;
+			return -1;
+		}
+		memset(it->stats, 0, sizeof(stm_stats_t));
+		if(lock_init(&it->stats->lock)==NULL)
+		{
+			LM_ERR("failed to init the stats lock\n");
+			return -1;
+		}
+		if(it->flags & RTIMER_ASYNC)
+		{
+			/* the async groups are set by the core parameters, so they
+			 * are known by now */
+			it->awg = async_task_group_find(&it->group);
+			if(it->awg==NULL || it->awg->workers<=0)
+			{
+				LM_ERR("async group [%.*s] not defined or without workers"
+						" - timer %.*s\n", it->group.len, it->group.s,
+						it->name.len, it->name.s);
+				return -1;
+			}
+		}
 		if(it->mode==0)
 		{
 			if(register_timer(stm_main_timer_exec, (void*)it, it->interval)<0)
@@ -160,7 +227,13 @@ static int child_init(int rank)
 		{
 			snprintf(si_desc, MAX_PT_DESC, "RTIMER EXEC child=%d timer=%.*s",
 			         i, it->name.len, it->name.s);
-			if(it->flags & RTIMER_INTERVAL_USEC)
+			if(it->flags & RTIMER_PRECISE)
+			{
+				if(fork_precise_timer(PROC_TIMER, si_desc, i, it)<0) {
+					LM_ERR("failed to start precise timer routine as process\n");
+					return -1; /* error */
+				}
+			} else if(it->flags & RTIMER_INTERVAL_USEC)
 			{
 				if(fork_basic_utimer_w(PROC_TIMER, si_desc, 1 /*socks flag*/,
 								stm_timer_exec, i, (void*)it, it->interval
@@ -190,41 +263,289 @@ void stm_main_timer_exec(unsigned int ticks, void *param)
 	stm_timer_exec(ticks, 0, param);
 }
 
-void stm_timer_exec(unsigned int ticks, int worker, void *param)
+/**
+ * monotonic time in microseconds
+ */
+static unsigned long long stm_now_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long long)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/**
+ * interval of the timer in microseconds
+ */
+static unsigned long long stm_interval_us(stm_timer_t *it)
+{
+	if(it->flags & RTIMER_INTERVAL_USEC)
+		return it->interval;
+	return (unsigned long long)it->interval * 1000000;
+}
+
+/**
+ * execute a route of the timer and account its duration
+ */
+static void stm_route_exec(stm_timer_t *it, stm_route_t *rt)
 {
-	stm_timer_t *it;
-	stm_route_t *rt;
 	sip_msg_t *fmsg;
 	sr_kemi_eng_t *keng = NULL;
 	str evname = str_init("rtimer");
-	rt_worker = worker;
+	unsigned long long tstart;
+	unsigned int d;
+
+	fmsg = faked_msg_next();
+	if (exec_pre_script_cb(fmsg, REQUEST_CB_TYPE)==0 )
+		return; /* drop the request */
+	tstart = stm_now_us();
+	set_route_type(REQUEST_ROUTE);
+	keng = sr_kemi_eng_get();
+	if(keng==NULL) {
+		run_top_route(main_rt.rlist[rt->route], fmsg, 0);
+	} else {
+		if(sr_kemi_route(keng, fmsg, EVENT_ROUTE, &rt->route_name, &evname)<0) {
+			LM_ERR("error running event route kemi callback [%.*s]\n",
+					rt->route_name.len, rt->route_name.s);
+		}
+	}
+	exec_post_script_cb(fmsg, REQUEST_CB_TYPE);
+	ksr_msg_env_reset();
 
-	if(param==NULL)
+	if(it->stats==NULL)
 		return;
-	it = (stm_timer_t*)param;
+	d = (unsigned int)(stm_now_us() - tstart);
+	lock_get(&it->stats->lock);
+	it->stats->runs++;
+	it->stats->exec_us += d;
+	if(d > it->stats->exec_max_us)
+		it->stats->exec_max_us = d;
+	if(d > stm_interval_us(it))
+		it->stats->overruns++;
+	lock_release(&it->stats->lock);
+}
+
+/**
+ * async worker callback - executes a route of a timer
+ */
+static void stm_task_exec(void *param)
+{
+	stm_task_t *tp;
+
+	tp = (stm_task_t*)param;
+	rt_worker = tp->worker;
+	lock_get(&tp->timer->stats->lock);
+	tp->timer->stats->queued--;
+	lock_release(&tp->timer->stats->lock);
+	stm_route_exec(tp->timer, tp->rt);
+}
+
+/**
+ * dispatch the routes of the timer to the async workers
+ */
+static void stm_timer_push(int worker, stm_timer_t *it)
+{
+	stm_route_t *rt;
+	async_task_t *at;
+	stm_task_t *tp;
+	int n = 0;
+
+	for(rt=it->rt; rt; rt=rt->next)
+		n++;
+
+	lock_get(&it->stats->lock);
+	if(it->stats->queued > 0)
+	{
+		/* the workers did not take the previous ones yet - no piling up */
+		it->stats->skipped++;
+		lock_release(&it->stats->lock);
+		return;
+	}
+	it->stats->queued += n;
+	lock_release(&it->stats->lock);
+
+	for(rt=it->rt; rt; rt=rt->next)
+	{
+		at = (async_task_t*)shm_malloc(sizeof(async_task_t)
+				+ sizeof(stm_task_t));
+		if(at==NULL)
+		{
+			SHM_MEM_ERROR;
+			goto error;
+		}
+		memset(at, 0, sizeof(async_task_t) + sizeof(stm_task_t));
+		tp = (stm_task_t*)((char*)at + sizeof(async_task_t));
+		tp->timer = it;
+		tp->rt = rt;
+		tp->worker = worker;
+		at->exec = stm_task_exec;
+		at->param = tp;
+		if(async_task_group_push_prio(it->awg, at, ASYNC_TASK_PRIO_NORMAL)<0)
+		{
+			LM_ERR("failed to push the task for timer %.*s\n",
+					it->name.len, it->name.s);
+			shm_free(at);
+			goto error;
+		}
+		n--;
+	}
+	return;
+
+error:
+	lock_get(&it->stats->lock);
+	it->stats->queued -= n;
+	lock_release(&it->stats->lock);
+}
+
+static void stm_timer_run(unsigned int ticks, int worker, stm_timer_t *it)
+{
+	stm_route_t *rt;
+
 	if(it->rt==NULL)
 		return;
 
+	if(it->flags & RTIMER_ASYNC)
+	{
+		stm_timer_push(worker, it);
+		return;
+	}
+
 	for(rt=it->rt; rt; rt=rt->next)
+		stm_route_exec(it, rt);
+}
+
+void stm_timer_exec(unsigned int ticks, int worker, void *param)
+{
+	rt_worker = worker;
+
+	if(param==NULL)
+		return;
+	stm_timer_run(ticks, worker, (stm_timer_t*)param);
+}
+
+/**
+ * account the ticks lost and the delay of a wakeup
+ */
+static void stm_timer_late(stm_timer_t *it, unsigned long long missed,
+		unsigned int drift)
+{
+	lock_get(&it->stats->lock);
+	it->stats->missed += missed;
+	if(drift > it->stats->drift_max_us)
+		it->stats->drift_max_us = drift;
+	lock_release(&it->stats->lock);
+}
+
+#ifdef RTIMER_TIMERFD
+/**
+ * precise timer loop using a periodic timerfd - the kernel keeps the
+ * schedule, so the execution time does not shift the next ticks
+ * @return -1 if the timerfd cannot be used
+ */
+static int stm_timerfd_loop(int worker, stm_timer_t *it)
+{
+	struct itimerspec its;
+	unsigned long long iv;
+	unsigned long long next;
+	unsigned long long now;
+	uint64_t exp;
+	int tfd;
+
+	tfd = timerfd_create(CLOCK_MONOTONIC, 0);
+	if(tfd<0)
 	{
-		fmsg = faked_msg_next();
-		if (exec_pre_script_cb(fmsg, REQUEST_CB_TYPE)==0 )
-			continue; /* drop the request */
-		set_route_type(REQUEST_ROUTE);
-		keng = sr_kemi_eng_get();
-		if(keng==NULL) {
-			run_top_route(main_rt.rlist[rt->route], fmsg, 0);
-		} else {
-			if(sr_kemi_route(keng, fmsg, EVENT_ROUTE, &rt->route_name, &evname)<0) {
-				LM_ERR("error running event route kemi callback [%.*s]\n",
-						rt->route_name.len, rt->route_name.s);
-			}
+		LM_WARN("failed to create timerfd (%d: %s) - timer %.*s\n",
+				errno, strerror(errno), it->name.len, it->name.s);
+		return -1;
+	}
+	iv = stm_interval_us(it);
+	memset(&its, 0, sizeof(struct itimerspec));
+	its.it_interval.tv_sec = iv / 1000000;
+	its.it_interval.tv_nsec = (iv % 1000000) * 1000;
+	its.it_value = its.it_interval;
+	if(timerfd_settime(tfd, 0, &its, NULL)<0)
+	{
+		LM_WARN("failed to set timerfd (%d: %s) - timer %.*s\n",
+				errno, strerror(errno), it->name.len, it->name.s);
+		close(tfd);
+		return -1;
+	}
+	next = stm_now_us() + iv;
+	for(;;)
+	{
+		if(read(tfd, &exp, sizeof(exp))!=sizeof(exp))
+		{
+			if(errno!=EINTR)
+				LM_ERR("failed to read timerfd (%d: %s)\n", errno,
+						strerror(errno));
+			continue;
 		}
-		exec_post_script_cb(fmsg, REQUEST_CB_TYPE);
-		ksr_msg_env_reset();
+		now = stm_now_us();
+		next += exp * iv;
+		stm_timer_late(it, exp - 1,
+				(now + iv > next) ? (unsigned int)(now + iv - next) : 0);
+		cfg_update();
+		stm_timer_exec(TICKS_TO_MS(get_ticks_raw()), worker, (void*)it);
+	}
+	return 0;
+}
+#endif
+
+/**
+ * precise timer loop sleeping until absolute deadlines, which are
+ * advanced by the interval - late wakeups are caught up by skipping
+ * the ticks already passed instead of shifting the schedule
+ */
+static void stm_deadline_loop(int worker, stm_timer_t *it)
+{
+	struct timespec ts;
+	unsigned long long iv;
+	unsigned long long next;
+	unsigned long long now;
+	unsigned long long missed;
+
+	iv = stm_interval_us(it);
+	next = stm_now_us() + iv;
+	for(;;)
+	{
+		ts.tv_sec = next / 1000000;
+		ts.tv_nsec = (next % 1000000) * 1000;
+		if(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL)!=0)
+			continue;
+		now = stm_now_us();
+		missed = (now > next) ? (now - next) / iv : 0;
+		stm_timer_late(it, missed, (now > next) ? (unsigned int)(now - next) : 0);
+		next += (missed + 1) * iv;
+		cfg_update();
+		stm_timer_exec(TICKS_TO_MS(get_ticks_raw()), worker, (void*)it);
 	}
 }
 
+/**
+ * fork a process running the timer with a drift free schedule
+ */
+static int fork_precise_timer(int child_id, char* desc, int worker,
+		stm_timer_t *it)
+{
+	int pid;
+
+	pid = fork_process(child_id, desc, 1);
+	if(pid<0)
+		return -1;
+	if(pid==0)
+	{
+		/* child */
+		if(cfg_child_init())
+			return -1;
+#ifdef RTIMER_TIMERFD
+		stm_timerfd_loop(worker, it);
+#endif
+		stm_deadline_loop(worker, it);
+	}
+	/* parent */
+	return pid;
+}
+
 int stm_t_param(modparam_t type, void *val)
 {
 	param_t* params_list = NULL;
@@ -270,6 +591,22 @@ int stm_t_param(modparam_t type, void *val)
 				LM_ERR("invalid interval: %.*s\n", pit->body.len, pit->body.s);
 					return -1;
 			}
+		} else if(pit->name.len==5
+				&& strncasecmp(pit->name.s, "async", 5)==0) {
+			if(pit->body.len==1 && pit->body.s[0]=='1')
+				tmp.flags |= RTIMER_ASYNC;
+		} else if(pit->name.len==5
+				&& strncasecmp(pit->name.s, "group", 5)==0) {
+			tmp.group = pit->body;
+			tmp.flags |= RTIMER_ASYNC;
+		} else if(pit->name.len==7
+				&& strncasecmp(pit->name.s, "precise", 7)==0) {
+			if(pit->body.len==1 && pit->body.s[0]=='1') {
+				tmp.flags |= RTIMER_PRECISE;
+				if (tmp.mode==0) {
+					tmp.mode = 1;
+				}
+			}
 		}
 	}
 	if(tmp.name.s==NULL)
@@ -295,6 +632,10 @@ int stm_t_param(modparam_t type, void *val)
 	}
 	if(tmp.interval==0)
 		tmp.interval = 120;
+	if((tmp.flags & RTIMER_ASYNC) && tmp.group.len<=0) {
+		tmp.group.s = "default";
+		tmp.group.len = 7;
+	}
 
 	nt = (stm_timer_t*)pkg_malloc(sizeof(stm_timer_t));
 	if(nt==0)
@@ -400,3 +741,61 @@ int stm_get_worker(struct sip_msg *msg, pv_param_t *param, pv_value_t *res)
 {
 	return pv_get_sintval(msg, param, res, rt_worker);
 }
+
+static const char* rtimer_rpc_stats_doc[2] = {
+	"Execution statistics of the timers",
+	0
+};
+
+/**
+ *
+ */
+static void rtimer_rpc_stats(rpc_t* rpc, void* ctx)
+{
+	stm_timer_t *it;
+	stm_stats_t st;
+	str rtimer_nogroup = str_init("");
+	void *th;
+
+	for(it=_stm_list; it!=NULL; it=it->next)
+	{
+		if(it->stats==NULL)
+			continue;
+		lock_get(&it->stats->lock);
+		memcpy(&st, it->stats, sizeof(stm_stats_t));
+		lock_release(&it->stats->lock);
+		if(rpc->add(ctx, "{", &th) < 0)
+		{
+			rpc->fault(ctx, 500, "Internal error creating rpc");
+			return;
+		}
+		/* the run counters are 64 bit and printed as strings */
+		if(rpc->struct_add(th, "SuuS",
+				"name", &it->name,
+				"interval_us", (unsigned int)stm_interval_us(it),
+				"mode", it->mode,
+				"group", (it->flags & RTIMER_ASYNC) ? &it->group : &rtimer_nogroup) < 0
+			|| rpc->struct_printf(th, "runs", "%llu", st.runs) < 0
+			|| rpc->struct_add(th, "uu",
+				"exec_avg_us",
+					(st.runs>0) ? (unsigned int)(st.exec_us / st.runs) : 0,
+				"exec_max_us", st.exec_max_us) < 0
+			|| rpc->struct_printf(th, "overruns", "%llu", st.overruns) < 0
+			|| rpc->struct_printf(th, "missed", "%llu", st.missed) < 0
+			|| rpc->struct_printf(th, "skipped", "%llu", st.skipped) < 0
+			|| rpc->struct_add(th, "uud",
+				"drift_max_us", st.drift_max_us,
+				"interval_load", (unsigned int)((st.runs>0) ? (st.exec_us * 100
+						/ st.runs / stm_interval_us(it)) : 0),
+				"queued", st.queued) < 0)
+		{
+			rpc->fault(ctx, 500, "Internal error adding item");
+			return;
+		}
+	}
+}
+
+static rpc_export_t rtimer_rpc_cmds[] = {
+	{"rtimer.stats", rtimer_rpc_stats, rtimer_rpc_stats_doc, RET_ARRAY},
+	{0, 0, 0, 0}
+};
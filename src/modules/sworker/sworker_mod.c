@@ -41,6 +41,8 @@ static int child_init(int);
 static void mod_destroy(void);
 
 static int w_sworker_task(sip_msg_t *msg, char *pgname, char *p2);
+static int fixup_sworker_task(void **param, int param_no);
+static int fixup_free_sworker_task(void **param, int param_no);
 static int w_sworker_active(sip_msg_t *msg, char *p1, char *p2);
 
 static int _sworker_active = 0;
@@ -52,9 +54,14 @@ typedef struct sworker_task_param {
 	receive_info_t rcv;
 } sworker_task_param_t;
 
+typedef struct sworker_group_param {
+	gparam_t *gname;
+	async_wgroup_t *awg; /* resolved at startup for static group names */
+} sworker_group_param_t;
+
 static cmd_export_t cmds[]={
-	{"sworker_task", (cmd_function)w_sworker_task, 1, fixup_spve_null,
-		fixup_free_spve_null, REQUEST_ROUTE|CORE_ONREPLY_ROUTE},
+	{"sworker_task", (cmd_function)w_sworker_task, 1, fixup_sworker_task,
+		fixup_free_sworker_task, REQUEST_ROUTE|CORE_ONREPLY_ROUTE},
 	{"sworker_active", (cmd_function)w_sworker_active, 0, 0,
 		0, REQUEST_ROUTE|CORE_ONREPLY_ROUTE},
 	{0, 0, 0, 0, 0, 0}
@@ -99,40 +106,29 @@ static void mod_destroy(void)
 }
 
 /**
- *
- */
-/**
- *
+ * execute the task in the async worker - the message is processed directly
+ * from the shm buffer of the task, which is released by the async framework
+ * after this function returns
  */
 void sworker_exec_task(void *param)
 {
 	sworker_task_param_t *stp;
-	static char buf[BUF_SIZE+1];
-	receive_info_t rcvi;
-	int len;
 
 	stp = (sworker_task_param_t *)param;
 
 	LM_DBG("received task [%p] - msg len [%d]\n", stp, stp->len);
-	if(stp->len > BUF_SIZE) {
-		LM_ERR("message is too large [%d]\n", stp->len);
-		return;
-	}
 
-	memcpy(buf, stp->buf, stp->len);
-	len = stp->len;
-	memcpy(&rcvi, &stp->rcv, sizeof(receive_info_t));
-	rcvi.rflags |= RECV_F_INTERNAL;
+	stp->rcv.rflags |= RECV_F_INTERNAL;
 
 	_sworker_active = 1;
-	receive_msg(buf, len, &rcvi);
+	receive_msg(stp->buf, stp->len, &stp->rcv);
 	_sworker_active = 0;
 }
 
 /**
- *
+ * build the task with one shm allocation and push it to the group
  */
-int sworker_send_task(sip_msg_t *msg, str *gname)
+static int sworker_send_task_group(sip_msg_t *msg, async_wgroup_t *awg)
 {
 	async_task_t *at = NULL;
 	sworker_task_param_t *stp = NULL;
@@ -145,22 +141,38 @@ int sworker_send_task(sip_msg_t *msg, str *gname)
 		LM_ERR("no more shm memory\n");
 		return -1;
 	}
-	memset(at, 0, dsize);
+	memset(at, 0, sizeof(async_task_t) + sizeof(sworker_task_param_t));
 	at->exec = sworker_exec_task;
 	at->param = (char *)at + sizeof(async_task_t);
 	stp = (sworker_task_param_t *)at->param;
 	stp->buf = (char*)stp+sizeof(sworker_task_param_t);
 	memcpy(stp->buf, msg->buf, msg->len);
+	stp->buf[msg->len] = '\0';
 	stp->len = msg->len;
 	memcpy(&stp->rcv, &msg->rcv, sizeof(receive_info_t));
 
-	return async_task_group_push(gname, at);
+	return async_task_group_push_prio(awg, at, ASYNC_TASK_PRIO_NORMAL);
 }
 
 /**
  *
  */
-int ki_sworker_task(sip_msg_t *msg, str *gname)
+int sworker_send_task(sip_msg_t *msg, str *gname)
+{
+	async_wgroup_t *awg = NULL;
+
+	awg = async_task_group_find(gname);
+	if(awg == NULL) {
+		LM_ERR("group [%.*s] not found\n", gname->len, gname->s);
+		return -1;
+	}
+	return sworker_send_task_group(msg, awg);
+}
+
+/**
+ *
+ */
+static int sworker_task_check(sip_msg_t *msg)
 {
 	if(msg==NULL || faked_msg_match(msg)) {
 		LM_ERR("invalid usage for null or faked message\n");
@@ -171,6 +183,17 @@ int ki_sworker_task(sip_msg_t *msg, str *gname)
 		LM_WARN("not used in pre-routing phase\n");
 		return -1;
 	}
+	return 0;
+}
+
+/**
+ *
+ */
+int ki_sworker_task(sip_msg_t *msg, str *gname)
+{
+	if(sworker_task_check(msg) < 0) {
+		return -1;
+	}
 	if(sworker_send_task(msg, gname) < 0) {
 		return -1;
 	}
@@ -183,19 +206,80 @@ int ki_sworker_task(sip_msg_t *msg, str *gname)
  */
 static int w_sworker_task(sip_msg_t *msg, char *pgname, char *p2)
 {
+	sworker_group_param_t *sgp;
 	str gname;
 
 	if(msg == NULL) {
 		return -1;
 	}
 
-	if(fixup_get_svalue(msg, (gparam_t *)pgname, &gname) != 0) {
+	sgp = (sworker_group_param_t *)pgname;
+	if(sgp->awg != NULL) {
+		/* static group name - no lookup needed */
+		if(sworker_task_check(msg) < 0) {
+			return -1;
+		}
+		if(sworker_send_task_group(msg, sgp->awg) < 0) {
+			return -1;
+		}
+		return 1;
+	}
+
+	if(fixup_get_svalue(msg, sgp->gname, &gname) != 0) {
 		LM_ERR("no async route block name\n");
 		return -1;
 	}
 	return ki_sworker_task(msg, &gname);
 }
 
+/**
+ *
+ */
+static int fixup_sworker_task(void **param, int param_no)
+{
+	sworker_group_param_t *sgp;
+
+	if(param_no != 1) {
+		return 0;
+	}
+	sgp = (sworker_group_param_t *)pkg_malloc(sizeof(sworker_group_param_t));
+	if(sgp == NULL) {
+		PKG_MEM_ERROR;
+		return -1;
+	}
+	memset(sgp, 0, sizeof(sworker_group_param_t));
+	if(fixup_spve_null(param, 1) < 0) {
+		pkg_free(sgp);
+		return -1;
+	}
+	sgp->gname = (gparam_t *)(*param);
+	if(sgp->gname->type == GPARAM_TYPE_STR) {
+		sgp->awg = async_task_group_find(&sgp->gname->v.str);
+		if(sgp->awg == NULL) {
+			LM_WARN("group [%.*s] not defined (yet)\n",
+					sgp->gname->v.str.len, sgp->gname->v.str.s);
+		}
+	}
+	*param = (void *)sgp;
+	return 0;
+}
+
+/**
+ *
+ */
+static int fixup_free_sworker_task(void **param, int param_no)
+{
+	sworker_group_param_t *sgp;
+
+	if(param_no != 1 || *param == NULL) {
+		return 0;
+	}
+	sgp = (sworker_group_param_t *)(*param);
+	*param = (void *)sgp->gname;
+	pkg_free(sgp);
+	return fixup_free_spve_null(param, 1);
+}
+
 /**
  *
  */
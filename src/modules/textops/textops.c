@@ -68,6 +68,7 @@
 
 #include "textops.h"
 #include "txt_var.h"
+#include "txt_match.h"
 #include "api.h"
 
 MODULE_VERSION
@@ -85,6 +86,7 @@ MODULE_VERSION
 #define AUDIO_STR_LEN 5
 
 
+static int w_search_f(struct sip_msg*, char*, char*);
 static int search_body_f(struct sip_msg*, char*, char*);
 static int search_hf_f(struct sip_msg*, char*, char*, char*);
 static int replace_f(struct sip_msg*, char*, char*);
@@ -167,6 +169,7 @@ static int fixup_subst_hf(void** param, int param_no);
 static int fixup_regex_substring(void** param, int param_no);
 
 static int mod_init(void);
+static int child_init(int rank);
 
 static tr_export_t mod_trans[] = {
 	{ {"re", sizeof("re")-1}, /* regexp class */
@@ -176,11 +179,11 @@ static tr_export_t mod_trans[] = {
 };
 
 static cmd_export_t cmds[]={
-	{"search",           (cmd_function)search_f,          1,
-		fixup_regexp_null, fixup_free_regexp_null,
+	{"search",           (cmd_function)w_search_f,        1,
+		tx_fixup_search, tx_fixup_free_search,
 		ANY_ROUTE},
 	{"search_body",      (cmd_function)search_body_f,     1,
-		fixup_regexp_null, fixup_free_regexp_null,
+		tx_fixup_search, tx_fixup_free_search,
 		ANY_ROUTE},
 	{"search_hf",      (cmd_function)search_hf_f,         3,
 		fixup_search_hf, 0,
@@ -267,7 +270,7 @@ static cmd_export_t cmds[]={
 		fixup_spve_null, fixup_free_spve_null,
 		ANY_ROUTE},
 	{"subst",            (cmd_function)subst_f,           1,
-		fixup_substre, 0,
+		tx_fixup_subst, 0,
 		ANY_ROUTE},
 	{"subst_uri",        (cmd_function)subst_uri_f,       1,
 		fixup_substre, 0,
@@ -276,7 +279,7 @@ static cmd_export_t cmds[]={
 		fixup_substre, 0,
 		REQUEST_ROUTE|ONREPLY_ROUTE|FAILURE_ROUTE|BRANCH_ROUTE},
 	{"subst_body",       (cmd_function)subst_body_f,      1,
-		fixup_substre, 0,
+		tx_fixup_subst, 0,
 		ANY_ROUTE},
 	{"subst_hf",         (cmd_function)subst_hf_f,        3,
 		fixup_subst_hf, 0,
@@ -383,16 +386,25 @@ static cmd_export_t cmds[]={
 };
 
 
+static param_export_t params[]={
+	{"search_prefilter",   PARAM_INT, &tx_search_prefilter},
+	{"search_cache",       PARAM_INT, &tx_search_cache},
+	{"pattern_stats",      PARAM_INT, &tx_pattern_stats},
+	{"pattern_cache_size", PARAM_INT, &tx_pattern_cache_size},
+	{0, 0, 0}
+};
+
+
 struct module_exports exports= {
 	"textops",  /* module name*/
 	DEFAULT_DLFLAGS, /* dlopen flags */
 	cmds,       /* exported functions */
-	0,          /* exported parameters */
-	0,          /* exported rpc functions */
+	params,     /* exported parameters */
+	tx_pattern_rpc, /* exported rpc functions */
 	0,          /* exported pseudo-variables */
 	0,          /* response handling function */
 	mod_init,   /* module init function */
-	0,          /* per-child init function */
+	child_init, /* per-child init function */
 	0           /* module destroy function */
 };
 
@@ -402,6 +414,14 @@ static int mod_init(void)
 	return 0;
 }
 
+static int child_init(int rank)
+{
+	/* all the config patterns are compiled by now */
+	if(rank==PROC_INIT)
+		return tx_pattern_stats_init();
+	return 0;
+}
+
 
 static char *get_header(struct sip_msg *msg)
 {
@@ -423,6 +443,12 @@ int search_f(struct sip_msg* msg, char* key, char* str2)
 	return search_helper_f(msg, (regex_t*)key);
 }
 
+static int w_search_f(struct sip_msg* msg, char* key, char* str2)
+{
+	return tx_pattern_search(msg, (tx_pattern_t*)key, TX_SCOPE_MSG,
+			search_helper_f);
+}
+
 static inline int search_body_helper_f(struct sip_msg* msg, regex_t* re)
 {
 	str body;
@@ -446,7 +472,8 @@ static inline int search_body_helper_f(struct sip_msg* msg, regex_t* re)
 
 static int search_body_f(struct sip_msg* msg, char* key, char* str2)
 {
-	return search_body_helper_f(msg, (regex_t*)key);
+	return tx_pattern_search(msg, (tx_pattern_t*)key, TX_SCOPE_BODY,
+			search_body_helper_f);
 }
 
 int search_append_helper(sip_msg_t* msg, regex_t* re, str* val)
@@ -1399,7 +1426,16 @@ error:
 /* sed-perl style re: s/regular expression/replacement/flags */
 static int subst_f(struct sip_msg* msg, char*  subst, char* ignored)
 {
-	return subst_helper_f(msg, (struct subst_expr*)subst);
+	tx_pattern_t *txp = (tx_pattern_t*)subst;
+	struct timeval tvb;
+	int ret;
+
+	if(tx_pattern_prefilter(msg, txp)==0)
+		return -1;
+	tx_pattern_exec_start(txp, &tvb);
+	ret = subst_helper_f(msg, txp->se);
+	tx_pattern_exec_end(txp, &tvb, ret);
+	return ret;
 }
 
 /* sed-perl style re: s/regular expression/replacement/flags, like
@@ -1560,7 +1596,16 @@ error:
 
 static int subst_body_f(struct sip_msg* msg, char*  subst, char* ignored)
 {
-	return subst_body_helper_f(msg, (struct subst_expr*)subst);
+	tx_pattern_t *txp = (tx_pattern_t*)subst;
+	struct timeval tvb;
+	int ret;
+
+	if(tx_pattern_prefilter(msg, txp)==0)
+		return -1;
+	tx_pattern_exec_start(txp, &tvb);
+	ret = subst_body_helper_f(msg, txp->se);
+	tx_pattern_exec_end(txp, &tvb, ret);
+	return ret;
 }
 
 static inline int find_line_start(char *text, unsigned int text_len,
@@ -4661,8 +4706,17 @@ done:
 /* sed-perl style re: s/regular expression/replacement/flags */
 static int subst_hf_f(struct sip_msg *msg, char *str_hf, char *subst, char *flags)
 {
-	return subst_hf_helper_f(msg, (gparam_t*)str_hf, (struct subst_expr*)subst,
-			flags);
+	tx_pattern_t *txp = (tx_pattern_t*)subst;
+	struct timeval tvb;
+	int ret;
+
+	/* the header bodies are in the message buffer */
+	if(tx_pattern_prefilter(msg, txp)==0)
+		return -1;
+	tx_pattern_exec_start(txp, &tvb);
+	ret = subst_hf_helper_f(msg, (gparam_t*)str_hf, txp->se, flags);
+	tx_pattern_exec_end(txp, &tvb, ret);
+	return ret;
 }
 
 /*
@@ -4673,7 +4727,7 @@ static int fixup_subst_hf(void** param, int param_no)
 	if(param_no==1)
 		return hname_fixup(param, param_no);
 	if(param_no==2)
-		return fixup_substre(param, 1);
+		return tx_fixup_subst(param, 1);
 	return 0;
 }
 
@@ -4737,12 +4791,17 @@ static int w_search_str(sip_msg_t *msg, char *ptext, char *pre)
  */
 static int ki_search(sip_msg_t *msg, str *sre)
 {
+	tx_pattern_t *txp;
 	regex_t re;
 	int ret;
 
 	if(sre==NULL || sre->len<=0)
 		return 1;
 
+	txp = tx_pattern_get(sre, TX_PATTERN_SEARCH);
+	if(txp!=NULL)
+		return tx_pattern_search(msg, txp, TX_SCOPE_MSG, search_helper_f);
+
 	memset(&re, 0, sizeof(regex_t));
 	if (regcomp(&re, sre->s, REG_EXTENDED|REG_ICASE|REG_NEWLINE)!=0) {
 		LM_ERR("failed to compile regex: %.*s\n", sre->len, sre->s);
@@ -4758,12 +4817,17 @@ static int ki_search(sip_msg_t *msg, str *sre)
  */
 static int ki_search_body(sip_msg_t *msg, str *sre)
 {
+	tx_pattern_t *txp;
 	regex_t re;
 	int ret;
 
 	if(sre==NULL || sre->len<=0)
 		return 1;
 
+	txp = tx_pattern_get(sre, TX_PATTERN_SEARCH);
+	if(txp!=NULL)
+		return tx_pattern_search(msg, txp, TX_SCOPE_BODY, search_body_helper_f);
+
 	memset(&re, 0, sizeof(regex_t));
 	if (regcomp(&re, sre->s, REG_EXTENDED|REG_ICASE|REG_NEWLINE)!=0) {
 		LM_ERR("failed to compile regex: %.*s\n", sre->len, sre->s);
@@ -4806,11 +4870,19 @@ static int ki_search_hf(sip_msg_t *msg, str *hname, str *sre, str *flags)
 static int ki_subst(sip_msg_t *msg, str *subst)
 {
 	struct subst_expr *se = NULL;
+	tx_pattern_t *txp;
 	int ret;
 
 	if(subst==NULL || subst->len<=0)
 		return -1;
 
+	txp = tx_pattern_get(subst, TX_PATTERN_SUBST);
+	if(txp!=NULL) {
+		if(tx_pattern_prefilter(msg, txp)==0)
+			return -1;
+		return subst_helper_f(msg, txp->se);
+	}
+
 	se=subst_parser(subst);
 	if (se==0) {
 		LM_ERR("cannot compile subst expression\n");
@@ -4863,11 +4935,19 @@ static int ki_subst_user(sip_msg_t *msg, str *subst)
 static int ki_subst_body(sip_msg_t *msg, str *subst)
 {
 	struct subst_expr *se = NULL;
+	tx_pattern_t *txp;
 	int ret;
 
 	if(subst==NULL || subst->len<=0)
 		return -1;
 
+	txp = tx_pattern_get(subst, TX_PATTERN_SUBST);
+	if(txp!=NULL) {
+		if(tx_pattern_prefilter(msg, txp)==0)
+			return -1;
+		return subst_body_helper_f(msg, txp->se);
+	}
+
 	se=subst_parser(subst);
 	if (se==0) {
 		LM_ERR("cannot compile subst expression\n");
@@ -4885,6 +4965,7 @@ static int ki_subst_body(sip_msg_t *msg, str *subst)
 static int ki_subst_hf(sip_msg_t *msg, str *hname, str *subst, str *flags)
 {
 	struct subst_expr *se = NULL;
+	tx_pattern_t *txp;
 	gparam_t ghp;
 	int ret;
 
@@ -4897,6 +4978,13 @@ static int ki_subst_hf(sip_msg_t *msg, str *hname, str *subst, str *flags)
 	if(ki_hname_gparam(hname, &ghp)<0)
 		return -1;
 
+	txp = tx_pattern_get(subst, TX_PATTERN_SUBST);
+	if(txp!=NULL) {
+		if(tx_pattern_prefilter(msg, txp)==0)
+			return -1;
+		return subst_hf_helper_f(msg, &ghp, txp->se, (flags)?flags->s:NULL);
+	}
+
 	se=subst_parser(subst);
 	if (se==0) {
 		LM_ERR("cannot compile subst expression\n");
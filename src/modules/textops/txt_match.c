@@ -0,0 +1,751 @@
+/*
+ * Copyright (C) 2021 kamailio.org
+ *
+ * This file is part of kamailio, a free SIP server.
+ *
+ * Kamailio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * Kamailio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/*!
+ * \file
+ * \brief Multi-pattern matching over the message buffer
+ * \ingroup textops
+ * Module: \ref textops
+ *
+ * All the search and subst expressions given in the config are kept in
+ * a table. For each of them the longest literal text that every match
+ * has to contain is extracted from the regular expression. The literals
+ * of all patterns are looked up in the message buffer with a single
+ * pass, done at the first use in a message, and the regular expression
+ * engine is run only for the patterns whose literal is present. The
+ * results of the search functions are cached per message, until the
+ * message buffer changes.
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+
+#include "../../core/mem/mem.h"
+#include "../../core/mem/shm_mem.h"
+#include "../../core/dprint.h"
+#include "../../core/error.h"
+#include "../../core/hashes.h"
+#include "../../core/atomic_ops.h"
+
+#include "txt_match.h"
+
+/* minimum size of a literal to be used for prefiltering */
+#define TX_LIT_MIN	2
+
+#define TX_PATTERN_DYN_SIZE	32
+
+/* per message state of a pattern */
+#define TXM_LIT			(1<<0)	/* literal found in the message */
+#define TXM_MSG_DONE	(1<<1)	/* search over the message done */
+#define TXM_MSG_MATCH	(1<<2)	/* search over the message matched */
+#define TXM_BODY_DONE	(1<<3)	/* search over the body done */
+#define TXM_BODY_MATCH	(1<<4)	/* search over the body matched */
+
+typedef struct tx_msg_state {
+	unsigned int id;
+	int pid;
+	char *buf;
+	unsigned int len;
+	unsigned int buf_gen;
+	int scanned;
+	int size;
+	unsigned char *flags;
+} tx_msg_state_t;
+
+typedef struct tx_pattern_stats {
+	volatile long calls;
+	volatile long skipped;
+	volatile long cached;
+	volatile long execs;
+	volatile long matched;
+	volatile long usecs;
+} tx_pattern_stats_t;
+
+int tx_search_prefilter = 1;
+int tx_search_cache = 1;
+int tx_pattern_stats = 0;
+int tx_pattern_cache_size = 32;
+
+static tx_pattern_t **_tx_patterns = NULL;
+static int _tx_patterns_no = 0;
+static int _tx_patterns_size = 0;
+
+/* patterns indexed by the first char of the literal */
+static int _tx_lit_head[256];
+static int _tx_lit_no = 0;
+static int _tx_lit_ready = 0;
+
+static tx_msg_state_t _tx_mstate = {0};
+
+/* patterns compiled at runtime for the kemi functions */
+static tx_pattern_t *_tx_dyn_table[TX_PATTERN_DYN_SIZE];
+static int _tx_dyn_no = 0;
+
+static tx_pattern_stats_t *_tx_stats = NULL;
+static int _tx_stats_no = 0;
+
+#define TX_STATS_ADD(txp, field, v) do { \
+		if(_tx_stats!=NULL && (txp)->idx<_tx_stats_no) \
+			atomic_add_long(&_tx_stats[(txp)->idx].field, (v)); \
+	} while(0)
+
+/**
+ * skip a bracket expression - p at '['
+ * - return the position after the closing ']' or NULL if not closed
+ */
+static char *tx_re_skip_bracket(char *p, char *end)
+{
+	char c;
+
+	p++;
+	if(p<end && *p=='^')
+		p++;
+	if(p<end && *p==']')
+		p++;
+	while(p<end) {
+		if(*p=='[' && p+1<end && (p[1]==':' || p[1]=='.' || p[1]=='=')) {
+			/* character class, collating symbol or equivalence class */
+			c = p[1];
+			p += 2;
+			while(p+1<end && !(p[0]==c && p[1]==']'))
+				p++;
+			p += 2;
+			continue;
+		}
+		if(*p==']')
+			return p+1;
+		p++;
+	}
+	return NULL;
+}
+
+/**
+ * skip a group - p at '('
+ * - return the position after the closing ')' or NULL if not closed
+ */
+static char *tx_re_skip_group(char *p, char *end)
+{
+	int depth = 0;
+
+	while(p<end) {
+		switch(*p) {
+			case '\\':
+				p += 2;
+				continue;
+			case '[':
+				p = tx_re_skip_bracket(p, end);
+				if(p==NULL)
+					return NULL;
+				continue;
+			case '(':
+				depth++;
+				break;
+			case ')':
+				depth--;
+				if(depth==0)
+					return p+1;
+				break;
+		}
+		p++;
+	}
+	return NULL;
+}
+
+static inline int tx_re_quantifier(char *p, char *end)
+{
+	return (p<end && (*p=='*' || *p=='?' || *p=='+' || *p=='{'));
+}
+
+/**
+ * skip the quantifiers following an atom
+ */
+static char *tx_re_skip_quantifier(char *p, char *end)
+{
+	while(tx_re_quantifier(p, end)) {
+		if(*p=='{') {
+			while(p<end && *p!='}')
+				p++;
+		}
+		p++;
+	}
+	return p;
+}
+
+/* escaped chars that match themselves - any other escape has a special
+ * meaning in GNU regex or is not portable, so it ends the literal text */
+#define TX_RE_LITERAL_ESCAPES ".[]()*+?{}|^$\\/-:;,@=\"#%&!~_ "
+
+/**
+ * get the longest literal text that every match of the extended regular
+ * expression has to contain
+ * - lit->s and tmp have to be buffers of re->len size
+ * - lit->len is set to 0 if no literal can be safely extracted
+ * (alternations at top level, escapes with special meaning, ...)
+ */
+static void tx_re_literal(str *re, str *lit, char *tmp)
+{
+	char *p, *end;
+	int tlen;
+	char c;
+
+	lit->len = 0;
+	tlen = 0;
+	p = re->s;
+	end = re->s + re->len;
+
+#define TX_RUN_END() do { \
+		if(tlen>lit->len) { \
+			memcpy(lit->s, tmp, tlen); \
+			lit->len = tlen; \
+		} \
+		tlen = 0; \
+	} while(0)
+
+	while(p<end) {
+		switch(*p) {
+			case '|':
+			case ')':
+				/* alternation or unbalanced group */
+				lit->len = 0;
+				return;
+			case '\\':
+				if(p+1>=end) {
+					lit->len = 0;
+					return;
+				}
+				if(p[1]=='\0'
+						|| strchr(TX_RE_LITERAL_ESCAPES, p[1])==NULL) {
+					/* back reference, class or anchor (e.g. \w, \1, \<,
+					 * \`) - only the known punctuation escapes stand for
+					 * the char itself */
+					TX_RUN_END();
+					p = tx_re_skip_quantifier(p+2, end);
+					continue;
+				}
+				c = p[1];
+				p += 2;
+				break;
+			case '[':
+				TX_RUN_END();
+				p = tx_re_skip_bracket(p, end);
+				if(p==NULL) {
+					lit->len = 0;
+					return;
+				}
+				p = tx_re_skip_quantifier(p, end);
+				continue;
+			case '(':
+				TX_RUN_END();
+				p = tx_re_skip_group(p, end);
+				if(p==NULL) {
+					lit->len = 0;
+					return;
+				}
+				p = tx_re_skip_quantifier(p, end);
+				continue;
+			case '.':
+			case '^':
+			case '$':
+			case '*':
+			case '?':
+			case '+':
+			case '{':
+				TX_RUN_END();
+				p = tx_re_skip_quantifier(p+1, end);
+				continue;
+			default:
+				c = *p;
+				p++;
+		}
+		if(p<end && (*p=='*' || *p=='?' || *p=='{'
+				|| (*p=='+' && p+1<end
+					&& (p[1]=='*' || p[1]=='?' || p[1]=='{')))) {
+			/* the char is optional or repeated a variable number of times
+			 * - in ERE a quantifier after '+' applies to the repetition,
+			 * so b+? or b+* also match no b */
+			TX_RUN_END();
+			p = tx_re_skip_quantifier(p, end);
+			continue;
+		}
+		tmp[tlen++] = tolower((unsigned char)c);
+		if(p<end && *p=='+') {
+			TX_RUN_END();
+			p = tx_re_skip_quantifier(p, end);
+		}
+	}
+	TX_RUN_END();
+#undef TX_RUN_END
+
+	if(lit->len<TX_LIT_MIN)
+		lit->len = 0;
+}
+
+/**
+ * get the regular expression part of a s/re/repl/flags expression
+ */
+static int tx_subst_re(str *subst, str *re)
+{
+	char *p, *end;
+
+	if(subst->len<3)
+		return -1;
+	re->s = subst->s + 1;
+	end = subst->s + subst->len;
+	for(p=re->s; p<end; p++) {
+		if(*p==subst->s[0] && p[-1]!='\\') {
+			re->len = p - re->s;
+			return 0;
+		}
+	}
+	return -1;
+}
+
+static int tx_patterns_add(tx_pattern_t *txp)
+{
+	tx_pattern_t **tbl;
+	int size;
+
+	if(_tx_patterns_no==_tx_patterns_size) {
+		size = (_tx_patterns_size==0)?16:2*_tx_patterns_size;
+		tbl = (tx_pattern_t**)pkg_realloc(_tx_patterns,
+				size*sizeof(tx_pattern_t*));
+		if(tbl==NULL) {
+			PKG_MEM_ERROR;
+			return -1;
+		}
+		_tx_patterns = tbl;
+		_tx_patterns_size = size;
+	}
+	txp->idx = _tx_patterns_no;
+	_tx_patterns[_tx_patterns_no++] = txp;
+	/* the literals index is rebuilt at next use */
+	_tx_lit_ready = 0;
+	return 0;
+}
+
+static void tx_pattern_free(tx_pattern_t *txp)
+{
+	if(txp->type==TX_PATTERN_SEARCH) {
+		regfree(&txp->re);
+	} else if(txp->se!=NULL) {
+		subst_expr_free(txp->se);
+	}
+	pkg_free(txp);
+}
+
+static tx_pattern_t *tx_pattern_new(str *text, int type)
+{
+	tx_pattern_t *txp;
+	str re;
+
+	/* text, literal and a temporary buffer are stored after the structure */
+	txp = (tx_pattern_t*)pkg_malloc(sizeof(tx_pattern_t) + 3*(text->len+1));
+	if(txp==NULL) {
+		PKG_MEM_ERROR;
+		return NULL;
+	}
+	memset(txp, 0, sizeof(tx_pattern_t));
+	txp->type = type;
+	txp->text.s = (char*)txp + sizeof(tx_pattern_t);
+	memcpy(txp->text.s, text->s, text->len);
+	txp->text.s[text->len] = '\0';
+	txp->text.len = text->len;
+	txp->lit.s = txp->text.s + text->len + 1;
+
+	if(type==TX_PATTERN_SEARCH) {
+		if(regcomp(&txp->re, txp->text.s,
+					REG_EXTENDED|REG_ICASE|REG_NEWLINE)!=0) {
+			LM_ERR("bad regular expression: %.*s\n", text->len, text->s);
+			pkg_free(txp);
+			return NULL;
+		}
+		re = txp->text;
+	} else {
+		txp->se = subst_parser(&txp->text);
+		if(txp->se==NULL) {
+			LM_ERR("bad subst expression: %.*s\n", text->len, text->s);
+			pkg_free(txp);
+			return NULL;
+		}
+		if(tx_subst_re(&txp->text, &re)<0)
+			re.len = 0;
+	}
+	if(re.len>0)
+		tx_re_literal(&re, &txp->lit, txp->lit.s + text->len + 1);
+
+	if(tx_patterns_add(txp)<0) {
+		tx_pattern_free(txp);
+		return NULL;
+	}
+	LM_DBG("pattern [%.*s] - literal [%.*s]\n", txp->text.len, txp->text.s,
+			txp->lit.len, txp->lit.s);
+	return txp;
+}
+
+/**
+ * fixup for a search expression
+ */
+int tx_fixup_search(void **param, int param_no)
+{
+	tx_pattern_t *txp;
+	str text;
+
+	if(param_no!=1)
+		return 0;
+	text.s = (char*)*param;
+	text.len = strlen(text.s);
+	txp = tx_pattern_new(&text, TX_PATTERN_SEARCH);
+	if(txp==NULL)
+		return E_BAD_RE;
+	*param = (void*)txp;
+	return 0;
+}
+
+/**
+ * free fixup for a search expression
+ */
+int tx_fixup_free_search(void **param, int param_no)
+{
+	tx_pattern_t *txp;
+
+	if(param_no!=1 || *param==NULL)
+		return 0;
+	txp = (tx_pattern_t*)*param;
+	_tx_patterns[txp->idx] = NULL;
+	_tx_lit_ready = 0;
+	tx_pattern_free(txp);
+	*param = NULL;
+	return 0;
+}
+
+/**
+ * fixup for a subst expression
+ */
+int tx_fixup_subst(void **param, int param_no)
+{
+	tx_pattern_t *txp;
+	str text;
+
+	if(param_no!=1)
+		return 0;
+	text.s = (char*)*param;
+	text.len = strlen(text.s);
+	txp = tx_pattern_new(&text, TX_PATTERN_SUBST);
+	if(txp==NULL)
+		return E_BAD_RE;
+	*param = (void*)txp;
+	return 0;
+}
+
+/**
+ * get the pattern for an expression given at runtime, compiling it at the
+ * first use
+ * - return NULL if it cannot be cached, the caller has to do the matching
+ */
+tx_pattern_t *tx_pattern_get(str *text, int type)
+{
+	tx_pattern_t *txp;
+	unsigned int hid;
+	int slot;
+
+	if(tx_pattern_cache_size<=0 || text==NULL || text->len<=0)
+		return NULL;
+
+	hid = get_hash1_raw(text->s, text->len);
+	slot = hid & (TX_PATTERN_DYN_SIZE-1);
+	for(txp=_tx_dyn_table[slot]; txp!=NULL; txp=txp->next) {
+		if(txp->hashid==hid && txp->type==type && txp->text.len==text->len
+				&& memcmp(txp->text.s, text->s, text->len)==0) {
+			return txp;
+		}
+	}
+	if(_tx_dyn_no>=tx_pattern_cache_size)
+		return NULL;
+
+	txp = tx_pattern_new(text, type);
+	if(txp==NULL)
+		return NULL;
+	txp->hashid = hid;
+	txp->next = _tx_dyn_table[slot];
+	_tx_dyn_table[slot] = txp;
+	_tx_dyn_no++;
+	return txp;
+}
+
+/**
+ * allocate the shared statistics of the patterns compiled by the fixups
+ * - to be called before forking
+ */
+int tx_pattern_stats_init(void)
+{
+	if(tx_pattern_stats==0 || _tx_patterns_no==0)
+		return 0;
+	_tx_stats = (tx_pattern_stats_t*)shm_malloc(
+			_tx_patterns_no*sizeof(tx_pattern_stats_t));
+	if(_tx_stats==NULL) {
+		SHM_MEM_ERROR;
+		return -1;
+	}
+	memset(_tx_stats, 0, _tx_patterns_no*sizeof(tx_pattern_stats_t));
+	_tx_stats_no = _tx_patterns_no;
+	return 0;
+}
+
+/**
+ * index the patterns by the first char of the literal
+ */
+static void tx_lit_build(void)
+{
+	tx_pattern_t *txp;
+	int i;
+
+	for(i=0; i<256; i++)
+		_tx_lit_head[i] = -1;
+	_tx_lit_no = 0;
+	for(i=_tx_patterns_no-1; i>=0; i--) {
+		txp = _tx_patterns[i];
+		if(txp==NULL || txp->lit.len<=0)
+			continue;
+		txp->lnext = _tx_lit_head[(unsigned char)txp->lit.s[0]];
+		_tx_lit_head[(unsigned char)txp->lit.s[0]] = i;
+		_tx_lit_no++;
+	}
+	/* literals are stored in lower case */
+	for(i='a'; i<='z'; i++)
+		_tx_lit_head[toupper(i)] = _tx_lit_head[i];
+
+	/* literals of the current message have to be looked up again */
+	for(i=0; i<_tx_mstate.size; i++)
+		_tx_mstate.flags[i] &= ~TXM_LIT;
+	_tx_mstate.scanned = 0;
+	_tx_lit_ready = 1;
+}
+
+/**
+ * get the state for the current message, reset if the buffer changed
+ */
+static int tx_msg_state_get(sip_msg_t *msg)
+{
+	unsigned char *flags;
+
+	if(_tx_mstate.size<_tx_patterns_no) {
+		flags = (unsigned char*)pkg_realloc(_tx_mstate.flags,
+				_tx_patterns_size);
+		if(flags==NULL) {
+			PKG_MEM_ERROR;
+			return -1;
+		}
+		_tx_mstate.flags = flags;
+		_tx_mstate.size = _tx_patterns_size;
+		_tx_mstate.buf = NULL;
+	}
+	if(msg->id!=_tx_mstate.id || msg->pid!=_tx_mstate.pid
+			|| msg->buf!=_tx_mstate.buf || msg->len!=_tx_mstate.len
+			|| msg->buf_gen!=_tx_mstate.buf_gen) {
+		memset(_tx_mstate.flags, 0, _tx_mstate.size);
+		_tx_mstate.id = msg->id;
+		_tx_mstate.pid = msg->pid;
+		_tx_mstate.buf = msg->buf;
+		_tx_mstate.len = msg->len;
+		_tx_mstate.buf_gen = msg->buf_gen;
+		_tx_mstate.scanned = 0;
+	}
+	return 0;
+}
+
+/**
+ * look up the literals of all patterns with one pass over the message
+ */
+static void tx_lit_scan(sip_msg_t *msg)
+{
+	tx_pattern_t *txp;
+	char *p, *end;
+	int left;
+	int i;
+
+	left = _tx_lit_no;
+	end = msg->buf + msg->len;
+	for(p=msg->buf; p<end && left>0; p++) {
+		for(i=_tx_lit_head[(unsigned char)*p]; i>=0; i=txp->lnext) {
+			txp = _tx_patterns[i];
+			if((_tx_mstate.flags[i] & TXM_LIT)==0
+					&& txp->lit.len<=end-p
+					&& strncasecmp(p, txp->lit.s, txp->lit.len)==0) {
+				_tx_mstate.flags[i] |= TXM_LIT;
+				left--;
+			}
+		}
+	}
+	_tx_mstate.scanned = 1;
+}
+
+/**
+ * check the literal of the pattern
+ * - return 0 if the pattern cannot match the message, 1 otherwise
+ */
+static int tx_lit_check(sip_msg_t *msg, tx_pattern_t *txp)
+{
+	if(tx_search_prefilter==0 || txp->lit.len<=0 || msg->buf==NULL)
+		return 1;
+	if(tx_msg_state_get(msg)<0)
+		return 1;
+	if(_tx_lit_ready==0)
+		tx_lit_build();
+	if(_tx_mstate.scanned==0)
+		tx_lit_scan(msg);
+	return (_tx_mstate.flags[txp->idx] & TXM_LIT)?1:0;
+}
+
+/**
+ * prefilter for functions working over parts of the message buffer
+ * - return 0 if the pattern cannot match, 1 if the expression has to be run
+ */
+int tx_pattern_prefilter(sip_msg_t *msg, tx_pattern_t *txp)
+{
+	TX_STATS_ADD(txp, calls, 1);
+	if(tx_lit_check(msg, txp)==0) {
+		TX_STATS_ADD(txp, skipped, 1);
+		return 0;
+	}
+	return 1;
+}
+
+void tx_pattern_exec_start(tx_pattern_t *txp, struct timeval *tvb)
+{
+	if(_tx_stats==NULL || txp->idx>=_tx_stats_no)
+		return;
+	gettimeofday(tvb, NULL);
+}
+
+void tx_pattern_exec_end(tx_pattern_t *txp, struct timeval *tvb, int ret)
+{
+	struct timeval tve;
+
+	if(_tx_stats==NULL || txp->idx>=_tx_stats_no)
+		return;
+	gettimeofday(&tve, NULL);
+	atomic_add_long(&_tx_stats[txp->idx].execs, 1);
+	if(ret>0)
+		atomic_add_long(&_tx_stats[txp->idx].matched, 1);
+	atomic_add_long(&_tx_stats[txp->idx].usecs,
+			(tve.tv_sec - tvb->tv_sec)*1000000
+			+ (tve.tv_usec - tvb->tv_usec));
+}
+
+/**
+ * run a search expression over the message or the body
+ * - the result is cached until the message buffer changes
+ */
+int tx_pattern_search(sip_msg_t *msg, tx_pattern_t *txp, int scope,
+		tx_search_f sf)
+{
+	struct timeval tvb;
+	unsigned char dflag;
+	unsigned char mflag;
+	int cached;
+	int ret;
+
+	if(scope==TX_SCOPE_BODY) {
+		dflag = TXM_BODY_DONE;
+		mflag = TXM_BODY_MATCH;
+	} else {
+		dflag = TXM_MSG_DONE;
+		mflag = TXM_MSG_MATCH;
+	}
+	TX_STATS_ADD(txp, calls, 1);
+	cached = (tx_search_cache!=0 && tx_msg_state_get(msg)==0);
+	if(cached && (_tx_mstate.flags[txp->idx] & dflag)) {
+		TX_STATS_ADD(txp, cached, 1);
+		return (_tx_mstate.flags[txp->idx] & mflag)?1:-1;
+	}
+	if(tx_lit_check(msg, txp)==0) {
+		TX_STATS_ADD(txp, skipped, 1);
+		ret = -1;
+	} else {
+		tx_pattern_exec_start(txp, &tvb);
+		ret = sf(msg, &txp->re);
+		tx_pattern_exec_end(txp, &tvb, ret);
+	}
+	if(cached) {
+		_tx_mstate.flags[txp->idx] |= dflag | ((ret>0)?mflag:0);
+	}
+	return ret;
+}
+
+static const char* tx_rpc_pattern_stats_doc[2] = {
+	"Execution statistics of the textops patterns",
+	0
+};
+
+static void tx_rpc_pattern_stats(rpc_t *rpc, void *ctx)
+{
+	tx_pattern_t *txp;
+	tx_pattern_stats_t *st;
+	void *th;
+	int i;
+
+	if(_tx_stats==NULL) {
+		rpc->fault(ctx, 500, "Pattern statistics not enabled");
+		return;
+	}
+	for(i=0; i<_tx_stats_no; i++) {
+		txp = _tx_patterns[i];
+		if(txp==NULL)
+			continue;
+		st = &_tx_stats[i];
+		if(rpc->add(ctx, "{", &th)<0) {
+			rpc->fault(ctx, 500, "Server error");
+			return;
+		}
+		if(rpc->struct_add(th, "dsSS",
+				"index", i,
+				"type", (txp->type==TX_PATTERN_SEARCH)?"search":"subst",
+				"pattern", &txp->text,
+				"literal", &txp->lit)<0) {
+			rpc->fault(ctx, 500, "Server error");
+			return;
+		}
+		/* the counters can go over 32 bits (exec_usec in particular) */
+		if(rpc->struct_printf(th, "calls", "%lu",
+					(unsigned long)atomic_get_long(&st->calls))<0
+				|| rpc->struct_printf(th, "skipped", "%lu",
+					(unsigned long)atomic_get_long(&st->skipped))<0
+				|| rpc->struct_printf(th, "cached", "%lu",
+					(unsigned long)atomic_get_long(&st->cached))<0
+				|| rpc->struct_printf(th, "execs", "%lu",
+					(unsigned long)atomic_get_long(&st->execs))<0
+				|| rpc->struct_printf(th, "matched", "%lu",
+					(unsigned long)atomic_get_long(&st->matched))<0
+				|| rpc->struct_printf(th, "exec_usec", "%lu",
+					(unsigned long)atomic_get_long(&st->usecs))<0) {
+			rpc->fault(ctx, 500, "Server error");
+			return;
+		}
+	}
+}
+
+rpc_export_t tx_pattern_rpc[] = {
+	{"textops.pattern_stats", tx_rpc_pattern_stats,
+		tx_rpc_pattern_stats_doc, RET_ARRAY},
+	{0, 0, 0, 0}
+};
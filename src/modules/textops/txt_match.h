@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2021 kamailio.org
+ *
+ * This file is part of kamailio, a free SIP server.
+ *
+ * Kamailio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * Kamailio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/*!
+ * \file
+ * \brief Multi-pattern matching over the message buffer
+ * \ingroup textops
+ * Module: \ref textops
+ */
+
+
+#ifndef _TXT_MATCH_H_
+#define _TXT_MATCH_H_
+
+#include <sys/types.h>
+#include <sys/time.h>
+#include <regex.h>
+
+#include "../../core/str.h"
+#include "../../core/re.h"
+#include "../../core/rpc.h"
+#include "../../core/parser/msg_parser.h"
+
+#define TX_PATTERN_SEARCH	0
+#define TX_PATTERN_SUBST	1
+
+#define TX_SCOPE_MSG	0
+#define TX_SCOPE_BODY	1
+
+typedef struct tx_pattern {
+	int idx;                /* position in the patterns table */
+	int type;               /* TX_PATTERN_SEARCH or TX_PATTERN_SUBST */
+	str text;               /* the pattern as given by the script */
+	str lit;                /* literal text (lower case) that every match
+							 * contains, empty if none could be found */
+	regex_t re;             /* compiled search expression */
+	struct subst_expr *se;  /* compiled subst expression */
+	int lnext;              /* next pattern with the same literal head */
+	unsigned int hashid;    /* hash of the text, for dynamic patterns */
+	struct tx_pattern *next;
+} tx_pattern_t;
+
+typedef int (*tx_search_f)(sip_msg_t *msg, regex_t *re);
+
+extern int tx_search_prefilter;
+extern int tx_search_cache;
+extern int tx_pattern_stats;
+extern int tx_pattern_cache_size;
+
+int tx_fixup_search(void **param, int param_no);
+int tx_fixup_free_search(void **param, int param_no);
+int tx_fixup_subst(void **param, int param_no);
+
+tx_pattern_t *tx_pattern_get(str *text, int type);
+
+int tx_pattern_stats_init(void);
+
+int tx_pattern_search(sip_msg_t *msg, tx_pattern_t *txp, int scope,
+		tx_search_f sf);
+int tx_pattern_prefilter(sip_msg_t *msg, tx_pattern_t *txp);
+void tx_pattern_exec_start(tx_pattern_t *txp, struct timeval *tvb);
+void tx_pattern_exec_end(tx_pattern_t *txp, struct timeval *tvb, int ret);
+
+extern rpc_export_t tx_pattern_rpc[];
+
+#endif
@@ -1285,6 +1285,8 @@ static inline int new_t(struct sip_msg *p_msg)
 		LM_ERR("uri invalid\n");
 		return E_BAD_REQ;
 	}
+	/* keep the receive time in the cloned request (final reply stats) */
+	msg_set_time(p_msg);
 
 	/* add new transaction */
 	new_cell = build_cell( p_msg ) ;
@@ -511,6 +511,7 @@ static int _reply_light( struct cell *trans, char* buf, unsigned int len,
 	 * on current transactions status */
 	/* t_update_timers_after_sending_reply( rb ); */
 	update_reply_stats( code );
+	t_stats_rpl_time( trans, code );
 	trans->relayed_reply_branch=-2;
 	t_stats_rpl_generated();
 	t_stats_rpl_sent();
@@ -2040,6 +2041,7 @@ enum rps relay_reply( struct cell *t, struct sip_msg *p_msg, int branch,
 			}
 		}
 		update_reply_stats( relayed_code );
+		t_stats_rpl_time( t, relayed_code );
 		t_stats_rpl_sent();
 		if (!buf) {
 			LM_ERR("no mem for outbound reply buffer\n");
@@ -2251,6 +2253,7 @@ enum rps local_reply( struct cell *t, struct sip_msg *p_msg, int branch,
 		}
 		t->uas.status = winning_code;
 		update_reply_stats( winning_code );
+		t_stats_rpl_time( t, winning_code );
 		t_stats_rpl_sent();
 		if (unlikely(is_invite(t) && winning_msg!=FAKED_REPLY
 					&& winning_code>=200 && winning_code <300
@@ -30,6 +30,7 @@
 #include "h_table.h"
 
 union t_stats *tm_stats=0;
+counter_handle_t tm_rpl_time_hist;
 
 int init_tm_stats(void)
 {
@@ -40,10 +41,33 @@ int init_tm_stats(void)
 	 * from modules which get loaded after tm and thus their mod_init
 	 * functions will be called after tm mod_init function finishes
 	 */
+	if (counter_register_hist(&tm_rpl_time_hist, "tm", "final_reply_us", 0,
+				"time from receiving the request to sending the final reply"
+				" (microseconds)", 0) < 0) {
+		LM_ERR("failed to register the final reply time histogram\n");
+		return -1;
+	}
 	return 0;
 }
 
 
+/* record the time elapsed since the request was received, for the final
+ * replies of server transactions */
+void t_stats_rpl_time(struct cell *t, int code)
+{
+	struct timeval now;
+	long long d;
+
+	if (code<200 || t==0 || t->uas.request==0
+			|| t->uas.request->tval.tv_sec==0)
+		return;
+	gettimeofday(&now, 0);
+	d=(long long)(now.tv_sec - t->uas.request->tval.tv_sec)*1000000
+		+ (now.tv_usec - t->uas.request->tval.tv_usec);
+	counter_hist_add(tm_rpl_time_hist, (d>0)?d:0);
+}
+
+
 int init_tm_stats_child(void)
 {
 	int size;
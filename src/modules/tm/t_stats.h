@@ -27,6 +27,7 @@
 
 #include "../../core/rpc.h"
 #include "../../core/pt.h"
+#include "../../core/counters.h"
 
 
 typedef unsigned long stat_counter;
@@ -62,6 +63,9 @@ union t_stats{
 };
 extern union t_stats *tm_stats;
 
+/* histogram of the time from request receiving to final reply (usec) */
+extern counter_handle_t tm_rpl_time_hist;
+
 #ifdef TM_MORE_STATS
 inline void static t_stats_created(void)
 {
@@ -120,6 +124,9 @@ inline static void update_reply_stats( int code ) {
 	}
 }
 
+struct cell;
+void t_stats_rpl_time(struct cell *t, int code);
+
 inline void static t_stats_rpl_received(void)
 {
 	tm_stats[process_no].s.rpl_received++;
@@ -1684,6 +1684,7 @@ int update_ucontact(struct urecord* _r, ucontact_t* _c, ucontact_info_t* _ci)
 		LM_ERR("failed to update memory\n");
 		return -1;
 	}
+	if (_r) ul_urecord_changed(_r);
 
 	if (ul_db_mode==DB_ONLY) {
 		/* urecord is static generate a copy for later */
@@ -1715,6 +1716,65 @@ int update_ucontact(struct urecord* _r, ucontact_t* _c, ucontact_info_t* _ci)
 	return 0;
 }
 
+#define ucontact_str_eq(_a, _b) \
+	((_a)->len==(_b)->len && ((_a)->len==0 || memcmp((_a)->s, (_b)->s, (_a)->len)==0))
+
+/*!
+ * \brief Refresh ucontact in place if only expires and CSeq changed
+ *
+ * Used for the re-registrations that keep all the other attributes of the
+ * contact. Only expires, CSeq and the timestamps are updated, the UPDATE
+ * callbacks are replaced by REFRESH ones and the database write is left
+ * to the timer (write through and write back modes).
+ * \param _r record the contact belongs to
+ * \param _c refreshed contact
+ * \param _ci new contact informations
+ * \return 0 if refreshed, 1 if a full update is needed
+ */
+int refresh_ucontact(struct urecord* _r, ucontact_t* _c, ucontact_info_t* _ci)
+{
+	str empty = {0, 0};
+
+	if (ul_db_mode==DB_ONLY || _r==NULL) return 1;
+	/* keep the notifications for the modules using the update events */
+	if (exists_ulcb_type(UL_CONTACT_UPDATE)) return 1;
+	/* the contact xavps have to be stored again */
+	if (ul_xavp_contact_clone && ul_xavp_contact_name.s!=NULL) return 1;
+
+	if (_ci->callid==NULL || !ucontact_str_eq(_ci->callid, &_c->callid))
+		return 1;
+	if (_ci->user_agent==NULL || !ucontact_str_eq(_ci->user_agent, &_c->user_agent))
+		return 1;
+	if (!ucontact_str_eq(&_ci->received, &_c->received))
+		return 1;
+	if (!ucontact_str_eq((_ci->path)?_ci->path:&empty, &_c->path))
+		return 1;
+	if (_ci->instance.s!=NULL && _ci->instance.len>0 && _ci->c!=NULL
+			&& _ci->c->s!=NULL && _ci->c->len>0
+			&& !ucontact_str_eq(_ci->c, &_c->c))
+		return 1;
+	if (_c->sock!=_ci->sock || _c->q!=_ci->q || _c->methods!=_ci->methods
+			|| _c->flags!=_ci->flags || _c->cflags!=_ci->cflags
+			|| _c->server_id!=_ci->server_id
+			|| _c->tcpconn_id!=_ci->tcpconn_id)
+		return 1;
+
+	_c->expires = _ci->expires;
+	_c->cseq = _ci->cseq;
+	_c->last_modified = _ci->last_modified;
+	_c->last_keepalive = time(NULL);
+	ul_urecord_changed(_r);
+
+	if (exists_ulcb_type(UL_CONTACT_REFRESH)) {
+		run_ul_callbacks( UL_CONTACT_REFRESH, _c);
+	}
+
+	update_contact_pos( _r, _c);
+	/* marked dirty, the timer writes it to database */
+	st_update_ucontact(_c);
+	return 0;
+}
+
 /*!
  * \brief Load all location attributes from a udomain
  *
@@ -143,6 +143,16 @@ int db_delete_ucontact(ucontact_t* _c);
  */
 int update_ucontact(struct urecord* _r, ucontact_t* _c, ucontact_info_t* _ci);
 
+
+/*!
+ * \brief Refresh ucontact in place if only expires and CSeq changed
+ * \param _r record the contact belongs to
+ * \param _c refreshed contact
+ * \param _ci new contact informations
+ * \return 0 if refreshed, 1 if a full update is needed
+ */
+int refresh_ucontact(struct urecord* _r, ucontact_t* _c, ucontact_info_t* _ci);
+
 /* ====== per contact attributes ====== */
 
 /*!
@@ -1347,8 +1347,10 @@ int get_urecord(udomain_t* _d, str* _aor, struct urecord** _r)
 					{
 						if (ptr->expires == UL_EXPIRED_TIME )
 							continue;
-						if (is_valid_tcpconn(ptr) && !is_tcp_alive(ptr))
+						if (is_valid_tcpconn(ptr) && !is_tcp_alive(ptr)) {
 							ptr->expires = UL_EXPIRED_TIME;
+							ul_urecord_changed(r);
+						}
 					}
 				}
 				*_r = r;
@@ -36,7 +36,8 @@ struct ucontact;
 #define UL_CONTACT_UPDATE      (1<<1)
 #define UL_CONTACT_DELETE      (1<<2)
 #define UL_CONTACT_EXPIRE      (1<<3)
-#define ULCB_MAX               ((1<<4)-1)
+#define UL_CONTACT_REFRESH     (1<<4)
+#define ULCB_MAX               ((1<<5)-1)
 
 /*! \brief callback function prototype */
 typedef void (ul_cb) (struct ucontact *c, int type, void *param);
@@ -145,6 +145,8 @@ int ul_ka_urecord(urecord_t *ur)
 						ur->aor.len, ur->aor.s, uc->c.len, uc->c.s);
 				if(uc->expires > tnow + 10) {
 					uc->expires = tnow + 10;
+					/* the cached branches of the record are outdated */
+					ul_urecord_changed(ur);
 					continue;
 				}
 			}
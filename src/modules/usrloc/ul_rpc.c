@@ -229,6 +229,7 @@ static void ul_rpc_dump(rpc_t* rpc, void* ctx)
 	void* ih;
 	void* sh;
 	int max, n, i;
+	int nb;
 
 	rpc->scan(ctx, "*S", &brief);
 
@@ -246,6 +247,7 @@ static void ul_rpc_dump(rpc_t* rpc, void* ctx)
 		return;
 	}
 	
+	nb = 0;
 	for( dl=_ksr_ul_root ; dl ; dl=dl->next ) {
 		dom = dl->d;
 
@@ -266,6 +268,7 @@ static void ul_rpc_dump(rpc_t* rpc, void* ctx)
 		for(i=0,n=0,max=0; i<dom->size; i++) {
 			lock_ulslot( dom, i);
 			n += dom->table[i].n;
+			nb += dom->table[i].n;
 			if(max<dom->table[i].n)
 				max= dom->table[i].n;
 			for( r = dom->table[i].first ; r ; r=r->next ) {
@@ -306,6 +309,12 @@ static void ul_rpc_dump(rpc_t* rpc, void* ctx)
 			}
 
 			unlock_ulslot( dom, i);
+			/* send out the records added so far, outside of the slot lock */
+			if(nb >= RPC_STREAM_BATCH) {
+				nb = 0;
+				if(rpc_stream_flush(rpc, ctx) < 0)
+					return;
+			}
 		}
 
 		/* extra attributes node */
@@ -35,6 +35,7 @@
 #include "../../core/hashes.h"
 #include "../../core/tcp_conn.h"
 #include "../../core/pass_fd.h"
+#include "../../core/atomic_ops.h"
 #include "usrloc_mod.h"
 #include "usrloc.h"
 #include "utime.h"
@@ -46,6 +47,9 @@ int ul_matching_mode = CONTACT_ONLY;
 /*! retransmission detection interval in seconds */
 int ul_cseq_delay = 20;
 
+/*! \brief counter for the versions of the records */
+static atomic_t *_ul_urecord_version = NULL;
+
 /*!
  * \brief Create and initialize new record structure
  * \param _dom domain name
@@ -73,10 +77,64 @@ int new_urecord(str* _dom, str* _aor, urecord_t** _r)
 	(*_r)->aor.len = _aor->len;
 	(*_r)->domain = _dom;
 	(*_r)->aorhash = ul_get_aorhash(_aor);
+	ul_urecord_changed(*_r);
+	return 0;
+}
+
+
+/*!
+ * \brief Init the shared counter used for the record versions
+ * \return 0 on success, -1 on failure
+ */
+int ul_init_urecord_version(void)
+{
+	_ul_urecord_version = (atomic_t*)shm_malloc(sizeof(atomic_t));
+	if(_ul_urecord_version == NULL) {
+		SHM_MEM_ERROR;
+		return -1;
+	}
+	atomic_set(_ul_urecord_version, 0);
 	return 0;
 }
 
 
+/*!
+ * \brief Destroy the shared counter used for the record versions
+ */
+void ul_destroy_urecord_version(void)
+{
+	if(_ul_urecord_version != NULL) {
+		shm_free(_ul_urecord_version);
+		_ul_urecord_version = NULL;
+	}
+}
+
+
+/*!
+ * \brief Set a new version for the record after changing its contacts
+ *
+ * The version is taken from a global counter, so a record created again
+ * for the same AoR does not reuse the versions of the old one. It lets
+ * the users of the API (e.g., registrar lookup) cache data built from
+ * the contacts of a record and detect when it is outdated.
+ * \param _r changed record
+ */
+void ul_urecord_changed(urecord_t* _r)
+{
+	unsigned int v;
+
+	if(ul_db_mode == DB_ONLY || _ul_urecord_version == NULL) {
+		/* static record rebuilt from database on each access */
+		_r->version = 0;
+		return;
+	}
+	do {
+		v = (unsigned int)atomic_add(_ul_urecord_version, 1);
+	} while(v == 0);
+	_r->version = v;
+}
+
+
 /*!
  * \brief Free all memory used by the given structure
  *
@@ -150,6 +208,7 @@ ucontact_t* mem_insert_ucontact(urecord_t* _r, str* _c, ucontact_info_t* _ci)
 		return 0;
 	}
 	if_update_stat( _r->slot, _r->slot->d->contacts, 1);
+	ul_urecord_changed(_r);
 
 	ptr = _r->contacts;
 
@@ -190,6 +249,7 @@ ucontact_t* mem_insert_ucontact(urecord_t* _r, str* _c, ucontact_info_t* _ci)
  */
 void mem_remove_ucontact(urecord_t* _r, ucontact_t* _c)
 {
+	ul_urecord_changed(_r);
 	if (_c->prev) {
 		_c->prev->next = _c->next;
 		if (_c->next) {
@@ -282,6 +342,7 @@ static inline void nodb_timer(urecord_t* _r)
 		if (ul_handle_lost_tcp && is_valid_tcpconn(ptr) && !is_tcp_alive(ptr)) {
 			LM_DBG("tcp connection has been lost, expiring contact %.*s\n", ptr->c.len, ptr->c.s);
 			ptr->expires = UL_EXPIRED_TIME;
+			ul_urecord_changed(_r);
 		}
 
 		if (!VALID_CONTACT(ptr, ul_act_time)) {
@@ -376,6 +437,7 @@ static inline void wb_timer(urecord_t* _r)
 		if (ul_handle_lost_tcp && is_valid_tcpconn(ptr) && !is_tcp_alive(ptr)) {
 			LM_DBG("tcp connection has been lost, expiring contact %.*s\n", ptr->c.len, ptr->c.s);
 			ptr->expires = UL_EXPIRED_TIME;
+			ul_urecord_changed(_r);
 		}
 
 		if (!VALID_CONTACT(ptr, ul_act_time)) {
@@ -639,6 +701,8 @@ int delete_ucontact(urecord_t* _r, struct ucontact* _c)
 		memcpy(_r, &_ur, sizeof(struct urecord));
 	}
 
+	/* the contact is removed or marked as expired */
+	ul_urecord_changed(_r);
 	if (st_delete_ucontact(_c) > 0) {
 		if (ul_db_mode == WRITE_THROUGH || ul_db_mode==DB_ONLY) {
 			if (db_delete_ucontact(_c) < 0) {
@@ -51,6 +51,26 @@ struct hslot; /*!< Hash table slot */
 int new_urecord(str* _dom, str* _aor, urecord_t** _r);
 
 
+/*!
+ * \brief Init the shared counter used for the record versions
+ * \return 0 on success, -1 on failure
+ */
+int ul_init_urecord_version(void);
+
+
+/*!
+ * \brief Destroy the shared counter used for the record versions
+ */
+void ul_destroy_urecord_version(void);
+
+
+/*!
+ * \brief Set a new version for the record after changing its contacts
+ * \param _r changed record
+ */
+void ul_urecord_changed(urecord_t* _r);
+
+
 /*!
  * \brief Free all memory used by the given structure
  *
@@ -66,6 +66,7 @@ int bind_usrloc(usrloc_api_t* api)
 	api->delete_ucontact    = delete_ucontact;
 	api->get_ucontact       = get_ucontact;
 	api->update_ucontact    = update_ucontact;
+	api->refresh_ucontact   = refresh_ucontact;
 	api->register_ulcb      = register_ulcb;
 	api->get_aorhash        = ul_get_aorhash;
 
@@ -139,6 +139,9 @@ typedef struct urecord {
 	str aor;                       /*!< Address of record */
 	unsigned int aorhash;          /*!< Hash over address of record */
 	ucontact_t* contacts;          /*!< One or more contact fields */
+	unsigned int version;          /*!< Changed on any update of the contacts
+                                    * (unique among the records, 0 if the
+                                    * record is not kept in memory) */
 
 	struct hslot* slot;            /*!< Collision slot in the hash table
                                     * array we belong to */
@@ -159,6 +162,8 @@ typedef int  (*delete_urecord_by_ruid_t)(struct udomain* _d, str* _ruid);
 
 typedef int (*update_ucontact_t)(struct urecord* _r, struct ucontact* _c,
 		struct ucontact_info* _ci);
+typedef int (*refresh_ucontact_t)(struct urecord* _r, struct ucontact* _c,
+		struct ucontact_info* _ci);
 typedef void (*release_urecord_t)(struct urecord* _r);
 
 typedef int (*insert_ucontact_t)(struct urecord* _r, str* _contact,
@@ -224,6 +229,7 @@ typedef struct usrloc_api {
 	get_ucontact_by_instance_t  get_ucontact_by_instance;
 
 	update_ucontact_t    update_ucontact;
+	refresh_ucontact_t   refresh_ucontact;
 
 	register_ulcb_t      register_ulcb;
 	ul_get_aorhash_t     get_aorhash;
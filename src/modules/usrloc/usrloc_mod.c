@@ -310,6 +310,10 @@ static int mod_init(void)
 		return -1;
 	}
 
+	if(ul_init_urecord_version()<0) {
+		return -1;
+	}
+
 #ifdef STATISTICS
 	/* register statistics */
 	if (register_module_stats(exports.name, mod_stats)!=0 ) {
@@ -507,6 +511,8 @@ static void destroy(void)
 
 	/* free callbacks list */
 	destroy_ulcb_list();
+
+	ul_destroy_urecord_version();
 }
 
 /*! \brief
@@ -35,6 +35,9 @@
 
 #include "../../core/counters.h"
 #include "../../core/ut.h"
+#include "../../core/locking.h"
+#include "../../core/mem/mem.h"
+#include "../../core/mem/shm_mem.h"
 
 #include "prom.h"
 #include "prom_metric.h"
@@ -166,121 +169,158 @@ int get_timestamp(uint64_t *ts)
 }
 
 /**
- * @brief Generate a string suitable for a Prometheus metric.
+ * @brief Append raw data in prom_body buffer.
  *
  * @return 0 on success.
+ * @return -1 on error.
  */
-static int metric_generate(prom_ctx_t *ctx, str *group, str *name, counter_handle_t *h)
+static int prom_body_append(prom_ctx_t *ctx, char *s, int len)
 {
-	long counter_val = counter_get_val(*h);
-
-	/* Calculate timestamp. */
-	uint64_t ts;
-	if (get_timestamp(&ts)) {
-		LM_ERR("Error getting current timestamp\n");
-		return -1;
-	}
-
-	LM_DBG("metric -> group: %.*s  name: %.*s  value: %lu  TS: %" PRIu64 "\n",
-		   group->len, group->s, name->len, name->s,
-		   counter_val, (uint64_t)ts);
+	struct xhttp_prom_reply *reply = &ctx->reply;
 
-	/* Print metric name. */
-	if (prom_body_name_printf(ctx, "%.*s%.*s_%.*s",
-						 xhttp_prom_beginning.len, xhttp_prom_beginning.s,
-						 group->len, group->s, name->len, name->s) == -1) {
-		LM_ERR("Fail to print\n");
-		return -1;
-	}
-						 
-	if (prom_body_printf(ctx, " %lu %" PRIu64 "\n",
-						 counter_val, (uint64_t)ts) == -1) {
-		LM_ERR("Fail to print\n");
+	if (len >= reply->buf.len - reply->body.len) {
+		LM_ERR("Error body buffer overflow: %d (%d)\n", len,
+			   reply->buf.len - reply->body.len);
 		return -1;
 	}
+	memcpy(reply->buf.s + reply->body.len, s, len);
+	reply->body.len += len;
 
 	return 0;
 }
 
 /**
- * @brief Statistic getter callback.
+ * @brief Precomputed Kamailio statistic for exposition.
+ *
+ * Metric name (with beginning prefix, '-' replaced by '_' and the
+ * trailing space) is built once per process, so a scrape only copies
+ * the name and prints the value.
+ */
+typedef struct prom_stat_item {
+	counter_handle_t h;
+	str name;
+	int hist; /* histogram counter */
+} prom_stat_item_t;
+
+/**
+ * @brief Index of statistics selected by xhttp_prom_stats parameter.
+ */
+typedef struct prom_stat_index {
+	int ready;
+	prom_stat_item_t *items;
+	int items_no;
+	char *names;
+	int names_len;
+	str title;
+	int fill;   /* 0 - counting pass, 1 - filling pass */
+	int pos;
+	int npos;
+} prom_stat_index_t;
+
+static prom_stat_index_t _prom_stat_index = {0};
+
+/**
+ * @brief Shared cache of the Kamailio statistics exposition text.
+ *
+ * It is refreshed by a dedicated timer process when
+ * xhttp_prom_stats_refresh is set, SIP workers only copy it out.
+ */
+typedef struct prom_stats_cache {
+	gen_lock_t lock;
+	char *buf;
+	int size;
+	int len;
+} prom_stats_cache_t;
+
+static prom_stats_cache_t *_prom_stats_cache = NULL;
+
+/**
+ * @brief Add one statistic to the index (counting or filling pass).
  */
-static void prom_get_grp_vars_cbk(void* p, str* g, str* n, counter_handle_t h)
+static void prom_stat_index_add(void *p, str *g, str *n, counter_handle_t h)
 {
-	metric_generate(p, g, n, &h);
+	prom_stat_index_t *idx = (prom_stat_index_t*)p;
+	prom_stat_item_t *it;
+	int len;
+	int i;
+
+	/* <beginning><group>_<name><space> */
+	len = xhttp_prom_beginning.len + g->len + 1 + n->len + 1;
+	if (idx->fill == 0) {
+		idx->items_no++;
+		idx->names_len += len;
+		return;
+	}
+
+	if (idx->pos >= idx->items_no || idx->npos + len > idx->names_len) {
+		/* should not happen - counters are registered before forking */
+		LM_ERR("statistics index overflow\n");
+		return;
+	}
+	it = &idx->items[idx->pos++];
+	it->h = h;
+	it->hist = counter_is_hist(h);
+	it->name.s = idx->names + idx->npos;
+	it->name.len = len;
+	idx->npos += len;
+
+	len = 0;
+	memcpy(it->name.s, xhttp_prom_beginning.s, xhttp_prom_beginning.len);
+	len += xhttp_prom_beginning.len;
+	memcpy(it->name.s + len, g->s, g->len);
+	len += g->len;
+	it->name.s[len++] = '_';
+	memcpy(it->name.s + len, n->s, n->len);
+	len += n->len;
+	it->name.s[len] = ' ';
+
+	/* Change - into _ to accomplish with Prometheus guidelines for metric names */
+	for (i=0; i<len; i++) {
+		if (it->name.s[i] == '-') {
+			it->name.s[i] = '_';
+		}
+	}
 }
 
 /**
- * @brief Group statistic getter callback.
+ * @brief Group statistic index callback.
  */
-static void prom_get_all_grps_cbk(void* p, str* g)
+static void prom_stat_index_grp(void *p, str *g)
 {
-	counter_iterate_grp_vars(g->s, prom_get_grp_vars_cbk, p);
+	counter_iterate_grp_vars(g->s, prom_stat_index_add, p);
 }
 
 #define STATS_MAX_LEN 1024
 
 /**
- * @brief Get statistics (based on stats_get_all)
+ * @brief Walk the statistics selected by stat parameter.
  *
  * @return 0 on success
  */
-int prom_stats_get(prom_ctx_t *ctx, str *stat)
+static int prom_stat_index_walk(prom_stat_index_t *idx, str *stat)
 {
-	if (stat == NULL) {
-		LM_ERR("No stats set\n");
-		return -1;
-	}
-
-	prom_body_delete(ctx);
-	
-	LM_DBG("User defined statistics\n");
-	if (prom_metric_list_print(ctx)) {
-		LM_ERR("Fail to print user defined metrics\n");
-		return -1;
-	}
-
-	LM_DBG("Statistics for: %.*s\n", stat->len, stat->s);
-
 	int len = stat->len;
-
 	stat_var *s_stat;
 
 	if (len == 0) {
 		LM_DBG("Do not show Kamailio statistics\n");
-
 	}
 	else if (len==3 && strncmp("all", stat->s, 3)==0) {
 		LM_DBG("Showing all statistics\n");
-		if (prom_body_printf(
-				ctx, "\n# Kamailio whole internal statistics\n") == -1) {
-			LM_ERR("Fail to print\n");
-			return -1;
-		}	
-
-		counter_iterate_grp_names(prom_get_all_grps_cbk, ctx);
+		counter_iterate_grp_names(prom_stat_index_grp, idx);
 	}
 	else if (stat->s[len-1]==':') {
 		LM_DBG("Showing statistics for group: %.*s\n", stat->len, stat->s);
 
-		if (len == 1) {
-			LM_ERR("Void group for statistics: %.*s\n", stat->len, stat->s);
+		if (len == 1 || len >= STATS_MAX_LEN) {
+			LM_ERR("Invalid group for statistics: %.*s\n", stat->len, stat->s);
 			return -1;
-			
 		} else {
-			if (prom_body_printf(
-					ctx, "\n# Kamailio statistics for group: %.*s\n",
-					stat->len, stat->s) == -1) {
-				LM_ERR("Fail to print\n");
-				return -1;
-			}
-
 			/* Temporary stat_tmp string. */
 			char stat_tmp[STATS_MAX_LEN];
 			memcpy(stat_tmp, stat->s, len);
 			stat_tmp[len-1] = '\0';
-			counter_iterate_grp_vars(stat_tmp, prom_get_grp_vars_cbk, ctx);
-			stat_tmp[len-1] = ':';
+			counter_iterate_grp_vars(stat_tmp, prom_stat_index_add, idx);
 		}
 	}
 	else {
@@ -295,34 +335,18 @@ int prom_stats_get(prom_ctx_t *ctx, str *stat)
 			} else {
 				group_str.len = 0;
 			}
-			
+
 			name_str.s = get_stat_name(s_stat);
 			if (name_str.s) {
 				name_str.len = strlen(name_str.s);
 			} else {
 				name_str.len = 0;
 			}
-			
-			LM_DBG("%s:%s = %lu\n",
-				   ZSW(get_stat_module(s_stat)), ZSW(get_stat_name(s_stat)),
-				   get_stat_val(s_stat));
-
-			if (group_str.len && name_str.len && s_stat) {
-				if (prom_body_printf(
-						ctx, "\n# Kamailio statistics for: %.*s\n",
-						stat->len, stat->s) == -1) {
-					LM_ERR("Fail to print\n");
-					return -1;
-				}
 
+			if (group_str.len && name_str.len) {
 				counter_handle_t stat_handle;
 				stat_handle.id = (unsigned short)(unsigned long)s_stat;
-				if (metric_generate(ctx, &group_str, &name_str, &stat_handle)) {
-					LM_ERR("Failed to generate metric: %.*s - %.*s\n",
-						   group_str.len, group_str.s,
-						   name_str.len, name_str.s);
-					return -1;
-				}
+				prom_stat_index_add(idx, &group_str, &name_str, stat_handle);
 			} else {
 				LM_ERR("Not enough length for group (%d) or name (%d)\n",
 					   group_str.len, name_str.len);
@@ -336,5 +360,335 @@ int prom_stats_get(prom_ctx_t *ctx, str *stat)
 	} /* if len == 0 */
 
 	return 0;
-} /* prom_stats_get */
+}
+
+/**
+ * @brief Build the index of statistics for current process.
+ *
+ * Counters cannot be registered after forking, so the index is built
+ * only once, on first use.
+ *
+ * @return 0 on success
+ */
+static int prom_stat_index_build(prom_stat_index_t *idx, str *stat)
+{
+	int len = stat->len;
+
+	memset(idx, 0, sizeof(prom_stat_index_t));
+
+	if (len == 0) {
+		idx->ready = 1;
+		return 0;
+	}
+
+	/* First pass computes number of items and size of names. */
+	if (prom_stat_index_walk(idx, stat)) {
+		return -1;
+	}
+
+	if (len==3 && strncmp("all", stat->s, 3)==0) {
+		idx->title.s = "\n# Kamailio whole internal statistics\n";
+		idx->title.len = strlen(idx->title.s);
+	} else {
+		idx->title.len = snprintf(NULL, 0, "\n# Kamailio statistics for%s %.*s\n",
+				(stat->s[len-1]==':')?" group:":":", stat->len, stat->s);
+	}
+
+	idx->items = (prom_stat_item_t*)pkg_malloc(
+			idx->items_no * sizeof(prom_stat_item_t)
+			+ idx->names_len + idx->title.len + 1);
+	if (idx->items == NULL) {
+		PKG_MEM_ERROR;
+		idx->items_no = 0;
+		return -1;
+	}
+	idx->names = (char*)(idx->items + idx->items_no);
+	if (idx->title.s == NULL) {
+		idx->title.s = idx->names + idx->names_len;
+		snprintf(idx->title.s, idx->title.len + 1,
+				"\n# Kamailio statistics for%s %.*s\n",
+				(stat->s[len-1]==':')?" group:":":", stat->len, stat->s);
+	}
+
+	/* Second pass fills in the items. */
+	idx->fill = 1;
+	if (prom_stat_index_walk(idx, stat)) {
+		pkg_free(idx->items);
+		memset(idx, 0, sizeof(prom_stat_index_t));
+		return -1;
+	}
+	idx->items_no = idx->pos;
+	idx->ready = 1;
+
+	LM_DBG("statistics index built with %d items\n", idx->items_no);
+
+	return 0;
+}
+
+/**
+ * @brief Bucket suffixes for histogram statistics: _bucket{le="X"}
+ */
+static str _prom_hist_le[CNT_HIST_BUCKETS];
+static char _prom_hist_le_buf[CNT_HIST_BUCKETS][INT2STR_MAX_LEN + 16];
+
+/**
+ * @brief Print a histogram statistic.
+ *
+ * @return 0 on success
+ */
+static int prom_stat_hist_print(prom_ctx_t *ctx, prom_stat_item_t *it,
+		char *tsbuf, int tslen)
+{
+	counter_hist_t hv;
+	counter_val_t cv;
+	char vbuf[INT2STR_MAX_LEN];
+	char *p;
+	int vlen;
+	int b;
+
+	if (_prom_hist_le[0].s == NULL) {
+		for (b=0; b<CNT_HIST_BUCKETS; b++) {
+			_prom_hist_le[b].s = _prom_hist_le_buf[b];
+			if (b == CNT_HIST_BUCKETS - 1) {
+				_prom_hist_le[b].len = snprintf(_prom_hist_le_buf[b],
+						INT2STR_MAX_LEN + 16, "_bucket{le=\"+Inf\"} ");
+			} else {
+				_prom_hist_le[b].len = snprintf(_prom_hist_le_buf[b],
+						INT2STR_MAX_LEN + 16, "_bucket{le=\"%lu\"} ",
+						counter_hist_bucket_le(b));
+			}
+		}
+	}
+
+	if (counter_get_hist(it->h, &hv)) {
+		return -1;
+	}
+
+	/* name without the trailing space */
+	cv = 0;
+	for (b=0; b<CNT_HIST_BUCKETS; b++) {
+		cv += hv.buckets[b];
+		p = int2strbuf((unsigned long)cv, vbuf, INT2STR_MAX_LEN, &vlen);
+		if (prom_body_append(ctx, it->name.s, it->name.len - 1)
+				|| prom_body_append(ctx, _prom_hist_le[b].s, _prom_hist_le[b].len)
+				|| prom_body_append(ctx, p, vlen)
+				|| prom_body_append(ctx, tsbuf, tslen)) {
+			return -1;
+		}
+	}
+	p = int2strbuf((unsigned long)hv.sum, vbuf, INT2STR_MAX_LEN, &vlen);
+	if (prom_body_append(ctx, it->name.s, it->name.len - 1)
+			|| prom_body_append(ctx, "_sum ", 5)
+			|| prom_body_append(ctx, p, vlen)
+			|| prom_body_append(ctx, tsbuf, tslen)) {
+		return -1;
+	}
+	p = int2strbuf((unsigned long)hv.count, vbuf, INT2STR_MAX_LEN, &vlen);
+	if (prom_body_append(ctx, it->name.s, it->name.len - 1)
+			|| prom_body_append(ctx, "_count ", 7)
+			|| prom_body_append(ctx, p, vlen)
+			|| prom_body_append(ctx, tsbuf, tslen)) {
+		return -1;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Print Kamailio statistics using the precomputed index.
+ *
+ * @return 0 on success
+ */
+static int prom_stats_print(prom_ctx_t *ctx, str *stat)
+{
+	prom_stat_index_t *idx = &_prom_stat_index;
+	char tsbuf[INT2STR_MAX_LEN + 2];
+	char vbuf[INT2STR_MAX_LEN];
+	char *p;
+	int tslen;
+	int vlen;
+	uint64_t ts;
+	int i;
+
+	if (!idx->ready) {
+		if (prom_stat_index_build(idx, stat)) {
+			return -1;
+		}
+	}
+	if (stat->len == 0) {
+		return 0;
+	}
+
+	if (prom_body_append(ctx, idx->title.s, idx->title.len)) {
+		LM_ERR("Fail to print\n");
+		return -1;
+	}
+
+	/* Timestamp is the same for the whole scrape. */
+	if (get_timestamp(&ts)) {
+		LM_ERR("Error getting current timestamp\n");
+		return -1;
+	}
+	tslen = snprintf(tsbuf, sizeof(tsbuf), " %" PRIu64 "\n", ts);
+	if (tslen < 0 || tslen >= sizeof(tsbuf)) {
+		LM_ERR("Fail to print timestamp\n");
+		return -1;
+	}
+
+	for (i=0; i<idx->items_no; i++) {
+		if (idx->items[i].hist) {
+			if (prom_stat_hist_print(ctx, &idx->items[i], tsbuf, tslen)) {
+				LM_ERR("Fail to print\n");
+				return -1;
+			}
+			continue;
+		}
+		p = int2strbuf((unsigned long)counter_get_val(idx->items[i].h),
+				vbuf, INT2STR_MAX_LEN, &vlen);
+		if (prom_body_append(ctx, idx->items[i].name.s, idx->items[i].name.len)
+				|| prom_body_append(ctx, p, vlen)
+				|| prom_body_append(ctx, tsbuf, tslen)) {
+			LM_ERR("Fail to print\n");
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Initialize shared cache of statistics.
+ *
+ * @return 0 on success
+ */
+int prom_stats_cache_init(void)
+{
+	_prom_stats_cache = (prom_stats_cache_t*)shm_malloc(
+			sizeof(prom_stats_cache_t));
+	if (_prom_stats_cache == NULL) {
+		SHM_MEM_ERROR;
+		return -1;
+	}
+	memset(_prom_stats_cache, 0, sizeof(prom_stats_cache_t));
+	if (lock_init(&_prom_stats_cache->lock) == NULL) {
+		LM_ERR("Cannot initialize the lock\n");
+		shm_free(_prom_stats_cache);
+		_prom_stats_cache = NULL;
+		return -1;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Destroy shared cache of statistics.
+ */
+void prom_stats_cache_destroy(void)
+{
+	if (_prom_stats_cache == NULL) {
+		return;
+	}
+	lock_destroy(&_prom_stats_cache->lock);
+	if (_prom_stats_cache->buf) {
+		shm_free(_prom_stats_cache->buf);
+	}
+	shm_free(_prom_stats_cache);
+	_prom_stats_cache = NULL;
+}
+
+/**
+ * @brief Timer callback to refresh the shared cache of statistics.
+ *
+ * It runs in a dedicated process, the buffer to build the text is
+ * allocated once and reused.
+ */
+void prom_stats_cache_timer(unsigned int ticks, void *param)
+{
+	static prom_ctx_t tctx;
+	char *nbuf;
+	int nsize;
+
+	if (_prom_stats_cache == NULL) {
+		return;
+	}
+	if (tctx.reply.buf.s == NULL) {
+		tctx.reply.buf.s = pkg_malloc(buf_size);
+		if (tctx.reply.buf.s == NULL) {
+			PKG_MEM_ERROR;
+			return;
+		}
+		tctx.reply.buf.len = buf_size;
+	}
+
+	prom_body_delete(&tctx);
+	if (prom_stats_print(&tctx, &xhttp_prom_stats)) {
+		LM_ERR("Failed to build statistics\n");
+		return;
+	}
+
+	lock_get(&_prom_stats_cache->lock);
+	if (tctx.reply.body.len > _prom_stats_cache->size) {
+		/* grow with some room to avoid resizing on each change */
+		nsize = tctx.reply.body.len + tctx.reply.body.len / 4 + 1;
+		nbuf = (char*)shm_malloc(nsize);
+		if (nbuf == NULL) {
+			lock_release(&_prom_stats_cache->lock);
+			SHM_MEM_ERROR;
+			return;
+		}
+		if (_prom_stats_cache->buf) {
+			shm_free(_prom_stats_cache->buf);
+		}
+		_prom_stats_cache->buf = nbuf;
+		_prom_stats_cache->size = nsize;
+	}
+	memcpy(_prom_stats_cache->buf, tctx.reply.buf.s, tctx.reply.body.len);
+	_prom_stats_cache->len = tctx.reply.body.len;
+	lock_release(&_prom_stats_cache->lock);
+}
+
+/**
+ * @brief Copy statistics from the shared cache.
+ *
+ * @return 0 on success
+ */
+static int prom_stats_cache_print(prom_ctx_t *ctx)
+{
+	int ret;
+
+	lock_get(&_prom_stats_cache->lock);
+	ret = prom_body_append(ctx, _prom_stats_cache->buf,
+			_prom_stats_cache->len);
+	lock_release(&_prom_stats_cache->lock);
 
+	return ret;
+}
+
+/**
+ * @brief Get statistics (based on stats_get_all)
+ *
+ * @return 0 on success
+ */
+int prom_stats_get(prom_ctx_t *ctx, str *stat)
+{
+	if (stat == NULL) {
+		LM_ERR("No stats set\n");
+		return -1;
+	}
+
+	prom_body_delete(ctx);
+	
+	LM_DBG("User defined statistics\n");
+	if (prom_metric_list_print(ctx)) {
+		LM_ERR("Fail to print user defined metrics\n");
+		return -1;
+	}
+
+	LM_DBG("Statistics for: %.*s\n", stat->len, stat->s);
+
+	if (_prom_stats_cache != NULL && stat->len > 0) {
+		return prom_stats_cache_print(ctx);
+	}
+
+	return prom_stats_print(ctx, stat);
+} /* prom_stats_get */
@@ -56,4 +56,21 @@ int prom_body_printf(prom_ctx_t *ctx, char *fmt, ...);
  */
 int prom_stats_get(prom_ctx_t *ctx, str *stat);
 
+/**
+ * @brief Initialize shared cache of statistics.
+ *
+ * @return 0 on success
+ */
+int prom_stats_cache_init(void);
+
+/**
+ * @brief Destroy shared cache of statistics.
+ */
+void prom_stats_cache_destroy(void);
+
+/**
+ * @brief Timer callback to refresh the shared cache of statistics.
+ */
+void prom_stats_cache_timer(unsigned int ticks, void *param);
+
 #endif // _PROM_H_
@@ -34,6 +34,7 @@
 #include "../../core/kemi.h"
 #include "../../core/rpc.h"
 #include "../../core/rpc_lookup.h"
+#include "../../core/timer_proc.h"
 
 #include "xhttp_prom.h"
 #include "prom.h"
@@ -62,6 +63,7 @@ str XHTTP_PROM_CONTENT_TYPE_TEXT_HTML = str_init("text/plain; version=0.0.4");
 
 static rpc_export_t rpc_cmds[];
 static int mod_init(void);
+static int child_init(int rank);
 static void mod_destroy(void);
 static int w_prom_check_uri(sip_msg_t* msg);
 static int w_prom_dispatch(sip_msg_t* msg);
@@ -119,6 +121,20 @@ int buf_size = 0; /**< size of buffer that contains the reply. */
 
 int timeout_minutes = 60; /**< timeout in minutes to delete old metrics. */
 
+/**
+ * @brief interval in milliseconds to refresh cached Kamailio statistics.
+ *
+ * When set, a dedicated process builds the statistics text and scrapes
+ * only copy it. Zero builds the statistics on each scrape.
+ */
+int xhttp_prom_stats_refresh = 0;
+
+/**
+ * @brief reply buffer kept between scrapes (xhttp_prom_buf_size set).
+ */
+static str xhttp_prom_buf = STR_NULL;
+static int buf_size_keep = 0;
+
 char error_buf[ERROR_REASON_BUF_LEN];
 
 /* module commands */
@@ -178,6 +194,7 @@ static param_export_t params[]={
 	{"prom_gauge",          PARAM_STRING|USE_FUNC_PARAM, (void*)prom_gauge_param},
 	{"prom_histogram",      PARAM_STRING|USE_FUNC_PARAM, (void*)prom_histogram_param},
 	{"xhttp_prom_timeout",	INT_PARAM,	&timeout_minutes},
+	{"xhttp_prom_stats_refresh",	INT_PARAM,	&xhttp_prom_stats_refresh},
 	{0, 0, 0}
 };
 
@@ -190,7 +207,7 @@ struct module_exports exports = {
 	0,         	/* exported pseudo-variables */
 	0,              /* response function */
 	mod_init,       /* module initialization function */
-	0,		/* per child init function */
+	child_init,     /* per child init function */
 	mod_destroy     /* destroy function */
 };
 
@@ -239,8 +256,12 @@ static int mod_init(void)
 	}
 
 	/* Check xhttp_prom_buf_size param */
-	if (buf_size == 0)
+	if (buf_size == 0) {
 		buf_size = pkg_mem_size/3;
+	} else {
+		/* explicitly sized buffer is reused across scrapes */
+		buf_size_keep = 1;
+	}
 
 	/* Initialize Prometheus metrics. */
 	if (prom_metric_init()) {
@@ -248,6 +269,33 @@ static int mod_init(void)
 		return -1;
 	}
 
+	/* Statistics cached and refreshed by a dedicated process. */
+	if (xhttp_prom_stats_refresh > 0 && xhttp_prom_stats.len > 0) {
+		if (prom_stats_cache_init()) {
+			LM_ERR("Cannot initialize statistics cache\n");
+			return -1;
+		}
+		register_basic_timers(1);
+	}
+
+	return 0;
+}
+
+static int child_init(int rank)
+{
+	if (rank != PROC_MAIN)
+		return 0;
+
+	if (xhttp_prom_stats_refresh <= 0 || xhttp_prom_stats.len == 0)
+		return 0;
+
+	if (fork_basic_utimer(PROC_TIMER, "XHTTP_PROM STATS TIMER",
+				1 /*socks flag*/, prom_stats_cache_timer, NULL,
+				1000 * xhttp_prom_stats_refresh /*milliseconds*/) < 0) {
+		LM_ERR("failed to register statistics timer as process\n");
+		return -1;
+	}
+
 	return 0;
 }
 
@@ -255,6 +303,7 @@ static void mod_destroy(void)
 {
 	LM_DBG("cleaning up\n");
 
+	prom_stats_cache_destroy();
 	prom_metric_close();
 }
 
@@ -345,13 +394,19 @@ static int init_xhttp_prom_reply(prom_ctx_t *ctx)
 
 	reply->code = 200;
 	reply->reason = XHTTP_PROM_REASON_OK;
-	reply->buf.s = pkg_malloc(buf_size);
-	if (!reply->buf.s) {
-		PKG_MEM_ERROR;
-		prom_fault(ctx, 500, "Internal Server Error (No memory left)");
-		return -1;
+	if (buf_size_keep && xhttp_prom_buf.s) {
+		reply->buf = xhttp_prom_buf;
+	} else {
+		reply->buf.s = pkg_malloc(buf_size);
+		if (!reply->buf.s) {
+			PKG_MEM_ERROR;
+			prom_fault(ctx, 500, "Internal Server Error (No memory left)");
+			return -1;
+		}
+		reply->buf.len = buf_size;
+		if (buf_size_keep)
+			xhttp_prom_buf = reply->buf;
 	}
-	reply->buf.len = buf_size;
 	reply->body.s = reply->buf.s;
 	reply->body.len = 0;
 	return 0;
@@ -366,7 +421,8 @@ static void xhttp_prom_reply_free(prom_ctx_t *ctx)
 	reply = &ctx->reply;
 	
 	if (reply->buf.s) {
-		pkg_free(reply->buf.s);
+		if (reply->buf.s != xhttp_prom_buf.s)
+			pkg_free(reply->buf.s);
 		reply->buf.s = NULL;
 		reply->buf.len = 0;
 	}
@@ -81,5 +81,15 @@ extern str xhttp_prom_beginning;
  */
 extern int timeout_minutes;
 
+/**
+ * @brief String to indicate which statistics to display.
+ */
+extern str xhttp_prom_stats;
+
+/**
+ * @brief size of buffer that contains the reply.
+ */
+extern int buf_size;
+
 #endif /* _XHTTP_PROM_H */
 
@@ -0,0 +1,206 @@
+/*
+ * Micro-benchmark for the SDP parser (parse_sdp() and clone_sdp_info())
+ * with a WebRTC like offer.
+ *
+ * Copyright (C) 2021 kamailio.org
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * The parser sources are included directly, with the shared memory mapped
+ * over malloc() and the logging disabled. Compile from this directory with:
+ *
+ *  gcc -O2 -DNO_LOG -DNO_DEBUG -DUSE_PTHREAD_MUTEX -I../../../src \
+ *      -o sdp_parse sdp_parse.c
+ *
+ * Run as: ./sdp_parse [iterations] [codecs] [candidates]
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "../../../src/core/parser/parser_f.c"
+#include "../../../src/core/parser/sdp/sdp.c"
+#include "../../../src/core/parser/sdp/sdp_helpr_funcs.c"
+
+/* stubs for the symbols used by the parser files */
+sr_shm_api_t _shm_root;
+
+char *get_body(sip_msg_t *const msg)
+{
+	/* skip the end of headers */
+	return msg->buf + 2;
+}
+
+int parse_content_type_hdr(struct sip_msg *const msg)
+{
+	return (TYPE_APPLICATION << 16) + SUBTYPE_SDP;
+}
+
+char *decode_mime_type(
+		char *const start, const char *const end, unsigned int *const mime_type)
+{
+	return NULL;
+}
+
+char *parse_hname2(
+		char *const begin, const char *const end, struct hdr_field *const hdr)
+{
+	return NULL;
+}
+
+void *ser_memmem(const void *b1, const void *b2, size_t len1, size_t len2)
+{
+	const char *sp = (const char *)b1;
+	const char *eos = sp + len1 - len2;
+
+	if(!(b1 && b2 && len1 && len2))
+		return NULL;
+	while(sp <= eos) {
+		if(*sp == *(const char *)b2 && memcmp(sp, b2, len2) == 0)
+			return (void *)sp;
+		sp++;
+	}
+	return NULL;
+}
+
+void *ser_memrmem(const void *b1, const void *b2, size_t len1, size_t len2)
+{
+	const char *p;
+
+	if(len2 > len1)
+		return NULL;
+	for(p = (const char *)b1 + len1 - len2; p >= (const char *)b1; p--) {
+		if(memcmp(p, b2, len2) == 0)
+			return (void *)p;
+	}
+	return NULL;
+}
+
+static void *bench_malloc(void *mbp, size_t size)
+{
+	return malloc(size);
+}
+
+static void bench_free(void *mbp, void *p)
+{
+	free(p);
+}
+
+static double bench_now(void)
+{
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+static int bench_media(char *p, int size, char *media, int port, int codecs,
+		int candidates)
+{
+	int len, i;
+
+	len = snprintf(p, size, "m=%s %d UDP/TLS/RTP/SAVPF", media, port);
+	for(i = 0; i < codecs; i++)
+		len += snprintf(p + len, size - len, " %d", 96 + i);
+	len += snprintf(p + len, size - len,
+			"\r\nc=IN IP4 192.0.2.10\r\na=rtcp:9 IN IP4 0.0.0.0\r\n"
+			"a=ice-ufrag:a1b2\r\na=ice-pwd:c3d4e5f6g7h8i9j0k1l2m3n4\r\n"
+			"a=mid:%s\r\na=sendrecv\r\na=rtcp-mux\r\n", media);
+	for(i = 0; i < candidates; i++)
+		len += snprintf(p + len, size - len,
+				"a=candidate:%d 1 udp 2122260223 192.0.2.%d %d typ host "
+				"generation 0 network-id 1\r\n",
+				1000 + i, 10 + i, 50000 + i);
+	for(i = 0; i < codecs; i++)
+		len += snprintf(p + len, size - len,
+				"a=rtpmap:%d %s%d/90000\r\na=rtcp-fb:%d nack\r\n"
+				"a=rtcp-fb:%d nack pli\r\na=fmtp:%d level-asymmetry-allowed=1;"
+				"packetization-mode=1;profile-level-id=42e01f\r\n",
+				96 + i, media, i, 96 + i, 96 + i, 96 + i);
+	return len;
+}
+
+int main(int argc, char **argv)
+{
+	static char buf[256 * 1024];
+	sip_msg_t msg;
+	sdp_info_t *sdp, *csdp;
+	sdp_stream_cell_t *stream;
+	sdp_payload_attr_t *payload;
+	int len;
+	int i, n, codecs, candidates;
+	double t;
+
+	n = (argc > 1) ? atoi(argv[1]) : 100000;
+	codecs = (argc > 2) ? atoi(argv[2]) : 30;
+	candidates = (argc > 3) ? atoi(argv[3]) : 12;
+
+	_shm_root.xmalloc = bench_malloc;
+	_shm_root.xfree = bench_free;
+
+	len = snprintf(buf, sizeof(buf),
+			"\r\nv=0\r\no=- 4611731400430051336 2 IN IP4 127.0.0.1\r\n"
+			"s=-\r\nt=0 0\r\na=group:BUNDLE audio video\r\n");
+	len += bench_media(buf + len, sizeof(buf) - len, "audio", 9, codecs,
+			candidates);
+	len += bench_media(buf + len, sizeof(buf) - len, "video", 9, codecs,
+			candidates);
+
+	memset(&msg, 0, sizeof(sip_msg_t));
+	msg.buf = buf;
+	msg.len = len;
+
+	if(parse_sdp(&msg) != 0) {
+		fprintf(stderr, "failed to parse the sdp\n");
+		return 1;
+	}
+	sdp = (sdp_info_t *)msg.body;
+	stream = get_sdp_stream(&msg, 0, 1);
+	payload = get_sdp_payload4index(stream, codecs - 1);
+	printf("sdp: %d bytes, %d streams, %d payloads, %d candidates,"
+		   " last codec %.*s\n",
+			len - 2, sdp->streams_num, stream->payloads_num,
+			stream->ice_attrs_num, payload->rtp_enc.len, payload->rtp_enc.s);
+	free_sdp((sdp_info_t **)(void *)&msg.body);
+
+	t = bench_now();
+	for(i = 0; i < n; i++) {
+		if(parse_sdp(&msg) != 0) {
+			fprintf(stderr, "failed to parse the sdp\n");
+			return 1;
+		}
+		free_sdp((sdp_info_t **)(void *)&msg.body);
+	}
+	t = bench_now() - t;
+	printf("parse: %d iterations in %.3fs - %.0f sdp/s\n", n, t, n / t);
+
+	parse_sdp(&msg);
+	t = bench_now();
+	for(i = 0; i < n; i++) {
+		csdp = clone_sdp_info(&msg);
+		if(csdp == NULL) {
+			fprintf(stderr, "failed to clone the sdp\n");
+			return 1;
+		}
+		free_cloned_sdp(csdp);
+	}
+	t = bench_now() - t;
+	printf("clone: %d iterations in %.3fs - %.0f sdp/s\n", n, t, n / t);
+	free_sdp((sdp_info_t **)(void *)&msg.body);
+
+	return 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * Checks for the literal prefilter of the textops search/subst patterns:
+ * every subject matched by a regular expression has to contain the literal
+ * extracted from it, otherwise the prefilter would skip a real match.
+ *
+ * Copyright (C) 2021 kamailio.org
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * The module source is included directly, with the logging disabled.
+ * Compile from this directory with:
+ *
+ *  gcc -O2 -DNO_LOG -DNO_DEBUG -DUSE_PTHREAD_MUTEX -DCC_GCC_LIKE_ASM \
+ *      -D__CPU_x86_64 -I../../../src -o textops_prefilter textops_prefilter.c
+ *
+ * Run as: ./textops_prefilter (exit code is 0 if all the checks passed)
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <regex.h>
+
+#include "../../../src/modules/textops/txt_match.c"
+
+/* stubs for the symbols used by the module file */
+sr_shm_api_t _shm_root;
+
+struct subst_expr *subst_parser(str *subst)
+{
+	return NULL;
+}
+
+void subst_expr_free(struct subst_expr *se)
+{
+}
+
+struct prefilter_test
+{
+	char *re;
+	char *subject;
+	int match; /* expected result of regexec() */
+};
+
+static struct prefilter_test tests[] = {
+		{"ab+cd", "xabbbcdx", 1},
+		{"ab*cd", "acd", 1},
+		{"ab?cd", "acd", 1},
+		{"ab{0,1}cd", "acd", 1},
+		/* a quantifier after '+' makes the char optional in ERE */
+		{"ab+?cd", "acd", 1},
+		{"ab+*cd", "acd", 1},
+		{"ab+{0,1}cd", "acd", 1},
+		{"ab+?cd", "abbcd", 1},
+		{"INVITE sip:", "invite sip:alice@example.com SIP/2.0", 1},
+		{"^From:.*tag=", "From: <sip:a@b>;tag=123", 1},
+		{"Call-ID: [0-9]+@host", "Call-ID: 1234@host", 1},
+		{"(abc|def)ghi", "defghi", 1},
+		{"abc\\.def", "abc.def", 1},
+		{"abc\\wdef", "abcxdef", 1},
+		{"x(ab)*yz", "xyz", 1},
+		{"ab[cd]ef", "abdef", 1},
+		{"abc|xyz", "xyz", 1},
+		{"ab+cd", "acd", 0},
+		{NULL, NULL, 0}
+};
+
+/* case insensitive search of lit in s */
+static int lit_found(char *s, str *lit)
+{
+	int len;
+
+	len = strlen(s);
+	for(; len >= lit->len; s++, len--) {
+		if(strncasecmp(s, lit->s, lit->len) == 0)
+			return 1;
+	}
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	struct prefilter_test *t;
+	regex_t re;
+	str sre;
+	str lit;
+	char *buf;
+	int m;
+	int errs;
+
+	errs = 0;
+	for(t = tests; t->re; t++) {
+		if(regcomp(&re, t->re, REG_EXTENDED | REG_ICASE | REG_NEWLINE) != 0) {
+			printf("FAIL [%s]: bad regular expression\n", t->re);
+			errs++;
+			continue;
+		}
+		m = (regexec(&re, t->subject, 0, NULL, 0) == 0);
+		regfree(&re);
+
+		sre.s = t->re;
+		sre.len = strlen(t->re);
+		buf = malloc(2 * (sre.len + 1));
+		if(buf == NULL) {
+			printf("no more memory\n");
+			return 2;
+		}
+		lit.s = buf;
+		tx_re_literal(&sre, &lit, buf + sre.len + 1);
+
+		if(m != t->match) {
+			printf("FAIL [%s] on [%s]: regexec result %d, expected %d\n",
+					t->re, t->subject, m, t->match);
+			errs++;
+		} else if(m && lit.len > 0 && !lit_found(t->subject, &lit)) {
+			printf("FAIL [%s] on [%s]: literal [%.*s] not in subject\n",
+					t->re, t->subject, lit.len, lit.s);
+			errs++;
+		} else {
+			printf("ok   [%s] on [%s]: literal [%.*s]\n", t->re, t->subject,
+					lit.len, lit.s);
+		}
+		free(buf);
+	}
+	printf("%d errors\n", errs);
+	return errs ? 1 : 0;
+}
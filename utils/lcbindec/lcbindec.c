@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2021 kamailio.org
+ *
+ * This file is part of Kamailio, a free SIP server.
+ *
+ * Kamailio is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version
+ *
+ * Kamailio is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/*
+ * Offline decoder for the binary event log files written by the
+ * log_custom module (bin_dir parameter) - prints the records as text
+ * or as one JSON document per line.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* keep in sync with src/modules/log_custom/log_custom_bin.h */
+#define LC_BIN_MAGIC 0x42434c4b
+#define LC_BIN_VERSION 1
+#define LC_BIN_EV_PAD 0
+
+typedef struct lc_bin_hdr {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t hsize;
+	uint32_t size;
+	uint32_t wrapped;
+	uint64_t head;
+	uint64_t tail;
+	uint64_t nrecs;
+	uint64_t stime;
+	int32_t pid;
+	int32_t pno;
+	char pdesc[64];
+} lc_bin_hdr_t;
+
+typedef struct lc_bin_rec {
+	uint16_t size;
+	uint8_t etype;
+	uint8_t rlen;
+	uint16_t plen;
+	uint16_t flags;
+	uint32_t msgid;
+	uint32_t cidhash;
+	uint64_t tsus;
+} lc_bin_rec_t;
+
+static int json_mode = 0;
+
+static void print_usage(char *name)
+{
+	fprintf(stderr,
+			"Usage: %s [-j] [-h] file ...\n"
+			"  Decode log_custom binary event log files.\n"
+			"    -j  print one JSON document per record\n"
+			"    -h  print this help\n",
+			name);
+}
+
+static void print_ts(uint64_t tsus)
+{
+	time_t t;
+	struct tm tm;
+	char buf[32];
+
+	t = (time_t)(tsus / 1000000);
+	gmtime_r(&t, &tm);
+	strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S", &tm);
+	printf("%s.%06uZ", buf, (unsigned)(tsus % 1000000));
+}
+
+static void print_json_str(const char *s, int len)
+{
+	int i;
+	unsigned char c;
+
+	putchar('"');
+	for(i = 0; i < len; i++) {
+		c = (unsigned char)s[i];
+		switch(c) {
+			case '"':
+				fputs("\\\"", stdout);
+				break;
+			case '\\':
+				fputs("\\\\", stdout);
+				break;
+			case '\n':
+				fputs("\\n", stdout);
+				break;
+			case '\r':
+				fputs("\\r", stdout);
+				break;
+			case '\t':
+				fputs("\\t", stdout);
+				break;
+			default:
+				if(c < 0x20) {
+					printf("\\u%04x", c);
+				} else {
+					putchar(c);
+				}
+		}
+	}
+	putchar('"');
+}
+
+static void print_rec(lc_bin_hdr_t *hdr, lc_bin_rec_t *r)
+{
+	char *rname;
+	char *payload;
+
+	rname = (char *)r + sizeof(lc_bin_rec_t);
+	payload = rname + r->rlen;
+
+	if(json_mode) {
+		printf("{\"ts\":\"");
+		print_ts(r->tsus);
+		printf("\",\"tsus\":%llu,\"pid\":%d,\"pno\":%d,\"msgid\":%u,"
+			   "\"cidhash\":\"%08x\",\"route\":",
+				(unsigned long long)r->tsus, hdr->pid, hdr->pno, r->msgid,
+				r->cidhash);
+		print_json_str(rname, r->rlen);
+		printf(",\"event\":%u,\"payload\":", r->etype);
+		print_json_str(payload, r->plen);
+		printf("}\n");
+	} else {
+		print_ts(r->tsus);
+		printf(" pid=%d pno=%d msgid=%u cid=%08x route=%.*s event=%u"
+			   " payload=[%.*s]\n",
+				hdr->pid, hdr->pno, r->msgid, r->cidhash, (int)r->rlen, rname,
+				r->etype, (int)r->plen, payload);
+	}
+}
+
+static int decode_file(char *fname)
+{
+	struct stat st;
+	lc_bin_hdr_t *hdr;
+	lc_bin_rec_t *r;
+	char *ring;
+	void *p;
+	uint64_t off;
+	int fd;
+	int first;
+
+	fd = open(fname, O_RDONLY);
+	if(fd < 0) {
+		fprintf(stderr, "failed to open %s: %s\n", fname, strerror(errno));
+		return -1;
+	}
+	if(fstat(fd, &st) < 0 || st.st_size < sizeof(lc_bin_hdr_t)) {
+		fprintf(stderr, "invalid file %s\n", fname);
+		close(fd);
+		return -1;
+	}
+	p = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if(p == MAP_FAILED) {
+		fprintf(stderr, "failed to map %s: %s\n", fname, strerror(errno));
+		return -1;
+	}
+	hdr = (lc_bin_hdr_t *)p;
+	if(hdr->magic != LC_BIN_MAGIC || hdr->version != LC_BIN_VERSION
+			|| hdr->hsize != sizeof(lc_bin_hdr_t)
+			|| (uint64_t)hdr->hsize + hdr->size > st.st_size
+			|| hdr->head > hdr->size || hdr->tail > hdr->size) {
+		fprintf(stderr, "invalid or unsupported content in %s\n", fname);
+		munmap(p, st.st_size);
+		return -1;
+	}
+	ring = (char *)p + hdr->hsize;
+
+	if(!json_mode) {
+		printf("# file %s - pid %d pno %d [%s] - records %llu\n", fname,
+				hdr->pid, hdr->pno, hdr->pdesc,
+				(unsigned long long)hdr->nrecs);
+	}
+
+	off = (hdr->wrapped) ? hdr->tail : 0;
+	/* a full ring has tail==head - walk at least once around */
+	first = hdr->wrapped;
+	while(first || off != hdr->head) {
+		first = 0;
+		if(hdr->size - off < sizeof(lc_bin_rec_t)) {
+			off = 0;
+			continue;
+		}
+		r = (lc_bin_rec_t *)(ring + off);
+		if(r->size < sizeof(lc_bin_rec_t) || r->size > hdr->size - off
+				|| (r->etype != LC_BIN_EV_PAD
+						&& sizeof(lc_bin_rec_t) + r->rlen + r->plen
+								   > r->size)) {
+			fprintf(stderr, "corrupted record at offset %llu in %s\n",
+					(unsigned long long)off, fname);
+			break;
+		}
+		if(r->etype != LC_BIN_EV_PAD) {
+			print_rec(hdr, r);
+		}
+		off += r->size;
+		if(off >= hdr->size) {
+			off = 0;
+		}
+	}
+
+	munmap(p, st.st_size);
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	int c;
+	int i;
+	int ret;
+
+	while((c = getopt(argc, argv, "jh")) != -1) {
+		switch(c) {
+			case 'j':
+				json_mode = 1;
+				break;
+			case 'h':
+				print_usage(argv[0]);
+				return 0;
+			default:
+				print_usage(argv[0]);
+				return 1;
+		}
+	}
+	if(optind >= argc) {
+		print_usage(argv[0]);
+		return 1;
+	}
+
+	ret = 0;
+	for(i = optind; i < argc; i++) {
+		if(decode_file(argv[i]) < 0) {
+			ret = 1;
+		}
+	}
+	return ret;
+}